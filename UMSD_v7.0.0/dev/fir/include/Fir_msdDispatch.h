@@ -0,0 +1,646 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/********************************************************************************
+* Fir_msdDispatch.h
+*
+* DESCRIPTION:
+*       Compile time function table of Fir, used in place of the run time
+*       table when the driver is built with MSD_SINGLE_FAMILY_FIR.
+*       Every field of SwitchDevObj_ has one entry MSD_FIR_<Obj>_<field>,
+*       a pair (present, function). Entries follow InitDevObj_Fir in
+*       msdDevObj.c one to one and must be changed together with it.
+*
+* DEPENDENCIES:
+*       fir/include/Fir_msdApi.h
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef Fir_msdDispatch_h
+#define Fir_msdDispatch_h
+
+/* ATUObj */
+#define MSD_FIR_ATUObj_gfdbAddMacEntry (1, Fir_gfdbAddMacEntryIntf)
+#define MSD_FIR_ATUObj_gfdbGetAtuEntryNext (1, Fir_gfdbGetAtuEntryNextIntf)
+#define MSD_FIR_ATUObj_gfdbFlush (1, Fir_gfdbFlushIntf)
+#define MSD_FIR_ATUObj_gfdbFlushInDB (1, Fir_gfdbFlushInDBIntf)
+#define MSD_FIR_ATUObj_gfdbMove (1, Fir_gfdbMoveIntf)
+#define MSD_FIR_ATUObj_gfdbMoveInDB (1, Fir_gfdbMoveInDBIntf)
+#define MSD_FIR_ATUObj_gfdbPortRemove (1, Fir_gfdbPortRemoveIntf)
+#define MSD_FIR_ATUObj_gfdbPortRemoveInDB (1, Fir_gfdbPortRemoveInDBIntf)
+#define MSD_FIR_ATUObj_gfdbDelAtuEntry (1, Fir_gfdbDelAtuEntry)
+#define MSD_FIR_ATUObj_gfdbGetViolation (1, Fir_gfdbGetViolationIntf)
+#define MSD_FIR_ATUObj_gfdbFindAtuMacEntry (1, Fir_gfdbFindAtuMacEntryIntf)
+#define MSD_FIR_ATUObj_gfdbSetAgingTimeout (1, Fir_gfdbSetAgingTimeout)
+#define MSD_FIR_ATUObj_gfdbGetAgingTimeout (1, Fir_gfdbGetAgingTimeout)
+#define MSD_FIR_ATUObj_gfdbSetLearn2All (1, Fir_gfdbSetLearn2All)
+#define MSD_FIR_ATUObj_gfdbGetLearn2All (1, Fir_gfdbGetLearn2All)
+#define MSD_FIR_ATUObj_gfdbSetPortLearnLimit (1, Fir_gfdbSetPortLearnLimit)
+#define MSD_FIR_ATUObj_gfdbGetPortLearnLimit (1, Fir_gfdbGetPortLearnLimit)
+#define MSD_FIR_ATUObj_gfdbGetPortLearnCount (1, Fir_gfdbGetPortLearnCount)
+#define MSD_FIR_ATUObj_gfdbGetEntryCount (1, Fir_gfdbGetEntryCount)
+#define MSD_FIR_ATUObj_gfdbGetNonStaticEntryCount (1, Fir_gfdbGetNonStaticEntryCount)
+#define MSD_FIR_ATUObj_gfdbGetEntryCountPerFid (1, Fir_gfdbGetEntryCountPerFid)
+#define MSD_FIR_ATUObj_gfdbGetNonStaticEntryCountPerFid (1, Fir_gfdbGetNStaticEntryCountFid)
+#define MSD_FIR_ATUObj_gfdbGetOccupancy (1, Fir_gfdbGetOccupancy)
+#define MSD_FIR_ATUObj_gfdbDump (1, Fir_gfdbDump)
+
+/* ECIDObj */
+#define MSD_FIR_ECIDObj_gBpeEnableSet (1, Fir_gBpeEnableSet)
+#define MSD_FIR_ECIDObj_gBpeEnableGet (1, Fir_gBpeEnableGet)
+#define MSD_FIR_ECIDObj_gecidAddEntry (1, Fir_gecidAddEntryIntf)
+#define MSD_FIR_ECIDObj_gecidFlushAll (1, Fir_gecidFlushAll)
+#define MSD_FIR_ECIDObj_gecidFlushEntry (1, Fir_gecidFlushEntry)
+#define MSD_FIR_ECIDObj_gecidMove (1, Fir_gecidMove)
+#define MSD_FIR_ECIDObj_gecidGetEcidEntryNext (1, Fir_gecidGetEcidEntryNextIntf)
+#define MSD_FIR_ECIDObj_gecidFindEcidEntry (1, Fir_gecidFindEcidEntryIntf)
+#define MSD_FIR_ECIDObj_gecidGetEntryCount (1, Fir_gecidGetEntryCount)
+#define MSD_FIR_ECIDObj_gecidDump (1, Fir_gecidDump)
+
+/* VCTObj */
+#define MSD_FIR_VCTObj_gvctGetAdvCableDiag (0, ((FMSD_gvctGetAdvCableDiag)NULL))
+#define MSD_FIR_VCTObj_gvctGetAdvExtendedStatus (0, ((FMSD_gvctGetAdvExtendedStatus)NULL))
+
+/* STUObj */
+#define MSD_FIR_STUObj_gstuAddEntry (1, Fir_gstuAddEntryIntf)
+#define MSD_FIR_STUObj_gstuDelEntry (1, Fir_gstuDelEntryIntf)
+#define MSD_FIR_STUObj_gstuGetEntryNext (1, Fir_gstuGetEntryNextIntf)
+#define MSD_FIR_STUObj_gstuFindSidEntry (1, Fir_gstuFindSidEntryIntf)
+#define MSD_FIR_STUObj_gstuGetEntryCount (1, Fir_gstuGetEntryCountIntf)
+#define MSD_FIR_STUObj_gstuDump (1, Fir_gstuDump)
+
+/* VTUObj */
+#define MSD_FIR_VTUObj_gvtuFindVidEntry (1, Fir_gvtuFindVidEntryIntf)
+#define MSD_FIR_VTUObj_gvtuExistVidEntry (1, Fir_gvtuExistVidEntryIntf)
+#define MSD_FIR_VTUObj_gvtuFlush (1, Fir_gvtuFlushIntf)
+#define MSD_FIR_VTUObj_gvtuAddEntry (1, Fir_gvtuAddEntryIntf)
+#define MSD_FIR_VTUObj_gvtuGetEntryNext (1, Fir_gvtuGetEntryNextIntf)
+#define MSD_FIR_VTUObj_gvtuDelEntry (1, Fir_gvtuDelEntryIntf)
+#define MSD_FIR_VTUObj_gvtuSetMode (1, Fir_gvtuSetModeIntf)
+#define MSD_FIR_VTUObj_gvtuGetMode (1, Fir_gvtuGetModeIntf)
+#define MSD_FIR_VTUObj_gvtuGetViolation (1, Fir_gvtuGetViolationIntf)
+#define MSD_FIR_VTUObj_gvtuGetEntryCount (1, Fir_gvtuGetEntryCountIntf)
+#define MSD_FIR_VTUObj_gvtuSetMemberTag (1, Fir_gvtuSetMemberTagIntf)
+#define MSD_FIR_VTUObj_gvtuGetMemberTag (1, Fir_gvtuGetMemberTagIntf)
+#define MSD_FIR_VTUObj_gvtuDump (1, Fir_gvtuDump)
+
+/* IMPObj */
+#define MSD_FIR_IMPObj_impRun (0, ((FMSD_impRun)NULL))
+#define MSD_FIR_IMPObj_impReset (0, ((FMSD_impReset)NULL))
+#define MSD_FIR_IMPObj_impWriteEEPROM (0, ((FMSD_impWriteEEPROM)NULL))
+#define MSD_FIR_IMPObj_impLoadToEEPROM (0, ((FMSD_impLoadToEEPROM)NULL))
+#define MSD_FIR_IMPObj_impLoadToRAM (0, ((FMSD_impLoadToRAM)NULL))
+#define MSD_FIR_IMPObj_impStop (0, ((FMSD_impStop)NULL))
+
+/* EEPROMObj */
+#define MSD_FIR_EEPROMObj_geepromWrite (1, Fir_EEPROMWriteIntf)
+#define MSD_FIR_EEPROMObj_geepromRead (1, Fir_EEPROMReadIntf)
+#define MSD_FIR_EEPROMObj_geepromSetMChipSel (1, Fir_EEPROMChipSelSetIntf)
+#define MSD_FIR_EEPROMObj_geepromGetMChipSel (1, Fir_EEPROMChipSelGetIntf)
+#define MSD_FIR_EEPROMObj_geepromReadBlock (1, Fir_EEPROMReadBlockIntf)
+#define MSD_FIR_EEPROMObj_geepromWriteBlock (1, Fir_EEPROMWriteBlockIntf)
+
+/* PHYCTRLObj */
+#define MSD_FIR_PHYCTRLObj_gphyReset (0, ((FMSD_gphyReset)NULL))
+#define MSD_FIR_PHYCTRLObj_serdesReset (1, Fir_serdesReset)
+#define MSD_FIR_PHYCTRLObj_gphySetPortLoopback (0, ((FMSD_gphySetPortLoopback)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetPortSpeed (0, ((FMSD_gphySetPortSpeed)NULL))
+#define MSD_FIR_PHYCTRLObj_gphyPortPowerDown (0, ((FMSD_gphyPortPowerDown)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetPortDuplexMode (0, ((FMSD_gphySetPortDuplexMode)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetPortAutoMode (0, ((FMSD_gphySetPortAutoMode)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetEEE (0, ((FMSD_gphySetEEE)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetFlowControlEnable (0, ((FMSD_gphySetFlowControlEnable)NULL))
+#define MSD_FIR_PHYCTRLObj_gphySetIntEnable (0, ((FMSD_gphySetIntEnable)NULL))
+#define MSD_FIR_PHYCTRLObj_gphyGetIntEnable (0, ((FMSD_gphyGetIntEnable)NULL))
+#define MSD_FIR_PHYCTRLObj_gphyGetIntStatus (0, ((FMSD_gphyGetIntStatus)NULL))
+
+/* PIRLObj */
+#define MSD_FIR_PIRLObj_gpirlInitialize (1, Fir_gpirlInitializeIntf)
+#define MSD_FIR_PIRLObj_gpirlInitResource (1, Fir_gpirlInitResourceIntf)
+#define MSD_FIR_PIRLObj_gpirlCustomSetup (1, Fir_gpirlCustomSetup_sr2cIntf)
+#define MSD_FIR_PIRLObj_gpirlReadResource (1, Fir_gpirlReadResourceIntf)
+#define MSD_FIR_PIRLObj_gpirlWriteResource (1, Fir_gpirlWriteResourceIntf)
+#define MSD_FIR_PIRLObj_gpirlGetResReg (1, Fir_gpirlGetResRegIntf)
+#define MSD_FIR_PIRLObj_gpirlSetResReg (1, Fir_gpirlSetResRegIntf)
+#define MSD_FIR_PIRLObj_gpirlAdvConfig (1, Fir_gpirlAdvConfigIntf)
+#define MSD_FIR_PIRLObj_gpirlAdvConfigDisable (1, Fir_gpirlAdvConfigDisableIntf)
+
+/* PORTCTRLObj */
+#define MSD_FIR_PORTCTRLObj_gvlnSetPortVid (1, Fir_gvlnSetPortVid)
+#define MSD_FIR_PORTCTRLObj_gvlnGetPortVid (1, Fir_gvlnGetPortVid)
+#define MSD_FIR_PORTCTRLObj_gvlnSetPortVlanDot1qMode (1, Fir_gvlnSetPortVlanQModeIntf)
+#define MSD_FIR_PORTCTRLObj_gvlnGetPortVlanDot1qMode (1, Fir_gvlnGetPortVlanQModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetDiscardTagged (1, Fir_gprtSetDiscardTaggedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDiscardTagged (1, Fir_gprtGetDiscardTaggedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetDiscardUntagged (1, Fir_gprtSetDiscardUntaggedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDiscardUntagged (1, Fir_gprtGetDiscardUntaggedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetUnicastFloodBlock (1, Fir_gprtSetUnicFloodBlockIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetUnicastFloodBlock (1, Fir_gprtGetUnicFloodBlockIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetMulticastFloodBlock (1, Fir_gprtSetMultiFloodBlockIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetMulticastFloodBlock (1, Fir_gprtGetMultiFloodBlockIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetDiscardBCastMode (1, Fir_gprtSetDiscardBCastModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDiscardBCastMode (1, Fir_gprtGetDiscardBCastModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetIGMPSnoopEnable (1, Fir_gprtSetIGMPSnoopEnable)
+#define MSD_FIR_PORTCTRLObj_gprtGetIGMPSnoopEnable (1, Fir_gprtGetIGMPSnoopEnable)
+#define MSD_FIR_PORTCTRLObj_gprtSetHeaderMode (1, Fir_gprtSetHeaderMode)
+#define MSD_FIR_PORTCTRLObj_gprtGetHeaderMode (1, Fir_gprtGetHeaderMode)
+#define MSD_FIR_PORTCTRLObj_gprtSetDropOnLock (1, Fir_gprtSetDropOnLock)
+#define MSD_FIR_PORTCTRLObj_gprtGetDropOnLock (1, Fir_gprtGetDropOnLock)
+#define MSD_FIR_PORTCTRLObj_gprtSetJumboMode (1, Fir_gprtSetJumboModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetJumboMode (1, Fir_gprtGetJumboModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetSpecifiedMTU (1, Fir_gprtSetSpecifiedMTUIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetSpecifiedMTU (1, Fir_gprtGetSpecifiedMTUIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetLearnEnable (1, Fir_gprtSetLearnEnableIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetLearnEnable (1, Fir_gprtGetLearnEnableIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetVTUPriorityOverride (1, Fir_gprtSetVTUPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetVTUPriorityOverride (1, Fir_gprtGetVTUPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetSAPriorityOverride (1, Fir_gprtSetSAPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetSAPriorityOverride (1, Fir_gprtGetSAPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetDAPriorityOverride (1, Fir_gprtSetDAPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDAPriorityOverride (1, Fir_gprtGetDAPriOverrideIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetMessagePort (1, Fir_gprtSetMessagePort)
+#define MSD_FIR_PORTCTRLObj_gprtGetMessagePort (1, Fir_gprtGetMessagePort)
+#define MSD_FIR_PORTCTRLObj_gprtSetEtherType (1, Fir_gprtSetEtherType)
+#define MSD_FIR_PORTCTRLObj_gprtGetEtherType (1, Fir_gprtGetEtherType)
+#define MSD_FIR_PORTCTRLObj_gprtSetAllowVidZero (1, Fir_gprtSetAllowVidZero)
+#define MSD_FIR_PORTCTRLObj_gprtGetAllowVidZero (1, Fir_gprtGetAllowVidZero)
+#define MSD_FIR_PORTCTRLObj_gprtSetFlowCtrl (1, Fir_gprtSetFlowCtrlIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetFlowCtrl (1, Fir_gprtGetFlowCtrlIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetForceSpeed (1, Fir_gprtSetForceSpeedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetForceSpeed (1, Fir_gprtGetForceSpeedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetEgressMonitorSource (1, Fir_gprtSetEgressMonitorSource)
+#define MSD_FIR_PORTCTRLObj_gprtGetEgressMonitorSource (1, Fir_gprtGetEgressMonitorSource)
+#define MSD_FIR_PORTCTRLObj_gprtSetIngressMonitorSource (1, Fir_gprtSetIngressMonitorSource)
+#define MSD_FIR_PORTCTRLObj_gprtGetIngressMonitorSource (1, Fir_gprtGetIngressMonitorSource)
+#define MSD_FIR_PORTCTRLObj_grcSetEgressRate (1, Fir_grcSetEgressRateIntf)
+#define MSD_FIR_PORTCTRLObj_grcGetEgressRate (1, Fir_grcGetEgressRateIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDuplex (1, Fir_gprtGetDuplexIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetDuplex (1, Fir_gprtSetDuplexIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetDuplexStatus (1, Fir_gprtGetDuplexStatusIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetForceLink (1, Fir_gprtGetForceLinkIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetForceLink (1, Fir_gprtSetForceLinkIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetLinkState (1, Fir_gprtGetLinkState)
+#define MSD_FIR_PORTCTRLObj_gprtGetSpeed (1, Fir_gprtGetSpeedIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetCutThrouthEnable (0, ((FMSD_gprtSetCutThrouthEnable)NULL))
+#define MSD_FIR_PORTCTRLObj_gprtGetCutThrouthEnable (0, ((FMSD_gprtGetCutThrouthEnable)NULL))
+#define MSD_FIR_PORTCTRLObj_gprtSetIgnoreFcs (1, Fir_gprtSetIgnoreFcs)
+#define MSD_FIR_PORTCTRLObj_gprtGetIgnoreFcs (1, Fir_gprtGetIgnoreFcs)
+#define MSD_FIR_PORTCTRLObj_gprtSetAllowBadFcs (1, Fir_gprtSetAllowBadFcs)
+#define MSD_FIR_PORTCTRLObj_gprtGetAllowBadFcs (1, Fir_gprtGetAllowBadFcs)
+#define MSD_FIR_PORTCTRLObj_gprtSetPauseLimitOut (1, Fir_gprtSetPauseLimitOut)
+#define MSD_FIR_PORTCTRLObj_gprtGetPauseLimitOut (1, Fir_gprtGetPauseLimitOut)
+#define MSD_FIR_PORTCTRLObj_gprtSetPauseLimitIn (1, Fir_gprtSetPauseLimitIn)
+#define MSD_FIR_PORTCTRLObj_gprtGetPauseLimitIn (1, Fir_gprtGetPauseLimitIn)
+#define MSD_FIR_PORTCTRLObj_gprtSetQueueToPause (1, Fir_gprtSetQueueToPause)
+#define MSD_FIR_PORTCTRLObj_gprtGetQueueToPause (1, Fir_gprtGetQueueToPause)
+#define MSD_FIR_PORTCTRLObj_gprtSetRxPriorityFlowControlEnable (1, Fir_gprtSetRxPriFlowCtrlEnable)
+#define MSD_FIR_PORTCTRLObj_gprtGetRxPriorityFlowControlEnable (1, Fir_gprtGetRxPriFlowCtrlEnable)
+#define MSD_FIR_PORTCTRLObj_gprtSetRxPriorityFlowControlToQueue (1, Fir_gprtSetRxPriFlowCtrlToQueue)
+#define MSD_FIR_PORTCTRLObj_gprtGetRxPriorityFlowControlToQueue (1, Fir_gprtGetRxPriFlowCtrlToQueue)
+#define MSD_FIR_PORTCTRLObj_gprtSetTxPriorityFlowControlEnable (1, Fir_gprtSetTxPriFlowCtrlEnable)
+#define MSD_FIR_PORTCTRLObj_gprtGetTxPriorityFlowControlEnable (1, Fir_gprtGetTxPriFlowCtrlEnable)
+#define MSD_FIR_PORTCTRLObj_gprtGetOutQueueSize (1, Fir_gprtGetOutQueueSize)
+#define MSD_FIR_PORTCTRLObj_gprtSetMapDA (1, Fir_gprtSetMapDA)
+#define MSD_FIR_PORTCTRLObj_gprtGetMapDA (1, Fir_gprtGetMapDA)
+#define MSD_FIR_PORTCTRLObj_gprtSetPortLocked (1, Fir_gprtSetPortLocked)
+#define MSD_FIR_PORTCTRLObj_gprtGetPortLocked (1, Fir_gprtGetPortLocked)
+#define MSD_FIR_PORTCTRLObj_gprtSetHoldAt1 (1, Fir_gprtSetHoldAt1)
+#define MSD_FIR_PORTCTRLObj_gprtGetHoldAt1 (1, Fir_gprtGetHoldAt1)
+#define MSD_FIR_PORTCTRLObj_gprtSetInt0nAgeOut (1, Fir_gprtSetInt0nAgeOut)
+#define MSD_FIR_PORTCTRLObj_gprtGetInt0nAgeOut (1, Fir_gprtGetInt0nAgeOut)
+#define MSD_FIR_PORTCTRLObj_gprtSetRefreshLocked (1, Fir_gprtSetRefreshLocked)
+#define MSD_FIR_PORTCTRLObj_gprtGetRefreshLocked (1, Fir_gprtGetRefreshLocked)
+#define MSD_FIR_PORTCTRLObj_gprtSetIgnoreWrongData (1, Fir_gprtSetIgnoreWrongData)
+#define MSD_FIR_PORTCTRLObj_gprtGetIgnoreWrongData (1, Fir_gprtGetIgnoreWrongData)
+#define MSD_FIR_PORTCTRLObj_gprtSetARPMirror (1, Fir_gprtSetARPMirror)
+#define MSD_FIR_PORTCTRLObj_gprtGetARPMirror (1, Fir_gprtGetARPMirror)
+#define MSD_FIR_PORTCTRLObj_gprtSetVlanPorts (1, Fir_gprtSetVlanPorts)
+#define MSD_FIR_PORTCTRLObj_gprtGetVlanPorts (1, Fir_gprtGetVlanPorts)
+#define MSD_FIR_PORTCTRLObj_gprtSetForceDefaultVid (1, Fir_gprtSetForceDefaultVid)
+#define MSD_FIR_PORTCTRLObj_gprtGetForceDefaultVid (1, Fir_gprtGetForceDefaultVid)
+#define MSD_FIR_PORTCTRLObj_gprtSetFrameMode (1, Fir_gprtSetFrameModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetFrameMode (1, Fir_gprtGetFrameModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetPortECID (1, Fir_gprtSetPortECID)
+#define MSD_FIR_PORTCTRLObj_gprtGetPortECID (1, Fir_gprtGetPortECID)
+#define MSD_FIR_PORTCTRLObj_gprtSetIgnoreETag (1, Fir_gprtSetIgnoreETag)
+#define MSD_FIR_PORTCTRLObj_gprtGetIgnoreETag (1, Fir_gprtGetIgnoreETag)
+#define MSD_FIR_PORTCTRLObj_gprtSetEgressMode (1, Fir_gprtSetEgressModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetEgressMode (1, Fir_gprtGetEgressModeIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetExtendedPortCtrlReg (1, Fir_gprtSetExtendedPortCtrlReg)
+#define MSD_FIR_PORTCTRLObj_gprtGetExtendedPortCtrlReg (1, Fir_gprtGetExtendedPortCtrlReg)
+#define MSD_FIR_PORTCTRLObj_gprtSetPortState (1, Fir_gprtSetPortStateIntf)
+#define MSD_FIR_PORTCTRLObj_gprtGetPortState (1, Fir_gprtGetPortStateIntf)
+#define MSD_FIR_PORTCTRLObj_gprtSetPreemptEnable (1, Fir_gprtSetPreemptEnable)
+#define MSD_FIR_PORTCTRLObj_gprtGetPreemptEnable (1, Fir_gprtGetPreemptEnable)
+#define MSD_FIR_PORTCTRLObj_gprtSetPreemptSize (1, Fir_gprtSetPreemptSize)
+#define MSD_FIR_PORTCTRLObj_gprtGetPreemptSize (1, Fir_gprtGetPreemptSize)
+#define MSD_FIR_PORTCTRLObj_gprtSetPreemptQueue (1, Fir_gprtSetPreemptQueue)
+#define MSD_FIR_PORTCTRLObj_gprtGetPreemptQueue (1, Fir_gprtGetPreemptQueue)
+#define MSD_FIR_PORTCTRLObj_gprtRegDump (1, Fir_gprtRegDump)
+
+/* POLICYObj */
+#define MSD_FIR_POLICYObj_gpolicySetMgmtCtrl (1, Fir_gpolicySetMgmtCtrl)
+#define MSD_FIR_POLICYObj_gpolicyGetMgmtCtrl (1, Fir_gpolicyGetMgmtCtrl)
+#define MSD_FIR_POLICYObj_gpolicySetCpuDest (1, Fir_gpolicySetCpuDest)
+#define MSD_FIR_POLICYObj_gpolicyGetCpuDest (1, Fir_gpolicyGetCpuDest)
+#define MSD_FIR_POLICYObj_gpolicySetIngressMonitorDest (1, Fir_gpolicySetIgrMonitorDest)
+#define MSD_FIR_POLICYObj_gpolicyGetIngressMonitorDest (1, Fir_gpolicyGetIgrMonitorDest)
+#define MSD_FIR_POLICYObj_gpolicySetRsvd2CpuEnables (1, Fir_gpolicySetRsvd2CpuEnables)
+#define MSD_FIR_POLICYObj_gpolicyGetRsvd2CpuEnables (1, Fir_gpolicyGetRsvd2CpuEnables)
+#define MSD_FIR_POLICYObj_gpolicySetMGMTPri (1, Fir_gpolicySetMGMTPri)
+#define MSD_FIR_POLICYObj_gpolicyGetMGMTPri (1, Fir_gpolicyGetMGMTPri)
+#define MSD_FIR_POLICYObj_gpolicySetRouteDest (1, Fir_gpolicySetRouteDest)
+#define MSD_FIR_POLICYObj_gpolicyGetRouteDest (1, Fir_gpolicyGetRouteDest)
+#define MSD_FIR_POLICYObj_gpolicySetMirrorDest (1, Fir_gpolicySetMirrorDest)
+#define MSD_FIR_POLICYObj_gpolicyGetMirrorDest (1, Fir_gpolicyGetMirrorDest)
+#define MSD_FIR_POLICYObj_gpolicySetIllegalIPAddr (1, Fir_gpolicySetIllegalIPAddr)
+#define MSD_FIR_POLICYObj_gpolicyGetIllegalIPAddr (1, Fir_gpolicyGetIllegalIPAddr)
+#define MSD_FIR_POLICYObj_gpolicySetDipDaMismatch (1, Fir_gpolicySetDipDaMismatch)
+#define MSD_FIR_POLICYObj_gpolicyGetDipDaMismatch (1, Fir_gpolicyGetDipDaMismatch)
+#define MSD_FIR_POLICYObj_gpolicySetZeroSIP (1, Fir_gpolicySetZeroSIP)
+#define MSD_FIR_POLICYObj_gpolicyGetZeroSIP (1, Fir_gpolicyGetZeroSIP)
+#define MSD_FIR_POLICYObj_gpolicySetMcTtlExceeded (1, Fir_gpolicySetMcTtlExceeded)
+#define MSD_FIR_POLICYObj_gpolicyGetMcTtlExceeded (1, Fir_gpolicyGetMcTtlExceeded)
+#define MSD_FIR_POLICYObj_gpolicySetUcTtlExceeded (1, Fir_gpolicySetUcTtlExceeded)
+#define MSD_FIR_POLICYObj_gpolicyGetUcTtlExceeded (1, Fir_gpolicyGetUcTtlExceeded)
+#define MSD_FIR_POLICYObj_gprtSetPortTtlThreshold (1, Fir_gprtSetPortTtlThreshold)
+#define MSD_FIR_POLICYObj_gprtGetPortTtlThreshold (1, Fir_gprtGetPortTtlThreshold)
+#define MSD_FIR_POLICYObj_gpolicySetIpHdrErr (1, Fir_gpolicySetIpHdrErr)
+#define MSD_FIR_POLICYObj_gpolicyGetIpHdrErr (1, Fir_gpolicyGetIpHdrErr)
+#define MSD_FIR_POLICYObj_gpolicySetTCPFinUrgPsh (1, Fir_gpolicySetTCPFinUrgPsh)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPFinUrgPsh (1, Fir_gpolicyGetTCPFinUrgPsh)
+#define MSD_FIR_POLICYObj_gpolicySetTCPFlagsSeqNum (1, Fir_gpolicySetTCPFlagsSeqNum)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPFlagsSeqNum (1, Fir_gpolicyGetTCPFlagsSeqNum)
+#define MSD_FIR_POLICYObj_gpolicySetTCPSYN (1, Fir_gpolicySetTCPSYN)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPSYN (1, Fir_gpolicyGetTCPSYN)
+#define MSD_FIR_POLICYObj_gpolicySetTCPHSize (1, Fir_gpolicySetTCPHSize)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPHSize (1, Fir_gpolicyGetTCPHSize)
+#define MSD_FIR_POLICYObj_gprtSetPortTCPMinHdrSize (1, Fir_gprtSetPortTCPMinHdrSize)
+#define MSD_FIR_POLICYObj_gprtGetPortTCPMinHdrSize (1, Fir_gprtGetPortTCPMinHdrSize)
+#define MSD_FIR_POLICYObj_gpolicySetICMPSize (1, Fir_gpolicySetICMPSize)
+#define MSD_FIR_POLICYObj_gpolicyGetICMPSize (1, Fir_gpolicyGetICMPSize)
+#define MSD_FIR_POLICYObj_gprtSetPortICMPMaxSize (1, Fir_gprtSetPortICMPMaxSize)
+#define MSD_FIR_POLICYObj_gprtGetPortICMPMaxSize (1, Fir_gprtGetPortICMPMaxSize)
+#define MSD_FIR_POLICYObj_gpolicySetUDPPort (1, Fir_gpolicySetUDPPort)
+#define MSD_FIR_POLICYObj_gpolicyGetUDPPort (1, Fir_gpolicyGetUDPPort)
+#define MSD_FIR_POLICYObj_gpolicySetTCPPort (1, Fir_gpolicySetTCPPort)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPPort (1, Fir_gpolicyGetTCPPort)
+#define MSD_FIR_POLICYObj_gpolicySetTCPSynFin (1, Fir_gpolicySetTCPSynFin)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPSynFin (1, Fir_gpolicyGetTCPSynFin)
+#define MSD_FIR_POLICYObj_gpolicySetTCPFrag (1, Fir_gpolicySetTCPFrag)
+#define MSD_FIR_POLICYObj_gpolicyGetTCPFrag (1, Fir_gpolicyGetTCPFrag)
+#define MSD_FIR_POLICYObj_gpolicySetNearNonTPMR (1, Fir_gpolicySetNearNonTPMR)
+#define MSD_FIR_POLICYObj_gpolicyGetNearNonTPMR (1, Fir_gpolicyGetNearNonTPMR)
+#define MSD_FIR_POLICYObj_gpolicySetETag (1, Fir_gpolicySetETag)
+#define MSD_FIR_POLICYObj_gpolicyGetETag (1, Fir_gpolicyGetETag)
+#define MSD_FIR_POLICYObj_gpolicySetNonETag (1, Fir_gpolicySetNonETag)
+#define MSD_FIR_POLICYObj_gpolicyGetNonETag (1, Fir_gpolicyGetNonETag)
+#define MSD_FIR_POLICYObj_gpolicyDump (1, Fir_gpolicyDump)
+
+/* QOSMAPObj */
+#define MSD_FIR_QOSMAPObj_gqosSetPrioMapRule (1, Fir_gqosSetPrioMapRuleIntf)
+#define MSD_FIR_QOSMAPObj_gqosGetPrioMapRule (1, Fir_gqosGetPrioMapRuleIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetInitialPri (1, Fir_gprtSetInitialPriIntf)
+#define MSD_FIR_QOSMAPObj_gprtGetInitialPri (1, Fir_gprtGetInitialPriIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetDefQpri (1, Fir_gprtSetDefQpriIntf)
+#define MSD_FIR_QOSMAPObj_gprtGetDefQpri (1, Fir_gprtGetDefQpriIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetDefFpri (1, Fir_gprtSetDefFpri)
+#define MSD_FIR_QOSMAPObj_gprtGetDefFpri (1, Fir_gprtGetDefFpri)
+#define MSD_FIR_QOSMAPObj_gprtSetIEEEPrioMap (1, Fir_gprtSetIEEEPrioMapIntf)
+#define MSD_FIR_QOSMAPObj_gprtGetIEEEPrioMap (1, Fir_gprtGetIEEEPrioMapIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetCosToQueue (1, Fir_gprtSetCosToQueue)
+#define MSD_FIR_QOSMAPObj_gprtGetCosToQueue (1, Fir_gprtGetCosToQueue)
+#define MSD_FIR_QOSMAPObj_gprtSetCosToDscp (1, Fir_gprtSetCosToDscp)
+#define MSD_FIR_QOSMAPObj_gprtGetCosToDscp (1, Fir_gprtGetCosToDscp)
+#define MSD_FIR_QOSMAPObj_gprtRewriteDscp (1, Fir_gprtRewriteDscp)
+#define MSD_FIR_QOSMAPObj_gprtSetIEEEPrioMapTable (1, Fir_gprtSetIEEEPrioMapTableIntf)
+#define MSD_FIR_QOSMAPObj_gprtGetIEEEPrioMapTable (1, Fir_gprtGetIEEEPrioMapTableIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetIEEEPrioMapTablePorts (1, Fir_gprtSetIEEEPrioMapTablePortsIntf)
+#define MSD_FIR_QOSMAPObj_gprtSetCosToQueueTable (1, Fir_gprtSetCosToQueueTable)
+#define MSD_FIR_QOSMAPObj_gprtSetCosToDscpTable (1, Fir_gprtSetCosToDscpTable)
+
+/* PORTRMONObj */
+#define MSD_FIR_PORTRMONObj_gstatsFlushAll (1, Fir_gstatsFlushAll)
+#define MSD_FIR_PORTRMONObj_gstatsFlushPort (1, Fir_gstatsFlushPort)
+#define MSD_FIR_PORTRMONObj_gstatsGetPortCounter (1, Fir_gstatsGetPortCounterIntf)
+#define MSD_FIR_PORTRMONObj_gstatsGetPortAllCounters (1, Fir_gstatsGetPortAllCntersIntf)
+#define MSD_FIR_PORTRMONObj_gstatsGetHistogramMode (1, Fir_gstatsGetHistogramModeIntf)
+#define MSD_FIR_PORTRMONObj_gstatsSetHistogramMode (1, Fir_gstatsSetHistogramModeIntf)
+#define MSD_FIR_PORTRMONObj_gmibDump (1, Fir_gmibDump)
+
+/* TrunkObj */
+#define MSD_FIR_TrunkObj_gsysSetTrunkMaskTable (1, Fir_gsysSetTrunkMaskTable)
+#define MSD_FIR_TrunkObj_gsysGetTrunkMaskTable (1, Fir_gsysGetTrunkMaskTable)
+#define MSD_FIR_TrunkObj_gsysSetHashTrunk (1, Fir_gsysSetHashTrunk)
+#define MSD_FIR_TrunkObj_gsysGetHashTrunk (1, Fir_gsysGetHashTrunk)
+#define MSD_FIR_TrunkObj_gsysSetTrunkRouting (1, Fir_gsysSetTrunkRouting)
+#define MSD_FIR_TrunkObj_gsysGetTrunkRouting (1, Fir_gsysGetTrunkRouting)
+#define MSD_FIR_TrunkObj_gprtSetTrunkPort (1, Fir_gprtSetTrunkPort)
+#define MSD_FIR_TrunkObj_gprtGetTrunkPort (1, Fir_gprtGetTrunkPort)
+
+/* QUEUEObj */
+#define MSD_FIR_QUEUEObj_gprtSetQueueCtrl (1, Fir_gprtSetQueueCtrlIntf)
+#define MSD_FIR_QUEUEObj_gprtGetQueueCtrl (1, Fir_gprtGetQueueCtrlIntf)
+#define MSD_FIR_QUEUEObj_gprtSetPortSched (1, Fir_gprtSetPortSchedIntf)
+#define MSD_FIR_QUEUEObj_gprtGetPortSched (1, Fir_gprtGetPortSchedIntf)
+#define MSD_FIR_QUEUEObj_gsysSetQoSWeight (0, ((FMSD_gsysSetQoSWeight)NULL))
+#define MSD_FIR_QUEUEObj_gsysGetQoSWeight (0, ((FMSD_gsysGetQoSWeight)NULL))
+#define MSD_FIR_QUEUEObj_gprtSetQoSWeight (1, Fir_gprtSetQoSWeightIntf)
+#define MSD_FIR_QUEUEObj_gprtGetQoSWeight (1, Fir_gprtGetQoSWeightIntf)
+
+/* SYSCTRLObj */
+#define MSD_FIR_SYSCTRLObj_gsysSetFloodBC (1, Fir_gsysSetFloodBC)
+#define MSD_FIR_SYSCTRLObj_gsysGetFloodBC (1, Fir_gsysGetFloodBC)
+#define MSD_FIR_SYSCTRLObj_gsysSetMonitorMgmtCtrl (0, ((FMSD_gsysSetMonitorMgmtCtrl)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysGetMonitorMgmtCtrl (0, ((FMSD_gsysGetMonitorMgmtCtrl)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysSetCPUDest (0, ((FMSD_gsysSetCPUDest)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysGetCPUDest (0, ((FMSD_gsysGetCPUDest)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysSetIngressMonitorDest (0, ((FMSD_gsysSetIngressMonitorDest)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysGetIngressMonitorDest (0, ((FMSD_gsysGetIngressMonitorDest)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysSetEgressMonitorDest (1, Fir_gsysSetEgressMonitorDest)
+#define MSD_FIR_SYSCTRLObj_gsysGetEgressMonitorDest (1, Fir_gsysGetEgressMonitorDest)
+#define MSD_FIR_SYSCTRLObj_gsysSetRsvd2CpuEnables (0, ((FMSD_gsysSetRsvd2CpuEnables)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysGetRsvd2CpuEnables (0, ((FMSD_gsysGetRsvd2CpuEnables)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysSetMGMTPri (0, ((FMSD_gsysSetMGMTPri)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysGetMGMTPri (0, ((FMSD_gsysGetMGMTPri)NULL))
+#define MSD_FIR_SYSCTRLObj_gsysSetSMISetup (1, Fir_gsysSetSMISetup)
+#define MSD_FIR_SYSCTRLObj_gsysGetSMISetup (1, Fir_gsysGetSMISetup)
+#define MSD_FIR_SYSCTRLObj_gsysGlobal1RegDump (1, Fir_gsysGlobal1RegDump)
+#define MSD_FIR_SYSCTRLObj_gsysGlobal2RegDump (1, Fir_gsysGlobal2RegDump)
+#define MSD_FIR_SYSCTRLObj_gsysSetRMUMode (1, Fir_gsysSetRMUMode)
+#define MSD_FIR_SYSCTRLObj_gsysGetRMUMode (1, Fir_gsysGetRMUMode)
+#define MSD_FIR_SYSCTRLObj_gsysQbvWrite (1, Fir_gsysQbvWrite)
+#define MSD_FIR_SYSCTRLObj_gsysQbvRead (1, Fir_gsysQbvRead)
+
+/* QAVObj */
+#define MSD_FIR_QAVObj_gqavSetPortQpriXRate (1, Fir_gqavSetPortQpriXRate)
+#define MSD_FIR_QAVObj_gqavGetPortQpriXRate (1, Fir_gqavGetPortQpriXRate)
+#define MSD_FIR_QAVObj_gqavSetPortQpriXHiLimit (1, Fir_gqavSetPortQpriXHiLimit)
+#define MSD_FIR_QAVObj_gqavGetPortQpriXHiLimit (1, Fir_gqavGetPortQpriXHiLimit)
+
+/* PTPObj */
+#define MSD_FIR_PTPObj_gptpSetIntEnable (1, Fir_gptpSetIntEnableIntf)
+#define MSD_FIR_PTPObj_gptpGetIntEnable (1, Fir_gptpGetIntEnableIntf)
+#define MSD_FIR_PTPObj_gptpSetProtPTPEn (1, Fir_gptpSetPortPTPEn)
+#define MSD_FIR_PTPObj_gptpGetProtPTPEn (1, Fir_gptpGetPortPTPEn)
+#define MSD_FIR_PTPObj_gptpSetPortConfig (0, ((FMSD_gptpSetPortConfig)NULL))
+#define MSD_FIR_PTPObj_gptpGetPortConfig (0, ((FMSD_gptpGetPortConfig)NULL))
+#define MSD_FIR_PTPObj_gptpGetTimeStamp (1, Fir_gptpGetTimeStampIntf)
+#define MSD_FIR_PTPObj_gptpGetTSValidSt (1, Fir_gptpGetTSValidSt)
+#define MSD_FIR_PTPObj_gptpResetTimeStamp (1, Fir_gptpResetTimeStamp)
+#define MSD_FIR_PTPObj_gptpTimeStampHarvest (1, Fir_gptpTimeStampHarvest)
+#define MSD_FIR_PTPObj_gptpSetGlobalConfig (0, ((FMSD_gptpSetGlobalConfig)NULL))
+#define MSD_FIR_PTPObj_gptpGetGlobalConfig (0, ((FMSD_gptpGetGlobalConfig)NULL))
+#define MSD_FIR_PTPObj_gptpGetIntStatus (1, Fir_gptpGetIntStatusIntf)
+#define MSD_FIR_PTPObj_gptpSetMeanPathDelay (1, Fir_gptpSetMeanPathDelay)
+#define MSD_FIR_PTPObj_gptpGetMeanPathDelay (1, Fir_gptpGetMeanPathDelay)
+#define MSD_FIR_PTPObj_gptpSetIgrPathDelayAsym (1, Fir_gptpSetIgrPathDelayAsym)
+#define MSD_FIR_PTPObj_gptpGetIgrPathDelayAsym (1, Fir_gptpGetIgrPathDelayAsym)
+#define MSD_FIR_PTPObj_gptpSetEgrPathDelayAsym (1, Fir_gptpSetEgrPathDelayAsym)
+#define MSD_FIR_PTPObj_gptpGetEgrPathDelayAsym (1, Fir_gptpGetEgrPathDelayAsym)
+#define MSD_FIR_PTPObj_gptpSetMode (0, ((FMSD_gptpSetMode)NULL))
+#define MSD_FIR_PTPObj_gptpGetMode (0, ((FMSD_gptpGetMode)NULL))
+#define MSD_FIR_PTPObj_gptpSetMasterSlave (0, ((FMSD_gptpSetMasterSlave)NULL))
+#define MSD_FIR_PTPObj_gptpGetMasterSlave (0, ((FMSD_gptpGetMasterSlave)NULL))
+#define MSD_FIR_PTPObj_gptpGetTODBusyBitStatus (1, Fir_gptpGetTODBusyBitStatus)
+#define MSD_FIR_PTPObj_gptpTODStoreCompensation (1, Fir_gptpTODStoreCompenIntf)
+#define MSD_FIR_PTPObj_gptpTODStoreAll (1, Fir_gptpTODStoreAllIntf)
+#define MSD_FIR_PTPObj_gptpTODCaptureAll (1, Fir_gptpTODCaptureAllIntf)
+#define MSD_FIR_PTPObj_gptpSetPulse (1, Fir_gptpSetPulseIntf)
+#define MSD_FIR_PTPObj_gptpGetPulse (1, Fir_gptpGetPulseIntf)
+#define MSD_FIR_PTPObj_gtaiGetPTPGlobalTime (1, Fir_gtaiGetPTPGlobalTime)
+#define MSD_FIR_PTPObj_gtaiGetPTPGlobalTimeSample (1, Fir_gtaiGetPTPGlobalTimeSample)
+#define MSD_FIR_PTPObj_gptpGetPortReg (1, Fir_gptpPortRegGet)
+#define MSD_FIR_PTPObj_gptpSetPortReg (1, Fir_gptpPortRegSet)
+#define MSD_FIR_PTPObj_gptpGetGlobalReg (1, Fir_gptpGlobalRegGet)
+#define MSD_FIR_PTPObj_gptpSetGlobalReg (1, Fir_gptpGlobalRegSet)
+#define MSD_FIR_PTPObj_gptpGetTaiReg (1, Fir_gTaiRegGet)
+#define MSD_FIR_PTPObj_gptpSetTaiReg (1, Fir_gTaiRegSet)
+#define MSD_FIR_PTPObj_gptpSet1588v2Config (1, Fir_gptp1588v2ConfigSetIntf)
+#define MSD_FIR_PTPObj_gptpSet8021asConfig (1, Fir_gptp8021asConfigSetIntf)
+#define MSD_FIR_PTPObj_gptpSet8021asRevConfig (1, Fir_gptp8021asRevConfigSetIntf)
+#define MSD_FIR_PTPObj_gptpSetPreemptTsSel (1, Fir_gptpPreemptTimestampSelSet)
+#define MSD_FIR_PTPObj_gptpGetPreemptTsSel (1, Fir_gptpPreemptTimestampSelGet)
+#define MSD_FIR_PTPObj_gptpSetPreemptCtrl (1, Fir_gptpPreemptCtrlSet)
+#define MSD_FIR_PTPObj_gptpGetPreemptCtrl (1, Fir_gptpPreemptCtrlGet)
+#define MSD_FIR_PTPObj_gtaiSetTrigGenTimerSel (1, Fir_gtaiTrigGenTimerSelSet)
+#define MSD_FIR_PTPObj_gtaiGetTrigGenTimerSel (1, Fir_gtaiTrigGenTimerSelGet)
+
+/* TCAMObj */
+#define MSD_FIR_TCAMObj_gtcamFlushAll (1, Fir_gtcamFlushAll)
+#define MSD_FIR_TCAMObj_gtcamFlushEntry (1, Fir_gtcamFlushEntry)
+#define MSD_FIR_TCAMObj_gtcamLoadEntry (1, Fir_gtcamLoadEntryIntf)
+#define MSD_FIR_TCAMObj_gtcamReadTCAMData (1, Fir_gtcamReadTCAMDataIntf)
+#define MSD_FIR_TCAMObj_gtcamGetNextTCAMData (1, Fir_gtcamGetNextTCAMDataIntf)
+#define MSD_FIR_TCAMObj_gtcamFindEntry (1, Fir_gtcamFindEntryIntf)
+#define MSD_FIR_TCAMObj_gtcamSetMode (1, Fir_gtcamSetModeIntf)
+#define MSD_FIR_TCAMObj_gtcamGetMode (1, Fir_gtcamGetModeIntf)
+#define MSD_FIR_TCAMObj_gtcamAddEntryPort (1, Fir_gtcamAddEntryPort)
+#define MSD_FIR_TCAMObj_gtcamRemoveEntryPort (1, Fir_gtcamRemoveEntryPort)
+#define MSD_FIR_TCAMObj_gtcamEgrFlushEntry (1, Fir_gtcamEgrFlushEntryIntf)
+#define MSD_FIR_TCAMObj_gtcamEgrFlushEntryAllPorts (1, Fir_gtcamEgrFlushAllPortsIntf)
+#define MSD_FIR_TCAMObj_gtcamEgrLoadEntry (1, Fir_gtcamEgrLoadEntryIntf)
+#define MSD_FIR_TCAMObj_gtcamEgrGetNextTCAMData (1, Fir_gtcamEgrGetNextTCAMDataIntf)
+#define MSD_FIR_TCAMObj_gtcamEgrReadTCAMData (1, Fir_gtcamEgrReadTCAMDataIntf)
+#define MSD_FIR_TCAMObj_gtcamDump (1, Fir_gtcamDump)
+#define MSD_FIR_TCAMObj_gtcamAdvConfig (1, Fir_gtcamAdvConfigIntf)
+
+/* TCAMRCObj */
+#define MSD_FIR_TCAMRCObj_gtcamRCLoadEntry (1, Fir_gtcamRCLoadEntryIntf)
+#define MSD_FIR_TCAMRCObj_gtcamRCFlushAllEntry (1, Fir_gtcamRCFlushAllEntry)
+#define MSD_FIR_TCAMRCObj_gtcamRCFlushEntry (1, Fir_gtcamRCFlushEntry)
+#define MSD_FIR_TCAMRCObj_gtcamRCReadEntry (1, Fir_gtcamRCReadEntryIntf)
+#define MSD_FIR_TCAMRCObj_gtcamRCGetNextEntry (1, Fir_gtcamRCGetNextEntryIntf)
+#define MSD_FIR_TCAMRCObj_gtcamRCFindEntry (1, Fir_gtcamRCFindEntryIntf)
+#define MSD_FIR_TCAMRCObj_gtcamRCEntryDump (1, Fir_gtcamRCEntryDump)
+
+/* TCAMRCCompObj */
+#define MSD_FIR_TCAMRCCompObj_gtcamRCCompLoad (1, Fir_gtcamRCCompLoadIntf)
+#define MSD_FIR_TCAMRCCompObj_gtcamRCCompFlushAll (1, Fir_gtcamRCCompFlushAll)
+#define MSD_FIR_TCAMRCCompObj_gtcamRCCompFlushPort (1, Fir_gtcamRCCompFlushPort)
+#define MSD_FIR_TCAMRCCompObj_gtcamRCCompRead (1, Fir_gtcamRCCompReadIntf)
+
+/* ARPObj */
+#define MSD_FIR_ARPObj_garpLoadMcEntry (1, Fir_garpLoadMcEntryIntf)
+#define MSD_FIR_ARPObj_garpLoadUcEntry (1, Fir_garpLoadUcEntryIntf)
+#define MSD_FIR_ARPObj_garpFlushEntry (1, Fir_garpFlushEntry)
+#define MSD_FIR_ARPObj_garpFlushAll (1, Fir_garpFlushAll)
+#define MSD_FIR_ARPObj_garpReadEntry (1, Fir_garpReadEntryIntf)
+#define MSD_FIR_ARPObj_garpGetNextEntry (1, Fir_garpGetNextEntryIntf)
+
+/* RMUObj */
+#define MSD_FIR_RMUObj_grmuGetID (1, Fir_msdRmuGetIDIntf)
+#define MSD_FIR_RMUObj_grmuAtuDump (1, Fir_msdRmuAtuDumpIntf)
+#define MSD_FIR_RMUObj_grmuEcidDump (1, Fir_msdRmuEcidDumpIntf)
+#define MSD_FIR_RMUObj_grmuMibDump (0, ((FMSD_grmuMibDump)NULL))
+#define MSD_FIR_RMUObj_grmuMib2Dump (1, Fir_msdRmuMib2DumpIntf)
+#define MSD_FIR_RMUObj_grmuTCAMDump (1, Fir_msdRmuTCAMDumpIntf)
+#define MSD_FIR_RMUObj_grmuTCAMRead (1, Fir_msdRmuTCAMReadIntf)
+#define MSD_FIR_RMUObj_grmuTCAMWrite (1, Fir_msdRmuTCAMWriteIntf)
+#define MSD_FIR_RMUObj_grmuMultiRegAccess (1, Fir_msdRmuMultiRegAccessIntf)
+#define MSD_FIR_RMUObj_grmuRegDump (1, Fir_msdRmuRegDump)
+
+/* SmiPhyRegAccessObj */
+#define MSD_FIR_SmiPhyRegAccessObj_msdSetSMIC45PhyReg (1, Fir_msdSetSMIC45PhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdGetSMIC45PhyReg (1, Fir_msdGetSMIC45PhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdSetSMIPhyReg (1, Fir_msdSetSMIPhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdGetSMIPhyReg (1, Fir_msdGetSMIPhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdSetSMIPhyXMDIOReg (1, Fir_msdSetSMIPhyXMDIOReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdGetSMIPhyXMDIOReg (1, Fir_msdGetSMIPhyXMDIOReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdSetSMIExtPhyReg (1, Fir_msdSetSMIExtPhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdGetSMIExtPhyReg (1, Fir_msdGetSMIExtPhyReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdSetSMIExtPhyXMDIOReg (1, Fir_msdSetSMIExtPhyXMDIOReg)
+#define MSD_FIR_SmiPhyRegAccessObj_msdGetSMIExtPhyXMDIOReg (1, Fir_msdGetSMIExtPhyXMDIOReg)
+
+/* LEDObj */
+#define MSD_FIR_LEDObj_gledForceOn (1, Fir_gledForceOnIntf)
+#define MSD_FIR_LEDObj_gledForceOff (1, Fir_gledForceOffIntf)
+#define MSD_FIR_LEDObj_gledLinkAct (1, Fir_gledLinkActIntf)
+#define MSD_FIR_LEDObj_gledModeSet (1, Fir_gledModeSetIntf)
+#define MSD_FIR_LEDObj_gledModeGet (1, Fir_gledModeGetIntf)
+#define MSD_FIR_LEDObj_gledBlinkRateSet (1, Fir_gledBlinkRateSetIntf)
+#define MSD_FIR_LEDObj_gledBlinkRateGet (1, Fir_gledBlinkRateGetIntf)
+#define MSD_FIR_LEDObj_gledPulseStretchSet (1, Fir_gledPulseStretchSetIntf)
+#define MSD_FIR_LEDObj_gledPulseStretchGet (1, Fir_gledPulseStretchGetIntf)
+#define MSD_FIR_LEDObj_gledSpecialModeSet (1, Fir_gledSpecialModeSetIntf)
+#define MSD_FIR_LEDObj_gledSpecialModeGet (1, Fir_gledSpecialModeGetIntf)
+#define MSD_FIR_LEDObj_gledCtrlSet (1, Fir_gledCtrlSetIntf)
+#define MSD_FIR_LEDObj_gledCtrlGet (1, Fir_gledCtrlGetIntf)
+#define MSD_FIR_LEDObj_gledDump (1, Fir_gledDump)
+
+/* INTObj */
+#define MSD_FIR_INTObj_gdevIntEnableSet (1, Fir_gsysDevIntEnableSet)
+#define MSD_FIR_INTObj_gdevIntEnableGet (1, Fir_gsysDevIntEnableGet)
+#define MSD_FIR_INTObj_gdevIntStatusGet (1, Fir_gsysDevIntStatusGet)
+#define MSD_FIR_INTObj_gactiveIntEnableSet (1, Fir_gsysActiveIntEnableSet)
+#define MSD_FIR_INTObj_gactiveIntEnableGet (1, Fir_gsysActiveIntEnableGet)
+#define MSD_FIR_INTObj_gactiveIntStatusGet (1, Fir_gsysActiveIntStatusGet)
+
+/* QCRObj */
+#define MSD_FIR_QCRObj_gqcrSetGrpId (1, Fir_gatsSetGrpId)
+#define MSD_FIR_QCRObj_gqcrGetGrpId (1, Fir_gatsGetGrpId)
+#define MSD_FIR_QCRObj_gqcrSetCbsLimit (1, Fir_gatsSetCbsLimit)
+#define MSD_FIR_QCRObj_gqcrGetCbsLimit (1, Fir_gatsGetCbsLimit)
+#define MSD_FIR_QCRObj_gqcrSetRateLimit (1, Fir_gatsSetRateLimit)
+#define MSD_FIR_QCRObj_gqcrGetRateLimit (1, Fir_gatsGetRateLimit)
+#define MSD_FIR_QCRObj_gqcrSetMaxResidenceTime (1, Fir_gatsSetMaxResidenceTime)
+#define MSD_FIR_QCRObj_gqcrGetMaxResidenceTime (1, Fir_gatsGetMaxResidenceTime)
+#define MSD_FIR_QCRObj_gqcrFlushOne (1, Fir_gatsFlushOne)
+#define MSD_FIR_QCRObj_gqcrFlushAll (1, Fir_gatsFlushAll)
+#define MSD_FIR_QCRObj_gqcrSetQueueEnables (1, Fir_gatsSetQueueEnables)
+#define MSD_FIR_QCRObj_gqcrGetQueueEnables (1, Fir_gatsGetQueueEnables)
+
+/* FRERObj */
+#define MSD_FIR_FRERObj_gfrerSeqGenFlushAll (1, Fir_gfrerSeqGenFlushAll)
+#define MSD_FIR_FRERObj_gfrerSeqGenFlushEntry (1, Fir_gfrerSeqGenFlushEntry)
+#define MSD_FIR_FRERObj_gfrerSeqGenRead (1, Fir_gfrerSeqGenReadIntf)
+#define MSD_FIR_FRERObj_gfrerSeqGenLoad (1, Fir_gfrerSeqGenLoadIntf)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyFlushAll (1, Fir_gfrerIndvRcvyFlushAll)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyFlushEntry (1, Fir_gfrerIndvRcvyFlushEntry)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyRead (1, Fir_gfrerIndvRcvyReadIntf)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyLoad (1, Fir_gfrerIndvRcvyLoadIntf)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyGetNext (1, Fir_gfrerIndvRcvyGetNextIntf)
+#define MSD_FIR_FRERObj_gfrerIndvRcvyReadClear (1, Fir_gfrerIndvRcvyReadClearIntf)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyFlushAll (1, Fir_gfrerSeqRcvyFlushAll)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyFlushEntry (1, Fir_gfrerSeqRcvyFlushEntry)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyRead (1, Fir_gfrerSeqRcvyReadIntf)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyLoad (1, Fir_gfrerSeqRcvyLoadIntf)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyGetNext (1, Fir_gfrerSeqRcvyGetNextIntf)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyGetViolation (1, Fir_gfrerSeqRcvyGetViolationIntf)
+#define MSD_FIR_FRERObj_gfrerSeqRcvyReadClear (1, Fir_gfrerSeqRcvyReadClearIntf)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrFlushAll (1, Fir_gfrerBank0SCtrFlushAll)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrFlushEntry (1, Fir_gfrerBank0SCtrFlushCtr)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrRead (1, Fir_gfrerBank0SCtrReadIntf)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrLoad (1, Fir_gfrerBank0SCtrLoadIntf)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrGetNext (1, Fir_gfrerBank0SCtrGetNextIntf)
+#define MSD_FIR_FRERObj_gfrerBank0SCtrReadClear (1, Fir_gfrerBank0SCtrReadClearIntf)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrFlushAll (1, Fir_gfrerBank1SCtrFlushAll)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrFlushEntry (1, Fir_gfrerBank1SCtrFlushCtr)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrRead (1, Fir_gfrerBank1SCtrReadIntf)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrLoad (1, Fir_gfrerBank1SCtrLoadIntf)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrGetNext (1, Fir_gfrerBank1SCtrGetNextIntf)
+#define MSD_FIR_FRERObj_gfrerBank1SCtrReadClear (1, Fir_gfrerBank1SCtrReadClearIntf)
+#define MSD_FIR_FRERObj_gfrerSnapshotRefresh (1, Fir_gfrerSnapshotRefresh)
+
+/* QCIObj */
+#define MSD_FIR_QCIObj_gqciStreamFiltFlushAll (1, Fir_gqciStreamFiltFlushAll)
+#define MSD_FIR_QCIObj_gqciStreamFiltSet (1, Fir_gqciStreamFiltSet)
+#define MSD_FIR_QCIObj_gqciStreamFiltBlockStatSet (1, Fir_gqciStreamFiltBlockStatSet)
+#define MSD_FIR_QCIObj_gqciStreamFiltBlockStatGet (1, Fir_gqciStreamFiltBlockStatGet)
+#define MSD_FIR_QCIObj_gqciStreamFiltEnAts (1, Fir_gqciStreamFiltEnAts)
+#define MSD_FIR_QCIObj_gqciStreamFiltEnGate (1, Fir_gqciStreamFiltEnGate)
+#define MSD_FIR_QCIObj_gqciStreamFiltMatchCtrGet (1, Fir_gqciStreamFiltMatchCtrGet)
+#define MSD_FIR_QCIObj_gqciStreamFiltFilterCtrGet (1, Fir_gqciStreamFiltFilterCtrGet)
+#define MSD_FIR_QCIObj_gqciStreamGateFiltCtrGet (1, Fir_gqciStreamGateFiltCtrGet)
+#define MSD_FIR_QCIObj_gqciFlowMeterFiltCtrGet (1, Fir_gqciFlowMeterFiltCtrGet)
+#define MSD_FIR_QCIObj_gqciCountersGetBulk (1, Fir_gqciCountersGetBulk)
+#define MSD_FIR_QCIObj_gqciStreamGateFlushAll (1, Fir_gqciStreamGateFlushAll)
+#define MSD_FIR_QCIObj_gqciStreamGateDefStateSet (1, Fir_gqciStreamGateDefStateSet)
+#define MSD_FIR_QCIObj_gqciStreamGateScaleSet (1, Fir_gqciStreamGateScaleSet)
+#define MSD_FIR_QCIObj_gqciStreamGateTimeGenIdSet (1, Fir_gqciStreamGateTimeGenIdSet)
+#define MSD_FIR_QCIObj_gqciStreamGateEntryAdd (1, Fir_gqciStreamGateEntryAddIntf)
+#define MSD_FIR_QCIObj_gqciStreamGateTimeGenFlush (1, Fir_gqciStreamGateTimeGenFlush)
+#define MSD_FIR_QCIObj_gqciStreamGateTimeGenSet (1, Fir_gqciStreamGateTimeGenSet)
+#define MSD_FIR_QCIObj_gqciStreamGateScheduleSet (1, Fir_gqciStreamGateScheduleSet)
+#define MSD_FIR_QCIObj_gqciFlowMeterFlushAll (1, Fir_gqciFlowMeterFlushAll)
+#define MSD_FIR_QCIObj_gqciFlowMeterCoupleFlagSet (1, Fir_gqciFlowMeterCoupleFlagSet)
+#define MSD_FIR_QCIObj_gqciFlowMeterCoupleFlagGet (1, Fir_gqciFlowMeterCoupleFlagGet)
+#define MSD_FIR_QCIObj_gqciFlowMeterDropOnYelSet (1, Fir_gqciFlowMeterDropOnYelSet)
+#define MSD_FIR_QCIObj_gqciFlowMeterDropOnYelGet (1, Fir_gqciFlowMeterDropOnYelGet)
+#define MSD_FIR_QCIObj_gqciFlowMeterRedBlockEnSet (1, Fir_gqciFlowMeterRedBlockEnSet)
+#define MSD_FIR_QCIObj_gqciFlowMeterRedBlockEnGet (1, Fir_gqciFlowMeterRedBlockEnGet)
+#define MSD_FIR_QCIObj_gqciFlowMeterRedBlkStatSet (1, Fir_gqciFlowMeterRedBlkStatSet)
+#define MSD_FIR_QCIObj_gqciFlowMeterRedBlkStatGet (1, Fir_gqciFlowMeterRedBlkStatGet)
+#define MSD_FIR_QCIObj_gqciFlowMeterAdvConfig (1, Fir_gqciFlowMeterAdvConfig)
+
+/* MACSECObj */
+#define MSD_FIR_MACSECObj_gmacsecRead (0, ((FMSD_gmacsecRead)NULL))
+#define MSD_FIR_MACSECObj_gmacsecWrite (0, ((FMSD_gmacsecWrite)NULL))
+#define MSD_FIR_MACSECObj_gmacsecFlushAll (1, Fir_gmacsecFlushAll)
+#define MSD_FIR_MACSECObj_gmacsecGetEvent (0, ((FMSD_gmacsecGetEvent)NULL))
+#define MSD_FIR_MACSECObj_gmacsecCreateRule (1, Fir_gmacsecCreateRuleIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteRule (1, Fir_gmacsecDeleteRule)
+#define MSD_FIR_MACSECObj_gmacsecGetRule (1, Fir_gmacsecGetRuleIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateTxSecY (1, Fir_gmacsecCreateTxSecYIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateRxSecY (1, Fir_gmacsecCreateRxSecYIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteTxSecY (1, Fir_gmacsecDeleteTxSecY)
+#define MSD_FIR_MACSECObj_gmacsecDeleteRxSecY (1, Fir_gmacsecDeleteRxSecY)
+#define MSD_FIR_MACSECObj_gmacsecGetTxSecY (1, Fir_gmacsecGetTxSecYIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetRxSecY (1, Fir_gmacsecGetRxSecYIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateRxSC (1, Fir_gmacsecCreateRxSCIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteRxSC (1, Fir_gmacsecDeleteRxSC)
+#define MSD_FIR_MACSECObj_gmacsecGetRxSC (1, Fir_gmacsecGetRxSCIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateRxSA (1, Fir_gmacsecCreateRxSAIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteRxSA (1, Fir_gmacsecDeleteRxSA)
+#define MSD_FIR_MACSECObj_gmacsecGetRxSA (1, Fir_gmacsecGetRxSAIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateTxSC (1, Fir_gmacsecCreateTxSCIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteTxSC (1, Fir_gmacsecDeleteTxSC)
+#define MSD_FIR_MACSECObj_gmacsecGetTxSC (1, Fir_gmacsecGetTxSCIntf)
+#define MSD_FIR_MACSECObj_gmacsecCreateTxSA (1, Fir_gmacsecCreateTxSAIntf)
+#define MSD_FIR_MACSECObj_gmacsecDeleteTxSA (1, Fir_gmacsecDeleteTxSA)
+#define MSD_FIR_MACSECObj_gmacsecGetTxSA (1, Fir_gmacsecGetTxSAIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetRXSCStates (1, Fir_gmacsecGetRXSCStatesIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetRXSecYStates (1, Fir_gmacsecGetRXSecYStatesIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetTXSCStates (1, Fir_gmacsecGetTXSCStatesIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetTXSecYStates (1, Fir_gmacsecGetTXSecYStatesIntf)
+#define MSD_FIR_MACSECObj_gmacsecEnableEgressSet (1, Fir_gmacsecEnableEgressSet)
+#define MSD_FIR_MACSECObj_gmacsecEnableIngressSet (1, Fir_gmacsecEnableIngressSet)
+#define MSD_FIR_MACSECObj_gmacsecEnableEgressGet (1, Fir_gmacsecEnableEgressGet)
+#define MSD_FIR_MACSECObj_gmacsecEnableIngressGet (1, Fir_gmacsecEnableIngressGet)
+#define MSD_FIR_MACSECObj_gmacsecSetTxPNThreshold (1, Fir_gmacsecSetTxPNThreshold)
+#define MSD_FIR_MACSECObj_gmacsecGetTxPNThreshold (1, Fir_gmacsecGetTxPNThreshold)
+#define MSD_FIR_MACSECObj_gmacsecSetTxXPNThreshold (1, Fir_gmacsecSetTxXPNThreshold)
+#define MSD_FIR_MACSECObj_gmacsecGetTxXPNThreshold (1, Fir_gmacsecGetTxXPNThreshold)
+#define MSD_FIR_MACSECObj_gmacsecSetRxDefaultSCI (1, Fir_gmacsecSetRxDefaultSCI)
+#define MSD_FIR_MACSECObj_gmacsecGetRxDefaultSCI (1, Fir_gmacsecGetRxDefaultSCI)
+#define MSD_FIR_MACSECObj_gmacsecSetTxSCIntCtrl (1, Fir_gmacsecSetTxSCIntCtrlIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetTxSCIntCtrl (1, Fir_gmacsecGetTxSCIntCtrlIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetNextTxSCIntStatus (1, Fir_gmacsecGetNextTxSCIntStatusIntf)
+#define MSD_FIR_MACSECObj_gmacsecGetStatsBulk (1, Fir_gmacsecGetStatsBulk)
+
+#endif /* __Fir_msdDispatch_h */
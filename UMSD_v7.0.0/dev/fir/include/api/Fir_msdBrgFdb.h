@@ -913,6 +913,38 @@ MSD_STATUS Fir_gfdbGetNStaticEntryCountFid
     OUT MSD_U32  *count
 );
 
+/*******************************************************************************
+* Fir_gfdbGetOccupancy
+*
+* DESCRIPTION:
+*       Reads the learn count and learn limit of every port, the number of valid
+*       and non-static entries in the Address Translation Unit, and the same two
+*       counts for each FID in fidList, in one sweep.
+*
+* INPUTS:
+*       numFids - number of FIDs in fidList, up to MSD_FDB_OCCUPANCY_MAX_FIDS
+*       fidList - FIDs to count, may be NULL if numFids is 0
+*
+* OUTPUTS:
+*       occupancy - counts and limits, generation and timestamp are set to 0
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if input parameters are beyond range.
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gfdbGetOccupancy
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32  numFids,
+    IN  const MSD_U32  *fidList,
+    OUT MSD_FDB_OCCUPANCY  *occupancy
+);
+
 /*******************************************************************************
 * gfdbDump
 *
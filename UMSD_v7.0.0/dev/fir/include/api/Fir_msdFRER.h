@@ -454,6 +454,12 @@ OUT MSD_FRER_BANK1_CONFIG	*bk1ConfigData,
 OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
 );
 
+MSD_STATUS Fir_gfrerSnapshotRefresh
+(
+IN  MSD_QD_DEV	*dev,
+OUT MSD_U32	*generation
+);
+
 
 
 #ifdef __cplusplus
@@ -273,7 +273,7 @@ typedef struct _FIR_MSEC_RULE {
 ******************************************************************************/
 MSD_STATUS Fir_gmacsecRead
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	OUT MSD_U32* data
 );
@@ -297,7 +297,7 @@ MSD_STATUS Fir_gmacsecRead
 ******************************************************************************/
 MSD_STATUS Fir_gmacsecWrite
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	IN MSD_U32 data
 );
@@ -1359,6 +1359,32 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrlIntf
 	OUT MSD_MACSEC_INT_CONTROL_TXSC* txscIntCtrl
 );
 
+/******************************************************************************
+* DESCRIPTION:
+*	This function captures the SecY and SC counters of every counter index
+*	in counterVec, without clearing them, and reads each capture with one
+*	APB burst.
+*
+* INPUTS:
+*	dev  - physical device
+*	counterVec - vector of the counter indexes to read
+*
+* OUTPUTS:
+*	stats - counter values, indexes not in counterVec are 0
+*
+* RETURNS:
+*	MSD_STATUS
+*
+* NOTES/WARNINGS:
+*	None
+******************************************************************************/
+MSD_STATUS Fir_gmacsecGetStatsBulk
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 counterVec,
+	OUT MSD_MACSEC_STATS *stats
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -294,6 +294,15 @@ MSD_STATUS Fir_gptpResetTimeStamp
     IN  MSD_PTP_TIME    timeToReset
 );
 
+MSD_STATUS Fir_gptpTimeStampHarvest
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    portVec,
+    IN  MSD_U8     timeMask,
+    OUT MSD_PTP_TS_EVENT    *events,
+    OUT MSD_U32    *numEvents
+);
+
 MSD_STATUS Fir_gptpGetIntStatus
 (
     IN  MSD_QD_DEV* dev,
@@ -420,6 +429,13 @@ MSD_STATUS Fir_gtaiGetPTPGlobalTime
     OUT MSD_U32 *ptpTime
 );
 
+MSD_STATUS Fir_gtaiGetPTPGlobalTimeSample
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32 numReads,
+    OUT MSD_PTP_TIME_SAMPLE *sample
+);
+
 MSD_STATUS Fir_gptpPortRegGet
 (
     IN  MSD_QD_DEV  *dev,
@@ -662,6 +662,188 @@ MSD_STATUS Fir_gprtGetCosToDscp
     OUT MSD_U8      *dscp
 );
 
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTable
+*
+* DESCRIPTION:
+*       This API sets all entries of one port IEEE Priority Mapping table.
+*       With a QoS map shadow attached, entries whose copy holds the
+*       requested value are not written again.
+*
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set, see Fir_gprtSetIEEEPrioMap
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTable
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  FIR_PRI_TABLE_STRUCT   *entries
+);
+MSD_STATUS Fir_gprtSetIEEEPrioMapTableIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+);
+
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTablePorts
+*
+* DESCRIPTION:
+*       This API sets the same IEEE Priority Mapping table on every port in a
+*       port vector. With a QoS map shadow attached, entries whose copy holds
+*       the requested value are not written again. The writes are batched
+*       into RMU frames when RMU is enabled.
+*
+* INPUTS:
+*       portVec		- logical port vector, bit N set selects port N
+*       table		- Frame Priority Table set, see Fir_gprtSetIEEEPrioMap
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTablePorts
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_U32	portVec,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  FIR_PRI_TABLE_STRUCT   *entries
+);
+MSD_STATUS Fir_gprtSetIEEEPrioMapTablePortsIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_U32	portVec,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+);
+
+/*******************************************************************************
+* Fir_gprtGetIEEEPrioMapTable
+*
+* DESCRIPTION:
+*       This API gets all entries of one port IEEE Priority Mapping table.
+*
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set, see Fir_gprtGetIEEEPrioMap
+*
+* OUTPUTS:
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtGetIEEEPrioMapTable
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    OUT FIR_PRI_TABLE_STRUCT   *entries
+);
+MSD_STATUS Fir_gprtGetIEEEPrioMapTableIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    OUT MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+);
+
+/*******************************************************************************
+* Fir_gprtSetCosToQueueTable
+*
+* DESCRIPTION:
+*       Update the whole COS to egress queue mapping of a port.
+*
+* INPUTS:
+*       portNum - the logical port number
+*       queue   - MSD_IEEE_PRIORITY_TABLE_SIZE physical queues, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		Only cos entries whose queue changes are written to the device.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetCosToQueueTable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT  portNum,
+    IN  MSD_U8     *queue
+);
+
+/*******************************************************************************
+* Fir_gprtSetCosToDscpTable
+*
+* DESCRIPTION:
+*       Update the whole COS to DSCP mapping of a port.
+*
+* INPUTS:
+*       portNum - the logical port number
+*       dscp    - MSD_IEEE_PRIORITY_TABLE_SIZE frame differentiated services
+*                 code points, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		Only cos entries whose dscp changes are written to the device.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetCosToDscpTable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT   portNum,
+    IN  MSD_U8      *dscp
+);
+
 /******************************************************************************
 * Fir_gprtSetDefFpri
 *
@@ -347,6 +347,38 @@ MSD_STATUS Fir_gqciFlowMeterFiltCtrGet
 	OUT MSD_U16* counter
 );
 
+/******************************************************************************
+* Fir_gqciCountersGetBulk
+*
+* DESCRIPTION:
+*        This routine reads the matching, stream filter filtered, stream gate
+*        filtered and flow meter filtered frames counters of a set of stream
+*        filters in one locked pass, together with the PTP global time.
+*
+* INPUTS:
+*        filterVec - vector of the stream filter instances to read
+*
+* OUTPUTS:
+*        counters  - timestamp and counters of every stream filter in filterVec
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        Counters are not cleared. With RMU the four counters of a stream
+*        filter are read in one frame.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersGetBulk
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U32	filterVec,
+OUT MSD_PSFP_COUNTERS *counters
+);
+
 /******************************************************************************
 * Fir_gqciStreamGateFlushAll
 *
@@ -594,6 +626,53 @@ IN  MSD_U32 gateCycleTime,
 IN  MSD_U64 gateBaseTime
 );
 
+/******************************************************************************
+* Fir_gqciStreamGateScheduleSet
+*
+* DESCRIPTION:
+*        This routine programs the complete schedule of a stream gate instance
+*        in one transaction: gate control entries, time generation identifier
+*        and time generation cycle and base time. With a stream gate shadow
+*        attached (msdStreamGateShadowAttach) only the entries and settings
+*        that differ from what this routine wrote last are programmed, else
+*        everything is programmed.
+*
+* INPUTS:
+*        streamGateId - stream gate instance identifier
+*        schedule     - stream gate schedule
+*
+* OUTPUTS:
+*        checksum  - CRC-16/CCITT of the schedule as programmed by this
+*                    routine, over the 16 gate control entries (gate fields of
+*                    register 5, registers 6 and 7, low byte first), the time
+*                    generation identifier, cycle time and base time (low byte
+*                    first), may be NULL
+*        numWrites - number of gate control entries, gate settings and time
+*                    generation instances written, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The time generation instance is written last, so the new gate control
+*        list starts at the new base time. Stream gate flush and the single
+*        entry APIs make the next call rewrite the affected parts.
+*        The checksum is computed from the schedule as written, it is not
+*        read back and does not detect a wrong hardware load.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciStreamGateScheduleSet
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8  streamGateId,
+IN  MSD_STREAM_GATE_SCHEDULE *schedule,
+OUT MSD_U16 *checksum,
+OUT MSD_U32 *numWrites
+);
+
 /******************************************************************************
 * Fir_gqciFlowMeterFlushAll
 *
@@ -104,6 +104,29 @@ static MSD_STATUS Fir_atuGetStats
     OUT MSD_U32        *count
 );
 
+static MSD_STATUS Fir_atuStatsPrepare
+(
+    IN  MSD_QD_DEV    *dev,
+    OUT MSD_U16        *numBins
+);
+
+static MSD_STATUS Fir_atuStatsCount
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  FIR_MSD_ATU_STATS_OP    op,
+    IN  MSD_U32        dbNum,
+    IN  MSD_U16        numBins,
+    OUT MSD_U32        *count
+);
+
+static MSD_STATUS Fir_atuPortLearnRead
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  MSD_U8         phyAddr,
+    OUT MSD_U32        *limit,
+    OUT MSD_U32        *count
+);
+
 /*******************************************************************************
 * Fir_gfdbGetAtuEntryNext
 *
@@ -1591,6 +1614,115 @@ MSD_STATUS Fir_gfdbGetNStaticEntryCountFid
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_gfdbGetOccupancy
+*
+* DESCRIPTION:
+*       Reads the learn count and learn limit of every port, the number of valid
+*       and non-static entries in the Address Translation Unit, and the same two
+*       counts for each FID in fidList, in one sweep.
+*
+* INPUTS:
+*       numFids - number of FIDs in fidList, up to MSD_FDB_OCCUPANCY_MAX_FIDS
+*       fidList - FIDs to count, may be NULL if numFids is 0
+*
+* OUTPUTS:
+*       occupancy - counts and limits, generation and timestamp are set to 0
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if input parameters are beyond range.
+*
+* COMMENTS:
+*       The ATU split mode is read once per sweep instead of once per count,
+*       and the learn count and limit of a port share one read of the Port
+*       ATU Control register.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gfdbGetOccupancy
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32  numFids,
+    IN  const MSD_U32  *fidList,
+    OUT MSD_FDB_OCCUPANCY  *occupancy
+)
+{
+    MSD_STATUS       retVal;
+    MSD_LPORT        port;
+    MSD_U8           hwPort;
+    MSD_U16          numBins;
+    MSD_U32          i;
+
+    MSD_DBG_INFO(("Fir_gfdbGetOccupancy Called.\n"));
+
+    if ((occupancy == NULL) || (numFids > MSD_FDB_OCCUPANCY_MAX_FIDS) ||
+        ((numFids != 0U) && (fidList == NULL)))
+    {
+        MSD_DBG_ERROR(("Bad occupancy parameter.\n"));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numFids; i++)
+    {
+        if (fidList[i] > (MSD_U32)0xfff)
+        {
+            MSD_DBG_ERROR(("Bad FID %u.\n", (unsigned int)fidList[i]));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    msdMemSet(occupancy, 0, sizeof(MSD_FDB_OCCUPANCY));
+
+    for (port = 0; (port < (MSD_LPORT)dev->numOfPorts) && (port < (MSD_LPORT)MSD_MAX_SWITCH_PORTS); port++)
+    {
+        hwPort = MSD_LPORT_2_PORT(port);
+        if (hwPort == MSD_INVALID_PORT)
+        {
+            continue;
+        }
+
+        retVal = Fir_atuPortLearnRead(dev, FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort),
+            &occupancy->learnLimit[port], &occupancy->learnCount[port]);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Fir_atuPortLearnRead for port %u returned: %s.\n", (unsigned int)port, msdDisplayStatus(retVal)));
+            return retVal;
+        }
+        occupancy->portVec |= (MSD_U32)1 << port;
+    }
+
+    retVal = Fir_atuStatsPrepare(dev, &numBins);
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_atuStatsPrepare returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+
+    retVal = Fir_atuStatsCount(dev, FIR_ATU_STATS_ALL, 0, numBins, &occupancy->count);
+    if (retVal == MSD_OK)
+    {
+        retVal = Fir_atuStatsCount(dev, FIR_ATU_STATS_NON_STATIC, 0, numBins, &occupancy->nonStaticCount);
+    }
+    for (i = 0; (i < numFids) && (retVal == MSD_OK); i++)
+    {
+        occupancy->fid[i].fid = fidList[i];
+        retVal = Fir_atuStatsCount(dev, FIR_ATU_STATS_ALL_FID, fidList[i], numBins, &occupancy->fid[i].count);
+        if (retVal == MSD_OK)
+        {
+            retVal = Fir_atuStatsCount(dev, FIR_ATU_STATS_NON_STATIC_FID, fidList[i], numBins, &occupancy->fid[i].nonStaticCount);
+        }
+    }
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_atuStatsCount returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+    occupancy->numFids = numFids;
+
+    MSD_DBG_INFO(("Fir_gfdbGetOccupancy Exit.\n"));
+    return MSD_OK;
+}
+
 /* End New Add */
 
 /****************************************************************************/
@@ -2478,3 +2610,158 @@ static MSD_STATUS Fir_atuGetStats
 
     return MSD_OK;
 }
+
+/* Reads the split ATU bit once for a sweep of Fir_atuStatsCount and selects
+   the MAC address database when the ATU is split */
+static MSD_STATUS Fir_atuStatsPrepare
+(
+    IN  MSD_QD_DEV    *dev,
+    OUT MSD_U16        *numBins
+)
+{
+    MSD_U16          SplitAtu;
+    MSD_STATUS       retVal;
+
+    if (IS_SMI_MULTICHIP_SUPPORTED(dev) == 1)
+    {
+        retVal = Fir_msdDirectGetMultiChipRegField(dev, FIR_ATU_FID_REG_MULTICHIP, (MSD_U8)15, (MSD_U8)1, &SplitAtu);
+    }
+    else
+    {
+        retVal = msdGetAnyRegField(dev->devNum, FIR_GLOBAL1_DEV_ADDR, FIR_ATU_FID_REG, (MSD_U8)15, (MSD_U8)1, &SplitAtu);
+    }
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    if (SplitAtu != (MSD_U16)0) /* ATU splited, 0~3 Bin for ATU */
+    {
+        /* set E-CID Mode = 0 Perform ATU Ops to the MAC address filtering database*/
+        if (IS_SMI_MULTICHIP_SUPPORTED(dev) == 1)
+        {
+            retVal = Fir_msdDirectSetMultiChipRegField(dev, FIR_ATU_FID_REG_MULTICHIP, (MSD_U8)14, (MSD_U8)1, (MSD_U16)0);
+        }
+        else
+        {
+            retVal = msdSetAnyRegField(dev->devNum, FIR_GLOBAL1_DEV_ADDR, FIR_ATU_FID_REG, (MSD_U8)14, (MSD_U8)1, (MSD_U16)0);
+        }
+        *numBins = 4U;
+    }
+    else
+    {
+        *numBins = 8U;
+    }
+
+    return retVal;
+}
+
+/* One ATU statistics count over numBins bins, same sequence as Fir_atuGetStats */
+static MSD_STATUS Fir_atuStatsCount
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  FIR_MSD_ATU_STATS_OP    op,
+    IN  MSD_U32        dbNum,
+    IN  MSD_U16        numBins,
+    OUT MSD_U32        *count
+)
+{
+    MSD_U32          numOfEntries;
+    FIR_MSD_ATU_ENTRY    entry;
+    MSD_U16          data, bin;
+    MSD_STATUS       retVal;
+
+    numOfEntries = 0;
+    for (bin = 0; bin < numBins; bin++)
+    {
+        data = (MSD_U16)((MSD_U16)bin << 11) | (MSD_U16)((MSD_U16)op << 14);
+
+        retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_ATU_STATS, data);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+
+        entry.DBNum = (MSD_U16)dbNum;
+        msdMemSet(entry.macAddr.arEther, 0, sizeof(MSD_ETHERADDR));
+
+        retVal = Fir_atuOperationPerform(dev, FIR_GET_NEXT_ENTRY, NULL, &entry);
+        if ((retVal != MSD_OK) && (retVal != MSD_NO_SUCH))
+        {
+            return retVal;
+        }
+
+        retVal = msdSetAnyRegField(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_ATU_STATS, (MSD_U8)11, (MSD_U8)2, bin);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+
+        retVal = msdGetAnyRegField(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_ATU_STATS, (MSD_U8)0, (MSD_U8)11, &data);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+
+        numOfEntries += (MSD_U32)(data & (MSD_U32)0x7FF);
+    }
+
+    *count = numOfEntries;
+
+    return MSD_OK;
+}
+
+/* Learn count and learn limit of a port from one read of the Port ATU Control
+   register. ReadLearnCnt (bit15) selects what bits 0~9 return and
+   KeepOldLearnLimit (bit12) keeps the write from changing the limit. */
+static MSD_STATUS Fir_atuPortLearnRead
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  MSD_U8         phyAddr,
+    OUT MSD_U32        *limit,
+    OUT MSD_U32        *count
+)
+{
+    MSD_U16          orig, data;
+    MSD_STATUS       retVal;
+
+    retVal = msdGetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, &orig);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    /* ReadLearnCnt 1, KeepOldLearnLimit 1 */
+    retVal = msdSetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, (MSD_U16)((orig & (MSD_U16)0x6000) | (MSD_U16)0x9000));
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    retVal = msdGetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, &data);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    *count = (MSD_U32)(data & (MSD_U16)0x3FF);
+
+    /* ReadLearnCnt 0, KeepOldLearnLimit 1 */
+    retVal = msdSetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, (MSD_U16)((orig & (MSD_U16)0x6000) | (MSD_U16)0x1000));
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    retVal = msdGetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, &data);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    *limit = (MSD_U32)(data & (MSD_U16)0x3FF);
+
+    /* Set back KeepOldLearnLimit, which writes the same limit */
+    if ((orig & (MSD_U16)0x1000) == 0U)
+    {
+        retVal = msdSetAnyReg(dev->devNum, phyAddr, FIR_PORT_ATU_CONTROL, (MSD_U16)((orig & (MSD_U16)0x6000) | (data & (MSD_U16)0x3FF)));
+    }
+
+    return retVal;
+}
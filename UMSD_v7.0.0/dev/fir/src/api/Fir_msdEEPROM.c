@@ -22,6 +22,13 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+/* RMU register commands issued per EEPROM address, a leading wait on the busy bit is added per frame */
+#define FIR_EEPROM_RMU_WRITE_CMDS	3U	/* address, write command, wait busy */
+#define FIR_EEPROM_RMU_READ_CMDS	4U	/* address, read command, wait busy, read data */
+/* number of EEPROM addresses read back at a time by the verify pass */
+#define FIR_EEPROM_VERIFY_CHUNK		64U
 
 /****************************************************************************/
 /* internal IMP related function declaration.                                    */
@@ -52,6 +59,28 @@ static MSD_STATUS Fir_EEPROM_Chip_Select_Get
 IN  MSD_QD_DEV *dev,
 OUT MSD_U8  *chipSelect
 );
+static MSD_STATUS Fir_EEPROM_Write_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+IN	MSD_U16	*data
+);
+static MSD_STATUS Fir_EEPROM_Read_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+OUT	MSD_U16	*data
+);
+static MSD_STATUS Fir_EEPROM_Rmu_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+INOUT	MSD_U16	*data,
+IN	MSD_BOOL	isWrite
+);
 /*******************************************************************************
 * Fir_EEPROMWrite
 *
@@ -234,6 +263,159 @@ OUT  MSD_U8  *chipSelect
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_EEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a range of EEPROM data in one locked pass
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address
+*      count     - number of EEPROM addresses to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, count entries
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMReadBlock
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  startAddr,
+IN  MSD_U16  count,
+OUT MSD_U16  *data
+)
+{
+	MSD_STATUS retVal;
+	MSD_DBG_INFO(("Fir_EEPROMReadBlock Called.\n"));
+
+	if (((MSD_U32)startAddr + (MSD_U32)count) > 0x10000U)
+	{
+		MSD_DBG_ERROR(("Bad EEPROM range: startAddr 0x%x, count %d.\n", startAddr, count));
+		return MSD_BAD_PARAM;
+	}
+	if ((count != 0U) && (NULL == data))
+	{
+		MSD_DBG_ERROR(("Input param data is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_EEPROM_Read_Block(dev, startAddr, count, data);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_EEPROMReadBlock returned: %d.\n", msdDisplayStatus(retVal)));
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+	MSD_DBG_INFO(("Fir_EEPROMReadBlock Exit.\n"));
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_EEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a range of EEPROM data in one locked pass,
+*       optionally followed by a CRC-16 read back verification
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address
+*      count     - number of EEPROM addresses to write
+*      data      - data to be written, count entries
+*      verify    - MSD_TRUE to read back and verify the written range
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error or verify mismatch
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMWriteBlock
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  startAddr,
+IN  MSD_U16  count,
+IN  MSD_U16  *data,
+IN  MSD_BOOL  verify
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 readBack[FIR_EEPROM_VERIFY_CHUNK];
+	MSD_U16 crcWritten, crcRead;
+	MSD_U16 offset, chunk;
+	MSD_DBG_INFO(("Fir_EEPROMWriteBlock Called.\n"));
+
+	if (((MSD_U32)startAddr + (MSD_U32)count) > 0x10000U)
+	{
+		MSD_DBG_ERROR(("Bad EEPROM range: startAddr 0x%x, count %d.\n", startAddr, count));
+		return MSD_BAD_PARAM;
+	}
+	if ((count != 0U) && (NULL == data))
+	{
+		MSD_DBG_ERROR(("Input param data is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_EEPROM_Write_Block(dev, startAddr, count, data);
+
+	if ((retVal == MSD_OK) && (verify == MSD_TRUE))
+	{
+		crcWritten = msdCrc16((MSD_U16)0xFFFF, data, (MSD_U32)count);
+		crcRead = (MSD_U16)0xFFFF;
+		offset = 0;
+		while ((retVal == MSD_OK) && (offset < count))
+		{
+			chunk = (MSD_U16)(count - offset);
+			if (chunk > FIR_EEPROM_VERIFY_CHUNK)
+			{
+				chunk = (MSD_U16)FIR_EEPROM_VERIFY_CHUNK;
+			}
+			retVal = Fir_EEPROM_Read_Block(dev, (MSD_U16)(startAddr + offset), chunk, readBack);
+			if (retVal == MSD_OK)
+			{
+				crcRead = msdCrc16(crcRead, readBack, (MSD_U32)chunk);
+			}
+			offset = (MSD_U16)(offset + chunk);
+		}
+
+		if ((retVal == MSD_OK) && (crcRead != crcWritten))
+		{
+			MSD_DBG_ERROR(("EEPROM verify failed: written crc 0x%04x, read crc 0x%04x.\n", crcWritten, crcRead));
+			retVal = MSD_FAIL;
+		}
+	}
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_EEPROMWriteBlock returned: %d.\n", msdDisplayStatus(retVal)));
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+	MSD_DBG_INFO(("Fir_EEPROMWriteBlock Exit.\n"));
+	return retVal;
+}
+
 /****************************************************************************/
 /* Internal functions.                                                  */
 /****************************************************************************/
@@ -414,4 +596,179 @@ OUT MSD_U8  *chipSelect
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+static MSD_STATUS Fir_EEPROM_Write_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+IN	MSD_U16	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 i;
+	MSD_U16 reg14;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		return Fir_EEPROM_Rmu_Block(dev, startAddr, count, data, MSD_TRUE);
+	}
+
+	/* The busy wait that ends every write also guards the next one, so only
+	 * one extra wait is needed in front of the whole block. */
+	retVal = Fir_waitBusyBitSelfClear(dev);
+	for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, (MSD_U8)0x15, (MSD_U16)(startAddr + i));
+		if (retVal == MSD_OK)
+		{
+			reg14 = (MSD_U16)0x8000 | (MSD_U16)((MSD_U16)3 << 12) | (MSD_U16)((MSD_U16)1 << 10) | (data[i] & (MSD_U16)0xff);
+			retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, (MSD_U8)0x14, reg14);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_waitBusyBitSelfClear(dev);
+		}
+	}
+
+	if (retVal != MSD_OK)
+	{
+		retVal = MSD_FAIL;
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_EEPROM_Read_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+OUT	MSD_U16	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 i;
+	MSD_U16 reg14, tmpData;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		return Fir_EEPROM_Rmu_Block(dev, startAddr, count, data, MSD_FALSE);
+	}
+
+	retVal = Fir_waitBusyBitSelfClear(dev);
+	for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, (MSD_U8)0x15, (MSD_U16)(startAddr + i));
+		if (retVal == MSD_OK)
+		{
+			reg14 = (MSD_U16)0x8000 | (MSD_U16)((MSD_U16)4 << 12);
+			retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, (MSD_U8)0x14, reg14);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_waitBusyBitSelfClear(dev);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = msdGetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, (MSD_U8)0x14, &tmpData);
+			data[i] = tmpData & (MSD_U16)0xFF;
+		}
+	}
+
+	if (retVal != MSD_OK)
+	{
+		retVal = MSD_FAIL;
+	}
+
+	return retVal;
+}
+
+static void Fir_EEPROM_Rmu_Cmd
+(
+OUT	MSD_RegCmd	*regCmd,
+IN	MSD_U8	isWaitOnBit,
+IN	MSD_U8	opCode,
+IN	MSD_U8	regAddr,
+IN	MSD_U16	data
+)
+{
+	regCmd->isWaitOnBit = isWaitOnBit;
+	regCmd->opCode = opCode;
+	regCmd->devAddr = (MSD_U8)FIR_GLOBAL2_DEV_ADDR;
+	regCmd->regAddr = regAddr;
+	regCmd->data = data;
+}
+
+/* Pack as many EEPROM operations as fit into each multiple register access frame,
+ * letting the switch itself poll the busy bit between the commands. */
+static MSD_STATUS Fir_EEPROM_Rmu_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	startAddr,
+IN	MSD_U16	count,
+INOUT	MSD_U16	*data,
+IN	MSD_BOOL	isWrite
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmdList[0]);
+	MSD_U32 cmdsPerAddr;
+	MSD_U32 addrPerFrame;
+	MSD_U32 offset = 0;
+	MSD_U32 chunk, nCmd, i;
+	MSD_U16 reg14;
+
+	cmdsPerAddr = (isWrite == MSD_TRUE) ? FIR_EEPROM_RMU_WRITE_CMDS : FIR_EEPROM_RMU_READ_CMDS;
+	addrPerFrame = (MSD_RMU_MAX_REGCMDS - 1U) / cmdsPerAddr;
+
+	while ((retVal == MSD_OK) && (offset < (MSD_U32)count))
+	{
+		chunk = (MSD_U32)count - offset;
+		if (chunk > addrPerFrame)
+		{
+			chunk = addrPerFrame;
+		}
+
+		nCmd = 0;
+		Fir_EEPROM_Rmu_Cmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, (MSD_U8)0x14, (MSD_U16)15);
+		for (i = 0; i < chunk; i++)
+		{
+			if (isWrite == MSD_TRUE)
+			{
+				reg14 = (MSD_U16)0x8000 | (MSD_U16)((MSD_U16)3 << 12) | (MSD_U16)((MSD_U16)1 << 10) | (data[offset + i] & (MSD_U16)0xff);
+			}
+			else
+			{
+				reg14 = (MSD_U16)0x8000 | (MSD_U16)((MSD_U16)4 << 12);
+			}
+			Fir_EEPROM_Rmu_Cmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x15, (MSD_U16)(startAddr + offset + i));
+			Fir_EEPROM_Rmu_Cmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x14, reg14);
+			Fir_EEPROM_Rmu_Cmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, (MSD_U8)0x14, (MSD_U16)15);
+			if (isWrite != MSD_TRUE)
+			{
+				Fir_EEPROM_Rmu_Cmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)0x14, 0);
+			}
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if ((retVal == MSD_OK) && (isWrite != MSD_TRUE))
+		{
+			for (i = 0; i < chunk; i++)
+			{
+				data[offset + i] = regCmdList[1U + (i * cmdsPerAddr) + 3U].data & (MSD_U16)0xFF;
+			}
+		}
+
+		offset += chunk;
+	}
+
+	if (retVal != MSD_OK)
+	{
+		retVal = MSD_FAIL;
+	}
+
+	return retVal;
+}
@@ -145,4 +145,76 @@ OUT  MSD_U8  *chipSelect
 )
 {
 	return Fir_EEPROMChipSelGet(dev, chipSelect);
-}
\ No newline at end of file
+}
+/*******************************************************************************
+* Fir_EEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a range of EEPROM data in one locked pass
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address
+*      count     - number of EEPROM addresses to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, count entries
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMReadBlockIntf
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  startAddr,
+IN  MSD_U16  count,
+OUT MSD_U16  *data
+)
+{
+	return Fir_EEPROMReadBlock(dev, startAddr, count, data);
+}
+/*******************************************************************************
+* Fir_EEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a range of EEPROM data in one locked pass,
+*       optionally followed by a CRC-16 read back verification
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address
+*      count     - number of EEPROM addresses to write
+*      data      - data to be written, count entries
+*      verify    - MSD_TRUE to read back and verify the written range
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error or verify mismatch
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMWriteBlockIntf
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  startAddr,
+IN  MSD_U16  count,
+IN  MSD_U16  *data,
+IN  MSD_BOOL  verify
+)
+{
+	return Fir_EEPROMWriteBlock(dev, startAddr, count, data, verify);
+}
@@ -22,6 +22,10 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+#define FIR_FRER_SNAPSHOT_REGS		20U	/* registers read per stream counter instance */
+#define FIR_FRER_COUNTER(regs, n)	((MSD_U32)((MSD_U32)(regs)[(n)] << 16) | (MSD_U32)(regs)[(n) + 1])
 
 /**********************************************************************************************
 *
@@ -106,6 +110,57 @@ IN  MSD_U8	bk1Op,
 IN  MSD_U8	bk1Id
 );
 
+static MSD_STATUS Fir_frerSnapshotOpPerform
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	op,
+IN  MSD_U8	id
+);
+
+static MSD_STATUS Fir_frerSnapshotRegsRead
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	numRegs,
+OUT MSD_U16	*regs
+);
+
+static MSD_STATUS Fir_frerSnapshotGetNext
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	maxId,
+IN  MSD_U8	numRegs,
+INOUT MSD_U32	*cursor,
+OUT MSD_U16	*regs,
+OUT MSD_BOOL	*found
+);
+
+static MSD_STATUS Fir_frerSnapshotSeqRcvy
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+);
+
+static MSD_STATUS Fir_frerSnapshotIndvRcvy
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+);
+
+static MSD_STATUS Fir_frerSnapshotBank0
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+);
+
+static MSD_STATUS Fir_frerSnapshotBank1
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+);
+
 /************************************************************************************************************************************/
 /****************************************** below is public function ***************************************************************/
 /***********************************************************************************************************************************/
@@ -2209,6 +2264,108 @@ OUT FIR_MSD_FRER_BANK1_COUNTER	*bk1SCtrData
 
 }
 
+/******************************************************************************
+* Fir_gfrerSnapshotRefresh
+*
+* DESCRIPTION:
+*        This routine captures all sequence recovery and individual recovery
+*        instances and both stream counter banks in one pass, holding the FRER
+*        register lock for the whole pass, into the snapshot of the attached
+*        cache that readers do not use, and then swaps it in under the cache
+*        lock.
+*        Valid instances are found with get next operations. The counters of
+*        every valid stream counter instance are read and cleared with a read
+*        clear operation and added to its 64 bits totals, which are reset when
+*        an instance disappears or its enable, port or index changes.
+*        With RMU the registers of an instance are read in one frame.
+*
+* INPUTS:
+*        None.
+*
+* OUTPUTS:
+*        generation - generation of the new snapshot, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        Counts cleared by the ReadClear APIs between two refreshes are not
+*        included in the totals.
+*        The generation is advanced on error too, with complete set to
+*        MSD_FALSE; counts already cleared from the device are kept.
+*
+******************************************************************************/
+MSD_STATUS Fir_gfrerSnapshotRefresh
+(
+IN  MSD_QD_DEV	*dev,
+OUT MSD_U32	*generation
+)
+{
+	MSD_STATUS	retVal;
+	MSD_FRER_SNAPSHOT_CACHE	*cache;
+	MSD_FRER_SNAPSHOT	*snap;
+	MSD_U32	next;
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshotRefresh Called.\n"));
+
+	msdSemTake(dev->devNum, dev->frerRegsSem, OS_WAIT_FOREVER);
+
+	cache = dev->frerCache;
+	if (cache == NULL)
+	{
+		msdSemGive(dev->devNum, dev->frerRegsSem);
+		MSD_DBG_ERROR(("No FRER snapshot cache attached.\n"));
+		return MSD_NO_SUCH;
+	}
+
+	/* only refreshes, serialized by frerRegsSem, write the snapshots */
+	next = cache->active ^ 1U;
+	snap = &cache->snap[next];
+	msdMemCpy((void*)snap, (void*)&cache->snap[cache->active], sizeof(MSD_FRER_SNAPSHOT));
+
+	retVal = Fir_frerSnapshotSeqRcvy(dev, snap);
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotIndvRcvy(dev, snap);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotBank0(dev, snap);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotBank1(dev, snap);
+	}
+
+	snap->complete = (retVal == MSD_OK) ? MSD_TRUE : MSD_FALSE;
+	snap->generation++;
+	if (snap->generation == 0U)
+	{
+		snap->generation = 1U;
+	}
+	if (generation != NULL)
+	{
+		*generation = snap->generation;
+	}
+
+	msdSemTake(dev->devNum, cache->lockSem, OS_WAIT_FOREVER);
+	cache->active = next;
+	msdSemGive(dev->devNum, cache->lockSem);
+
+	msdSemGive(dev->devNum, dev->frerRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_gfrerSnapshotRefresh returned: %s.\n", msdDisplayStatus(retVal)));
+	}
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshotRefresh Exit.\n"));
+	return retVal;
+}
+
 static MSD_STATUS Fir_frerBasicWrite
 (
 IN MSD_QD_DEV* dev,
@@ -2644,3 +2801,389 @@ IN  MSD_U8	bk1Id
 	return retVal;
 }
 
+/*
+* same as the Fir_frer*OpPerform routines, for callers already holding
+* frerRegsSem
+*/
+static MSD_STATUS Fir_frerSnapshotOpPerform
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	op,
+IN  MSD_U8	id
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U16	data;
+
+	/*wait busyBit Clear*/
+	retVal = Fir_frerWaitBusyBitSelfClear(dev, block);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)op << 12) | (MSD_U16)id);
+	retVal = Fir_frerBasicWrite(dev, block, 0, data);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	/*wait busyBit Clear*/
+	return Fir_frerWaitBusyBitSelfClear(dev, block);
+}
+
+/*
+* read registers 0 to numRegs - 1 of a FRER block. With RMU the indirect
+* reads go out in one frame, each waiting on the AVB busy bit in the switch.
+*/
+static MSD_STATUS Fir_frerSnapshotRegsRead
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	numRegs,
+OUT MSD_U16	*regs
+)
+{
+	MSD_STATUS	retVal = MSD_OK;
+	MSD_RegCmd	regCmdList[4U * FIR_FRER_SNAPSHOT_REGS];
+	MSD_RegCmd	*pRegCmd = regCmdList;
+	MSD_U32	nCmd = 0;
+	MSD_U8	i;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		for (i = 0; i < numRegs; i++)
+		{
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = 15U;
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)block << 8) | (MSD_U16)((MSD_U16)5 << 5) | (MSD_U16)(i & 0x1F));
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = 15U;
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_READ;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_DATA;
+			regCmdList[nCmd].data = 0;
+			nCmd++;
+		}
+
+		msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+		if (retVal == MSD_OK)
+		{
+			for (i = 0; i < numRegs; i++)
+			{
+				regs[i] = regCmdList[(4U * i) + 3U].data;
+			}
+		}
+	}
+	else
+	{
+		for (i = 0; (retVal == MSD_OK) && (i < numRegs); i++)
+		{
+			retVal = Fir_frerBasicRead(dev, block, i, &regs[i]);
+		}
+	}
+
+	return retVal;
+}
+
+/*
+* get next valid instance after *cursor and read its registers. A cursor
+* above maxId starts from the lowest instance. found is MSD_FALSE once the
+* search wraps around or returns an invalid instance.
+*/
+static MSD_STATUS Fir_frerSnapshotGetNext
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	block,
+IN  MSD_U8	maxId,
+IN  MSD_U8	numRegs,
+INOUT MSD_U32	*cursor,
+OUT MSD_U16	*regs,
+OUT MSD_BOOL	*found
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U8	id;
+
+	*found = MSD_FALSE;
+
+	id = (*cursor > (MSD_U32)maxId) ? maxId : (MSD_U8)*cursor;
+	retVal = Fir_frerSnapshotOpPerform(dev, block, GET_NEXT, id);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	retVal = Fir_frerSnapshotRegsRead(dev, block, numRegs, regs);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	id = (MSD_U8)(regs[0] & (MSD_U16)maxId);
+	if (((regs[1] & (MSD_U16)0x8000) != 0U) && ((*cursor > (MSD_U32)maxId) || ((MSD_U32)id > *cursor)))
+	{
+		*cursor = id;
+		*found = MSD_TRUE;
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_frerSnapshotSeqRcvy
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U16	regs[FIR_FRER_SNAPSHOT_REGS];
+	MSD_U32	cursor = MSD_FRER_MAX_RCVY;
+	MSD_BOOL	found;
+	MSD_FRER_SEQRCVY	*entry;
+
+	msdMemSet((void*)snap->seqRcvyVec, 0, sizeof(snap->seqRcvyVec));
+	msdMemSet((void*)snap->seqRcvy, 0, sizeof(snap->seqRcvy));
+	msdMemSet((void*)snap->seqRcvyResets, 0, sizeof(snap->seqRcvyResets));
+	msdMemSet((void*)snap->latErrResets, 0, sizeof(snap->latErrResets));
+
+	do
+	{
+		retVal = Fir_frerSnapshotGetNext(dev, SEQ_RCVY, (MSD_U8)0x7F, 10, &cursor, regs, &found);
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			snap->seqRcvyVec[cursor / 32U] |= (MSD_U32)1 << (cursor % 32U);
+
+			entry = &snap->seqRcvy[cursor];
+			entry->seqRcvyId = (MSD_U8)cursor;
+			entry->seqRcvyEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+			entry->seqRcvyPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+			entry->seqRcvyIndex = (MSD_U8)(regs[1] & 0x7F);
+			entry->seqRcvyAlg = (MSD_U8)((regs[2] & 0x2000) >> 13);
+			entry->seqRcvyTakeNoSeq = (MSD_U8)((regs[2] & 0x1000) >> 12);
+			entry->latErrIntEn = (MSD_U8)((regs[2] & 0x200) >> 9);
+			entry->latErrStatus = (MSD_U8)((regs[2] & 0x100) >> 8);
+			entry->seqRcvySeqHisLen = (MSD_U8)(regs[2] & 0x1F);
+			entry->seqRcvyRstRate = (MSD_U8)((regs[3] & 0x3000) >> 12);
+			entry->seqRcvyRstTime = (MSD_U16)(regs[3] & 0x3FF);
+			entry->latErrEn = (MSD_U8)((regs[4] & 0x8000) >> 15);
+			entry->rdantPaths = (MSD_U8)((regs[4] & 0x3000) >> 12);
+			entry->latErrDiff = (MSD_U8)(regs[4] & 0xFF);
+			entry->latErrTestRate = (MSD_U8)((regs[5] & 0x3000) >> 12);
+			entry->latErrTestTime = (MSD_U16)(regs[5] & 0x3FF);
+			entry->latErrRstRate = (MSD_U8)((regs[6] & 0x3000) >> 12);
+			entry->latErrRstTime = (MSD_U16)(regs[6] & 0x3FF);
+
+			snap->seqRcvyResets[cursor] = regs[8];
+			snap->latErrResets[cursor] = regs[9];
+		}
+	} while ((retVal == MSD_OK) && (found == MSD_TRUE));
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_frerSnapshotIndvRcvy
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U16	regs[FIR_FRER_SNAPSHOT_REGS];
+	MSD_U32	cursor = MSD_FRER_MAX_RCVY;
+	MSD_BOOL	found;
+	MSD_FRER_INDVRCVY	*entry;
+
+	msdMemSet((void*)snap->indvRcvyVec, 0, sizeof(snap->indvRcvyVec));
+	msdMemSet((void*)snap->indvRcvy, 0, sizeof(snap->indvRcvy));
+	msdMemSet((void*)snap->indvRcvyResets, 0, sizeof(snap->indvRcvyResets));
+
+	do
+	{
+		retVal = Fir_frerSnapshotGetNext(dev, INDV_RCVY, (MSD_U8)0x7F, 5, &cursor, regs, &found);
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			snap->indvRcvyVec[cursor / 32U] |= (MSD_U32)1 << (cursor % 32U);
+
+			entry = &snap->indvRcvy[cursor];
+			entry->indvRcvyId = (MSD_U8)cursor;
+			entry->indvRcvyEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+			entry->indvRcvyAlg = (MSD_U8)((regs[1] & 0x2000) >> 13);
+			entry->indvRcvyTakeNoSeq = (MSD_U8)((regs[1] & 0x1000) >> 12);
+			entry->indvRcvySeqHisLen = (MSD_U8)(regs[1] & 0x1F);
+			entry->indvRcvyRstRate = (MSD_U8)((regs[2] & 0x3000) >> 12);
+			entry->indvRcvyRstTime = (MSD_U16)(regs[2] & 0x3FF);
+
+			snap->indvRcvyResets[cursor] = regs[4];
+		}
+	} while ((retVal == MSD_OK) && (found == MSD_TRUE));
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_frerSnapshotBank0
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U16	regs[FIR_FRER_SNAPSHOT_REGS];
+	MSD_U32	cursor = MSD_FRER_MAX_STREAM_CTR;
+	MSD_BOOL	found;
+	MSD_U32	vec = 0;
+	MSD_U32	bit;
+	MSD_FRER_BANK0_CONFIG	config;
+	MSD_FRER_BANK0_TOTAL	*total;
+
+	do
+	{
+		retVal = Fir_frerSnapshotGetNext(dev, BANK_0, (MSD_U8)0x1F, 2, &cursor, regs, &found);
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			retVal = Fir_frerSnapshotOpPerform(dev, BANK_0, READ_CLEAR, (MSD_U8)cursor);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_frerSnapshotRegsRead(dev, BANK_0, 20, regs);
+			}
+		}
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			bit = (MSD_U32)1 << cursor;
+			vec |= bit;
+
+			config.bk0SCtrId = (MSD_U8)cursor;
+			config.bk0SCtrEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+			config.bk0SCtrPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+			config.bk0SCtrIndex = (MSD_U8)(regs[1] & 0x1F);
+
+			total = &snap->bank0Total[cursor];
+			if (((snap->bank0Vec & bit) == 0U) ||
+				(msdMemCmp((void*)&snap->bank0Config[cursor], (void*)&config, sizeof(config)) != 0))
+			{
+				msdMemSet((void*)total, 0, sizeof(MSD_FRER_BANK0_TOTAL));
+			}
+			snap->bank0Config[cursor] = config;
+			snap->bank0Vec |= bit;
+
+			total->indvRcvyTagless += FIR_FRER_COUNTER(regs, 4);
+			total->indvRcvyPassed += FIR_FRER_COUNTER(regs, 6);
+			total->indvRcvyDiscarded += FIR_FRER_COUNTER(regs, 8);
+			total->indvRcvyOutofOrder += FIR_FRER_COUNTER(regs, 10);
+			total->indvRcvyRogue += FIR_FRER_COUNTER(regs, 12);
+			total->indvRcvyLost += FIR_FRER_COUNTER(regs, 14);
+			total->sidInput += FIR_FRER_COUNTER(regs, 16);
+			total->seqEncErrored += FIR_FRER_COUNTER(regs, 18);
+		}
+	} while ((retVal == MSD_OK) && (found == MSD_TRUE));
+
+	/* drop the instances that are gone, only after a full walk */
+	if (retVal == MSD_OK)
+	{
+		for (cursor = 0; cursor < MSD_FRER_MAX_STREAM_CTR; cursor++)
+		{
+			if ((vec & ((MSD_U32)1 << cursor)) == 0U)
+			{
+				msdMemSet((void*)&snap->bank0Config[cursor], 0, sizeof(MSD_FRER_BANK0_CONFIG));
+				msdMemSet((void*)&snap->bank0Total[cursor], 0, sizeof(MSD_FRER_BANK0_TOTAL));
+			}
+		}
+		snap->bank0Vec = vec;
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_frerSnapshotBank1
+(
+IN  MSD_QD_DEV	*dev,
+INOUT MSD_FRER_SNAPSHOT	*snap
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U16	regs[FIR_FRER_SNAPSHOT_REGS];
+	MSD_U32	cursor = MSD_FRER_MAX_STREAM_CTR;
+	MSD_BOOL	found;
+	MSD_U32	vec = 0;
+	MSD_U32	bit;
+	MSD_FRER_BANK1_CONFIG	config;
+	MSD_FRER_BANK1_TOTAL	*total;
+
+	do
+	{
+		retVal = Fir_frerSnapshotGetNext(dev, BANK_1, (MSD_U8)0x1F, 2, &cursor, regs, &found);
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			retVal = Fir_frerSnapshotOpPerform(dev, BANK_1, READ_CLEAR, (MSD_U8)cursor);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_frerSnapshotRegsRead(dev, BANK_1, 18, regs);
+			}
+		}
+		if ((retVal == MSD_OK) && (found == MSD_TRUE))
+		{
+			bit = (MSD_U32)1 << cursor;
+			vec |= bit;
+
+			config.bk1SCtrId = (MSD_U8)cursor;
+			config.bk1SCtrEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+			config.bk1SCtrPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+			config.bk1SCtrIndex = (MSD_U8)(regs[1] & 0x1F);
+
+			total = &snap->bank1Total[cursor];
+			if (((snap->bank1Vec & bit) == 0U) ||
+				(msdMemCmp((void*)&snap->bank1Config[cursor], (void*)&config, sizeof(config)) != 0))
+			{
+				msdMemSet((void*)total, 0, sizeof(MSD_FRER_BANK1_TOTAL));
+			}
+			snap->bank1Config[cursor] = config;
+			snap->bank1Vec |= bit;
+
+			total->seqRcvyTagless += FIR_FRER_COUNTER(regs, 4);
+			total->seqRcvyPassed += FIR_FRER_COUNTER(regs, 6);
+			total->seqRcvyDiscarded += FIR_FRER_COUNTER(regs, 8);
+			total->seqRcvyOutofOrder += FIR_FRER_COUNTER(regs, 10);
+			total->seqRcvyRogue += FIR_FRER_COUNTER(regs, 12);
+			total->seqRcvyLost += FIR_FRER_COUNTER(regs, 14);
+			total->sidOutput += FIR_FRER_COUNTER(regs, 16);
+		}
+	} while ((retVal == MSD_OK) && (found == MSD_TRUE));
+
+	/* drop the instances that are gone, only after a full walk */
+	if (retVal == MSD_OK)
+	{
+		for (cursor = 0; cursor < MSD_FRER_MAX_STREAM_CTR; cursor++)
+		{
+			if ((vec & ((MSD_U32)1 << cursor)) == 0U)
+			{
+				msdMemSet((void*)&snap->bank1Config[cursor], 0, sizeof(MSD_FRER_BANK1_CONFIG));
+				msdMemSet((void*)&snap->bank1Total[cursor], 0, sizeof(MSD_FRER_BANK1_TOTAL));
+			}
+		}
+		snap->bank1Vec = vec;
+	}
+
+	return retVal;
+}
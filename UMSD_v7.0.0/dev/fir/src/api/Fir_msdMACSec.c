@@ -23,6 +23,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 #define regBusWidth 0x4U
 #define APB_PHYADDR 0x1CU
@@ -56,6 +57,9 @@
 #define RX_SA_WIDTH 0x8U
 #define TX_SA_WIDTH 0x8U
 #define SAK_WIDTH 0xAU
+/* RMU commands of one APB write and read transfer at most */
+#define FIR_APB_RMU_WRITE_CMDS 11U
+#define FIR_APB_RMU_READ_CMDS 17U
 #define GET_MEM_ADDR(memType, regAddr) \
 		{ \
 			switch (memType){\
@@ -191,227 +195,377 @@ typedef union
 
 } FIR_MACSec_DATA_HW;
 
-static MSD_U32* ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertActionToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertRXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertTXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertRXSCToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertTXSCToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertRXSAToArray(IN FIR_MACSec_DATA_HW* dataRw);
-static MSD_U32* ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw);
-
-static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(IN MSD_QD_DEV dev);
-static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev);
-static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev);
-static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev);
-static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev);
-
-
-static MSD_STATUS Fir_MACSecGetAnyRegField(IN  MSD_QD_DEV dev, IN MSD_U32 regAddr, IN MSD_U32 fieldOffset, IN MSD_U32 fieldLength, OUT MSD_U32* data);
-static MSD_STATUS Fir_WaitOperationReady(IN  MSD_QD_DEV dev, IN MSD_32 regAddr);
+static void ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertActionToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertRXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertTXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertRXSCToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertTXSCToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertRXSAToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+static void ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array);
+
+static MSD_STATUS ConvertArrayToRule(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RULE *temp_rule);
+static MSD_STATUS ConvertArrayToAction(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TCAM_ACTION *action);
+static MSD_STATUS ConvertArrayToRxSecY(IN MSD_QD_DEV *dev, OUT FIR_SECY_INGRESS *rxSecY);
+static MSD_STATUS ConvertArrayToTxSecY(IN MSD_QD_DEV *dev, OUT FIR_SECY_EGRESS *txSecY);
+static MSD_STATUS ConvertArrayToRxSc(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RX_SC *rxSC);
+static MSD_STATUS ConvertArrayToTxSc(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TX_SC *txSC);
+static MSD_STATUS ConvertArrayToRxSa(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RX_SA *rxSA);
+static MSD_STATUS ConvertArrayToTxSa(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TX_SA *txSA);
+
+
+static MSD_STATUS Fir_MACSecGetAnyRegField(IN  MSD_QD_DEV *dev, IN MSD_U32 regAddr, IN MSD_U32 fieldOffset, IN MSD_U32 fieldLength, OUT MSD_U32* data);
+static MSD_STATUS Fir_WaitOperationReady(IN  MSD_QD_DEV *dev, IN MSD_32 regAddr);
 static MSD_STATUS Fir_OperationPerform(IN  MSD_QD_DEV* dev, IN	MSD_32	regAddr, IN	FIR_MEMTYPE memType, IN  FIR_MACSec_OPERATION  tcamOp, INOUT FIR_MACSec_DATA_HW* opData, IN MSD_U8 index);
 static MSD_STATUS  Fir_SAKOperation(IN  MSD_QD_DEV* dev, IN  FIR_MACSec_SAK_OPERATION  sakOp, IN MSD_U8 index);
-static MSD_STATUS MACSec_SetMEMData(IN  MSD_QD_DEV dev, IN FIR_MEMTYPE memType, IN FIR_MACSec_DATA_HW* tcamDataP);
-static MSD_STATUS MACSec_GetMEMData(IN  MSD_QD_DEV dev, IN FIR_MEMTYPE memType, OUT FIR_MACSec_DATA_HW* tcamDataP);
+static MSD_STATUS MACSec_SetMEMData(IN  MSD_QD_DEV *dev, IN FIR_MEMTYPE memType, IN FIR_MACSec_DATA_HW* tcamDataP);
+static MSD_STATUS MACSec_GetMEMData(IN  MSD_QD_DEV *dev, IN FIR_MEMTYPE memType, OUT FIR_MACSec_DATA_HW* tcamDataP);
 
-static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV dev);
-static MSD_STATUS Operation_APB(IN  MSD_QD_DEV dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value);
+static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV *dev);
+static MSD_STATUS Operation_APB(IN  MSD_QD_DEV *dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value);
 
 /*MACSec mibs*/
-static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index);
-static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 MIB_Index);
+static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV *dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index);
+static MSD_STATUS Operation_INT(IN  MSD_QD_DEV *dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 MIB_Index);
 
-/****************************************************************************************************/
-
-/*MACSec related API*/
-
-/****************************************************************************************************/
-MSD_STATUS Fir_gmacsecRead
+/* Write value to the four APB byte registers starting at opBase */
+static MSD_STATUS Fir_macsecApbSetBytes
 (
-	IN MSD_QD_DEV dev,
-	IN MSD_U32 regAddr,
-	OUT MSD_U32* data
+	IN MSD_QD_DEV *dev,
+	IN MSD_U8 opBase,
+	IN MSD_U32 value
 )
 {
 	MSD_STATUS retVal = MSD_OK;
-	MSD_U8 value = 0;
-	/*step 1 wait Ready*/
-	msdSemTake(dev.devNum, dev.apbRegsSem, OS_WAIT_FOREVER);
-	/* Wait until the tcam in ready. */
-	retVal = Wait_APBReady(dev);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 2, write address*/
-	value = regAddr & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	MSD_U8 b;
+	MSD_U8 byteVal;
+
+	for (b = 0; (b < 4U) && (retVal == MSD_OK); b++)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		byteVal = (MSD_U8)((value >> (8U * b)) & 0xFFU);
+		retVal = Operation_APB(dev, (FIR_MACSec_APB_OPERATION)(opBase + b), FIR_APB_WRITE, &byteVal);
 	}
-	value = (regAddr >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	return retVal;
+}
+
+static void Fir_macsecRmuAddCmd
+(
+	OUT MSD_RegCmd *regCmd,
+	IN MSD_U8 isWaitOnBit,
+	IN MSD_U8 opCode,
+	IN MSD_U16 data
+)
+{
+	regCmd->isWaitOnBit = isWaitOnBit;
+	regCmd->opCode = opCode;
+	regCmd->devAddr = APB_PHYADDR;
+	regCmd->regAddr = APB_REGADDR;
+	regCmd->data = data;
+}
+
+/* RMU counterpart of Fir_macsecApbSetBytes, queues the byte writes */
+static MSD_U32 Fir_macsecRmuSetBytes
+(
+	INOUT MSD_RegCmd *regCmdList,
+	IN MSD_U32 nCmd,
+	IN MSD_U8 opBase,
+	IN MSD_U32 value
+)
+{
+	MSD_U8 b;
+	MSD_U8 byteVal;
+
+	for (b = 0; b < 4U; b++)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		byteVal = (MSD_U8)((value >> (8U * b)) & 0xFFU);
+		Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+			(MSD_U16)((1U << 15) | ((MSD_U16)((opBase + b) & 0x7FU) << 8) | byteVal));
 	}
-	value = (regAddr >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	return nCmd;
+}
+
+/* Queue the selection of the transfer control byte and a wait until its
+ * busy bit is cleared */
+static MSD_U32 Fir_macsecRmuWaitReady
+(
+	INOUT MSD_RegCmd *regCmdList,
+	IN MSD_U32 nCmd
+)
+{
+	Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+		(MSD_U16)((FIR_TRANSFER_CONTROL & 0x7F) << 8));
+	Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, 7);
+	return nCmd;
+}
+
+/* Read the transfer control byte and build the control value of a read transfer */
+static MSD_STATUS Fir_macsecApbReadCtrl
+(
+	IN MSD_QD_DEV *dev,
+	OUT MSD_U8 *ctrl
+)
+{
+	MSD_STATUS retVal;
+	MSD_U8 value = 0;
+
+	retVal = Wait_APBReady(dev);
+	if (retVal == MSD_OK)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_READ, &value);
 	}
-	value = (regAddr >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 3, action read*/
-	value = 0;
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
+	*ctrl = (MSD_U8)((1 << 1) | FIR_APB_READ | ((value | 0x80) & 0xFC));
+	return retVal;
+}
+
+/* Write count consecutive registers with apbRegsSem held, see Fir_macsecWriteBurst */
+static MSD_STATUS Fir_macsecRmuWriteBurst
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 regAddr,
+	IN const MSD_U32 *data,
+	IN MSD_U32 count
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = regCmdList;
+	MSD_U32 nCmd = 0;
+	MSD_U32 i;
+	MSD_U32 addr;
+
+	for (i = 0; (i < count) && (retVal == MSD_OK); i++)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		if ((nCmd + FIR_APB_RMU_WRITE_CMDS) > MSD_RMU_MAX_REGCMDS)
+		{
+			retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			nCmd = 0;
+			if (retVal != MSD_OK)
+			{
+				break;
+			}
+		}
+		addr = regAddr + regBusWidth * i;
+		nCmd = Fir_macsecRmuWaitReady(regCmdList, nCmd);
+		nCmd = Fir_macsecRmuSetBytes(regCmdList, nCmd, FIR_ADDRESS_B0, addr);
+		nCmd = Fir_macsecRmuSetBytes(regCmdList, nCmd, FIR_DATA_B0, data[i]);
+		Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+			(MSD_U16)((1U << 15) | ((FIR_TRANSFER_CONTROL & 0x7F) << 8) | ((1 << 1) | FIR_APB_WRITE | 0x80)));
 	}
 
-	value = (1 << 1) | FIR_APB_READ | ((value | 0x80) & 0xFC);
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	if ((retVal == MSD_OK) && (nCmd != 0))
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
 	}
-	/*Step 4, read value*/
-	retVal = Operation_APB(dev, FIR_DATA_B0, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
+	return retVal;
+}
+
+/* Read count consecutive registers with apbRegsSem held, see Fir_macsecReadBurst */
+static MSD_STATUS Fir_macsecRmuReadBurst
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 regAddr,
+	OUT MSD_U32 *data,
+	IN MSD_U32 count
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = regCmdList;
+	MSD_U32 dataCmd[MSD_RMU_MAX_REGCMDS / 10U];    /* a word takes more than 10 commands */
+	MSD_U32 nCmd = 0;
+	MSD_U32 nWord = 0;
+	MSD_U32 i, k;
+	MSD_U8 b;
+	MSD_U32 addr;
+	MSD_U8 ctrl = 0;
+
+	retVal = Fir_macsecApbReadCtrl(dev, &ctrl);
+
+	for (i = 0; (i < count) && (retVal == MSD_OK); i++)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		addr = regAddr + regBusWidth * i;
+		nCmd = Fir_macsecRmuWaitReady(regCmdList, nCmd);
+		nCmd = Fir_macsecRmuSetBytes(regCmdList, nCmd, FIR_ADDRESS_B0, addr);
+		Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+			(MSD_U16)((1U << 15) | ((FIR_TRANSFER_CONTROL & 0x7F) << 8) | ctrl));
+		nCmd = Fir_macsecRmuWaitReady(regCmdList, nCmd);
+		dataCmd[nWord++] = nCmd;
+		for (b = 0; b < 4U; b++)
+		{
+			Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+				(MSD_U16)(((FIR_DATA_B0 + b) & 0x7F) << 8));
+			Fir_macsecRmuAddCmd(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, 0);
+		}
+
+		/* send the frame once the next word may not fit or the burst is complete */
+		if (((nCmd + FIR_APB_RMU_READ_CMDS) > MSD_RMU_MAX_REGCMDS) || ((i + 1U) == count))
+		{
+			retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			for (k = 0; (k < nWord) && (retVal == MSD_OK); k++)
+			{
+				data[i + 1U - nWord + k] = 0;
+				for (b = 0; b < 4U; b++)
+				{
+					data[i + 1U - nWord + k] |= (MSD_U32)(regCmdList[dataCmd[k] + 2U * b + 1U].data & 0xFFU) << (8U * b);
+				}
+			}
+			nCmd = 0;
+			nWord = 0;
+		}
 	}
-	*data = (MSD_U32)(value & 0xFF);
-	retVal = Operation_APB(dev, FIR_DATA_B1, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_macsecWriteBurst
+*
+* DESCRIPTION:
+*       Writes count consecutive 32-bit MACSec registers starting at regAddr.
+*       apbRegsSem is held for the whole burst. Every address and data byte
+*       is written for every word, as by a single register write. With RMU,
+*       the accesses of up to MSD_RMU_MAX_REGCMDS commands are sent in one
+*       frame, each transfer waiting on the busy bit of the previous one.
+*
+*******************************************************************************/
+static MSD_STATUS Fir_macsecWriteBurst
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 regAddr,
+	IN const MSD_U32 *data,
+	IN MSD_U32 count
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U32 i;
+	MSD_U32 addr;
+	MSD_U8 value;
+
+	msdSemTake(dev->devNum, dev->apbRegsSem, OS_WAIT_FOREVER);
+	if (IS_RMU_SUPPORTED(dev))
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		retVal = Fir_macsecRmuWriteBurst(dev, regAddr, data, count);
 	}
-	*data += (MSD_U32)(value & 0xFF) << 8;
-	retVal = Operation_APB(dev, FIR_DATA_B2, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
+	else
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		for (i = 0; (i < count) && (retVal == MSD_OK); i++)
+		{
+			addr = regAddr + regBusWidth * i;
+			retVal = Wait_APBReady(dev);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_macsecApbSetBytes(dev, FIR_ADDRESS_B0, addr);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_macsecApbSetBytes(dev, FIR_DATA_B0, data[i]);
+			}
+			if (retVal == MSD_OK)
+			{
+				value = (1 << 1) | FIR_APB_WRITE | 0x80;
+				retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
+			}
+		}
 	}
-	*data += (MSD_U32)(value & 0xFF) << 16;
-	retVal = Operation_APB(dev, FIR_DATA_B3, FIR_APB_READ, &value);
+	msdSemGive(dev->devNum, dev->apbRegsSem);
+
 	if (retVal != MSD_OK)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		MSD_DBG_ERROR(("Fir_macsecWriteBurst returned: %s.\n", msdDisplayStatus(retVal)));
 	}
-	*data += (MSD_U32)(value & 0xFF) << 24;
-	msdSemGive(dev.devNum, dev.apbRegsSem);
 	return retVal;
 }
 
-MSD_STATUS Fir_gmacsecWrite
+/*******************************************************************************
+* Fir_macsecReadBurst
+*
+* DESCRIPTION:
+*       Reads count consecutive 32-bit MACSec registers starting at regAddr,
+*       with apbRegsSem held for the whole burst. The transfer control byte
+*       is read once per burst, every address byte is written for every
+*       word. With RMU, the accesses are packed into RMU frames.
+*
+*******************************************************************************/
+static MSD_STATUS Fir_macsecReadBurst
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
-	IN MSD_U32 data
+	OUT MSD_U32 *data,
+	IN MSD_U32 count
 )
 {
 	MSD_STATUS retVal = MSD_OK;
+	MSD_U32 i;
+	MSD_U32 addr;
+	MSD_U8 b;
+	MSD_U8 ctrl = 0;
 	MSD_U8 value = 0;
-	msdSemTake(dev.devNum, dev.apbRegsSem, OS_WAIT_FOREVER);
-	retVal = Wait_APBReady(dev);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 2, write address*/
-	value = regAddr & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
 
-	/*Step 3, write data*/
-	value = data & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	msdSemTake(dev->devNum, dev->apbRegsSem, OS_WAIT_FOREVER);
+	if (IS_RMU_SUPPORTED(dev))
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		retVal = Fir_macsecRmuReadBurst(dev, regAddr, data, count);
 	}
-	value = (data >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (data >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (data >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
+	else
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		retVal = Fir_macsecApbReadCtrl(dev, &ctrl);
+		for (i = 0; (i < count) && (retVal == MSD_OK); i++)
+		{
+			addr = regAddr + regBusWidth * i;
+			if (i != 0)
+			{
+				retVal = Wait_APBReady(dev);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_macsecApbSetBytes(dev, FIR_ADDRESS_B0, addr);
+			}
+			if (retVal == MSD_OK)
+			{
+				value = ctrl;
+				retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
+			}
+			data[i] = 0;
+			for (b = 0; (b < 4U) && (retVal == MSD_OK); b++)
+			{
+				retVal = Operation_APB(dev, (FIR_MACSec_APB_OPERATION)(FIR_DATA_B0 + b), FIR_APB_READ, &value);
+				data[i] |= (MSD_U32)(value & 0xFF) << (8U * b);
+			}
+		}
 	}
-	/*Step 4, action Write*/
-	value = (1 << 1) | FIR_APB_WRITE | 0x80;
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
+	msdSemGive(dev->devNum, dev->apbRegsSem);
+
 	if (retVal != MSD_OK)
 	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
+		MSD_DBG_ERROR(("Fir_macsecReadBurst returned: %s.\n", msdDisplayStatus(retVal)));
 	}
-	msdSemGive(dev.devNum, dev.apbRegsSem);
 	return retVal;
 }
 
+/****************************************************************************************************/
+
+/*MACSec related API*/
+
+/****************************************************************************************************/
+MSD_STATUS Fir_gmacsecRead
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 regAddr,
+	OUT MSD_U32* data
+)
+{
+	return Fir_macsecReadBurst(dev, regAddr, data, 1);
+}
+
+MSD_STATUS Fir_gmacsecWrite
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 regAddr,
+	IN MSD_U32 data
+)
+{
+	return Fir_macsecWriteBurst(dev, regAddr, &data, 1);
+}
+
 MSD_STATUS Fir_gmacsecFlushAll
 (
 	IN MSD_QD_DEV *dev
@@ -944,95 +1098,95 @@ MSD_STATUS Fir_gmacsecGetTXSecYStates
 	{
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SECY_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SECY_AUTO_CLEAR, secYCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
 		}
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYControlledPort = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYControlledPort |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYEncrypted = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYEncrypted |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYProtected = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outOctetsSecYProtected |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTUNIFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTUNIFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktsSecYUnicast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTMULFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTMULFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktsSecYMulticast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTBRDFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTBRDFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktSecYBroadcast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_UNTAG_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_UNTAG_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktsSecYuntagged = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_TOOLONG_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_TOOLONG_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktsSecYTooLong = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_NOSAERROR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_TX_NOSAERROR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
@@ -1061,25 +1215,25 @@ MSD_STATUS Fir_gmacsecGetTXSCStates
 	{
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SC_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SC_AUTO_CLEAR, scCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SC_NO_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SC_NO_AUTO_CLEAR, scCounterIndex);
 		}
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_TX_SC_ENC_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_TX_SC_ENC_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->outPktsEncrypted = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_TX_SC_PRO_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_TX_SC_PRO_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
@@ -1108,109 +1262,109 @@ MSD_STATUS Fir_gmacsecGetRXSecYStates
 	{
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SECY_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_RX_SECY_AUTO_CLEAR, secYCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_RX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
 		}
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYControlledPort = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYControlledPort |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYValidated = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYValidated |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_HICAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_HICAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYDecrypted = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_LOCAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inOctetsSecYDecrypted |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTUNIFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTUNIFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYUnicast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTMULFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTMULFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYMulticast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTBRDFR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTBRDFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYBroadCast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_UNTAGGED_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_UNTAGGED_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYUnTagged = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOTAG_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_NOTAG_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYNoTag = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_BADTAG_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_BADTAG_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYBadTag = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSA_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSA_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSecYNoSA = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSAERR_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSAERR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
@@ -1239,53 +1393,53 @@ MSD_STATUS Fir_gmacsecGetRXSCStates
 	{
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SC_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_RX_SC_AUTO_CLEAR, scCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SC_NO_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(dev, FIR_CAPTURE_RX_SC_NO_AUTO_CLEAR, scCounterIndex);
 		}
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_OK_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_OK_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSCOK = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_UNCHK_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_UNCHK_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSCUnchecked = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_DLYED_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_DLYED_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSCDelayed = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_LATE_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_LATE_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSCLate = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_INVLD_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_INVLD_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
 		states->inPktsSCInvalid = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_NOVLD_CAP_OFFSET, &data);
+		status = Fir_gmacsecRead(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_NOVLD_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
@@ -1295,6 +1449,99 @@ MSD_STATUS Fir_gmacsecGetRXSCStates
 	}
 	return status;
 }
+/* Unpack the captured MIB words: octet counters take a high and a low word */
+static void Fir_macsecMibToCounters
+(
+	IN MSD_U32 *data,
+	IN MSD_U32 numOctet,
+	IN MSD_U32 numCnt,
+	OUT MSD_U64 *cnt
+)
+{
+	MSD_U32 i;
+
+	for (i = 0; i < numCnt; i++)
+	{
+		if (i < numOctet)
+		{
+			cnt[i] = ((MSD_U64)data[2 * i] << 32) | data[2 * i + 1];
+		}
+		else
+		{
+			cnt[i] = data[numOctet + i];
+		}
+	}
+}
+
+MSD_STATUS Fir_gmacsecGetStatsBulk
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 counterVec,
+	OUT MSD_MACSEC_STATS *stats
+)
+{
+	MSD_STATUS status = MSD_OK;
+	MSD_U32 data[MSD_MSEC_RX_SECY_CNT_NUM + MSD_MSEC_SECY_OCTET_CNT_NUM];
+	MSD_U8 index;
+
+	msdMemSet(stats, 0, sizeof(MSD_MACSEC_STATS));
+	counterVec &= (1U << FIR_MAXMIBINDEX) - 1;
+
+	for (index = 0; (index < FIR_MAXMIBINDEX) && (status == MSD_OK); index++)
+	{
+		if ((counterVec & (1U << index)) == 0)
+		{
+			continue;
+		}
+
+		status = Operation_MIB(dev, FIR_CAPTURE_RX_SECY_NO_AUTO_CLEAR, index);
+		if (status == MSD_OK)
+		{
+			status = Fir_macsecReadBurst(dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_HICAP_OFFSET, data,
+				MSD_MSEC_RX_SECY_CNT_NUM + MSD_MSEC_SECY_OCTET_CNT_NUM);
+		}
+		if (status == MSD_OK)
+		{
+			Fir_macsecMibToCounters(data, MSD_MSEC_SECY_OCTET_CNT_NUM, MSD_MSEC_RX_SECY_CNT_NUM, stats->rxSecY[index]);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SECY_NO_AUTO_CLEAR, index);
+		}
+		if (status == MSD_OK)
+		{
+			status = Fir_macsecReadBurst(dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_HICAP_OFFSET, data,
+				MSD_MSEC_TX_SECY_CNT_NUM + MSD_MSEC_SECY_OCTET_CNT_NUM);
+		}
+		if (status == MSD_OK)
+		{
+			Fir_macsecMibToCounters(data, MSD_MSEC_SECY_OCTET_CNT_NUM, MSD_MSEC_TX_SECY_CNT_NUM, stats->txSecY[index]);
+			status = Operation_MIB(dev, FIR_CAPTURE_RX_SC_NO_AUTO_CLEAR, index);
+		}
+		if (status == MSD_OK)
+		{
+			status = Fir_macsecReadBurst(dev, BASE_SC_MIB + FIR_MSEC_RX_SC_OK_CAP_OFFSET, data, MSD_MSEC_RX_SC_CNT_NUM);
+		}
+		if (status == MSD_OK)
+		{
+			Fir_macsecMibToCounters(data, 0, MSD_MSEC_RX_SC_CNT_NUM, stats->rxSC[index]);
+			status = Operation_MIB(dev, FIR_CAPTURE_TX_SC_NO_AUTO_CLEAR, index);
+		}
+		if (status == MSD_OK)
+		{
+			status = Fir_macsecReadBurst(dev, BASE_SC_MIB + FIR_MSEC_TX_SC_ENC_CAP_OFFSET, data, MSD_MSEC_TX_SC_CNT_NUM);
+		}
+		if (status == MSD_OK)
+		{
+			Fir_macsecMibToCounters(data, 0, MSD_MSEC_TX_SC_CNT_NUM, stats->txSC[index]);
+			stats->counterVec |= 1U << index;
+		}
+	}
+
+	if (MSD_OK != status)
+	{
+		MSD_DBG_ERROR(("Fir_gmacsecGetStatsBulk function returned: %s.\n", msdDisplayStatus(status)));
+	}
+	return status;
+}
+
 MSD_STATUS Fir_gmacsecSetTxPNThreshold
 (
 	IN MSD_QD_DEV *dev,
@@ -1304,7 +1551,7 @@ MSD_STATUS Fir_gmacsecSetTxPNThreshold
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecWrite(*dev, regAddr, (MSD_U32)pnThr & 0xFFFFFFFF); 
+	status = Fir_gmacsecWrite(dev, regAddr, (MSD_U32)pnThr & 0xFFFFFFFF); 
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetTxPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1322,7 +1569,7 @@ MSD_STATUS Fir_gmacsecGetTxPNThreshold
 	MSD_U32 regAddr = 0;
 	MSD_U32 data = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecRead(*dev, regAddr, &data); 
+	status = Fir_gmacsecRead(dev, regAddr, &data); 
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetTxPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1340,13 +1587,13 @@ MSD_STATUS Fir_gmacsecSetTxXPNThreshold
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecWrite(*dev, regAddr + 8, (MSD_U32)xpnThr & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr + 8, (MSD_U32)xpnThr & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	status = Fir_gmacsecWrite(*dev, regAddr + 4, (MSD_U32)(xpnThr >> 32) & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr + 4, (MSD_U32)(xpnThr >> 32) & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1364,14 +1611,14 @@ MSD_STATUS Fir_gmacsecGetTxXPNThreshold
 	MSD_U32 regAddr = 0;
 	MSD_U32 data = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecRead(*dev, regAddr + 8, &data);
+	status = Fir_gmacsecRead(dev, regAddr + 8, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	*xpnThr = (MSD_U64)data;
-	status = Fir_gmacsecRead(*dev, regAddr + 4, &data);
+	status = Fir_gmacsecRead(dev, regAddr + 4, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1395,13 +1642,13 @@ MSD_STATUS Fir_gmacsecSetRxDefaultSCI
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_DEFRXSCI + (portNum << 7);
-	status = Fir_gmacsecWrite(*dev, regAddr, (MSD_U32)((defaultRxSCI >> 32) & 0xFFFFFFFF));
+	status = Fir_gmacsecWrite(dev, regAddr, (MSD_U32)((defaultRxSCI >> 32) & 0xFFFFFFFF));
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	status = Fir_gmacsecWrite(*dev, regAddr + 4, (MSD_U32)defaultRxSCI & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr + 4, (MSD_U32)defaultRxSCI & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
@@ -1425,14 +1672,14 @@ MSD_STATUS Fir_gmacsecGetRxDefaultSCI
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_DEFRXSCI + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	*defaultRxSCI = (MSD_U64)data << 32;
-	status = Fir_gmacsecRead(*dev, regAddr + 4, &data);
+	status = Fir_gmacsecRead(dev, regAddr + 4, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
@@ -1460,17 +1707,17 @@ MSD_STATUS Fir_gmacsecSetTxSCIntCtrl
 		return MSD_BAD_PARAM;
 	}
 	/* Global enable TXSC Interrupt.*/
-	tempData = Fir_gmacsecRead(*dev, GLOBAL_CTRL_ADDR, &tempData);
+	tempData = Fir_gmacsecRead(dev, GLOBAL_CTRL_ADDR, &tempData);
 	tempData = (tempData | (0x1 << 19));
-	status = Fir_gmacsecWrite(*dev, GLOBAL_CTRL_ADDR, tempData);
+	status = Fir_gmacsecWrite(dev, GLOBAL_CTRL_ADDR, tempData);
 
 	regAddr = BASE_TX_SC + 0x14;
 	tempData = (txscIntCtrl->txPNThrIntEn << 18) + (txscIntCtrl->txSAInvalidIntEn << 17) + (txscIntCtrl->txAutoRekeyIntEn << 16);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
+	status = Fir_gmacsecWrite(dev, regAddr, tempData);
 
 	regAddr = BASE_TX_SC;
 	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
+	status = Fir_WaitOperationReady(dev, regAddr);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1478,7 +1725,7 @@ MSD_STATUS Fir_gmacsecSetTxSCIntCtrl
 	}
 
 	tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_LOAD_ENTRY << 12) | index);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
+	status = Fir_gmacsecWrite(dev, regAddr, tempData);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1487,7 +1734,7 @@ MSD_STATUS Fir_gmacsecSetTxSCIntCtrl
 	}
 
 	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
+	status = Fir_WaitOperationReady(dev, regAddr);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1516,7 +1763,7 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 	regAddr = BASE_TX_SC;
 
 	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
+	status = Fir_WaitOperationReady(dev, regAddr);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1525,7 +1772,7 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 
 	tempData = 0;
 	tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_READ_ENTRY << 12) | index);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
+	status = Fir_gmacsecWrite(dev, regAddr, tempData);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1534,7 +1781,7 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 	}
 
 	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
+	status = Fir_WaitOperationReady(dev, regAddr);
 	if (status != MSD_OK)
 	{
 		msdSemGive(dev->devNum, dev->tblRegsSem);
@@ -1542,7 +1789,7 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 	}
 
 	regAddr = BASE_TX_SC + 0x14;
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	txscIntCtrl->txPNThrIntEn = (MSD_BOOL)((data>>18)&1);
 	txscIntCtrl->txSAInvalidIntEn = (MSD_BOOL)((data >> 17) & 1);
 	txscIntCtrl->txAutoRekeyIntEn = (MSD_BOOL)((data >> 16) & 1);
@@ -1578,8 +1825,8 @@ MSD_STATUS Fir_gmacsecGetNextTxSCIntStatus
 	{
 		opMode = FIR_NEXT_TX_SC_INT_NO_AUTO_CLEAR;
 	}
-	status = Operation_INT(*dev, opMode, index);
-	status = Fir_gmacsecRead(*dev, INT_OP_ADDR, &data);
+	status = Operation_INT(dev, opMode, index);
+	status = Fir_gmacsecRead(dev, INT_OP_ADDR, &data);
 	if ((data & 0xF) == 0xF && (data & 0x7F0000) == 0)
 	{
 		return MSD_NO_SUCH;
@@ -1610,14 +1857,14 @@ MSD_STATUS Fir_gmacsecEnableIngressSet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_RXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecRead function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	data = (isEnable << 31) | (data & 0x7FFFFFFF);
-	status = Fir_gmacsecWrite(*dev, regAddr, data & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr, data & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
@@ -1642,14 +1889,14 @@ MSD_STATUS Fir_gmacsecEnableEgressSet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_TXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecRead function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	data = (isEnable << 31) | (data & 0x7FFFFFFF);
-	status = Fir_gmacsecWrite(*dev, regAddr, data & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr, data & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1674,7 +1921,7 @@ MSD_STATUS Fir_gmacsecEnableIngressGet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_RXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1701,7 +1948,7 @@ MSD_STATUS Fir_gmacsecEnableEgressGet
 	}
 	regAddr = BASE_TXPortCTRL + (portNum << 7);	
 	
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1725,19 +1972,19 @@ MSD_STATUS Fir_gmacsecGetEvent
 	regAddr = GLOBAL_CTRL_ADDR;
 
 	/* get the EVENT VALUE */
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_ECC_ERR_EVTS_OFFSET, &temp0);
+	status = Fir_gmacsecRead(dev, regAddr + FIR_MSEC_ECC_ERR_EVTS_OFFSET, &temp0);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_ECC_MISMAC_EVTS_OFFSET, &temp1);
+	status = Fir_gmacsecRead(dev, regAddr + FIR_MSEC_ECC_MISMAC_EVTS_OFFSET, &temp1);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_SMS_RPE_EVTS_OFFSET, &temp2);
+	status = Fir_gmacsecRead(dev, regAddr + FIR_MSEC_SMS_RPE_EVTS_OFFSET, &temp2);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
@@ -1752,7 +1999,7 @@ MSD_STATUS Fir_gmacsecGetEvent
 	return status;
 }
 
-static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index)
+static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV *dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index)
 {
 	MSD_STATUS retVal = MSD_OK;
 	retVal = Fir_WaitOperationReady(dev, MIB_OP_ADDR);
@@ -1775,7 +2022,7 @@ static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION
 	}
 	return retVal;
 }
-static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 Index)
+static MSD_STATUS Operation_INT(IN  MSD_QD_DEV *dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 Index)
 {
 	MSD_STATUS retVal = MSD_OK;
 	retVal = Fir_WaitOperationReady(dev, INT_OP_ADDR);
@@ -1798,21 +2045,21 @@ static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION
 	return retVal;
 }
 /*MACSec interrupt*/
-static MSD_STATUS Operation_APB(IN  MSD_QD_DEV dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value)
+static MSD_STATUS Operation_APB(IN  MSD_QD_DEV *dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value)
 {
 	MSD_STATUS retVal = MSD_OK;
 	MSD_U16 tempData = 0;
 	if (rwOp == FIR_APB_READ)
 	{
 		tempData = (opCode & 0x7F) << 8;
-		retVal = msdSetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, tempData);
+		retVal = msdSetAnyReg(dev->devNum, APB_PHYADDR, APB_REGADDR, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("Operation_APB function returned: %s.\n", msdDisplayStatus(retVal)));
 		}
 		else
 		{
-			retVal = msdGetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, &tempData);
+			retVal = msdGetAnyReg(dev->devNum, APB_PHYADDR, APB_REGADDR, &tempData);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("Operation_APB function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -1823,12 +2070,12 @@ static MSD_STATUS Operation_APB(IN  MSD_QD_DEV dev, IN FIR_MACSec_APB_OPERATION
 	else
 	{
 		tempData = ((1 << 15) | (MSD_U16)((opCode & 0x7F) << 8) | (MSD_U16)((*value) & 0xFF));
-		retVal = msdSetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, tempData);
+		retVal = msdSetAnyReg(dev->devNum, APB_PHYADDR, APB_REGADDR, tempData);
 	}
 	return retVal;
 }
 
-static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV dev)
+static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV *dev)
 {
 	MSD_STATUS retVal = MSD_OK;
 	MSD_U8 tempData = 1 << 7;
@@ -1845,9 +2092,9 @@ static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV dev)
 }
 
 /*Convert Array to Mem Data*/
-static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToRule(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RULE *temp_rule)
 {
-	static FIR_MSEC_RULE temp_rule;
+	MSD_STATUS retVal;
 	MSD_U8 i;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
@@ -1855,194 +2102,199 @@ static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev)
 	GET_MEM_ADDR(FIR_TYPE_RULE, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 
-	for (i = 0; i < TCAM_WIDTH; i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, TCAM_WIDTH);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
 
-	temp_rule.maskSPV = (array[1] >> 17) & 0x7F;
-	temp_rule.keySPV = (array[1] >> 1) & 0x7F;
+	temp_rule->maskSPV = (array[1] >> 17) & 0x7F;
+	temp_rule->keySPV = (array[1] >> 1) & 0x7F;
 
-	temp_rule.maskSecTagC = (array[3] >> 23) & 0x1;
-	temp_rule.keySecTagC = (array[3] >> 7) & 0x1;
+	temp_rule->maskSecTagC = (array[3] >> 23) & 0x1;
+	temp_rule->keySecTagC = (array[3] >> 7) & 0x1;
 
-	temp_rule.maskSecTagE = (array[3] >> 22) & 0x1;
-	temp_rule.keySecTagE = (array[3] >> 6) & 0x1;
+	temp_rule->maskSecTagE = (array[3] >> 22) & 0x1;
+	temp_rule->keySecTagE = (array[3] >> 6) & 0x1;
 
-	temp_rule.maskSecTag = (array[3] >> 21) & 0x1;
-	temp_rule.keySecTag = (array[3] >> 5) & 0x1;
+	temp_rule->maskSecTag = (array[3] >> 21) & 0x1;
+	temp_rule->keySecTag = (array[3] >> 5) & 0x1;
 
-	temp_rule.maskSkipTag = (array[3] >> 20) & 0x1;
-	temp_rule.keySkipTag = (array[3] >> 4) & 0x1;
+	temp_rule->maskSkipTag = (array[3] >> 20) & 0x1;
+	temp_rule->keySkipTag = (array[3] >> 4) & 0x1;
 
-	temp_rule.maskRTag = (array[3] >> 19) & 0x1;
-	temp_rule.keyRTag = (array[3] >> 3) & 0x1;
+	temp_rule->maskRTag = (array[3] >> 19) & 0x1;
+	temp_rule->keyRTag = (array[3] >> 3) & 0x1;
 
-	temp_rule.maskQTag = (array[3] >> 18) & 0x1;
-	temp_rule.keyQTag = (array[3] >> 2) & 0x1;
+	temp_rule->maskQTag = (array[3] >> 18) & 0x1;
+	temp_rule->keyQTag = (array[3] >> 2) & 0x1;
 
-	temp_rule.maskADTag = (array[3] >> 17) & 0x1;
-	temp_rule.keyADTag = (array[3] >> 1) & 0x1;
+	temp_rule->maskADTag = (array[3] >> 17) & 0x1;
+	temp_rule->keyADTag = (array[3] >> 1) & 0x1;
 
-	temp_rule.maskDirection = (array[3] >> 16) & 0x1;
-	temp_rule.keyDirection = array[3] & 0x1;
+	temp_rule->maskDirection = (array[3] >> 16) & 0x1;
+	temp_rule->keyDirection = array[3] & 0x1;
 
 	for (i = 0; i < 3; i++)
 	{
-		temp_rule.keyMacDA[2 * i] = (array[4 + i] >> 8) & 0xFF;
-		temp_rule.maskMacDA[2 * i] = (array[4 + i] >> 24) & 0xFF;
+		temp_rule->keyMacDA[2 * i] = (array[4 + i] >> 8) & 0xFF;
+		temp_rule->maskMacDA[2 * i] = (array[4 + i] >> 24) & 0xFF;
 
-		temp_rule.keyMacDA[2 * i + 1] = array[4 + i] & 0xFF;
-		temp_rule.maskMacDA[2 * i + 1] = (array[4 + i] >> 16) & 0xFF;
+		temp_rule->keyMacDA[2 * i + 1] = array[4 + i] & 0xFF;
+		temp_rule->maskMacDA[2 * i + 1] = (array[4 + i] >> 16) & 0xFF;
 	}
 
 	for (i = 0; i < 3; i++)
 	{
-		temp_rule.keyMacSA[2 * i] = (array[7 + i] >> 8) & 0xFF;
-		temp_rule.maskMacSA[2 * i] = (array[7 + i] >> 24) & 0xFF;
+		temp_rule->keyMacSA[2 * i] = (array[7 + i] >> 8) & 0xFF;
+		temp_rule->maskMacSA[2 * i] = (array[7 + i] >> 24) & 0xFF;
 
-		temp_rule.keyMacSA[2 * i + 1] = array[7 + i] & 0xFF;
-		temp_rule.maskMacSA[2 * i + 1] = (array[7 + i] >> 16) & 0xFF;
+		temp_rule->keyMacSA[2 * i + 1] = array[7 + i] & 0xFF;
+		temp_rule->maskMacSA[2 * i + 1] = (array[7 + i] >> 16) & 0xFF;
 	}
 
-	temp_rule.maskAdPCP = (array[10] >> 28) & 0xF;
-	temp_rule.keyAdPCP = (array[10] >> 12) & 0xF;
+	temp_rule->maskAdPCP = (array[10] >> 28) & 0xF;
+	temp_rule->keyAdPCP = (array[10] >> 12) & 0xF;
 
-	temp_rule.maskAdVID = (array[10] >> 16) & 0xFFF;
-	temp_rule.keyAdVID = array[10] & 0xFFF;
+	temp_rule->maskAdVID = (array[10] >> 16) & 0xFFF;
+	temp_rule->keyAdVID = array[10] & 0xFFF;
 
-	temp_rule.maskQPCP = (array[11] >> 28) & 0xF;
-	temp_rule.keyQPCP = (array[11] >> 12) & 0xF;
+	temp_rule->maskQPCP = (array[11] >> 28) & 0xF;
+	temp_rule->keyQPCP = (array[11] >> 12) & 0xF;
 
-	temp_rule.maskQVID = (array[11] >> 16) & 0xFFF;
-	temp_rule.keyQVID = array[11] & 0xFFF;
+	temp_rule->maskQVID = (array[11] >> 16) & 0xFFF;
+	temp_rule->keyQVID = array[11] & 0xFFF;
 
-	temp_rule.maskLengthType = (array[12] >> 16) & 0xFFFF;
-	temp_rule.keyLengthType = array[12] & 0xFFFF;
+	temp_rule->maskLengthType = (array[12] >> 16) & 0xFFFF;
+	temp_rule->keyLengthType = array[12] & 0xFFFF;
 
-	return &temp_rule;
+	return retVal;
 }
-static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(IN MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToAction(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TCAM_ACTION *action)
 {
-	static FIR_MSEC_TCAM_ACTION action;
+	MSD_STATUS retVal;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
 	MSD_U32 tempData = 0;
 	GET_MEM_ADDR(FIR_TYPE_ACTION, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	Fir_gmacsecRead(dev, data_addr, &tempData);
-	action.isControlledPort = (((tempData >> 15) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	action.secYIndex = tempData & 0xF;
-	action.txSCIndex = (tempData >> 16) & 0xF;
-	return &action;
+	retVal = Fir_gmacsecRead(dev, data_addr, &tempData);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+	action->isControlledPort = (((tempData >> 15) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	action->secYIndex = tempData & 0xF;
+	action->txSCIndex = (tempData >> 16) & 0xF;
+	return retVal;
 }
-static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToRxSecY(IN MSD_QD_DEV *dev, OUT FIR_SECY_INGRESS *rxSecY)
 {
-	static FIR_SECY_INGRESS rxSecY;
-	MSD_U8 i;
+	MSD_STATUS retVal;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
 	MSD_U32 array[RX_SECY_WIDTH - 1] = { 0 };
 	GET_MEM_ADDR(FIR_TYPE_RX_SECY, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (RX_SECY_WIDTH - 1); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, RX_SECY_WIDTH - 1);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
-	rxSecY.allowZeroRxPN = (((array[0] >> 24) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	rxSecY.secYCounterIndex = (array[0] >> 16) & 0xF;
-	rxSecY.rxConfOffset = (array[0] >> 8) & 0x3F;
-	rxSecY.replayProtect = (((array[0] >> 7) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	rxSecY.cipher = (array[0] >> 4) & 0x3;
-	rxSecY.validateFrame = (array[0] >> 1) & 0x3;
-	rxSecY.rxSecYEn = ((array[0] & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	rxSecY.replayWindow = array[1];
-	return &rxSecY;
+	rxSecY->allowZeroRxPN = (((array[0] >> 24) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	rxSecY->secYCounterIndex = (array[0] >> 16) & 0xF;
+	rxSecY->rxConfOffset = (array[0] >> 8) & 0x3F;
+	rxSecY->replayProtect = (((array[0] >> 7) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	rxSecY->cipher = (array[0] >> 4) & 0x3;
+	rxSecY->validateFrame = (array[0] >> 1) & 0x3;
+	rxSecY->rxSecYEn = ((array[0] & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	rxSecY->replayWindow = array[1];
+	return retVal;
 }
-static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToTxSecY(IN MSD_QD_DEV *dev, OUT FIR_SECY_EGRESS *txSecY)
 {
-	static FIR_SECY_EGRESS txSecY;
-	MSD_U8 i;
+	MSD_STATUS retVal;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
 	MSD_U32 array[TX_SECY_WIDTH - 1] = { 0 };
 	GET_MEM_ADDR(FIR_TYPE_TX_SECY, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (TX_SECY_WIDTH - 1); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, TX_SECY_WIDTH - 1);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
-	txSecY.secYCounterIndex = (array[0] >> 16) & 0xF;
-	txSecY.txConfOffset = (array[0] >> 8) & 0x3F;
-	txSecY.cipher = (MSD_CIPHER_SUITE)((array[0] >> 4) & 0x3);
-	txSecY.protectFrame = (((array[0] >> 1) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSecY.txSecYEn = ((array[0] & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-
-	txSecY.afterSkipTag = (((array[1] >> 11) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSecY.afterRTag = (((array[1] >> 10) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSecY.afterQTag = (((array[1] >> 9) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSecY.afterADTag = (((array[1] >> 8) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSecY.secTagTCI = array[1] & 0x3F;
-	return &txSecY;
+	txSecY->secYCounterIndex = (array[0] >> 16) & 0xF;
+	txSecY->txConfOffset = (array[0] >> 8) & 0x3F;
+	txSecY->cipher = (MSD_CIPHER_SUITE)((array[0] >> 4) & 0x3);
+	txSecY->protectFrame = (((array[0] >> 1) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSecY->txSecYEn = ((array[0] & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+
+	txSecY->afterSkipTag = (((array[1] >> 11) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSecY->afterRTag = (((array[1] >> 10) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSecY->afterQTag = (((array[1] >> 9) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSecY->afterADTag = (((array[1] >> 8) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSecY->secTagTCI = array[1] & 0x3F;
+	return retVal;
 }
-static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToRxSc(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RX_SC *rxSC)
 {
-	static FIR_MSEC_RX_SC rxSC;
-	MSD_U8 i;
+	MSD_STATUS retVal;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
 	MSD_U32 array[RX_SC_WIDTH - 1] = { 0 };
 	GET_MEM_ADDR(FIR_TYPE_RX_SC, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (RX_SC_WIDTH - 1); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, RX_SC_WIDTH - 1);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
-	rxSC.scCounterIndex = (array[0] >> 16) & 0xF;
-	rxSC.secYIndex = array[0] & 0xF;
-	rxSC.sci = (((MSD_U64)array[1] << 32) | array[2]);
-	rxSC.sa0An = (array[3] >> 12) & 0x3;
-	rxSC.sa0Index = array[3] & 0x1F;
-	rxSC.sa0Valid = (((array[3] >> 14) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	rxSC.sa1An = (array[3] >> 28) & 0x3;
-	rxSC.sa1Index = (array[3] >> 16) & 0x1F;
-	rxSC.sa1Valid = (((array[3] >> 30) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	return &rxSC;
+	rxSC->scCounterIndex = (array[0] >> 16) & 0xF;
+	rxSC->secYIndex = array[0] & 0xF;
+	rxSC->sci = (((MSD_U64)array[1] << 32) | array[2]);
+	rxSC->sa0An = (array[3] >> 12) & 0x3;
+	rxSC->sa0Index = array[3] & 0x1F;
+	rxSC->sa0Valid = (((array[3] >> 14) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	rxSC->sa1An = (array[3] >> 28) & 0x3;
+	rxSC->sa1Index = (array[3] >> 16) & 0x1F;
+	rxSC->sa1Valid = (((array[3] >> 30) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	return retVal;
 }
-static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToTxSc(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TX_SC *txSC)
 {
-	static FIR_MSEC_TX_SC txSC;
-	MSD_U8 i;
+	MSD_STATUS retVal;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
 	MSD_U32 array[TX_SC_WIDTH - 1] = { 0 };
 	GET_MEM_ADDR(FIR_TYPE_TX_SC, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (TX_SC_WIDTH - 1); i++)
-	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
-	}
-	txSC.scCounterIndex = (array[0] >> 16) & 0xF;
-	txSC.txNextPNRolloEn = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSC.sci = (((MSD_U64)array[1] << 32) | array[2]);
-	txSC.enableAutoRekey = (((array[3] >> 31) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSC.sa1Valid = (((array[3] >> 30) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSC.sa1An = (array[3] >> 28) & 0x3;
-	txSC.sa1Index = (array[3] >> 16) & 0x1F;
-	txSC.isActiveSA1 = (((array[3] >> 15) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSC.sa0Valid = (((array[3] >> 14) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSC.sa0An = (array[3] >> 12) & 0x3;
-	txSC.sa0Index = array[3] & 0x1F;
-	return &txSC;
-}
-static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
-{
-	static FIR_MSEC_RX_SA rxSA;
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, TX_SC_WIDTH - 1);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+	txSC->scCounterIndex = (array[0] >> 16) & 0xF;
+	txSC->txNextPNRolloEn = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSC->sci = (((MSD_U64)array[1] << 32) | array[2]);
+	txSC->enableAutoRekey = (((array[3] >> 31) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSC->sa1Valid = (((array[3] >> 30) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSC->sa1An = (array[3] >> 28) & 0x3;
+	txSC->sa1Index = (array[3] >> 16) & 0x1F;
+	txSC->isActiveSA1 = (((array[3] >> 15) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSC->sa0Valid = (((array[3] >> 14) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSC->sa0An = (array[3] >> 12) & 0x3;
+	txSC->sa0Index = array[3] & 0x1F;
+	return retVal;
+}
+static MSD_STATUS ConvertArrayToRxSa(IN MSD_QD_DEV *dev, OUT FIR_MSEC_RX_SA *rxSA)
+{
+	MSD_STATUS retVal;
 	MSD_U8 i, j;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
@@ -2050,37 +2302,39 @@ static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
 	GET_MEM_ADDR(FIR_TYPE_RX_SA, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (RX_SA_WIDTH - 1); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, RX_SA_WIDTH - 1);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
-	rxSA.rxSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	rxSA.ssci = array[1] & 0xFFFFFFFFU;
+	rxSA->rxSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	rxSA->ssci = array[1] & 0xFFFFFFFFU;
 	for (i = 0; i < 3; i++)
 	{
 		for (j = 0; j < 4; j++)
 		{
-			rxSA.salt[i * 4 + j] = (array[i + 2] >> (3 - j) * 8) & 0xFF;
+			rxSA->salt[i * 4 + j] = (array[i + 2] >> (3 - j) * 8) & 0xFF;
 		}
 	}
-	rxSA.nextPN = ((MSD_U64)array[5] << 32) | array[6];
+	rxSA->nextPN = ((MSD_U64)array[5] << 32) | array[6];
 	data_addr = (MSD_U32)BASE_SAK;
-	for (i =(RX_SA_WIDTH -1); i < (RX_SA_WIDTH + SAK_WIDTH - 2); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr + regBusWidth, &array[RX_SA_WIDTH - 1], SAK_WIDTH - 2);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * (i - RX_SA_WIDTH + 2), &array[i]);
+		return retVal;
 	}
 	for (i = 0; i < 8; i++)
 	{
 		for (j = 0; j < 4; j++)
 		{
-			rxSA.sak[i * 4 + j] = (array[i + 7] >> (3 - j) * 8) & 0xFF;
+			rxSA->sak[i * 4 + j] = (array[i + 7] >> (3 - j) * 8) & 0xFF;
 		}
 	}
-	return &rxSA;
+	return retVal;
 }
-static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev)
+static MSD_STATUS ConvertArrayToTxSa(IN MSD_QD_DEV *dev, OUT FIR_MSEC_TX_SA *txSA)
 {
-	static FIR_MSEC_TX_SA txSA;
+	MSD_STATUS retVal;
 	MSD_U8 i, j;
 	MSD_U32 data_addr = 0;
 	MSD_32 _data_addr = 0;
@@ -2088,40 +2342,41 @@ static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev)
 	GET_MEM_ADDR(FIR_TYPE_TX_SA, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	for (i = 0; i < (TX_SA_WIDTH - 1); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr, array, TX_SA_WIDTH - 1);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		return retVal;
 	}
-	txSA.txSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
-	txSA.ssci = array[1] & 0xFFFFFFFFU;
+	txSA->txSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
+	txSA->ssci = array[1] & 0xFFFFFFFFU;
 	for (i = 0; i < 3; i++)
 	{
 		for (j = 0; j < 4; j++)
 		{
-			txSA.salt[i * 4 + j] = (array[i + 2] >> (3-j) * 8) & 0xFF;
+			txSA->salt[i * 4 + j] = (array[i + 2] >> (3-j) * 8) & 0xFF;
 		}
 	}
-	txSA.nextPN = ((MSD_U64)array[5] << 32) | array[6];
+	txSA->nextPN = ((MSD_U64)array[5] << 32) | array[6];
 	data_addr = (MSD_U32)BASE_SAK;
-	for (i = (TX_SA_WIDTH - 1); i < (TX_SA_WIDTH + SAK_WIDTH - 2); i++)
+	retVal = Fir_macsecReadBurst(dev, data_addr + regBusWidth, &array[TX_SA_WIDTH - 1], SAK_WIDTH - 2);
+	if (retVal != MSD_OK)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * (i - TX_SA_WIDTH + 2), &array[i]);
+		return retVal;
 	}
 	for (i = 0; i < 8; i++)
 	{
 		for (j = 0; j < 4; j++)
 		{
-			txSA.sak[i * 4 + j] = (array[i + 7] >> (3 - j) * 8) & 0xFF;
+			txSA->sak[i * 4 + j] = (array[i + 7] >> (3 - j) * 8) & 0xFF;
 		}
 	}
-	return &txSA;
+	return retVal;
 }
 
 
 /*Convert Mem Data to Array*/
-static MSD_U32* ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[TCAM_WIDTH] = { 0 };
 	MSD_U8 i;
 
 	array[1] = (dataRw->rule.maskSPV << 17) + (dataRw->rule.keySPV << 1);
@@ -2139,124 +2394,96 @@ static MSD_U32* ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw)
 	array[10] = ((dataRw->rule.maskAdPCP) << 28) + ((dataRw->rule.maskAdVID) << 16) + ((dataRw->rule.keyAdPCP) << 12) + dataRw->rule.keyAdVID;
 	array[11] = ((dataRw->rule.maskQPCP) << 28) + ((dataRw->rule.maskQVID) << 16) + ((dataRw->rule.keyQPCP) << 12) + dataRw->rule.keyQVID;
 	array[12] = ((dataRw->rule.maskLengthType) << 16) + dataRw->rule.keyLengthType;
-
-	return array;
 }
-static MSD_U32* ConvertActionToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertActionToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[TCAM_ACTION_WIDTH] = { 0 };
-
 	array[1] = ((dataRw->action.txSCIndex) << 16) + ((dataRw->action.isControlledPort) << 15) + dataRw->action.secYIndex;
-
-	return array;
 }
-static MSD_U32* ConvertRXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertRXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[RX_SECY_WIDTH] = { 0 };
-
 	array[1] = ((dataRw->rxSecy.allowZeroRxPN) << 24) 
 		+ ((dataRw->rxSecy.secYCounterIndex) << 16) + ((dataRw->rxSecy.rxConfOffset) << 8)
 		+ ((dataRw->rxSecy.replayProtect) << 7) + ((dataRw->rxSecy.cipher) << 4)
 		+ ((dataRw->rxSecy.validateFrame) << 1) + dataRw->rxSecy.rxSecYEn;
 
 	array[2] = dataRw->rxSecy.replayWindow;
-
-	return array;
 }
-static MSD_U32* ConvertTXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertTXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[TX_SECY_WIDTH] = { 0 };
-
 	array[1] = ((dataRw->txSecy.secYCounterIndex) << 16) + ((dataRw->txSecy.txConfOffset) << 8)
 		+ ((dataRw->txSecy.cipher) << 4) + ((dataRw->txSecy.protectFrame) << 1) + dataRw->txSecy.txSecYEn;
 
 	array[2] = ((dataRw->txSecy.afterSkipTag) << 11) + ((dataRw->txSecy.afterRTag) << 10)
 		+ ((dataRw->txSecy.afterQTag) << 9) + ((dataRw->txSecy.afterADTag) << 8) + dataRw->txSecy.secTagTCI;
-
-	return array;
 }
-static MSD_U32* ConvertRXSCToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertRXSCToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[RX_SC_WIDTH] = { 0 };
-
 	array[1] = ((dataRw->rxSc.scCounterIndex) << 16) + dataRw->rxSc.secYIndex;
 	array[2] = (dataRw->rxSc.sci >> 32) & 0xFFFFFFFFU;
 	array[3] = dataRw->rxSc.sci & 0xFFFFFFFFU;
 	array[4] = ((dataRw->rxSc.sa1Valid) << 30) + ((dataRw->rxSc.sa1An) << 28) + ((dataRw->rxSc.sa1Index) << 16)
 		+ ((dataRw->rxSc.sa0Valid) << 14) + ((dataRw->rxSc.sa0An) << 12) + dataRw->rxSc.sa0Index;
-
-
-	return array;
 }
-static MSD_U32* ConvertTXSCToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertTXSCToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 array[TX_SC_WIDTH] = { 0 };
-
 	array[1] = ((dataRw->txSc.scCounterIndex) << 16) + dataRw->txSc.txNextPNRolloEn;
 	array[2] = ((dataRw->txSc.sci) >> 32) & 0xFFFFFFFFU;
 	array[3] = (dataRw->txSc.sci) & 0xFFFFFFFFU;
 	array[4] = ((dataRw->txSc.enableAutoRekey) << 31) + ((dataRw->txSc.sa1Valid) << 30) + ((dataRw->txSc.sa1An) << 28) 
 		+ ((dataRw->txSc.sa1Index) << 16) + ((dataRw->txSc.isActiveSA1) << 15) + ((dataRw->txSc.sa0Valid) << 14) 
 		+ ((dataRw->txSc.sa0An) << 12) + dataRw->txSc.sa0Index;
-
-	return array;
 }
 
-static MSD_U32* ConvertRXSAToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertRXSAToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 Array[RX_SA_WIDTH + SAK_WIDTH] = { 0 };
 	MSD_U8 i;
 
-	Array[1] = dataRw->rxSa.rxSAValid;
-	Array[2] = dataRw->rxSa.ssci;
+	array[1] = dataRw->rxSa.rxSAValid;
+	array[2] = dataRw->rxSa.ssci;
 
 	for (i = 0; i < 3; i++)
 	{
-		Array[3 + i] = ((dataRw->rxSa.salt[4 * i]) << 24) + ((dataRw->rxSa.salt[4 * i + 1]) << 16)
+		array[3 + i] = ((dataRw->rxSa.salt[4 * i]) << 24) + ((dataRw->rxSa.salt[4 * i + 1]) << 16)
 			+ ((dataRw->rxSa.salt[4 * i + 2]) << 8) + dataRw->rxSa.salt[4 * i + 3];
 	}
 
-	Array[6] = ((dataRw->rxSa.nextPN) >> 32) & 0xFFFFFFFFU;
-	Array[7] = (dataRw->rxSa.nextPN) & 0xFFFFFFFFU;
+	array[6] = ((dataRw->rxSa.nextPN) >> 32) & 0xFFFFFFFFU;
+	array[7] = (dataRw->rxSa.nextPN) & 0xFFFFFFFFU;
 
 	for (i = 0; i < 8; i++)
 	{
-		Array[9 + i] = ((dataRw->rxSa.sak[4 * i]) << 24) + ((dataRw->rxSa.sak[4 * i + 1]) << 16)
+		array[9 + i] = ((dataRw->rxSa.sak[4 * i]) << 24) + ((dataRw->rxSa.sak[4 * i + 1]) << 16)
 			+ ((dataRw->rxSa.sak[4 * i + 2]) << 8) + dataRw->rxSa.sak[4 * i + 3];
 	}
-
-	return Array;
 }
-static MSD_U32* ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw)
+static void ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw, OUT MSD_U32* array)
 {
-	static MSD_U32 Array[TX_SA_WIDTH + SAK_WIDTH] = { 0 };
 	MSD_U8 i;
 
-	Array[1] = dataRw->txSa.txSAValid;
-	Array[2] = dataRw->txSa.ssci;
+	array[1] = dataRw->txSa.txSAValid;
+	array[2] = dataRw->txSa.ssci;
 
 	for (i = 0; i < 3; i++)
 	{
-		Array[3 + i] = ((dataRw->txSa.salt[4 * i]) << 24) + ((dataRw->txSa.salt[4 * i + 1]) << 16)
+		array[3 + i] = ((dataRw->txSa.salt[4 * i]) << 24) + ((dataRw->txSa.salt[4 * i + 1]) << 16)
 			+ ((dataRw->txSa.salt[4 * i + 2]) << 8) + dataRw->txSa.salt[4 * i + 3];
 	}
 
-	Array[6] = ((dataRw->txSa.nextPN) >> 32) & 0xFFFFFFFFU;
-	Array[7] = (dataRw->txSa.nextPN) & 0xFFFFFFFFU;
+	array[6] = ((dataRw->txSa.nextPN) >> 32) & 0xFFFFFFFFU;
+	array[7] = (dataRw->txSa.nextPN) & 0xFFFFFFFFU;
 
 	for (i = 0; i < 8; i++)
 	{
-		Array[9 + i] = ((dataRw->txSa.sak[4 * i]) << 24) + ((dataRw->txSa.sak[4 * i + 1]) << 16)
+		array[9 + i] = ((dataRw->txSa.sak[4 * i]) << 24) + ((dataRw->txSa.sak[4 * i + 1]) << 16)
 			+ ((dataRw->txSa.sak[4 * i + 2]) << 8) + dataRw->txSa.sak[4 * i + 3];
 	}
-	return Array;
 }
 
 
 /*In case MACSec Read\Write change*/
 static MSD_STATUS Fir_MACSecGetAnyRegField
 (
-	IN  MSD_QD_DEV dev,
+	IN  MSD_QD_DEV *dev,
 	IN  MSD_U32    regAddr,
 	IN  MSD_U32    fieldOffset,
 	IN  MSD_U32    fieldLength,
@@ -2287,7 +2514,7 @@ static MSD_STATUS Fir_MACSecGetAnyRegField
 
 static MSD_STATUS Fir_WaitOperationReady
 (
-	IN  MSD_QD_DEV dev,
+	IN  MSD_QD_DEV *dev,
 	IN MSD_32 regAddr
 )
 {
@@ -2320,7 +2547,7 @@ static MSD_STATUS Fir_SAKOperation
 
 	regAddr = BASE_SAK;
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
+	retVal = Fir_WaitOperationReady(dev, regAddr);
 	if (retVal != MSD_OK)
 	{
 		return retVal;
@@ -2328,7 +2555,7 @@ static MSD_STATUS Fir_SAKOperation
 
 	tempData = 0;
 	tempData = (MSD_U32)((1 << 15) | (sakOp << 12) | index);
-	retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+	retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 	if (retVal != MSD_OK)
 	{
 		MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2336,7 +2563,7 @@ static MSD_STATUS Fir_SAKOperation
 	}
 
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
+	retVal = Fir_WaitOperationReady(dev, regAddr);
 	if (retVal != MSD_OK)
 	{
 		return retVal;
@@ -2358,7 +2585,7 @@ static MSD_STATUS Fir_OperationPerform
 	MSD_U32          tempData;     /* temporary Data storage */
 
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
+	retVal = Fir_WaitOperationReady(dev, regAddr);
 	if (retVal != MSD_OK)
 	{
 		return retVal;
@@ -2370,7 +2597,7 @@ static MSD_STATUS Fir_OperationPerform
 	case FIR_MACSec_FLUSH_ALL:
 	{
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2378,7 +2605,7 @@ static MSD_STATUS Fir_OperationPerform
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12));
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2390,7 +2617,7 @@ static MSD_STATUS Fir_OperationPerform
 	case FIR_MACSec_FLUSH_ONE:
 	{
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2398,7 +2625,7 @@ static MSD_STATUS Fir_OperationPerform
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2410,13 +2637,13 @@ static MSD_STATUS Fir_OperationPerform
 	case FIR_MACSec_LOAD_ENTRY:
 	{
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
 		}
 
-		retVal = MACSec_SetMEMData(*dev, memType, opData);
+		retVal = MACSec_SetMEMData(dev, memType, opData);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2424,7 +2651,7 @@ static MSD_STATUS Fir_OperationPerform
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2432,7 +2659,7 @@ static MSD_STATUS Fir_OperationPerform
 		}
 
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2443,7 +2670,7 @@ static MSD_STATUS Fir_OperationPerform
 
 	case FIR_MACSec_LOAD_PN_ONLY_GET_NEXT_ENTRY:
 	{
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2451,21 +2678,21 @@ static MSD_STATUS Fir_OperationPerform
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
 			return retVal;
 		}
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
 		}
 
 		/* read the updated entry index*/
-		retVal = Fir_gmacsecRead(*dev, regAddr, &tempData);
+		retVal = Fir_gmacsecRead(dev, regAddr, &tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecRead function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2475,7 +2702,7 @@ static MSD_STATUS Fir_OperationPerform
 		if ((tempData & (MSD_U32)0xff) == (MSD_U32)0xff)
 		{
 			MSD_U32 data1;
-			retVal = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_TCAM_DA_5_4_OFFSET, &data1);
+			retVal = Fir_gmacsecRead(dev, regAddr + FIR_MSEC_TCAM_DA_5_4_OFFSET, &data1);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecRead function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2493,7 +2720,7 @@ static MSD_STATUS Fir_OperationPerform
 		}
 
 		/* Get next entry and read the entry */
-		retVal = MACSec_GetMEMData(*dev, memType, opData);   
+		retVal = MACSec_GetMEMData(dev, memType, opData);   
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2503,7 +2730,7 @@ static MSD_STATUS Fir_OperationPerform
 	case FIR_MACSec_READ_ENTRY:
 	{
 
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2511,27 +2738,27 @@ static MSD_STATUS Fir_OperationPerform
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		retVal = Fir_gmacsecWrite(dev, regAddr, tempData);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
 			return retVal;
 		}
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
 		}
 
-		retVal = MACSec_GetMEMData(*dev, memType, opData);   
+		retVal = MACSec_GetMEMData(dev, memType, opData);   
 		if (retVal != MSD_OK)
 		{
 			return retVal;
 		}
 
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(dev, regAddr);
 		if (retVal != MSD_OK)
 		{
 			return retVal;
@@ -2548,14 +2775,14 @@ static MSD_STATUS Fir_OperationPerform
 
 static MSD_STATUS MACSec_SetMEMData
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN FIR_MEMTYPE memType,
 	IN FIR_MACSec_DATA_HW* tcamDataP
 )
 {
 	MSD_STATUS retVal = MSD_OK;    /* Functions return value */
-	MSD_U8 i;
 	MSD_U32 array[RX_SA_WIDTH + SAK_WIDTH] = { 0 };
+	MSD_U32 width = 0;
 	MSD_U32 regAddr = 0;
 	MSD_32 _regAddr = 0;
 
@@ -2563,177 +2790,61 @@ static MSD_STATUS MACSec_SetMEMData
 	switch (memType)
 	{
 	case FIR_TYPE_RULE:
-	{
-		msdMemCpy(array, ConvertRuleToArray(tcamDataP), TCAM_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_RULE, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-
-		/*Set TCAM data*/
-		for (i = 1; i < TCAM_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-	}
-	break;
-
+		ConvertRuleToArray(tcamDataP, array);
+		width = TCAM_WIDTH;
+		break;
 	case FIR_TYPE_ACTION:
-	{
-		msdMemCpy(array, ConvertActionToArray(tcamDataP), TCAM_ACTION_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_ACTION, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*Action Data*/
-		retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth, array[1]);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			break;
-		}
-	}
-	break;
-
+		ConvertActionToArray(tcamDataP, array);
+		width = TCAM_ACTION_WIDTH;
+		break;
 	case FIR_TYPE_RX_SECY:
-	{
-		msdMemCpy(array, ConvertRXSecYToArray(tcamDataP), RX_SECY_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_RX_SECY, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*RX SecY Data*/
-		for (i = 1; i < RX_SECY_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-	}
-	break;
-
+		ConvertRXSecYToArray(tcamDataP, array);
+		width = RX_SECY_WIDTH;
+		break;
 	case FIR_TYPE_TX_SECY:
-	{
-		msdMemCpy(array, ConvertTXSecYToArray(tcamDataP), TX_SECY_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_TX_SECY, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*TX SecY Data*/
-		for (i = 1; i < TX_SECY_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-	}
-	break;
-
+		ConvertTXSecYToArray(tcamDataP, array);
+		width = TX_SECY_WIDTH;
+		break;
 	case FIR_TYPE_RX_SC:
-	{
-		msdMemCpy(array, ConvertRXSCToArray(tcamDataP), RX_SC_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_RX_SC, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*RX SC Data*/
-		for (i = 1; i < RX_SC_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-
-	}
-	break;
-
+		ConvertRXSCToArray(tcamDataP, array);
+		width = RX_SC_WIDTH;
+		break;
 	case FIR_TYPE_TX_SC:
-	{
-		msdMemCpy(array, ConvertTXSCToArray(tcamDataP), TX_SC_WIDTH * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_TX_SC, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*TX SC Data*/
-		for (i = 1; i < TX_SC_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-
+		ConvertTXSCToArray(tcamDataP, array);
+		width = TX_SC_WIDTH;
+		break;
+	case FIR_TYPE_RX_SA:
+		ConvertRXSAToArray(tcamDataP, array);
+		width = RX_SA_WIDTH;
+		break;
+	case FIR_TYPE_TX_SA:
+		ConvertTXSAToArray(tcamDataP, array);
+		width = TX_SA_WIDTH;
+		break;
+	default:
+		return retVal;
 	}
-	break;
 
-	case FIR_TYPE_RX_SA:
+	/* Word 0 is the operation register, the data words follow it */
+	GET_MEM_ADDR(memType, _regAddr);
+	regAddr = (MSD_U32)_regAddr;
+	retVal = Fir_macsecWriteBurst(dev, regAddr + regBusWidth, &array[1], width - 1);
+	if (retVal != MSD_OK)
 	{
-		msdMemCpy(array, ConvertRXSAToArray(tcamDataP), (RX_SA_WIDTH + SAK_WIDTH) * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_RX_SA, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*RX SA Data*/
-		for (i = 1; i < RX_SA_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
-		regAddr = (MSD_U32)BASE_SAK;
-		/*RX SAK Data*/
-		for (i = RX_SA_WIDTH + 1; i < RX_SA_WIDTH + SAK_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * (i - RX_SA_WIDTH), array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
+		MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
 	}
-	break;
 
-	case FIR_TYPE_TX_SA:
+	/* SAK Data */
+	if ((memType == FIR_TYPE_RX_SA) || (memType == FIR_TYPE_TX_SA))
 	{
-
-		msdMemCpy(array, ConvertTXSAToArray(tcamDataP), (TX_SA_WIDTH + SAK_WIDTH) * sizeof(MSD_U32));
-		GET_MEM_ADDR(FIR_TYPE_TX_SA, _regAddr);
-		regAddr = (MSD_U32)_regAddr;
-		/*TX SA Data*/
-		for (i = 1; i < TX_SA_WIDTH; i++)
-		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
-		}
 		regAddr = (MSD_U32)BASE_SAK;
-		/*TX SAK Data*/
-		for (i = TX_SA_WIDTH + 1; i < TX_SA_WIDTH + SAK_WIDTH; i++)
+		retVal = Fir_macsecWriteBurst(dev, regAddr + regBusWidth, &array[width + 1], SAK_WIDTH - 1);
+		if (retVal != MSD_OK)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * (i - TX_SA_WIDTH), array[i]);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-				break;
-			}
+			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
 		}
 	}
-	break;
-
-	default:
-	{
-		break;
-	}
-	}
 
 	return retVal;
 
@@ -2741,7 +2852,7 @@ static MSD_STATUS MACSec_SetMEMData
 
 static MSD_STATUS MACSec_GetMEMData
 (
-	IN  MSD_QD_DEV dev,
+	IN  MSD_QD_DEV *dev,
 	IN FIR_MEMTYPE memType,
 	OUT FIR_MACSec_DATA_HW* tcamDataP
 )
@@ -2750,28 +2861,28 @@ static MSD_STATUS MACSec_GetMEMData
 	switch (memType)
 	{
 	case FIR_TYPE_RULE:
-		msdMemCpy(&(tcamDataP->rule), ConvertArrayToRule(dev), sizeof(FIR_MSEC_RULE));
+		retVal = ConvertArrayToRule(dev, &(tcamDataP->rule));
 		break;
 	case FIR_TYPE_ACTION:
-		msdMemCpy(&(tcamDataP->action), ConvertArrayToAction(dev), sizeof(FIR_MSEC_TCAM_ACTION));
+		retVal = ConvertArrayToAction(dev, &(tcamDataP->action));
 		break;
 	case FIR_TYPE_RX_SECY:
-		msdMemCpy(&(tcamDataP->rxSecy), ConvertArrayToRxSecY(dev), sizeof(FIR_SECY_INGRESS));
+		retVal = ConvertArrayToRxSecY(dev, &(tcamDataP->rxSecy));
 		break;
 	case FIR_TYPE_TX_SECY:
-		msdMemCpy(&(tcamDataP->txSecy), ConvertArrayToTxSecY(dev), sizeof(FIR_SECY_EGRESS));
+		retVal = ConvertArrayToTxSecY(dev, &(tcamDataP->txSecy));
 		break;
 	case FIR_TYPE_RX_SC:
-		msdMemCpy(&(tcamDataP->rxSc), ConvertArrayToRxSc(dev), sizeof(FIR_MSEC_RX_SC));
+		retVal = ConvertArrayToRxSc(dev, &(tcamDataP->rxSc));
 		break;
 	case FIR_TYPE_TX_SC:
-		msdMemCpy(&(tcamDataP->txSc), ConvertArrayToTxSc(dev), sizeof(FIR_MSEC_TX_SC));
+		retVal = ConvertArrayToTxSc(dev, &(tcamDataP->txSc));
 		break;
 	case FIR_TYPE_RX_SA:
-		msdMemCpy(&(tcamDataP->rxSa), ConvertArrayToRxSa(dev), sizeof(FIR_MSEC_RX_SA));
+		retVal = ConvertArrayToRxSa(dev, &(tcamDataP->rxSa));
 		break;
 	case FIR_TYPE_TX_SA:
-		msdMemCpy(&(tcamDataP->txSa), ConvertArrayToTxSa(dev), sizeof(FIR_MSEC_TX_SA));
+		retVal = ConvertArrayToTxSa(dev, &(tcamDataP->txSa));
 		break;
 	default:
 		retVal = MSD_FAIL;
@@ -191,6 +191,71 @@ MSD_STATUS Fir_gpirlInitResource
     return retVal;
 }
 
+/*******************************************************************************
+* Fir_pirlEvalIncrement
+*
+* DESCRIPTION:
+*       Evaluates one bucket increment for Fir_gpirlCustomSetup_sr2c and keeps
+*       it in setup if it gives a smaller rate error than the best so far.
+*
+* INPUTS:
+*       bktInc      - bucket increment to evaluate
+*       tgRate      - target rate in bps or fps
+*       irlConstant - IRL constant of the count mode
+*       tgtBstSize  - target burst size
+*       deltaMin    - smallest rate error found so far
+*       setup       - parameters giving deltaMin
+*
+* OUTPUTS:
+*       deltaMin    - updated smallest rate error
+*       setup       - updated bktIncrement, bktRateFactorGrn and cbsLimit
+*
+* RETURNS:
+*       MSD_TRUE if the bucket rate factor of bktInc fits in 16 bits,
+*       MSD_FALSE otherwise.
+*
+* COMMENTS:
+*       On equal rate error the smaller bucket increment is kept.
+*
+*******************************************************************************/
+static MSD_BOOL Fir_pirlEvalIncrement
+(
+    IN    MSD_U32  bktInc,
+    IN    MSD_DOUBLE  tgRate,
+    IN    MSD_DOUBLE  irlConstant,
+    IN    MSD_U32  tgtBstSize,
+    INOUT MSD_DOUBLE  *deltaMin,
+    INOUT FIR_MSD_PIRL_CUSTOM_RATE_LIMIT  *setup
+)
+{
+    MSD_U32 bktRateFactorGrn;
+    MSD_DOUBLE rate;
+    MSD_DOUBLE delta;
+
+    bktRateFactorGrn = (MSD_U32)((tgRate / irlConstant) * bktInc + 0.5);
+    if (bktRateFactorGrn >= (MSD_U32)0xFFFF)
+    {
+        return MSD_FALSE;
+    }
+
+    rate = irlConstant * ((MSD_DOUBLE)bktRateFactorGrn / bktInc);
+    delta = (MSD_DOUBLE)(tgRate - rate) / tgRate;
+    if (delta < (MSD_DOUBLE)0)
+    {
+        delta = (MSD_DOUBLE)0 - delta;
+    }
+
+    if ((*deltaMin > delta) || ((*deltaMin == delta) && (bktInc < setup->bktIncrement)))
+    {
+        *deltaMin = delta;
+        setup->bktIncrement = bktInc;
+        setup->bktRateFactorGrn = (MSD_U16)bktRateFactorGrn;
+        setup->cbsLimit = bktInc * tgtBstSize;
+    }
+
+    return MSD_TRUE;
+}
+
 /*******************************************************************************
 * Fir_gpirlCustomSetup_sr2c
 *
@@ -215,6 +280,11 @@ MSD_STATUS Fir_gpirlInitResource
 * COMMENTS:
 *		We have the following contrain in calculate the final parameters:
 *			CBS >= BktIncrement * tFir_gtBstSize
+*		The rate is IRL constant * BRFGrn / BktIncrement, so the best setup is
+*		the best rational approximation of tgtRate / IRL constant whose
+*		denominator BktIncrement stays within the CBS and BRFGrn limits. It
+*		is taken from the continued fraction expansion of that ratio, which
+*		needs a few dozen steps instead of trying every BktIncrement.
 *
 *******************************************************************************/
 MSD_STATUS Fir_gpirlCustomSetup_sr2c
@@ -229,13 +299,15 @@ MSD_STATUS Fir_gpirlCustomSetup_sr2c
 #else
 	MSD_U32 IRL_constant = (MSD_U32)500000000;
 	MSD_U16 bktIncrement = (MSD_U16)0x1FFF;
-    MSD_U16 bktRateFactorGrn = 0U;
     MSD_U32 cbsLimit = (MSD_U32)0xFFFFFF;
 
     FIR_MSD_PIRL_CUSTOM_RATE_LIMIT Setup;
-    MSD_DOUBLE	   	Rate = 0.0;
-    MSD_DOUBLE delta = 1.0, deltaMin = 1.0, mode = 1.0;
-    MSD_U32 j;
+    MSD_DOUBLE deltaMin = 1.0;
+    MSD_DOUBLE ratio;
+    MSD_DOUBLE x;
+    MSD_DOUBLE frac;
+    MSD_U32 maxInc;
+    MSD_U32 a, q0, q1, q2;
     MSD_DOUBLE tgRate = (MSD_DOUBLE)(tgtRate * 1000.0);
 
     MSD_DBG_INFO(("Fir_gpirlCustomSetup Called.\n"));
@@ -252,41 +324,72 @@ MSD_STATUS Fir_gpirlCustomSetup_sr2c
 	{
 		IRL_constant /= 8U;
 	}
+    ratio = tgRate / IRL_constant;
 
-    for (j = 1U; j < bktIncrement; j++)
+    /* largest BktIncrement allowed by the register width and by CBS,
+     * a burst that does not fit in CBS leaves no BktIncrement at all */
+    maxInc = (MSD_U32)bktIncrement - 1U;
+    if (tgtBstSize >= cbsLimit)
     {
-		if ((MSD_U32)((MSD_DOUBLE)(cbsLimit / j) + 0.5) < (tgtBstSize + 1U))
-		{
-			continue;
-		}
-		if ((MSD_U32)((tgRate / IRL_constant) * j * mode + 0.5) < 0xFFFF)
-		{
-			bktRateFactorGrn = (MSD_U16)((tgRate / IRL_constant) * j * mode + 0.5);
-		}
-		else
-		{
-			continue;
-		}
-
-        Rate = (MSD_DOUBLE)((IRL_constant / mode) * ((MSD_DOUBLE)bktRateFactorGrn / j));
-        delta = (MSD_DOUBLE)(tgRate - Rate) / tgRate;
-		if (delta < (MSD_DOUBLE)0)
-		{
-			delta = (MSD_DOUBLE)0 - delta;
-		}
+        maxInc = 0U;
+    }
+    else if (maxInc > (cbsLimit / (tgtBstSize + 1U)))
+    {
+        maxInc = cbsLimit / (tgtBstSize + 1U);
+    }
+    /* and by BRFGrn, which grows with BktIncrement */
+    if ((ratio * maxInc) >= 65534.5)
+    {
+        maxInc = (MSD_U32)(65534.5 / ratio);
+        while ((maxInc > 0U) && (((MSD_U32)(ratio * maxInc + 0.5)) >= (MSD_U32)0xFFFF))
+        {
+            maxInc--;
+        }
+    }
 
-        if (deltaMin > delta)
+    /* convergents q1 and semiconvergents of ratio, denominators only */
+    q0 = 1U;
+    q1 = 0U;
+    x = ratio;
+    while (maxInc > 0U)
+    {
+        if (q1 == 0U)
+        {
+            a = 0U;
+        }
+        else if (x >= ((MSD_DOUBLE)maxInc + 1.0))
+        {
+            a = maxInc + 1U;
+        }
+        else
         {
-            deltaMin = delta;
-            Setup.bktIncrement = j;
-            Setup.bktRateFactorGrn = bktRateFactorGrn;
-            Setup.cbsLimit = j * tgtBstSize;
+            a = (MSD_U32)x;
+        }
 
-			if (delta == (MSD_DOUBLE)0)
+        q2 = (a * q1) + q0;
+        if (q2 > maxInc)
+        {
+            if (q1 != 0U)
             {
-                break;
+                a = (maxInc - q0) / q1;
+                if (a > 0U)
+                {
+                    (void)Fir_pirlEvalIncrement((a * q1) + q0, tgRate, (MSD_DOUBLE)IRL_constant, tgtBstSize, &deltaMin, &Setup);
+                }
             }
+            break;
+        }
+
+        (void)Fir_pirlEvalIncrement(q2, tgRate, (MSD_DOUBLE)IRL_constant, tgtBstSize, &deltaMin, &Setup);
+        q0 = q1;
+        q1 = q2;
+
+        frac = x - (MSD_DOUBLE)((MSD_U32)x);
+        if ((frac <= (MSD_DOUBLE)0) || (deltaMin == (MSD_DOUBLE)0))
+        {
+            break;
         }
+        x = 1.0 / frac;
     }
 
 	if (deltaMin == (MSD_DOUBLE)1)
@@ -22,6 +22,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 typedef enum
 {
@@ -74,6 +75,9 @@ typedef struct
     MSD_U32    nData;
 } FIR_MSD_PTP_OP_DATA;
 
+/* port status register of the Arr0, Arr1, Dep and Dep1 time stamps */
+static const MSD_U8 firPtpTsStatusReg[4] = { 8U, 12U, 16U, 24U };
+
 
 /********************************************************/
 /*     static function declaration                      */
@@ -91,6 +95,48 @@ static MSD_STATUS ptpOperationPerform
     IN    FIR_MSD_PTP_OPERATION      ptpOp,
     INOUT FIR_MSD_PTP_OP_DATA        *opData
 );
+static MSD_STATUS gptpTsStatusDecode
+(
+    IN  MSD_U32 *tsData,
+    OUT MSD_PTP_TS_STATUS *ptpStatus
+);
+static void gptpRmuCmdSet
+(
+    OUT MSD_RegCmd *regCmd,
+    IN  MSD_U8 isWaitOnBit,
+    IN  MSD_U8 opCode,
+    IN  MSD_U8 regAddr,
+    IN  MSD_U16 data
+);
+static MSD_STATUS gptpTsHarvestRmu
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 nSlot,
+    IN  MSD_LPORT *slotPort,
+    IN  MSD_U8 *slotTime,
+    OUT MSD_PTP_TS_EVENT *events,
+    OUT MSD_U32 *numEvents
+);
+
+static MSD_STATUS gptpAvbRegRead
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8 regAddr,
+    OUT MSD_U16 *data
+);
+static MSD_STATUS gptpAvbRegWrite
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8 regAddr,
+    IN  MSD_U16 data
+);
+static MSD_STATUS gptpGlobalTimeSampleRead
+(
+    IN  MSD_QD_DEV *dev,
+    OUT MSD_U64 *hostBefore,
+    OUT MSD_U64 *hostAfter,
+    OUT MSD_U32 *ptpTime
+);
 
 static MSD_STATUS gptpSetReg
 (
@@ -552,6 +598,117 @@ MSD_STATUS Fir_gptpResetTimeStamp
     return retVal;
 }
 
+/*******************************************************************************
+* Fir_gptpTimeStampHarvest
+*
+* DESCRIPTION:
+*       This routine collects the valid time stamps of a set of ports in one
+*       sweep and clears them in the same sequence.
+*       With RMU the status word of every requested time stamp is read in one
+*       frame, then the valid time stamps are read and cleared in a second
+*       frame, so the whole sweep costs two round trips. Without RMU every
+*       time stamp is fetched with a read time stamp operation, which reads
+*       only the status word when no time stamp is pending.
+*
+* INPUTS:
+*       portVec    - logical port vector of the ports to sweep
+*       timeMask   - bit n set to sweep MSD_PTP_TIME n (Arr0, Arr1, Dep, Dep1)
+*
+* OUTPUTS:
+*       events     - valid time stamps, MSD_PTP_TS_HARVEST_MAX entries
+*       numEvents  - number of entries written to events
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Port 0 does not support PTP and is skipped.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gptpTimeStampHarvest
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    portVec,
+    IN  MSD_U8     timeMask,
+    OUT MSD_PTP_TS_EVENT    *events,
+    OUT MSD_U32    *numEvents
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_LPORT slotPort[MSD_PTP_TS_HARVEST_MAX];
+    MSD_U8 slotTime[MSD_PTP_TS_HARVEST_MAX];
+    MSD_U32 nSlot = 0;
+    MSD_LPORT port;
+    MSD_U8 time;
+    MSD_U32 i;
+    FIR_MSD_PTP_OP_DATA opData;
+    MSD_PTP_TS_STATUS tsStatus;
+
+    MSD_DBG_INFO(("Fir_gptpTimeStampHarvest Called.\n"));
+
+    if ((events == NULL) || (numEvents == NULL))
+    {
+        MSD_DBG_ERROR(("events or numEvents is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    *numEvents = 0;
+
+    for (port = 1; (port < (MSD_LPORT)dev->numOfPorts) && (port < MSD_MAX_SWITCH_PORTS); port++)
+    {
+        if ((portVec & ((MSD_U32)1 << port)) == 0U)
+        {
+            continue;
+        }
+        for (time = 0; time < (MSD_U8)4; time++)
+        {
+            if ((timeMask & (MSD_U8)(1U << time)) != 0U)
+            {
+                slotPort[nSlot] = port;
+                slotTime[nSlot] = time;
+                nSlot++;
+            }
+        }
+    }
+
+    if (IS_RMU_SUPPORTED(dev))
+    {
+        retVal = gptpTsHarvestRmu(dev, nSlot, slotPort, slotTime, events, numEvents);
+    }
+    else
+    {
+        for (i = 0; (retVal == MSD_OK) && (i < nSlot); i++)
+        {
+            opData.ptpPort = MSD_LPORT_2_PORT(slotPort[i]);
+            opData.ptpBlock = (MSD_U32)FIR_MSD_AVB_BLOCK_PTP;
+            opData.ptpAddr = firPtpTsStatusReg[slotTime[i]];
+            opData.nData = 4;
+
+            /* reads the status word, and when valid the time stamp, then clears it */
+            retVal = ptpOperationPerform(dev, FIR_PTP_READ_TIMESTAMP_DATA, &opData);
+            if ((retVal == MSD_OK) && ((opData.ptpMultiData[0] & (MSD_U32)0x1) == (MSD_U32)1))
+            {
+                if (gptpTsStatusDecode(opData.ptpMultiData, &tsStatus) == MSD_OK)
+                {
+                    events[*numEvents].port = slotPort[i];
+                    events[*numEvents].timeToRead = (MSD_PTP_TIME)slotTime[i];
+                    events[*numEvents].tsStatus = tsStatus;
+                    (*numEvents)++;
+                }
+            }
+        }
+    }
+
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_gptpTimeStampHarvest returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+
+    MSD_DBG_INFO(("Fir_gptpTimeStampHarvest Exit.\n"));
+    return retVal;
+}
+
 MSD_STATUS Fir_gptpGetIntStatus
 (
     IN  MSD_QD_DEV* dev,
@@ -977,6 +1134,74 @@ MSD_STATUS Fir_gtaiGetPTPGlobalTime
     return retVal;
 }
 
+MSD_STATUS Fir_gtaiGetPTPGlobalTimeSample
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 numReads,
+    OUT MSD_PTP_TIME_SAMPLE *sample
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_U64 hostBefore;
+    MSD_U64 hostAfter;
+    MSD_U64 width;
+    MSD_U64 bestWidth = 0;
+    MSD_U64 bestBefore = 0;
+    MSD_U32 ptpTime;
+    MSD_U32 bestTime = 0;
+    MSD_U32 i;
+    MSD_DBG_INFO(("Fir_gtaiGetPTPGlobalTimeSample Called.\n"));
+
+    if ((sample == NULL) || (numReads == 0U) || (numReads > MSD_PTP_TIME_SAMPLE_MAX))
+    {
+        MSD_DBG_ERROR(("Bad numReads %u or sample is NULL.\n", (unsigned int)numReads));
+        return MSD_BAD_PARAM;
+    }
+    if (dev->getHostTime == NULL)
+    {
+        MSD_DBG_ERROR(("No host time function registered.\n"));
+        return MSD_NOT_SUPPORTED;
+    }
+
+    /* the semaphore is held over all reads so that waiting for it is not inside a sample */
+    msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+    for (i = 0; (retVal == MSD_OK) && (i < numReads); i++)
+    {
+        retVal = gptpGlobalTimeSampleRead(dev, &hostBefore, &hostAfter, &ptpTime);
+        if ((retVal == MSD_OK) && (hostAfter < hostBefore))
+        {
+            MSD_DBG_ERROR(("Host time is not monotonic.\n"));
+            retVal = MSD_FAIL;
+        }
+        if (retVal == MSD_OK)
+        {
+            width = hostAfter - hostBefore;
+            if ((i == 0U) || (width < bestWidth))
+            {
+                bestWidth = width;
+                bestBefore = hostBefore;
+                bestTime = ptpTime;
+            }
+        }
+    }
+
+    msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_gtaiGetPTPGlobalTimeSample returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+
+    sample->hwTime = bestTime;
+    sample->uncertainty = bestWidth / 2U;
+    sample->hostTimeMid = bestBefore + sample->uncertainty;
+
+    MSD_DBG_INFO(("Fir_gtaiGetPTPGlobalTimeSample Exit.\n"));
+    return retVal;
+}
+
 MSD_STATUS Fir_gptpPortRegGet
 (
     IN  MSD_QD_DEV  *dev,
@@ -2728,3 +2953,293 @@ static MSD_STATUS gtaiRegSet
     MSD_LPORT portNum = 0x1EU;
     return gptpSetReg(dev, portNum, regOffset, (MSD_U32)data);
 }
+
+static MSD_STATUS gptpTsStatusDecode
+(
+    IN  MSD_U32 *tsData,
+    OUT MSD_PTP_TS_STATUS *ptpStatus
+)
+{
+    MSD_U32 temp;
+
+    ptpStatus->isValid = ((tsData[0] & (MSD_U32)0x1) == (MSD_U32)1) ? MSD_TRUE : MSD_FALSE;
+    temp = (tsData[0] >> 1) & (MSD_U32)0x3;
+    if (temp == (MSD_U32)0)
+    {
+        ptpStatus->status = MSD_PTP_INT_NORMAL;
+    }
+    else if (temp == (MSD_U32)1)
+    {
+        ptpStatus->status = MSD_PTP_INT_OVERWRITE;
+    }
+    else if (temp == (MSD_U32)2)
+    {
+        ptpStatus->status = MSD_PTP_INT_DROP;
+    }
+    else
+    {
+        MSD_DBG_ERROR(("Invalid .MSD_PTP_INT_STATUS\n"));
+        return MSD_FAIL;
+    }
+    ptpStatus->timeStamped = FIRMSD_PTP_BUILD_TIME(tsData[2], tsData[1]);
+    ptpStatus->ptpSeqId = tsData[3];
+
+    return MSD_OK;
+}
+
+static void gptpRmuCmdSet
+(
+    OUT MSD_RegCmd *regCmd,
+    IN  MSD_U8 isWaitOnBit,
+    IN  MSD_U8 opCode,
+    IN  MSD_U8 regAddr,
+    IN  MSD_U16 data
+)
+{
+    regCmd->isWaitOnBit = isWaitOnBit;
+    regCmd->opCode = opCode;
+    regCmd->devAddr = FIR_GLOBAL2_DEV_ADDR;
+    regCmd->regAddr = regAddr;
+    regCmd->data = data;
+}
+
+static MSD_STATUS gptpAvbRegRead
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8 regAddr,
+    OUT MSD_U16 *data
+)
+{
+    if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+    {
+        return Fir_msdDirectGetMultiChipReg(dev, regAddr, data);
+    }
+    return msdGetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, regAddr, data);
+}
+
+static MSD_STATUS gptpAvbRegWrite
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8 regAddr,
+    IN  MSD_U16 data
+)
+{
+    if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+    {
+        return Fir_msdDirectSetMultiChipReg(dev, regAddr, data);
+    }
+    return msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, regAddr, data);
+}
+
+/*
+* one bracketed read of the TAI global time, register 14 and 15 of the TAI
+* global block. The time is latched by the read command, so over SMI only the
+* command write and the busy poll are inside the host time stamps; over RMU the
+* whole frame is, as the data comes back with the command. Called with
+* ptpRegsSem taken.
+*/
+static MSD_STATUS gptpGlobalTimeSampleRead
+(
+    IN  MSD_QD_DEV *dev,
+    OUT MSD_U64 *hostBefore,
+    OUT MSD_U64 *hostAfter,
+    OUT MSD_U32 *ptpTime
+)
+{
+    MSD_STATUS retVal;
+    MSD_RegCmd regCmdList[5];
+    MSD_RegCmd *pRegCmd;
+    MSD_U16 cmd;
+    MSD_U16 data;
+    MSD_U16 low;
+    MSD_U16 high;
+
+    cmd = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(((MSD_U16)FIR_PTP_READ_MULTIPLE_DATA & 3U) << 13) |
+        (MSD_U16)((MSD_U16)0x1E << 8) | (MSD_U16)14);
+
+    if (IS_RMU_SUPPORTED(dev))
+    {
+        gptpRmuCmdSet(&regCmdList[0], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+        gptpRmuCmdSet(&regCmdList[1], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND, cmd);
+        gptpRmuCmdSet(&regCmdList[2], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+        gptpRmuCmdSet(&regCmdList[3], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        gptpRmuCmdSet(&regCmdList[4], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        pRegCmd = regCmdList;
+
+        retVal = dev->getHostTime(hostBefore);
+        if (retVal == MSD_OK)
+        {
+            retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, 5);
+        }
+        if (retVal == MSD_OK)
+        {
+            retVal = dev->getHostTime(hostAfter);
+        }
+        low = regCmdList[3].data;
+        high = regCmdList[4].data;
+    }
+    else
+    {
+        /* wait until the AVB unit is idle before the first host time stamp */
+        data = (MSD_U16)0x8000;
+        retVal = MSD_OK;
+        while ((retVal == MSD_OK) && ((data & (MSD_U16)0x8000) != 0U))
+        {
+            retVal = gptpAvbRegRead(dev, FIR_AVB_COMMAND, &data);
+        }
+
+        if (retVal == MSD_OK)
+        {
+            retVal = dev->getHostTime(hostBefore);
+        }
+        if (retVal == MSD_OK)
+        {
+            retVal = gptpAvbRegWrite(dev, FIR_AVB_COMMAND, cmd);
+        }
+        data = (MSD_U16)0x8000;
+        while ((retVal == MSD_OK) && ((data & (MSD_U16)0x8000) != 0U))
+        {
+            retVal = gptpAvbRegRead(dev, FIR_AVB_COMMAND, &data);
+        }
+        if (retVal == MSD_OK)
+        {
+            retVal = dev->getHostTime(hostAfter);
+        }
+
+        low = 0;
+        high = 0;
+        if (retVal == MSD_OK)
+        {
+            retVal = gptpAvbRegRead(dev, FIR_AVB_DATA, &low);
+        }
+        if (retVal == MSD_OK)
+        {
+            retVal = gptpAvbRegRead(dev, FIR_AVB_DATA, &high);
+        }
+    }
+
+    *ptpTime = ((MSD_U32)high << 16) | (MSD_U32)low;
+    return retVal;
+}
+
+/*
+* time stamp harvest over RMU. The first frames read the status word of every
+* slot, 4 commands per slot; the next frames read status and time stamp of
+* the valid slots with a multiple read and write the status word back to 0,
+* 9 commands per slot. Every AVB command waits on the busy bit in the switch.
+*/
+static MSD_STATUS gptpTsHarvestRmu
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 nSlot,
+    IN  MSD_LPORT *slotPort,
+    IN  MSD_U8 *slotTime,
+    OUT MSD_PTP_TS_EVENT *events,
+    OUT MSD_U32 *numEvents
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd;
+    MSD_U32 valid[MSD_PTP_TS_HARVEST_MAX];
+    MSD_U32 tsData[4];
+    MSD_U32 nValid = 0;
+    MSD_U32 first;
+    MSD_U32 num;
+    MSD_U32 nCmd;
+    MSD_U32 i;
+    MSD_U32 j;
+    MSD_U32 slot;
+    MSD_U16 cmdBase;
+    MSD_PTP_TS_STATUS tsStatus;
+
+    /* status sweep */
+    for (first = 0; (retVal == MSD_OK) && (first < nSlot); first += num)
+    {
+        num = nSlot - first;
+        if (num > (MSD_RMU_MAX_REGCMDS / 4U))
+        {
+            num = MSD_RMU_MAX_REGCMDS / 4U;
+        }
+
+        nCmd = 0;
+        for (i = 0; i < num; i++)
+        {
+            slot = first + i;
+            cmdBase = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)MSD_LPORT_2_PORT(slotPort[slot]) << 8) |
+                (MSD_U16)((MSD_U16)FIR_MSD_AVB_BLOCK_PTP << 5) | (MSD_U16)firPtpTsStatusReg[slotTime[slot]]);
+
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                (MSD_U16)(cmdBase | (MSD_U16)(((MSD_U16)FIR_PTP_READ_DATA & 3U) << 13)));
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        }
+
+        pRegCmd = regCmdList;
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+        retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+        for (i = 0; (retVal == MSD_OK) && (i < num); i++)
+        {
+            if ((regCmdList[(4U * i) + 3U].data & (MSD_U16)0x1) != 0U)
+            {
+                valid[nValid++] = first + i;
+            }
+        }
+    }
+
+    /* fetch and clear the valid time stamps */
+    for (first = 0; (retVal == MSD_OK) && (first < nValid); first += num)
+    {
+        num = nValid - first;
+        if (num > (MSD_RMU_MAX_REGCMDS / 9U))
+        {
+            num = MSD_RMU_MAX_REGCMDS / 9U;
+        }
+
+        nCmd = 0;
+        for (i = 0; i < num; i++)
+        {
+            slot = valid[first + i];
+            cmdBase = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)MSD_LPORT_2_PORT(slotPort[slot]) << 8) |
+                (MSD_U16)((MSD_U16)FIR_MSD_AVB_BLOCK_PTP << 5) | (MSD_U16)firPtpTsStatusReg[slotTime[slot]]);
+
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                (MSD_U16)(cmdBase | (MSD_U16)(((MSD_U16)FIR_PTP_READ_MULTIPLE_DATA & 3U) << 13)));
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, FIR_AVB_COMMAND, 15U);
+            for (j = 0; j < 4U; j++)
+            {
+                gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+            }
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, 0);
+            gptpRmuCmdSet(&regCmdList[nCmd++], MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                (MSD_U16)(cmdBase | (MSD_U16)(((MSD_U16)FIR_PTP_WRITE_DATA & 3U) << 13)));
+        }
+
+        pRegCmd = regCmdList;
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+        retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+        for (i = 0; (retVal == MSD_OK) && (i < num); i++)
+        {
+            slot = valid[first + i];
+            for (j = 0; j < 4U; j++)
+            {
+                tsData[j] = (MSD_U32)regCmdList[(9U * i) + 3U + j].data;
+            }
+            if ((gptpTsStatusDecode(tsData, &tsStatus) == MSD_OK) && (tsStatus.isValid == MSD_TRUE))
+            {
+                events[*numEvents].port = slotPort[slot];
+                events[*numEvents].timeToRead = (MSD_PTP_TIME)slotTime[slot];
+                events[*numEvents].tsStatus = tsStatus;
+                (*numEvents)++;
+            }
+        }
+    }
+
+    return retVal;
+}
@@ -23,6 +23,71 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+/* IEEE Priority Mapping Table register layout */
+#define FIR_PRI_MAP_UPDATE		(MSD_U16)0x8000
+#define FIR_PRI_MAP_DATA_MASK	(MSD_U16)0x1FF
+#define FIR_PRI_MAP_PTR(_table, _entry)	\
+	(MSD_U16)((MSD_U16)(((MSD_U16)(_entry) & (MSD_U16)0x7) << 9) | (MSD_U16)(((MSD_U16)(_table) & (MSD_U16)0x7) << 12))
+
+/****************************************************************************/
+/* internal IEEE priority map table related function declaration.           */
+/****************************************************************************/
+static MSD_STATUS Fir_IEEEPrioMap_Encode
+(
+IN  MSD_U8    table,
+IN  FIR_PRI_TABLE_STRUCT *entryStruct,
+OUT MSD_U16   *data
+);
+static void Fir_IEEEPrioMap_Decode
+(
+IN  MSD_U8    table,
+IN  MSD_U16   data,
+OUT FIR_PRI_TABLE_STRUCT *entryStruct
+);
+static void Fir_IEEEPrioMap_ShadowSet
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    hwPort,
+IN  MSD_U8    table,
+IN  MSD_U8    entryPtr,
+IN  MSD_U16   data
+);
+static MSD_STATUS Fir_IEEEPrioMap_WaitReady
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    phyAddr
+);
+static MSD_STATUS Fir_IEEEPrioMap_ReadTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    hwPort,
+IN  MSD_U8    table,
+OUT MSD_U16   *data
+);
+static MSD_STATUS Fir_IEEEPrioMap_WriteTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U32   hwPortVec,
+IN  MSD_U8    table,
+IN  MSD_U16   *data,
+IN  MSD_U16   *current
+);
+static MSD_STATUS Fir_IEEEPrioMap_RmuFlush
+(
+IN  MSD_QD_DEV *dev,
+INOUT MSD_RegCmd *regCmdList,
+IN  MSD_U32   nCmd
+);
+static MSD_STATUS Fir_IEEEPrioMap_ModifyTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_LPORT  port,
+IN  MSD_U8    table,
+IN  MSD_U16   fieldMask,
+IN  MSD_U16   *fieldData
+);
 
 
 /*******************************************************************************
@@ -543,55 +608,11 @@ MSD_STATUS Fir_gprtSetIEEEPrioMap
 
 	ptr = (MSD_U16)((MSD_U16)(((MSD_U16)entryPtr & (MSD_U16)0x7) << 9) | (MSD_U16)(((MSD_U16)table & (MSD_U16)0x7) << 12));
 
-	data = 0;
-
-	switch(table)
+	retVal = Fir_IEEEPrioMap_Encode((MSD_U8)table, entryStruct, &data);
+	if (retVal != MSD_OK)
 	{
-		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0:
-			MSD_BF_SET(data, entryStruct->ingTblDei0.ieeeYellow, 8, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei0.disIeeeQpri, 7, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei0.ieeeQpri, 4, 3);
-			MSD_BF_SET(data, entryStruct->ingTblDei0.disIeeeFpri, 3, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei0.ieeeFpri, 0, 3);
-			break;
-		case FIR_PRI_EG_GREEN_FPRI_2_PCP:
-			MSD_BF_SET(data,entryStruct->egGreeTblPcp.disVIDMarking, 4, 1);
-			MSD_BF_SET(data,entryStruct->egGreeTblPcp.disPCPMarking, 3, 1);
-			MSD_BF_SET(data,entryStruct->egGreeTblPcp.framePCP, 0, 3);
-			break;
-		case FIR_PRI_EG_YEL_FPRI_2_PCP:
-			MSD_BF_SET(data,entryStruct->egYelTblPcp.disVIDMarking, 4, 1);
-			MSD_BF_SET(data,entryStruct->egYelTblPcp.disPCPMarking, 3, 1);
-			MSD_BF_SET(data,entryStruct->egYelTblPcp.framePCP, 0, 3);
-			break;
-		case FIR_PRI_EG_AVB_FPRI_2_PCP:
-			MSD_BF_SET(data,entryStruct->egAvbTblPcp.disVIDMarking, 4, 1);
-			MSD_BF_SET(data,entryStruct->egAvbTblPcp.disPCPMarking, 3, 1);
-			MSD_BF_SET(data,entryStruct->egAvbTblPcp.framePCP, 0, 3);
-			break;
-		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_1:
-			MSD_BF_SET(data, entryStruct->ingTblDei1.ieeeYellow, 8, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei1.disIeeeQpri, 7, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei1.ieeeQpri, 4, 3);
-			MSD_BF_SET(data, entryStruct->ingTblDei1.disIeeeFpri, 3, 1);
-			MSD_BF_SET(data, entryStruct->ingTblDei1.ieeeFpri, 0, 3);
-			break;
-		case FIR_PRI_EG_GREEN_FPRI_2_DSCP:
-			MSD_BF_SET(data,entryStruct->egGreeTblDscp.enDSCPMarking, 6, 1);
-			MSD_BF_SET(data,entryStruct->egGreeTblDscp.frameDSCP, 0, 6);
-			break;
-		case FIR_PRI_EG_YEL_FPRI_2_DSCP:
-			MSD_BF_SET(data,entryStruct->egYelTblDscp.enDSCPMarking, 6, 1);
-			MSD_BF_SET(data,entryStruct->egYelTblDscp.frameDSCP, 0, 6);
-			break;
-		case FIR_PRI_EG_AVB_FPRI_2_DSCP:
-			MSD_BF_SET(data,entryStruct->egAvbTbldscp.enDSCPMarking, 6, 1);
-			MSD_BF_SET(data,entryStruct->egAvbTbldscp.frameDSCP, 0, 6);
-			break;
-        default:
-            MSD_DBG_ERROR(("Bad table: %u.\n", (MSD_U16)table));
-            return MSD_BAD_PARAM;
-			break;
+		MSD_DBG_ERROR(("Bad table: %u.\n", (MSD_U16)table));
+		return retVal;
 	}
 
 	data |= ptr;
@@ -628,6 +649,8 @@ MSD_STATUS Fir_gprtSetIEEEPrioMap
         return retVal;
     }
 
+	Fir_IEEEPrioMap_ShadowSet(dev, hwPort, (MSD_U8)table, entryPtr, data);
+
     msdSemGive(dev->devNum, dev->tblRegsSem);
 
     MSD_DBG_INFO(("Fir_gprtSetIEEEPrioMap Exit.\n"));
@@ -749,56 +772,11 @@ MSD_STATUS Fir_gprtGetIEEEPrioMap
 		return retVal;
 	}
 
+	Fir_IEEEPrioMap_ShadowSet(dev, hwPort, (MSD_U8)table, entryPtr, data);
+
     msdSemGive(dev->devNum, dev->tblRegsSem);
 
-	switch(table)
-	{
-		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0:			
-			entryStruct->ingTblDei0.ieeeYellow = (MSD_U8)(MSD_BF_GET(data, 8, 1));
-			entryStruct->ingTblDei0.disIeeeQpri = (MSD_U8)(MSD_BF_GET(data, 7, 1));
-			entryStruct->ingTblDei0.ieeeQpri = (MSD_U8)(MSD_BF_GET(data, 4, 3));
-			entryStruct->ingTblDei0.disIeeeFpri = (MSD_U8)(MSD_BF_GET(data, 3, 1));
-			entryStruct->ingTblDei0.ieeeFpri = (MSD_U8)(MSD_BF_GET(data, 0, 3));
-			break;
-		case FIR_PRI_EG_GREEN_FPRI_2_PCP:
-			entryStruct->egGreeTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
-			entryStruct->egGreeTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
-			entryStruct->egGreeTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
-			break;
-		case FIR_PRI_EG_YEL_FPRI_2_PCP:
-			entryStruct->egYelTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
-			entryStruct->egYelTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
-			entryStruct->egYelTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
-			break;
-		case FIR_PRI_EG_AVB_FPRI_2_PCP:
-			entryStruct->egAvbTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
-			entryStruct->egAvbTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
-			entryStruct->egAvbTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
-			break;
-		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_1:
-			entryStruct->ingTblDei1.ieeeYellow = (MSD_U8)(MSD_BF_GET(data, 8, 1));
-			entryStruct->ingTblDei1.disIeeeQpri = (MSD_U8)(MSD_BF_GET(data, 7, 1));
-			entryStruct->ingTblDei1.ieeeQpri = (MSD_U8)(MSD_BF_GET(data, 4, 3));
-			entryStruct->ingTblDei1.disIeeeFpri = (MSD_U8)(MSD_BF_GET(data, 3, 1));
-			entryStruct->ingTblDei1.ieeeFpri = (MSD_U8)(MSD_BF_GET(data, 0, 3));
-			break;
-		case FIR_PRI_EG_GREEN_FPRI_2_DSCP:
-			entryStruct->egGreeTblDscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
-			entryStruct->egGreeTblDscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
-			break;
-		case FIR_PRI_EG_YEL_FPRI_2_DSCP:
-			entryStruct->egYelTblDscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
-			entryStruct->egYelTblDscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
-			break;
-		case FIR_PRI_EG_AVB_FPRI_2_DSCP:
-			entryStruct->egAvbTbldscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
-			entryStruct->egAvbTbldscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
-			break;
-        default:
-            MSD_DBG_ERROR(("Bad table: %u.\n", table));
-            return MSD_BAD_PARAM;
-			break;
-	}
+	Fir_IEEEPrioMap_Decode((MSD_U8)table, data, entryStruct);
 
     MSD_DBG_INFO(("Fir_gprtGetIpPrioMap Exit.\n"));
     return MSD_OK;
@@ -1091,99 +1069,877 @@ MSD_STATUS Fir_gprtGetCosToDscp
     return retVal;
 }
 
-/******************************************************************************
-* Fir_gprtSetDefFpri
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTable
 *
-* Set port default priority.
+* DESCRIPTION:
+*       This API sets all entries of one port IEEE Priority Mapping table.
+*       With a QoS map shadow attached, entries whose copy holds the
+*       requested value are not written again.
 *
-******************************************************************************/
-MSD_STATUS Fir_gprtSetDefFpri
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set, see Fir_gprtSetIEEEPrioMap
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTable
 (
-    IN  MSD_QD_DEV    *dev,
-    IN  MSD_LPORT    port,
-    IN  MSD_U8  	  defque
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  FIR_PRI_TABLE_STRUCT   *entries
 )
 {
-    MSD_STATUS       retVal;         /* Functions return value.      */
-    MSD_U8           hwPort;         /* the physical port number     */
-    MSD_U8			phyAddr;
-    MSD_U16		    data;
+    MSD_STATUS     retVal;
+    MSD_U8         hwPort;
 
-    MSD_DBG_INFO(("Fir_gprtSetDefFpri Called.\n"));
+    MSD_DBG_INFO(("Fir_gprtSetIEEEPrioMapTable Called.\n"));
 
-    /* translate LPORT to hardware port */
     hwPort = MSD_LPORT_2_PORT(port);
-    phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
-    if (hwPort == MSD_INVALID_PORT)
-    {
+	if ((hwPort == MSD_INVALID_PORT) || (hwPort >= dev->numOfPorts))
+	{
         MSD_DBG_ERROR(("Bad port: %u.\n", port));
-		retVal = MSD_BAD_PARAM;
+		return MSD_BAD_PARAM;
+	}
+
+	retVal = Fir_gprtSetIEEEPrioMapTablePorts(dev, (MSD_U32)1 << port, table, entries);
+
+    MSD_DBG_INFO(("Fir_gprtSetIEEEPrioMapTable Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTablePorts
+*
+* DESCRIPTION:
+*       This API sets the same IEEE Priority Mapping table on every port in a
+*       port vector. With a QoS map shadow attached, entries whose copy holds
+*       the requested value are not written again. The writes are batched
+*       into RMU frames when RMU is enabled.
+*
+* INPUTS:
+*       portVec		- logical port vector, bit N set selects port N
+*       table		- Frame Priority Table set, see Fir_gprtSetIEEEPrioMap
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTablePorts
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_U32	portVec,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  FIR_PRI_TABLE_STRUCT   *entries
+)
+{
+    MSD_STATUS     retVal = MSD_OK;
+    MSD_U16        data[MSD_IEEE_PRIORITY_TABLE_SIZE];
+    MSD_U32        hwPortVec = 0;
+    MSD_LPORT      port;
+    MSD_U8         hwPort;
+    MSD_U8         entryPtr;
+
+    MSD_DBG_INFO(("Fir_gprtSetIEEEPrioMapTablePorts Called.\n"));
+
+	if ((portVec == 0U) || ((portVec & ~dev->validPortVec) != 0U))
+	{
+        MSD_DBG_ERROR(("Bad port vector: 0x%x.\n", portVec));
+		return MSD_BAD_PARAM;
+	}
+	if ((table < FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0) || (table > FIR_PRI_EG_AVB_FPRI_2_DSCP))
+    {
+        MSD_DBG_ERROR(("Bad table: %u.\n", table));
+        return MSD_BAD_PARAM;
     }
-	else
+	if (NULL == entries)
 	{
-		if (defque > (MSD_U8)7)
+		MSD_DBG_ERROR(("Input param entries is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (port = 0; port < dev->numOfPorts; port++)
+	{
+		if ((portVec & ((MSD_U32)1 << port)) != 0U)
 		{
-			MSD_DBG_ERROR(("Bad defFPri: %u.\n", defque));
-			retVal = MSD_BAD_PARAM;
+			hwPort = MSD_LPORT_2_PORT(port);
+			hwPortVec |= (MSD_U32)1 << hwPort;
 		}
-		else
-		{
-			data = (MSD_U16)((MSD_U16)defque & (MSD_U16)0x7);
+	}
 
-			/* Set the default frame priority.  */
-			retVal = msdSetAnyRegField(dev->devNum, phyAddr, FIR_PVID, (MSD_U8)13, (MSD_U8)3, data);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("set Fir_PVID Register return %s.\n", msdDisplayStatus(retVal)));
-			}
+	for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
+	{
+		retVal = Fir_IEEEPrioMap_Encode((MSD_U8)table, &entries[entryPtr], &data[entryPtr]);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Bad table: %u.\n", table));
+			return retVal;
 		}
 	}
 
-    MSD_DBG_INFO(("Fir_gprtSetDefFpri Exit.\n"));
-	return retVal;
+    msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_IEEEPrioMap_WriteTable(dev, hwPortVec, (MSD_U8)table, data, NULL);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_IEEEPrioMap_WriteTable returned: %s.\n", msdDisplayStatus(retVal)));
+	}
+
+    msdSemGive(dev->devNum, dev->tblRegsSem);
+
+    MSD_DBG_INFO(("Fir_gprtSetIEEEPrioMapTablePorts Exit.\n"));
+    return retVal;
 }
 
-/******************************************************************************
-* Fir_gprtGetDefFpri
+/*******************************************************************************
+* Fir_gprtGetIEEEPrioMapTable
 *
-* Get port default priority.
+* DESCRIPTION:
+*       This API gets all entries of one port IEEE Priority Mapping table.
 *
-******************************************************************************/
-MSD_STATUS Fir_gprtGetDefFpri
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set, see Fir_gprtGetIEEEPrioMap
+*
+* OUTPUTS:
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		The table is always read from the device, an attached QoS map shadow
+*		is refreshed as a side effect.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtGetIEEEPrioMapTable
 (
-    IN  MSD_QD_DEV    *dev,
-    IN  MSD_LPORT     port,
-    OUT MSD_U8  	   *defque
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  FIR_MSD_IEEE_PRIORITY_TABLE_SET		table,
+    OUT FIR_PRI_TABLE_STRUCT   *entries
 )
 {
-    MSD_STATUS       retVal;         /* Functions return value.      */
-    MSD_U8           hwPort;         /* the physical port number     */
-    MSD_U8			phyAddr;
-    MSD_U16		    data;
+    MSD_STATUS     retVal;
+    MSD_U16        data[MSD_IEEE_PRIORITY_TABLE_SIZE];
+    MSD_U8         hwPort;
+    MSD_U8         entryPtr;
+
+    MSD_DBG_INFO(("Fir_gprtGetIEEEPrioMapTable Called.\n"));
 
-    MSD_DBG_INFO(("Fir_gprtGetDefFpri Called.\n"));
-    /* translate LPORT to hardware port */
     hwPort = MSD_LPORT_2_PORT(port);
-    phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
-    if (hwPort == MSD_INVALID_PORT)
-    {
+	if ((hwPort == MSD_INVALID_PORT) || (hwPort >= dev->numOfPorts))
+	{
         MSD_DBG_ERROR(("Bad port: %u.\n", port));
-		retVal = MSD_BAD_PARAM;
+		return MSD_BAD_PARAM;
+	}
+	if ((table < FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0) || (table > FIR_PRI_EG_AVB_FPRI_2_DSCP))
+    {
+        MSD_DBG_ERROR(("Bad table: %u.\n", table));
+        return MSD_BAD_PARAM;
     }
+	if (NULL == entries)
+	{
+		MSD_DBG_ERROR(("Input param entries is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+    msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+	retVal = Fir_IEEEPrioMap_ReadTable(dev, hwPort, (MSD_U8)table, data);
+    msdSemGive(dev->devNum, dev->tblRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_IEEEPrioMap_ReadTable returned: %s.\n", msdDisplayStatus(retVal)));
+	}
 	else
 	{
-		/* Get the default frame priority.  */
-		retVal = msdGetAnyRegField(dev->devNum, phyAddr, FIR_PVID, (MSD_U8)13, (MSD_U8)3, &data);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("set Fir_PVID Register return %s.\n", msdDisplayStatus(retVal)));
-		}
-		else
+		for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
 		{
-			*defque = (MSD_U8)(data & (MSD_U16)0x7);
+			msdMemSet((void*)&entries[entryPtr], 0, sizeof(FIR_PRI_TABLE_STRUCT));
+			Fir_IEEEPrioMap_Decode((MSD_U8)table, data[entryPtr], &entries[entryPtr]);
 		}
 	}
 
-    MSD_DBG_INFO(("Fir_gprtGetDefFpri Exit.\n"));
-	return retVal;
-}
\ No newline at end of file
+    MSD_DBG_INFO(("Fir_gprtGetIEEEPrioMapTable Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gprtSetCosToQueueTable
+*
+* DESCRIPTION:
+*       Update the whole COS to egress queue mapping of a port.
+*
+* INPUTS:
+*       portNum - the logical port number
+*       queue   - MSD_IEEE_PRIORITY_TABLE_SIZE physical queues, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		Only cos entries whose queue changes are written to the device.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetCosToQueueTable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT  portNum,
+    IN  MSD_U8     *queue
+)
+{
+    MSD_STATUS       retVal;
+    MSD_U16          fieldData[MSD_IEEE_PRIORITY_TABLE_SIZE];
+    MSD_U8           cosVal;
+
+    MSD_DBG_INFO(("Fir_gprtSetCosToQueueTable Called.\n"));
+
+	if (NULL == queue)
+	{
+		MSD_DBG_ERROR(("Input param queue is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (cosVal = 0; cosVal < MSD_IEEE_PRIORITY_TABLE_SIZE; cosVal++)
+	{
+		if (queue[cosVal] >= FIR_MAX_NUM_OF_QUEUES)
+		{
+			MSD_DBG_ERROR(("Bad queue %u for cos %u.\n", queue[cosVal], cosVal));
+			return MSD_BAD_PARAM;
+		}
+		/* disIeeeQpri = 0, ieeeQpri = queue */
+		fieldData[cosVal] = (MSD_U16)((MSD_U16)queue[cosVal] << 4);
+	}
+
+	retVal = Fir_IEEEPrioMap_ModifyTable(dev, portNum, (MSD_U8)FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0, (MSD_U16)0xF0, fieldData);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("ERROR to modify IEEEPrioMap in Fir_gprtSetCosToQueueTable.\n"));
+	}
+
+    MSD_DBG_INFO(("Fir_gprtSetCosToQueueTable Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gprtSetCosToDscpTable
+*
+* DESCRIPTION:
+*       Update the whole COS to DSCP mapping of a port. This will be used for
+*       rewriting DSCP for IPv4/IPv6 packets based on the assigned cos value.
+*
+* INPUTS:
+*       portNum - the logical port number
+*       dscp    - MSD_IEEE_PRIORITY_TABLE_SIZE frame differentiated services
+*                 code points, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		Only cos entries whose dscp changes are written to the device.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetCosToDscpTable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT   portNum,
+    IN  MSD_U8      *dscp
+)
+{
+    MSD_STATUS       retVal;
+    MSD_U16          fieldData[MSD_IEEE_PRIORITY_TABLE_SIZE];
+    MSD_U8           cosVal;
+
+    MSD_DBG_INFO(("Fir_gprtSetCosToDscpTable Called.\n"));
+
+	if (NULL == dscp)
+	{
+		MSD_DBG_ERROR(("Input param dscp is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (cosVal = 0; cosVal < MSD_IEEE_PRIORITY_TABLE_SIZE; cosVal++)
+	{
+		if (dscp[cosVal] > (MSD_U8)0x3F)
+		{
+			MSD_DBG_ERROR(("Bad dscp %u for cos %u.\n", dscp[cosVal], cosVal));
+			return MSD_BAD_PARAM;
+		}
+		/* enDSCPMarking = 1, frameDSCP = dscp */
+		fieldData[cosVal] = (MSD_U16)0x40 | (MSD_U16)dscp[cosVal];
+	}
+
+	retVal = Fir_IEEEPrioMap_ModifyTable(dev, portNum, (MSD_U8)FIR_PRI_EG_GREEN_FPRI_2_DSCP, (MSD_U16)0x7F, fieldData);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("ERROR to modify IEEEPrioMap in Fir_gprtSetCosToDscpTable.\n"));
+	}
+
+    MSD_DBG_INFO(("Fir_gprtSetCosToDscpTable Exit.\n"));
+    return retVal;
+}
+
+/******************************************************************************
+* Fir_gprtSetDefFpri
+*
+* Set port default priority.
+*
+******************************************************************************/
+MSD_STATUS Fir_gprtSetDefFpri
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  MSD_LPORT    port,
+    IN  MSD_U8  	  defque
+)
+{
+    MSD_STATUS       retVal;         /* Functions return value.      */
+    MSD_U8           hwPort;         /* the physical port number     */
+    MSD_U8			phyAddr;
+    MSD_U16		    data;
+
+    MSD_DBG_INFO(("Fir_gprtSetDefFpri Called.\n"));
+
+    /* translate LPORT to hardware port */
+    hwPort = MSD_LPORT_2_PORT(port);
+    phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
+    if (hwPort == MSD_INVALID_PORT)
+    {
+        MSD_DBG_ERROR(("Bad port: %u.\n", port));
+		retVal = MSD_BAD_PARAM;
+    }
+	else
+	{
+		if (defque > (MSD_U8)7)
+		{
+			MSD_DBG_ERROR(("Bad defFPri: %u.\n", defque));
+			retVal = MSD_BAD_PARAM;
+		}
+		else
+		{
+			data = (MSD_U16)((MSD_U16)defque & (MSD_U16)0x7);
+
+			/* Set the default frame priority.  */
+			retVal = msdSetAnyRegField(dev->devNum, phyAddr, FIR_PVID, (MSD_U8)13, (MSD_U8)3, data);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("set Fir_PVID Register return %s.\n", msdDisplayStatus(retVal)));
+			}
+		}
+	}
+
+    MSD_DBG_INFO(("Fir_gprtSetDefFpri Exit.\n"));
+	return retVal;
+}
+
+/******************************************************************************
+* Fir_gprtGetDefFpri
+*
+* Get port default priority.
+*
+******************************************************************************/
+MSD_STATUS Fir_gprtGetDefFpri
+(
+    IN  MSD_QD_DEV    *dev,
+    IN  MSD_LPORT     port,
+    OUT MSD_U8  	   *defque
+)
+{
+    MSD_STATUS       retVal;         /* Functions return value.      */
+    MSD_U8           hwPort;         /* the physical port number     */
+    MSD_U8			phyAddr;
+    MSD_U16		    data;
+
+    MSD_DBG_INFO(("Fir_gprtGetDefFpri Called.\n"));
+    /* translate LPORT to hardware port */
+    hwPort = MSD_LPORT_2_PORT(port);
+    phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
+    if (hwPort == MSD_INVALID_PORT)
+    {
+        MSD_DBG_ERROR(("Bad port: %u.\n", port));
+		retVal = MSD_BAD_PARAM;
+    }
+	else
+	{
+		/* Get the default frame priority.  */
+		retVal = msdGetAnyRegField(dev->devNum, phyAddr, FIR_PVID, (MSD_U8)13, (MSD_U8)3, &data);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("set Fir_PVID Register return %s.\n", msdDisplayStatus(retVal)));
+		}
+		else
+		{
+			*defque = (MSD_U8)(data & (MSD_U16)0x7);
+		}
+	}
+
+    MSD_DBG_INFO(("Fir_gprtGetDefFpri Exit.\n"));
+	return retVal;
+}
+
+
+/****************************************************************************/
+/* Internal IEEE priority map table functions.                              */
+/****************************************************************************/
+static MSD_STATUS Fir_IEEEPrioMap_Encode
+(
+IN  MSD_U8    table,
+IN  FIR_PRI_TABLE_STRUCT *entryStruct,
+OUT MSD_U16   *data
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U16 tmpData = 0;
+
+	switch(table)
+	{
+		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0:
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei0.ieeeYellow, 8, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei0.disIeeeQpri, 7, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei0.ieeeQpri, 4, 3);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei0.disIeeeFpri, 3, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei0.ieeeFpri, 0, 3);
+			break;
+		case FIR_PRI_EG_GREEN_FPRI_2_PCP:
+			MSD_BF_SET(tmpData,entryStruct->egGreeTblPcp.disVIDMarking, 4, 1);
+			MSD_BF_SET(tmpData,entryStruct->egGreeTblPcp.disPCPMarking, 3, 1);
+			MSD_BF_SET(tmpData,entryStruct->egGreeTblPcp.framePCP, 0, 3);
+			break;
+		case FIR_PRI_EG_YEL_FPRI_2_PCP:
+			MSD_BF_SET(tmpData,entryStruct->egYelTblPcp.disVIDMarking, 4, 1);
+			MSD_BF_SET(tmpData,entryStruct->egYelTblPcp.disPCPMarking, 3, 1);
+			MSD_BF_SET(tmpData,entryStruct->egYelTblPcp.framePCP, 0, 3);
+			break;
+		case FIR_PRI_EG_AVB_FPRI_2_PCP:
+			MSD_BF_SET(tmpData,entryStruct->egAvbTblPcp.disVIDMarking, 4, 1);
+			MSD_BF_SET(tmpData,entryStruct->egAvbTblPcp.disPCPMarking, 3, 1);
+			MSD_BF_SET(tmpData,entryStruct->egAvbTblPcp.framePCP, 0, 3);
+			break;
+		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_1:
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei1.ieeeYellow, 8, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei1.disIeeeQpri, 7, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei1.ieeeQpri, 4, 3);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei1.disIeeeFpri, 3, 1);
+			MSD_BF_SET(tmpData, entryStruct->ingTblDei1.ieeeFpri, 0, 3);
+			break;
+		case FIR_PRI_EG_GREEN_FPRI_2_DSCP:
+			MSD_BF_SET(tmpData,entryStruct->egGreeTblDscp.enDSCPMarking, 6, 1);
+			MSD_BF_SET(tmpData,entryStruct->egGreeTblDscp.frameDSCP, 0, 6);
+			break;
+		case FIR_PRI_EG_YEL_FPRI_2_DSCP:
+			MSD_BF_SET(tmpData,entryStruct->egYelTblDscp.enDSCPMarking, 6, 1);
+			MSD_BF_SET(tmpData,entryStruct->egYelTblDscp.frameDSCP, 0, 6);
+			break;
+		case FIR_PRI_EG_AVB_FPRI_2_DSCP:
+			MSD_BF_SET(tmpData,entryStruct->egAvbTbldscp.enDSCPMarking, 6, 1);
+			MSD_BF_SET(tmpData,entryStruct->egAvbTbldscp.frameDSCP, 0, 6);
+			break;
+		default:
+			retVal = MSD_BAD_PARAM;
+			break;
+	}
+
+	*data = tmpData;
+	return retVal;
+}
+
+static void Fir_IEEEPrioMap_Decode
+(
+IN  MSD_U8    table,
+IN  MSD_U16   data,
+OUT FIR_PRI_TABLE_STRUCT *entryStruct
+)
+{
+	switch(table)
+	{
+		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_0:
+			entryStruct->ingTblDei0.ieeeYellow = (MSD_U8)(MSD_BF_GET(data, 8, 1));
+			entryStruct->ingTblDei0.disIeeeQpri = (MSD_U8)(MSD_BF_GET(data, 7, 1));
+			entryStruct->ingTblDei0.ieeeQpri = (MSD_U8)(MSD_BF_GET(data, 4, 3));
+			entryStruct->ingTblDei0.disIeeeFpri = (MSD_U8)(MSD_BF_GET(data, 3, 1));
+			entryStruct->ingTblDei0.ieeeFpri = (MSD_U8)(MSD_BF_GET(data, 0, 3));
+			break;
+		case FIR_PRI_EG_GREEN_FPRI_2_PCP:
+			entryStruct->egGreeTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
+			entryStruct->egGreeTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
+			entryStruct->egGreeTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
+			break;
+		case FIR_PRI_EG_YEL_FPRI_2_PCP:
+			entryStruct->egYelTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
+			entryStruct->egYelTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
+			entryStruct->egYelTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
+			break;
+		case FIR_PRI_EG_AVB_FPRI_2_PCP:
+			entryStruct->egAvbTblPcp.disVIDMarking = (MSD_U8)(MSD_BF_GET(data,4,1));
+			entryStruct->egAvbTblPcp.disPCPMarking = (MSD_U8)(MSD_BF_GET(data,3,1));
+			entryStruct->egAvbTblPcp.framePCP = (MSD_U8)(MSD_BF_GET(data,0,3));
+			break;
+		case FIR_PRI_ING_PCP_2_F_Q_PRI_DEI_1:
+			entryStruct->ingTblDei1.ieeeYellow = (MSD_U8)(MSD_BF_GET(data, 8, 1));
+			entryStruct->ingTblDei1.disIeeeQpri = (MSD_U8)(MSD_BF_GET(data, 7, 1));
+			entryStruct->ingTblDei1.ieeeQpri = (MSD_U8)(MSD_BF_GET(data, 4, 3));
+			entryStruct->ingTblDei1.disIeeeFpri = (MSD_U8)(MSD_BF_GET(data, 3, 1));
+			entryStruct->ingTblDei1.ieeeFpri = (MSD_U8)(MSD_BF_GET(data, 0, 3));
+			break;
+		case FIR_PRI_EG_GREEN_FPRI_2_DSCP:
+			entryStruct->egGreeTblDscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
+			entryStruct->egGreeTblDscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
+			break;
+		case FIR_PRI_EG_YEL_FPRI_2_DSCP:
+			entryStruct->egYelTblDscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
+			entryStruct->egYelTblDscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
+			break;
+		case FIR_PRI_EG_AVB_FPRI_2_DSCP:
+			entryStruct->egAvbTbldscp.enDSCPMarking = (MSD_U8)(MSD_BF_GET(data,6,1));
+			entryStruct->egAvbTbldscp.frameDSCP = (MSD_U8)(MSD_BF_GET(data,0,6));
+			break;
+		default:
+			break;
+	}
+}
+
+static void Fir_IEEEPrioMap_ShadowSet
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    hwPort,
+IN  MSD_U8    table,
+IN  MSD_U8    entryPtr,
+IN  MSD_U16   data
+)
+{
+	table &= (MSD_U8)0x7;
+	entryPtr &= (MSD_U8)0x7;
+	if ((dev->qosMapShadow != NULL) && (hwPort < MSD_MAX_SWITCH_PORTS))
+	{
+		dev->qosMapShadow->entry[hwPort][table][entryPtr] = data & FIR_PRI_MAP_DATA_MASK;
+		dev->qosMapShadow->valid[hwPort][table] |= (MSD_U8)((MSD_U8)1 << entryPtr);
+	}
+}
+
+static MSD_STATUS Fir_IEEEPrioMap_WaitReady
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    phyAddr
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 data;
+	MSD_U16 count = (MSD_U16)0x10;
+
+	do
+	{
+		retVal = msdGetAnyRegField(dev->devNum, phyAddr, FIR_IEEE_PRI_MAPPING_TBL, (MSD_U8)15, (MSD_U8)1, &data);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("read FIR_IEEE_PRI_MAPPING_TBL Register return %s.\n", msdDisplayStatus(retVal)));
+			return retVal;
+		}
+		if (count == (MSD_U16)0)
+		{
+			MSD_DBG_ERROR(("Failed(table always busy).\n"));
+			return MSD_FAIL;
+		}
+		count -= 1U;
+	} while (data == (MSD_U16)1);
+
+	return MSD_OK;
+}
+
+/* Read a complete table into data[] and the driver copy, with tblRegsSem held */
+static MSD_STATUS Fir_IEEEPrioMap_ReadTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U8    hwPort,
+IN  MSD_U8    table,
+OUT MSD_U16   *data
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[3U * MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_RegCmd *pRegCmd = &(regCmdList[0]);
+	MSD_U32 nCmd = 0;
+	MSD_U8 phyAddr;
+	MSD_U8 entryPtr;
+
+	phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
+		{
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = phyAddr;
+			regCmdList[nCmd].regAddr = FIR_IEEE_PRI_MAPPING_TBL;
+			regCmdList[nCmd].data = 15;
+			nCmd++;
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+			regCmdList[nCmd].devAddr = phyAddr;
+			regCmdList[nCmd].regAddr = FIR_IEEE_PRI_MAPPING_TBL;
+			regCmdList[nCmd].data = FIR_PRI_MAP_PTR(table, entryPtr);
+			nCmd++;
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_READ;
+			regCmdList[nCmd].devAddr = phyAddr;
+			regCmdList[nCmd].regAddr = FIR_IEEE_PRI_MAPPING_TBL;
+			regCmdList[nCmd].data = 0;
+			nCmd++;
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal == MSD_OK)
+		{
+			for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
+			{
+				data[entryPtr] = regCmdList[(3U * entryPtr) + 2U].data & FIR_PRI_MAP_DATA_MASK;
+			}
+		}
+	}
+	else
+	{
+		for (entryPtr = 0; (retVal == MSD_OK) && (entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE); entryPtr++)
+		{
+			retVal = Fir_IEEEPrioMap_WaitReady(dev, phyAddr);
+			if (retVal == MSD_OK)
+			{
+				retVal = msdSetAnyReg(dev->devNum, phyAddr, FIR_IEEE_PRI_MAPPING_TBL, FIR_PRI_MAP_PTR(table, entryPtr));
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = msdGetAnyReg(dev->devNum, phyAddr, FIR_IEEE_PRI_MAPPING_TBL, &data[entryPtr]);
+				data[entryPtr] &= FIR_PRI_MAP_DATA_MASK;
+			}
+		}
+	}
+
+	if (retVal == MSD_OK)
+	{
+		for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
+		{
+			Fir_IEEEPrioMap_ShadowSet(dev, hwPort, table, entryPtr, data[entryPtr]);
+		}
+	}
+
+	return retVal;
+}
+
+/* Send the queued RMU commands and record the written entries in the driver copy */
+static MSD_STATUS Fir_IEEEPrioMap_RmuFlush
+(
+IN  MSD_QD_DEV *dev,
+INOUT MSD_RegCmd *regCmdList,
+IN  MSD_U32   nCmd
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd *pRegCmd = regCmdList;
+	MSD_U16 written[MSD_RMU_MAX_REGCMDS];
+	MSD_U32 i;
+
+	/* the response data overwrites the command list, keep the written values */
+	for (i = 0; i < nCmd; i++)
+	{
+		written[i] = regCmdList[i].data;
+	}
+
+	retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+	if (retVal == MSD_OK)
+	{
+		for (i = 0; i < nCmd; i++)
+		{
+			if ((regCmdList[i].isWaitOnBit == MSD_RMU_WAIT_ON_BIT_FALSE) && (regCmdList[i].opCode == MSD_RMU_REQ_OPCODE_WRITE))
+			{
+				Fir_IEEEPrioMap_ShadowSet(dev, (MSD_U8)(regCmdList[i].devAddr - dev->baseRegAddr),
+					(MSD_U8)((written[i] >> 12) & 0x7U), (MSD_U8)((written[i] >> 9) & 0x7U), written[i]);
+			}
+		}
+	}
+
+	return retVal;
+}
+
+/* Write a complete table to every port of hwPortVec, with tblRegsSem held.
+ * Entries are skipped if they match current, the values just read from the
+ * device, or else the attached driver copy. With neither every entry is written. */
+static MSD_STATUS Fir_IEEEPrioMap_WriteTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U32   hwPortVec,
+IN  MSD_U8    table,
+IN  MSD_U16   *data,
+IN  MSD_U16   *current
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+	MSD_U32 nCmd = 0;
+	MSD_U8 hwPort;
+	MSD_U8 phyAddr;
+	MSD_U8 entryPtr;
+	MSD_U16 regData;
+	MSD_BOOL useRmu;
+
+	useRmu = IS_RMU_SUPPORTED(dev) ? MSD_TRUE : MSD_FALSE;
+
+	for (hwPort = 0; (retVal == MSD_OK) && (hwPort < MSD_MAX_SWITCH_PORTS); hwPort++)
+	{
+		if ((hwPortVec & ((MSD_U32)1 << hwPort)) == 0U)
+		{
+			continue;
+		}
+		phyAddr = FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort);
+
+		for (entryPtr = 0; (retVal == MSD_OK) && (entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE); entryPtr++)
+		{
+			if (current != NULL)
+			{
+				if (current[entryPtr] == data[entryPtr])
+				{
+					continue;
+				}
+			}
+			else if ((dev->qosMapShadow != NULL) &&
+				((dev->qosMapShadow->valid[hwPort][table] & ((MSD_U8)1 << entryPtr)) != 0U) &&
+				(dev->qosMapShadow->entry[hwPort][table][entryPtr] == data[entryPtr]))
+			{
+				continue;
+			}
+
+			regData = FIR_PRI_MAP_UPDATE | FIR_PRI_MAP_PTR(table, entryPtr) | data[entryPtr];
+
+			if (useRmu == MSD_TRUE)
+			{
+				if ((nCmd + 2U) > MSD_RMU_MAX_REGCMDS)
+				{
+					retVal = Fir_IEEEPrioMap_RmuFlush(dev, regCmdList, nCmd);
+					nCmd = 0;
+				}
+				regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+				regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+				regCmdList[nCmd].devAddr = phyAddr;
+				regCmdList[nCmd].regAddr = FIR_IEEE_PRI_MAPPING_TBL;
+				regCmdList[nCmd].data = 15;
+				nCmd++;
+				regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+				regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+				regCmdList[nCmd].devAddr = phyAddr;
+				regCmdList[nCmd].regAddr = FIR_IEEE_PRI_MAPPING_TBL;
+				regCmdList[nCmd].data = regData;
+				nCmd++;
+			}
+			else
+			{
+				retVal = Fir_IEEEPrioMap_WaitReady(dev, phyAddr);
+				if (retVal == MSD_OK)
+				{
+					retVal = msdSetAnyReg(dev->devNum, phyAddr, FIR_IEEE_PRI_MAPPING_TBL, regData);
+				}
+				if (retVal == MSD_OK)
+				{
+					Fir_IEEEPrioMap_ShadowSet(dev, hwPort, table, entryPtr, regData);
+				}
+			}
+		}
+	}
+
+	if ((retVal == MSD_OK) && (nCmd != 0U))
+	{
+		retVal = Fir_IEEEPrioMap_RmuFlush(dev, regCmdList, nCmd);
+	}
+
+	if ((retVal != MSD_OK) && (dev->qosMapShadow != NULL))
+	{
+		/* the device state is unknown after a failed write, drop the driver copy */
+		for (hwPort = 0; hwPort < MSD_MAX_SWITCH_PORTS; hwPort++)
+		{
+			if ((hwPortVec & ((MSD_U32)1 << hwPort)) != 0U)
+			{
+				dev->qosMapShadow->valid[hwPort][table] = 0;
+			}
+		}
+	}
+
+	return retVal;
+}
+
+/* Replace the fieldMask bits of every entry of one port table */
+static MSD_STATUS Fir_IEEEPrioMap_ModifyTable
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_LPORT  port,
+IN  MSD_U8    table,
+IN  MSD_U16   fieldMask,
+IN  MSD_U16   *fieldData
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U16 current[MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_U16 data[MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_U8 hwPort;
+	MSD_U8 entryPtr;
+
+	hwPort = MSD_LPORT_2_PORT(port);
+	if ((hwPort == MSD_INVALID_PORT) || (hwPort >= dev->numOfPorts))
+	{
+		MSD_DBG_ERROR(("Bad port: %u.\n", port));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	/* read from the device, other writers do not update the driver copy */
+	retVal = Fir_IEEEPrioMap_ReadTable(dev, hwPort, table, current);
+
+	if (retVal == MSD_OK)
+	{
+		for (entryPtr = 0; entryPtr < MSD_IEEE_PRIORITY_TABLE_SIZE; entryPtr++)
+		{
+			data[entryPtr] = (MSD_U16)((current[entryPtr] & (MSD_U16)~fieldMask) | (fieldData[entryPtr] & fieldMask));
+		}
+		retVal = Fir_IEEEPrioMap_WriteTable(dev, (MSD_U32)1 << hwPort, table, data, current);
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+
+	return retVal;
+}
@@ -377,3 +377,167 @@ MSD_STATUS Fir_gprtGetIEEEPrioMapIntf
 
 	return retVal;
 }
+
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTableIntf
+*
+* DESCRIPTION:
+*       This API sets all entries of one port IEEE Priority Mapping table.
+*
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTableIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+)
+{
+	FIR_PRI_TABLE_STRUCT entry[MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_U8 i;
+
+	if (NULL == entries)
+	{
+		MSD_DBG_ERROR(("Input param MSD_IEEE_PRIORITY_TABLE_STRUCT in Fir_gprtSetIEEEPrioMapTableIntf is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < MSD_IEEE_PRIORITY_TABLE_SIZE; i++)
+	{
+		entry[i].ingTblDei0.disIeeeFpri = entries[i].ingTbl.disIeeeFpri;
+		entry[i].ingTblDei0.disIeeeQpri = entries[i].ingTbl.disIeeeQpri;
+		entry[i].ingTblDei0.ieeeFpri = entries[i].ingTbl.ieeeFpri;
+		entry[i].ingTblDei0.ieeeQpri = entries[i].ingTbl.ieeeQpri;
+		entry[i].ingTblDei0.ieeeYellow = entries[i].ingTbl.ieeeYellow;
+	}
+
+	return Fir_gprtSetIEEEPrioMapTable(dev, port, (FIR_MSD_IEEE_PRIORITY_TABLE_SET)table, entry);
+}
+
+/*******************************************************************************
+* Fir_gprtSetIEEEPrioMapTablePortsIntf
+*
+* DESCRIPTION:
+*       This API sets the same IEEE Priority Mapping table on every port in a
+*       port vector.
+*
+* INPUTS:
+*       portVec		- logical port vector, bit N set selects port N
+*       table		- Frame Priority Table set
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtSetIEEEPrioMapTablePortsIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_U32	portVec,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+)
+{
+	FIR_PRI_TABLE_STRUCT entry[MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_U8 i;
+
+	if (NULL == entries)
+	{
+		MSD_DBG_ERROR(("Input param MSD_IEEE_PRIORITY_TABLE_STRUCT in Fir_gprtSetIEEEPrioMapTablePortsIntf is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < MSD_IEEE_PRIORITY_TABLE_SIZE; i++)
+	{
+		entry[i].ingTblDei0.disIeeeFpri = entries[i].ingTbl.disIeeeFpri;
+		entry[i].ingTblDei0.disIeeeQpri = entries[i].ingTbl.disIeeeQpri;
+		entry[i].ingTblDei0.ieeeFpri = entries[i].ingTbl.ieeeFpri;
+		entry[i].ingTblDei0.ieeeQpri = entries[i].ingTbl.ieeeQpri;
+		entry[i].ingTblDei0.ieeeYellow = entries[i].ingTbl.ieeeYellow;
+	}
+
+	return Fir_gprtSetIEEEPrioMapTablePorts(dev, portVec, (FIR_MSD_IEEE_PRIORITY_TABLE_SET)table, entry);
+}
+
+/*******************************************************************************
+* Fir_gprtGetIEEEPrioMapTableIntf
+*
+* DESCRIPTION:
+*       This API gets all entries of one port IEEE Priority Mapping table.
+*
+* INPUTS:
+*       port		- the logical port number
+*       table		- Frame Priority Table set
+*
+* OUTPUTS:
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gprtGetIEEEPrioMapTableIntf
+(
+    IN  MSD_QD_DEV	*dev,
+    IN  MSD_LPORT	port,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET		table,
+    OUT MSD_IEEE_PRIORITY_TABLE_STRUCT   *entries
+)
+{
+	FIR_PRI_TABLE_STRUCT entry[MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_STATUS    retVal;
+	MSD_U8 i;
+
+	if (NULL == entries)
+	{
+		MSD_DBG_ERROR(("Input param MSD_IEEE_PRIORITY_TABLE_STRUCT in Fir_gprtGetIEEEPrioMapTableIntf is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+
+	retVal = Fir_gprtGetIEEEPrioMapTable(dev, port, (FIR_MSD_IEEE_PRIORITY_TABLE_SET)table, entry);
+	if (MSD_OK != retVal)
+	{
+		return retVal;
+	}
+
+	for (i = 0; i < MSD_IEEE_PRIORITY_TABLE_SIZE; i++)
+	{
+		msdMemSet((void*)&entries[i], 0, sizeof(MSD_IEEE_PRIORITY_TABLE_STRUCT));
+		entries[i].ingTbl.disIeeeFpri = entry[i].ingTblDei0.disIeeeFpri;
+		entries[i].ingTbl.disIeeeQpri = entry[i].ingTblDei0.disIeeeQpri;
+		entries[i].ingTbl.ieeeFpri = entry[i].ingTblDei0.ieeeFpri;
+		entries[i].ingTbl.ieeeQpri = entry[i].ingTblDei0.ieeeQpri;
+		entries[i].ingTbl.ieeeYellow = entry[i].ingTblDei0.ieeeYellow;
+	}
+
+	return retVal;
+}
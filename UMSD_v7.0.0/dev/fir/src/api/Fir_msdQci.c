@@ -24,6 +24,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 
 /**********************************************************************************************
@@ -31,6 +32,11 @@
 * Below is internal basic read/write functions
 *
 **********************************************************************************************/
+/* RMU commands per gate control entry: wait, data and command for 4 registers */
+#define FIR_QCI_RMU_ENTRY_CMDS	12U
+/* RMU commands per stream filter counter read: wait, command, wait, data for 4 registers */
+#define FIR_QCI_RMU_COUNTER_CMDS	16U
+
 typedef enum
 {
 	STREAM_FILTER = 0,
@@ -71,6 +77,12 @@ IN  MSD_U8        regAddr,
 OUT MSD_U16       *dataVal
 );
 
+static MSD_STATUS Fir_taiGlobalTimeRead
+(
+IN  MSD_QD_DEV    *dev,
+OUT MSD_U32       *globalTime
+);
+
 static MSD_STATUS Fir_waitQciBusyBitClear
 (
 IN  MSD_QD_DEV    *dev,
@@ -100,6 +112,12 @@ IN  MSD_U8        op,
 IN  MSD_U8        streamFilterId
 );
 
+static MSD_STATUS Fir_streamFilterCountersRead
+(
+IN  MSD_QD_DEV    *dev,
+OUT MSD_U16       *counter
+);
+
 /* stream gate basic read/write*/
 static MSD_STATUS Fir_streamGateBasicWrite
 (
@@ -128,6 +146,18 @@ IN  MSD_QD_DEV    *dev,
 IN  MSD_U8        pointer
 );
 
+static MSD_STATUS Fir_streamGateEntryWait
+(
+IN  MSD_QD_DEV    *dev
+);
+
+static MSD_STATUS Fir_streamGateEntryLoad
+(
+IN  MSD_QD_DEV    *dev,
+IN  MSD_U8        pointer,
+IN  const MSD_U16 *entryRegs
+);
+
 /* stream gate time generation related*/
 static MSD_STATUS Fir_streamGateTimeGenBasicWrite
 (
@@ -142,6 +172,14 @@ IN  MSD_QD_DEV    *dev,
 IN  MSD_U8        streamGateTimeGenId
 );
 
+static MSD_STATUS Fir_streamGateTimeGenLoad
+(
+IN  MSD_QD_DEV    *dev,
+IN  MSD_U8        streamGateGenId,
+IN  MSD_U32       gateCycleTime,
+IN  MSD_U64       gateBaseTime
+);
+
 /* flow meter related */
 static MSD_STATUS Fir_flowMeterBasicWrite
 (
@@ -903,6 +941,89 @@ MSD_STATUS Fir_gqciFlowMeterFiltCtrGet
 }
 
 
+/******************************************************************************
+* Fir_gqciCountersGetBulk
+*
+* DESCRIPTION:
+*        This routine reads the four PSFP counters of a set of stream filters
+*        in one locked pass, together with the PTP global time.
+*
+* INPUTS:
+*        filterVec - vector of the stream filter instances to read
+*
+* OUTPUTS:
+*        counters  - timestamp and counters of every stream filter in filterVec
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersGetBulk
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U32	filterVec,
+OUT MSD_PSFP_COUNTERS *counters
+)
+{
+	MSD_STATUS retVal;
+	MSD_U8 id;
+
+	MSD_DBG_INFO(("Fir_gqciCountersGetBulk Called.\n"));
+
+	if (counters == NULL)
+	{
+		MSD_DBG_ERROR(("Input param counters is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+	if ((filterVec >> MSD_PSFP_MAX_STREAM_FILTER) != 0U)
+	{
+		MSD_DBG_ERROR(("Bad stream filter vector 0x%x.\n", (unsigned int)filterVec));
+		return MSD_BAD_PARAM;
+	}
+
+	msdMemSet((void*)counters, 0, sizeof(MSD_PSFP_COUNTERS));
+
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_taiGlobalTimeRead(dev, &counters->timestamp);
+
+	for (id = 0; (retVal == MSD_OK) && (id < MSD_PSFP_MAX_STREAM_FILTER); id++)
+	{
+		if ((filterVec & ((MSD_U32)1 << id)) == 0U)
+		{
+			continue;
+		}
+
+		/* one read operation latches all counters of the stream filter, offset 4 to 7 */
+		retVal = Fir_streamFilterOperation(dev, (MSD_U8)READ, id);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_streamFilterCountersRead(dev, counters->counter[id]);
+		}
+		if (retVal == MSD_OK)
+		{
+			counters->filterVec |= (MSD_U32)1 << id;
+		}
+	}
+
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Stream filter counter read returned: %s.\n", msdDisplayStatus(retVal)));
+	}
+
+	MSD_DBG_INFO(("Fir_gqciCountersGetBulk Exit.\n"));
+	return retVal;
+}
+
+
 /******************************************************************************
 * Fir_gqciStreamGateFlushAll
 *
@@ -939,6 +1060,10 @@ IN  MSD_QD_DEV     *dev
 
 	/* access stream gate offset 0 */
 	op = (MSD_U8)FLUSH_ALL;
+	if (dev->qciGateShadow != NULL)
+	{
+		dev->qciGateShadow->gateVec = 0;
+	}
 	retVal = Fir_streamGateOperation(dev, op, 0);
 	if (retVal != MSD_OK)
 	{
@@ -1172,6 +1297,10 @@ IN  MSD_U8	streamGateTimeGenId
 	MSD_DBG_INFO(("Fir_gqciStreamGateDefStateSet Called.\n"));
 
 	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+	if (dev->qciGateShadow != NULL)
+	{
+		dev->qciGateShadow->gateVec &= ~((MSD_U32)1 << (streamGateId & 0xFU));
+	}
 
 	/* access stream gate offset 0 */
 	op = (MSD_U8)READ;
@@ -1260,6 +1389,10 @@ IN  FIR_MSD_STREAM_GATE_ENTRY *streamGateEntry
 	MSD_DBG_INFO(("Fir_gqciStreamGateEntryAdd Called.\n"));
 
 	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+	if (dev->qciGateShadow != NULL)
+	{
+		dev->qciGateShadow->gateVec &= ~((MSD_U32)1 << (streamGateId & 0xFU));
+	}
 
 	/* access stream gate offset 0 */
 	regAdr = 0U;
@@ -1412,6 +1545,10 @@ IN  MSD_QD_DEV     *dev
 	MSD_DBG_INFO(("Fir_gqciStreamGateTimeGenFlush Called.\n"));
 
 	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+	if (dev->qciGateShadow != NULL)
+	{
+		dev->qciGateShadow->timeGenVec = 0;
+	}
 
 	/* access stream gate time gen offset 0 */
 	for (i = 0; i < 4U; i++)
@@ -1475,121 +1612,264 @@ IN  MSD_U64 gateBaseTime
 )
 {
 	MSD_STATUS retVal;
-	MSD_U16 dataVal;
-	MSD_U8 tmpRegAddr;
-	MSD_U8 trigSel;
-	MSD_U32 cycleTime;
 
 	MSD_DBG_INFO(("Fir_gqciStreamGateTimeGenSet Called.\n"));
 
 	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
-
-	/* get TrigGenTimeSel (see TAI offset 0x12) */
-	tmpRegAddr = (MSD_U8)0x12;
-	retVal = Fir_taiBasicRead(dev, tmpRegAddr, &dataVal);
-	if (retVal != MSD_OK)
+	if (dev->qciGateShadow != NULL)
 	{
-		MSD_DBG_ERROR(("Fir_taiBasicRead returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		dev->qciGateShadow->timeGenVec &= ~((MSD_U32)1 << (streamGateGenId & 0x3U));
 	}
 
-	/* check trigSel using PTP Global Timer, PTP ToD, PTP 1722 Nano */
-	trigSel = (MSD_U8)((dataVal & (MSD_U16)0x60) >> 5);
-	if (trigSel == 0U)
-	{
-		/* the unit of this interval is as same as PTP Global Timer */
-		cycleTime = gateCycleTime / 4U;
-	}
-	else if ((trigSel == 1U) || (trigSel == 2U))
+	retVal = Fir_streamGateTimeGenLoad(dev, streamGateGenId, gateCycleTime, gateBaseTime);
+
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+	MSD_DBG_INFO(("Fir_gqciStreamGateTimeGenSet Exit.\n"));
+	return retVal;
+}
+
+
+/******************************************************************************
+* Fir_gqciStreamGateScheduleSet
+*
+* DESCRIPTION:
+*        This routine programs the complete schedule of a stream gate instance
+*        in one transaction: gate control entries, time generation identifier
+*        and time generation cycle and base time. With a stream gate shadow
+*        attached only the parts that differ from what this routine wrote
+*        last are programmed, else everything is programmed.
+*
+* INPUTS:
+*        streamGateId - stream gate instance identifier
+*        schedule     - stream gate schedule
+*
+* OUTPUTS:
+*        checksum  - CRC-16 of the schedule as programmed, may be NULL
+*        numWrites - number of gate control entries, gate settings and time
+*                    generation instances written, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The time generation instance is written last, so the new gate control
+*        list starts at the new base time. The checksum is computed from the
+*        schedule as written, not read back from the device.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciStreamGateScheduleSet
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8  streamGateId,
+IN  MSD_STREAM_GATE_SCHEDULE *schedule,
+OUT MSD_U16 *checksum,
+OUT MSD_U32 *numWrites
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_QCI_GATE_SHADOW *shadow;
+	MSD_STREAM_GATE_ENTRY *entry;
+	MSD_U16 entryRegs[MSD_STREAM_GATE_MAX_ENTRIES][3];
+	MSD_U16 crcData[6];
+	MSD_U16 tempData;
+	MSD_U16 crc;
+	MSD_U32 writeVec = 0;
+	MSD_U32 bit;
+	MSD_U32 count = 0;
+	MSD_U8 timeGenId;
+	MSD_U8 i, j;
+
+	MSD_DBG_INFO(("Fir_gqciStreamGateScheduleSet Called.\n"));
+
+	if (schedule == NULL)
 	{
-		/* the unit of this interval is nanoseconds */
-		cycleTime = gateCycleTime;
+		MSD_DBG_ERROR(("Input param is NULL.\n"));
+		return MSD_BAD_PARAM;
 	}
-	else
+	if ((streamGateId >= MSD_STREAM_GATE_MAX_ID) || (schedule->timeGenId >= MSD_STREAM_GATE_MAX_TIME_GEN) ||
+		(schedule->numEntries == 0U) || (schedule->numEntries > MSD_STREAM_GATE_MAX_ENTRIES) ||
+		((schedule->baseTime >> 40) != 0U))
 	{
-		MSD_DBG_ERROR(("TrigGenTimeSel is reseved, please check.\n"));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
+		MSD_DBG_ERROR(("Bad stream gate schedule.\n"));
 		return MSD_BAD_PARAM;
 	}
 
-	/* write gate cycle time low 16 bits*/
-	tmpRegAddr = 2U;
-	dataVal = (MSD_U16)(cycleTime & (MSD_U32)0xFFFF);
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	/* encode gate control entries, stream gate offset 5, 6 and 7 */
+	msdMemSet((void*)entryRegs, 0, sizeof(entryRegs));
+	for (i = 0; i < schedule->numEntries; i++)
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		entry = &schedule->entry[i];
+		if ((entry->gateState > 1U) || (entry->gateIPVEn > 1U) || (entry->gateIPV > 7U))
+		{
+			MSD_DBG_ERROR(("Bad stream gate entry %d.\n", (int)i));
+			return MSD_BAD_PARAM;
+		}
+		entryRegs[i][0] = (MSD_U16)((MSD_U16)((MSD_U16)entry->gateState << 4) |
+			(MSD_U16)((MSD_U16)entry->gateIPVEn << 3) | (MSD_U16)entry->gateIPV);
+		entryRegs[i][1] = entry->gateWindowTime;
+		entryRegs[i][2] = entry->gateAllowedBytes;
 	}
 
-	/* write gate cycle time high 8 bits*/
-	tmpRegAddr = 3U;
-	dataVal = (MSD_U16)((cycleTime >> 16) & (MSD_U32)0xFF);
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	bit = (MSD_U32)1 << streamGateId;
+	timeGenId = schedule->timeGenId;
+
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+
+	/* without a shadow every entry and setting is written */
+	shadow = dev->qciGateShadow;
+	for (i = 0; i < MSD_STREAM_GATE_MAX_ENTRIES; i++)
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		if ((shadow == NULL) || ((shadow->gateVec & bit) == 0U) ||
+			(msdMemCmp((void*)shadow->entry[streamGateId][i], (void*)entryRegs[i], sizeof(entryRegs[i])) != 0))
+		{
+			writeVec |= (MSD_U32)1 << i;
+		}
 	}
-
-	/* write gate base time low 16 bits*/
-	tmpRegAddr = 4U;
-	dataVal = (MSD_U16)(gateBaseTime & (MSD_U32)0xFFFF);
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	if ((shadow == NULL) || ((shadow->gateVec & bit) == 0U) || (shadow->timeGenId[streamGateId] != timeGenId))
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		writeVec |= (MSD_U32)1 << MSD_STREAM_GATE_MAX_ENTRIES;
+	}
+	if (shadow != NULL)
+	{
+		shadow->gateVec &= ~bit;
 	}
 
-	/* write gate base time middle 16 bits*/
-	tmpRegAddr = 5U;
-	dataVal = (MSD_U16)((gateBaseTime >> 16) & (MSD_U32)0xFFFF);
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	if ((writeVec & (((MSD_U32)1 << MSD_STREAM_GATE_MAX_ENTRIES) - 1U)) != 0U)
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		/* select the stream gate the entries belong to, stream gate offset 0 */
+		retVal = Fir_streamGateBasicRead(dev, 0, &tempData);
+		if (retVal == MSD_OK)
+		{
+			tempData = (tempData & (MSD_U16)0xFFF0) | (MSD_U16)((MSD_U16)streamGateId & (MSD_U16)0xF);
+			retVal = Fir_streamGateBasicWrite(dev, 0, tempData);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_streamGateEntryWait(dev);
+		}
+
+		for (i = 0; (retVal == MSD_OK) && (i < MSD_STREAM_GATE_MAX_ENTRIES); i++)
+		{
+			if ((writeVec & ((MSD_U32)1 << i)) == 0U)
+			{
+				continue;
+			}
+			retVal = Fir_streamGateEntryLoad(dev, i, entryRegs[i]);
+			if (retVal == MSD_OK)
+			{
+				if (shadow != NULL)
+				{
+					msdMemCpy((void*)shadow->entry[streamGateId][i], (void*)entryRegs[i], sizeof(entryRegs[i]));
+				}
+				count++;
+			}
+		}
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Stream gate entry write returned: %s.\n", msdDisplayStatus(retVal)));
+		}
 	}
 
-	/* write gate base time high 8 bits*/
-	tmpRegAddr = 6U;
-	dataVal = (MSD_U16)((gateBaseTime >> 32) & (MSD_U32)0xFF);
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	/* enable the gate control list and bind the time generation instance, stream gate offset 2 */
+	if ((retVal == MSD_OK) && (writeVec != 0U))
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		retVal = Fir_streamGateOperation(dev, (MSD_U8)READ, streamGateId);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_streamGateBasicRead(dev, 2U, &tempData);
+		}
+		if (retVal == MSD_OK)
+		{
+			tempData = (tempData & (MSD_U16)0x7FFC) | (MSD_U16)0x8000 | (MSD_U16)timeGenId;
+			retVal = Fir_streamGateBasicWrite(dev, 2U, tempData);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_streamGateOperation(dev, (MSD_U8)LOAD, streamGateId);
+		}
+		if (retVal == MSD_OK)
+		{
+			if (shadow != NULL)
+			{
+				shadow->timeGenId[streamGateId] = timeGenId;
+			}
+			count++;
+		}
+		else
+		{
+			MSD_DBG_ERROR(("Stream gate load returned: %s.\n", msdDisplayStatus(retVal)));
+		}
 	}
 
-	/* write gate time generation enable */
-	tmpRegAddr = 1U;
-	dataVal = 1U;
-	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
-	if (retVal != MSD_OK)
+	if ((retVal == MSD_OK) && (shadow == NULL))
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		/* activate through the time generation instance */
+		retVal = Fir_streamGateTimeGenLoad(dev, timeGenId, schedule->cycleTime, schedule->baseTime);
+		if (retVal == MSD_OK)
+		{
+			count++;
+		}
 	}
+	else if (retVal == MSD_OK)
+	{
+		shadow->gateVec |= bit;
 
-	/* write gate time generation instance to corresponding Id */
-	retVal = Fir_streamGateTimeGenOpWrite(dev, streamGateGenId);
-	if (retVal != MSD_OK)
+		/* activate through the time generation instance */
+		if (((shadow->timeGenVec & ((MSD_U32)1 << timeGenId)) == 0U) ||
+			(shadow->cycleTime[timeGenId] != schedule->cycleTime) ||
+			(shadow->baseTime[timeGenId] != schedule->baseTime))
+		{
+			shadow->timeGenVec &= ~((MSD_U32)1 << timeGenId);
+			retVal = Fir_streamGateTimeGenLoad(dev, timeGenId, schedule->cycleTime, schedule->baseTime);
+			if (retVal == MSD_OK)
+			{
+				shadow->cycleTime[timeGenId] = schedule->cycleTime;
+				shadow->baseTime[timeGenId] = schedule->baseTime;
+				shadow->timeGenVec |= (MSD_U32)1 << timeGenId;
+				count++;
+			}
+		}
+	}
+
+	/* CRC-16 over the entries as written (low byte first), time generation id, cycle time and base time */
+	if ((retVal == MSD_OK) && (checksum != NULL))
 	{
-		MSD_DBG_ERROR(("Fir_streamGateTimeGenOpWrite returned: %s.\n", msdDisplayStatus(retVal)));
-		msdSemGive(dev->devNum, dev->qciRegsSem);
-		return retVal;
+		crc = (MSD_U16)0xFFFF;
+		for (i = 0; i < MSD_STREAM_GATE_MAX_ENTRIES; i++)
+		{
+			for (j = 0; j < 3U; j++)
+			{
+				crcData[2U * j] = (MSD_U16)(entryRegs[i][j] & 0xFFU);
+				crcData[(2U * j) + 1U] = (MSD_U16)(entryRegs[i][j] >> 8);
+			}
+			crc = msdCrc16(crc, crcData, 6U);
+		}
+		crcData[0] = (MSD_U16)timeGenId;
+		crc = msdCrc16(crc, crcData, 1U);
+		for (j = 0; j < 4U; j++)
+		{
+			crcData[j] = (MSD_U16)((schedule->cycleTime >> (8U * j)) & 0xFFU);
+		}
+		crc = msdCrc16(crc, crcData, 4U);
+		for (j = 0; j < 5U; j++)
+		{
+			crcData[j] = (MSD_U16)((schedule->baseTime >> (8U * j)) & 0xFFU);
+		}
+		crc = msdCrc16(crc, crcData, 5U);
+		*checksum = crc;
 	}
 
 	msdSemGive(dev->devNum, dev->qciRegsSem);
-	MSD_DBG_INFO(("Fir_gqciStreamGateTimeGenSet Exit.\n"));
+
+	if (numWrites != NULL)
+	{
+		*numWrites = count;
+	}
+
+	MSD_DBG_INFO(("Fir_gqciStreamGateScheduleSet Exit.\n"));
 	return retVal;
 }
 
@@ -2689,6 +2969,41 @@ OUT MSD_U16       *dataVal
 	return retVal;
 }
 
+/* PTP global time, TAI offset 0xE and 0xF, high word re-read to catch a carry */
+static MSD_STATUS Fir_taiGlobalTimeRead
+(
+IN  MSD_QD_DEV    *dev,
+OUT MSD_U32       *globalTime
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 high;
+	MSD_U16 low = 0;
+	MSD_U16 high2 = 0;
+
+	retVal = Fir_taiBasicRead(dev, (MSD_U8)0xF, &high);
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_taiBasicRead(dev, (MSD_U8)0xE, &low);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_taiBasicRead(dev, (MSD_U8)0xF, &high2);
+	}
+	if ((retVal == MSD_OK) && (high2 != high))
+	{
+		high = high2;
+		retVal = Fir_taiBasicRead(dev, (MSD_U8)0xE, &low);
+	}
+
+	if (retVal == MSD_OK)
+	{
+		*globalTime = ((MSD_U32)high << 16) | (MSD_U32)low;
+	}
+
+	return retVal;
+}
+
 static MSD_STATUS Fir_TSNBasicWrite
 (
 IN	MSD_QD_DEV	*dev,
@@ -2887,6 +3202,80 @@ IN  MSD_U8        streamFilterId
 	return retVal;
 }
 
+/*
+* read stream filter offset 4 to 7 after a read operation. With RMU the four
+* indirect reads go out in one frame, each waiting on the AVB busy bit in the
+* switch.
+*/
+static MSD_STATUS Fir_streamFilterCountersRead
+(
+IN  MSD_QD_DEV    *dev,
+OUT MSD_U16       *counter
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[FIR_QCI_RMU_COUNTER_CMDS];
+	MSD_RegCmd *pRegCmd = regCmdList;
+	MSD_U32 nCmd = 0;
+	MSD_U8 i;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		for (i = 0; i < (MSD_U8)MSD_PSFP_CNT_NUM; i++)
+		{
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = 15U;
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)0x4 << 5) |
+				(MSD_U16)((MSD_U16)(4U + i) & (MSD_U16)0x1F));
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = 15U;
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_READ;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_DATA;
+			regCmdList[nCmd].data = 0;
+			nCmd++;
+		}
+
+		msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+		if (retVal == MSD_OK)
+		{
+			for (i = 0; i < (MSD_U8)MSD_PSFP_CNT_NUM; i++)
+			{
+				counter[i] = regCmdList[(4U * i) + 3U].data;
+			}
+		}
+	}
+	else
+	{
+		for (i = 0; (retVal == MSD_OK) && (i < (MSD_U8)MSD_PSFP_CNT_NUM); i++)
+		{
+			retVal = Fir_streamFilterBasicRead(dev, (MSD_U8)(4U + i), &counter[i]);
+		}
+	}
+
+	return retVal;
+}
+
 /* stream gate related*/
 static MSD_STATUS Fir_streamGateBasicWrite
 (
@@ -3118,6 +3507,239 @@ IN  MSD_U8        streamGateTimeGenId
 	return retVal;
 }
 
+/* program and enable a stream gate time generation instance, caller holds qciRegsSem */
+static MSD_STATUS Fir_streamGateTimeGenLoad
+(
+IN  MSD_QD_DEV    *dev,
+IN  MSD_U8        streamGateGenId,
+IN  MSD_U32       gateCycleTime,
+IN  MSD_U64       gateBaseTime
+)
+{
+	MSD_STATUS retVal;
+	MSD_U16 dataVal;
+	MSD_U8 tmpRegAddr;
+	MSD_U8 trigSel;
+	MSD_U32 cycleTime;
+
+	/* get TrigGenTimeSel (see TAI offset 0x12) */
+	tmpRegAddr = (MSD_U8)0x12;
+	retVal = Fir_taiBasicRead(dev, tmpRegAddr, &dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_taiBasicRead returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* check trigSel using PTP Global Timer, PTP ToD, PTP 1722 Nano */
+	trigSel = (MSD_U8)((dataVal & (MSD_U16)0x60) >> 5);
+	if (trigSel == 0U)
+	{
+		/* the unit of this interval is as same as PTP Global Timer */
+		cycleTime = gateCycleTime / 4U;
+	}
+	else if ((trigSel == 1U) || (trigSel == 2U))
+	{
+		/* the unit of this interval is nanoseconds */
+		cycleTime = gateCycleTime;
+	}
+	else
+	{
+		MSD_DBG_ERROR(("TrigGenTimeSel is reseved, please check.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	/* cycle time register is 24 bits wide */
+	if ((cycleTime >> 24) != 0U)
+	{
+		MSD_DBG_ERROR(("Gate cycle time %u out of range.\n", (unsigned int)gateCycleTime));
+		return MSD_BAD_PARAM;
+	}
+
+	/* write gate cycle time low 16 bits*/
+	tmpRegAddr = 2U;
+	dataVal = (MSD_U16)(cycleTime & (MSD_U32)0xFFFF);
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate cycle time high 8 bits*/
+	tmpRegAddr = 3U;
+	dataVal = (MSD_U16)((cycleTime >> 16) & (MSD_U32)0xFF);
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate base time low 16 bits*/
+	tmpRegAddr = 4U;
+	dataVal = (MSD_U16)(gateBaseTime & (MSD_U32)0xFFFF);
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate base time middle 16 bits*/
+	tmpRegAddr = 5U;
+	dataVal = (MSD_U16)((gateBaseTime >> 16) & (MSD_U32)0xFFFF);
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate base time high 8 bits*/
+	tmpRegAddr = 6U;
+	dataVal = (MSD_U16)((gateBaseTime >> 32) & (MSD_U32)0xFF);
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate time generation enable */
+	tmpRegAddr = 1U;
+	dataVal = 1U;
+	retVal = Fir_streamGateTimeGenBasicWrite(dev, tmpRegAddr, dataVal);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenBasicWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* write gate time generation instance to corresponding Id */
+	retVal = Fir_streamGateTimeGenOpWrite(dev, streamGateGenId);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_streamGateTimeGenOpWrite returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+
+	return retVal;
+}
+
+/* wait until the previous gate control entry write is done, stream gate offset 4 */
+static MSD_STATUS Fir_streamGateEntryWait
+(
+IN  MSD_QD_DEV    *dev
+)
+{
+	MSD_STATUS retVal;
+	MSD_U8 count = (MSD_U8)0x10;
+	MSD_U16 tempData = 0;
+
+	do
+	{
+		retVal = Fir_streamGateBasicRead(dev, 0x4U, &tempData);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+
+		if (count-- == 0U)
+		{
+			return MSD_FAIL;
+		}
+
+	} while ((tempData & (MSD_U16)0x8000) == (MSD_U16)0x8000);
+
+	return retVal;
+}
+
+/*
+* write one gate control entry of the selected stream gate: offset 5, 6, 7 and
+* the entry write at offset 4. Offset 5 is read first and only its gate fields
+* (bits 4:0) are changed. With RMU the four indirect writes go out in one
+* frame, each waiting on the AVB busy bit in the switch.
+*/
+static MSD_STATUS Fir_streamGateEntryLoad
+(
+IN  MSD_QD_DEV    *dev,
+IN  MSD_U8        pointer,
+IN  const MSD_U16 *entryRegs
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmdList[FIR_QCI_RMU_ENTRY_CMDS];
+	MSD_RegCmd *pRegCmd = regCmdList;
+	MSD_U16 data[4];
+	MSD_U8 regAddr[4];
+	MSD_U16 tempData = 0;
+	MSD_U32 nCmd = 0;
+	MSD_U8 i;
+
+	retVal = Fir_streamGateBasicRead(dev, 5U, &tempData);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	regAddr[0] = 5U;
+	regAddr[1] = 6U;
+	regAddr[2] = 7U;
+	regAddr[3] = 4U;
+	data[0] = (tempData & (MSD_U16)0xFFE0) | (entryRegs[0] & (MSD_U16)0x1F);
+	data[1] = entryRegs[1];
+	data[2] = entryRegs[2];
+	data[3] = (MSD_U16)0x8000 | (MSD_U16)(pointer & (MSD_U8)0xF);
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		for (i = 0; i < 4U; i++)
+		{
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+			regCmdList[nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = 15U;
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_DATA;
+			regCmdList[nCmd].data = data[i];
+			nCmd++;
+
+			regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+			regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+			regCmdList[nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+			regCmdList[nCmd].regAddr = FIR_AVB_COMMAND;
+			regCmdList[nCmd].data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)3 << 13) |
+				(MSD_U16)((MSD_U16)0x1 << 8) | (MSD_U16)((MSD_U16)0x4 << 5) | (MSD_U16)((MSD_U16)regAddr[i] & (MSD_U16)0x1F));
+			nCmd++;
+		}
+
+		msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		msdSemGive(dev->devNum, dev->ptpRegsSem);
+	}
+	else
+	{
+		for (i = 0; (retVal == MSD_OK) && (i < 4U); i++)
+		{
+			retVal = Fir_streamGateBasicWrite(dev, regAddr[i], data[i]);
+		}
+	}
+
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_streamGateEntryWait(dev);
+	}
+
+	return retVal;
+}
+
 /* flow meter related */
 static MSD_STATUS Fir_flowMeterBasicWrite
 (
@@ -0,0 +1,644 @@
+/*******************************************************************************
+*
+* msdBench.c
+*
+* DESCRIPTION:
+*       UMSD driver microbenchmark. Loads the driver over a register access
+*       backend and runs the operations of every API family: ATU add, find,
+*       dump and delete, VTU add, find and delete, MIB read of all counters,
+*       TCAM load and read, PTP time stamp read, Qci and FRER counters.
+*       For each operation it reports operations per second, SMI reads and
+*       writes per operation and the p50 and p99 latency, as text, JSON or
+*       CSV. Run it with the same options for two releases and compare the
+*       JSON or CSV output to find regressions.
+*
+* DEPENDENCIES:   msdApi, msdBench
+*
+* FILE REVISION NUMBER:
+*
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <semaphore.h>
+#include "msdBench.h"
+
+#define BENCH_DEV_NUM        0
+#define BENCH_ITERATIONS     1000
+#define BENCH_WARMUP         16
+#define BENCH_TABLE_SIZE     256    /* ATU and VTU entries cycled through */
+#define BENCH_TCAM_ENTRIES   64
+#define BENCH_INSTANCES      8      /* Qci and FRER instances cycled through */
+#define BENCH_SEM_NUM        64
+
+typedef enum
+{
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_JSON,
+    BENCH_FORMAT_CSV
+} BENCH_FORMAT;
+
+typedef struct
+{
+    const char *family;
+    const char *name;
+    MSD_STATUS (*prepare)(MSD_U8 devNum);    /* untimed set up, may be NULL */
+    MSD_STATUS (*run)(MSD_U8 devNum, MSD_U32 iter);
+} BENCH_OP;
+
+typedef struct
+{
+    const BENCH_OP *op;
+    const char *status;
+    MSD_U32 ops;
+    MSD_U32 failures;
+    MSD_U64 elapsedNs;
+    MSD_U64 reads;
+    MSD_U64 writes;
+    MSD_U64 p50Ns;
+    MSD_U64 p99Ns;
+} BENCH_RESULT;
+
+static const BENCH_BACKEND *benchBackend;
+static MSD_U64 benchReads;
+static MSD_U64 benchWrites;
+static sem_t benchSems[BENCH_SEM_NUM];
+static MSD_U32 benchSemUsed;
+
+static MSD_U64 benchNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (MSD_U64)ts.tv_sec * 1000000000ULL + (MSD_U64)ts.tv_nsec;
+}
+
+/*
+ * BSP functions given to the driver. The register accesses are counted
+ * here, so every backend reports bus transactions the same way.
+ */
+static MSD_STATUS benchReadMii(MSD_U8 devNum, MSD_U8 phyAddr, MSD_U8 miiReg, MSD_U16 *value)
+{
+    benchReads++;
+    return benchBackend->read(phyAddr, miiReg, value);
+}
+
+static MSD_STATUS benchWriteMii(MSD_U8 devNum, MSD_U8 phyAddr, MSD_U8 miiReg, MSD_U16 value)
+{
+    benchWrites++;
+    return benchBackend->write(phyAddr, miiReg, value);
+}
+
+static MSD_SEM benchSemCreate(MSD_SEM_BEGIN_STATE state)
+{
+    if (benchSemUsed >= BENCH_SEM_NUM)
+        return 0;
+    if (sem_init(&benchSems[benchSemUsed], 0, (unsigned int)state) != 0)
+        return 0;
+    benchSemUsed++;
+    return (MSD_SEM)benchSemUsed;
+}
+
+static MSD_STATUS benchSemDelete(MSD_SEM smid)
+{
+    return sem_destroy(&benchSems[smid - 1]) == 0 ? MSD_OK : MSD_FAIL;
+}
+
+static MSD_STATUS benchSemTake(MSD_SEM smid, MSD_U32 timeOut)
+{
+    return sem_wait(&benchSems[smid - 1]) == 0 ? MSD_OK : MSD_FAIL;
+}
+
+static MSD_STATUS benchSemGive(MSD_SEM smid)
+{
+    return sem_post(&benchSems[smid - 1]) == 0 ? MSD_OK : MSD_FAIL;
+}
+
+static MSD_STATUS benchHostTime(MSD_U64 *nanoSec)
+{
+    *nanoSec = benchNow();
+    return MSD_OK;
+}
+
+/* ports 1 to numOfPorts - 1, port 0 has no PTP on some devices */
+static MSD_U8 benchPort(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_QD_DEV *dev = sohoDevGet(devNum);
+
+    if (dev->numOfPorts < 2)
+        return 0;
+    return (MSD_U8)(1 + iter % (dev->numOfPorts - 1U));
+}
+
+/* ATU: static unicast entries 00:50:43:00:xx:xx in FID 0 */
+static void benchAtuEntry(MSD_U8 devNum, MSD_U32 iter, MSD_ATU_ENTRY *entry)
+{
+    MSD_U32 idx = iter % BENCH_TABLE_SIZE;
+
+    memset(entry, 0, sizeof(MSD_ATU_ENTRY));
+    entry->macAddr.arEther[0] = 0x00;
+    entry->macAddr.arEther[1] = 0x50;
+    entry->macAddr.arEther[2] = 0x43;
+    entry->macAddr.arEther[4] = (MSD_U8)(idx >> 8);
+    entry->macAddr.arEther[5] = (MSD_U8)idx;
+    entry->portVec = 1U << benchPort(devNum, idx);
+    entry->entryState = 0xE;
+}
+
+static MSD_STATUS benchAtuAdd(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_ATU_ENTRY entry;
+
+    benchAtuEntry(devNum, iter, &entry);
+    return msdFdbMacEntryAdd(devNum, &entry);
+}
+
+static MSD_STATUS benchAtuPrepare(MSD_U8 devNum)
+{
+    MSD_STATUS retVal;
+    MSD_U32 i;
+
+    for (i = 0; i < BENCH_TABLE_SIZE; i++)
+    {
+        if ((retVal = benchAtuAdd(devNum, i)) != MSD_OK)
+            return retVal;
+    }
+    return MSD_OK;
+}
+
+static MSD_STATUS benchAtuFind(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_ATU_ENTRY entry, found;
+    MSD_BOOL isFound;
+
+    benchAtuEntry(devNum, iter, &entry);
+    return msdFdbMacEntryFind(devNum, &entry.macAddr, 0, &found, &isFound);
+}
+
+/* one step of a walk over FID 0, that is the cost of one dumped entry */
+static MSD_STATUS benchAtuDump(MSD_U8 devNum, MSD_U32 iter)
+{
+    static MSD_ETHERADDR next;
+    MSD_ATU_ENTRY entry;
+    MSD_STATUS retVal;
+
+    if (iter == 0)
+        memset(&next, 0xFF, sizeof(next));
+
+    retVal = msdFdbEntryNextGet(devNum, &next, 0, &entry);
+    if (retVal == MSD_NO_SUCH)
+    {
+        memset(&next, 0xFF, sizeof(next));
+        return MSD_OK;
+    }
+    memcpy(&next, &entry.macAddr, sizeof(next));
+    return retVal;
+}
+
+static MSD_STATUS benchAtuDelete(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_ATU_ENTRY entry;
+
+    benchAtuEntry(devNum, iter, &entry);
+    return msdFdbMacEntryDelete(devNum, &entry.macAddr, 0);
+}
+
+/* one occupancy sweep: every port, the ATU totals and FID 0 */
+static MSD_STATUS benchAtuOccupancy(MSD_U8 devNum, MSD_U32 iter)
+{
+    static const MSD_U32 fid = 0;
+    MSD_FDB_OCCUPANCY occupancy;
+
+    return msdFdbOccupancyGet(devNum, 1, &fid, &occupancy);
+}
+
+/* VTU: VID 1 to BENCH_TABLE_SIZE, all in FID 1 */
+static MSD_STATUS benchVtuAdd(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_VTU_ENTRY entry;
+
+    memset(&entry, 0, sizeof(entry));
+    entry.vid = (MSD_U16)(1 + iter % BENCH_TABLE_SIZE);
+    entry.fid = 1;
+    return msdVlanEntryAdd(devNum, &entry);
+}
+
+static MSD_STATUS benchVtuPrepare(MSD_U8 devNum)
+{
+    MSD_STATUS retVal;
+    MSD_U32 i;
+
+    for (i = 0; i < BENCH_TABLE_SIZE; i++)
+    {
+        if ((retVal = benchVtuAdd(devNum, i)) != MSD_OK)
+            return retVal;
+    }
+    return MSD_OK;
+}
+
+static MSD_STATUS benchVtuFind(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_VTU_ENTRY entry;
+    MSD_BOOL found;
+
+    return msdVlanEntryFind(devNum, (MSD_U16)(1 + iter % BENCH_TABLE_SIZE), &entry, &found);
+}
+
+static MSD_STATUS benchVtuDelete(MSD_U8 devNum, MSD_U32 iter)
+{
+    return msdVlanEntryDelete(devNum, (MSD_U16)(1 + iter % BENCH_TABLE_SIZE));
+}
+
+static MSD_STATUS benchMibReadAll(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_STATS_COUNTER_SET counters;
+
+    return msdStatsPortAllCountersGet(devNum, benchPort(devNum, iter), &counters);
+}
+
+static MSD_STATUS benchTcamLoad(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_TCAM_DATA data;
+
+    memset(&data, 0, sizeof(data));
+    data.spvMask = (MSD_U16)(1U << benchPort(devNum, iter));
+    return msdTcamEntryAdd(devNum, iter % BENCH_TCAM_ENTRIES, &data);
+}
+
+static MSD_STATUS benchTcamRead(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_TCAM_DATA data;
+
+    return msdTcamEntryRead(devNum, iter % BENCH_TCAM_ENTRIES, &data);
+}
+
+static MSD_STATUS benchPtpTsRead(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_PTP_TS_STATUS status;
+
+    return msdPtpTimeStampGet(devNum, benchPort(devNum, iter), MSD_PTP_ARR0_TIME, &status);
+}
+
+static MSD_STATUS benchQciCounter(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_U16 counter;
+
+    return msdStreamFilterMatchCounterGet(devNum, (MSD_U8)(iter % BENCH_INSTANCES), &counter);
+}
+
+static MSD_STATUS benchQciSnapshot(MSD_U8 devNum, MSD_U32 iter)
+{
+    static MSD_PSFP_STATS_CTX ctx;
+
+    return msdPsfpStatsSnapshot(devNum, (1U << BENCH_INSTANCES) - 1U, &ctx);
+}
+
+static MSD_STATUS benchFrerSeqRcvy(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_FRER_SEQRCVY data;
+    MSD_U16 resets, latErrResets;
+
+    return msdFrerSeqRcvyRead(devNum, (MSD_U8)(iter % BENCH_INSTANCES), &data, &resets, &latErrResets);
+}
+
+static MSD_STATUS benchFrerCounter(MSD_U8 devNum, MSD_U32 iter)
+{
+    MSD_FRER_BANK0_CONFIG config;
+    MSD_FRER_BANK0_COUNTER counter;
+
+    return msdFrerBank0SCtrRead(devNum, (MSD_U8)(iter % BENCH_INSTANCES), &config, &counter);
+}
+
+static MSD_STATUS benchFrerPrepare(MSD_U8 devNum)
+{
+    static MSD_FRER_SNAPSHOT_CACHE cache;
+    MSD_STATUS retVal;
+
+    retVal = msdFrerSnapshotAttach(devNum, &cache);
+    return (retVal == MSD_ALREADY_EXIST) ? MSD_OK : retVal;
+}
+
+static MSD_STATUS benchFrerSnapshot(MSD_U8 devNum, MSD_U32 iter)
+{
+    return msdFrerSnapshotRefresh(devNum, NULL);
+}
+
+static const BENCH_OP benchOps[] =
+{
+    { "atu",  "add",            NULL,            benchAtuAdd },
+    { "atu",  "find",           benchAtuPrepare, benchAtuFind },
+    { "atu",  "dump",           benchAtuPrepare, benchAtuDump },
+    { "atu",  "delete",         benchAtuPrepare, benchAtuDelete },
+    { "atu",  "occupancy",      benchAtuPrepare, benchAtuOccupancy },
+    { "vtu",  "add",            NULL,            benchVtuAdd },
+    { "vtu",  "find",           benchVtuPrepare, benchVtuFind },
+    { "vtu",  "delete",         benchVtuPrepare, benchVtuDelete },
+    { "mib",  "read_all",       NULL,            benchMibReadAll },
+    { "tcam", "load",           NULL,            benchTcamLoad },
+    { "tcam", "read",           NULL,            benchTcamRead },
+    { "ptp",  "ts_read",        NULL,            benchPtpTsRead },
+    { "qci",  "match_counter",  NULL,            benchQciCounter },
+    { "qci",  "stats_snapshot", NULL,            benchQciSnapshot },
+    { "frer", "seqrcvy_read",   NULL,            benchFrerSeqRcvy },
+    { "frer", "counter_read",   NULL,            benchFrerCounter },
+    { "frer", "snapshot",       benchFrerPrepare, benchFrerSnapshot }
+};
+
+#define BENCH_OP_NUM    (sizeof(benchOps) / sizeof(benchOps[0]))
+
+static int benchCompareU64(const void *a, const void *b)
+{
+    MSD_U64 x = *(const MSD_U64 *)a;
+    MSD_U64 y = *(const MSD_U64 *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* nearest rank percentile of sorted samples */
+static MSD_U64 benchPercentile(const MSD_U64 *sorted, MSD_U32 num, MSD_U32 pct)
+{
+    MSD_U32 rank = (num * pct + 99) / 100;
+
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+static void benchRunOp(MSD_U8 devNum, const BENCH_OP *op, MSD_U32 iterations,
+                       MSD_U64 *samples, BENCH_RESULT *result)
+{
+    MSD_STATUS retVal;
+    MSD_U64 reads, writes, start, t0, t1;
+    MSD_U32 i;
+
+    memset(result, 0, sizeof(BENCH_RESULT));
+    result->op = op;
+    result->status = "ok";
+
+    retVal = op->prepare != NULL ? op->prepare(devNum) : MSD_OK;
+    for (i = 0; i < BENCH_WARMUP && retVal == MSD_OK; i++)
+        retVal = op->run(devNum, i);
+    if (retVal != MSD_OK)
+    {
+        result->status = retVal == MSD_NOT_SUPPORTED ? "not_supported" : "error";
+        return;
+    }
+
+    reads = benchReads;
+    writes = benchWrites;
+    start = benchNow();
+    for (i = 0; i < iterations; i++)
+    {
+        t0 = benchNow();
+        retVal = op->run(devNum, i);
+        t1 = benchNow();
+        samples[i] = t1 - t0;
+        if (retVal != MSD_OK)
+            result->failures++;
+    }
+    result->elapsedNs = benchNow() - start;
+    result->reads = benchReads - reads;
+    result->writes = benchWrites - writes;
+    result->ops = iterations;
+
+    qsort(samples, iterations, sizeof(MSD_U64), benchCompareU64);
+    result->p50Ns = benchPercentile(samples, iterations, 50);
+    result->p99Ns = benchPercentile(samples, iterations, 99);
+}
+
+static double benchPerOp(MSD_U64 count, const BENCH_RESULT *result)
+{
+    return result->ops == 0 ? 0.0 : (double)count / result->ops;
+}
+
+static double benchOpsPerSec(const BENCH_RESULT *result)
+{
+    return result->elapsedNs == 0 ? 0.0 : (double)result->ops * 1e9 / (double)result->elapsedNs;
+}
+
+static void benchReport(BENCH_FORMAT format, const char *version, const BENCH_BACKEND_CFG *cfg,
+                        MSD_U32 iterations, const BENCH_RESULT *results, MSD_U32 num)
+{
+    const BENCH_RESULT *r;
+    MSD_U32 i;
+
+    if (format == BENCH_FORMAT_JSON)
+    {
+        printf("{\n  \"tool\": \"msdBench\",\n  \"version\": \"%s\",\n  \"backend\": \"%s\",\n"
+               "  \"latency_ns\": %u,\n  \"device_id\": \"0x%x\",\n  \"iterations\": %u,\n"
+               "  \"results\": [",
+               version, benchBackend->name, (unsigned)cfg->latencyNs,
+               (unsigned)sohoDevGet(BENCH_DEV_NUM)->deviceId, (unsigned)iterations);
+        for (i = 0; i < num; i++)
+        {
+            r = &results[i];
+            printf("%s\n    {\"family\": \"%s\", \"op\": \"%s\", \"status\": \"%s\", \"ops\": %u, "
+                   "\"ops_per_sec\": %.1f, \"reads_per_op\": %.2f, \"writes_per_op\": %.2f, "
+                   "\"bus_per_op\": %.2f, \"p50_ns\": %llu, \"p99_ns\": %llu, \"failures\": %u}",
+                   i == 0 ? "" : ",", r->op->family, r->op->name, r->status, (unsigned)r->ops,
+                   benchOpsPerSec(r), benchPerOp(r->reads, r), benchPerOp(r->writes, r),
+                   benchPerOp(r->reads + r->writes, r), (unsigned long long)r->p50Ns,
+                   (unsigned long long)r->p99Ns, (unsigned)r->failures);
+        }
+        printf("\n  ]\n}\n");
+    }
+    else if (format == BENCH_FORMAT_CSV)
+    {
+        printf("version,backend,latency_ns,family,op,status,ops,ops_per_sec,reads_per_op,"
+               "writes_per_op,bus_per_op,p50_ns,p99_ns,failures\n");
+        for (i = 0; i < num; i++)
+        {
+            r = &results[i];
+            printf("%s,%s,%u,%s,%s,%s,%u,%.1f,%.2f,%.2f,%.2f,%llu,%llu,%u\n",
+                   version, benchBackend->name, (unsigned)cfg->latencyNs, r->op->family,
+                   r->op->name, r->status, (unsigned)r->ops, benchOpsPerSec(r),
+                   benchPerOp(r->reads, r), benchPerOp(r->writes, r),
+                   benchPerOp(r->reads + r->writes, r), (unsigned long long)r->p50Ns,
+                   (unsigned long long)r->p99Ns, (unsigned)r->failures);
+        }
+    }
+    else
+    {
+        printf("UMSD %s, backend %s, latency %u ns, device 0x%x, %u iterations\n\n",
+               version, benchBackend->name, (unsigned)cfg->latencyNs,
+               (unsigned)sohoDevGet(BENCH_DEV_NUM)->deviceId, (unsigned)iterations);
+        printf("%-5s %-15s %12s %8s %8s %8s %10s %10s %6s\n",
+               "api", "op", "ops/s", "bus/op", "rd/op", "wr/op", "p50(ns)", "p99(ns)", "fail");
+        for (i = 0; i < num; i++)
+        {
+            r = &results[i];
+            if (r->ops == 0)
+            {
+                printf("%-5s %-15s %s\n", r->op->family, r->op->name, r->status);
+                continue;
+            }
+            printf("%-5s %-15s %12.1f %8.2f %8.2f %8.2f %10llu %10llu %6u\n",
+                   r->op->family, r->op->name, benchOpsPerSec(r),
+                   benchPerOp(r->reads + r->writes, r), benchPerOp(r->reads, r),
+                   benchPerOp(r->writes, r), (unsigned long long)r->p50Ns,
+                   (unsigned long long)r->p99Ns, (unsigned)r->failures);
+        }
+    }
+}
+
+/* families is a comma separated list, NULL for all */
+static int benchSelected(const char *families, const char *family)
+{
+    const char *p = families;
+    size_t len = strlen(family);
+
+    if (families == NULL)
+        return 1;
+    while ((p = strstr(p, family)) != NULL)
+    {
+        if ((p == families || p[-1] == ',') && (p[len] == ',' || p[len] == '\0'))
+            return 1;
+        p += len;
+    }
+    return 0;
+}
+
+static void benchUsage(const char *prog)
+{
+    MSD_U32 i;
+
+    printf("Usage: %s [-b backend] [-l latency_ns] [-n iterations] [-d device_id]\n"
+           "       [-a smi_addr] [-u usb_port] [-t api[,api...]] [-f text|json|csv]\n\n", prog);
+    printf("Backends:\n");
+    for (i = 0; benchBackends[i] != NULL; i++)
+        printf("  %-6s %s\n", benchBackends[i]->name, benchBackends[i]->desc);
+    printf("\nAPI families: atu, vtu, mib, tcam, ptp, qci, frer\n");
+}
+
+int main(int argc, char *argv[])
+{
+    MSD_SYS_CONFIG cfg;
+    BENCH_BACKEND_CFG backendCfg;
+    BENCH_FORMAT format = BENCH_FORMAT_TEXT;
+    BENCH_RESULT results[BENCH_OP_NUM];
+    MSD_VERSION version;
+    MSD_U64 *samples;
+    MSD_U32 iterations = BENCH_ITERATIONS;
+    MSD_U32 i, num;
+    MSD_U8 baseAddr = 0;
+    const char *backendName = "stub";
+    const char *families = NULL;
+    MSD_STATUS retVal;
+    int opt;
+
+    memset(&backendCfg, 0, sizeof(backendCfg));
+    backendCfg.deviceId = (MSD_U16)MSD_88Q5152;
+
+    while ((opt = getopt(argc, argv, "b:l:n:d:a:u:t:f:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'b':
+            backendName = optarg;
+            break;
+        case 'l':
+            backendCfg.latencyNs = (MSD_U32)strtoul(optarg, NULL, 0);
+            break;
+        case 'n':
+            iterations = (MSD_U32)strtoul(optarg, NULL, 0);
+            break;
+        case 'd':
+            backendCfg.deviceId = (MSD_U16)strtoul(optarg, NULL, 0);
+            break;
+        case 'a':
+            baseAddr = (MSD_U8)strtoul(optarg, NULL, 0);
+            break;
+        case 'u':
+            backendCfg.usbPort = (MSD_U32)strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            families = optarg;
+            break;
+        case 'f':
+            if (strcmp(optarg, "json") == 0)
+                format = BENCH_FORMAT_JSON;
+            else if (strcmp(optarg, "csv") == 0)
+                format = BENCH_FORMAT_CSV;
+            else if (strcmp(optarg, "text") == 0)
+                format = BENCH_FORMAT_TEXT;
+            else
+            {
+                benchUsage(argv[0]);
+                return 1;
+            }
+            break;
+        default:
+            benchUsage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (iterations == 0)
+    {
+        benchUsage(argv[0]);
+        return 1;
+    }
+
+    for (i = 0; benchBackends[i] != NULL; i++)
+    {
+        if (strcmp(benchBackends[i]->name, backendName) == 0)
+            benchBackend = benchBackends[i];
+    }
+    if (benchBackend == NULL)
+    {
+        fprintf(stderr, "Unknown backend %s\n", backendName);
+        benchUsage(argv[0]);
+        return 1;
+    }
+    if (benchBackend->open(&backendCfg) != 0)
+    {
+        fprintf(stderr, "Open backend %s failed\n", backendName);
+        return 1;
+    }
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.devNum = BENCH_DEV_NUM;
+    cfg.baseAddr = baseAddr;
+    cfg.InterfaceChannel = MSD_INTERFACE_SMI;
+    cfg.BSPFunctions.readMii = benchReadMii;
+    cfg.BSPFunctions.writeMii = benchWriteMii;
+    cfg.BSPFunctions.semCreate = benchSemCreate;
+    cfg.BSPFunctions.semDelete = benchSemDelete;
+    cfg.BSPFunctions.semTake = benchSemTake;
+    cfg.BSPFunctions.semGive = benchSemGive;
+    cfg.BSPFunctions.getHostTime = benchHostTime;
+
+    if ((retVal = msdLoadDriver(&cfg)) != MSD_OK)
+    {
+        fprintf(stderr, "msdLoadDriver returned %d\n", retVal);
+        benchBackend->close();
+        return 1;
+    }
+
+    memset(&version, 0, sizeof(version));
+    msdVersion(&version);
+
+    samples = (MSD_U64 *)malloc(sizeof(MSD_U64) * iterations);
+    if (samples == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        msdUnLoadDriver(BENCH_DEV_NUM);
+        benchBackend->close();
+        return 1;
+    }
+
+    num = 0;
+    for (i = 0; i < BENCH_OP_NUM; i++)
+    {
+        if (benchSelected(families, benchOps[i].family))
+            benchRunOp(BENCH_DEV_NUM, &benchOps[i], iterations, samples, &results[num++]);
+    }
+
+    benchReport(format, (const char *)version.version, &backendCfg, iterations, results, num);
+
+    free(samples);
+    msdUnLoadDriver(BENCH_DEV_NUM);
+    benchBackend->close();
+    return 0;
+}
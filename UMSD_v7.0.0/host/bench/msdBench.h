@@ -0,0 +1,73 @@
+/*******************************************************************************
+*
+* msdBench.h
+*
+* DESCRIPTION:
+*       Definitions of the UMSD driver microbenchmark. A backend carries the
+*       register accesses of the driver; the suite runs every API family
+*       over it and counts the bus transactions of each operation.
+*
+* DEPENDENCIES:   msdApi
+*
+* FILE REVISION NUMBER:
+*
+*******************************************************************************/
+
+#ifndef __MSDBENCH_H_
+#define __MSDBENCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "msdApi.h"
+
+/*
+*  typedef: struct BENCH_BACKEND_CFG
+*
+*  Description: Options passed to a backend when it is opened.
+*
+*  Fields:
+*      latencyNs - time one register access takes, in ns, stub backend only
+*      deviceId  - switch ID reported in port register 3, stub backend only
+*      usbPort   - USB port of the adapter, usb backend only
+*/
+typedef struct
+{
+    MSD_U32 latencyNs;
+    MSD_U16 deviceId;
+    MSD_U32 usbPort;
+} BENCH_BACKEND_CFG;
+
+/*
+*  typedef: struct BENCH_BACKEND
+*
+*  Description: Register access backend. A new backend is added to
+*               benchBackends in msdBenchBackend.c.
+*
+*  Fields:
+*      name  - name selected with -b
+*      desc  - one line description
+*      open  - prepare the backend, returns 0 on success
+*      close - release the backend
+*      read  - read a register of an SMI device address
+*      write - write a register of an SMI device address
+*/
+typedef struct
+{
+    const char *name;
+    const char *desc;
+    int (*open)(const BENCH_BACKEND_CFG *cfg);
+    void (*close)(void);
+    MSD_STATUS (*read)(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 *value);
+    MSD_STATUS (*write)(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 value);
+} BENCH_BACKEND;
+
+/* NULL terminated list of the backends built in */
+extern const BENCH_BACKEND *const benchBackends[];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MSDBENCH_H_ */
@@ -0,0 +1,150 @@
+/*******************************************************************************
+*
+* msdBenchBackend.c
+*
+* DESCRIPTION:
+*       Register access backends of the UMSD driver microbenchmark.
+*
+*       stub - in-process register file. Every SMI device address has 32
+*              registers that read back what was last written, with bit 15
+*              cleared so that command busy bits finish at once. Port
+*              register 3 reads the switch ID until it is written. Each
+*              access spins for the configured latency, which models the
+*              cost of the real bus.
+*       usb  - USB to SMI adapter through libMRegAccess, built with HW=YES.
+*
+* DEPENDENCIES:   msdBench
+*
+* FILE REVISION NUMBER:
+*
+*******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+#include "msdBench.h"
+#ifdef BENCH_HW
+#include "Wrapper.h"
+#endif
+
+#define STUB_DEV_ADDR_NUM    32
+#define STUB_REG_NUM         32
+#define STUB_SWITCH_ID_REG   3
+
+static MSD_U16 stubRegs[STUB_DEV_ADDR_NUM][STUB_REG_NUM];
+static MSD_U32 stubIdWritten;
+static MSD_U16 stubDeviceId;
+static MSD_U32 stubLatencyNs;
+
+static void stubDelay(void)
+{
+    struct timespec ts;
+    MSD_U64 start, now;
+
+    if (stubLatencyNs == 0)
+        return;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    start = (MSD_U64)ts.tv_sec * 1000000000ULL + (MSD_U64)ts.tv_nsec;
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        now = (MSD_U64)ts.tv_sec * 1000000000ULL + (MSD_U64)ts.tv_nsec;
+    } while (now - start < stubLatencyNs);
+}
+
+static int stubOpen(const BENCH_BACKEND_CFG *cfg)
+{
+    memset(stubRegs, 0, sizeof(stubRegs));
+    stubIdWritten = 0;
+    stubDeviceId = cfg->deviceId;
+    stubLatencyNs = cfg->latencyNs;
+    return 0;
+}
+
+static void stubClose(void)
+{
+}
+
+static MSD_STATUS stubRead(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 *value)
+{
+    if (devAddr >= STUB_DEV_ADDR_NUM || regAddr >= STUB_REG_NUM)
+        return MSD_FAIL;
+
+    stubDelay();
+    if (regAddr == STUB_SWITCH_ID_REG && (stubIdWritten & (1U << devAddr)) == 0)
+        *value = (MSD_U16)(stubDeviceId << 4);
+    else
+        *value = stubRegs[devAddr][regAddr];
+    return MSD_OK;
+}
+
+static MSD_STATUS stubWrite(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 value)
+{
+    if (devAddr >= STUB_DEV_ADDR_NUM || regAddr >= STUB_REG_NUM)
+        return MSD_FAIL;
+
+    stubDelay();
+    if (regAddr == STUB_SWITCH_ID_REG)
+        stubIdWritten |= 1U << devAddr;
+    stubRegs[devAddr][regAddr] = (MSD_U16)(value & 0x7FFF);
+    return MSD_OK;
+}
+
+static const BENCH_BACKEND stubBackend =
+{
+    "stub",
+    "in-process register file, access latency set with -l",
+    stubOpen,
+    stubClose,
+    stubRead,
+    stubWrite
+};
+
+#ifdef BENCH_HW
+static int usbOpen(const BENCH_BACKEND_CFG *cfg)
+{
+    setUSBPort((int)cfg->usbPort);
+    return openDefaultUSBDriver();
+}
+
+static void usbClose(void)
+{
+    closeUSBDriver();
+}
+
+static MSD_STATUS usbRead(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 *value)
+{
+    int ret = readRegister(devAddr, regAddr);
+
+    if (ret < 0)
+        return MSD_FAIL;
+    *value = (MSD_U16)ret;
+    return MSD_OK;
+}
+
+static MSD_STATUS usbWrite(MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 value)
+{
+    if (writeRegister(devAddr, regAddr, value) < 0)
+        return MSD_FAIL;
+    return MSD_OK;
+}
+
+static const BENCH_BACKEND usbBackend =
+{
+    "usb",
+    "USB to SMI adapter, port set with -u",
+    usbOpen,
+    usbClose,
+    usbRead,
+    usbWrite
+};
+#endif
+
+const BENCH_BACKEND *const benchBackends[] =
+{
+    &stubBackend,
+#ifdef BENCH_HW
+    &usbBackend,
+#endif
+    NULL
+};
@@ -22,10 +22,14 @@ typedef struct
     char nic_name[100];
 }RMU_STRUCT;
 
+#define MAX_EXTRA_DEV 31
+
 typedef struct
 {
     MSD_INTERFACE bus_interface;
     MSD_U8 dev_num;
+    MSD_U8 extra_dev[MAX_EXTRA_DEV];   /* more devices on the bus, loaded with qdInitDevList */
+    MSD_U8 num_extra_dev;
     SMI_STRUCT smi;
     RMU_STRUCT rmu;
 }BUS_CONF_STRUCT;
@@ -0,0 +1,26 @@
+#ifndef __QDINIT_H__
+#define __QDINIT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "msdApi.h"
+
+void qdConfigInit(MSD_SYS_CONFIG *cfg, MSD_U8 devNum, MSD_U8 baseAddr, MSD_32 bus_interface, MSD_U16 tempDeviceId);
+MSD_STATUS qdInit(int baseAddr, int bus_interface, MSD_U16 tempDeviceId);
+MSD_STATUS qdInitMulti(MSD_U32 numDevs, MSD_SYS_CONFIG *cfgList, const MSD_U32 *busId,
+					   MSD_STATUS *statusList, MSD_U64 *loadTimeNs);
+MSD_STATUS qdInitDevList(int baseAddr, int bus_interface, const MSD_U8 *devList, MSD_U32 numDevs);
+void qdClose();
+
+#ifndef WIN32
+MSD_STATUS qdAsyncStart(MSD_U8 devNum, int *eventFd);
+#endif
+MSD_STATUS qdAsyncStop(MSD_U8 devNum);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__QDINIT_H__*/
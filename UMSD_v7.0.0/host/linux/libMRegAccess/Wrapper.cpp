@@ -1,5 +1,6 @@
 // QdCppWrapper.cpp : source file that includes just the standard includes
 
+#include <pthread.h>
 #include <semaphore.h>
 #include <stdio.h>
 #include <time.h>
@@ -11,9 +12,13 @@
 HANDLE pDeviceHandle = NULL;
 unsigned int  g_USBPort;
 
-#define MAXSEMNUMBER 15
+// 32 devices with up to 20 semaphores each (device, async queue, FRER cache)
+// plus the load semaphore of qdInitMulti. Handle 0 is not used, the driver
+// takes it as a failed create. Closed handles are given out again.
+#define MAXSEMNUMBER (32 * 20 + 2)
 sem_t g_semlist[MAXSEMNUMBER];
-static int g_semcount = 1;
+static bool g_semused[MAXSEMNUMBER];
+static pthread_mutex_t g_semlock = PTHREAD_MUTEX_INITIALIZER;
 
 int openDefaultUSBDriver()
 {
@@ -56,24 +61,35 @@ void closeUSBDriver()
 int semaphoreCreate(int count)
 {
 	int ret = 0;
+	int smid;
 
-	if(g_semcount >= MAXSEMNUMBER)
+	// devices may be loaded from several threads
+	pthread_mutex_lock(&g_semlock);
+
+	for(smid = 1; smid < MAXSEMNUMBER; smid++)
 	{
-		printf("Over the Max Semaphore numbers\n");
-		return -3;
+		if(!g_semused[smid])
+			break;
 	}
 
-	if(sem_init(&(g_semlist[g_semcount]), 0, count) != 0)
+	if(smid >= MAXSEMNUMBER)
 	{
-		printf("Init semapore%d error\n", g_semcount);
+		printf("Over the Max Semaphore numbers\n");
+		ret = -3;
+	}
+	else if(sem_init(&(g_semlist[smid]), 0, count) != 0)
+	{
+		printf("Init semapore%d error\n", smid);
 		ret = -1;
 	}
 	else
 	{
-		ret = g_semcount;
-		g_semcount = g_semcount + 1;		
+		g_semused[smid] = true;
+		ret = smid;
 	}
 
+	pthread_mutex_unlock(&g_semlock);
+
 	return ret;
 }
 int semaphoreWait(unsigned int smid, unsigned long timeout)
@@ -109,7 +125,13 @@ int semaphoreClose(unsigned int smid)
 	if(smid >= MAXSEMNUMBER)
 		return -1;
 
+	pthread_mutex_lock(&g_semlock);
+
 	ret = sem_destroy(&(g_semlist[smid]));
+	if(ret == 0)
+		g_semused[smid] = false;
+
+	pthread_mutex_unlock(&g_semlock);
 
 	return ret;
 }
@@ -1216,7 +1216,7 @@ int SampleCases(void)
     return 0;
 }
 #endif
-extern int setDQAVlan(MSD_U8 devNum, MSD_U8 portNum, MSD_U8 vlanPort);
+extern int setDQAVlan(MSD_U8 devNum, MSD_U8 portNum_1[], MSD_U8 portNum_2[], int numPairs);
 extern int resetPortBasedVlan(MSD_U8 devNum);
 void resetPortBasedVlanCases(void)
 {
@@ -1245,7 +1245,10 @@ void CustomizedVlanCases(void)
         portNum_1[i] = (MSD_U8)strtoul(CMD_ARGS[i*2 + 2], NULL, 0);
         portNum_2[i] = (MSD_U8)strtoul(CMD_ARGS[i*2 + 3], NULL, 0);
         printf("portNum_1 = %X, portNum_2 = %X\n", portNum_1[i], portNum_2[i]);
-        if (setDQAVlan(sohoDevNum, portNum_1[i], portNum_2[i]) == 0)
+    }
+    if (setDQAVlan(sohoDevNum, portNum_1, portNum_2, (nargs - 2) / 2) == 0)
+    {
+        for (int i = 0; i < (nargs - 2) / 2; i++)
         {
             CLI_INFO("VLAN for DQAC bind \033[1;34m%d\033[0m \033[1;34m%d\033[0m done\n", portNum_1[i], portNum_2[i]);
         }
@@ -135,6 +135,17 @@ static void parse_file_free(CONF_LIST* conf_list)
     }
 }
 
+static void bus_conf_add_extra_dev(BUS_CONF_STRUCT* bus_conf, char* value)
+{
+    if (bus_conf->num_extra_dev >= MAX_EXTRA_DEV)
+    {
+        printf("Too many extra_dev, %d at most\n", MAX_EXTRA_DEV);
+        return;
+    }
+    bus_conf->extra_dev[bus_conf->num_extra_dev] = (MSD_U8)strtoul(value, NULL, 0);
+    bus_conf->num_extra_dev++;
+}
+
 
 int bus_conf_parse(char* filename, BUS_CONF_STRUCT* bus_conf)
 {
@@ -259,6 +270,10 @@ int bus_conf_parse(char* filename, BUS_CONF_STRUCT* bus_conf)
                 {
                     bus_conf->dev_num = (MSD_U8)strtoul(temp_sub->value, NULL, 0);
                 }
+                else if (strcmp(temp_sub->name, "extra_dev") == 0)
+                {
+                    bus_conf_add_extra_dev(bus_conf, temp_sub->value);
+                }
                 else if (strcmp(temp_sub->name, "smi_protocol") == 0)
                 {
                     if (strcmp(temp_sub->value, "XMDIO") == 0)
@@ -282,6 +297,10 @@ int bus_conf_parse(char* filename, BUS_CONF_STRUCT* bus_conf)
                 {
                     bus_conf->dev_num = (MSD_U8)strtoul(temp_sub->value, NULL, 0);
                 }
+                else if (strcmp(temp_sub->name, "extra_dev") == 0)
+                {
+                    bus_conf_add_extra_dev(bus_conf, temp_sub->value);
+                }
                 else if (strcmp(temp_sub->name, "rmu_mode") == 0)
                 {
                     if (strcmp(temp_sub->value, "DSA") == 0)
@@ -314,6 +333,10 @@ int bus_conf_parse(char* filename, BUS_CONF_STRUCT* bus_conf)
 				{
 					bus_conf->dev_num = (MSD_U8)strtoul(temp_sub->value, NULL, 0);
 				}
+				else if (strcmp(temp_sub->name, "extra_dev") == 0)
+				{
+					bus_conf_add_extra_dev(bus_conf, temp_sub->value);
+				}
 				else if (strcmp(temp_sub->name, "rmu_mode") == 0)
 				{
 					if (strcmp(temp_sub->value, "EtherType_DSA") == 0)
@@ -90,54 +90,87 @@ MSD_U32 checkPhyData(MSD_U8 *devNum, int *phyAddr)
 int resetPortBasedVlan(MSD_U8 devNum)
 {
     MSD_STATUS retVal;
-    MSD_U32 data;
     MSD_U32 mapDAdata = 0x2080;
+    MSD_U32 portVec[MSD_MAX_SWITCH_PORTS];
+    MSD_QD_DEV *dev = sohoDevGet(devNum);
+
+    if (dev == NULL)
+    {
+        return 1;
+    }
 
-    for (int port = 0; port <= 11; port++)
+    memset(portVec, 0, sizeof(portVec));
+    for (int port = 0; port < dev->numOfPorts; port++)
     {   
-        data = (port == 11) ? 0x7FF : (0x107FF - (1 << port));
         retVal = msdSetAnyExtendedReg(devNum, port, 0x08, mapDAdata);       
-        retVal = msdSetAnyExtendedReg(devNum, port, 0x06, data);
+        portVec[port] = dev->validPortVec & ~(1U << port);
+    }
+
+    //Every port reaches every other port, only the VLAN tables that differ are written
+    retVal = msdPortBasedVlanMatrixSet(devNum, portVec, MSD_FALSE, NULL);
+    if (retVal != MSD_OK)
+    {
+        printf("Reset Port Based Vlan Fail\n");
+        return 1;
     }
     printf("Reset Port Based Vlan Success\n");
     return 0;
 }
 
-int setDQAVlan(MSD_U8 devNum, MSD_U8 portNum_1, MSD_U8 portNum_2)
+static void setDQAAutoNeg(MSD_U8 devNum, MSD_U8 portNum)
+{
+    MSD_U32 data;
+
+    //Auto-Negotiation 1 setting 
+    data = (portNum == 8) ? 0xa007 : 0xa007 + (portNum << 5);
+    msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x200);
+    msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
+    data = (portNum == 8) ? 0xa407 : 0xa407 + (portNum << 5);
+    msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x1000);  // If 1000BT1 is using set 0x1000, if 100BT1 is using set 0x0
+    msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
+}
+
+int setDQAVlan(MSD_U8 devNum, MSD_U8 portNum_1[], MSD_U8 portNum_2[], int numPairs)
 {
     MSD_STATUS retVal;
-    MSD_U8 devAddr;
     MSD_U8 regAddr = 0x0008;
     MSD_U32 data;
+    MSD_U32 portVec[MSD_MAX_SWITCH_PORTS];
+    MSD_U32 numWrites = 0;
 
-    //MapDA disable
-    data = 0x2000;
-    retVal = msdSetAnyExtendedReg(devNum, portNum_1, regAddr, data);
-    retVal = msdSetAnyExtendedReg(devNum, portNum_2, regAddr, data);
-    
-    //A pair of ports bind with VLAN
-    regAddr = 0x0006;
-    data = (portNum_2 == 11) ? 1 << 16 : 1 << portNum_2;
-    retVal = msdSetAnyExtendedReg(devNum, portNum_1, regAddr, data);
+    //Start from the current VLAN tables, one read of every port
+    retVal = msdPortBasedVlanMatrixGet(devNum, portVec);
+    if (retVal != MSD_OK)
+    {
+        return 1;
+    }
 
-    data = (portNum_1 == 11) ? 1 << 16 : 1 << portNum_1;;
-    retVal = msdSetAnyExtendedReg(devNum, portNum_2, regAddr, data);
+    for (int i = 0; i < numPairs; i++)
+    {
+        if (portNum_1[i] >= MSD_MAX_SWITCH_PORTS || portNum_2[i] >= MSD_MAX_SWITCH_PORTS)
+        {
+            return 1;
+        }
 
-    //Auto-Negotiation 1 setting 
-    data = (portNum_1 == 8) ? 0xa007 : 0xa007 + (portNum_1 << 5);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x200);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
-    data = (portNum_1 == 8) ? 0xa407 : 0xa407 + (portNum_1 << 5);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x1000);  // If 1000BT1 is using set 0x1000, if 100BT1 is using set 0x0
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
-    
-    //Auto-Negotiation 1 setting 
-    data = (portNum_2 == 8) ? 0xa007 : 0xa007 + (portNum_2 << 5);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x200);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
-    data = (portNum_2 == 8) ? 0xa407 : 0xa407 + (portNum_2 << 5);
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x19, 0x1000);  // If 1000BT1 is using set 0x1000, if 100BT1 is using set 0x0
-    retVal = msdSetAnyExtendedReg(devNum, 0x1c, 0x18, data);
+        //MapDA disable
+        data = 0x2000;
+        retVal = msdSetAnyExtendedReg(devNum, portNum_1[i], regAddr, data);
+        retVal = msdSetAnyExtendedReg(devNum, portNum_2[i], regAddr, data);
+
+        //A pair of ports bind with VLAN
+        portVec[portNum_1[i]] = 1U << portNum_2[i];
+        portVec[portNum_2[i]] = 1U << portNum_1[i];
+
+        setDQAAutoNeg(devNum, portNum_1[i]);
+        setDQAAutoNeg(devNum, portNum_2[i]);
+    }
+
+    //Write the changed VLAN tables of all pairs at once
+    retVal = msdPortBasedVlanMatrixSet(devNum, portVec, MSD_TRUE, &numWrites);
+    if (retVal != MSD_OK)
+    {
+        return 1;
+    }
 
     return 0;
 }
@@ -13,9 +13,20 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#endif
 #include "Wrapper.h"
 #include "msdApi.h"
 #include "rmuPcap.h"
+#include "qdInit.h"
  
 #define MSG_PRINT printf
 
@@ -37,6 +48,21 @@ MSD_U8 gXMDIOFlag = 0;
 MSD_U8 gFWRmuFlag = 0;
 MSD_U16 gFakeDevice = 0;
 
+/*
+ * All devices are reached through the one USB2SMI adapter or the one RMU NIC.
+ * Every bus transaction holds qdBusLock, so devices loaded by parallel threads
+ * (qdInitMulti) or served by an async worker do not interleave on the wire.
+ */
+#ifdef WIN32
+static SRWLOCK qdBusLock = SRWLOCK_INIT;
+#define qdBusTake()	AcquireSRWLockExclusive(&qdBusLock)
+#define qdBusGive()	ReleaseSRWLockExclusive(&qdBusLock)
+#else
+static pthread_mutex_t qdBusLock = PTHREAD_MUTEX_INITIALIZER;
+#define qdBusTake()	pthread_mutex_lock(&qdBusLock)
+#define qdBusGive()	pthread_mutex_unlock(&qdBusLock)
+#endif
+
 static MSD_STATUS SMIRead(MSD_U8 devNum, MSD_U8 phyAddr,
                MSD_U8 miiReg, MSD_U16* value)
 {
@@ -48,6 +74,7 @@ static MSD_STATUS SMIRead(MSD_U8 devNum, MSD_U8 phyAddr,
         return MSD_OK;
     }
 
+	qdBusTake();
 	if (gXMDIOFlag == 0)
 	{
 		ret = readRegister(phyAddr, miiReg);
@@ -57,6 +84,7 @@ static MSD_STATUS SMIRead(MSD_U8 devNum, MSD_U8 phyAddr,
 		/*For Amethyst, access register through C45 is supported, and devAddr been fixed as 3, and register has one 0x8000 offset*/
 		ret = readC45Register(phyAddr, 3, miiReg | 0x8000);
 	}
+	qdBusGive();
 	*value = (MSD_U16)ret;
 	if(ret < 0)
 		return MSD_FAIL;
@@ -74,6 +102,7 @@ static MSD_STATUS SMIWrite(MSD_U8 devNum, MSD_U8 phyAddr,
 		return MSD_OK;
 	}
 
+	qdBusTake();
 	if (gXMDIOFlag == 0)
 	{
 		ret = writeRegister(phyAddr, miiReg, value);
@@ -83,6 +112,7 @@ static MSD_STATUS SMIWrite(MSD_U8 devNum, MSD_U8 phyAddr,
 		/*For Amethyst, access register through C45 is supported, and devAddr been fixed as 3, and register has one 0x8000 offset*/
 		ret = writeC45Register(phyAddr, 3, miiReg | 0x8000, value);
 	}
+	qdBusGive();
 
 	if(ret < 0)
 		return MSD_FAIL;
@@ -90,15 +120,32 @@ static MSD_STATUS SMIWrite(MSD_U8 devNum, MSD_U8 phyAddr,
 		return MSD_OK;
 }
 
+/* request and response of one RMU frame are one bus transaction */
+static MSD_STATUS RMUTxRx(MSD_U8 *req_pkt, MSD_U32 req_pkt_len,
+					MSD_U8 **rsp_pkt, MSD_U32 *rsp_pkt_len)
+{
+	int ret;
+
+	qdBusTake();
+	ret = send_and_receive_packet(req_pkt, req_pkt_len, rsp_pkt, rsp_pkt_len);
+	qdBusGive();
+
+	return (MSD_STATUS)ret;
+}
+
 #ifdef USE_SEMAPHORE
 static MSD_SEM osSemCreate(MSD_SEM_BEGIN_STATE state)
 {
-	MSD_SEM pSem;
+	int pSem;
 	int count = (int)state;
 
 	pSem = semaphoreCreate(count);
 
-	return pSem;
+	/* the driver takes 0 as a failed create */
+	if (pSem < 0)
+		return 0;
+
+	return (MSD_SEM)pSem;
 }
 static MSD_STATUS osSemDelete(MSD_SEM smid)
 {
@@ -135,35 +182,63 @@ static MSD_STATUS osSemSignal(MSD_SEM smid)
 }
 #endif
 
-/* Register function to BSP */
-MSD_STATUS qdStart(MSD_U8 devNum, MSD_U8 baseAddr, MSD_U32 phyAddr, MSD_U32 cpuPort, MSD_32 bus_interface, MSD_U16 tempDeviceId)
+static MSD_STATUS osHostTime(MSD_U64 *nanoSec)
 {
-	MSD_STATUS status = MSD_FAIL;
-	MSD_SYS_CONFIG   cfg;
+#ifdef WIN32
+	LARGE_INTEGER count, freq;
+
+	if (!QueryPerformanceCounter(&count) || !QueryPerformanceFrequency(&freq))
+		return MSD_FAIL;
+
+	*nanoSec = (MSD_U64)(count.QuadPart / freq.QuadPart) * 1000000000ULL +
+		(MSD_U64)(count.QuadPart % freq.QuadPart) * 1000000000ULL / (MSD_U64)freq.QuadPart;
+#else
+	struct timespec ts;
 
-	memset((char*)&cfg,0,sizeof(MSD_SYS_CONFIG));
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return MSD_FAIL;
 
-	cfg.BSPFunctions.rmu_tx_rx = send_and_receive_packet;
-	cfg.BSPFunctions.readMii   = SMIRead;
-	cfg.BSPFunctions.writeMii  = SMIWrite;
-    cfg.InterfaceChannel = (MSD_INTERFACE)bus_interface;
+	*nanoSec = (MSD_U64)ts.tv_sec * 1000000000ULL + (MSD_U64)ts.tv_nsec;
+#endif
+	return MSD_OK;
+}
+
+/* Fill a system config with the host BSP functions */
+void qdConfigInit(MSD_SYS_CONFIG *cfg, MSD_U8 devNum, MSD_U8 baseAddr, MSD_32 bus_interface, MSD_U16 tempDeviceId)
+{
+	memset((char*)cfg,0,sizeof(MSD_SYS_CONFIG));
+
+	cfg->BSPFunctions.rmu_tx_rx = RMUTxRx;
+	cfg->BSPFunctions.readMii   = SMIRead;
+	cfg->BSPFunctions.writeMii  = SMIWrite;
+    cfg->InterfaceChannel = (MSD_INTERFACE)bus_interface;
 #ifdef USE_SEMAPHORE
-	cfg.BSPFunctions.semCreate = osSemCreate;
-	cfg.BSPFunctions.semDelete = osSemDelete;
-	cfg.BSPFunctions.semTake   = osSemWait;
-	cfg.BSPFunctions.semGive   = osSemSignal;
+	cfg->BSPFunctions.semCreate = osSemCreate;
+	cfg->BSPFunctions.semDelete = osSemDelete;
+	cfg->BSPFunctions.semTake   = osSemWait;
+	cfg->BSPFunctions.semGive   = osSemSignal;
 #else
-	cfg.BSPFunctions.semCreate = NULL;
-	cfg.BSPFunctions.semDelete = NULL;
-	cfg.BSPFunctions.semTake   = NULL;
-	cfg.BSPFunctions.semGive   = NULL;
+	cfg->BSPFunctions.semCreate = NULL;
+	cfg->BSPFunctions.semDelete = NULL;
+	cfg->BSPFunctions.semTake   = NULL;
+	cfg->BSPFunctions.semGive   = NULL;
 #endif
+	cfg->BSPFunctions.getHostTime = osHostTime;
+
+	cfg->devNum = devNum;
+	cfg->baseAddr = baseAddr;
+    cfg->rmuMode = gRmuMode;
+    cfg->eTypeValue = gEtherTypeValue;
+	cfg->tempDeviceId = tempDeviceId;
+}
 
-	cfg.devNum = devNum;
-	cfg.baseAddr = baseAddr;
-    cfg.rmuMode = gRmuMode;
-    cfg.eTypeValue = gEtherTypeValue;
-	cfg.tempDeviceId = tempDeviceId;
+/* Register function to BSP */
+MSD_STATUS qdStart(MSD_U8 devNum, MSD_U8 baseAddr, MSD_U32 phyAddr, MSD_U32 cpuPort, MSD_32 bus_interface, MSD_U16 tempDeviceId)
+{
+	MSD_STATUS status = MSD_FAIL;
+	MSD_SYS_CONFIG   cfg;
+
+	qdConfigInit(&cfg, devNum, baseAddr, bus_interface, tempDeviceId);
 
 	if((status = msdLoadDriver(&cfg)) != MSD_OK)
 	{
@@ -175,8 +250,14 @@ MSD_STATUS qdStart(MSD_U8 devNum, MSD_U8 baseAddr, MSD_U32 phyAddr, MSD_U32 cpuP
 
 void qdClose() 
 {
-	if (sohoDevGet(sohoDevNum))
-		msdUnLoadDriver(sohoDevNum);
+	MSD_U8 devNum;
+
+	qdAsyncStop(sohoDevNum);
+	for (devNum = 0; devNum < MAX_SOHO_DEVICES; devNum++)
+	{
+		if (sohoDevGet(devNum))
+			msdUnLoadDriver(devNum);
+	}
 }
 
 /* 
@@ -206,6 +287,306 @@ MSD_STATUS qdInit(int baseAddr, int bus_interface, MSD_U16 tempDeviceId)
 	return MSD_OK;
 }
 
+/* Devices of one bus, loaded one after another by qdLoadBus */
+typedef struct
+{
+	MSD_U32         first;       /* first device of the bus */
+	MSD_U32         numDevs;
+	MSD_SYS_CONFIG  *cfgList;
+	const MSD_U32   *busId;
+	MSD_STATUS      *statusList;
+	MSD_U64         *loadTimeNs;
+} QD_LOAD_BUS;
+
+#ifdef WIN32
+static DWORD WINAPI qdLoadBus(LPVOID arg)
+#else
+static void *qdLoadBus(void *arg)
+#endif
+{
+	QD_LOAD_BUS *bus = (QD_LOAD_BUS *)arg;
+	MSD_U64 start, end;
+	MSD_U32 i;
+
+	for (i = bus->first; i < bus->numDevs; i++)
+	{
+		if (bus->busId[i] != bus->busId[bus->first])
+			continue;
+
+		osHostTime(&start);
+		bus->statusList[i] = msdLoadDriver(&bus->cfgList[i]);
+		osHostTime(&end);
+		bus->loadTimeNs[i] = end - start;
+	}
+
+#ifdef WIN32
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+/*
+ *	Load several devices. Devices with the same busId share an SMI bus or RMU
+ *	channel and are probed and loaded one after another; every bus is loaded
+ *	by its own thread. cfgList[i] is normally filled by qdConfigInit.
+ *	statusList[i] and loadTimeNs[i] return the load status and time of device i.
+*/
+MSD_STATUS qdInitMulti(MSD_U32 numDevs, MSD_SYS_CONFIG *cfgList, const MSD_U32 *busId,
+					   MSD_STATUS *statusList, MSD_U64 *loadTimeNs)
+{
+	QD_LOAD_BUS	bus[MAX_SOHO_DEVICES];
+#ifdef WIN32
+	HANDLE		thread[MAX_SOHO_DEVICES];
+#else
+	pthread_t	thread[MAX_SOHO_DEVICES];
+#endif
+	MSD_BOOL	started[MAX_SOHO_DEVICES];
+	MSD_SEM		loadSem = 0;
+	MSD_U32		i, j, numBus = 0;
+	MSD_STATUS	status = MSD_OK;
+
+	if ((numDevs == 0) || (numDevs > MAX_SOHO_DEVICES) || (cfgList == NULL) ||
+		(busId == NULL) || (statusList == NULL) || (loadTimeNs == NULL))
+		return MSD_BAD_PARAM;
+
+	/* one semaphore guards the driver state shared by the loads, deleted when
+	   all loads are done */
+	if ((cfgList[0].BSPFunctions.semCreate != NULL) && (cfgList[0].BSPFunctions.semTake != NULL) &&
+		(cfgList[0].BSPFunctions.semGive != NULL))
+		loadSem = cfgList[0].BSPFunctions.semCreate(MSD_SEM_FULL);
+
+	for (i = 0; i < numDevs; i++)
+	{
+		cfgList[i].loadSem = loadSem;
+		statusList[i] = MSD_FAIL;
+		loadTimeNs[i] = 0;
+
+		for (j = 0; j < i; j++)
+		{
+			if (busId[j] == busId[i])
+				break;
+		}
+		if (j < i)
+			continue;
+
+		bus[numBus].first = i;
+		bus[numBus].numDevs = numDevs;
+		bus[numBus].cfgList = cfgList;
+		bus[numBus].busId = busId;
+		bus[numBus].statusList = statusList;
+		bus[numBus].loadTimeNs = loadTimeNs;
+		numBus++;
+	}
+
+	/* without the semaphore the buses are loaded one after another */
+	for (i = 0; i < numBus; i++)
+	{
+		started[i] = MSD_FALSE;
+		if (loadSem == 0)
+		{
+			qdLoadBus(&bus[i]);
+			continue;
+		}
+#ifdef WIN32
+		thread[i] = CreateThread(NULL, 0, qdLoadBus, &bus[i], 0, NULL);
+		started[i] = (thread[i] != NULL) ? MSD_TRUE : MSD_FALSE;
+#else
+		started[i] = (pthread_create(&thread[i], NULL, qdLoadBus, &bus[i]) == 0) ? MSD_TRUE : MSD_FALSE;
+#endif
+		if (started[i] == MSD_FALSE)
+			qdLoadBus(&bus[i]);
+	}
+
+	for (i = 0; i < numBus; i++)
+	{
+		if (started[i] == MSD_FALSE)
+			continue;
+#ifdef WIN32
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+#else
+		pthread_join(thread[i], NULL);
+#endif
+	}
+
+	/* loaded devices keep cfg->loadSem for msdUnLoadDriver, the later unloads
+	   are not run in parallel */
+	if (loadSem != 0)
+	{
+		for (i = 0; i < numDevs; i++)
+		{
+			MSD_QD_DEV *dev = sohoDevGet(cfgList[i].devNum);
+
+			if ((dev != NULL) && (dev->loadSem == loadSem))
+				dev->loadSem = 0;
+			cfgList[i].loadSem = 0;
+		}
+		if (cfgList[0].BSPFunctions.semDelete != NULL)
+			cfgList[0].BSPFunctions.semDelete(loadSem);
+	}
+
+	for (i = 0; i < numDevs; i++)
+	{
+		MSG_PRINT("devNum %d addr 0x%x bus %u: %s, load time %llu us\n",
+			(int)cfgList[i].devNum, (unsigned int)cfgList[i].baseAddr, (unsigned int)busId[i],
+			(statusList[i] == MSD_OK) ? "loaded" : "failed",
+			(unsigned long long)(loadTimeNs[i] / 1000ULL));
+		if (statusList[i] != MSD_OK)
+			status = MSD_FAIL;
+	}
+
+	return status;
+}
+
+/*
+ *	Load the devices of the bus config file: devList[0] is the device given by
+ *	dev_num/dev_addr, the others come from extra_dev. The devNum of a device is
+ *	its address. All of them are reached through the one USB2SMI adapter or
+ *	RMU NIC, so they are loaded as one bus, one after another.
+*/
+MSD_STATUS qdInitDevList(int baseAddr, int bus_interface, const MSD_U8 *devList, MSD_U32 numDevs)
+{
+	MSD_SYS_CONFIG	cfgList[MAX_SOHO_DEVICES];
+	MSD_U32			busId[MAX_SOHO_DEVICES];
+	MSD_STATUS		statusList[MAX_SOHO_DEVICES];
+	MSD_U64			loadTimeNs[MAX_SOHO_DEVICES];
+	MSD_U32			i;
+	MSD_STATUS		status;
+
+	if ((devList == NULL) || (numDevs == 0) || (numDevs > MAX_SOHO_DEVICES))
+		return MSD_BAD_PARAM;
+
+	for (i = 0; i < numDevs; i++)
+	{
+		qdConfigInit(&cfgList[i], devList[i], (i == 0) ? (MSD_U8)baseAddr : devList[i], bus_interface, 0);
+		busId[i] = 0;
+	}
+
+	status = qdInitMulti(numDevs, cfgList, busId, statusList, loadTimeNs);
+
+	qddev = sohoDevGet(sohoDevNum);
+	if (qddev == NULL)
+		return MSD_FAIL;
+
+	return status;
+}
+
+#ifndef WIN32
+/* Host side of the asynchronous queue of a device, see qdAsyncStart */
+typedef struct
+{
+	MSD_ASYNC_QUEUE queue;
+	pthread_t       thread;
+	int             eventFd;
+} QD_ASYNC;
+
+static QD_ASYNC *qdAsync[MAX_SOHO_DEVICES];
+
+/* Called by the worker after a batch, wakes the poller of the eventfd */
+static void qdAsyncNotify(MSD_U8 devNum, void *arg)
+{
+	uint64_t one = 1;
+	QD_ASYNC *async = (QD_ASYNC *)arg;
+
+	(void)devNum;
+	if (write(async->eventFd, &one, sizeof(one)) != (ssize_t)sizeof(one))
+		MSG_PRINT("async eventfd write failed\n");
+}
+
+static void *qdAsyncWorker(void *arg)
+{
+	msdAsyncWorkerRun((MSD_U8)(size_t)arg);
+	return NULL;
+}
+#endif
+
+/*
+ *	Attach an asynchronous queue to a loaded device and start its worker thread.
+ *	*eventFd returns a non-blocking eventfd that becomes readable when
+ *	completions are queued; add it to an epoll set, read it to clear it and
+ *	collect the completions with msdAsyncCompletionGet. Operations are
+ *	submitted with msdAsyncSubmit. Needs the semaphore functions of the BSP.
+*/
+MSD_STATUS qdAsyncStart(MSD_U8 devNum, int *eventFd)
+{
+#ifdef WIN32
+	(void)devNum;
+	(void)eventFd;
+	return MSD_NOT_SUPPORTED;
+#else
+	QD_ASYNC *async;
+	MSD_STATUS status;
+
+	if ((devNum >= MAX_SOHO_DEVICES) || (eventFd == NULL))
+		return MSD_BAD_PARAM;
+	if (qdAsync[devNum] != NULL)
+		return MSD_ALREADY_EXIST;
+
+	async = (QD_ASYNC *)calloc(1, sizeof(QD_ASYNC));
+	if (async == NULL)
+		return MSD_FAIL;
+
+	async->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (async->eventFd < 0)
+	{
+		free(async);
+		return MSD_FAIL;
+	}
+
+	status = msdAsyncQueueInit(devNum, &async->queue, qdAsyncNotify, async);
+	if (status != MSD_OK)
+	{
+		close(async->eventFd);
+		free(async);
+		return status;
+	}
+
+	if (pthread_create(&async->thread, NULL, qdAsyncWorker, (void *)(size_t)devNum) != 0)
+	{
+		msdAsyncQueueDestroy(devNum);
+		close(async->eventFd);
+		free(async);
+		return MSD_FAIL;
+	}
+
+	qdAsync[devNum] = async;
+	*eventFd = async->eventFd;
+	return MSD_OK;
+#endif
+}
+
+/*
+ *	Stop the worker started by qdAsyncStart after it ran the submitted operations,
+ *	then detach the queue and close the eventfd. Call it before msdUnLoadDriver.
+*/
+MSD_STATUS qdAsyncStop(MSD_U8 devNum)
+{
+#ifdef WIN32
+	(void)devNum;
+	return MSD_NOT_SUPPORTED;
+#else
+	QD_ASYNC *async;
+	MSD_STATUS status;
+
+	if ((devNum >= MAX_SOHO_DEVICES) || (qdAsync[devNum] == NULL))
+		return MSD_NO_SUCH;
+	async = qdAsync[devNum];
+
+	if ((status = msdAsyncWorkerStop(devNum)) != MSD_OK)
+		return status;
+	pthread_join(async->thread, NULL);
+
+	if ((status = msdAsyncQueueDestroy(devNum)) != MSD_OK)
+		return status;
+
+	close(async->eventFd);
+	free(async);
+	qdAsync[devNum] = NULL;
+	return MSD_OK;
+#endif
+}
+
 void clean_stdin(void)
 {
 	int c;
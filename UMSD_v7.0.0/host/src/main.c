@@ -5,6 +5,7 @@
 #include "msdApi.h"
 #include "rmuPcap.h"
 #include "bus_conf.h"
+#include "qdInit.h"
 #ifdef WIN32
 #include <Winsock2.h>  
 #include <Iptypes.h>  
@@ -32,12 +33,14 @@ extern MSD_U8 sohoDevNum;
 extern MSD_U16 gFakeDevice;
 extern unsigned short g_telnet_port;
 
+/* devices of the bus config file, dev_num/dev_addr first and then extra_dev */
+static MSD_U8 devList[MAX_SOHO_DEVICES];
+static MSD_U32 numDevList = 1;
+
 
 /****************************************************************************/
 /* Function Declaration                                                     */
 /****************************************************************************/
-MSD_STATUS qdInit(int baseAddr, int bus_interface, MSD_U16 tempDeviceId);
-void qdClose();
 void clean_stdin(void);
 void apiCLI(void);
 int cliCommand();
@@ -168,6 +171,12 @@ static int openBusWithCfgFile(char *filename, int *bus_interface, MSD_U32 *baseA
         return 0;
 
     sohoDevNum = bus_conf.dev_num;
+    devList[0] = bus_conf.dev_num;
+    for (index = 0; index < bus_conf.num_extra_dev; index++)
+    {
+        devList[index + 1] = bus_conf.extra_dev[index];
+    }
+    numDevList = (MSD_U32)bus_conf.num_extra_dev + 1;
     *bus_interface = (int)(bus_conf.bus_interface);
     *baseAddr = bus_conf.dev_num;
     gRmuMode = bus_conf.rmu.rmu_mode;
@@ -656,7 +665,21 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	if (qdInit(baseAddr, bus_interface, inputDeviceId) != 0)
+	if (numDevList > 1)
+	{
+		/* the extra devices are only loaded from the config file, without
+		   the prompt for an unprogrammed device below */
+		if (qdInitDevList(baseAddr, bus_interface, devList, numDevList) != MSD_OK)
+		{
+			printf("QD Load Failed For Some Devices\n");
+			if (qddev == NULL)
+			{
+				qdClose();
+				return 1;
+			}
+		}
+	}
+	else if (qdInit(baseAddr, bus_interface, inputDeviceId) != 0)
 	{
         int command = 0;
 		printf("QD Load Failed For Unkown Device\n\n");
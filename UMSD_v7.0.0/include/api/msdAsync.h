@@ -0,0 +1,255 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/*******************************************************************************
+* msdAsync.h
+*
+* DESCRIPTION:
+*       API definitions for the asynchronous submission and completion queue.
+*       Callers submit MIB reads, ATU dump chunks, TCAM writes and PTP time
+*       stamp reads to a per-device queue without blocking. A worker runs
+*       them in batches and queues completions, then calls a notify
+*       function, so an event loop can wait on a file descriptor instead of
+*       the device.
+*
+* DEPENDENCIES:
+*       msdBrgFdb, msdPortRmon, msdTCAM, msdPTP
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef msdAsync_h
+#define msdAsync_h
+
+#include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* msdAsyncQueueInit
+*
+* DESCRIPTION:
+*       This function attaches a submission and completion queue to a device.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       queue     - queue memory, owned by the caller until msdAsyncQueueDestroy
+*       notify    - called by the worker after it queued completions, may be NULL
+*       notifyArg - argument of notify
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a queue already
+*
+* COMMENTS:
+*       notify runs in the worker thread and should only wake the consumer,
+*       for example by writing an eventfd. msdUnLoadDriver fails while a
+*       queue is attached.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncQueueInit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_ASYNC_QUEUE  *queue,
+    IN  MSD_ASYNC_NOTIFY  notify,
+    IN  void  *notifyArg
+);
+
+/*******************************************************************************
+* msdAsyncQueueDestroy
+*
+* DESCRIPTION:
+*       This function detaches the queue of a device. Operations not run yet
+*       and completions not returned yet are dropped.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BUSY  - if a batch is being run
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       A thread in msdAsyncWorkerRun must be stopped with msdAsyncWorkerStop
+*       and joined first.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncQueueDestroy
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdAsyncSubmit
+*
+* DESCRIPTION:
+*       This function queues operations and wakes the worker. It does not
+*       access the device.
+*
+* INPUTS:
+*       devNum - physical device number
+*       numOps - number of operations in ops
+*       ops    - operation descriptors, copied into the queue
+*
+* OUTPUTS:
+*       numSubmitted - operations queued, the first numSubmitted of ops
+*
+* RETURNS:
+*       MSD_OK  - on success, also when only some operations fit
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if an operation is invalid, nothing is queued
+*       MSD_BUSY  - if no operation fits, completions must be collected first
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       The queue holds MSD_ASYNC_QUEUE_DEPTH operations, counting both the
+*       operations not completed yet and the completions not collected yet.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncSubmit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  numOps,
+    IN  const MSD_ASYNC_OP  *ops,
+    OUT MSD_U32  *numSubmitted
+);
+
+/*******************************************************************************
+* msdAsyncProcess
+*
+* DESCRIPTION:
+*       This function runs the queued operations as one batch, queues their
+*       completions and calls the notify function once. Reads with the same
+*       parameters in a batch access the device once, and of several TCAM
+*       writes of one entry only the last is written.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       numCompleted - operations completed, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success, the status of each operation is in its completion
+*       MSD_FAIL  - on error
+*       MSD_BUSY  - if another thread is running a batch
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       msdAsyncWorkerRun calls this function. A single threaded caller may
+*       call it directly, for example when its event loop is idle.
+*       Operations submitted while a batch runs go into the next batch.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncProcess
+(
+    IN  MSD_U8  devNum,
+    OUT MSD_U32  *numCompleted
+);
+
+/*******************************************************************************
+* msdAsyncWorkerRun
+*
+* DESCRIPTION:
+*       This function is the body of a worker thread. It waits for submitted
+*       operations and runs them with msdAsyncProcess until msdAsyncWorkerStop
+*       is called. Operations submitted before the stop are run first.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - when stopped
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no queue
+*       MSD_NOT_SUPPORTED - if the BSP has no semaphore functions
+*
+* COMMENTS:
+*       Only one worker per device. The thread itself is created by the
+*       caller, the driver has no thread functions.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncWorkerRun
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdAsyncWorkerStop
+*
+* DESCRIPTION:
+*       This function asks msdAsyncWorkerRun to return once the submitted
+*       operations are run. It does not wait for the worker.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no queue
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncWorkerStop
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdAsyncCompletionGet
+*
+* DESCRIPTION:
+*       This function returns completions in submission order. It does not
+*       wait and does not access the device.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       maxComps - number of entries in comps
+*
+* OUTPUTS:
+*       comps    - completions
+*       numComps - completions returned, 0 if none is ready
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - if the device has no queue
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncCompletionGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  maxComps,
+    OUT MSD_ASYNC_COMPLETION  *comps,
+    OUT MSD_U32  *numComps
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __msdAsync_h */
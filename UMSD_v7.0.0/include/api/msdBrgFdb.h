@@ -1121,6 +1121,83 @@ MSD_STATUS msdFdbEntryNextGet
 	OUT MSD_ATU_ENTRY  *entry
 );
 
+/*******************************************************************************
+* msdFdbOccupancyGet
+*
+* DESCRIPTION:
+*       Reads the learn count and learn limit of every port, the number of valid
+*       and non-static entries in the ATU, and the same two counts for each FID
+*       in fidList in one sweep. The result can be kept by the caller as the
+*       cache of msdFdbOccupancyCachedGet.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       numFids - number of FIDs in fidList, up to MSD_FDB_OCCUPANCY_MAX_FIDS
+*       fidList - FIDs to count, may be NULL if numFids is 0
+*
+* OUTPUTS:
+*       occupancy - counts and limits of this sweep, generation 1
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Devices without a sweep of their own are read with the per port and
+*       per FID functions; ports that have no learn limit are left out of
+*       portVec. The counts are not atomic, entries learned or aged during
+*       the sweep may or may not be counted.
+*
+*******************************************************************************/
+MSD_STATUS msdFdbOccupancyGet
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32  numFids,
+	IN  const MSD_U32  *fidList,
+	OUT MSD_FDB_OCCUPANCY  *occupancy
+);
+
+/*******************************************************************************
+* msdFdbOccupancyCachedGet
+*
+* DESCRIPTION:
+*       Returns a cached occupancy of the device, for callers that poll more
+*       often than the ATU should be swept. The cache is owned by the caller
+*       and refreshed, with the FIDs of the cached sweep, if it is older than
+*       maxAgeNs.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       maxAgeNs - oldest cached sweep to return, in ns; 0 never sweeps
+*       cache    - last sweep, from msdFdbOccupancyGet or an earlier call, or
+*                  zeroed if no sweep was taken yet
+*
+* OUTPUTS:
+*       cache - counts and limits no older than maxAgeNs
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - if maxAgeNs is 0 and no sweep was taken yet
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       The age is taken from the getHostTime function of the BSP; without
+*       it every call with a non-zero maxAgeNs sweeps. Fill the cache with
+*       msdFdbOccupancyGet to choose the FIDs, a first sweep made here counts
+*       no FID. The cache is left unchanged if the sweep fails.
+*
+*******************************************************************************/
+MSD_STATUS msdFdbOccupancyCachedGet
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U64  maxAgeNs,
+	INOUT MSD_FDB_OCCUPANCY  *cache
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -146,6 +146,80 @@ MSD_STATUS msdEEPROMChipSelGet
 	OUT  MSD_U8		*chipSelect
 );
 
+/*******************************************************************************
+* msdEEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a contiguous range of EEPROM data. The
+*       per-byte command/busy/data sequences are issued back to back under a
+*       single lock, and are packed into multi-register frames when the device
+*       is accessed over RMU.
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address to read
+*      count     - number of EEPROM addresses to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, count entries
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdEEPROMReadBlock
+(
+	IN  MSD_U8		devNum,
+	IN  MSD_U16		startAddr,
+	IN  MSD_U16		count,
+	OUT MSD_U16		*data
+);
+
+/*******************************************************************************
+* msdEEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a contiguous range of EEPROM data. The
+*       per-byte command/busy sequences are issued back to back under a single
+*       lock, and are packed into multi-register frames when the device is
+*       accessed over RMU. Optionally the range is read back and its CRC-16 is
+*       compared against the CRC-16 of the written data.
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address to write
+*      count     - number of EEPROM addresses to write
+*      data      - data to be written, count entries
+*      verify    - MSD_TRUE to read back and verify the written range
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error, or if the verify pass found a CRC mismatch
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdEEPROMWriteBlock
+(
+	IN  MSD_U8		devNum,
+	IN  MSD_U16		startAddr,
+	IN  MSD_U16		count,
+	IN  MSD_U16		*data,
+	IN  MSD_BOOL	verify
+);
+
 #ifdef __cplusplus
 }
 #endif
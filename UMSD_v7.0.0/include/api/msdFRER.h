@@ -902,6 +902,201 @@ MSD_STATUS msdFrerBank1SCtrReadClear
 	OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
 	);
 
+/******************************************************************************
+* msdFrerSnapshotAttach
+*
+* DESCRIPTION:
+*        This routine attaches a snapshot cache to the device. The snapshot
+*        APIs below keep their data in it, so only devices that use them
+*        need the memory.
+*
+* INPUTS:
+*        devNum - physical device number
+*        cache  - cache memory, owned by the caller until msdFrerSnapshotDetach
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_ALREADY_EXIST - if the device has a cache already
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        msdUnLoadDriver detaches the cache.
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotAttach
+(
+IN  MSD_U8	devNum,
+IN  MSD_FRER_SNAPSHOT_CACHE	*cache
+);
+
+/******************************************************************************
+* msdFrerSnapshotDetach
+*
+* DESCRIPTION:
+*        This routine detaches the snapshot cache of the device, waiting for
+*        a refresh in progress.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if the device has no cache
+*
+* COMMENTS:
+*        Readers of the cache must be done before it is detached.
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotDetach
+(
+IN  MSD_U8	devNum
+);
+
+/******************************************************************************
+* msdFrerSnapshotRefresh
+*
+* DESCRIPTION:
+*        This routine captures all sequence recovery and individual recovery
+*        instances and both stream counter banks in one pass under the FRER
+*        register lock, and stores them in the snapshot cache of the device.
+*        The pass fills the cache snapshot readers do not use, which is then
+*        swapped in, so readers never wait for the device.
+*        The counters of every valid stream counter instance are read and
+*        cleared on the device and added to 64 bits totals kept in the cache,
+*        so consumers read the totals instead of calling the ReadClear APIs.
+*
+* INPUTS:
+*        devNum     - physical device number
+*
+* OUTPUTS:
+*        generation - generation of the new snapshot, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        Totals are reset when an instance disappears or its enable, port or
+*        index changes. Counts cleared by the ReadClear APIs are not included.
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotRefresh
+(
+IN  MSD_U8	devNum,
+OUT MSD_U32	*generation
+);
+
+/******************************************************************************
+* msdFrerSnapshotGet
+*
+* DESCRIPTION:
+*        This routine copies the snapshot cache of the device, as left by the
+*        last msdFrerSnapshotRefresh. No device register is accessed.
+*
+* INPUTS:
+*        devNum   - physical device number
+*
+* OUTPUTS:
+*        snapshot - cached snapshot, generation is 0 if none was taken yet
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotGet
+(
+IN  MSD_U8	devNum,
+OUT MSD_FRER_SNAPSHOT	*snapshot
+);
+
+/******************************************************************************
+* msdFrerSnapshotIterStart
+*
+* DESCRIPTION:
+*        This routine starts a walk over the valid instances of the cached
+*        snapshot, see msdFrerSnapshotGetNext.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        iter   - iterator positioned before the first instance
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached or no snapshot was
+*                      taken yet
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotIterStart
+(
+IN  MSD_U8	devNum,
+OUT MSD_FRER_SNAPSHOT_ITER	*iter
+);
+
+/******************************************************************************
+* msdFrerSnapshotGetNext
+*
+* DESCRIPTION:
+*        This routine returns the next valid instance of the cached snapshot.
+*        Sequence recovery instances come first, then individual recovery
+*        instances, bank 0 and bank 1 stream counters, each in identifier
+*        order. No device register is accessed, so any number of consumers
+*        may walk the same snapshot.
+*
+* INPUTS:
+*        devNum - physical device number
+*        iter   - iterator set up by msdFrerSnapshotIterStart
+*
+* OUTPUTS:
+*        iter   - iterator advanced past the returned instance
+*        entry  - instance data
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if there are no more instances or no snapshot cache
+*                      is attached
+*        MSD_BUSY    - if the snapshot was refreshed since the walk started,
+*                      restart it with msdFrerSnapshotIterStart
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotGetNext
+(
+IN    MSD_U8	devNum,
+INOUT MSD_FRER_SNAPSHOT_ITER	*iter,
+OUT   MSD_FRER_SNAPSHOT_ENTRY	*entry
+);
+
 
 
 
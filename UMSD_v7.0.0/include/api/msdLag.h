@@ -0,0 +1,182 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/*******************************************************************************
+* msdLag.h
+*
+* DESCRIPTION:
+*       API definitions for the LAG manager. The trunk mask table, trunk
+*       routing table and per port LAG settings of a device are computed
+*       from the LAG membership and link state, and only the entries that
+*       differ from the last committed configuration are programmed.
+*
+* DEPENDENCIES:
+*       msdTrunk
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef msdLag_h
+#define msdLag_h
+
+#include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* msdLagCompute
+*
+* DESCRIPTION:
+*       This function computes the complete trunk configuration for a set of
+*       LAGs without accessing the device.
+*       Each of the MSD_LAG_MASK_NUM trunk masks enables exactly one link up
+*       member of every LAG. Masks are first spread over all members in port
+*       order; masks whose member is link down are handed to the link up
+*       member currently holding the fewest masks. A member failure therefore
+*       only moves the masks of the failed port, and the result is balanced
+*       to within one mask.
+*       The trunk route of every LAG holds its link up members.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       groups    - LAG membership, one entry per LAG
+*       numGroups - number of entries in groups
+*       linkUpVec - logical port vector of the ports whose link is up
+*
+* OUTPUTS:
+*       config - computed trunk configuration, hashTrunk is set to MSD_TRUE
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, such as a trunk ID
+*                       used twice or a port in more than one LAG
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagCompute
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_GROUP  *groups,
+    IN  MSD_U32  numGroups,
+    IN  MSD_U32  linkUpVec,
+    OUT MSD_LAG_CONFIG  *config
+);
+
+/*******************************************************************************
+* msdLagCommit
+*
+* DESCRIPTION:
+*       This function programs a trunk configuration, writing only the trunk
+*       masks, hash setting, trunk routes and port LAG settings that differ
+*       from the configuration committed last. The first commit after the
+*       driver is loaded, or after msdLagInvalidate, writes every entry.
+*       Entries are written in the order trunk masks, hash setting, trunk
+*       routes, port LAG settings, so that traffic leaves a failed member
+*       with the first writes.
+*
+* INPUTS:
+*       devNum - physical device number
+*       config - trunk configuration, normally produced by msdLagCompute
+*
+* OUTPUTS:
+*       numWrites - number of table entries written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Address database entries learnt on a LAG member carry the trunk ID
+*       rather than the port, so they stay valid across a member failover
+*       and no FDB flush is needed.
+*       Calls for the same device must be serialized by the caller.
+*
+*******************************************************************************/
+MSD_STATUS msdLagCommit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_CONFIG  *config,
+    OUT MSD_U32  *numWrites
+);
+
+/*******************************************************************************
+* msdLagUpdate
+*
+* DESCRIPTION:
+*       This function computes the trunk configuration for the given LAG
+*       membership and link state and commits the entries that changed.
+*       It is the failover path: call it with the new link state whenever
+*       a LAG member goes up or down.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       groups    - LAG membership, one entry per LAG
+*       numGroups - number of entries in groups
+*       linkUpVec - logical port vector of the ports whose link is up
+*
+* OUTPUTS:
+*       numWrites - number of table entries written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       See msdLagCompute and msdLagCommit.
+*
+*******************************************************************************/
+MSD_STATUS msdLagUpdate
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_GROUP  *groups,
+    IN  MSD_U32  numGroups,
+    IN  MSD_U32  linkUpVec,
+    OUT MSD_U32  *numWrites
+);
+
+/*******************************************************************************
+* msdLagInvalidate
+*
+* DESCRIPTION:
+*       This function drops the configuration remembered by msdLagCommit, so
+*       that the next commit rewrites every entry. Call it after the trunk
+*       tables were changed through other APIs or the device was reset.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagInvalidate
+(
+    IN  MSD_U8  devNum
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __msdLag_h */
@@ -1129,6 +1129,142 @@ MSD_STATUS msdMacSecGetNextTxSCIntStatus
 	OUT MSD_MACSEC_INT_TXSC* txscInt
 );
 
+/******************************************************************************
+* DESCRIPTION:
+*       This function pre-stages the next SA set of a number of TX secure
+*       channels, so that a later msdMacSecRekeySwitch only has to write
+*       one TX SC entry per channel.
+*       For every channel the new RX SA is created and installed in the RX
+*       SC slot that does not hold the previous association number, so the
+*       receiver accepts both the current and the new key. The new TX SA is
+*       created with its key, and the TX SC entry using it is prepared in
+*       the driver without being written.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       numSC   - number of entries in scIndex and stage
+*       scIndex - TX SC index of every channel
+*       stage   - next SA set of every channel
+*       pnThr   - TX PN threshold to program, 0 to keep the current one
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if input parameters are beyond range.
+*       MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*       Staging a channel again replaces its staged entry. The TX SA given
+*       must not be the SA currently in use by the channel.
+******************************************************************************/
+MSD_STATUS msdMacSecRekeyStage
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U8  numSC,
+	IN  MSD_U8  *scIndex,
+	IN  MSD_MACSEC_REKEY_SA *stage,
+	IN  MSD_U32 pnThr
+);
+/******************************************************************************
+* DESCRIPTION:
+*       This function switches the given TX secure channels to their staged
+*       SA, writing the prepared TX SC entry of every channel back to back.
+*
+* INPUTS:
+*       devNum - physical device number
+*       scVec  - vector of the TX SC indexes to switch
+*
+* OUTPUTS:
+*       result - channels switched and the time all their entry writes took,
+*                may be NULL
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if a channel in scVec has no staged entry.
+*       MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*       Latency is measured with the PTP global time, read once before and
+*       once after the writes, and is 0 when the device has none. Writing the TX SC entry clears its interrupt enables,
+*       as msdMacSecCreateTxSC does.
+******************************************************************************/
+MSD_STATUS msdMacSecRekeySwitch
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32 scVec,
+	OUT MSD_MACSEC_REKEY_RESULT *result
+);
+/******************************************************************************
+* DESCRIPTION:
+*       This function collects the pending TX SC interrupts and switches
+*       every staged channel whose PN threshold was reached, clearing the
+*       interrupt status of the switched channels only.
+*       It is meant to be called from the MACSec interrupt handler or a
+*       polling task.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       result - channels switched with their switch latency, may be NULL
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*       Only channels staged with pnThrTrigger set raise the interrupt.
+*       Pending interrupts of other channels are left for their own handler.
+******************************************************************************/
+MSD_STATUS msdMacSecRekeyService
+(
+	IN  MSD_U8  devNum,
+	OUT MSD_MACSEC_REKEY_RESULT *result
+);
+/******************************************************************************
+* DESCRIPTION:
+*       This function reads the SecY and SC counters of every counter index
+*       in counterVec in one pass, and accumulates the change since the
+*       previous snapshot into 64-bit totals.
+*       The counters are captured without clearing them, so other readers of
+*       the counters are not disturbed. 32-bit counters are taken modulo 2^32,
+*       which keeps the totals right across a counter wrap as long as
+*       snapshots are taken at least once per wrap period.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       counterVec - vector of the counter indexes to read
+*       ctx        - statistics context, zeroed before the first snapshot
+*
+* OUTPUTS:
+*       ctx   - raw counter values and updated totals
+*       delta - change of every counter since the previous snapshot, may be
+*               NULL. The first snapshot of an index reports the counter
+*               value itself.
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if input parameters are beyond range.
+*       MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*       Counters read with auto clear through msdMacSecGetRXSecYStates and
+*       the like make the next delta of those indexes wrong.
+******************************************************************************/
+MSD_STATUS msdMacSecStatsSnapshot
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32 counterVec,
+	INOUT MSD_MACSEC_STATS_CTX *ctx,
+	OUT MSD_MACSEC_STATS *delta
+);
+
 
 #ifdef __cplusplus
 }
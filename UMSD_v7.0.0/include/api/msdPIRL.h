@@ -196,6 +196,42 @@ MSD_STATUS msdIRLResourceWrite
     IN  MSD_PIRL_DATA  *pirlData
 );
 
+/*******************************************************************************
+* msdIRLResourceBulkWrite
+*
+* DESCRIPTION:
+*       This function writes the same resource bucket parameter to every
+*       selected resource of every selected port, for example a policer
+*       profile computed once with msdIRLCustomSetup.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       portVec  - logical port vector of the target ports
+*       resVec   - resource vector, bit n selects resource unit n
+*       pirlData - IRL Resource data
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Resources are written port by port in ascending order. On error the
+*       resources before the failing one keep the new data.
+*
+*******************************************************************************/
+MSD_STATUS msdIRLResourceBulkWrite
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  portVec,
+    IN  MSD_U32  resVec,
+    IN  MSD_PIRL_DATA  *pirlData
+);
+
 /*******************************************************************************
 * msdIRLResRegGet
 *
@@ -303,6 +303,100 @@ MSD_STATUS msdPtpTimeStampReset
     IN  MSD_PTP_TIME    timeToReset
 );
 
+/*******************************************************************************
+* msdPtpTimeStampHarvest
+*
+* DESCRIPTION:
+*       This routine collects the valid time stamps of a set of ports in one
+*       sweep, clears them on the device in the same sequence and appends
+*       them to a time stamp queue. With RMU the sweep is done in two frames,
+*       one reading all status words and one fetching and clearing the valid
+*       time stamps. Call it from the interrupt or polling task in place of
+*       msdPtpTimeStampGet and msdPtpTimeStampReset.
+*
+* INPUTS:
+*       portVec   - logical port vector of the ports to sweep
+*       timeMask  - bit n set to sweep MSD_PTP_TIME n (Arr0, Arr1, Dep, Dep1)
+*       queue     - time stamp queue, set up by msdPtpTsQueueInit
+*
+* OUTPUTS:
+*       numHarvested - number of time stamps appended to queue, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       This routine is the only producer of queue, calls for the same queue
+*       must not overlap. Time stamps that do not fit in the queue are counted
+*       in queue->dropped.
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTimeStampHarvest
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_U32    portVec,
+    IN  MSD_U8    timeMask,
+    INOUT MSD_PTP_TS_QUEUE    *queue,
+    OUT MSD_U32    *numHarvested
+);
+
+/*******************************************************************************
+* msdPtpTsQueueInit
+*
+* DESCRIPTION:
+*       This routine empties a time stamp queue.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       queue - empty time stamp queue
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Call it before the producer and consumer start.
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTsQueueInit
+(
+    OUT MSD_PTP_TS_QUEUE    *queue
+);
+
+/*******************************************************************************
+* msdPtpTsQueuePop
+*
+* DESCRIPTION:
+*       This routine takes the oldest time stamp from a time stamp queue. It
+*       does not access the device and takes no lock, so a consumer task can
+*       run it while msdPtpTimeStampHarvest fills the queue.
+*
+* INPUTS:
+*       queue - time stamp queue
+*
+* OUTPUTS:
+*       event - oldest time stamp
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_NO_SUCH - if the queue is empty
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       There must be a single consumer per queue.
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTsQueuePop
+(
+    INOUT MSD_PTP_TS_QUEUE    *queue,
+    OUT MSD_PTP_TS_EVENT    *event
+);
+
 /*******************************************************************************
 * msdPtpGlobalConfigSet
 *
@@ -933,6 +1027,42 @@ MSD_STATUS msdGetPTPGlobalTime
     OUT MSD_U32 *ptpTime
 );
 
+/*******************************************************************************
+* msdPtpGlobalTimeSampleGet
+*
+* DESCRIPTION:
+*       This routine reads the PTP global time bracketed by host monotonic time
+*       stamps, for correlating the switch clock with the host clock.
+*       The PTP register lock is taken before the first host time stamp, and
+*       only the shortest access sequence is inside the bracket. The read is
+*       repeated numReads times and the read with the narrowest bracket is
+*       returned.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       numReads - number of reads, 1 to MSD_PTP_TIME_SAMPLE_MAX
+*
+* OUTPUTS:
+*       sample   - PTP global time, host time of the capture and its uncertainty
+*
+* RETURNS:
+*       MSD_OK - On success
+*       MSD_FAIL - On error
+*       MSD_BAD_PARAM - If invalid parameter is given
+*       MSD_NOT_SUPPORTED - Device not support, or no getHostTime function
+*                           was registered in MSD_BSP_FUNCTIONS
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdPtpGlobalTimeSampleGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32 numReads,
+    OUT MSD_PTP_TIME_SAMPLE *sample
+);
+
 /*******************************************************************************
 * msdPtpPortRegGet
 *
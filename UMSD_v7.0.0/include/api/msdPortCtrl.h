@@ -2680,6 +2680,77 @@ MSD_STATUS msdPortBasedVlanMapSet
     IN  MSD_U8  memPortsLen
 );
 
+/*******************************************************************************
+* msdPortBasedVlanMatrixGet
+*
+* DESCRIPTION:
+*       this routine gets the port based vlan table of every port as a port
+*       isolation matrix, and refreshes the copy used by
+*       msdPortBasedVlanMatrixSet.
+*
+* INPUTS:
+*       devNum  - physical device number
+*
+* OUTPUTS:
+*       portVec - array of MSD_MAX_SWITCH_PORTS entries, entry i is the port
+*                 vector port i is allowed to send frames to. Entries of
+*                 ports that do not exist are set to 0.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdPortBasedVlanMatrixGet
+(
+    IN  MSD_U8  devNum,
+    OUT MSD_U32  *portVec
+);
+
+/*******************************************************************************
+* msdPortBasedVlanMatrixSet
+*
+* DESCRIPTION:
+*       this routine sets the port based vlan table of every port from a port
+*       isolation matrix. The matrix is compared with the current tables and
+*       only the ports whose table changes are written.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       portVec   - array of MSD_MAX_SWITCH_PORTS entries, entry i is the port
+*                   vector port i is allowed to send frames to. Entries of
+*                   ports that do not exist are ignored.
+*       useShadow - MSD_TRUE to compare with the tables last read or written
+*                   by the matrix APIs, MSD_FALSE to read them from the device
+*                   first. The device is read anyway if no such copy exists.
+*
+* OUTPUTS:
+*       numWrites - number of port tables written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*		Tables changed by msdPortBasedVlanMapSet are tracked. Use
+*		useShadow = MSD_FALSE after writing the registers by other means.
+*
+*******************************************************************************/
+MSD_STATUS msdPortBasedVlanMatrixSet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  *portVec,
+    IN  MSD_BOOL  useShadow,
+    OUT MSD_U32  *numWrites
+);
+
 /*******************************************************************************
 * msdPortFrameModeGet
 *
@@ -0,0 +1,203 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/*******************************************************************************
+* msdQbvGcl.h
+*
+* DESCRIPTION:
+*       API definitions for the Qbv gate control list (GCL) manager. A time
+*       aware shaper schedule is validated and compiled into Qbv table
+*       images, and loaded into the Qbv tables. With a caller owned shadow
+*       attached only the entries that changed are written.
+*
+* DEPENDENCIES:
+*       msdSysCtrl, msdPTP
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef msdQbvGcl_h
+#define msdQbvGcl_h
+
+#include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* msdQbvGclCompile
+*
+* DESCRIPTION:
+*       This function checks a schedule against the limits of the Qbv table
+*       and entry encoding and encodes it into Qbv table images without
+*       accessing the device.
+*       A schedule is accepted if the cycle time is a whole number of PTP
+*       clock periods, every port lists 1 to MSD_QBV_GCL_MAX_ENTRIES
+*       entries, the Qbv table depth, every interval is a multiple of MSD_QBV_GCL_WINDOW_UNIT ns
+*       and fits a window time register, only the last interval is 0, and
+*       the intervals of a port add up to no more than the cycle time.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       schedule - cycle time, base time and gate control list per port
+*
+* OUTPUTS:
+*       image - Qbv table images and TAI trigger settings
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if the schedule cannot be encoded
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclCompile
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_SCHEDULE  *schedule,
+    OUT MSD_QBV_GCL_IMAGE  *image
+);
+
+/*******************************************************************************
+* msdQbvGclLoad
+*
+* DESCRIPTION:
+*       This function writes a compiled schedule into the Qbv table of each
+*       port of the image, then writes the TAI trigger generation amount and
+*       time if the cycle time or base time changed. With a shadow attached
+*       (msdQbvGclShadowAttach) only the table entries that differ from what
+*       the API last wrote are written; without one, right after attaching,
+*       or after msdQbvGclInvalidate every entry and the TAI trigger are
+*       written.
+*
+* INPUTS:
+*       devNum - physical device number
+*       image  - Qbv table images produced by msdQbvGclCompile
+*
+* OUTPUTS:
+*       numWrites - number of Qbv register writes, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       The update is not hitless. The device has no second table to switch
+*       to, the entries are written to the table the port runs, so a port
+*       runs a mix of the old and the new list while it is loaded. The
+*       cycle time and base time are written last, so a new base time in
+*       the future starts the new cycle on the complete new lists.
+*       Calls for the same device must be serialized by the caller.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclLoad
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_GCL_IMAGE  *image,
+    OUT MSD_U32  *numWrites
+);
+
+/*******************************************************************************
+* msdQbvGclInvalidate
+*
+* DESCRIPTION:
+*       This function drops the table images remembered in the attached
+*       shadow, so that the next load rewrites every entry and the TAI
+*       trigger. Call it after the Qbv tables were changed through
+*       msdQbvWrite or the device was reset.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Does nothing if no shadow is attached.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclInvalidate
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdQbvGclShadowAttach
+*
+* DESCRIPTION:
+*       This function attaches a gate control list shadow to the device, so
+*       that msdQbvGclLoad only writes what changed. The shadow starts empty.
+*
+* INPUTS:
+*       devNum - physical device number
+*       shadow - shadow memory, owned by the caller until msdQbvGclShadowDetach
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a shadow already
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Calls for the same device must be serialized with msdQbvGclLoad by
+*       the caller.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclShadowAttach
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_GCL_SHADOW  *shadow
+);
+
+/*******************************************************************************
+* msdQbvGclShadowDetach
+*
+* DESCRIPTION:
+*       This function detaches the gate control list shadow of the device.
+*       msdQbvGclLoad then writes every entry again.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclShadowDetach
+(
+    IN  MSD_U8  devNum
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __msdQbvGcl_h */
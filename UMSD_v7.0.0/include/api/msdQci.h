@@ -335,6 +335,42 @@ MSD_STATUS msdFlowMeterFiltedCounterGet
 	OUT MSD_U16* counter
 );
 
+/******************************************************************************
+* msdPsfpStatsSnapshot
+*
+* DESCRIPTION:
+*        This routine reads the matching, stream filter filtered, stream gate
+*        filtered and flow meter filtered frames counters of a set of stream
+*        filters in one locked pass and accumulates their change into 64 bits
+*        totals.
+*
+* INPUTS:
+*        devNum    - physical device number
+*        filterVec - vector of the stream filter instances to read
+*        ctx       - statistics context, zeroed before the first snapshot
+*
+* OUTPUTS:
+*        ctx       - counters and PTP global time of this snapshot in raw,
+*                    updated totals in total, indexed by MSD_PSFP_CNT
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The hardware counters are 16 bits wide and are not cleared. A stream
+*        filter must be read before its counters wrap more than once.
+*
+******************************************************************************/
+MSD_STATUS msdPsfpStatsSnapshot
+(
+IN  MSD_U8   devNum,
+IN  MSD_U32  filterVec,
+INOUT MSD_PSFP_STATS_CTX *ctx
+);
+
 /******************************************************************************
 * msdStreamGateFlushAll
 *
@@ -555,6 +591,113 @@ IN  MSD_U32  gateCycleTime,
 IN  MSD_U64  gateBaseTime
 );
 
+/******************************************************************************
+* msdStreamGateScheduleSet
+*
+* DESCRIPTION:
+*        This routine programs the complete schedule of a stream gate instance
+*        in one transaction: gate control entries, time generation identifier
+*        and time generation cycle and base time. With a stream gate shadow
+*        attached (msdStreamGateShadowAttach) only the entries and settings
+*        that differ from what this routine wrote last are programmed, else
+*        everything is programmed.
+*
+* INPUTS:
+*        devNum       - physical device number
+*        streamGateId - stream gate instance identifier
+*        schedule     - stream gate schedule
+*
+* OUTPUTS:
+*        checksum  - CRC-16/CCITT of the schedule as programmed by this
+*                    routine, over the 16 gate control entries (gate fields of
+*                    register 5, registers 6 and 7, low byte first), the time
+*                    generation identifier, cycle time and base time (low byte
+*                    first), may be NULL
+*        numWrites - number of gate control entries, gate settings and time
+*                    generation instances written, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The time generation instance is written last, so the new gate control
+*        list starts at the new base time. Stream gate flush and the single
+*        entry APIs make the next call rewrite the affected parts.
+*        The checksum is computed from the schedule as written, it is not
+*        read back and does not detect a wrong hardware load.
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateScheduleSet
+(
+IN  MSD_U8   devNum,
+IN  MSD_U8   streamGateId,
+IN  MSD_STREAM_GATE_SCHEDULE *schedule,
+OUT MSD_U16  *checksum,
+OUT MSD_U32  *numWrites
+);
+
+/******************************************************************************
+* msdStreamGateShadowAttach
+*
+* DESCRIPTION:
+*        This routine attaches a stream gate shadow to the device. With a
+*        shadow msdStreamGateScheduleSet only writes what changed.
+*
+* INPUTS:
+*        devNum - physical device number
+*        shadow - shadow memory, owned by the caller until
+*                 msdStreamGateShadowDetach
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_ALREADY_EXIST - if the device has a shadow already
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The shadow starts empty, so the first schedule of every stream gate
+*        is written in full.
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateShadowAttach
+(
+IN  MSD_U8   devNum,
+IN  MSD_QCI_GATE_SHADOW *shadow
+);
+
+/******************************************************************************
+* msdStreamGateShadowDetach
+*
+* DESCRIPTION:
+*        This routine detaches the stream gate shadow of the device.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateShadowDetach
+(
+IN  MSD_U8   devNum
+);
+
 /******************************************************************************
 * msdFlowMeterFlushAll
 *
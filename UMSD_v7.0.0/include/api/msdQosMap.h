@@ -255,6 +255,171 @@ MSD_STATUS msdQosPortCosToDscpMappingGet
     OUT MSD_U8     *dscp
 );
 /*******************************************************************************
+* msdQosPortPrioMapTableSet
+*
+* DESCRIPTION:
+*       This API sets all entries of one port IEEE Priority Mapping table.
+*       With a QoS map shadow attached (msdQosMapShadowAttach), entries whose
+*       copy holds the requested value are skipped.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portNum		- the logical port number
+*       table		- Frame Priority Table set, see msdQosPortPrioMapSet
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortPrioMapTableSet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_LPORT portNum,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+);
+/*******************************************************************************
+* msdQosPortPrioMapTableGet
+*
+* DESCRIPTION:
+*       This API gets all entries of one port IEEE Priority Mapping table.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portNum		- the logical port number
+*       table		- Frame Priority Table set, see msdQosPortPrioMapGet
+*
+* OUTPUTS:
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortPrioMapTableGet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_LPORT portNum,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    OUT MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+);
+/*******************************************************************************
+* msdQosPortsPrioMapTableSet
+*
+* DESCRIPTION:
+*       This API sets the same IEEE Priority Mapping table on every port in a
+*       port vector. With a QoS map shadow attached (msdQosMapShadowAttach),
+*       entries whose copy holds the requested value are skipped.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portVec		- logical port vector, bit N set selects port N
+*       table		- Frame Priority Table set, see msdQosPortPrioMapSet
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortsPrioMapTableSet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_U32   portVec,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+);
+/*******************************************************************************
+* msdQosPortCosToQueueTableSet
+*
+* DESCRIPTION:
+*       Updates the COS to egress queue mapping of all cos values of a port.
+*       Entries already holding the requested queue are skipped.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       portNum - the logical port number
+*       queue   - MSD_IEEE_PRIORITY_TABLE_SIZE physical queues, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortCosToQueueTableSet
+(
+    IN  MSD_U8     devNum,
+    IN  MSD_LPORT  portNum,
+    IN  MSD_U8     *queue
+);
+/*******************************************************************************
+* msdQosPortCosToDscpTableSet
+*
+* DESCRIPTION:
+*       Updates the COS to DSCP mapping of all cos values of a port.
+*       Entries already holding the requested DSCP are skipped.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       portNum - the logical port number
+*       dscp    - MSD_IEEE_PRIORITY_TABLE_SIZE frame differentiated services
+*                 code points, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortCosToDscpTableSet
+(
+    IN  MSD_U8      devNum,
+    IN  MSD_LPORT   portNum,
+    IN  MSD_U8      *dscp
+);
+/*******************************************************************************
 * msdPortDefQPriSet
 *
 * DESCRIPTION:
@@ -554,6 +719,65 @@ MSD_STATUS msdQosPortRewriteDscp
     IN MSD_LPORT  portNum,
     IN MSD_BOOL   en
 );
+/*******************************************************************************
+* msdQosMapShadowAttach
+*
+* DESCRIPTION:
+*       This API attaches a QoS map shadow to the device. With a shadow the
+*       IEEE Priority Mapping table set APIs skip entries whose copy already
+*       holds the requested value.
+*
+* INPUTS:
+*       devNum - physical device number
+*       shadow - shadow memory, owned by the caller until msdQosMapShadowDetach
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a shadow already
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		The shadow starts empty. It only follows the QoS map APIs and snapshot
+*		restore; after a switch reset or raw register writes to the priority
+*		mapping tables detach it and attach it again to clear it.
+*
+*******************************************************************************/
+MSD_STATUS msdQosMapShadowAttach
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_QOS_MAP_SHADOW *shadow
+);
+/*******************************************************************************
+* msdQosMapShadowDetach
+*
+* DESCRIPTION:
+*       This API detaches the QoS map shadow of the device. The table set APIs
+*       write every entry again.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosMapShadowDetach
+(
+    IN  MSD_U8    devNum
+);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,208 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/*******************************************************************************
+* msdSnapshot.h
+*
+* DESCRIPTION:
+*       API definitions for binary configuration snapshots. A snapshot holds
+*       the global and port registers and the STU, VTU, static ATU, ingress
+*       TCAM, PIRL and QoS mapping tables of a device in a versioned binary
+*       format, see MSD_SNAPSHOT_HEADER. Restoring it writes only what
+*       differs from the device. Register captures can be compared to find
+*       configuration changes.
+*
+* DEPENDENCIES:
+*       msdBrgStu, msdBrgVtu, msdBrgFdb, msdTCAM, msdPIRL, msdQosMap, msdRMU
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef msdSnapshot_h
+#define msdSnapshot_h
+
+#include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* msdSnapshotRegCapture
+*
+* DESCRIPTION:
+*       This function reads all 32 registers of global 1, global 2 and every
+*       port, one block per SMI device address in this order. Each block is
+*       read with one RMU register dump frame when RMU is the interface.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       maxBlocks - number of entries in blocks, at least numOfPorts + 2
+*
+* OUTPUTS:
+*       blocks    - register blocks
+*       numBlocks - number of blocks read
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Registers are read as they are, including command and status
+*       registers of indirect tables.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRegCapture
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  maxBlocks,
+    OUT MSD_SNAPSHOT_REG_BLOCK  *blocks,
+    OUT MSD_U32  *numBlocks
+);
+
+/*******************************************************************************
+* msdSnapshotRegDiff
+*
+* DESCRIPTION:
+*       This function compares two register captures of msdSnapshotRegCapture
+*       and returns the registers whose value changed, in capture order.
+*       Blocks that did not change at all are skipped with a single compare.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       prevBlocks - previous capture
+*       curBlocks  - current capture
+*       numBlocks  - number of blocks in both captures
+*       configOnly - MSD_TRUE to compare only the configuration registers
+*                    restored by msdSnapshotRestore, ignoring status, counter
+*                    and indirect table registers that change on their own
+*       maxChanges - number of entries in changes, may be 0
+*
+* OUTPUTS:
+*       changes    - changed registers, may be NULL if maxChanges is 0
+*       numChanges - number of changed registers, only the first maxChanges
+*                    are stored in changes
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, or the captures do not
+*                       have the same device addresses
+*
+* COMMENTS:
+*       A watchdog keeps two capture arrays, captures into one and compares
+*       it with the other, then swaps them.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRegDiff
+(
+    IN  MSD_U8  devNum,
+    IN  const MSD_SNAPSHOT_REG_BLOCK  *prevBlocks,
+    IN  const MSD_SNAPSHOT_REG_BLOCK  *curBlocks,
+    IN  MSD_U32  numBlocks,
+    IN  MSD_BOOL  configOnly,
+    IN  MSD_U32  maxChanges,
+    OUT MSD_SNAPSHOT_REG_CHANGE  *changes,
+    OUT MSD_U32  *numChanges
+);
+
+/*******************************************************************************
+* msdSnapshotCapture
+*
+* DESCRIPTION:
+*       This function captures the selected sections of the device
+*       configuration into buf. The snapshot starts with an
+*       MSD_SNAPSHOT_HEADER followed by the records of every section.
+*       Sections the device does not support are left out of
+*       MSD_SNAPSHOT_HEADER.sectionVec.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       sectionVec - sections to capture, bit n for MSD_SNAPSHOT_SECTION_ID n,
+*                    MSD_SNAPSHOT_ALL_SECTIONS for all
+*       bufSize    - size of buf in bytes, may be 0
+*
+* OUTPUTS:
+*       buf          - snapshot, may be NULL if bufSize is 0
+*       snapshotSize - size of the snapshot in bytes, also set when buf is
+*                      too small
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, or buf is too small
+*
+* COMMENTS:
+*       Call with bufSize 0 to get the size needed; the tables are walked
+*       in both calls, leave some room for entries added in between.
+*       Only static ATU entries are captured. The ATU is walked in FID 0,
+*       the FIDs of the VTU entries and, with RMU, the FIDs found by an RMU
+*       ATU dump. VTU entries of VTU page 1 and egress TCAM entries are not
+*       captured.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotCapture
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  sectionVec,
+    IN  MSD_U32  bufSize,
+    OUT MSD_U8  *buf,
+    OUT MSD_U32  *snapshotSize
+);
+
+/*******************************************************************************
+* msdSnapshotRestore
+*
+* DESCRIPTION:
+*       This function programs a snapshot taken by msdSnapshotCapture into the
+*       device in one pass. Every table is walked once next to the snapshot
+*       records: entries that already match are left alone, differing and
+*       missing entries are written and entries the snapshot does not have
+*       are removed. Registers are restored last, see COMMENTS.
+*
+* INPUTS:
+*       devNum       - physical device number
+*       buf          - snapshot
+*       snapshotSize - size of buf in bytes
+*
+* OUTPUTS:
+*       stats - work done, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, such as a damaged
+*                       snapshot, another snapshot version or a snapshot of
+*                       another device ID or port count
+*       MSD_NOT_SUPPORTED - device does not support a captured section
+*
+* COMMENTS:
+*       Only configuration registers are restored: global 1 global control,
+*       ATU control, switch MAC and global control 2; global 2 interrupt
+*       masks and switch management; port physical control, port control 0
+*       to 3, port based VLAN map, default VID, egress rate, association
+*       vector, ATU control and override. Tables behind command and data
+*       registers are restored through their sections.
+*       Dynamic ATU entries are kept. Other configuration must not be
+*       changed while the restore runs.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRestore
+(
+    IN  MSD_U8  devNum,
+    IN  const MSD_U8  *buf,
+    IN  MSD_U32  snapshotSize,
+    OUT MSD_SNAPSHOT_RESTORE_STATS  *stats
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __msdSnapshot_h */
@@ -0,0 +1,241 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+/*******************************************************************************
+* msdTcamStats.h
+*
+* DESCRIPTION:
+*       API definitions for TCAM rule hit statistics. Rules are tagged for
+*       counting and share the four TCAM counters of every port, TCAMCounter0
+*       to TCAMCounter3. Pinned rules keep a counter and are counted exactly;
+*       the other rules take turns on the remaining counters and their hits
+*       are estimated from the intervals they were counted.
+*
+* DEPENDENCIES:
+*       msdTCAM, msdPortRmon
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#ifndef msdTcamStats_h
+#define msdTcamStats_h
+
+#include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* msdTcamStatsInit
+*
+* DESCRIPTION:
+*       This function starts TCAM rule statistics on a device. Rules tagged
+*       before are released and their TCAM counter increment is disabled.
+*       The statistics are kept in shadow, which stays owned by the caller
+*       and must not be freed before msdTcamStatsStop.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       portVec    - logical port vector of the ports whose TCAM counters are
+*                    summed, normally the ingress ports of the tagged rules
+*       dwellTicks - number of msdTcamStatsSample calls a rotating counter
+*                    stays with a rule, at least 1
+*       shadow     - caller memory for the statistics state
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsInit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  portVec,
+    IN  MSD_U32  dwellTicks,
+    IN  MSD_TCAM_STATS_SHADOW  *shadow
+);
+
+/*******************************************************************************
+* msdTcamStatsStop
+*
+* DESCRIPTION:
+*       This function stops TCAM rule statistics on a device. The TCAM counter
+*       increment of the tagged rules is disabled and the shadow given to
+*       msdTcamStatsInit is no longer used.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsStop
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdTcamStatsRuleAdd
+*
+* DESCRIPTION:
+*       This function tags a TCAM rule for counting. A pinned rule gets a TCAM
+*       counter at once and keeps it. Other rules get a counter right away if
+*       one is free, and otherwise at the next rotation.
+*       The rule's IncTcamCtr and tcamCtr action fields are owned by this API
+*       while the rule is tagged.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry holding the action of the rule, the last
+*                     entry of a rule that continues over several entries
+*       pinned      - MSD_TRUE to count the rule exactly
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, such as a full rule
+*                       table or no counter left for a pinned rule
+*       MSD_ALREADY_EXIST - the rule is already tagged
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       A pinned rule may take the counter of a rotating rule.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleAdd
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer,
+    IN  MSD_BOOL  pinned
+);
+
+/*******************************************************************************
+* msdTcamStatsRuleRemove
+*
+* DESCRIPTION:
+*       This function stops counting a TCAM rule and disables its TCAM counter
+*       increment.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry given to msdTcamStatsRuleAdd
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - the rule is not tagged
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleRemove
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer
+);
+
+/*******************************************************************************
+* msdTcamStatsSample
+*
+* DESCRIPTION:
+*       This function ends one sample interval. It reads the TCAM counters of
+*       the ports given to msdTcamStatsInit, credits the increments to the
+*       rules owning the counters, and every dwellTicks calls hands the
+*       counters not used by pinned rules to the next rotating rules.
+*       Call it on a fixed period; hit rates are per sample interval.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       Only TCAMCounter0 to TCAMCounter3 are read, one stats operation per
+*       counter and port, rather than the full MIB set.
+*       Frames hitting a rule while its action is rewritten on a rotation
+*       may be credited to the interval before or after.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsSample
+(
+    IN  MSD_U8  devNum
+);
+
+/*******************************************************************************
+* msdTcamStatsRuleGet
+*
+* DESCRIPTION:
+*       This function gets the hit statistics of a tagged TCAM rule. The hit
+*       rate per sample interval is estimatedHits divided by totalTicks.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry given to msdTcamStatsRuleAdd
+*
+* OUTPUTS:
+*       stats - hit statistics of the rule
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - the rule is not tagged
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       Does not access the device.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer,
+    OUT MSD_TCAM_RULE_STATS  *stats
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __msdTcamStats_h */
@@ -282,6 +282,57 @@ typedef struct
 	MSD_U16   fid;
 	MSD_ETHERADDR  macAddr;
 } MSD_ATU_INT_STATUS;
+
+#define MSD_FDB_OCCUPANCY_MAX_FIDS	64U	/* FIDs in one occupancy snapshot */
+
+/*
+*  typedef: struct MSD_FDB_FID_OCCUPANCY
+*
+*  Description: Address database occupancy of one FID
+*
+*  Fields:
+*      fid            - Forwarding Information Database Number
+*      count          - number of valid entries in the FID
+*      nonStaticCount - number of non-static entries in the FID
+*
+*/
+typedef struct
+{
+	MSD_U32 fid;
+	MSD_U32 count;
+	MSD_U32 nonStaticCount;
+} MSD_FDB_FID_OCCUPANCY;
+
+/*
+*  typedef: struct MSD_FDB_OCCUPANCY
+*
+*  Description: Address database occupancy of a device, see msdFdbOccupancyGet
+*
+*  Fields:
+*      generation     - 1 for a sweep of msdFdbOccupancyGet, incremented by every
+*                       sweep of msdFdbOccupancyCachedGet, 0 if no sweep was taken yet
+*      timestamp      - host time of the sweep in ns, 0 if the BSP has no getHostTime
+*      portVec        - ports in learnCount and learnLimit
+*      learnCount     - active unicast MAC addresses learned on each port
+*      learnLimit     - learn limit of each port, 0 if not limited
+*      count          - number of valid entries in the ATU
+*      nonStaticCount - number of non-static entries in the ATU
+*      numFids        - number of entries in fid
+*      fid            - occupancy of the requested FIDs, in request order
+*
+*/
+typedef struct
+{
+	MSD_U32 generation;
+	MSD_U64 timestamp;
+	MSD_U32 portVec;
+	MSD_U32 learnCount[MSD_MAX_SWITCH_PORTS];
+	MSD_U32 learnLimit[MSD_MAX_SWITCH_PORTS];
+	MSD_U32 count;
+	MSD_U32 nonStaticCount;
+	MSD_U32 numFids;
+	MSD_FDB_FID_OCCUPANCY fid[MSD_FDB_OCCUPANCY_MAX_FIDS];
+} MSD_FDB_OCCUPANCY;
 /****************************************************************************/
 /* Exported ATU Types			 			                                */
 /****************************************************************************/
@@ -1415,6 +1466,10 @@ typedef enum
 	MSD_IEEE_PRIORITY_TABLE_EG_AVB_FPRI_2_DSCP,			/* 0x7 */
 } MSD_IEEE_PRIORITY_TABLE_SET;
 
+/* Number of IEEE priority mapping tables per port and of entries in each table */
+#define MSD_IEEE_PRIORITY_TABLE_NUM		8U
+#define MSD_IEEE_PRIORITY_TABLE_SIZE	8U
+
 /*
 * Typedef: struct each table
 *
@@ -1517,10 +1572,181 @@ typedef union
 	MSD_IEEE_PRIORITY_TABLE_EG_YEL_FPRI_2_DSCP_STRUCT    egYelTblDscp;
 	MSD_IEEE_PRIORITY_TABLE_EG_AVB_FPRI_2_DSCP_STRUCT    egAvbTbldscp;
 } MSD_IEEE_PRIORITY_TABLE_STRUCT;
+
+/*
+* Typedef: struct MSD_QOS_MAP_SHADOW
+*
+* Description: Caller owned copy of the per port IEEE priority mapping tables,
+*              used by the table level QoS map APIs to skip entries that
+*              already hold the requested value, see msdQosMapShadowAttach
+*
+* Fields:
+*      entry - entry data as last written or read, indexed by [port][table][entry]
+*      valid - bitmap of the entries of [port][table] whose copy is current
+*/
+typedef struct
+{
+	MSD_U16 entry[MSD_MAX_SWITCH_PORTS][MSD_IEEE_PRIORITY_TABLE_NUM][MSD_IEEE_PRIORITY_TABLE_SIZE];
+	MSD_U8  valid[MSD_MAX_SWITCH_PORTS][MSD_IEEE_PRIORITY_TABLE_NUM];
+} MSD_QOS_MAP_SHADOW;
 /****************************************************************************/
 /* Exported Qos Map Types			 			                            */
 /****************************************************************************/
 
+/****************************************************************************/
+/* Exported LAG Types                                                       */
+/****************************************************************************/
+#define MSD_LAG_MASK_NUM		8U		/* number of trunk mask table entries */
+#define MSD_LAG_MAX_TRUNK_ID	32U		/* number of trunk routing table entries */
+
+/*
+* Typedef: struct MSD_LAG_GROUP
+*
+* Description: Membership of one link aggregation group
+*
+* Fields:
+*      trunkId   - trunk ID assigned to the member ports
+*      memberVec - logical port vector of the member ports
+*/
+typedef struct
+{
+	MSD_U32    trunkId;
+	MSD_U32    memberVec;
+} MSD_LAG_GROUP;
+
+/*
+* Typedef: struct MSD_LAG_CONFIG
+*
+* Description: Complete trunk configuration of a device as computed by
+*              msdLagCompute and programmed by msdLagCommit
+*
+* Fields:
+*      hashTrunk   - MSD_TRUE to select the trunk mask from the address hash,
+*                    MSD_FALSE to use the XOR of the lower 3 bits of DA and SA
+*      maskTable   - trunk mask table, one logical port vector per mask number
+*      routeVec    - bitmap of the trunk IDs whose routing entry is managed
+*      trunkRoute  - trunk routing table, logical port vector per trunk ID
+*      lagPortVec  - logical port vector of the ports that are LAG members
+*      portTrunkId - trunk ID of every port set in lagPortVec
+*/
+typedef struct
+{
+	MSD_BOOL   hashTrunk;
+	MSD_U32    maskTable[MSD_LAG_MASK_NUM];
+	MSD_U32    routeVec;
+	MSD_U32    trunkRoute[MSD_LAG_MAX_TRUNK_ID];
+	MSD_U32    lagPortVec;
+	MSD_U32    portTrunkId[MSD_MAX_SWITCH_PORTS];
+} MSD_LAG_CONFIG;
+
+/****************************************************************************/
+/* Exported Qbv Gate Control List Types                                     */
+/****************************************************************************/
+#define MSD_QBV_GCL_MAX_ENTRIES		16U		/* Qbv table entries per port, range of the 4 bit table pointer */
+#define MSD_QBV_GCL_WINDOW_UNIT		8U		/* window time unit in ns */
+#define MSD_QBV_GCL_MAX_WINDOW		0xFFFFU	/* largest window time in units */
+
+/*
+* Typedef: struct MSD_QBV_GCL_ENTRY
+*
+* Description: One gate control list entry
+*
+* Fields:
+*      gateStates - bit n set opens the gate of egress queue n
+*      interval   - time the gate states are held, in ns. 0 is only allowed
+*                   for the last entry and holds the states to the end of
+*                   the cycle
+*/
+typedef struct
+{
+	MSD_U8     gateStates;
+	MSD_U32    interval;
+} MSD_QBV_GCL_ENTRY;
+
+/*
+* Typedef: struct MSD_QBV_GCL_PORT
+*
+* Description: Gate control list of one egress port
+*
+* Fields:
+*      numEntries - number of valid entries in entry
+*      entry      - gate control list, executed in order from the start
+*                   of every cycle. All gates are closed after the last
+*                   entry until the cycle ends
+*/
+typedef struct
+{
+	MSD_U32           numEntries;
+	MSD_QBV_GCL_ENTRY entry[MSD_QBV_GCL_MAX_ENTRIES];
+} MSD_QBV_GCL_PORT;
+
+/*
+* Typedef: struct MSD_QBV_SCHEDULE
+*
+* Description: Time aware shaper schedule of a device
+*
+* Fields:
+*      cycleTime - cycle time in ns, shared by all ports
+*      baseTime  - PTP global time at which the first cycle starts
+*      portVec   - logical port vector of the ports whose list is given
+*      port      - gate control list of every port set in portVec
+*/
+typedef struct
+{
+	MSD_U32          cycleTime;
+	MSD_U32          baseTime;
+	MSD_U32          portVec;
+	MSD_QBV_GCL_PORT port[MSD_MAX_SWITCH_PORTS];
+} MSD_QBV_SCHEDULE;
+
+/*
+* Typedef: struct MSD_QBV_GCL_IMAGE
+*
+* Description: Register image of a schedule as produced by msdQbvGclCompile
+*
+* Fields:
+*      cycleTicks - cycle time in PTP clock periods (TAI TrigGenAmt)
+*      baseTime   - PTP global time at which the first cycle starts
+*                   (TAI TrigGenTime)
+*      portVec    - logical port vector of the ports whose list is given
+*      gates      - gate states of every table entry
+*      window     - window time of every table entry, in units of
+*                   MSD_QBV_GCL_WINDOW_UNIT ns
+*/
+typedef struct
+{
+	MSD_U32    cycleTicks;
+	MSD_U32    baseTime;
+	MSD_U32    portVec;
+	MSD_U8     gates[MSD_MAX_SWITCH_PORTS][MSD_QBV_GCL_MAX_ENTRIES];
+	MSD_U16    window[MSD_MAX_SWITCH_PORTS][MSD_QBV_GCL_MAX_ENTRIES];
+} MSD_QBV_GCL_IMAGE;
+
+/*
+* Typedef: struct MSD_QBV_GCL_SHADOW
+*
+* Description: Caller owned copy of the Qbv table entries and TAI trigger
+*              settings as last written by msdQbvGclLoad, see
+*              msdQbvGclShadowAttach
+*
+* Fields:
+*      validVec   - ports whose entries below match the device
+*      timeValid  - MSD_TRUE once cycleTicks and baseTime match the device
+*      cycleTicks - TAI trigger generation amount
+*      baseTime   - TAI trigger generation time
+*      gates      - gate states of every table entry
+*      window     - window time of every table entry
+*/
+typedef struct
+{
+	MSD_U32    validVec;
+	MSD_BOOL   timeValid;
+	MSD_U32    cycleTicks;
+	MSD_U32    baseTime;
+	MSD_U8     gates[MSD_MAX_SWITCH_PORTS][MSD_QBV_GCL_MAX_ENTRIES];
+	MSD_U16    window[MSD_MAX_SWITCH_PORTS][MSD_QBV_GCL_MAX_ENTRIES];
+} MSD_QBV_GCL_SHADOW;
+
 /****************************************************************************/
 /* Exported MIBS Types			 			                                */
 /****************************************************************************/
@@ -2365,6 +2591,87 @@ typedef struct {
 
 }  MSD_TCAM_DATA;
 
+#define MSD_TCAM_STATS_MAX_RULES	32U		/* rules tagged for counting per device */
+#define MSD_TCAM_STATS_COUNTER_NUM	4U		/* TCAM counters per port, TCAMCounter0 to 3 */
+
+/*
+* Typedef: struct MSD_TCAM_RULE_STATS
+*
+* Description: Hit statistics of a TCAM rule tagged for counting
+*
+* Fields:
+*      tcamPointer   - TCAM entry holding the action of the rule
+*      pinned        - MSD_TRUE if the rule owns a TCAM counter permanently
+*      hits          - hits counted while the rule owned a TCAM counter
+*      observedTicks - sample intervals during which the rule owned a counter
+*      totalTicks    - sample intervals since the rule was tagged
+*      estimatedHits - hits scaled from the observed to all sample intervals,
+*                      equal to hits when observedTicks equals totalTicks
+*/
+typedef struct
+{
+	MSD_U32    tcamPointer;
+	MSD_BOOL   pinned;
+	MSD_U64    hits;
+	MSD_U32    observedTicks;
+	MSD_U32    totalTicks;
+	MSD_U64    estimatedHits;
+} MSD_TCAM_RULE_STATS;
+
+/*
+* Typedef: struct MSD_TCAM_STATS_RULE
+*
+* Description: Counting state of one TCAM rule tagged by msdTcamStatsRuleAdd
+*
+* Fields:
+*      tcamPointer   - TCAM entry holding the action of the rule
+*      pinned        - MSD_TRUE if the rule keeps its counter
+*      counter       - TCAM counter owned by the rule, MSD_TCAM_STATS_NO_COUNTER if none
+*      hits          - hits counted while the rule owned a counter
+*      observedTicks - sample intervals during which the rule owned a counter
+*      totalTicks    - sample intervals since the rule was tagged
+*/
+typedef struct
+{
+	MSD_U32    tcamPointer;
+	MSD_BOOL   pinned;
+	MSD_U8     counter;
+	MSD_U64    hits;
+	MSD_U32    observedTicks;
+	MSD_U32    totalTicks;
+} MSD_TCAM_STATS_RULE;
+
+#define MSD_TCAM_STATS_NO_COUNTER	0xFFU
+
+/*
+* Typedef: struct MSD_TCAM_STATS_SHADOW
+*
+* Description: TCAM counter allocation of the TCAM statistics API, owned by
+*              the caller of msdTcamStatsInit until msdTcamStatsStop
+*
+* Fields:
+*      portVec    - ports whose TCAM counters are summed
+*      dwellTicks - sample intervals between two counter rotations
+*      tickCount  - sample intervals since msdTcamStatsInit
+*      numRules   - number of entries in rule
+*      nextRule   - first rule to get a rotating counter at the next rotation
+*      owner      - index into rule of the owner of every counter, or
+*                   MSD_TCAM_STATS_NO_COUNTER
+*      lastCount  - counter values at the last collection, indexed by [port][counter]
+*      rule       - tagged rules
+*/
+typedef struct
+{
+	MSD_U32    portVec;
+	MSD_U32    dwellTicks;
+	MSD_U32    tickCount;
+	MSD_U32    numRules;
+	MSD_U32    nextRule;
+	MSD_U8     owner[MSD_TCAM_STATS_COUNTER_NUM];
+	MSD_U32    lastCount[MSD_MAX_SWITCH_PORTS][MSD_TCAM_STATS_COUNTER_NUM];
+	MSD_TCAM_STATS_RULE rule[MSD_TCAM_STATS_MAX_RULES];
+} MSD_TCAM_STATS_SHADOW;
+
 /*
 * Typedef: struct MSD_TCAM_EGR_DATA
 *
@@ -3151,6 +3458,68 @@ typedef struct
 	MSD_PTP_INT_STATUS    status;
 } MSD_PTP_TS_STATUS;
 
+#define MSD_PTP_TS_HARVEST_MAX		(MSD_MAX_SWITCH_PORTS * 4U)	/* time stamps per harvest */
+#define MSD_PTP_TS_QUEUE_SIZE		64U		/* entries of MSD_PTP_TS_QUEUE, power of 2 */
+
+/*
+*  typedef: struct MSD_PTP_TS_EVENT
+*
+*  Description: time stamp collected by the time stamp harvester
+*
+*  Fields:
+*      port           - logical port the time stamp was captured on
+*      timeToRead     - Arr0, Arr1, Dep or Dep1 time stamp
+*      tsStatus       - time stamp status, value and sequence ID
+*/
+typedef struct
+{
+	MSD_LPORT    port;
+	MSD_PTP_TIME    timeToRead;
+	MSD_PTP_TS_STATUS    tsStatus;
+} MSD_PTP_TS_EVENT;
+
+/*
+*  typedef: struct MSD_PTP_TS_QUEUE
+*
+*  Description: single producer, single consumer ring of harvested time stamps.
+*               The producer only writes head and dropped, the consumer only
+*               writes tail, so no lock is needed between them.
+*
+*  Fields:
+*      head           - index of the next entry to write
+*      tail           - index of the next entry to read
+*      dropped        - time stamps dropped because the queue was full
+*      event          - queue entries
+*/
+typedef struct
+{
+	volatile MSD_U32    head;
+	volatile MSD_U32    tail;
+	volatile MSD_U32    dropped;
+	MSD_PTP_TS_EVENT    event[MSD_PTP_TS_QUEUE_SIZE];
+} MSD_PTP_TS_QUEUE;
+
+#define MSD_PTP_TIME_SAMPLE_MAX		16U		/* reads per bracketed global time read */
+
+/*
+*  typedef: struct MSD_PTP_TIME_SAMPLE
+*
+*  Description: PTP global time read bracketed by host monotonic time
+*
+*  Fields:
+*      hwTime         - PTP global time
+*      hostTimeMid    - host time in ns, half way between the host time stamps
+*                       taken before and after the capture
+*      uncertainty    - half the distance between the two host time stamps in
+*                       ns, the capture happened within hostTimeMid +/- uncertainty
+*/
+typedef struct
+{
+	MSD_U32    hwTime;
+	MSD_U64    hostTimeMid;
+	MSD_U64    uncertainty;
+} MSD_PTP_TIME_SAMPLE;
+
 /*
 *  typedef: struct PTP_GLOBAL_CONFIG
 *
@@ -3617,6 +3986,184 @@ typedef struct
 
 } MSD_FRER_BANK1_COUNTER;
 
+#define MSD_FRER_MAX_RCVY			128U	/* individual and sequence recovery instances */
+#define MSD_FRER_MAX_STREAM_CTR		32U		/* stream counter instances per bank */
+
+/*
+*  typedef: struct MSD_FRER_BANK0_TOTAL
+*
+*  Description: FRER bank 0 counters accumulated over all snapshots, see
+*               MSD_FRER_BANK0_COUNTER for the fields
+*/
+typedef struct
+{
+	MSD_U64 indvRcvyTagless;
+	MSD_U64 indvRcvyPassed;
+	MSD_U64 indvRcvyDiscarded;
+	MSD_U64 indvRcvyOutofOrder;
+	MSD_U64 indvRcvyRogue;
+	MSD_U64 indvRcvyLost;
+	MSD_U64 sidInput;
+	MSD_U64 seqEncErrored;
+
+} MSD_FRER_BANK0_TOTAL;
+
+/*
+*  typedef: struct MSD_FRER_BANK1_TOTAL
+*
+*  Description: FRER bank 1 counters accumulated over all snapshots, see
+*               MSD_FRER_BANK1_COUNTER for the fields
+*/
+typedef struct
+{
+	MSD_U64 seqRcvyTagless;
+	MSD_U64 seqRcvyPassed;
+	MSD_U64 seqRcvyDiscarded;
+	MSD_U64 seqRcvyOutofOrder;
+	MSD_U64 seqRcvyRogue;
+	MSD_U64 seqRcvyLost;
+	MSD_U64 sidOutput;
+
+} MSD_FRER_BANK1_TOTAL;
+
+/*
+*  typedef: struct MSD_FRER_SNAPSHOT
+*
+*  Description: FRER recovery tables and stream counters captured in one pass.
+*               Bit n of a vector is set when instance n is valid.
+*
+*  Fields:
+*     generation; incremented by every snapshot refresh, 0 if none was taken
+*     complete; MSD_FALSE if the last refresh stopped on an error
+*     seqRcvyVec; valid sequence recovery instances
+*     seqRcvy; sequence recovery instance data
+*     seqRcvyResets; sequence recovery reset counter
+*     latErrResets; latent error reset counter
+*     indvRcvyVec; valid individual recovery instances
+*     indvRcvy; individual recovery instance data
+*     indvRcvyResets; individual recovery reset counter
+*     bank0Vec; valid bank 0 stream counter instances
+*     bank0Config; bank 0 stream counter config data
+*     bank0Total; bank 0 counters accumulated since the instance was found
+*     bank1Vec; valid bank 1 stream counter instances
+*     bank1Config; bank 1 stream counter config data
+*     bank1Total; bank 1 counters accumulated since the instance was found
+*/
+typedef struct
+{
+	MSD_U32 generation;
+	MSD_BOOL complete;
+	MSD_U32 seqRcvyVec[MSD_FRER_MAX_RCVY / 32U];
+	MSD_FRER_SEQRCVY seqRcvy[MSD_FRER_MAX_RCVY];
+	MSD_U16 seqRcvyResets[MSD_FRER_MAX_RCVY];
+	MSD_U16 latErrResets[MSD_FRER_MAX_RCVY];
+	MSD_U32 indvRcvyVec[MSD_FRER_MAX_RCVY / 32U];
+	MSD_FRER_INDVRCVY indvRcvy[MSD_FRER_MAX_RCVY];
+	MSD_U16 indvRcvyResets[MSD_FRER_MAX_RCVY];
+	MSD_U32 bank0Vec;
+	MSD_FRER_BANK0_CONFIG bank0Config[MSD_FRER_MAX_STREAM_CTR];
+	MSD_FRER_BANK0_TOTAL bank0Total[MSD_FRER_MAX_STREAM_CTR];
+	MSD_U32 bank1Vec;
+	MSD_FRER_BANK1_CONFIG bank1Config[MSD_FRER_MAX_STREAM_CTR];
+	MSD_FRER_BANK1_TOTAL bank1Total[MSD_FRER_MAX_STREAM_CTR];
+
+} MSD_FRER_SNAPSHOT;
+
+/*
+*  typedef: enum MSD_FRER_SNAPSHOT_TABLE
+*
+*  Description: tables of a FRER snapshot, in iteration order
+*
+*  Enumerations:
+*     MSD_FRER_SNAPSHOT_SEQ_RCVY - sequence recovery instances
+*     MSD_FRER_SNAPSHOT_INDV_RCVY - individual recovery instances
+*     MSD_FRER_SNAPSHOT_BANK0 - bank 0 stream counter instances
+*     MSD_FRER_SNAPSHOT_BANK1 - bank 1 stream counter instances
+*/
+typedef enum
+{
+	MSD_FRER_SNAPSHOT_SEQ_RCVY = 0,
+	MSD_FRER_SNAPSHOT_INDV_RCVY,
+	MSD_FRER_SNAPSHOT_BANK0,
+	MSD_FRER_SNAPSHOT_BANK1,
+	MSD_FRER_SNAPSHOT_TABLE_NUM
+} MSD_FRER_SNAPSHOT_TABLE;
+
+/*
+*  typedef: struct MSD_FRER_SNAPSHOT_ITER
+*
+*  Description: position of a walk over the cached FRER snapshot, set up by
+*               msdFrerSnapshotIterStart
+*
+*  Fields:
+*     generation; snapshot generation being walked
+*     table; table of the next entry
+*     nextId; instance to look at next within table
+*/
+typedef struct
+{
+	MSD_U32 generation;
+	MSD_FRER_SNAPSHOT_TABLE table;
+	MSD_U32 nextId;
+
+} MSD_FRER_SNAPSHOT_ITER;
+
+/*
+*  typedef: struct MSD_FRER_SNAPSHOT_ENTRY
+*
+*  Description: one instance returned by msdFrerSnapshotGetNext. Only the
+*               fields of the given table are filled in, the rest are zero.
+*
+*  Fields:
+*     table; table the instance belongs to
+*     id; instance identifier
+*     seqRcvy; sequence recovery instance data
+*     seqRcvyResets; sequence recovery reset counter
+*     latErrResets; latent error reset counter
+*     indvRcvy; individual recovery instance data
+*     indvRcvyResets; individual recovery reset counter
+*     bank0Config; bank 0 stream counter config data
+*     bank0Total; bank 0 accumulated counters
+*     bank1Config; bank 1 stream counter config data
+*     bank1Total; bank 1 accumulated counters
+*/
+typedef struct
+{
+	MSD_FRER_SNAPSHOT_TABLE table;
+	MSD_U8 id;
+	MSD_FRER_SEQRCVY seqRcvy;
+	MSD_U16 seqRcvyResets;
+	MSD_U16 latErrResets;
+	MSD_FRER_INDVRCVY indvRcvy;
+	MSD_U16 indvRcvyResets;
+	MSD_FRER_BANK0_CONFIG bank0Config;
+	MSD_FRER_BANK0_TOTAL bank0Total;
+	MSD_FRER_BANK1_CONFIG bank1Config;
+	MSD_FRER_BANK1_TOTAL bank1Total;
+
+} MSD_FRER_SNAPSHOT_ENTRY;
+
+/*
+*  typedef: struct MSD_FRER_SNAPSHOT_CACHE
+*
+*  Description: FRER snapshot cache of a device, owned by the caller of
+*               msdFrerSnapshotAttach. msdFrerSnapshotRefresh fills the
+*               snapshot not in use and swaps it in under lockSem, so readers
+*               only wait for the swap, not for the device.
+*
+*  Fields:
+*     lockSem; guards active and the snapshot it selects
+*     active; index of the snapshot readers see
+*     snap; published and refresh snapshots
+*/
+typedef struct
+{
+	MSD_SEM lockSem;
+	MSD_U32 active;
+	MSD_FRER_SNAPSHOT snap[2];
+
+} MSD_FRER_SNAPSHOT_CACHE;
+
 /****************************************************************************/
 /* Exported FRER Types			 			                                */
 /****************************************************************************/
@@ -3644,6 +4191,111 @@ typedef struct
 	MSD_U16 gateWindowTime;
 	MSD_U16 gateAllowedBytes;
 } MSD_STREAM_GATE_ENTRY;
+
+#define MSD_STREAM_GATE_MAX_ID			16U	/* stream gate instances */
+#define MSD_STREAM_GATE_MAX_ENTRIES		16U	/* gate control entries per instance */
+#define MSD_STREAM_GATE_MAX_TIME_GEN	4U	/* stream gate time generation instances */
+
+/*
+*  typedef: struct MSD_STREAM_GATE_SCHEDULE
+*
+*  Description: complete schedule of a stream gate instance
+*
+*  Fields:
+*     timeGenId - stream gate time generation instance driving the gate
+*     cycleTime - gate cycle time, unit ns
+*     baseTime - gate base time, PTP Global Timer, PTP ToD, PTP 1722 Nano
+*     numEntries - number of valid entries in entry, the remaining gate
+*                  control entries are cleared
+*     entry - gate control list
+*/
+typedef struct
+{
+	MSD_U8  timeGenId;
+	MSD_U32 cycleTime;
+	MSD_U64 baseTime;
+	MSD_U32 numEntries;
+	MSD_STREAM_GATE_ENTRY entry[MSD_STREAM_GATE_MAX_ENTRIES];
+} MSD_STREAM_GATE_SCHEDULE;
+
+/*
+*  typedef: struct MSD_QCI_GATE_SHADOW
+*
+*  Description: Stream gate tables as last written by msdStreamGateScheduleSet,
+*               owned by the caller of msdStreamGateShadowAttach.
+*
+*  Fields:
+*     gateVec - stream gates whose entries and timeGenId match the device
+*     timeGenVec - time generation instances whose times match the device
+*     timeGenId - time generation instance of every stream gate
+*     entry - gate control entries, stream gate registers 5, 6 and 7
+*     cycleTime - cycle time of every time generation instance, unit ns
+*     baseTime - base time of every time generation instance
+*/
+typedef struct
+{
+	MSD_U32 gateVec;
+	MSD_U32 timeGenVec;
+	MSD_U8  timeGenId[MSD_STREAM_GATE_MAX_ID];
+	MSD_U16 entry[MSD_STREAM_GATE_MAX_ID][MSD_STREAM_GATE_MAX_ENTRIES][3];
+	MSD_U32 cycleTime[MSD_STREAM_GATE_MAX_TIME_GEN];
+	MSD_U64 baseTime[MSD_STREAM_GATE_MAX_TIME_GEN];
+} MSD_QCI_GATE_SHADOW;
+
+#define MSD_PSFP_MAX_STREAM_FILTER		16U	/* stream filter instances */
+
+/*
+*  typedef: enum MSD_PSFP_CNT
+*
+*  Description: per stream filter PSFP counters
+*
+*  Enumerations:
+*     MSD_PSFP_MATCH_CNT - stream filter matching frames
+*     MSD_PSFP_FILTER_DROP_CNT - stream filter filtered frames
+*     MSD_PSFP_GATE_DROP_CNT - stream gate filtered frames
+*     MSD_PSFP_METER_DROP_CNT - flow meter filtered frames
+*/
+typedef enum
+{
+	MSD_PSFP_MATCH_CNT = 0,
+	MSD_PSFP_FILTER_DROP_CNT,
+	MSD_PSFP_GATE_DROP_CNT,
+	MSD_PSFP_METER_DROP_CNT,
+	MSD_PSFP_CNT_NUM
+} MSD_PSFP_CNT;
+
+/*
+*  typedef: struct MSD_PSFP_COUNTERS
+*
+*  Description: PSFP counters of a set of stream filters read in one pass
+*
+*  Fields:
+*     filterVec - stream filters held in counter
+*     timestamp - PTP global time taken before the first counter was read
+*     counter - counters of every stream filter, indexed by MSD_PSFP_CNT
+*/
+typedef struct
+{
+	MSD_U32 filterVec;
+	MSD_U32 timestamp;
+	MSD_U16 counter[MSD_PSFP_MAX_STREAM_FILTER][MSD_PSFP_CNT_NUM];
+} MSD_PSFP_COUNTERS;
+
+/*
+*  typedef: struct MSD_PSFP_STATS_CTX
+*
+*  Description: PSFP statistics context owned by the caller, zero it before
+*               the first snapshot
+*
+*  Fields:
+*     raw - counters read by the last snapshot
+*     total - 64 bits totals accumulated over all snapshots
+*/
+typedef struct
+{
+	MSD_PSFP_COUNTERS raw;
+	MSD_U64 total[MSD_PSFP_MAX_STREAM_FILTER][MSD_PSFP_CNT_NUM];
+} MSD_PSFP_STATS_CTX;
 /****************************************************************************/
 /* Exported Qci Types			 			                                */
 /****************************************************************************/
@@ -3827,6 +4479,101 @@ typedef struct _MSD_MACSEC_INT_TXSC {
 	MSD_BOOL txPNThrInt;
 }MSD_MACSEC_INT_TXSC;
 
+#define MSD_MACSEC_MAX_TX_SC 16
+
+/* Next SA set of one secure channel, pre-staged by msdMacSecRekeyStage */
+typedef struct _MSD_MACSEC_REKEY_SA {
+	/* TX SA entry holding the new key */
+	MSD_U8 txSAIndex;
+	MSD_MSEC_TX_SA txSA;
+	/* RX SC receiving from the peer and RX SA entry holding its new key */
+	MSD_U8 rxSCIndex;
+	MSD_U8 rxSAIndex;
+	MSD_MSEC_RX_SA rxSA;
+	/*2 bits, association number of the new SA*/
+	MSD_U8 an;
+	/* arm the TX SC PN threshold interrupt for msdMacSecRekeyService */
+	MSD_BOOL pnThrTrigger;
+}MSD_MACSEC_REKEY_SA;
+
+typedef struct _MSD_MACSEC_REKEY_RESULT {
+	/* TX SCs switched to their staged SA */
+	MSD_U32 switchedVec;
+	/* PTP global time ticks from before the first to after the last TX SC write */
+	MSD_U32 latency;
+}MSD_MACSEC_REKEY_RESULT;
+
+/* MACSec counters, in the order of the capture registers */
+#define MSD_MACSEC_MAX_COUNTER_INDEX 16
+/* The first counters of a SecY count octets and are 64 bits wide, the others are 32 bits */
+#define MSD_MSEC_SECY_OCTET_CNT_NUM 3
+
+typedef enum
+{
+	MSD_MSEC_RX_SECY_CPT_OCTETS = 0,
+	MSD_MSEC_RX_SECY_VALIDATED_OCTETS,
+	MSD_MSEC_RX_SECY_DECRYPTED_OCTETS,
+	MSD_MSEC_RX_SECY_UNICAST,
+	MSD_MSEC_RX_SECY_MULTICAST,
+	MSD_MSEC_RX_SECY_BROADCAST,
+	MSD_MSEC_RX_SECY_UNTAGGED,
+	MSD_MSEC_RX_SECY_NO_TAG,
+	MSD_MSEC_RX_SECY_BAD_TAG,
+	MSD_MSEC_RX_SECY_NO_SA,
+	MSD_MSEC_RX_SECY_NO_SA_ERR,
+	MSD_MSEC_RX_SECY_CNT_NUM
+} MSD_MSEC_RX_SECY_CNT;
+
+typedef enum
+{
+	MSD_MSEC_TX_SECY_CPT_OCTETS = 0,
+	MSD_MSEC_TX_SECY_ENCRYPTED_OCTETS,
+	MSD_MSEC_TX_SECY_PROTECTED_OCTETS,
+	MSD_MSEC_TX_SECY_UNICAST,
+	MSD_MSEC_TX_SECY_MULTICAST,
+	MSD_MSEC_TX_SECY_BROADCAST,
+	MSD_MSEC_TX_SECY_UNTAGGED,
+	MSD_MSEC_TX_SECY_TOO_LONG,
+	MSD_MSEC_TX_SECY_NO_SA_ERR,
+	MSD_MSEC_TX_SECY_CNT_NUM
+} MSD_MSEC_TX_SECY_CNT;
+
+typedef enum
+{
+	MSD_MSEC_RX_SC_OK = 0,
+	MSD_MSEC_RX_SC_UNCHECKED,
+	MSD_MSEC_RX_SC_DELAYED,
+	MSD_MSEC_RX_SC_LATE,
+	MSD_MSEC_RX_SC_INVALID,
+	MSD_MSEC_RX_SC_NOT_VALID,
+	MSD_MSEC_RX_SC_CNT_NUM
+} MSD_MSEC_RX_SC_CNT;
+
+typedef enum
+{
+	MSD_MSEC_TX_SC_ENCRYPTED = 0,
+	MSD_MSEC_TX_SC_PROTECTED,
+	MSD_MSEC_TX_SC_CNT_NUM
+} MSD_MSEC_TX_SC_CNT;
+
+/* Counters of every SecY and SC counter index, see msdMacSecStatsSnapshot */
+typedef struct _MSD_MACSEC_STATS {
+	/* counter indexes held */
+	MSD_U32 counterVec;
+	MSD_U64 rxSecY[MSD_MACSEC_MAX_COUNTER_INDEX][MSD_MSEC_RX_SECY_CNT_NUM];
+	MSD_U64 txSecY[MSD_MACSEC_MAX_COUNTER_INDEX][MSD_MSEC_TX_SECY_CNT_NUM];
+	MSD_U64 rxSC[MSD_MACSEC_MAX_COUNTER_INDEX][MSD_MSEC_RX_SC_CNT_NUM];
+	MSD_U64 txSC[MSD_MACSEC_MAX_COUNTER_INDEX][MSD_MSEC_TX_SC_CNT_NUM];
+}MSD_MACSEC_STATS;
+
+/* Statistics context owned by the caller, zero it before the first snapshot */
+typedef struct _MSD_MACSEC_STATS_CTX {
+	/* counter values read by the last snapshot */
+	MSD_MACSEC_STATS raw;
+	/* 64 bits totals accumulated over all snapshots */
+	MSD_MACSEC_STATS total;
+}MSD_MACSEC_STATS_CTX;
+
 typedef struct _MSD_MSEC_TCAM_ACTION {
 	/*4bits*/
 	MSD_U8 txSCIndex;
@@ -3893,6 +4640,365 @@ typedef struct _MSD_MSEC_RULE {
 /* Exported MACSec Types			 			                                */
 /****************************************************************************/
 
+/****************************************************************************/
+/* Exported Snapshot Types                                                  */
+/****************************************************************************/
+#define MSD_SNAPSHOT_MAGIC			0x4D534E50U	/* "MSNP" */
+#define MSD_SNAPSHOT_VERSION		1U
+#define MSD_SNAPSHOT_REG_NUM		32U		/* registers per SMI device address */
+#define MSD_SNAPSHOT_MAX_REG_BLOCKS	(MSD_MAX_SWITCH_PORTS + 2U)	/* global 1, global 2 and every port */
+#define MSD_SNAPSHOT_IRL_RES_NUM	8U		/* ingress rate resources looked at per port */
+#define MSD_SNAPSHOT_COS_NUM		8U		/* entries of the cos to queue and cos to dscp maps */
+
+/*
+*  typedef: enum MSD_SNAPSHOT_SECTION_ID
+*
+*  Description: sections of a configuration snapshot, in capture order.
+*               Bit n of a section vector selects section n.
+*
+*  Enumerations:
+*     MSD_SNAPSHOT_SECTION_REGS - global 1, global 2 and port registers,
+*                                 MSD_SNAPSHOT_REG_BLOCK records
+*     MSD_SNAPSHOT_SECTION_STU  - STU entries, MSD_STU_ENTRY records
+*     MSD_SNAPSHOT_SECTION_VTU  - VTU entries, MSD_VTU_ENTRY records
+*     MSD_SNAPSHOT_SECTION_ATU  - static ATU entries, MSD_ATU_ENTRY records
+*     MSD_SNAPSHOT_SECTION_TCAM - ingress TCAM entries, MSD_SNAPSHOT_TCAM_ENTRY records
+*     MSD_SNAPSHOT_SECTION_PIRL - ingress rate resources, MSD_SNAPSHOT_PIRL_RES records
+*     MSD_SNAPSHOT_SECTION_QOS  - port QoS mapping, MSD_SNAPSHOT_QOS_PORT records
+*/
+typedef enum
+{
+	MSD_SNAPSHOT_SECTION_REGS = 0,
+	MSD_SNAPSHOT_SECTION_STU,
+	MSD_SNAPSHOT_SECTION_VTU,
+	MSD_SNAPSHOT_SECTION_ATU,
+	MSD_SNAPSHOT_SECTION_TCAM,
+	MSD_SNAPSHOT_SECTION_PIRL,
+	MSD_SNAPSHOT_SECTION_QOS,
+	MSD_SNAPSHOT_SECTION_NUM
+} MSD_SNAPSHOT_SECTION_ID;
+
+#define MSD_SNAPSHOT_ALL_SECTIONS	((1U << MSD_SNAPSHOT_SECTION_NUM) - 1U)
+
+/*
+*  typedef: struct MSD_SNAPSHOT_SECTION
+*
+*  Description: location of one section in a snapshot
+*
+*  Fields:
+*     offset     - byte offset of the first record from the start of the snapshot
+*     count      - number of records
+*     recordSize - size of one record in bytes
+*/
+typedef struct
+{
+	MSD_U32 offset;
+	MSD_U32 count;
+	MSD_U32 recordSize;
+} MSD_SNAPSHOT_SECTION;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_HEADER
+*
+*  Description: header at the start of every snapshot. Records follow in
+*               host byte order; a snapshot is only accepted by a driver with
+*               the same version and record sizes.
+*
+*  Fields:
+*     magic        - MSD_SNAPSHOT_MAGIC
+*     version      - MSD_SNAPSHOT_VERSION
+*     headerSize   - size of this header in bytes
+*     totalSize    - size of the snapshot in bytes, header included
+*     checksum     - Adler-32 of the bytes following the header
+*     deviceId     - device ID of the captured device
+*     numOfPorts   - number of ports of the captured device
+*     validPortVec - valid port vector of the captured device
+*     sectionVec   - sections captured, bit n for MSD_SNAPSHOT_SECTION_ID n
+*     section      - location of every section, count is 0 if not captured
+*/
+typedef struct
+{
+	MSD_U32 magic;
+	MSD_U16 version;
+	MSD_U16 headerSize;
+	MSD_U32 totalSize;
+	MSD_U32 checksum;
+	MSD_U32 deviceId;
+	MSD_U32 numOfPorts;
+	MSD_U32 validPortVec;
+	MSD_U32 sectionVec;
+	MSD_SNAPSHOT_SECTION section[MSD_SNAPSHOT_SECTION_NUM];
+} MSD_SNAPSHOT_HEADER;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_REG_BLOCK
+*
+*  Description: the 32 registers of one SMI device address
+*
+*  Fields:
+*     devAddr  - SMI device address
+*     reserved - always 0
+*     data     - register values, indexed by register address
+*/
+typedef struct
+{
+	MSD_U8  devAddr;
+	MSD_U8  reserved;
+	MSD_U16 data[MSD_SNAPSHOT_REG_NUM];
+} MSD_SNAPSHOT_REG_BLOCK;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_TCAM_ENTRY
+*
+*  Description: one ingress TCAM entry
+*
+*  Fields:
+*     tcamPointer - TCAM entry index
+*     data        - entry key, mask and action
+*/
+typedef struct
+{
+	MSD_U32 tcamPointer;
+	MSD_TCAM_DATA data;
+} MSD_SNAPSHOT_TCAM_ENTRY;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_PIRL_RES
+*
+*  Description: one ingress rate resource of a port
+*
+*  Fields:
+*     irlPort - logical port number
+*     irlRes  - resource number
+*     data    - resource data
+*/
+typedef struct
+{
+	MSD_LPORT irlPort;
+	MSD_U32 irlRes;
+	MSD_PIRL_DATA data;
+} MSD_SNAPSHOT_PIRL_RES;
+
+/* Fields of MSD_SNAPSHOT_QOS_PORT.validVec */
+#define MSD_SNAPSHOT_QOS_PRIO_RULE		0x1U
+#define MSD_SNAPSHOT_QOS_INITIAL_PRI	0x2U
+#define MSD_SNAPSHOT_QOS_DEF_QPRI		0x4U
+#define MSD_SNAPSHOT_QOS_DEF_FPRI		0x8U
+#define MSD_SNAPSHOT_QOS_COS_TO_QUEUE	0x10U
+#define MSD_SNAPSHOT_QOS_COS_TO_DSCP	0x20U
+#define MSD_SNAPSHOT_QOS_PRIO_MAP(_table)	(0x100U << (_table))
+
+/*
+*  typedef: struct MSD_SNAPSHOT_QOS_PORT
+*
+*  Description: QoS mapping of one port
+*
+*  Fields:
+*     port        - logical port number
+*     validVec    - MSD_SNAPSHOT_QOS_xxx bits of the fields that were captured
+*     prioMapRule - priority map rule
+*     initialPri  - initial priority selection
+*     defQPri     - default queue priority
+*     defFPri     - default frame priority
+*     cosToQueue  - queue of every cos value
+*     cosToDscp   - dscp of every cos value
+*     prioMap     - IEEE priority mapping tables, indexed by
+*                   [MSD_IEEE_PRIORITY_TABLE_SET][entry]
+*/
+typedef struct
+{
+	MSD_LPORT port;
+	MSD_U32 validVec;
+	MSD_BOOL prioMapRule;
+	MSD_INITIAL_PRI initialPri;
+	MSD_U8 defQPri;
+	MSD_U8 defFPri;
+	MSD_U8 cosToQueue[MSD_SNAPSHOT_COS_NUM];
+	MSD_U8 cosToDscp[MSD_SNAPSHOT_COS_NUM];
+	MSD_IEEE_PRIORITY_TABLE_STRUCT prioMap[MSD_IEEE_PRIORITY_TABLE_NUM][MSD_IEEE_PRIORITY_TABLE_SIZE];
+} MSD_SNAPSHOT_QOS_PORT;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_RESTORE_STATS
+*
+*  Description: work done by a snapshot restore
+*
+*  Fields:
+*     entriesChecked - table entries compared with the device
+*     entriesWritten - table entries added or rewritten
+*     entriesDeleted - table entries removed because the snapshot has none
+*     regsWritten    - registers rewritten
+*/
+typedef struct
+{
+	MSD_U32 entriesChecked;
+	MSD_U32 entriesWritten;
+	MSD_U32 entriesDeleted;
+	MSD_U32 regsWritten;
+} MSD_SNAPSHOT_RESTORE_STATS;
+
+/*
+*  typedef: struct MSD_SNAPSHOT_REG_CHANGE
+*
+*  Description: one register that differs between two register captures
+*
+*  Fields:
+*     devAddr - SMI device address
+*     regAddr - register address
+*     oldData - value in the previous capture
+*     newData - value in the current capture
+*/
+typedef struct
+{
+	MSD_U8  devAddr;
+	MSD_U8  regAddr;
+	MSD_U16 oldData;
+	MSD_U16 newData;
+} MSD_SNAPSHOT_REG_CHANGE;
+/****************************************************************************/
+/* Exported Snapshot Types                                                  */
+/****************************************************************************/
+
+/****************************************************************************/
+/* Exported Async Types                                                     */
+/****************************************************************************/
+#define MSD_ASYNC_QUEUE_DEPTH		32U		/* entries of the submission and completion queues, power of 2 */
+
+/*
+*  typedef: enum MSD_ASYNC_OP_TYPE
+*
+*  Description: operations of the asynchronous API
+*
+*  Enumerations:
+*     MSD_ASYNC_OP_MIB_READ   - all counters of a port, as msdStatsPortAllCountersGet
+*     MSD_ASYNC_OP_ATU_DUMP   - next ATU entries of a FID, as repeated msdFdbEntryNextGet
+*     MSD_ASYNC_OP_TCAM_WRITE - one TCAM entry, as msdTcamEntryAdd
+*     MSD_ASYNC_OP_PTP_TS_GET - one PTP time stamp of a port, as msdPtpTimeStampGet
+*/
+typedef enum
+{
+	MSD_ASYNC_OP_MIB_READ = 0,
+	MSD_ASYNC_OP_ATU_DUMP,
+	MSD_ASYNC_OP_TCAM_WRITE,
+	MSD_ASYNC_OP_PTP_TS_GET,
+	MSD_ASYNC_OP_NUM
+} MSD_ASYNC_OP_TYPE;
+
+/*
+*  typedef: struct MSD_ASYNC_OP
+*
+*  Description: operation descriptor given to msdAsyncSubmit. The descriptor
+*               is copied; the buffers it points to belong to the caller and
+*               must stay valid until the completion is returned.
+*
+*  Fields:
+*     type        - operation
+*     userData    - returned in the completion, not used by the driver
+*     port        - logical port, MIB read and PTP time stamp
+*     timeToRead  - Arr0, Arr1, Dep or Dep1 time stamp, PTP time stamp
+*     fid         - ATU database, ATU dump
+*     startMac    - the dump returns the entries after this address,
+*                   broadcast for the first chunk, ATU dump
+*     maxEntries  - entries of atuEntries, ATU dump
+*     tcamPointer - TCAM entry index, TCAM write
+*     counters    - counters read, MIB read
+*     atuEntries  - entries read, ATU dump
+*     tcamData    - entry to write, TCAM write
+*     tsStatus    - time stamp read, PTP time stamp
+*/
+typedef struct
+{
+	MSD_ASYNC_OP_TYPE type;
+	void *userData;
+	MSD_LPORT port;
+	MSD_PTP_TIME timeToRead;
+	MSD_U32 fid;
+	MSD_ETHERADDR startMac;
+	MSD_U32 maxEntries;
+	MSD_U32 tcamPointer;
+	MSD_STATS_COUNTER_SET *counters;
+	MSD_ATU_ENTRY *atuEntries;
+	MSD_TCAM_DATA *tcamData;
+	MSD_PTP_TS_STATUS *tsStatus;
+} MSD_ASYNC_OP;
+
+/*
+*  typedef: struct MSD_ASYNC_COMPLETION
+*
+*  Description: result of one submitted operation
+*
+*  Fields:
+*     userData   - userData of the operation
+*     type       - operation
+*     status     - return value of the operation
+*     numEntries - entries stored in atuEntries, ATU dump
+*     more       - MSD_TRUE if the dump stopped at maxEntries; the next chunk
+*                  starts at atuEntries[numEntries - 1].macAddr, ATU dump
+*     coalesced  - MSD_TRUE if the device was not accessed for this operation:
+*                  a read was served by the same read earlier in the batch, or
+*                  a TCAM write was replaced by a later write of the same entry
+*/
+typedef struct
+{
+	void *userData;
+	MSD_ASYNC_OP_TYPE type;
+	MSD_STATUS status;
+	MSD_U32 numEntries;
+	MSD_BOOL more;
+	MSD_BOOL coalesced;
+} MSD_ASYNC_COMPLETION;
+
+/* Called by the worker after it queued completions, see msdAsyncQueueInit */
+typedef void (*MSD_ASYNC_NOTIFY)(MSD_U8 devNum, void *arg);
+
+/*
+*  typedef: struct MSD_ASYNC_QUEUE
+*
+*  Description: submission and completion queue of a device, owned by the
+*               caller of msdAsyncQueueInit. Indexes run freely and are taken
+*               modulo MSD_ASYNC_QUEUE_DEPTH. A slot is reserved in the
+*               completion queue for every submitted operation, so completions
+*               never overflow.
+*
+*  Fields:
+*     lockSem    - guards the indexes and flags
+*     workSem    - given on submit and stop, taken by msdAsyncWorkerRun
+*     notify     - completion callback, may be NULL
+*     notifyArg  - argument of notify
+*     stop       - set by msdAsyncWorkerStop
+*     busy       - a batch is being run
+*     sqHead     - next submission slot to fill
+*     sqTail     - next submission slot to run
+*     cqHead     - next completion slot to fill
+*     cqTail     - next completion slot to return
+*     submitted  - operations submitted
+*     completed  - operations completed
+*     coalesced  - operations completed without device access
+*     sq         - submission queue
+*     cq         - completion queue
+*/
+typedef struct
+{
+	MSD_SEM lockSem;
+	MSD_SEM workSem;
+	MSD_ASYNC_NOTIFY notify;
+	void *notifyArg;
+	MSD_BOOL stop;
+	MSD_BOOL busy;
+	MSD_U32 sqHead;
+	MSD_U32 sqTail;
+	MSD_U32 cqHead;
+	MSD_U32 cqTail;
+	MSD_U32 submitted;
+	MSD_U32 completed;
+	MSD_U32 coalesced;
+	MSD_ASYNC_OP sq[MSD_ASYNC_QUEUE_DEPTH];
+	MSD_ASYNC_COMPLETION cq[MSD_ASYNC_QUEUE_DEPTH];
+} MSD_ASYNC_QUEUE;
+/****************************************************************************/
+/* Exported Async Types                                                     */
+/****************************************************************************/
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,12 +21,37 @@
 #define msdDevObj_h
 
 #include <driver/msdApiTypes.h>
+#include <driver/msdSysConfig.h>
+#ifdef MSD_SINGLE_FAMILY_FIR
+#include <fir/include/Fir_msdApi.h>
+#include <fir/include/Fir_msdDispatch.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+* Access to the function table of a device. MSD_DEV_HAS tells if the device
+* implements obj.fn and MSD_DEV_FN gives the function to call. Built with
+* MSD_SINGLE_FAMILY_FIR, both resolve at compile time from Fir_msdDispatch.h:
+* the check becomes a constant and the call a direct call to the Fir function.
+*/
+#ifdef MSD_SINGLE_FAMILY_FIR
+#define MSD_DEV_ENTRY_(op, entry)   op entry
+#define MSD_DEV_PRESENT_(has, fn)   (has)
+#define MSD_DEV_FUNC_(has, fn)      (fn)
+#define MSD_DEV_HAS(dev, obj, fn)   MSD_DEV_ENTRY_(MSD_DEV_PRESENT_, MSD_FIR_##obj##_##fn)
+#define MSD_DEV_FN(dev, obj, fn)    MSD_DEV_ENTRY_(MSD_DEV_FUNC_, MSD_FIR_##obj##_##fn)
+#else
+#define MSD_DEV_HAS(dev, obj, fn)   ((dev)->SwitchDevObj->obj.fn != NULL)
+#define MSD_DEV_FN(dev, obj, fn)    ((dev)->SwitchDevObj->obj.fn)
+#endif
+
+/* points the device at its chip's function table, filled on first use */
 MSD_STATUS InitDevObj(MSD_QD_DEV *dev);
+/* points the device at the empty function table */
+void ResetDevObj(MSD_QD_DEV *dev);
 
 #ifdef __cplusplus
 }
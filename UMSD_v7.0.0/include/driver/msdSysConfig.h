@@ -63,6 +63,16 @@ extern "C" {
     ((dev->InterfaceChannel == MSD_INTERFACE_SMI_MULTICHIP) ? 1 : 0)
 
 #define MAX_SOHO_DEVICES	32U
+
+/*
+ * Number of devices that can be loaded at the same time, set by
+ * MAX_LOADED_DEVICES in setenv. Device state is only kept for loaded devices,
+ * devNum can still be any value below MAX_SOHO_DEVICES. Systems with more
+ * switches raise it, up to MAX_SOHO_DEVICES; single-switch builds set it to 1.
+ */
+#ifndef MSD_MAX_LOADED_DEVICES
+#define MSD_MAX_LOADED_DEVICES	4U
+#endif
 /*
  * Typedef: struct MSD_VERSION
  *
@@ -211,6 +221,7 @@ typedef MSD_STATUS(*FMSD_gfdbGetEntryCountPerFid)(MSD_QD_DEV*  dev, MSD_U32  fid
 typedef MSD_STATUS(*FMSD_gfdbGetNonStaticEntryCount)(MSD_QD_DEV*  dev, MSD_U32*  count);
 typedef MSD_STATUS(*FMSD_gfdbGetNonStaticEntryCountPerFid)(MSD_QD_DEV*  dev, MSD_U32  fid, MSD_U32*  count);
 typedef MSD_STATUS(*FMSD_gfdbDump)(MSD_QD_DEV*  dev, MSD_U32  fid);
+typedef MSD_STATUS(*FMSD_gfdbGetOccupancy)(MSD_QD_DEV*  dev, MSD_U32  numFids, const MSD_U32  *fidList, MSD_FDB_OCCUPANCY  *occupancy);
 
 typedef MSD_STATUS(*FMSD_gBpeEnableSet)(MSD_QD_DEV* dev, MSD_BOOL en);
 typedef MSD_STATUS(*FMSD_gBpeEnableGet)(MSD_QD_DEV* dev, MSD_BOOL *en);
@@ -258,6 +269,8 @@ typedef MSD_STATUS(*FMSD_geepromWrite)(MSD_QD_DEV*  dev, MSD_U16  addr, MSD_U16
 typedef MSD_STATUS(*FMSD_geepromRead)(MSD_QD_DEV*  dev, MSD_U16  addr, MSD_U16*  data);
 typedef MSD_STATUS(*FMSD_geepromSetMChipSel)(MSD_QD_DEV*  dev, MSD_U8  chipSelect);
 typedef MSD_STATUS(*FMSD_geepromGetMChipSel)(MSD_QD_DEV*  dev, MSD_U8*  chipSelect);
+typedef MSD_STATUS(*FMSD_geepromReadBlock)(MSD_QD_DEV*  dev, MSD_U16  startAddr, MSD_U16  count, MSD_U16*  data);
+typedef MSD_STATUS(*FMSD_geepromWriteBlock)(MSD_QD_DEV*  dev, MSD_U16  startAddr, MSD_U16  count, MSD_U16*  data, MSD_BOOL  verify);
 
 typedef MSD_STATUS(*FMSD_gphyReset)(MSD_QD_DEV*  dev, MSD_LPORT  port); 
 typedef MSD_STATUS(*FMSD_serdesReset)(MSD_QD_DEV*  dev, MSD_LPORT  port);
@@ -419,6 +432,11 @@ typedef MSD_STATUS(*FMSD_gprtGetCosToQueue)(MSD_QD_DEV* dev, MSD_LPORT port, MSD
 typedef MSD_STATUS(*FMSD_gprtSetCosToDscp)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_U8 cosVal, MSD_U8 dscp);
 typedef MSD_STATUS(*FMSD_gprtGetCosToDscp)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_U8 cosVal, MSD_U8* dscp);
 typedef MSD_STATUS(*FMSD_gprtRewriteDscp)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_BOOL en);
+typedef MSD_STATUS(*FMSD_gprtSetIEEEPrioMapTable)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_IEEE_PRIORITY_TABLE_SET table, MSD_IEEE_PRIORITY_TABLE_STRUCT* entries);
+typedef MSD_STATUS(*FMSD_gprtGetIEEEPrioMapTable)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_IEEE_PRIORITY_TABLE_SET table, MSD_IEEE_PRIORITY_TABLE_STRUCT* entries);
+typedef MSD_STATUS(*FMSD_gprtSetIEEEPrioMapTablePorts)(MSD_QD_DEV* dev, MSD_U32 portVec, MSD_IEEE_PRIORITY_TABLE_SET table, MSD_IEEE_PRIORITY_TABLE_STRUCT* entries);
+typedef MSD_STATUS(*FMSD_gprtSetCosToQueueTable)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_U8* queue);
+typedef MSD_STATUS(*FMSD_gprtSetCosToDscpTable)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_U8* dscp);
 
 typedef MSD_STATUS(*FMSD_gpolicySetMgmtCtrl)(MSD_QD_DEV* dev, MSD_LPORT portNum, MSD_U8 point, MSD_U8 data);
 typedef MSD_STATUS(*FMSD_gpolicyGetMgmtCtrl)(MSD_QD_DEV* dev, MSD_LPORT portNum, MSD_U8 point, MSD_U8 *data);
@@ -532,6 +550,7 @@ typedef MSD_STATUS(*FMSD_gptpGetPortConfig)(MSD_QD_DEV* dev, MSD_LPORT port, MSD
 typedef MSD_STATUS(*FMSD_gptpGetTimeStamp)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_PTP_TIME timeToRead, MSD_PTP_TS_STATUS *ptpStatus);
 typedef MSD_STATUS(*FMSD_gptpGetTSValidSt)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_PTP_TIME timeToRead, MSD_BOOL *isValid);
 typedef MSD_STATUS(*FMSD_gptpResetTimeStamp)(MSD_QD_DEV* dev, MSD_LPORT port, MSD_PTP_TIME timeToReset);
+typedef MSD_STATUS(*FMSD_gptpTimeStampHarvest)(MSD_QD_DEV* dev, MSD_U32 portVec, MSD_U8 timeMask, MSD_PTP_TS_EVENT *events, MSD_U32 *numEvents);
 typedef MSD_STATUS(*FMSD_gptpSetGlobalConfig)(MSD_QD_DEV* dev, MSD_PTP_GLOBAL_CONFIG *ptpData);
 typedef MSD_STATUS(*FMSD_gptpGetGlobalConfig)(MSD_QD_DEV* dev, MSD_PTP_GLOBAL_CONFIG *ptpData);
 typedef MSD_STATUS(*FMSD_gptpGetIntStatus)(MSD_QD_DEV* dev, MSD_PTP_INTERRUPT_STATUS *ptpIntSt);
@@ -552,6 +571,7 @@ typedef MSD_STATUS(*FMSD_gptpTODCaptureAll)(MSD_QD_DEV* dev, MSD_U8 timeArrayInd
 typedef MSD_STATUS(*FMSD_gptpSetPulse)(MSD_QD_DEV* dev, MSD_PTP_PULSE_STRUCT *pulsePara);
 typedef MSD_STATUS(*FMSD_gptpGetPulse)(MSD_QD_DEV* dev, MSD_PTP_PULSE_STRUCT *pulsePara);
 typedef MSD_STATUS(*FMSD_gtaiGetPTPGlobalTime)(MSD_QD_DEV* dev, MSD_U32 *ptpTime);
+typedef MSD_STATUS(*FMSD_gtaiGetPTPGlobalTimeSample)(MSD_QD_DEV* dev, MSD_U32 numReads, MSD_PTP_TIME_SAMPLE *sample);
 typedef MSD_STATUS(*FMSD_gptpGetPortReg)(MSD_QD_DEV* dev, MSD_LPORT portNum, MSD_U32 regOffset, MSD_U16 *data);
 typedef MSD_STATUS(*FMSD_gptpSetPortReg)(MSD_QD_DEV* dev, MSD_LPORT portNum, MSD_U32 regOffset, MSD_U16 data);
 typedef MSD_STATUS(*FMSD_gptpGetGlobalReg)(MSD_QD_DEV* dev, MSD_U32 regOffset, MSD_U16 *data);
@@ -699,6 +719,7 @@ typedef MSD_STATUS(*FMSD_gfrerBank1SCtrRead)(MSD_QD_DEV* dev, MSD_U8 bk1Id, MSD_
 typedef MSD_STATUS(*FMSD_gfrerBank1SCtrLoad)(MSD_QD_DEV* dev, MSD_FRER_BANK1_CONFIG *bk1ConfigData);
 typedef MSD_STATUS(*FMSD_gfrerBank1SCtrGetNext)(MSD_QD_DEV* dev, MSD_U8 bk1Id, MSD_FRER_BANK1_CONFIG *bk1ConfigData, MSD_FRER_BANK1_COUNTER *bk1SCtrData);
 typedef MSD_STATUS(*FMSD_gfrerBank1SCtrReadClear)(MSD_QD_DEV* dev, MSD_U8 bk1Id, MSD_FRER_BANK1_CONFIG *bk1ConfigData, MSD_FRER_BANK1_COUNTER *bk1SCtrData);
+typedef MSD_STATUS(*FMSD_gfrerSnapshotRefresh)(MSD_QD_DEV* dev, MSD_U32 *generation);
 
 typedef MSD_STATUS(*FMSD_gqciStreamFiltFlushAll)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gqciStreamFiltSet)(MSD_QD_DEV* dev, MSD_U8 streamFilterId, MSD_U16 maxSDUSize, MSD_U8 blockEn);
@@ -710,6 +731,7 @@ typedef MSD_STATUS(*FMSD_gqciStreamFiltMatchCtrGet)(MSD_QD_DEV* dev, MSD_U8 stre
 typedef MSD_STATUS(*FMSD_gqciStreamFiltFilterCtrGet)(MSD_QD_DEV* dev, MSD_U8 streamFilterId, MSD_U16 *counter);
 typedef MSD_STATUS(*FMSD_gqciStreamGateFiltCtrGet)(MSD_QD_DEV* dev, MSD_U8 streamFilterId, MSD_U16 *counter);
 typedef MSD_STATUS(*FMSD_gqciFlowMeterFiltCtrGet)(MSD_QD_DEV* dev, MSD_U8 streamFilterId, MSD_U16* counter);
+typedef MSD_STATUS(*FMSD_gqciCountersGetBulk)(MSD_QD_DEV* dev, MSD_U32 filterVec, MSD_PSFP_COUNTERS* counters);
 
 typedef MSD_STATUS(*FMSD_gqciStreamGateFlushAll)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gqciStreamGateDefStateSet)(MSD_QD_DEV* dev, MSD_U8 streamGateId, MSD_U8 defGateState, MSD_U8 defGateIPVEn, MSD_U8 defGateIPV);
@@ -719,6 +741,7 @@ typedef MSD_STATUS(*FMSD_gqciStreamGateEntryAdd)(MSD_QD_DEV* dev, MSD_U8 streamG
 
 typedef MSD_STATUS(*FMSD_gqciStreamGateTimeGenFlush)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gqciStreamGateTimeGenSet)(MSD_QD_DEV* dev, MSD_U8 streamGateGenId, MSD_U32 gateCycleTime, MSD_U64 gateBaseTime);
+typedef MSD_STATUS(*FMSD_gqciStreamGateScheduleSet)(MSD_QD_DEV* dev, MSD_U8 streamGateId, MSD_STREAM_GATE_SCHEDULE *schedule, MSD_U16 *checksum, MSD_U32 *numWrites);
 
 typedef MSD_STATUS(*FMSD_gqciFlowMeterFlushAll)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gqciFlowMeterCoupleFlagSet)(MSD_QD_DEV* dev, MSD_U8 flowMeterId, MSD_U8 flag);
@@ -731,8 +754,8 @@ typedef MSD_STATUS(*FMSD_gqciFlowMeterRedBlkStatSet)(MSD_QD_DEV* dev, MSD_U8 flo
 typedef MSD_STATUS(*FMSD_gqciFlowMeterRedBlkStatGet)(MSD_QD_DEV* dev, MSD_U8 flowMeterId, MSD_U8 *status);
 typedef MSD_STATUS(*FMSD_gqciFlowMeterAdvConfig)(MSD_QD_DEV* dev, MSD_U8 flowMeterId, MSD_U32 tgtRate, MSD_U32 bstSize, MSD_U8 countMode);
 
-typedef MSD_STATUS(*FMSD_gmacsecRead)(MSD_QD_DEV dev, MSD_U32 regAddr, MSD_U32* data);
-typedef MSD_STATUS(*FMSD_gmacsecWrite)(MSD_QD_DEV dev, MSD_U32 regAddr, MSD_U32 data);
+typedef MSD_STATUS(*FMSD_gmacsecRead)(MSD_QD_DEV *dev, MSD_U32 regAddr, MSD_U32* data);
+typedef MSD_STATUS(*FMSD_gmacsecWrite)(MSD_QD_DEV *dev, MSD_U32 regAddr, MSD_U32 data);
 typedef MSD_STATUS(*FMSD_gmacsecFlushAll)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gmacsecGetEvent)(MSD_QD_DEV* dev, MSD_MSEC_EVENT* event);
 typedef MSD_STATUS(*FMSD_gmacsecCreateRule)(MSD_QD_DEV* dev, MSD_U8 ruleIndex, MSD_MSEC_RULE* rule);
@@ -773,6 +796,7 @@ typedef MSD_STATUS(*FMSD_gmacsecGetRxDefaultSCI)(MSD_QD_DEV* dev, MSD_U16 portNu
 typedef MSD_STATUS(*FMSD_gmacsecSetTxSCIntCtrl)(MSD_QD_DEV* dev, MSD_U8 index, MSD_MACSEC_INT_CONTROL_TXSC* txscIntCtrl);
 typedef MSD_STATUS(*FMSD_gmacsecGetTxSCIntCtrl)(MSD_QD_DEV* dev, MSD_U8 index, MSD_MACSEC_INT_CONTROL_TXSC* txscIntCtrl);
 typedef MSD_STATUS(*FMSD_gmacsecGetNextTxSCIntStatus)(MSD_QD_DEV* dev, MSD_U8 index, MSD_BOOL isAUTOClear, MSD_U8* nextIndex, MSD_MACSEC_INT_TXSC* txscInt);
+typedef MSD_STATUS(*FMSD_gmacsecGetStatsBulk)(MSD_QD_DEV* dev, MSD_U32 counterVec, MSD_MACSEC_STATS* stats);
 
 typedef struct
 {
@@ -818,6 +842,7 @@ typedef struct
 	FMSD_gmacsecSetTxSCIntCtrl gmacsecSetTxSCIntCtrl;
 	FMSD_gmacsecGetTxSCIntCtrl gmacsecGetTxSCIntCtrl;
 	FMSD_gmacsecGetNextTxSCIntStatus gmacsecGetNextTxSCIntStatus;
+	FMSD_gmacsecGetStatsBulk gmacsecGetStatsBulk;
 } SwitchDevMACSECObj_;
 
 typedef struct
@@ -845,6 +870,7 @@ typedef struct
     FMSD_gfdbGetNonStaticEntryCount gfdbGetNonStaticEntryCount;
     FMSD_gfdbGetEntryCountPerFid gfdbGetEntryCountPerFid;
     FMSD_gfdbGetNonStaticEntryCountPerFid gfdbGetNonStaticEntryCountPerFid;
+    FMSD_gfdbGetOccupancy gfdbGetOccupancy;
 
     FMSD_gfdbDump gfdbDump;
 
@@ -916,6 +942,8 @@ typedef struct
 	FMSD_geepromRead  geepromRead;
 	FMSD_geepromSetMChipSel geepromSetMChipSel;
 	FMSD_geepromGetMChipSel geepromGetMChipSel;
+	FMSD_geepromReadBlock geepromReadBlock;
+	FMSD_geepromWriteBlock geepromWriteBlock;
 
 } SwitchDevEEPROMObj_;
 
@@ -1160,6 +1188,11 @@ typedef struct
     FMSD_gprtSetCosToDscp gprtSetCosToDscp;
     FMSD_gprtGetCosToDscp gprtGetCosToDscp;
     FMSD_gprtRewriteDscp  gprtRewriteDscp;
+    FMSD_gprtSetIEEEPrioMapTable gprtSetIEEEPrioMapTable;
+    FMSD_gprtGetIEEEPrioMapTable gprtGetIEEEPrioMapTable;
+    FMSD_gprtSetIEEEPrioMapTablePorts gprtSetIEEEPrioMapTablePorts;
+    FMSD_gprtSetCosToQueueTable gprtSetCosToQueueTable;
+    FMSD_gprtSetCosToDscpTable gprtSetCosToDscpTable;
 } SwitchDevQoSMAPObj_;
 
 typedef struct
@@ -1233,6 +1266,7 @@ typedef struct
     FMSD_gptpGetTimeStamp    gptpGetTimeStamp;
     FMSD_gptpGetTSValidSt    gptpGetTSValidSt;
     FMSD_gptpResetTimeStamp  gptpResetTimeStamp;
+    FMSD_gptpTimeStampHarvest  gptpTimeStampHarvest;
     FMSD_gptpSetGlobalConfig gptpSetGlobalConfig;
     FMSD_gptpGetGlobalConfig gptpGetGlobalConfig;
     FMSD_gptpGetIntStatus    gptpGetIntStatus;
@@ -1253,6 +1287,7 @@ typedef struct
     FMSD_gptpSetPulse             gptpSetPulse;
     FMSD_gptpGetPulse             gptpGetPulse;
     FMSD_gtaiGetPTPGlobalTime     gtaiGetPTPGlobalTime;
+    FMSD_gtaiGetPTPGlobalTimeSample gtaiGetPTPGlobalTimeSample;
     FMSD_gptpGetPortReg           gptpGetPortReg;
     FMSD_gptpSetPortReg           gptpSetPortReg;
     FMSD_gptpGetGlobalReg         gptpGetGlobalReg;
@@ -1413,6 +1448,8 @@ typedef struct
     FMSD_gfrerBank1SCtrLoad                gfrerBank1SCtrLoad;
     FMSD_gfrerBank1SCtrGetNext             gfrerBank1SCtrGetNext;
     FMSD_gfrerBank1SCtrReadClear           gfrerBank1SCtrReadClear;
+
+    FMSD_gfrerSnapshotRefresh              gfrerSnapshotRefresh;
 } SwitchDevFRERObj_;
 
 typedef struct
@@ -1443,6 +1480,7 @@ typedef struct
 	FMSD_gqciStreamFiltFilterCtrGet gqciStreamFiltFilterCtrGet;
 	FMSD_gqciStreamGateFiltCtrGet gqciStreamGateFiltCtrGet;
 	FMSD_gqciFlowMeterFiltCtrGet gqciFlowMeterFiltCtrGet;
+	FMSD_gqciCountersGetBulk gqciCountersGetBulk;
 
 	FMSD_gqciStreamGateFlushAll gqciStreamGateFlushAll;
 	FMSD_gqciStreamGateDefStateSet gqciStreamGateDefStateSet;
@@ -1452,6 +1490,7 @@ typedef struct
 
 	FMSD_gqciStreamGateTimeGenFlush gqciStreamGateTimeGenFlush;
 	FMSD_gqciStreamGateTimeGenSet gqciStreamGateTimeGenSet;
+	FMSD_gqciStreamGateScheduleSet gqciStreamGateScheduleSet;
 
 	FMSD_gqciFlowMeterFlushAll gqciFlowMeterFlushAll;
 	FMSD_gqciFlowMeterCoupleFlagSet gqciFlowMeterCoupleFlagSet;
@@ -1539,7 +1578,61 @@ typedef MSD_STATUS (*MSD_FMSD_SEM_TAKE)(
                         MSD_SEM semId, MSD_U32 timOut);
 typedef MSD_STATUS (*MSD_FMSD_SEM_GIVE)(
                         MSD_SEM semId);
+
+/*
+ * definition for the host time function, returns a monotonic time in ns.
+ *
+*/
+typedef MSD_STATUS (*MSD_FMSD_GET_HOST_TIME)(
+                        MSD_U64 *nanoSec);
 						
+/*
+ * Typedef: struct MSD_LAG_SHADOW
+ *
+ * Description: Trunk configuration last programmed by msdLagCommit.
+ *
+ * Fields:
+ *   valid  - MSD_TRUE once config matches the device
+ *   config - trunk mask, routing and LAG port configuration
+ */
+typedef struct
+{
+	MSD_BOOL       valid;
+	MSD_LAG_CONFIG config;
+} MSD_LAG_SHADOW;
+
+/*
+ * Typedef: struct MSD_VLAN_MATRIX_SHADOW
+ *
+ * Description: Port based VLAN map of every port, as last read or written
+ *              by the port isolation matrix API.
+ *
+ * Fields:
+ *   valid   - MSD_TRUE once portVec matches the device
+ *   portVec - port vector each port is allowed to send frames to
+ */
+typedef struct
+{
+	MSD_BOOL  valid;
+	MSD_U32   portVec[MSD_MAX_SWITCH_PORTS];
+} MSD_VLAN_MATRIX_SHADOW;
+
+/*
+ * Typedef: struct MSD_MACSEC_REKEY_SHADOW
+ *
+ * Description: TX SC entries prepared by msdMacSecRekeyStage, each with the
+ *              staged SA installed in the inactive slot and made active.
+ *
+ * Fields:
+ *   stagedVec - TX SCs holding a staged entry
+ *   txSC      - TX SC entry written by msdMacSecRekeySwitch
+ */
+typedef struct
+{
+	MSD_U32        stagedVec;
+	MSD_MSEC_TX_SC txSC[MSD_MACSEC_MAX_TX_SC];
+} MSD_MACSEC_REKEY_SHADOW;
+
 /*
  * Typedef: struct MSD_QD_DEV
  *
@@ -1570,12 +1663,25 @@ typedef MSD_STATUS (*MSD_FMSD_SEM_GIVE)(
  *                    such as Trunk Tables and Device Table
  *   eepromRegsSem  - Semaphore for eeprom control access
  *   phyRegsSem     - Semaphore for PHY Device access
+ *   qosMapShadow   - copy of the IEEE priority mapping tables, NULL if none, see msdQosMapShadowAttach
+ *   lagShadow      - trunk configuration last committed by the LAG manager
+ *   vlanMatrixShadow - port based VLAN map of every port, see msdPortBasedVlanMatrixSet
+ *   macsecRekey    - TX SC entries staged for a MACSec rekey
+ *   qbvGclShadow   - Qbv table entries written by the gate control list API, NULL if none, see msdQbvGclShadowAttach
+ *   qciGateShadow  - stream gate shadow, NULL if none, see msdStreamGateShadowAttach
+ *   frerCache      - FRER snapshot cache, NULL if none, see msdFrerSnapshotAttach
+ *   tcamStats      - TCAM statistics state, NULL if not started, see msdTcamStatsInit
+ *   asyncQueue     - queue of the asynchronous API, NULL if none, see msdAsyncQueueInit
+ *   SwitchDevObj   - function table of the device, shared by devices of the same ID
  *   fgtReadMii     - platform specific SMI register Read function
  *   fgtWriteMii    - platform specific SMI register Write function
  *   semCreate      - function to create semapore
  *   semDelete      - function to delete the semapore
  *   semTake        - function to get a semapore
  *   semGive        - function to return semaphore
+ *   getHostTime    - function to read the host monotonic time, may be NULL
+ *   loadSem        - semaphore shared by parallel loads, 0 if none, see MSD_SYS_CONFIG
+ *   reattached     - MSD_TRUE if loaded with cfg->reattach, nothing was written to the device
  */
 struct MSD_QD_DEV_
 {
@@ -1628,12 +1734,26 @@ struct MSD_QD_DEV_
     MSD_FMSD_SEM_TAKE    semTake;    	/* try to get a semaphore */
     MSD_FMSD_SEM_GIVE    semGive;    	/* return semaphore */
 
+    MSD_FMSD_GET_HOST_TIME getHostTime;	/* read host monotonic time */
+    MSD_SEM              loadSem;       /* serializes driver state shared by parallel loads */
+    MSD_BOOL             reattached;    /* attached to a running device */
+
     MSD_INTERFACE    InterfaceChannel;
 
 	MSD_BOOL           hwSemaphoreSupport;    /* true means the device support Hardware semaphore, false means do not support*/
 	MSD_HWSEMAPHORE    HWSemaphore;
 
-    SwitchDevObj_ SwitchDevObj;
+	MSD_QOS_MAP_SHADOW *qosMapShadow;
+	MSD_LAG_SHADOW     lagShadow;
+	MSD_VLAN_MATRIX_SHADOW vlanMatrixShadow;
+	MSD_MACSEC_REKEY_SHADOW macsecRekey;
+	MSD_QBV_GCL_SHADOW *qbvGclShadow;
+	MSD_QCI_GATE_SHADOW *qciGateShadow;
+	MSD_FRER_SNAPSHOT_CACHE *frerCache;
+	MSD_TCAM_STATS_SHADOW *tcamStats;
+	MSD_ASYNC_QUEUE    *asyncQueue;
+
+    const SwitchDevObj_ *SwitchDevObj;
 };
 
 /* Definition for BSP functions*/
@@ -1648,6 +1768,8 @@ typedef struct BSP_FUNCTIONS_
     MSD_FMSD_SEM_DELETE    semDelete;    /* delete the semapore */
     MSD_FMSD_SEM_TAKE    semTake;        /* try to get a semapore */
     MSD_FMSD_SEM_GIVE    semGive;        /* return semaphore */
+
+    MSD_FMSD_GET_HOST_TIME getHostTime;  /* read host monotonic time, optional */
 } MSD_BSP_FUNCTIONS;
 
 /* System configuration Parameters struct*/
@@ -1661,6 +1783,12 @@ typedef struct
 	MSD_BSP_FUNCTIONS	BSPFunctions;    /* register APIs */
 	MSD_INTERFACE    InterfaceChannel;   /* select register access bus, SMI or SMI multi-chip mode or RMU */
 	MSD_U16         tempDeviceId;       /* temp device Id for some device no eFuse */
+	MSD_SEM         loadSem;            /* semaphore from BSPFunctions.semCreate, the same for all
+	                                       devices loaded in parallel, 0 if devices are loaded one
+	                                       at a time */
+	MSD_BOOL        reattach;           /* attach to a running device without writing it */
+	MSD_DEVICE      reattachDeviceId;   /* reattach: device ID the device must have, 0 for any
+	                                       supported device */
 }MSD_SYS_CONFIG;
 
 
@@ -1692,6 +1820,13 @@ typedef struct
 *
 * COMMENTS:
 *     msdUnLoadDriver is also provided to do driver cleanup.
+*     Devices with different devNum, on different buses or RMU channels, may
+*     be loaded from parallel threads if they are given the same cfg->loadSem.
+*     With cfg->reattach the driver attaches to a device that is already
+*     configured, e.g. when the management process restarts: the device ID
+*     is checked against cfg->reattachDeviceId and no register is written.
+*     Driver copies of device tables start empty and are read back when
+*     first needed.
 *
 *******************************************************************************/
 MSD_STATUS msdLoadDriver
@@ -52,10 +52,15 @@ extern "C" {
 #include <api/msdTCAM.h>
 #include <api/msdTCAMRC.h>
 #include <api/msdTCAMRCComp.h>
+#include <api/msdTcamStats.h>
+#include <api/msdSnapshot.h>
+#include <api/msdAsync.h>
 #include <api/msdRMU.h>
 #include <api/msdQav.h>
 #include <api/msdPTP.h>
 #include <api/msdTrunk.h>
+#include <api/msdLag.h>
+#include <api/msdQbvGcl.h>
 #include <api/msdLed.h>
 #include <api/msdQci.h>
 #include <api/msdQcr.h>
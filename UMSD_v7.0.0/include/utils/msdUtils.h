@@ -35,34 +35,90 @@ extern "C" {
 
 #define MSD_UNUSED_PARAM(_a)	(_a)=(_a)
 
+/*
+* full memory barrier between filling a lock free queue entry and publishing
+* its index, and between reading the index and the entry. A platform may
+* define its own, or define MSD_NO_MEM_BARRIER for a single core build where
+* neither the compiler nor the CPU reorders the accesses.
+*/
+#ifndef MSD_MEM_BARRIER
+#if defined(MSD_NO_MEM_BARRIER)
+#define MSD_MEM_BARRIER()
+#elif defined(_MSC_VER)
+#include <windows.h>
+#define MSD_MEM_BARRIER()	MemoryBarrier()
+#elif defined(__GNUC__)
+#define MSD_MEM_BARRIER()	__sync_synchronize()
+#else
+#error "Define MSD_MEM_BARRIER() for this compiler, or MSD_NO_MEM_BARRIER"
+#endif
+#endif
+
 void msdDbgPrint(char* format, ...);
 #define MSG(x)             msdDbgPrint x      /* macro for message dump, like atu/vtu/mib...dump */
 typedef void(*MSD_STRING_PRINT_CALLBACK)(const char *string);
 void msdSetStringPrintCallback(MSD_STRING_PRINT_CALLBACK callback);
 void msdDbgLvlSet(MSD_U8 dbgLvl);
 
+/*
+* Debug modules, a source file belongs to the module of its API family,
+* e.g. Fir_msdBrgFdbIntf.c and msdBrgFdb.c to MSD_DBG_MOD_ATU
+*/
+typedef enum
+{
+	MSD_DBG_MOD_SYS = 0,	/* driver load, device object and others */
+	MSD_DBG_MOD_HW,			/* register access and semaphores */
+	MSD_DBG_MOD_RMU,
+	MSD_DBG_MOD_ATU,
+	MSD_DBG_MOD_VTU,
+	MSD_DBG_MOD_STU,
+	MSD_DBG_MOD_PORT,		/* port control, counters, PHY, trunk */
+	MSD_DBG_MOD_QOS,		/* priority mapping and queue control */
+	MSD_DBG_MOD_PIRL,
+	MSD_DBG_MOD_TCAM,		/* TCAM, TCAM RC, ARP, policy, ECID */
+	MSD_DBG_MOD_PTP,
+	MSD_DBG_MOD_TSN,		/* Qav, Qci, Qcr, Qbv, FRER */
+	MSD_DBG_MOD_MACSEC,
+	MSD_DBG_MOD_NUM
+} MSD_DBG_MODULE;
+
+void msdDbgModuleLvlSet(MSD_DBG_MODULE module, MSD_U8 dbgLvl);
+void msdDbgTraceSet(MSD_BOOL enable);
+MSD_U32 msdDbgTraceDump(void);
+
 #ifdef MSD_DEBUG_QD
 typedef enum 
 {
 	MSD_DBG_OFF_LVL = 0,
 	MSD_DBG_ERR_LVL,
 	MSD_DBG_INF_LVL,
-	MSD_DBG_ALL_LVL
+	MSD_DBG_ALL_LVL,
+	MSD_DBG_LVL_NUM
 } MSD_DBG_LEVEL;
 
-extern MSD_DBG_LEVEL dbg_level;
+/* bit n set: module n prints messages of this level, indexed by MSD_DBG_LEVEL */
+extern MSD_U32 msdDbgModuleMask[MSD_DBG_LVL_NUM];
+
+MSD_BOOL msdDbgOn(MSD_DBG_LEVEL level, const char *file);
+void msdDbgError(char* format, ...);
+void msdDbgInfo(char* format, ...);
+void msdDbgAll(char* format, ...);
+
 /*******************************************************************************
-* msdDbgPrint
+* MSD_DBG_ERROR, MSD_DBG_INFO, MSD_DBG
 *
 * DESCRIPTION:
-*       This function prints out debug message depending on input debug_level.
+*       These macros print out a debug message if the module of the calling
+*       source file has the debug level enabled, see msdDbgModuleLvlSet.
+*       With the trace ring enabled, see msdDbgTraceSet, the format string
+*       and the raw arguments are recorded instead and formatted by
+*       msdDbgTraceDump.
 *
 * INPUTS:
-*       debug_level 
-*          MSD_DBG_OFF_LVL - prints nothing
-*          MSD_DBG_ERR_LVL - for error messages
-*          MSD_DBG_INF_LVL - for trace messages
-*          MSD_DBG_ALL_LVL - for all messages
+*       x - printf style format string and arguments, in parentheses
+*          MSD_DBG_ERROR - for error messages
+*          MSD_DBG_INFO  - for trace messages
+*          MSD_DBG       - for all messages
 *
 * OUTPUTS:
 *       None
@@ -71,20 +127,18 @@ extern MSD_DBG_LEVEL dbg_level;
 *       None
 *
 * COMMENTS:
-*       None
+*       The arguments are not evaluated while the level is disabled.
 *
 *******************************************************************************/
+#define MSD_DBG_ON(_level)     ((msdDbgModuleMask[_level] != 0U) && \
+                               (msdDbgOn((_level), __FILE__) == MSD_TRUE))
 
-#define MSD_DBG_ERROR(x)       if(dbg_level >= MSD_DBG_ERR_LVL) \
-                               msdDbgPrint("(ERROR ): "); \
-                           if(dbg_level >= MSD_DBG_ERR_LVL) \
-                               msdDbgPrint x  /* macro for error messages */
-#define MSD_DBG_INFO(x)        if(dbg_level >= MSD_DBG_INF_LVL) \
-                               msdDbgPrint("(TRACE ): "); \
-                           if(dbg_level >= MSD_DBG_INF_LVL) \
-	                           msdDbgPrint x  /* macro for trace messages */
-#define MSD_DBG(x)             if(dbg_level >= MSD_DBG_ALL_LVL) \
-                               msdDbgPrint x  /* macro for informational messages */
+#define MSD_DBG_ERROR(x)       if(!MSD_DBG_ON(MSD_DBG_ERR_LVL)) {} else \
+                               msdDbgError x  /* macro for error messages */
+#define MSD_DBG_INFO(x)        if(!MSD_DBG_ON(MSD_DBG_INF_LVL)) {} else \
+                               msdDbgInfo x  /* macro for trace messages */
+#define MSD_DBG(x)             if(!MSD_DBG_ON(MSD_DBG_ALL_LVL)) {} else \
+                               msdDbgAll x  /* macro for informational messages */
 
 #else
 #define MSD_DBG_ERROR(x)
@@ -339,6 +393,36 @@ MSD_U8 msdShort2Char
 	MSD_U16 data
 );
 
+/*******************************************************************************
+* msdCrc16
+*
+* DESCRIPTION:
+*       This function calculates CRC-16/CCITT (polynomial 0x1021) over the low
+*       byte of each element of a 16-bit data array.
+*
+* INPUTS:
+*       crc   - initial CRC value, 0xFFFF for a new calculation
+*       data  - data array
+*       count - number of elements in data array
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       updated CRC value
+*
+* COMMENTS:
+*       Passing the result of a previous call as crc allows a CRC to be
+*       accumulated over several blocks.
+*
+*******************************************************************************/
+MSD_U16 msdCrc16
+(
+	IN MSD_U16 crc,
+	IN const MSD_U16 *data,
+	IN MSD_U32 count
+);
+
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,10 @@
 *    2. Enable learn2All feature
 *    3. Enable one port's message port bit
 *
+*    The sample sample_msdBrgFdb_occupancy will demonstrate how to
+*    1. Read the learn counts and limits of all ports and the ATU counts in one sweep
+*    2. Read the cached occupancy at a higher rate without accessing the device
+*
 * DEPENDENCIES:   None.
 *
 * FILE REVISION NUMBER:
@@ -190,4 +194,68 @@ MSD_STATUS sample_msdBrgFdb_learnToAll(MSD_U8 devNum)
 
 	MSG_PRINT(("sample_msdBrgFdb_learnToAll success.\n"));
 	return MSD_OK;
-}
\ No newline at end of file
+}
+
+/********************************************************************************
+* Sample #3:
+*       Address database occupancy for a monitoring dashboard.
+*
+* Description:
+*       One sweep reads the learn count and learn limit of every port, the
+*       valid and non-static entries of the ATU and of FID 0 and FID 1.
+*       Later reads return the cached sweep while it is younger than one
+*       second, and sweep again with the same FIDs once it is older.
+*
+* Comment:
+*       The cache age needs the getHostTime function in MSD_BSP_FUNCTIONS.
+*
+********************************************************************************/
+MSD_STATUS sample_msdBrgFdb_occupancy(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_FDB_OCCUPANCY occupancy;
+	MSD_U32 fidList[2] = { 0, 1 };
+	MSD_U32 port, i;
+
+	/*
+	* Sweep the device and fill the cache, the cache is kept by the caller
+	*/
+	if ((status = msdFdbOccupancyGet(devNum, 2, fidList, &occupancy)) != MSD_OK)
+	{
+		MSG_PRINT(("msdFdbOccupancyGet returned fail.\n"));
+		return status;
+	}
+
+	MSG_PRINT(("ATU entries %u, non-static %u\n", (unsigned int)occupancy.count,
+		(unsigned int)occupancy.nonStaticCount));
+	for (port = 0; port < MSD_MAX_SWITCH_PORTS; port++)
+	{
+		if ((occupancy.portVec & ((MSD_U32)1 << port)) != 0U)
+		{
+			MSG_PRINT(("port %u learned %u limit %u\n", (unsigned int)port,
+				(unsigned int)occupancy.learnCount[port], (unsigned int)occupancy.learnLimit[port]));
+		}
+	}
+	for (i = 0; i < occupancy.numFids; i++)
+	{
+		MSG_PRINT(("fid %u entries %u, non-static %u\n", (unsigned int)occupancy.fid[i].fid,
+			(unsigned int)occupancy.fid[i].count, (unsigned int)occupancy.fid[i].nonStaticCount));
+	}
+
+	/*
+	* Poll the cache, the device is swept again once the cache is one second old
+	*/
+	for (i = 0; i < 10U; i++)
+	{
+		if ((status = msdFdbOccupancyCachedGet(devNum, 1000000000ULL, &occupancy)) != MSD_OK)
+		{
+			MSG_PRINT(("msdFdbOccupancyCachedGet returned fail.\n"));
+			return status;
+		}
+		MSG_PRINT(("sweep %u: ATU entries %u\n", (unsigned int)occupancy.generation,
+			(unsigned int)occupancy.count));
+	}
+
+	MSG_PRINT(("sample_msdBrgFdb_occupancy success.\n"));
+	return MSD_OK;
+}
@@ -487,4 +487,84 @@ MSD_STATUS sample_msdSeqRcvy(MSD_U8 devNum)
 
 	MSG_PRINT(("sample_msdSeqRcvy success.\n"));
 	return MSD_OK;
-}
\ No newline at end of file
+}
+/********************************************************************************
+* Sample #4:
+*       Attach a FRER snapshot cache, take a snapshot and walk the cached
+*       recovery instances and stream counter totals.
+*
+*
+* Note:
+*		The snapshot reads and clears the stream counters on the device, use it
+*		instead of the ReadClear APIs.
+*
+* Comment:
+*		Only support Fir
+*
+********************************************************************************/
+
+MSD_STATUS sample_msdFrerSnapshot(MSD_U8 devNum)
+{
+	MSD_STATUS     status;
+	MSD_U32        generation;
+	MSD_FRER_SNAPSHOT_ITER  iter;
+	MSD_FRER_SNAPSHOT_ENTRY entry;
+	static MSD_FRER_SNAPSHOT_CACHE cache;
+
+	/*
+	*    The cache is kept in caller memory, attach it once after the driver is loaded.
+	*/
+	status = msdFrerSnapshotAttach(devNum, &cache);
+	if ((status != MSD_OK) && (status != MSD_ALREADY_EXIST))
+	{
+		MSG_PRINT(("msdFrerSnapshotAttach returned fail.\n"));
+		return status;
+	}
+
+	/*
+	*    Capture all instances and accumulate the stream counters, typically from a
+	*    periodic task. Any number of consumers may then read the cached results.
+	*/
+	if ((status = msdFrerSnapshotRefresh(devNum, &generation)) != MSD_OK)
+	{
+		MSG_PRINT(("msdFrerSnapshotRefresh returned fail.\n"));
+		return status;
+	}
+
+	if ((status = msdFrerSnapshotIterStart(devNum, &iter)) != MSD_OK)
+	{
+		MSG_PRINT(("msdFrerSnapshotIterStart returned fail.\n"));
+		return status;
+	}
+
+	while ((status = msdFrerSnapshotGetNext(devNum, &iter, &entry)) == MSD_OK)
+	{
+		switch (entry.table)
+		{
+		case MSD_FRER_SNAPSHOT_SEQ_RCVY:
+			MSG_PRINT(("seqRcvy %d: port %d resets %d\n", entry.id, entry.seqRcvy.seqRcvyPort, entry.seqRcvyResets));
+			break;
+		case MSD_FRER_SNAPSHOT_INDV_RCVY:
+			MSG_PRINT(("indvRcvy %d: resets %d\n", entry.id, entry.indvRcvyResets));
+			break;
+		case MSD_FRER_SNAPSHOT_BANK0:
+			MSG_PRINT(("bank0 %d: passed %lu discarded %lu\n", entry.id,
+				(unsigned long)entry.bank0Total.indvRcvyPassed, (unsigned long)entry.bank0Total.indvRcvyDiscarded));
+			break;
+		default:
+			MSG_PRINT(("bank1 %d: passed %lu discarded %lu\n", entry.id,
+				(unsigned long)entry.bank1Total.seqRcvyPassed, (unsigned long)entry.bank1Total.seqRcvyDiscarded));
+			break;
+		}
+	}
+
+	/* MSD_BUSY means another task refreshed the snapshot meanwhile, start again */
+	if (status != MSD_NO_SUCH)
+	{
+		MSG_PRINT(("msdFrerSnapshotGetNext returned fail.\n"));
+		return status;
+	}
+
+	MSG_PRINT(("sample_msdFrerSnapshot success.\n"));
+	return MSD_OK;
+}
@@ -981,4 +981,81 @@ MSD_STATUS ptpSet1588v2And8021as(MSD_U8 devNum)
     }
 
     return status;
-}
\ No newline at end of file
+}
+/********************************************************************************
+* Time stamp harvest
+*
+*   This sample API will demonstrate how a gPTP stack collects the time stamps of
+*   all its ports with one call and hands them to another task through a queue.
+*
+*   The harvest task calls msdPtpTimeStampHarvest on every PTP interrupt or poll
+*   tick; the protocol task drains the queue with msdPtpTsQueuePop. Neither call
+*   blocks the other.
+*
+*   Supported Device: Fir
+*
+*******************************************************************************/
+static MSD_PTP_TS_QUEUE ptpTsQueue;
+
+MSD_STATUS ptpTimeStampHarvest(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_U32 numHarvested;
+	MSD_PTP_TS_EVENT event;
+
+	/* done once, before the harvest and protocol tasks start */
+	if ((status = msdPtpTsQueueInit(&ptpTsQueue)) != MSD_OK)
+	{
+		MSG_PRINT(("msdPtpTsQueueInit error, error code: %d\n", status));
+		return status;
+	}
+
+	/* harvest task: arrival 0 and departure time stamps of ports 1 to 10 */
+	status = msdPtpTimeStampHarvest(devNum, 0x7FEU, (MSD_U8)((1U << MSD_PTP_ARR0_TIME) | (1U << MSD_PTP_DEP_TIME)),
+		&ptpTsQueue, &numHarvested);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdPtpTimeStampHarvest error, error code: %d\n", status));
+		return status;
+	}
+
+	/* protocol task */
+	while (msdPtpTsQueuePop(&ptpTsQueue, &event) == MSD_OK)
+	{
+		MSG_PRINT(("port %d time %d seqId 0x%x timeStamp 0x%lx\n", (int)event.port, (int)event.timeToRead,
+			(unsigned int)event.tsStatus.ptpSeqId, (unsigned long)event.tsStatus.timeStamped));
+	}
+
+	return MSD_OK;
+}
+/********************************************************************************
+* Host correlated global time
+*
+*   This sample API will demonstrate how to read the PTP global time together
+*   with the host monotonic time it was captured at, for example to steer a host
+*   clock from the switch clock.
+*
+*   The host time function must be registered in cfg.BSPFunctions.getHostTime
+*   before msdLoadDriver, see sample_msdSysConfig.c. Out of 8 reads, the one with
+*   the smallest host time bracket is returned.
+*
+*   Supported Device: Fir
+*
+*******************************************************************************/
+MSD_STATUS ptpGlobalTimeSample(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_PTP_TIME_SAMPLE sample;
+
+	status = msdPtpGlobalTimeSampleGet(devNum, 8U, &sample);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdPtpGlobalTimeSampleGet error, error code: %d\n", status));
+		return status;
+	}
+
+	MSG_PRINT(("global time 0x%lx at host time %lu ns +/- %lu ns\n", (unsigned long)sample.hwTime,
+		(unsigned long)sample.hostTimeMid, (unsigned long)sample.uncertainty));
+
+	return MSD_OK;
+}
@@ -153,6 +153,113 @@ MSD_STATUS sample_msdQbv(MSD_U8 devNum)
 	return MSD_OK;
 }
 
+/********************************************************************************
+* Sample #2:
+*       Reprogram the schedule of every port with the gate control list API.
+*       Cycle time is 1ms, starting 1ms from now. Priority 3 is open from 0 to
+*       200us, priority 2 from 200us to 300us, and all others for the rest of
+*       the cycle. A second schedule then moves the priority 2 window to
+*       priority 1, which with the shadow attached only rewrites the two
+*       changed entries of each port. The update is not hitless, see
+*       msdQbvGclLoad.
+*
+* Comment:
+*		Only support Amethyst, Peridot and Topaz
+*
+********************************************************************************/
+MSD_STATUS sample_msdQbvGcl(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_QBV_SCHEDULE schedule;
+	MSD_QBV_GCL_IMAGE image;
+	MSD_U32 numWrites;
+	MSD_U32 now;
+	MSD_LPORT port;
+	static MSD_QBV_GCL_SHADOW shadow;
+
+	MSD_QD_DEV *dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSG_PRINT(("devNum %d is NULL. \n", devNum));
+		return MSD_FAIL;
+	}
+
+	status = msdGetPTPGlobalTime(devNum, &now);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdGetPTPGlobalTime fail.\n"));
+		return status;
+	}
+
+	msdMemSet(&schedule, 0, sizeof(MSD_QBV_SCHEDULE));
+	schedule.cycleTime = 1000000;
+	schedule.baseTime = now + 250000;
+	for (port = 0; port < dev->numOfPorts; port++)
+	{
+		schedule.portVec |= (MSD_U32)1 << port;
+		schedule.port[port].numEntries = 3;
+		schedule.port[port].entry[0].gateStates = 1 << 3;
+		schedule.port[port].entry[0].interval = 200000;
+		schedule.port[port].entry[1].gateStates = 1 << 2;
+		schedule.port[port].entry[1].interval = 100000;
+		schedule.port[port].entry[2].gateStates = (MSD_U8)~((1 << 3) | (1 << 2));
+		schedule.port[port].entry[2].interval = 0;
+	}
+
+	/* a shadow left attached by an earlier run is replaced */
+	(void)msdQbvGclShadowDetach(devNum);
+	status = msdQbvGclShadowAttach(devNum, &shadow);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclShadowAttach fail.\n"));
+		return status;
+	}
+
+	status = msdQbvGclCompile(devNum, &schedule, &image);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclCompile fail.\n"));
+		return status;
+	}
+	status = msdQbvGclLoad(devNum, &image, &numWrites);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclLoad fail.\n"));
+		return status;
+	}
+	MSG_PRINT(("first schedule: %d writes\n", (int)numWrites));
+
+	for (port = 0; port < dev->numOfPorts; port++)
+	{
+		schedule.port[port].entry[1].gateStates = 1 << 1;
+		schedule.port[port].entry[2].gateStates = (MSD_U8)~((1 << 3) | (1 << 1));
+	}
+
+	status = msdQbvGclCompile(devNum, &schedule, &image);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclCompile fail.\n"));
+		return status;
+	}
+	status = msdQbvGclLoad(devNum, &image, &numWrites);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclLoad fail.\n"));
+		return status;
+	}
+	MSG_PRINT(("second schedule: %d writes\n", (int)numWrites));
+
+	status = msdQbvGclShadowDetach(devNum);
+	if (status != MSD_OK)
+	{
+		MSG_PRINT(("msdQbvGclShadowDetach fail.\n"));
+		return status;
+	}
+
+	MSG_PRINT(("sample_msdQbvGcl success.\n"));
+	return MSD_OK;
+}
+
 /********************************************************************************
 * ptpTriggerGenClk:
 *
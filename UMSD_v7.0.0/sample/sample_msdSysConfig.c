@@ -14,6 +14,8 @@
 *    2. Initialize driver for single device @ SMI multi-chip mode
 *    3. Initialize driver for single device @ RMU access mode
 *    4. Initialize driver for multiple device
+*    5. Reattach driver to a running device after a process restart
+*    6. Save the configuration of a device and program it into a replacement
 *
 * DEPENDENCIES:   None.
 *
@@ -46,6 +48,8 @@
  *						   (provided by BSP and required by All Device API)
  *		6) semGive      -  OS specific semaphore give function.
  *						   (provided by BSP and required by All Device API)
+ *		7) getHostTime  -  OS specific monotonic time function, in ns.
+ *						   (optional, required by msdPtpGlobalTimeSampleGet)
  */
 MSD_STATUS msdBspReadMii(MSD_U8 devNum, MSD_U8 phyAddr, MSD_U8 MIIReg,
                         MSD_U16* value);
@@ -111,6 +115,12 @@ MSD_STATUS sample_qdStart_SingleDevice_SMI_SC (MSD_U8 devNum)
     cfg.BSPFunctions.semGive   = NULL;
 #endif
 
+    /*
+    * Optional host monotonic time in ns, used by msdPtpGlobalTimeSampleGet to
+    * bracket the PTP global time read.
+    */
+    cfg.BSPFunctions.getHostTime = NULL;
+
     if((status=msdLoadDriver(&cfg)) != MSD_OK)
     {
         MSG_PRINT(("msdLoadDriver return Failed\n"));
@@ -353,6 +363,113 @@ MSD_STATUS sample_qdStart_MultiDevice_SMI_MC(MSD_U8 numOfDevice)
 	return MSD_OK;
 }
 
+/********************************************************************************
+* Sample #5: Reattach driver to a running device @ SMI Multi-chip mode.
+*            The device keeps forwarding with its current configuration:
+*            the driver only checks the device ID and writes no register.
+********************************************************************************/
+MSD_STATUS sample_qdReattach_SMI_MC(MSD_U8 devNum, MSD_U8 devAddr, MSD_DEVICE deviceId)
+{
+	MSD_STATUS status;
+	MSD_SYS_CONFIG   cfg;
+	MSD_QD_DEV       *dev;
+
+	msdMemSet((char*)&cfg, 0, sizeof(MSD_SYS_CONFIG));
+
+	cfg.InterfaceChannel = MSD_INTERFACE_SMI_MULTICHIP;
+	cfg.devNum = devNum;
+	cfg.baseAddr = devAddr;
+
+	cfg.BSPFunctions.readMii = msdBspReadMii;
+	cfg.BSPFunctions.writeMii = msdBspWriteMii;
+	cfg.BSPFunctions.rmu_tx_rx = NULL;
+
+#ifdef USE_SEMAPHORE
+	cfg.BSPFunctions.semCreate = osSemCreate;
+	cfg.BSPFunctions.semDelete = osSemDelete;
+	cfg.BSPFunctions.semTake = osSemWait;
+	cfg.BSPFunctions.semGive = osSemSignal;
+#endif
+
+	/* Attach without init, fail if another device answers at devAddr */
+	cfg.reattach = MSD_TRUE;
+	cfg.reattachDeviceId = deviceId;
+
+	if ((status = msdLoadDriver(&cfg)) != MSD_OK)
+	{
+		MSG_PRINT(("msdLoadDriver reattach return Failed\n"));
+		return status;
+	}
+
+	dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSG_PRINT(("devNum %d is NULL. Driver load failed. \n", devNum));
+		return MSD_FAIL;
+	}
+
+	MSG_PRINT(("Device ID     : 0x%x\n", dev->deviceId));
+	MSG_PRINT(("Reattached    : %d\n", dev->reattached));
+	MSG_PRINT(("sample_qdReattach_SMI_MC sample code success.\n"));
+
+	return MSD_OK;
+}
+
+/********************************************************************************
+* Sample #6: Capture the configuration of a device into a snapshot and program
+*            it into a replacement device of the same type. The restore only
+*            writes what differs, restoring onto the captured device itself
+*            writes nothing.
+********************************************************************************/
+MSD_STATUS sample_qdSnapshot(MSD_U8 devNum, MSD_U8 newDevNum)
+{
+	MSD_STATUS status;
+	MSD_U8 *buf;
+	MSD_U32 size = 0;
+	MSD_SNAPSHOT_RESTORE_STATS stats;
+
+	/* First call returns the size needed */
+	status = msdSnapshotCapture(devNum, MSD_SNAPSHOT_ALL_SECTIONS, 0, NULL, &size);
+	if ((status != MSD_OK) && (status != MSD_BAD_PARAM))
+	{
+		MSG_PRINT(("msdSnapshotCapture returned fail.\n"));
+		return status;
+	}
+
+	/* Room for a few entries learned or added between the two calls */
+	size += 1024;
+	buf = (MSD_U8*)malloc(size);
+	if (NULL == buf)
+	{
+		return MSD_FAIL;
+	}
+
+	if ((status = msdSnapshotCapture(devNum, MSD_SNAPSHOT_ALL_SECTIONS, size, buf, &size)) != MSD_OK)
+	{
+		MSG_PRINT(("msdSnapshotCapture returned fail.\n"));
+		free(buf);
+		return status;
+	}
+
+	/* buf may be stored in a file and restored after a reboot as well */
+	if ((status = msdSnapshotRestore(newDevNum, buf, size, &stats)) != MSD_OK)
+	{
+		MSG_PRINT(("msdSnapshotRestore returned fail.\n"));
+		free(buf);
+		return status;
+	}
+
+	MSG_PRINT(("Snapshot size   : %d\n", (int)size));
+	MSG_PRINT(("Entries checked : %d\n", (int)stats.entriesChecked));
+	MSG_PRINT(("Entries written : %d\n", (int)stats.entriesWritten));
+	MSG_PRINT(("Entries deleted : %d\n", (int)stats.entriesDeleted));
+	MSG_PRINT(("Regs written    : %d\n", (int)stats.regsWritten));
+	MSG_PRINT(("sample_qdSnapshot sample code success.\n"));
+
+	free(buf);
+	return MSD_OK;
+}
+
 /*****************************************************************************
 *
 * TODO by customers
@@ -26,6 +26,9 @@
 *    the sample sample_msdTcam_Adv will demonstrate how to
 *    1. Match the TCP over Ipv6 frame with specified DA, ipv6 and Tcp header using advance TCAM APIs
 *
+*    the sample sample_msdTcamStats will demonstrate how to
+*    1. Count the hits of a set of TCAM rules with the four TCAM counters of a port
+*
 * DEPENDENCIES:   None.
 *
 * FILE REVISION NUMBER:
@@ -857,4 +860,70 @@ MSD_STATUS sample_msdTcam_Adv(MSD_U8 devNum)
 	}
 
     return retVal;
-}
\ No newline at end of file
+}
+
+/********************************************************************************
+*   This sample demonstrate
+*   1. Tag TCAM entries 0 to 7 for counting, entry 0 pinned so it is counted exactly
+*   2. Sample the TCAM counters of port 1 to 4 on a fixed period, the 3 counters
+*      left rotate over entries 1 to 7 every 2 samples
+*   3. Read exact and estimated hit counts of every entry
+*   4. Stop the statistics, the state lives in caller memory until then
+*   The entries must be loaded and the port TCAM mode enabled first, see
+*   sample_msdTCAM.
+********************************************************************************/
+MSD_STATUS sample_msdTcamStats(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_U32 tcamPointer;
+	MSD_U32 tick;
+	MSD_TCAM_RULE_STATS stats;
+	static MSD_TCAM_STATS_SHADOW tcamStats;
+
+	if ((status = msdTcamStatsInit(devNum, 0x1EU, 2U, &tcamStats)) != MSD_OK)
+	{
+		MSG_PRINT(("msdTcamStatsInit returned fail.\n"));
+		return status;
+	}
+
+	for (tcamPointer = 0; tcamPointer < 8U; tcamPointer++)
+	{
+		status = msdTcamStatsRuleAdd(devNum, tcamPointer, (tcamPointer == 0U) ? MSD_TRUE : MSD_FALSE);
+		if (status != MSD_OK)
+		{
+			MSG_PRINT(("msdTcamStatsRuleAdd returned fail for entry %d.\n", (int)tcamPointer));
+			return status;
+		}
+	}
+
+	/* normally driven by a periodic timer */
+	for (tick = 0; tick < 20U; tick++)
+	{
+		if ((status = msdTcamStatsSample(devNum)) != MSD_OK)
+		{
+			MSG_PRINT(("msdTcamStatsSample returned fail.\n"));
+			return status;
+		}
+	}
+
+	for (tcamPointer = 0; tcamPointer < 8U; tcamPointer++)
+	{
+		if ((status = msdTcamStatsRuleGet(devNum, tcamPointer, &stats)) != MSD_OK)
+		{
+			MSG_PRINT(("msdTcamStatsRuleGet returned fail.\n"));
+			return status;
+		}
+		MSG_PRINT(("entry %d: %s %lu hits in %d of %d samples, estimated %lu\n", (int)tcamPointer,
+			(stats.pinned == MSD_TRUE) ? "pinned" : "rotating", (unsigned long)stats.hits,
+			(int)stats.observedTicks, (int)stats.totalTicks, (unsigned long)stats.estimatedHits));
+	}
+
+	if ((status = msdTcamStatsStop(devNum)) != MSD_OK)
+	{
+		MSG_PRINT(("msdTcamStatsStop returned fail.\n"));
+		return status;
+	}
+
+	MSG_PRINT(("sample_msdTcamStats sample code success.\n"));
+	return MSD_OK;
+}
@@ -23,6 +23,11 @@
 *			HashTrunk bit to 0, which means that calculating the final MaskNum
 *			using the XOR value of lower 3 bits of actual MAC address.
 *
+*		Sample #3: LAG member failover with the LAG manager
+*		1. Commit a LAG of port 1, 2 and 3 with trunkId 2
+*		2. Toggle the link of port 2 down and up, measure the average time
+*			and the number of table writes per failover
+*
 *
 * DEPENDENCIES:   None.
 *
@@ -31,6 +36,28 @@
 *******************************************************************************/
 #include "msdSample.h"
 #include "msdApi.h"
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* monotonic wall clock in ns, so time blocked on SMI or RMU I/O is counted */
+static double sample_msdTrunk_NowNs(void)
+{
+#ifdef WIN32
+	LARGE_INTEGER count, freq;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (double)count.QuadPart * 1000000000.0 / (double)freq.QuadPart;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1000000000.0 + (double)ts.tv_nsec;
+#endif
+}
 
 /********************************************************************************
 * Sample #1: Atu learn for trunk port, enable trunk port for port 1 and port 2 
@@ -154,4 +181,76 @@ MSD_STATUS sample_msdTrunk_TrunkRouting_TrunkMask(MSD_U8 devNum)
 
 	MSG_PRINT(("sample_msdTrunk_TrunkRouting_TrunkMask success.\n"));
 	return MSD_OK;
+}
+
+/********************************************************************************
+* Sample #3: LAG member failover with the LAG manager
+*		1. Commit a LAG of port 1, 2 and 3 with trunkId 2, all links up
+*		2. Toggle the link of port 2 down and up, measure the average time
+*			and the number of table writes per failover
+*		Note: only the trunk masks owned by port 2, the trunk route of trunkId 2
+*			and no port LAG setting are rewritten on each failover.
+********************************************************************************/
+MSD_STATUS sample_msdTrunk_LagFailover(MSD_U8 devNum)
+{
+	MSD_STATUS status;
+	MSD_LAG_GROUP lag;
+	MSD_U32 linkUpVec = (1 << 1) | (1 << 2) | (1 << 3);
+	MSD_U32 failPort = 2;
+	MSD_U32 loops = 100;
+	MSD_U32 idx;
+	MSD_U32 numWrites = 0;
+	MSD_U32 totalWrites = 0;
+	double start;
+	double end;
+
+	MSD_QD_DEV *dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSG_PRINT(("devNum %d is NULL. \n", devNum));
+		return MSD_FAIL;
+	}
+
+	lag.trunkId = 2;
+	lag.memberVec = linkUpVec;
+
+	/*
+	*    Initial commit, writes every trunk entry
+	*/
+	msdLagInvalidate(devNum);
+	if ((status = msdLagUpdate(devNum, &lag, 1, linkUpVec, &numWrites)) != MSD_OK)
+	{
+		MSG_PRINT(("msdLagUpdate returned fail.\n"));
+		return status;
+	}
+	MSG_PRINT(("initial commit: %u writes\n", (unsigned int)numWrites));
+
+	/*
+	*    Fail over port 2 and bring it back
+	*/
+	start = sample_msdTrunk_NowNs();
+	for (idx = 0; idx < loops; idx++)
+	{
+		if ((status = msdLagUpdate(devNum, &lag, 1, linkUpVec & ~(1U << failPort), &numWrites)) != MSD_OK)
+		{
+			MSG_PRINT(("msdLagUpdate returned fail.\n"));
+			return status;
+		}
+		totalWrites += numWrites;
+
+		if ((status = msdLagUpdate(devNum, &lag, 1, linkUpVec, &numWrites)) != MSD_OK)
+		{
+			MSG_PRINT(("msdLagUpdate returned fail.\n"));
+			return status;
+		}
+		totalWrites += numWrites;
+	}
+	end = sample_msdTrunk_NowNs();
+
+	MSG_PRINT(("failover: %.1f us and %.1f writes on average\n",
+		((end - start) / 1000.0) / (2.0 * loops),
+		(double)totalWrites / (2.0 * loops)));
+
+	MSG_PRINT(("sample_msdTrunk_LagFailover success.\n"));
+	return MSD_OK;
 }
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include <api/msdAdvVct.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdVctGetAdvCableDiag
@@ -64,9 +65,9 @@ MSD_STATUS msdVctGetAdvCableDiag
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag != NULL)
+		if (MSD_DEV_HAS(dev, VCTObj, gvctGetAdvCableDiag))
 		{
-			retVal = dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag(dev, portNum, mode, cableStatus);
+			retVal = MSD_DEV_FN(dev, VCTObj, gvctGetAdvCableDiag)(dev, portNum, mode, cableStatus);
 		}
 		else
 		{
@@ -120,9 +121,9 @@ MSD_STATUS msdVctGetAdvExtendStatus
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus != NULL)
+		if (MSD_DEV_HAS(dev, VCTObj, gvctGetAdvExtendedStatus))
 		{
-			retVal = dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus(dev, portNum, extendedStatus);
+			retVal = MSD_DEV_FN(dev, VCTObj, gvctGetAdvExtendedStatus)(dev, portNum, extendedStatus);
 		}
 		else
 		{
@@ -20,6 +20,7 @@
 #include <api/msdArp.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdArpMcEntryAdd
@@ -73,9 +74,9 @@ IN  MSD_ARP_MC_DATA  *arpMcData
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpLoadMcEntry != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpLoadMcEntry))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpLoadMcEntry(dev, arpEntryNum, arpMcData);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpLoadMcEntry)(dev, arpEntryNum, arpMcData);
 		}
 		else
 		{
@@ -139,9 +140,9 @@ IN  MSD_ARP_UC_DATA  *arpUcData
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpLoadUcEntry != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpLoadUcEntry))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpLoadUcEntry(dev, arpEntryNum, arpUcData);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpLoadUcEntry)(dev, arpEntryNum, arpUcData);
 		}
 		else
 		{
@@ -190,9 +191,9 @@ IN  MSD_U32  arpEntryNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpFlushEntry != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpFlushEntry))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpFlushEntry(dev, arpEntryNum);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpFlushEntry)(dev, arpEntryNum);
 		}
 		else
 		{
@@ -239,9 +240,9 @@ IN  MSD_U8  devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpFlushAll))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpFlushAll)(dev);
 		}
 		else
 		{
@@ -292,9 +293,9 @@ OUT MSD_ARP_DATA  *arpData
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpReadEntry != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpReadEntry))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpReadEntry(dev, arpEntryNum, arpData);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpReadEntry)(dev, arpEntryNum, arpData);
 		}
 		else
 		{
@@ -346,9 +347,9 @@ OUT		MSD_ARP_DATA  *arpData
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ARPObj.garpGetNextEntry != NULL)
+		if (MSD_DEV_HAS(dev, ARPObj, garpGetNextEntry))
 		{
-			retVal = dev->SwitchDevObj.ARPObj.garpGetNextEntry(dev, arpEntryNum, arpData);
+			retVal = MSD_DEV_FN(dev, ARPObj, garpGetNextEntry)(dev, arpEntryNum, arpData);
 		}
 		else
 		{
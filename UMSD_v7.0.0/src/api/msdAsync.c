@@ -0,0 +1,817 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+
+/********************************************************************************
+* msdAsync.c
+*
+* DESCRIPTION:
+*       API definitions for the asynchronous submission and completion queue.
+*
+* DEPENDENCIES:
+*       None.
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#include <api/msdAsync.h>
+#include <api/msdBrgFdb.h>
+#include <api/msdPortRmon.h>
+#include <api/msdTCAM.h>
+#include <api/msdPTP.h>
+#include <driver/msdApiTypes.h>
+#include <utils/msdUtils.h>
+#include <platform/msdSem.h>
+
+#define MSD_ASYNC_INDEX(_i)		((_i) & (MSD_ASYNC_QUEUE_DEPTH - 1U))
+
+/*
+ * The queue semaphores are taken with the BSP functions directly, not with
+ * msdSemTake, which would also take the hardware semaphore while the worker
+ * waits for work. Without semaphore functions the queue is not locked and
+ * must be used from one thread.
+ */
+static void msdAsyncLock(MSD_QD_DEV *dev)
+{
+    if (dev->semTake != NULL)
+    {
+        (void)dev->semTake(dev->asyncQueue->lockSem, OS_WAIT_FOREVER);
+    }
+}
+
+static void msdAsyncUnlock(MSD_QD_DEV *dev)
+{
+    if (dev->semGive != NULL)
+    {
+        (void)dev->semGive(dev->asyncQueue->lockSem);
+    }
+}
+
+static MSD_BOOL msdAsyncMacSame(const MSD_ETHERADDR *a, const MSD_ETHERADDR *b)
+{
+    MSD_U32 i;
+
+    for (i = 0; i < MSD_ETHERNET_HEADER_SIZE; i++)
+    {
+        if (a->arEther[i] != b->arEther[i])
+        {
+            return MSD_FALSE;
+        }
+    }
+
+    return MSD_TRUE;
+}
+
+/* MAC addresses in get next order, -1, 0 or 1 */
+static MSD_32 msdAsyncMacCmp(const MSD_ETHERADDR *a, const MSD_ETHERADDR *b)
+{
+    MSD_U32 i;
+
+    for (i = 0; i < MSD_ETHERNET_HEADER_SIZE; i++)
+    {
+        if (a->arEther[i] != b->arEther[i])
+        {
+            return (a->arEther[i] < b->arEther[i]) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+static MSD_BOOL msdAsyncIsBroadcast(const MSD_ETHERADDR *macAddr)
+{
+    MSD_U32 i;
+
+    for (i = 0; i < MSD_ETHERNET_HEADER_SIZE; i++)
+    {
+        if (macAddr->arEther[i] != 0xFFU)
+        {
+            return MSD_FALSE;
+        }
+    }
+
+    return MSD_TRUE;
+}
+
+static MSD_STATUS msdAsyncOpCheck(const MSD_ASYNC_OP *op)
+{
+    MSD_STATUS retVal = MSD_OK;
+
+    switch (op->type)
+    {
+    case MSD_ASYNC_OP_MIB_READ:
+        if (op->counters == NULL)
+        {
+            retVal = MSD_BAD_PARAM;
+        }
+        break;
+    case MSD_ASYNC_OP_ATU_DUMP:
+        if ((op->atuEntries == NULL) || (op->maxEntries == 0U))
+        {
+            retVal = MSD_BAD_PARAM;
+        }
+        break;
+    case MSD_ASYNC_OP_TCAM_WRITE:
+        if (op->tcamData == NULL)
+        {
+            retVal = MSD_BAD_PARAM;
+        }
+        break;
+    case MSD_ASYNC_OP_PTP_TS_GET:
+        if (op->tsStatus == NULL)
+        {
+            retVal = MSD_BAD_PARAM;
+        }
+        break;
+    default:
+        retVal = MSD_BAD_PARAM;
+        break;
+    }
+
+    return retVal;
+}
+
+/* MSD_TRUE if two reads return the same data */
+static MSD_BOOL msdAsyncSameRead(const MSD_ASYNC_OP *a, const MSD_ASYNC_OP *b)
+{
+    MSD_BOOL same = MSD_FALSE;
+
+    if (a->type != b->type)
+    {
+        return MSD_FALSE;
+    }
+
+    switch (a->type)
+    {
+    case MSD_ASYNC_OP_MIB_READ:
+        same = (a->port == b->port) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_ASYNC_OP_ATU_DUMP:
+        same = ((a->fid == b->fid) && (a->maxEntries == b->maxEntries) &&
+            (msdAsyncMacSame(&a->startMac, &b->startMac) == MSD_TRUE)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_ASYNC_OP_PTP_TS_GET:
+        same = ((a->port == b->port) && (a->timeToRead == b->timeToRead)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    default:
+        break;
+    }
+
+    return same;
+}
+
+/* Copy the result of an earlier read of the batch */
+static void msdAsyncCopyRead(const MSD_ASYNC_OP *from, const MSD_ASYNC_COMPLETION *fromComp, MSD_ASYNC_OP *op, MSD_ASYNC_COMPLETION *comp)
+{
+    comp->status = fromComp->status;
+    comp->numEntries = fromComp->numEntries;
+    comp->more = fromComp->more;
+
+    switch (op->type)
+    {
+    case MSD_ASYNC_OP_MIB_READ:
+        if (op->counters != from->counters)
+        {
+            msdMemCpy((void*)op->counters, (const void*)from->counters, sizeof(MSD_STATS_COUNTER_SET));
+        }
+        break;
+    case MSD_ASYNC_OP_ATU_DUMP:
+        if ((op->atuEntries != from->atuEntries) && (fromComp->numEntries != 0U))
+        {
+            msdMemCpy((void*)op->atuEntries, (const void*)from->atuEntries, fromComp->numEntries * (MSD_U32)sizeof(MSD_ATU_ENTRY));
+        }
+        break;
+    case MSD_ASYNC_OP_PTP_TS_GET:
+        if (op->tsStatus != from->tsStatus)
+        {
+            msdMemCpy((void*)op->tsStatus, (const void*)from->tsStatus, sizeof(MSD_PTP_TS_STATUS));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/* Next ATU entries after op->startMac, in ascending MAC order */
+static MSD_STATUS msdAsyncAtuDump(MSD_U8 devNum, const MSD_ASYNC_OP *op, MSD_ASYNC_COMPLETION *comp)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_ETHERADDR cursor;
+    MSD_ATU_ENTRY *entry;
+
+    msdMemCpy((void*)&cursor, (const void*)&op->startMac, sizeof(MSD_ETHERADDR));
+    comp->more = MSD_TRUE;
+
+    while (comp->numEntries < op->maxEntries)
+    {
+        entry = &op->atuEntries[comp->numEntries];
+        msdMemSet((void*)entry, 0, sizeof(MSD_ATU_ENTRY));
+        retVal = msdFdbEntryNextGet(devNum, &cursor, op->fid, entry);
+        if (retVal == MSD_NO_SUCH)
+        {
+            retVal = MSD_OK;
+            comp->more = MSD_FALSE;
+            break;
+        }
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        /* the walk ends at the broadcast address or when it wraps */
+        if ((msdAsyncIsBroadcast(&entry->macAddr) == MSD_TRUE) ||
+            ((msdAsyncIsBroadcast(&cursor) == MSD_FALSE) && (msdAsyncMacCmp(&entry->macAddr, &cursor) <= 0)))
+        {
+            comp->more = MSD_FALSE;
+            break;
+        }
+        msdMemCpy((void*)&cursor, (const void*)&entry->macAddr, sizeof(MSD_ETHERADDR));
+        comp->numEntries++;
+    }
+
+    return retVal;
+}
+
+/*
+ * Run entry k of a batch of num operations. Reads are served from an earlier
+ * read of the batch with the same parameters; a TCAM write is skipped when a
+ * later write of the batch programs the same entry.
+ */
+static void msdAsyncOpRun
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 sqBase,
+    IN  MSD_U32 cqBase,
+    IN  MSD_U32 k,
+    IN  MSD_U32 num
+)
+{
+    MSD_ASYNC_QUEUE *queue = dev->asyncQueue;
+    MSD_ASYNC_OP *op = &queue->sq[MSD_ASYNC_INDEX(sqBase + k)];
+    MSD_ASYNC_COMPLETION *comp = &queue->cq[MSD_ASYNC_INDEX(cqBase + k)];
+    MSD_ASYNC_OP *other;
+    MSD_U32 j;
+
+    msdMemSet((void*)comp, 0, sizeof(MSD_ASYNC_COMPLETION));
+    comp->userData = op->userData;
+    comp->type = op->type;
+
+    if (op->type == MSD_ASYNC_OP_TCAM_WRITE)
+    {
+        for (j = k + 1U; j < num; j++)
+        {
+            other = &queue->sq[MSD_ASYNC_INDEX(sqBase + j)];
+            if ((other->type == MSD_ASYNC_OP_TCAM_WRITE) && (other->tcamPointer == op->tcamPointer))
+            {
+                comp->status = MSD_OK;
+                comp->coalesced = MSD_TRUE;
+                return;
+            }
+        }
+    }
+    else
+    {
+        for (j = 0; j < k; j++)
+        {
+            other = &queue->sq[MSD_ASYNC_INDEX(sqBase + j)];
+            if (msdAsyncSameRead(other, op) == MSD_TRUE)
+            {
+                msdAsyncCopyRead(other, &queue->cq[MSD_ASYNC_INDEX(cqBase + j)], op, comp);
+                comp->coalesced = MSD_TRUE;
+                return;
+            }
+        }
+    }
+
+    switch (op->type)
+    {
+    case MSD_ASYNC_OP_MIB_READ:
+        comp->status = msdStatsPortAllCountersGet(dev->devNum, op->port, op->counters);
+        break;
+    case MSD_ASYNC_OP_ATU_DUMP:
+        comp->status = msdAsyncAtuDump(dev->devNum, op, comp);
+        break;
+    case MSD_ASYNC_OP_TCAM_WRITE:
+        comp->status = msdTcamEntryAdd(dev->devNum, op->tcamPointer, op->tcamData);
+        break;
+    case MSD_ASYNC_OP_PTP_TS_GET:
+        comp->status = msdPtpTimeStampGet(dev->devNum, op->port, op->timeToRead, op->tsStatus);
+        break;
+    default:
+        comp->status = MSD_BAD_PARAM;
+        break;
+    }
+}
+
+/*******************************************************************************
+* msdAsyncQueueInit
+*
+* DESCRIPTION:
+*       This function attaches a submission and completion queue to a device.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       queue     - queue memory, owned by the caller until msdAsyncQueueDestroy
+*       notify    - called by the worker after it queued completions, may be NULL
+*       notifyArg - argument of notify
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a queue already
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncQueueInit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_ASYNC_QUEUE  *queue,
+    IN  MSD_ASYNC_NOTIFY  notify,
+    IN  void  *notifyArg
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (queue == NULL)
+    {
+        MSD_DBG_ERROR(("queue is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    if (dev->asyncQueue != NULL)
+    {
+        MSD_DBG_ERROR(("Async queue already exists.\n"));
+        return MSD_ALREADY_EXIST;
+    }
+
+    msdMemSet((void*)queue, 0, sizeof(MSD_ASYNC_QUEUE));
+    queue->notify = notify;
+    queue->notifyArg = notifyArg;
+
+    if ((queue->lockSem = msdSemCreate(devNum, MSD_SEM_FULL)) == 0U)
+    {
+        MSD_DBG_ERROR(("lockSem semCreate Failed.\n"));
+        return MSD_FAIL;
+    }
+    if ((queue->workSem = msdSemCreate(devNum, MSD_SEM_EMPTY)) == 0U)
+    {
+        MSD_DBG_ERROR(("workSem semCreate Failed.\n"));
+        if (dev->semDelete != NULL)
+        {
+            (void)dev->semDelete(queue->lockSem);
+        }
+        return MSD_FAIL;
+    }
+
+    dev->asyncQueue = queue;
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncQueueDestroy
+*
+* DESCRIPTION:
+*       This function detaches the queue of a device. Operations not run yet
+*       and completions not returned yet are dropped.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BUSY  - if a batch is being run
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       A thread in msdAsyncWorkerRun must be stopped with msdAsyncWorkerStop
+*       and joined first.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncQueueDestroy
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_BOOL busy;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdAsyncLock(dev);
+    busy = queue->busy;
+    msdAsyncUnlock(dev);
+    if (busy == MSD_TRUE)
+    {
+        return MSD_BUSY;
+    }
+
+    if (dev->semDelete != NULL)
+    {
+        (void)dev->semDelete(queue->workSem);
+        (void)dev->semDelete(queue->lockSem);
+    }
+    dev->asyncQueue = NULL;
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncSubmit
+*
+* DESCRIPTION:
+*       This function queues operations and wakes the worker. It does not
+*       access the device.
+*
+* INPUTS:
+*       devNum - physical device number
+*       numOps - number of operations in ops
+*       ops    - operation descriptors, copied into the queue
+*
+* OUTPUTS:
+*       numSubmitted - operations queued, the first numSubmitted of ops
+*
+* RETURNS:
+*       MSD_OK  - on success, also when only some operations fit
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if an operation is invalid, nothing is queued
+*       MSD_BUSY  - if no operation fits, completions must be collected first
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       The queue holds MSD_ASYNC_QUEUE_DEPTH operations, counting both the
+*       operations not completed yet and the completions not collected yet.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncSubmit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  numOps,
+    IN  const MSD_ASYNC_OP  *ops,
+    OUT MSD_U32  *numSubmitted
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_U32 i, freeSlots;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if ((numSubmitted == NULL) || ((numOps != 0U) && (ops == NULL)))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    *numSubmitted = 0;
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    for (i = 0; i < numOps; i++)
+    {
+        if (msdAsyncOpCheck(&ops[i]) != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Bad async operation %u.\n", (unsigned int)i));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    msdAsyncLock(dev);
+    freeSlots = MSD_ASYNC_QUEUE_DEPTH - (queue->sqHead - queue->sqTail) - (queue->cqHead - queue->cqTail);
+    for (i = 0; (i < numOps) && (i < freeSlots); i++)
+    {
+        msdMemCpy((void*)&queue->sq[MSD_ASYNC_INDEX(queue->sqHead)], (const void*)&ops[i], sizeof(MSD_ASYNC_OP));
+        queue->sqHead++;
+    }
+    queue->submitted += i;
+    msdAsyncUnlock(dev);
+
+    *numSubmitted = i;
+    if (i != 0U)
+    {
+        if (dev->semGive != NULL)
+        {
+            (void)dev->semGive(queue->workSem);
+        }
+    }
+    else if (numOps != 0U)
+    {
+        return MSD_BUSY;
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncProcess
+*
+* DESCRIPTION:
+*       This function runs the queued operations as one batch, queues their
+*       completions and calls the notify function once. Reads with the same
+*       parameters in a batch access the device once, and of several TCAM
+*       writes of one entry only the last is written.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       numCompleted - operations completed, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success, the status of each operation is in its completion
+*       MSD_FAIL  - on error
+*       MSD_BUSY  - if another thread is running a batch
+*       MSD_NO_SUCH - if the device has no queue
+*
+* COMMENTS:
+*       msdAsyncWorkerRun calls this function. A single threaded caller may
+*       call it directly, for example when its event loop is idle.
+*       Operations submitted while a batch runs go into the next batch.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncProcess
+(
+    IN  MSD_U8  devNum,
+    OUT MSD_U32  *numCompleted
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_U32 sqBase, cqBase, num, k, coalesced;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (numCompleted != NULL)
+    {
+        *numCompleted = 0;
+    }
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdAsyncLock(dev);
+    if (queue->busy == MSD_TRUE)
+    {
+        msdAsyncUnlock(dev);
+        return MSD_BUSY;
+    }
+    sqBase = queue->sqTail;
+    cqBase = queue->cqHead;
+    num = queue->sqHead - sqBase;
+    queue->busy = (num != 0U) ? MSD_TRUE : MSD_FALSE;
+    msdAsyncUnlock(dev);
+
+    if (num == 0U)
+    {
+        return MSD_OK;
+    }
+
+    /* slots sqBase.. and cqBase.. are not touched by other threads until published */
+    coalesced = 0;
+    for (k = 0; k < num; k++)
+    {
+        msdAsyncOpRun(dev, sqBase, cqBase, k, num);
+        if (queue->cq[MSD_ASYNC_INDEX(cqBase + k)].coalesced == MSD_TRUE)
+        {
+            coalesced++;
+        }
+    }
+
+    msdAsyncLock(dev);
+    queue->sqTail = sqBase + num;
+    queue->cqHead = cqBase + num;
+    queue->completed += num;
+    queue->coalesced += coalesced;
+    queue->busy = MSD_FALSE;
+    msdAsyncUnlock(dev);
+
+    if (queue->notify != NULL)
+    {
+        queue->notify(devNum, queue->notifyArg);
+    }
+
+    if (numCompleted != NULL)
+    {
+        *numCompleted = num;
+    }
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncWorkerRun
+*
+* DESCRIPTION:
+*       This function is the body of a worker thread. It waits for submitted
+*       operations and runs them with msdAsyncProcess until msdAsyncWorkerStop
+*       is called. Operations submitted before the stop are run first.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - when stopped
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no queue
+*       MSD_NOT_SUPPORTED - if the BSP has no semaphore functions
+*
+* COMMENTS:
+*       Only one worker per device. The thread itself is created by the
+*       caller, the driver has no thread functions.
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncWorkerRun
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_STATUS retVal;
+    MSD_BOOL stop = MSD_FALSE;
+    MSD_BOOL pending = MSD_FALSE;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    if ((dev->semTake == NULL) || (dev->semGive == NULL))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    while ((stop == MSD_FALSE) || (pending == MSD_TRUE))
+    {
+        if (pending == MSD_FALSE)
+        {
+            if (dev->semTake(queue->workSem, OS_WAIT_FOREVER) != MSD_OK)
+            {
+                return MSD_FAIL;
+            }
+        }
+
+        retVal = msdAsyncProcess(devNum, NULL);
+        if ((retVal != MSD_OK) && (retVal != MSD_BUSY))
+        {
+            return retVal;
+        }
+
+        msdAsyncLock(dev);
+        stop = queue->stop;
+        pending = ((stop == MSD_TRUE) && (queue->sqHead != queue->sqTail)) ? MSD_TRUE : MSD_FALSE;
+        msdAsyncUnlock(dev);
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncWorkerStop
+*
+* DESCRIPTION:
+*       This function asks msdAsyncWorkerRun to return once the submitted
+*       operations are run. It does not wait for the worker.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no queue
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncWorkerStop
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdAsyncLock(dev);
+    queue->stop = MSD_TRUE;
+    msdAsyncUnlock(dev);
+
+    if (dev->semGive != NULL)
+    {
+        (void)dev->semGive(queue->workSem);
+    }
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdAsyncCompletionGet
+*
+* DESCRIPTION:
+*       This function returns completions in submission order. It does not
+*       wait and does not access the device.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       maxComps - number of entries in comps
+*
+* OUTPUTS:
+*       comps    - completions
+*       numComps - completions returned, 0 if none is ready
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - if the device has no queue
+*
+*******************************************************************************/
+MSD_STATUS msdAsyncCompletionGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  maxComps,
+    OUT MSD_ASYNC_COMPLETION  *comps,
+    OUT MSD_U32  *numComps
+)
+{
+    MSD_ASYNC_QUEUE *queue;
+    MSD_U32 i;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if ((numComps == NULL) || ((maxComps != 0U) && (comps == NULL)))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    *numComps = 0;
+
+    if ((queue = dev->asyncQueue) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdAsyncLock(dev);
+    for (i = 0; (i < maxComps) && (queue->cqTail != queue->cqHead); i++)
+    {
+        msdMemCpy((void*)&comps[i], (const void*)&queue->cq[MSD_ASYNC_INDEX(queue->cqTail)], sizeof(MSD_ASYNC_COMPLETION));
+        queue->cqTail++;
+    }
+    msdAsyncUnlock(dev);
+
+    *numComps = i;
+    return MSD_OK;
+}
@@ -20,6 +20,8 @@
 #include <api/msdBrgFdb.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <platform/msdSem.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdFdbMacEntryAdd
@@ -63,9 +65,9 @@ MSD_STATUS msdFdbMacEntryAdd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbAddMacEntry != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbAddMacEntry))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbAddMacEntry(dev, macEntry);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbAddMacEntry)(dev, macEntry);
 		}
 		else
 		{
@@ -114,9 +116,9 @@ IN MSD_FLUSH_CMD flushCmd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbFlush != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbFlush))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbFlush(dev, flushCmd);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbFlush)(dev, flushCmd);
 		}
 		else
 		{
@@ -168,9 +170,9 @@ IN MSD_U32 fid
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbFlushInDB != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbFlushInDB))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbFlushInDB(dev, flushCmd, fid);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbFlushInDB)(dev, flushCmd, fid);
 		}
 		else
 		{
@@ -223,9 +225,9 @@ IN MSD_LPORT     moveTo
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbMove != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbMove))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbMove(dev, moveCmd, moveFrom, moveTo);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbMove)(dev, moveCmd, moveFrom, moveTo);
 		}
 		else
 		{
@@ -280,9 +282,9 @@ IN MSD_LPORT      moveTo
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbMoveInDB != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbMoveInDB))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbMoveInDB(dev, moveCmd, fid, moveFrom, moveTo);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbMoveInDB)(dev, moveCmd, fid, moveFrom, moveTo);
 		}
 		else
 		{
@@ -333,9 +335,9 @@ IN MSD_LPORT     portNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbPortRemove != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbPortRemove))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbPortRemove(dev, moveCmd, portNum);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbPortRemove)(dev, moveCmd, portNum);
 		}
 		else
 		{
@@ -388,9 +390,9 @@ IN MSD_LPORT      portNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbPortRemoveInDB))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB(dev, moveCmd, fid, portNum);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbPortRemoveInDB)(dev, moveCmd, fid, portNum);
 		}
 		else
 		{
@@ -444,9 +446,9 @@ IN MSD_U32   fid
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbDelAtuEntry))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry(dev, macAddr, fid);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbDelAtuEntry)(dev, macAddr, fid);
 		}
 		else
 		{
@@ -494,9 +496,9 @@ OUT MSD_ATU_INT_STATUS *atuIntStatus
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetViolation != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetViolation))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetViolation(dev, atuIntStatus);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetViolation)(dev, atuIntStatus);
 		}
 		else
 		{
@@ -553,9 +555,9 @@ OUT MSD_BOOL         *found
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbFindAtuMacEntry))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry(dev, macAddr, fid, atuEntry, found);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbFindAtuMacEntry)(dev, macAddr, fid, atuEntry, found);
 		}
 		else
 		{
@@ -610,9 +612,9 @@ IN MSD_U32 timeout
 	}
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbSetAgingTimeout))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout(dev, timeout);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbSetAgingTimeout)(dev, timeout);
 		}
 		else
 		{
@@ -663,9 +665,9 @@ OUT MSD_U32 *timeout
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetAgingTimeout))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout(dev, timeout);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetAgingTimeout)(dev, timeout);
 		}
 		else
 		{
@@ -721,9 +723,9 @@ OUT MSD_BOOL  *en
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetLearn2All != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetLearn2All))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetLearn2All(dev, en);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetLearn2All)(dev, en);
 		}
 		else
 		{
@@ -779,9 +781,9 @@ IN  MSD_BOOL  en
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbSetLearn2All != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbSetLearn2All))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbSetLearn2All(dev, en);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbSetLearn2All)(dev, en);
 		}
 		else
 		{
@@ -852,9 +854,9 @@ IN  MSD_U32  limit
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbSetPortLearnLimit))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbSetPortLearnLimit)(dev, portNum, limit);
 		}
 		else
 		{
@@ -924,9 +926,9 @@ OUT MSD_U32  *limit
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetPortLearnLimit))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetPortLearnLimit)(dev, portNum, limit);
 		}
 		else
 		{
@@ -979,9 +981,9 @@ OUT MSD_U32  *count
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetPortLearnCount))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount(dev, portNum, count);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetPortLearnCount)(dev, portNum, count);
 		}
 		else
 		{
@@ -1030,9 +1032,9 @@ OUT MSD_U32  *count
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetEntryCount != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetEntryCount))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetEntryCount(dev, count);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetEntryCount)(dev, count);
 		}
 		else
 		{
@@ -1081,9 +1083,9 @@ OUT MSD_U32  *count
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetEntryCountPerFid))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid(dev, fid, count);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetEntryCountPerFid)(dev, fid, count);
 		}
 		else
 		{
@@ -1131,9 +1133,9 @@ OUT MSD_U32  *count
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetNonStaticEntryCount))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount(dev, count);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetNonStaticEntryCount)(dev, count);
 		}
 		else
 		{
@@ -1182,9 +1184,9 @@ OUT MSD_U32  *count
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetNonStaticEntryCountPerFid))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid(dev, fid, count);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetNonStaticEntryCountPerFid)(dev, fid, count);
 		}
 		else
 		{
@@ -1232,9 +1234,9 @@ MSD_STATUS msdFdbDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.ATUObj.gfdbDump != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbDump))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbDump(dev, fid);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbDump)(dev, fid);
 		}
 		else
 		{
@@ -1284,9 +1286,9 @@ MSD_STATUS msdPortLockedGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPortLocked))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPortLocked)(dev, portNum, en);
 		}
 		else
 		{
@@ -1339,9 +1341,9 @@ MSD_STATUS msdPortLockedSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPortLocked))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPortLocked)(dev, portNum, en);
 		}
 		else
 		{
@@ -1391,9 +1393,9 @@ MSD_STATUS msdPortHoldAt1Get
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetHoldAt1))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetHoldAt1)(dev, portNum, en);
 		}
 		else
 		{
@@ -1446,9 +1448,9 @@ MSD_STATUS msdPortHoldAt1Set
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetHoldAt1))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetHoldAt1)(dev, portNum, en);
 		}
 		else
 		{
@@ -1501,9 +1503,9 @@ MSD_STATUS msdPortIntOnAgeOutGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetInt0nAgeOut))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetInt0nAgeOut)(dev, portNum, en);
 		}
 		else
 		{
@@ -1557,9 +1559,9 @@ MSD_STATUS msdPortIntOnAgeOutSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetInt0nAgeOut))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetInt0nAgeOut)(dev, portNum, en);
 		}
 		else
 		{
@@ -1611,9 +1613,9 @@ MSD_STATUS msdPortRefreshLockedGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetRefreshLocked))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetRefreshLocked)(dev, portNum, en);
 		}
 		else
 		{
@@ -1667,9 +1669,9 @@ MSD_STATUS msdPortRefreshLockedSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetRefreshLocked))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetRefreshLocked)(dev, portNum, en);
 		}
 		else
 		{
@@ -1720,9 +1722,9 @@ MSD_STATUS msdPortIgnoreWrongDataGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetIgnoreWrongData))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetIgnoreWrongData)(dev, portNum, en);
 		}
 		else
 		{
@@ -1776,9 +1778,9 @@ MSD_STATUS msdPortIgnoreWrongDataSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetIgnoreWrongData))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetIgnoreWrongData)(dev, portNum, en);
 		}
 		else
 		{
@@ -1835,9 +1837,9 @@ MSD_STATUS msdFdbEntryNextGet
 		entry->fid = (MSD_U16)fid;
 		msdMemCpy(&entry->macAddr, macAddr, MSD_ETHERNET_HEADER_SIZE);
 
-		if (dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext != NULL)
+		if (MSD_DEV_HAS(dev, ATUObj, gfdbGetAtuEntryNext))
 		{
-			retVal = dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext(dev, entry);
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetAtuEntryNext)(dev, entry);
 		}
 		else
 		{
@@ -1847,3 +1849,243 @@ MSD_STATUS msdFdbEntryNextGet
 
 	return retVal;
 }
+
+static MSD_STATUS fdbOccupancySweep
+(
+	IN  MSD_QD_DEV  *dev,
+	IN  MSD_U32  numFids,
+	IN  const MSD_U32  *fidList,
+	OUT MSD_FDB_OCCUPANCY  *occupancy
+)
+{
+	MSD_STATUS retVal;
+	MSD_LPORT port;
+	MSD_U32 i;
+
+	if (MSD_DEV_HAS(dev, ATUObj, gfdbGetOccupancy))
+	{
+		return MSD_DEV_FN(dev, ATUObj, gfdbGetOccupancy)(dev, numFids, fidList, occupancy);
+	}
+
+	if (!MSD_DEV_HAS(dev, ATUObj, gfdbGetPortLearnLimit) || !MSD_DEV_HAS(dev, ATUObj, gfdbGetPortLearnCount) ||
+		!MSD_DEV_HAS(dev, ATUObj, gfdbGetEntryCount) || !MSD_DEV_HAS(dev, ATUObj, gfdbGetNonStaticEntryCount))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+	if ((numFids != 0U) && (!MSD_DEV_HAS(dev, ATUObj, gfdbGetEntryCountPerFid) ||
+		!MSD_DEV_HAS(dev, ATUObj, gfdbGetNonStaticEntryCountPerFid)))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+
+	msdMemSet(occupancy, 0, sizeof(MSD_FDB_OCCUPANCY));
+
+	for (port = 0; (port < (MSD_LPORT)dev->numOfPorts) && (port < (MSD_LPORT)MSD_MAX_SWITCH_PORTS); port++)
+	{
+		retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetPortLearnLimit)(dev, port, &occupancy->learnLimit[port]);
+		if ((retVal == MSD_BAD_PARAM) || (retVal == MSD_NOT_SUPPORTED))
+		{
+			continue;
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetPortLearnCount)(dev, port, &occupancy->learnCount[port]);
+		}
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+		occupancy->portVec |= (MSD_U32)1 << port;
+	}
+
+	retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetEntryCount)(dev, &occupancy->count);
+	if (retVal == MSD_OK)
+	{
+		retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetNonStaticEntryCount)(dev, &occupancy->nonStaticCount);
+	}
+	for (i = 0; (i < numFids) && (retVal == MSD_OK); i++)
+	{
+		occupancy->fid[i].fid = fidList[i];
+		retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetEntryCountPerFid)(dev, fidList[i], &occupancy->fid[i].count);
+		if (retVal == MSD_OK)
+		{
+			retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetNonStaticEntryCountPerFid)(dev, fidList[i], &occupancy->fid[i].nonStaticCount);
+		}
+	}
+	if (retVal == MSD_OK)
+	{
+		occupancy->numFids = numFids;
+	}
+
+	return retVal;
+}
+
+/*
+* sweep the device into occupancy and stamp the sweep with the host time
+*/
+static MSD_STATUS fdbOccupancyTake
+(
+	IN  MSD_QD_DEV  *dev,
+	IN  MSD_U32  numFids,
+	IN  const MSD_U32  *fidList,
+	IN  MSD_U32  generation,
+	OUT MSD_FDB_OCCUPANCY  *occupancy
+)
+{
+	MSD_STATUS retVal;
+	MSD_U64 now = 0;
+
+	retVal = fdbOccupancySweep(dev, numFids, fidList, occupancy);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	if ((dev->getHostTime != NULL) && (dev->getHostTime(&now) != MSD_OK))
+	{
+		now = 0;
+	}
+
+	occupancy->generation = (generation == 0U) ? 1U : generation;
+	occupancy->timestamp = now;
+
+	return MSD_OK;
+}
+
+/*******************************************************************************
+* msdFdbOccupancyGet
+*
+* DESCRIPTION:
+*       Reads the learn count and learn limit of every port, the number of valid
+*       and non-static entries in the ATU, and the same two counts for each FID
+*       in fidList in one sweep. The result can be kept by the caller as the
+*       cache of msdFdbOccupancyCachedGet.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       numFids - number of FIDs in fidList, up to MSD_FDB_OCCUPANCY_MAX_FIDS
+*       fidList - FIDs to count, may be NULL if numFids is 0
+*
+* OUTPUTS:
+*       occupancy - counts and limits of this sweep, generation 1
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Devices without a sweep of their own are read with the per port and
+*       per FID functions; ports that have no learn limit are left out of
+*       portVec. The counts are not atomic, entries learned or aged during
+*       the sweep may or may not be counted.
+*
+*******************************************************************************/
+MSD_STATUS msdFdbOccupancyGet
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32  numFids,
+	IN  const MSD_U32  *fidList,
+	OUT MSD_FDB_OCCUPANCY  *occupancy
+)
+{
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	if ((occupancy == NULL) || (numFids > MSD_FDB_OCCUPANCY_MAX_FIDS) ||
+		((numFids != 0U) && (fidList == NULL)))
+	{
+		MSD_DBG_ERROR(("Bad occupancy parameter.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	return fdbOccupancyTake(dev, numFids, fidList, 1U, occupancy);
+}
+
+/*******************************************************************************
+* msdFdbOccupancyCachedGet
+*
+* DESCRIPTION:
+*       Returns a cached occupancy of the device, for callers that poll more
+*       often than the ATU should be swept. The cache is owned by the caller
+*       and refreshed, with the FIDs of the cached sweep, if it is older than
+*       maxAgeNs.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       maxAgeNs - oldest cached sweep to return, in ns; 0 never sweeps
+*       cache    - last sweep, from msdFdbOccupancyGet or an earlier call, or
+*                  zeroed if no sweep was taken yet
+*
+* OUTPUTS:
+*       cache - counts and limits no older than maxAgeNs
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - if maxAgeNs is 0 and no sweep was taken yet
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       The age is taken from the getHostTime function of the BSP; without
+*       it every call with a non-zero maxAgeNs sweeps. Fill the cache with
+*       msdFdbOccupancyGet to choose the FIDs, a first sweep made here counts
+*       no FID. The cache is left unchanged if the sweep fails.
+*
+*******************************************************************************/
+MSD_STATUS msdFdbOccupancyCachedGet
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U64  maxAgeNs,
+	INOUT MSD_FDB_OCCUPANCY  *cache
+)
+{
+	MSD_STATUS retVal;
+	MSD_FDB_OCCUPANCY sweep;
+	MSD_U32 fidList[MSD_FDB_OCCUPANCY_MAX_FIDS];
+	MSD_U64 now;
+	MSD_U32 i;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	if ((cache == NULL) || (cache->numFids > MSD_FDB_OCCUPANCY_MAX_FIDS))
+	{
+		MSD_DBG_ERROR(("Bad occupancy cache.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	if (maxAgeNs == 0U)
+	{
+		return (cache->generation == 0U) ? MSD_NO_SUCH : MSD_OK;
+	}
+
+	if ((cache->generation != 0U) && (dev->getHostTime != NULL) &&
+		(dev->getHostTime(&now) == MSD_OK) && (now >= cache->timestamp) &&
+		((now - cache->timestamp) <= maxAgeNs))
+	{
+		return MSD_OK;
+	}
+
+	for (i = 0; i < cache->numFids; i++)
+	{
+		fidList[i] = cache->fid[i].fid;
+	}
+
+	retVal = fdbOccupancyTake(dev, cache->numFids, fidList, cache->generation + 1U, &sweep);
+	if (retVal == MSD_OK)
+	{
+		msdMemCpy((void*)cache, (void*)&sweep, sizeof(MSD_FDB_OCCUPANCY));
+	}
+
+	return retVal;
+}
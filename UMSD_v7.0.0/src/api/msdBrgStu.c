@@ -20,6 +20,7 @@
 #include <api/msdBrgStu.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdStuEntryAdd
@@ -57,9 +58,9 @@ MSD_STATUS msdStuEntryAdd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.STUObj.gstuAddEntry != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuAddEntry))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuAddEntry(dev, stuEntry);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuAddEntry)(dev, stuEntry);
 		}
 		else
 		{
@@ -110,9 +111,9 @@ MSD_STATUS msdStuEntryNextGet
 	else
 	{
 		stuEntry->sid = sid;
-		if (dev->SwitchDevObj.STUObj.gstuGetEntryNext != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuGetEntryNext))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuGetEntryNext(dev, stuEntry);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuGetEntryNext)(dev, stuEntry);
 		}
 		else
 		{
@@ -161,9 +162,9 @@ MSD_STATUS msdStuEntryDelete
 	}
 	else
 	{
-		if (dev->SwitchDevObj.STUObj.gstuDelEntry != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuDelEntry))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuDelEntry(dev, sid);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuDelEntry)(dev, sid);
 		}
 		else
 		{
@@ -215,9 +216,9 @@ MSD_STATUS msdStuEntryFind
 	}
 	else
 	{
-		if (dev->SwitchDevObj.STUObj.gstuFindSidEntry != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuFindSidEntry))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuFindSidEntry(dev, sid, stuEntry, found);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuFindSidEntry)(dev, sid, stuEntry, found);
 		}
 		else
 		{
@@ -264,9 +265,9 @@ MSD_STATUS msdStuEntryCountGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.STUObj.gstuGetEntryCount != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuGetEntryCount))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuGetEntryCount(dev, count);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuGetEntryCount)(dev, count);
 		}
 		else
 		{
@@ -312,9 +313,9 @@ MSD_STATUS msdStuDump
 	}
 	else
 	{
-		if (dev->SwitchDevObj.STUObj.gstuDump != NULL)
+		if (MSD_DEV_HAS(dev, STUObj, gstuDump))
 		{
-			retVal = dev->SwitchDevObj.STUObj.gstuDump(dev);
+			retVal = MSD_DEV_FN(dev, STUObj, gstuDump)(dev);
 		}
 		else
 		{
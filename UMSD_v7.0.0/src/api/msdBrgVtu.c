@@ -19,6 +19,7 @@
 #include <api/msdBrgVtu.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdVlanEntryFind
@@ -61,9 +62,9 @@ MSD_STATUS msdVlanEntryFind
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuFindVidEntry != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuFindVidEntry))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuFindVidEntry(dev, vlanId, entry, found);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuFindVidEntry)(dev, vlanId, entry, found);
 		}
 		else
 		{
@@ -113,9 +114,9 @@ MSD_STATUS msdVlanExists
     }
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuExistVidEntry != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuExistVidEntry))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuExistVidEntry(dev, vlanId, isExists);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuExistVidEntry)(dev, vlanId, isExists);
 		}
 		else
 		{
@@ -166,9 +167,9 @@ MSD_STATUS msdVlanEntryNextGet
 	else
 	{
 		vlanEntry->vid = vlanId;
-		if (dev->SwitchDevObj.VTUObj.gvtuGetEntryNext != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuGetEntryNext))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuGetEntryNext(dev, vlanEntry);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetEntryNext)(dev, vlanEntry);
 		}
 		else
 		{
@@ -215,9 +216,9 @@ MSD_STATUS msdVlanAllDelete
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuFlush != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuFlush))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuFlush(dev);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuFlush)(dev);
 		}
 		else
 		{
@@ -265,9 +266,9 @@ MSD_STATUS msdVlanEntryAdd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuAddEntry != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuAddEntry))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuAddEntry(dev, vtuEntry);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuAddEntry)(dev, vtuEntry);
 		}
 		else
 		{
@@ -315,9 +316,9 @@ MSD_STATUS msdVlanEntryDelete
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuDelEntry != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuDelEntry))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuDelEntry(dev, vlanId);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuDelEntry)(dev, vlanId);
 		}
 		else
 		{
@@ -365,9 +366,9 @@ MSD_STATUS msdVlanModeSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuSetMode != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuSetMode))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuSetMode(dev, vtuMode);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuSetMode)(dev, vtuMode);
 		}
 		else
 		{
@@ -414,9 +415,9 @@ MSD_STATUS msdVlanModeGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuGetMode != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuGetMode))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuGetMode(dev, vtuMode);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetMode)(dev, vtuMode);
 		}
 		else
 		{
@@ -463,9 +464,9 @@ MSD_STATUS msdVlanViolationGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuGetViolation != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuGetViolation))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuGetViolation(dev, vtuIntStatus);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetViolation)(dev, vtuIntStatus);
 		}
 		else
 		{
@@ -512,9 +513,9 @@ MSD_STATUS msdVlanEntryCountGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuGetEntryCount != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuGetEntryCount))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuGetEntryCount(dev, count);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetEntryCount)(dev, count);
 		}
 		else
 		{
@@ -568,9 +569,9 @@ MSD_STATUS msdVlanMemberTagSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuSetMemberTag != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuSetMemberTag))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuSetMemberTag(dev, vlanId, portNum, memberTag);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuSetMemberTag)(dev, vlanId, portNum, memberTag);
 		}
 		else
 		{
@@ -623,9 +624,9 @@ MSD_STATUS msdVlanMemberTagGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuGetMemberTag != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuGetMemberTag))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuGetMemberTag(dev, vlanId, portNum, memberTag);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetMemberTag)(dev, vlanId, portNum, memberTag);
 		}
 		else
 		{
@@ -671,9 +672,9 @@ MSD_STATUS msdVtuDump
 	}
 	else
 	{
-		if (dev->SwitchDevObj.VTUObj.gvtuDump != NULL)
+		if (MSD_DEV_HAS(dev, VTUObj, gvtuDump))
 		{
-			retVal = dev->SwitchDevObj.VTUObj.gvtuDump(dev);
+			retVal = MSD_DEV_FN(dev, VTUObj, gvtuDump)(dev);
 		}
 		else
 		{
@@ -20,6 +20,7 @@
 #include <api/msdEEPROM.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdEEPROMWrite
@@ -61,9 +62,9 @@ MSD_STATUS msdEEPROMWrite
 	}
 	else
 	{
-		if (dev->SwitchDevObj.EEPROMObj.geepromWrite != NULL)
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromWrite))
 		{
-			retVal = dev->SwitchDevObj.EEPROMObj.geepromWrite(dev, addr, data);
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromWrite)(dev, addr, data);
 		}
 		else
 		{
@@ -113,9 +114,9 @@ MSD_STATUS msdEEPROMRead
 	}
 	else
 	{
-		if (dev->SwitchDevObj.EEPROMObj.geepromRead != NULL)
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromRead))
 		{
-			retVal = dev->SwitchDevObj.EEPROMObj.geepromRead(dev, addr, data);
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromRead)(dev, addr, data);
 		}
 		else
 		{
@@ -164,9 +165,9 @@ MSD_STATUS msdEEPROMChipSelSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel != NULL)
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromSetMChipSel))
 		{
-			retVal = dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel(dev, chipSelect);
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromSetMChipSel)(dev, chipSelect);
 		}
 		else
 		{
@@ -215,9 +216,127 @@ MSD_STATUS msdEEPROMChipSelGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel != NULL)
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromGetMChipSel))
 		{
-			retVal = dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel(dev, chipSelect);
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromGetMChipSel)(dev, chipSelect);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdEEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a contiguous range of EEPROM data. The
+*       per-byte command/busy/data sequences are issued back to back under a
+*       single lock, and are packed into multi-register frames when the device
+*       is accessed over RMU.
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address to read
+*      count     - number of EEPROM addresses to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, count entries
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdEEPROMReadBlock
+(
+	IN  MSD_U8		devNum,
+	IN  MSD_U16		startAddr,
+	IN  MSD_U16		count,
+	OUT MSD_U16		*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		retVal = MSD_FAIL;
+	}
+	else
+	{
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromReadBlock))
+		{
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromReadBlock)(dev, startAddr, count, data);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdEEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a contiguous range of EEPROM data. The
+*       per-byte command/busy sequences are issued back to back under a single
+*       lock, and are packed into multi-register frames when the device is
+*       accessed over RMU. Optionally the range is read back and its CRC-16 is
+*       compared against the CRC-16 of the written data.
+*
+*
+* INPUTS:
+*      startAddr - first EEPROM address to write
+*      count     - number of EEPROM addresses to write
+*      data      - data to be written, count entries
+*      verify    - MSD_TRUE to read back and verify the written range
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error, or if the verify pass found a CRC mismatch
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdEEPROMWriteBlock
+(
+	IN  MSD_U8		devNum,
+	IN  MSD_U16		startAddr,
+	IN  MSD_U16		count,
+	IN  MSD_U16		*data,
+	IN  MSD_BOOL	verify
+)
+{
+	MSD_STATUS retVal;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		retVal = MSD_FAIL;
+	}
+	else
+	{
+		if (MSD_DEV_HAS(dev, EEPROMObj, geepromWriteBlock))
+		{
+			retVal = MSD_DEV_FN(dev, EEPROMObj, geepromWriteBlock)(dev, startAddr, count, data, verify);
 		}
 		else
 		{
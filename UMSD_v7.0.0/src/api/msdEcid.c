@@ -20,6 +20,7 @@
 #include <api/msdEcid.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdBpeEnableSet
@@ -60,9 +61,9 @@ MSD_STATUS msdBpeEnableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gBpeEnableSet != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gBpeEnableSet))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gBpeEnableSet(dev, en);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gBpeEnableSet)(dev, en);
 		}
 		else
 		{
@@ -110,9 +111,9 @@ MSD_STATUS msdBpeEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gBpeEnableGet != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gBpeEnableGet))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gBpeEnableGet(dev, en);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gBpeEnableGet)(dev, en);
 		}
 		else
 		{
@@ -161,9 +162,9 @@ MSD_STATUS msdEcidEntryAdd
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidAddEntry != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidAddEntry))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidAddEntry(dev, ecidEntry);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidAddEntry)(dev, ecidEntry);
 		}
 		else
 		{
@@ -211,9 +212,9 @@ MSD_STATUS msdEcidEntryAllDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidFlushAll))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidFlushAll)(dev);
 		}
 		else
 		{
@@ -264,9 +265,9 @@ MSD_STATUS msdEcidEntryMove
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidMove != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidMove))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidMove(dev, moveFrom, moveTo);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidMove)(dev, moveFrom, moveTo);
 		}
 		else
 		{
@@ -317,9 +318,9 @@ MSD_STATUS msdEcidEntryDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidFlushEntry != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidFlushEntry))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidFlushEntry(dev, group, ecid);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidFlushEntry)(dev, group, ecid);
 		}
 		else
 		{
@@ -372,9 +373,9 @@ MSD_STATUS msdEcidEntryNextGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidGetEcidEntryNext))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext(dev, group, ecid, ecidEntry);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidGetEcidEntryNext)(dev, group, ecid, ecidEntry);
 		}
 		else
 		{
@@ -428,9 +429,9 @@ MSD_STATUS msdEcidEntryFind
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidFindEcidEntry))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry(dev, group, ecid, ecidEntry, found);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidFindEcidEntry)(dev, group, ecid, ecidEntry, found);
 		}
 		else
 		{
@@ -479,9 +480,9 @@ MSD_STATUS msdEcidEntryCountGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidGetEntryCount != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidGetEntryCount))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidGetEntryCount(dev, count);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidGetEntryCount)(dev, count);
 		}
 		else
 		{
@@ -529,9 +530,9 @@ MSD_STATUS msdEcidDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.ECIDObj.gecidDump != NULL)
+		if (MSD_DEV_HAS(dev, ECIDObj, gecidDump))
 		{
-			retVal = dev->SwitchDevObj.ECIDObj.gecidDump(dev);
+			retVal = MSD_DEV_FN(dev, ECIDObj, gecidDump)(dev);
 		}
 		else
 		{
@@ -20,6 +20,8 @@
 #include <api/msdFRER.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <platform/msdSem.h>
+#include <driver/msdDevObj.h>
 
 /******************************************************************************
 * msdFrerSeqGenFlushAll
@@ -55,8 +57,8 @@ MSD_STATUS msdFrerSeqGenFlushAll
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushAll != NULL)
-        return dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushAll(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqGenFlushAll))
+        return MSD_DEV_FN(dev, FRERObj, gfrerSeqGenFlushAll)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -97,8 +99,8 @@ MSD_STATUS msdFrerSeqGenFlushEntry
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushEntry != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushEntry(dev, seqGenId);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqGenFlushEntry))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqGenFlushEntry)(dev, seqGenId);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -140,8 +142,8 @@ OUT MSD_FRER_SEQGEN	*seqGenData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqGenRead != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqGenRead(dev, seqGenId, seqGenData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqGenRead))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqGenRead)(dev, seqGenId, seqGenData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -182,8 +184,8 @@ IN  MSD_FRER_SEQGEN	*seqGenData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqGenLoad != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqGenLoad(dev, seqGenData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqGenLoad))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqGenLoad)(dev, seqGenData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -222,8 +224,8 @@ IN  MSD_U8          devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushAll != NULL)
-        return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushAll(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyFlushAll))
+        return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyFlushAll)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -264,8 +266,8 @@ IN  MSD_U8	indvRcvyId
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushEntry != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushEntry(dev, indvRcvyId);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyFlushEntry))
+		return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyFlushEntry)(dev, indvRcvyId);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -309,8 +311,8 @@ OUT MSD_U16	*indvRcvyResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyRead != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyRead(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyRead))
+		return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyRead)(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -351,8 +353,8 @@ IN MSD_FRER_INDVRCVY	*indvRcvyData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyLoad != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyLoad(dev, indvRcvyData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyLoad))
+		return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyLoad)(dev, indvRcvyData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -396,8 +398,8 @@ OUT MSD_U16	*indvRcvyResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyGetNext != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyGetNext(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyGetNext))
+		return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyGetNext)(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -441,8 +443,8 @@ OUT MSD_U16	*indvRcvyResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerIndvRcvyReadClear != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerIndvRcvyReadClear(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerIndvRcvyReadClear))
+		return MSD_DEV_FN(dev, FRERObj, gfrerIndvRcvyReadClear)(dev, indvRcvyId, indvRcvyData, indvRcvyResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -481,8 +483,8 @@ IN  MSD_U8          devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushAll != NULL)
-        return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushAll(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyFlushAll))
+        return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyFlushAll)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -523,8 +525,8 @@ IN  MSD_U8	seqRcvyId
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushEntry != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushEntry(dev, seqRcvyId);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyFlushEntry))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyFlushEntry)(dev, seqRcvyId);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -570,8 +572,8 @@ OUT MSD_U16	*latErrResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyRead != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyRead(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyRead))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyRead)(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -612,8 +614,8 @@ IN  MSD_FRER_SEQRCVY	*seqRcvyData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyLoad != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyLoad(dev, seqRcvyData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyLoad))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyLoad)(dev, seqRcvyData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -659,8 +661,8 @@ OUT MSD_U16	*latErrResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetNext != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetNext(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyGetNext))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyGetNext)(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -706,8 +708,8 @@ OUT MSD_U16	*latErrResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetViolation != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetViolation(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyGetViolation))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyGetViolation)(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -753,8 +755,8 @@ OUT MSD_U16	*latErrResets
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerSeqRcvyReadClear != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerSeqRcvyReadClear(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSeqRcvyReadClear))
+		return MSD_DEV_FN(dev, FRERObj, gfrerSeqRcvyReadClear)(dev, seqRcvyId, seqRcvyData, seqRcvyResets, latErrResets);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -793,8 +795,8 @@ IN  MSD_U8              devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushAll != NULL)
-        return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushAll(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrFlushAll))
+        return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrFlushAll)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -833,8 +835,8 @@ IN  MSD_U8	devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushEntry != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushEntry(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrFlushEntry))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrFlushEntry)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -878,8 +880,8 @@ OUT MSD_FRER_BANK0_COUNTER	*bk0SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrRead != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrRead(dev, bk0Id, bk0ConfigData, bk0SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrRead))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrRead)(dev, bk0Id, bk0ConfigData, bk0SCtrData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -920,8 +922,8 @@ IN MSD_FRER_BANK0_CONFIG	*bk0ConfigData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrLoad != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrLoad(dev, bk0ConfigData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrLoad))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrLoad)(dev, bk0ConfigData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -964,8 +966,8 @@ OUT MSD_FRER_BANK0_COUNTER	*bk0SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrGetNext != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrGetNext(dev, bk0Id, bk0ConfigData, bk0SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrGetNext))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrGetNext)(dev, bk0Id, bk0ConfigData, bk0SCtrData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1009,8 +1011,8 @@ OUT MSD_FRER_BANK0_COUNTER	*bk0SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank0SCtrReadClear != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank0SCtrReadClear(dev, bk0Id, bk0ConfigData, bk0SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank0SCtrReadClear))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank0SCtrReadClear)(dev, bk0Id, bk0ConfigData, bk0SCtrData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1049,8 +1051,8 @@ IN  MSD_U8	devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushAll != NULL)
-        return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushAll(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrFlushAll))
+        return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrFlushAll)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1089,8 +1091,8 @@ IN  MSD_U8	devNum
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushEntry != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushEntry(dev);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrFlushEntry))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrFlushEntry)(dev);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1134,8 +1136,8 @@ OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrRead != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrRead(dev, bk1Id, bk1ConfigData, bk1SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrRead))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrRead)(dev, bk1Id, bk1ConfigData, bk1SCtrData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1176,8 +1178,8 @@ IN MSD_FRER_BANK1_CONFIG	*bk1ConfigData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrLoad != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrLoad(dev, bk1ConfigData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrLoad))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrLoad)(dev, bk1ConfigData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1221,8 +1223,8 @@ OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrGetNext != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrGetNext(dev, bk1Id, bk1ConfigData, bk1SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrGetNext))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrGetNext)(dev, bk1Id, bk1ConfigData, bk1SCtrData);
     else
         return MSD_NOT_SUPPORTED;
 }
@@ -1266,8 +1268,441 @@ OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
         return MSD_FAIL;
     }
 
-    if (dev->SwitchDevObj.FRERObj.gfrerBank1SCtrReadClear != NULL)
-		return dev->SwitchDevObj.FRERObj.gfrerBank1SCtrReadClear(dev, bk1Id, bk1ConfigData, bk1SCtrData);
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerBank1SCtrReadClear))
+		return MSD_DEV_FN(dev, FRERObj, gfrerBank1SCtrReadClear)(dev, bk1Id, bk1ConfigData, bk1SCtrData);
     else
         return MSD_NOT_SUPPORTED;
-}
\ No newline at end of file
+}
+
+/* MSD_TRUE if instance id of the given table is valid in the snapshot */
+static MSD_BOOL msdFrerSnapshotIdValid
+(
+IN  MSD_FRER_SNAPSHOT	*snap,
+IN  MSD_FRER_SNAPSHOT_TABLE	table,
+IN  MSD_U32	id
+)
+{
+	MSD_U32 vec;
+
+	switch (table)
+	{
+	case MSD_FRER_SNAPSHOT_SEQ_RCVY:
+		vec = snap->seqRcvyVec[id / 32U];
+		break;
+	case MSD_FRER_SNAPSHOT_INDV_RCVY:
+		vec = snap->indvRcvyVec[id / 32U];
+		break;
+	case MSD_FRER_SNAPSHOT_BANK0:
+		vec = (id < MSD_FRER_MAX_STREAM_CTR) ? snap->bank0Vec : 0U;
+		break;
+	case MSD_FRER_SNAPSHOT_BANK1:
+		vec = (id < MSD_FRER_MAX_STREAM_CTR) ? snap->bank1Vec : 0U;
+		break;
+	default:
+		vec = 0;
+		break;
+	}
+
+	return ((vec & ((MSD_U32)1 << (id % 32U))) != 0U) ? MSD_TRUE : MSD_FALSE;
+}
+
+/******************************************************************************
+* msdFrerSnapshotAttach
+*
+* DESCRIPTION:
+*        This routine attaches a snapshot cache to the device.
+*
+* INPUTS:
+*        devNum - physical device number
+*        cache  - cache memory, owned by the caller until msdFrerSnapshotDetach
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_ALREADY_EXIST - if the device has a cache already
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotAttach
+(
+IN  MSD_U8	devNum,
+IN  MSD_FRER_SNAPSHOT_CACHE	*cache
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (!MSD_DEV_HAS(dev, FRERObj, gfrerSnapshotRefresh))
+        return MSD_NOT_SUPPORTED;
+
+    if (cache == NULL)
+    {
+        MSD_DBG_ERROR(("cache is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    if (dev->frerCache != NULL)
+    {
+        MSD_DBG_ERROR(("FRER snapshot cache already exists.\n"));
+        return MSD_ALREADY_EXIST;
+    }
+
+    msdMemSet((void*)cache, 0, sizeof(MSD_FRER_SNAPSHOT_CACHE));
+    if ((cache->lockSem = msdSemCreate(devNum, MSD_SEM_FULL)) == 0U)
+    {
+        MSD_DBG_ERROR(("lockSem semCreate Failed.\n"));
+        return MSD_FAIL;
+    }
+
+    msdSemTake(dev->devNum, dev->frerRegsSem, OS_WAIT_FOREVER);
+    dev->frerCache = cache;
+    msdSemGive(dev->devNum, dev->frerRegsSem);
+
+    return MSD_OK;
+}
+
+/******************************************************************************
+* msdFrerSnapshotDetach
+*
+* DESCRIPTION:
+*        This routine detaches the snapshot cache of the device.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if the device has no cache
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotDetach
+(
+IN  MSD_U8	devNum
+)
+{
+    MSD_FRER_SNAPSHOT_CACHE *cache;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    /* wait for a refresh in progress */
+    msdSemTake(dev->devNum, dev->frerRegsSem, OS_WAIT_FOREVER);
+    cache = dev->frerCache;
+    dev->frerCache = NULL;
+    msdSemGive(dev->devNum, dev->frerRegsSem);
+
+    if (cache == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    return msdSemDelete(devNum, cache->lockSem);
+}
+
+/******************************************************************************
+* msdFrerSnapshotRefresh
+*
+* DESCRIPTION:
+*        This routine captures all sequence recovery and individual recovery
+*        instances and both stream counter banks in one pass under the FRER
+*        register lock, and stores them in the snapshot cache of the device.
+*
+* INPUTS:
+*        devNum     - physical device number
+*
+* OUTPUTS:
+*        generation - generation of the new snapshot, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotRefresh
+(
+IN  MSD_U8	devNum,
+OUT MSD_U32	*generation
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (MSD_DEV_HAS(dev, FRERObj, gfrerSnapshotRefresh))
+        return MSD_DEV_FN(dev, FRERObj, gfrerSnapshotRefresh)(dev, generation);
+    else
+        return MSD_NOT_SUPPORTED;
+}
+
+/******************************************************************************
+* msdFrerSnapshotGet
+*
+* DESCRIPTION:
+*        This routine copies the snapshot cache of the device.
+*
+* INPUTS:
+*        devNum   - physical device number
+*
+* OUTPUTS:
+*        snapshot - cached snapshot, generation is 0 if none was taken yet
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotGet
+(
+IN  MSD_U8	devNum,
+OUT MSD_FRER_SNAPSHOT	*snapshot
+)
+{
+    MSD_FRER_SNAPSHOT_CACHE *cache;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (!MSD_DEV_HAS(dev, FRERObj, gfrerSnapshotRefresh))
+        return MSD_NOT_SUPPORTED;
+
+    if (snapshot == NULL)
+    {
+        MSD_DBG_ERROR(("snapshot is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    if ((cache = dev->frerCache) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdSemTake(dev->devNum, cache->lockSem, OS_WAIT_FOREVER);
+    msdMemCpy((void*)snapshot, (void*)&cache->snap[cache->active], sizeof(MSD_FRER_SNAPSHOT));
+    msdSemGive(dev->devNum, cache->lockSem);
+
+    return MSD_OK;
+}
+
+/******************************************************************************
+* msdFrerSnapshotIterStart
+*
+* DESCRIPTION:
+*        This routine starts a walk over the valid instances of the cached
+*        snapshot.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        iter   - iterator positioned before the first instance
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if no snapshot cache is attached or no snapshot was
+*                      taken yet
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotIterStart
+(
+IN  MSD_U8	devNum,
+OUT MSD_FRER_SNAPSHOT_ITER	*iter
+)
+{
+    MSD_FRER_SNAPSHOT_CACHE *cache;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (!MSD_DEV_HAS(dev, FRERObj, gfrerSnapshotRefresh))
+        return MSD_NOT_SUPPORTED;
+
+    if (iter == NULL)
+    {
+        MSD_DBG_ERROR(("iter is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    if ((cache = dev->frerCache) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    msdSemTake(dev->devNum, cache->lockSem, OS_WAIT_FOREVER);
+    iter->generation = cache->snap[cache->active].generation;
+    msdSemGive(dev->devNum, cache->lockSem);
+
+    iter->table = MSD_FRER_SNAPSHOT_SEQ_RCVY;
+    iter->nextId = 0;
+
+    return (iter->generation == 0U) ? MSD_NO_SUCH : MSD_OK;
+}
+
+/******************************************************************************
+* msdFrerSnapshotGetNext
+*
+* DESCRIPTION:
+*        This routine returns the next valid instance of the cached snapshot.
+*
+* INPUTS:
+*        devNum - physical device number
+*        iter   - iterator set up by msdFrerSnapshotIterStart
+*
+* OUTPUTS:
+*        iter   - iterator advanced past the returned instance
+*        entry  - instance data
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if there are no more instances or no snapshot cache
+*                      is attached
+*        MSD_BUSY    - if the snapshot was refreshed since the walk started
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdFrerSnapshotGetNext
+(
+IN    MSD_U8	devNum,
+INOUT MSD_FRER_SNAPSHOT_ITER	*iter,
+OUT   MSD_FRER_SNAPSHOT_ENTRY	*entry
+)
+{
+    MSD_STATUS retVal;
+    MSD_FRER_SNAPSHOT_CACHE *cache;
+    MSD_FRER_SNAPSHOT *snap;
+    MSD_U32 maxId;
+    MSD_U32 id;
+
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    if (!MSD_DEV_HAS(dev, FRERObj, gfrerSnapshotRefresh))
+        return MSD_NOT_SUPPORTED;
+
+    if ((iter == NULL) || (entry == NULL))
+    {
+        MSD_DBG_ERROR(("iter or entry is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    if ((cache = dev->frerCache) == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+    retVal = MSD_NO_SUCH;
+
+    msdSemTake(dev->devNum, cache->lockSem, OS_WAIT_FOREVER);
+    snap = &cache->snap[cache->active];
+
+    if (iter->generation != snap->generation)
+    {
+        retVal = MSD_BUSY;
+    }
+
+    while ((retVal == MSD_NO_SUCH) && (iter->table < MSD_FRER_SNAPSHOT_TABLE_NUM))
+    {
+        maxId = ((iter->table == MSD_FRER_SNAPSHOT_SEQ_RCVY) || (iter->table == MSD_FRER_SNAPSHOT_INDV_RCVY)) ?
+            MSD_FRER_MAX_RCVY : MSD_FRER_MAX_STREAM_CTR;
+
+        for (id = iter->nextId; id < maxId; id++)
+        {
+            if (msdFrerSnapshotIdValid(snap, iter->table, id) == MSD_TRUE)
+            {
+                break;
+            }
+        }
+
+        if (id < maxId)
+        {
+            msdMemSet((void*)entry, 0, sizeof(MSD_FRER_SNAPSHOT_ENTRY));
+            entry->table = iter->table;
+            entry->id = (MSD_U8)id;
+            switch (iter->table)
+            {
+            case MSD_FRER_SNAPSHOT_SEQ_RCVY:
+                entry->seqRcvy = snap->seqRcvy[id];
+                entry->seqRcvyResets = snap->seqRcvyResets[id];
+                entry->latErrResets = snap->latErrResets[id];
+                break;
+            case MSD_FRER_SNAPSHOT_INDV_RCVY:
+                entry->indvRcvy = snap->indvRcvy[id];
+                entry->indvRcvyResets = snap->indvRcvyResets[id];
+                break;
+            case MSD_FRER_SNAPSHOT_BANK0:
+                entry->bank0Config = snap->bank0Config[id];
+                entry->bank0Total = snap->bank0Total[id];
+                break;
+            default:
+                entry->bank1Config = snap->bank1Config[id];
+                entry->bank1Total = snap->bank1Total[id];
+                break;
+            }
+            iter->nextId = id + 1U;
+            retVal = MSD_OK;
+        }
+        else
+        {
+            iter->table = (MSD_FRER_SNAPSHOT_TABLE)((MSD_U32)iter->table + 1U);
+            iter->nextId = 0;
+        }
+    }
+
+    msdSemGive(dev->devNum, cache->lockSem);
+
+    return retVal;
+}
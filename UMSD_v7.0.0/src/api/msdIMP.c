@@ -20,6 +20,7 @@
 #include <api/msdIMP.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdImpRun
@@ -60,9 +61,9 @@ MSD_STATUS msdImpRun
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impRun != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impRun))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impRun(dev, addr);
+			retVal = MSD_DEV_FN(dev, IMPObj, impRun)(dev, addr);
 		}
 		else
 		{
@@ -110,9 +111,9 @@ MSD_STATUS msdImpReset
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impReset != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impReset))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impReset(dev);
+			retVal = MSD_DEV_FN(dev, IMPObj, impReset)(dev);
 		}
 		else
 		{
@@ -164,9 +165,9 @@ MSD_STATUS msdImpWriteEEPROM
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impWriteEEPROM != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impWriteEEPROM))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impWriteEEPROM(dev, addr, data);
+			retVal = MSD_DEV_FN(dev, IMPObj, impWriteEEPROM)(dev, addr, data);
 		}
 		else
 		{
@@ -218,9 +219,9 @@ MSD_STATUS msdImpLoadToEEPROM
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impLoadToEEPROM != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impLoadToEEPROM))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impLoadToEEPROM(dev, dataSize, data);
+			retVal = MSD_DEV_FN(dev, IMPObj, impLoadToEEPROM)(dev, dataSize, data);
 		}
 		else
 		{
@@ -274,9 +275,9 @@ MSD_STATUS msdImpLoadToRAM
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impLoadToRAM != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impLoadToRAM))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impLoadToRAM(dev, addr, dataSize, data);
+			retVal = MSD_DEV_FN(dev, IMPObj, impLoadToRAM)(dev, addr, dataSize, data);
 		}
 		else
 		{
@@ -324,9 +325,9 @@ MSD_STATUS msdImpStop
 	}
 	else
 	{
-		if (dev->SwitchDevObj.IMPObj.impStop != NULL)
+		if (MSD_DEV_HAS(dev, IMPObj, impStop))
 		{
-			retVal = dev->SwitchDevObj.IMPObj.impStop(dev);
+			retVal = MSD_DEV_FN(dev, IMPObj, impStop)(dev);
 		}
 		else
 		{
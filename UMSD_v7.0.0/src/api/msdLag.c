@@ -0,0 +1,389 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+
+/********************************************************************************
+* msdLag.c
+*
+* DESCRIPTION:
+*       API definitions for the LAG manager, built on the Trunk functionality.
+*
+* DEPENDENCIES:
+*       None.
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#include <api/msdLag.h>
+#include <driver/msdApiTypes.h>
+#include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
+
+/*******************************************************************************
+* msdLagCompute
+*
+* DESCRIPTION:
+*       This function computes the complete trunk configuration for a set of
+*       LAGs without accessing the device.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       groups    - LAG membership, one entry per LAG
+*       numGroups - number of entries in groups
+*       linkUpVec - logical port vector of the ports whose link is up
+*
+* OUTPUTS:
+*       config - computed trunk configuration, hashTrunk is set to MSD_TRUE
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagCompute
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_GROUP  *groups,
+    IN  MSD_U32  numGroups,
+    IN  MSD_U32  linkUpVec,
+    OUT MSD_LAG_CONFIG  *config
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_U32 memberVec = 0;
+    MSD_U32 g, i;
+    MSD_LPORT port;
+    MSD_LPORT member[MSD_MAX_SWITCH_PORTS];
+    MSD_U32 maskCount[MSD_MAX_SWITCH_PORTS];
+    MSD_U32 numMember;
+    MSD_U32 sel;
+    MSD_U32 best;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == config) || ((numGroups != 0U) && (NULL == groups)))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemSet((void*)config, 0, sizeof(MSD_LAG_CONFIG));
+    config->hashTrunk = MSD_TRUE;
+
+    for (g = 0; g < numGroups; g++)
+    {
+        if ((groups[g].trunkId >= MSD_LAG_MAX_TRUNK_ID) ||
+            ((config->routeVec & ((MSD_U32)1 << groups[g].trunkId)) != 0U))
+        {
+            MSD_DBG_ERROR(("Bad or duplicated trunkId %u.\n", groups[g].trunkId));
+            return MSD_BAD_PARAM;
+        }
+        if ((groups[g].memberVec == 0U) ||
+            ((groups[g].memberVec & ~dev->validPortVec) != 0U) ||
+            ((groups[g].memberVec & memberVec) != 0U))
+        {
+            MSD_DBG_ERROR(("Bad member vector 0x%x for trunkId %u.\n", groups[g].memberVec, groups[g].trunkId));
+            return MSD_BAD_PARAM;
+        }
+
+        memberVec |= groups[g].memberVec;
+        config->routeVec |= (MSD_U32)1 << groups[g].trunkId;
+        config->trunkRoute[groups[g].trunkId] = groups[g].memberVec & linkUpVec;
+        for (port = 0; port < MSD_MAX_SWITCH_PORTS; port++)
+        {
+            if ((groups[g].memberVec & ((MSD_U32)1 << port)) != 0U)
+            {
+                config->portTrunkId[port] = groups[g].trunkId;
+            }
+        }
+    }
+    config->lagPortVec = memberVec;
+
+    /* ports outside of any LAG are enabled in every mask */
+    for (i = 0; i < MSD_LAG_MASK_NUM; i++)
+    {
+        config->maskTable[i] = dev->validPortVec & ~memberVec;
+    }
+
+    for (g = 0; g < numGroups; g++)
+    {
+        numMember = 0;
+        for (port = 0; port < MSD_MAX_SWITCH_PORTS; port++)
+        {
+            if ((groups[g].memberVec & ((MSD_U32)1 << port)) != 0U)
+            {
+                member[numMember] = port;
+                maskCount[numMember] = 0;
+                numMember++;
+            }
+        }
+
+        /* spread the masks over all members, count the ones owned by link up members */
+        for (i = 0; i < MSD_LAG_MASK_NUM; i++)
+        {
+            sel = i % numMember;
+            if ((linkUpVec & ((MSD_U32)1 << member[sel])) != 0U)
+            {
+                config->maskTable[i] |= (MSD_U32)1 << member[sel];
+                maskCount[sel]++;
+            }
+        }
+
+        /* hand the masks of link down members to the least loaded link up member */
+        for (i = 0; i < MSD_LAG_MASK_NUM; i++)
+        {
+            if ((linkUpVec & ((MSD_U32)1 << member[i % numMember])) != 0U)
+            {
+                continue;
+            }
+
+            best = numMember;
+            for (sel = 0; sel < numMember; sel++)
+            {
+                if (((linkUpVec & ((MSD_U32)1 << member[sel])) != 0U) &&
+                    ((best == numMember) || (maskCount[sel] < maskCount[best])))
+                {
+                    best = sel;
+                }
+            }
+            if (best != numMember)
+            {
+                config->maskTable[i] |= (MSD_U32)1 << member[best];
+                maskCount[best]++;
+            }
+        }
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdLagCommit
+*
+* DESCRIPTION:
+*       This function programs a trunk configuration, writing only the entries
+*       that differ from the configuration committed last.
+*
+* INPUTS:
+*       devNum - physical device number
+*       config - trunk configuration, normally produced by msdLagCompute
+*
+* OUTPUTS:
+*       numWrites - number of table entries written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagCommit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_CONFIG  *config,
+    OUT MSD_U32  *numWrites
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_LAG_CONFIG *old;
+    MSD_BOOL full;
+    MSD_BOOL oldEn, newEn;
+    MSD_U32 writes = 0;
+    MSD_U32 i;
+    MSD_LPORT port;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (NULL == config)
+    {
+        MSD_DBG_ERROR(("Input param config is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if ((!MSD_DEV_HAS(dev, TrunkObj, gsysSetTrunkMaskTable)) ||
+        (!MSD_DEV_HAS(dev, TrunkObj, gsysSetHashTrunk)) ||
+        (!MSD_DEV_HAS(dev, TrunkObj, gsysSetTrunkRouting)) ||
+        (!MSD_DEV_HAS(dev, TrunkObj, gprtSetTrunkPort)))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    old = &dev->lagShadow.config;
+    full = (dev->lagShadow.valid == MSD_TRUE) ? MSD_FALSE : MSD_TRUE;
+    /* a partly written configuration is unknown until this commit completes */
+    dev->lagShadow.valid = MSD_FALSE;
+
+    for (i = 0; (retVal == MSD_OK) && (i < MSD_LAG_MASK_NUM); i++)
+    {
+        if ((full == MSD_TRUE) || (old->maskTable[i] != config->maskTable[i]))
+        {
+            retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetTrunkMaskTable)(dev, i, config->maskTable[i]);
+            writes++;
+        }
+    }
+
+    if ((retVal == MSD_OK) && ((full == MSD_TRUE) || (old->hashTrunk != config->hashTrunk)))
+    {
+        retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetHashTrunk)(dev, config->hashTrunk);
+        writes++;
+    }
+
+    for (i = 0; (retVal == MSD_OK) && (i < MSD_LAG_MAX_TRUNK_ID); i++)
+    {
+        if ((config->routeVec & ((MSD_U32)1 << i)) != 0U)
+        {
+            if ((full == MSD_TRUE) || ((old->routeVec & ((MSD_U32)1 << i)) == 0U) ||
+                (old->trunkRoute[i] != config->trunkRoute[i]))
+            {
+                retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetTrunkRouting)(dev, i, config->trunkRoute[i]);
+                writes++;
+            }
+        }
+        else if ((full == MSD_FALSE) && ((old->routeVec & ((MSD_U32)1 << i)) != 0U) && (old->trunkRoute[i] != 0U))
+        {
+            /* the LAG is gone, stop routing to its former members */
+            retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetTrunkRouting)(dev, i, 0);
+            writes++;
+        }
+        else
+        {
+            /* not managed */
+        }
+    }
+
+    for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts); port++)
+    {
+        if ((dev->validPortVec & ((MSD_U32)1 << port)) == 0U)
+        {
+            continue;
+        }
+        newEn = ((config->lagPortVec & ((MSD_U32)1 << port)) != 0U) ? MSD_TRUE : MSD_FALSE;
+        oldEn = ((old->lagPortVec & ((MSD_U32)1 << port)) != 0U) ? MSD_TRUE : MSD_FALSE;
+        if ((full == MSD_TRUE) || (newEn != oldEn) ||
+            ((newEn == MSD_TRUE) && (old->portTrunkId[port] != config->portTrunkId[port])))
+        {
+            retVal = MSD_DEV_FN(dev, TrunkObj, gprtSetTrunkPort)(dev, port, newEn,
+                (newEn == MSD_TRUE) ? config->portTrunkId[port] : 0U);
+            writes++;
+        }
+    }
+
+    if (retVal == MSD_OK)
+    {
+        msdMemCpy((void*)old, (const void*)config, sizeof(MSD_LAG_CONFIG));
+        dev->lagShadow.valid = MSD_TRUE;
+    }
+    else
+    {
+        MSD_DBG_ERROR(("msdLagCommit failed after %u writes: %s.\n", writes, msdDisplayStatus(retVal)));
+    }
+
+    if (numWrites != NULL)
+    {
+        *numWrites = writes;
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdLagUpdate
+*
+* DESCRIPTION:
+*       This function computes the trunk configuration for the given LAG
+*       membership and link state and commits the entries that changed.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       groups    - LAG membership, one entry per LAG
+*       numGroups - number of entries in groups
+*       linkUpVec - logical port vector of the ports whose link is up
+*
+* OUTPUTS:
+*       numWrites - number of table entries written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagUpdate
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_LAG_GROUP  *groups,
+    IN  MSD_U32  numGroups,
+    IN  MSD_U32  linkUpVec,
+    OUT MSD_U32  *numWrites
+)
+{
+    MSD_STATUS retVal;
+    MSD_LAG_CONFIG config;
+
+    retVal = msdLagCompute(devNum, groups, numGroups, linkUpVec, &config);
+    if (retVal == MSD_OK)
+    {
+        retVal = msdLagCommit(devNum, &config, numWrites);
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdLagInvalidate
+*
+* DESCRIPTION:
+*       This function drops the configuration remembered by msdLagCommit, so
+*       that the next commit rewrites every entry.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdLagInvalidate
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+    dev->lagShadow.valid = MSD_FALSE;
+    return MSD_OK;
+}
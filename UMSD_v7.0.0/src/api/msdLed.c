@@ -19,7 +19,8 @@
 
 #include <api/msdLed.h>
 #include <driver/msdApiTypes.h>
-#include <utils/msdUtils.h>
+#include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdLedForceOn
@@ -66,9 +67,9 @@ IN  MSD_U8    ledNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledForceOn != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledForceOn))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledForceOn(dev, portNum, ledNum);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledForceOn)(dev, portNum, ledNum);
 		}
 		else
 		{
@@ -124,9 +125,9 @@ IN  MSD_U8    ledNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledForceOff != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledForceOff))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledForceOff(dev, portNum, ledNum);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledForceOff)(dev, portNum, ledNum);
 		}
 		else
 		{
@@ -183,9 +184,9 @@ IN  MSD_U8    ledNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledLinkAct != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledLinkAct))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledLinkAct(dev, portNum, ledNum);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledLinkAct)(dev, portNum, ledNum);
 		}
 		else
 		{
@@ -261,9 +262,9 @@ IN  MSD_U8    ledMode
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledModeSet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledModeSet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledModeSet(dev, portNum, ledNum, ledMode);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledModeSet)(dev, portNum, ledNum, ledMode);
 		}
 		else
 		{
@@ -336,9 +337,9 @@ OUT  MSD_U8    *ledMode
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledModeGet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledModeGet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledModeGet(dev, portNum, ledNum, ledMode);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledModeGet)(dev, portNum, ledNum, ledMode);
 		}
 		else
 		{
@@ -394,9 +395,9 @@ IN  MSD_LED_BLINK_RATE    rate
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledBlinkRateSet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledBlinkRateSet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledBlinkRateSet(dev, portNum, rate);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledBlinkRateSet)(dev, portNum, rate);
 		}
 		else
 		{
@@ -451,9 +452,9 @@ OUT  MSD_LED_BLINK_RATE    *rate
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledBlinkRateGet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledBlinkRateGet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledBlinkRateGet(dev, portNum, rate);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledBlinkRateGet)(dev, portNum, rate);
 		}
 		else
 		{
@@ -509,9 +510,9 @@ IN  MSD_LED_STRETCH_DURATION duration
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledPulseStretchSet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledPulseStretchSet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledPulseStretchSet(dev, portNum, duration);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledPulseStretchSet)(dev, portNum, duration);
 		}
 		else
 		{
@@ -566,9 +567,9 @@ OUT  MSD_LED_STRETCH_DURATION    *duration
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledPulseStretchGet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledPulseStretchGet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledPulseStretchGet(dev, portNum, duration);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledPulseStretchGet)(dev, portNum, duration);
 		}
 		else
 		{
@@ -624,9 +625,9 @@ IN  MSD_U16  portVect
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledSpecialModeSet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledSpecialModeSet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledSpecialModeSet(dev, mode, portVect);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledSpecialModeSet)(dev, mode, portVect);
 		}
 		else
 		{
@@ -681,9 +682,9 @@ OUT  MSD_U16	*portVect
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledSpecialModeGet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledSpecialModeGet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledSpecialModeGet(dev, mode, portVect);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledSpecialModeGet)(dev, mode, portVect);
 		}
 		else
 		{
@@ -741,9 +742,9 @@ IN  MSD_U16	data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledCtrlSet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledCtrlSet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledCtrlSet(dev, portNum, pointer, data);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledCtrlSet)(dev, portNum, pointer, data);
 		}
 		else
 		{
@@ -800,9 +801,9 @@ OUT MSD_U16	*data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledCtrlGet != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledCtrlGet))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledCtrlGet(dev, portNum, pointer, data);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledCtrlGet)(dev, portNum, pointer, data);
 		}
 		else
 		{
@@ -854,9 +855,9 @@ IN  MSD_U8  devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.LEDObj.gledDump != NULL)
+		if (MSD_DEV_HAS(dev, LEDObj, gledDump))
 		{
-			retVal = dev->SwitchDevObj.LEDObj.gledDump(dev);
+			retVal = MSD_DEV_FN(dev, LEDObj, gledDump)(dev);
 		}
 		else
 		{
@@ -18,8 +18,10 @@
 *******************************************************************************/
 
 #include <api/msdMACSec.h>
+#include <api/msdPTP.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /******************************************************************************
 * DESCRIPTION:
@@ -55,9 +57,9 @@ MSD_STATUS msdMacSecRead
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecRead != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecRead))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecRead(*dev, regAddr, data);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecRead)(dev, regAddr, data);
 		}
 		else
 		{
@@ -102,9 +104,9 @@ MSD_STATUS msdMacSecWrite
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecWrite != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecWrite))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecWrite(*dev, regAddr, data);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecWrite)(dev, regAddr, data);
 		}
 		else
 		{
@@ -150,9 +152,9 @@ MSD_STATUS msdMacSecFlushAll
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecFlushAll))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecFlushAll)(dev);
 		}
 		else
 		{
@@ -194,9 +196,9 @@ MSD_STATUS msdMacSecGetEvent
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetEvent != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetEvent))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetEvent(dev, event);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetEvent)(dev, event);
 		}
 		else
 		{
@@ -246,9 +248,9 @@ MSD_STATUS msdMacSecCreateRule
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateRule != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateRule))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateRule(dev, ruleIndex, rule);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateRule)(dev, ruleIndex, rule);
 		}
 		else
 		{
@@ -296,9 +298,9 @@ MSD_STATUS msdMacSecDeleteRule
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteRule != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteRule))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteRule(dev, ruleIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteRule)(dev, ruleIndex);
 		}
 		else
 		{
@@ -347,9 +349,9 @@ MSD_STATUS msdMacSecGetRule
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRule != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRule))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRule(dev, ruleIndex, rule);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRule)(dev, ruleIndex, rule);
 		}
 		else
 		{
@@ -399,9 +401,9 @@ MSD_STATUS msdMacSecCreateRxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateRxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSecY(dev, secYIndex, secY);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateRxSecY)(dev, secYIndex, secY);
 		}
 		else
 		{
@@ -451,9 +453,9 @@ MSD_STATUS msdMacSecCreateTxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateTxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSecY(dev, secYIndex, secY);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateTxSecY)(dev, secYIndex, secY);
 		}
 		else
 		{
@@ -496,9 +498,9 @@ MSD_STATUS msdMacSecDeleteTxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteTxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSecY(dev, secYIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteTxSecY)(dev, secYIndex);
 		}
 		else
 		{
@@ -541,9 +543,9 @@ MSD_STATUS msdMacSecDeleteRxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteRxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSecY(dev, secYIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteRxSecY)(dev, secYIndex);
 		}
 		else
 		{
@@ -587,9 +589,9 @@ MSD_STATUS msdMacSecGetTxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxSecY(dev, secYIndex, secY);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxSecY)(dev, secYIndex, secY);
 		}
 		else
 		{
@@ -633,9 +635,9 @@ MSD_STATUS msdMacSecGetRxSecY
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRxSecY != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRxSecY))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRxSecY(dev, secYIndex, secY);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRxSecY)(dev, secYIndex, secY);
 		}
 		else
 		{
@@ -680,9 +682,9 @@ MSD_STATUS msdMacSecCreateRxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateRxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSC(dev, scIndex, rxSC);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateRxSC)(dev, scIndex, rxSC);
 		}
 		else
 		{
@@ -725,9 +727,9 @@ MSD_STATUS msdMacSecDeleteRxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteRxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSC(dev, scIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteRxSC)(dev, scIndex);
 		}
 		else
 		{
@@ -770,9 +772,9 @@ MSD_STATUS msdMacSecGetRxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRxSC(dev, scIndex, rxSC);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRxSC)(dev, scIndex, rxSC);
 		}
 		else
 		{
@@ -817,9 +819,9 @@ MSD_STATUS msdMacSecCreateRxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateRxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSA(dev, saIndex, rxSA);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateRxSA)(dev, saIndex, rxSA);
 		}
 		else
 		{
@@ -862,9 +864,9 @@ MSD_STATUS msdMacSecDeleteRxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteRxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSA(dev, saIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteRxSA)(dev, saIndex);
 		}
 		else
 		{
@@ -907,9 +909,9 @@ MSD_STATUS msdMacSecGetRxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRxSA(dev, saIndex, rxSA);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRxSA)(dev, saIndex, rxSA);
 		}
 		else
 		{
@@ -954,9 +956,9 @@ MSD_STATUS msdMacSecCreateTxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateTxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSC(dev, scIndex, txSC);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateTxSC)(dev, scIndex, txSC);
 		}
 		else
 		{
@@ -999,9 +1001,9 @@ MSD_STATUS msdMacSecDeleteTxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteTxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSC(dev, scIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteTxSC)(dev, scIndex);
 		}
 		else
 		{
@@ -1045,9 +1047,9 @@ MSD_STATUS msdMacSecGetTxSC
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxSC != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxSC))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxSC(dev, scIndex, txSC);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxSC)(dev, scIndex, txSC);
 		}
 		else
 		{
@@ -1092,9 +1094,9 @@ MSD_STATUS msdMacSecCreateTxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecCreateTxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSA(dev, saIndex, txSA);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecCreateTxSA)(dev, saIndex, txSA);
 		}
 		else
 		{
@@ -1137,9 +1139,9 @@ MSD_STATUS msdMacSecDeleteTxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecDeleteTxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSA(dev, saIndex);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecDeleteTxSA)(dev, saIndex);
 		}
 		else
 		{
@@ -1183,9 +1185,9 @@ MSD_STATUS msdMacSecGetTxSA
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxSA != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxSA))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxSA(dev, saIndex, txSA);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxSA)(dev, saIndex, txSA);
 		}
 		else
 		{
@@ -1231,9 +1233,9 @@ MSD_STATUS msdMacSecGetRXSCStates
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRXSCStates != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRXSCStates))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRXSCStates(dev, scCounterIndex, autoClear, states);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRXSCStates)(dev, scCounterIndex, autoClear, states);
 		}
 		else
 		{
@@ -1279,9 +1281,9 @@ MSD_STATUS msdMacSecGetRXSecYStates
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRXSecYStates != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRXSecYStates))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRXSecYStates(dev, secYCounterIndex, autoClear, states);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRXSecYStates)(dev, secYCounterIndex, autoClear, states);
 		}
 		else
 		{
@@ -1326,9 +1328,9 @@ MSD_STATUS msdMacSecGetTXSCStates
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTXSCStates != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTXSCStates))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTXSCStates(dev, scCounterIndex, autoClear, states);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTXSCStates)(dev, scCounterIndex, autoClear, states);
 		}
 		else
 		{
@@ -1374,9 +1376,9 @@ MSD_STATUS msdMacSecGetTXSecYStates
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTXSecYStates != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTXSecYStates))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTXSecYStates(dev, secYCounterIndex, autoClear, states);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTXSecYStates)(dev, secYCounterIndex, autoClear, states);
 		}
 		else
 		{
@@ -1421,9 +1423,9 @@ MSD_STATUS msdMacSecEnableEgressSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressSet != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecEnableEgressSet))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressSet(dev, portNum, isEnable);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecEnableEgressSet)(dev, portNum, isEnable);
 		}
 		else
 		{
@@ -1468,9 +1470,9 @@ MSD_STATUS msdMacSecEnableIngressSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressSet != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecEnableIngressSet))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressSet(dev, portNum, isEnable);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecEnableIngressSet)(dev, portNum, isEnable);
 		}
 		else
 		{
@@ -1515,9 +1517,9 @@ MSD_STATUS msdMacSecEnableIngressGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressGet != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecEnableIngressGet))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressGet(dev, portNum, isEnable);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecEnableIngressGet)(dev, portNum, isEnable);
 		}
 		else
 		{
@@ -1562,9 +1564,9 @@ MSD_STATUS msdMacSecEnableEgressGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressGet != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecEnableEgressGet))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressGet(dev, portNum, isEnable);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecEnableEgressGet)(dev, portNum, isEnable);
 		}
 		else
 		{
@@ -1608,9 +1610,9 @@ MSD_STATUS msdMacSecSetTxPNThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecSetTxPNThreshold != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecSetTxPNThreshold))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecSetTxPNThreshold(dev, pnThr);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecSetTxPNThreshold)(dev, pnThr);
 		}
 		else
 		{
@@ -1653,10 +1655,10 @@ MSD_STATUS msdMacSecGetTxPNThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxPNThreshold != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxPNThreshold))
 		{
 			
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxPNThreshold(dev, pnThr);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxPNThreshold)(dev, pnThr);
 		}
 		else
 		{
@@ -1700,9 +1702,9 @@ MSD_STATUS msdMacSecSetTxXPNThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecSetTxXPNThreshold != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecSetTxXPNThreshold))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecSetTxXPNThreshold(dev, xpnThr);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecSetTxXPNThreshold)(dev, xpnThr);
 		}
 		else
 		{
@@ -1744,10 +1746,10 @@ MSD_STATUS msdMacSecGetTxXPNThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxXPNThreshold != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxXPNThreshold))
 		{
 
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxXPNThreshold(dev, xpnThr);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxXPNThreshold)(dev, xpnThr);
 		}
 		else
 		{
@@ -1792,9 +1794,9 @@ MSD_STATUS msdMacSecSetRxDefaultSCI
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecSetRxDefaultSCI != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecSetRxDefaultSCI))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecSetRxDefaultSCI(dev, portNum, defaultRxSCI);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecSetRxDefaultSCI)(dev, portNum, defaultRxSCI);
 		}
 		else
 		{
@@ -1838,9 +1840,9 @@ MSD_STATUS msdMacSecGetRxDefaultSCI
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetRxDefaultSCI != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetRxDefaultSCI))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetRxDefaultSCI(dev, portNum, defaultRxSCI);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetRxDefaultSCI)(dev, portNum, defaultRxSCI);
 		}
 		else
 		{
@@ -1885,9 +1887,9 @@ MSD_STATUS msdMacSecSetTxSCIntCtrl
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecSetTxSCIntCtrl != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecSetTxSCIntCtrl))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecSetTxSCIntCtrl(dev, index, txscIntCtrl);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecSetTxSCIntCtrl)(dev, index, txscIntCtrl);
 		}
 		else
 		{
@@ -1932,9 +1934,9 @@ MSD_STATUS msdMacSecGetTxSCIntCtrl
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetTxSCIntCtrl != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetTxSCIntCtrl))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetTxSCIntCtrl(dev, index, txscIntCtrl);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetTxSCIntCtrl)(dev, index, txscIntCtrl);
 		}
 		else
 		{
@@ -1981,9 +1983,9 @@ MSD_STATUS msdMacSecGetNextTxSCIntStatus
 	}
 	else
 	{
-		if (dev->SwitchDevObj.MACSECObj.gmacsecGetNextTxSCIntStatus != NULL)
+		if (MSD_DEV_HAS(dev, MACSECObj, gmacsecGetNextTxSCIntStatus))
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecGetNextTxSCIntStatus(dev, index, isAutoClear, nextIndex, txscInt);
+			retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetNextTxSCIntStatus)(dev, index, isAutoClear, nextIndex, txscInt);
 		}
 		else
 		{
@@ -1992,4 +1994,442 @@ MSD_STATUS msdMacSecGetNextTxSCIntStatus
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+/* RX SC slot receiving a new SA: a free slot, else the slot that does not
+ * hold the association number used before the new one */
+static MSD_U8 msdMacSecRekeyRxSlot
+(
+	IN MSD_MSEC_RX_SC* rxSC,
+	IN MSD_U8 an
+)
+{
+	MSD_U8 prevAn = (MSD_U8)((an + 3U) & 0x3U);
+
+	if (rxSC->sa0Valid != MSD_TRUE)
+	{
+		return 0;
+	}
+	if (rxSC->sa1Valid != MSD_TRUE)
+	{
+		return 1;
+	}
+	return (rxSC->sa0An == prevAn) ? 1 : 0;
+}
+
+/******************************************************************************
+DESCRIPTION:
+	This function pre-stages the next SA set of a number of TX secure
+	channels. RX SAs and TX SAs are created and the RX SCs accept both
+	keys on return; the TX SC entries are only prepared.
+
+INPUTS:
+	devNum  - physical device number
+	numSC   - number of entries in scIndex and stage
+	scIndex - TX SC index of every channel
+	stage   - next SA set of every channel
+	pnThr   - TX PN threshold to program, 0 to keep the current one
+
+OUTPUTS:
+	None
+
+RETURNS:
+	MSD_STATUS
+
+COMMENTS:
+	None
+******************************************************************************/
+MSD_STATUS msdMacSecRekeyStage
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U8  numSC,
+	IN  MSD_U8  *scIndex,
+	IN  MSD_MACSEC_REKEY_SA *stage,
+	IN  MSD_U32 pnThr
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_MSEC_RX_SC rxSC;
+	MSD_MSEC_TX_SC txSC;
+	MSD_MACSEC_INT_CONTROL_TXSC intCtrl;
+	MSD_U8 i, sc;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	if ((scIndex == NULL) || (stage == NULL))
+	{
+		MSD_DBG_ERROR(("Input param in msdMacSecRekeyStage is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+	for (i = 0; i < numSC; i++)
+	{
+		if ((scIndex[i] >= MSD_MACSEC_MAX_TX_SC) || (stage[i].an > 3U))
+		{
+			MSD_DBG_ERROR(("Bad scIndex %u or an %u.\n", scIndex[i], stage[i].an));
+			return MSD_BAD_PARAM;
+		}
+	}
+
+	if (pnThr != 0)
+	{
+		retVal = msdMacSecSetTxPNThreshold(devNum, pnThr);
+	}
+
+	for (i = 0; (i < numSC) && (retVal == MSD_OK); i++)
+	{
+		sc = scIndex[i];
+		dev->macsecRekey.stagedVec &= ~((MSD_U32)1 << sc);
+
+		/* the receiver takes the new key before the peer starts using it */
+		retVal = msdMacSecCreateRxSA(devNum, stage[i].rxSAIndex, &stage[i].rxSA);
+		if (retVal == MSD_OK)
+		{
+			retVal = msdMacSecGetRxSC(devNum, stage[i].rxSCIndex, &rxSC);
+		}
+		if (retVal == MSD_OK)
+		{
+			if (msdMacSecRekeyRxSlot(&rxSC, stage[i].an) == 0)
+			{
+				rxSC.sa0Index = stage[i].rxSAIndex;
+				rxSC.sa0An = stage[i].an;
+				rxSC.sa0Valid = MSD_TRUE;
+			}
+			else
+			{
+				rxSC.sa1Index = stage[i].rxSAIndex;
+				rxSC.sa1An = stage[i].an;
+				rxSC.sa1Valid = MSD_TRUE;
+			}
+			retVal = msdMacSecCreateRxSC(devNum, stage[i].rxSCIndex, &rxSC);
+		}
+
+		if (retVal == MSD_OK)
+		{
+			retVal = msdMacSecCreateTxSA(devNum, stage[i].txSAIndex, &stage[i].txSA);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = msdMacSecGetTxSC(devNum, sc, &txSC);
+		}
+		if ((retVal == MSD_OK) && (stage[i].pnThrTrigger == MSD_TRUE))
+		{
+			retVal = msdMacSecGetTxSCIntCtrl(devNum, sc, &intCtrl);
+			if (retVal == MSD_OK)
+			{
+				intCtrl.txPNThrIntEn = MSD_TRUE;
+				retVal = msdMacSecSetTxSCIntCtrl(devNum, sc, &intCtrl);
+			}
+		}
+		if (retVal == MSD_OK)
+		{
+			/* the new SA goes to the inactive slot, which becomes the active one */
+			if (txSC.isActiveSA1 == MSD_TRUE)
+			{
+				txSC.sa0Index = stage[i].txSAIndex;
+				txSC.sa0An = stage[i].an;
+				txSC.sa0Valid = MSD_TRUE;
+				txSC.isActiveSA1 = MSD_FALSE;
+			}
+			else
+			{
+				txSC.sa1Index = stage[i].txSAIndex;
+				txSC.sa1An = stage[i].an;
+				txSC.sa1Valid = MSD_TRUE;
+				txSC.isActiveSA1 = MSD_TRUE;
+			}
+			msdMemCpy(&dev->macsecRekey.txSC[sc], &txSC, sizeof(MSD_MSEC_TX_SC));
+			dev->macsecRekey.stagedVec |= (MSD_U32)1 << sc;
+		}
+	}
+
+	return retVal;
+}
+
+/******************************************************************************
+DESCRIPTION:
+	This function switches the given TX secure channels to their staged SA.
+
+INPUTS:
+	devNum - physical device number
+	scVec  - vector of the TX SC indexes to switch
+
+OUTPUTS:
+	result - switched channels and switch latency, may be NULL
+
+RETURNS:
+	MSD_STATUS
+
+COMMENTS:
+	None
+******************************************************************************/
+MSD_STATUS msdMacSecRekeySwitch
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32 scVec,
+	OUT MSD_MACSEC_REKEY_RESULT *result
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U32 start = 0;
+	MSD_U32 now = 0;
+	MSD_BOOL timed = MSD_FALSE;
+	MSD_U8 sc;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	if ((scVec & ~dev->macsecRekey.stagedVec) != 0)
+	{
+		MSD_DBG_ERROR(("TX SC vector 0x%x holds channels without a staged SA.\n", (unsigned int)scVec));
+		return MSD_BAD_PARAM;
+	}
+
+	if (result != NULL)
+	{
+		msdMemSet(result, 0, sizeof(MSD_MACSEC_REKEY_RESULT));
+		timed = (msdGetPTPGlobalTime(devNum, &start) == MSD_OK) ? MSD_TRUE : MSD_FALSE;
+	}
+
+	/* everything else is staged, one TX SC entry write per channel */
+	for (sc = 0; sc < MSD_MACSEC_MAX_TX_SC; sc++)
+	{
+		if ((scVec & ((MSD_U32)1 << sc)) == 0)
+		{
+			continue;
+		}
+		retVal = msdMacSecCreateTxSC(devNum, sc, &dev->macsecRekey.txSC[sc]);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+		dev->macsecRekey.stagedVec &= ~((MSD_U32)1 << sc);
+
+		if (result != NULL)
+		{
+			result->switchedVec |= (MSD_U32)1 << sc;
+		}
+	}
+
+	if ((timed == MSD_TRUE) && (msdGetPTPGlobalTime(devNum, &now) == MSD_OK))
+	{
+		result->latency = now - start;
+	}
+
+	return retVal;
+}
+
+/******************************************************************************
+DESCRIPTION:
+	This function switches every staged TX secure channel whose PN
+	threshold interrupt is pending, and clears the interrupt status of the
+	switched channels only.
+
+INPUTS:
+	devNum - physical device number
+
+OUTPUTS:
+	result - switched channels and switch latency, may be NULL
+
+RETURNS:
+	MSD_STATUS
+
+COMMENTS:
+	None
+******************************************************************************/
+MSD_STATUS msdMacSecRekeyService
+(
+	IN  MSD_U8  devNum,
+	OUT MSD_MACSEC_REKEY_RESULT *result
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_MACSEC_INT_TXSC txscInt;
+	MSD_U32 scVec = 0;
+	MSD_U32 doneVec;
+	MSD_U8 index = 0;
+	MSD_U8 next = 0;
+	MSD_U8 sc;
+	MSD_STATUS clrVal;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	/* read without auto clear, other channels keep their pending interrupts */
+	while (index < MSD_MACSEC_MAX_TX_SC)
+	{
+		retVal = msdMacSecGetNextTxSCIntStatus(devNum, index, MSD_FALSE, &next, &txscInt);
+		if (retVal == MSD_NO_SUCH)
+		{
+			retVal = MSD_OK;
+			break;
+		}
+		if ((retVal != MSD_OK) || (next < index) || (next >= MSD_MACSEC_MAX_TX_SC))
+		{
+			break;
+		}
+		if (txscInt.txPNThrInt == MSD_TRUE)
+		{
+			scVec |= (MSD_U32)1 << next;
+		}
+		index = next + 1;
+	}
+
+	if (result != NULL)
+	{
+		msdMemSet(result, 0, sizeof(MSD_MACSEC_REKEY_RESULT));
+	}
+	scVec &= dev->macsecRekey.stagedVec;
+	if ((retVal != MSD_OK) || (scVec == 0))
+	{
+		return retVal;
+	}
+
+	retVal = msdMacSecRekeySwitch(devNum, scVec, result);
+
+	/* the status is latched, so an auto clear get next started at a
+	 * switched channel that was pending finds and clears that channel */
+	doneVec = scVec & ~dev->macsecRekey.stagedVec;
+	for (sc = 0; sc < MSD_MACSEC_MAX_TX_SC; sc++)
+	{
+		if ((doneVec & ((MSD_U32)1 << sc)) == 0)
+		{
+			continue;
+		}
+		clrVal = msdMacSecGetNextTxSCIntStatus(devNum, sc, MSD_TRUE, &next, &txscInt);
+		if (clrVal == MSD_NO_SUCH)
+		{
+			clrVal = MSD_OK;
+		}
+		else if ((clrVal == MSD_OK) && (next != sc))
+		{
+			MSD_DBG_ERROR(("TX SC %u interrupt cleared at index %u.\n", (unsigned int)sc, (unsigned int)next));
+			clrVal = MSD_FAIL;
+		}
+		if ((clrVal != MSD_OK) && (retVal == MSD_OK))
+		{
+			retVal = clrVal;
+		}
+	}
+
+	return retVal;
+}
+
+/* Accumulate one counter set: octet counters are 64 bits, the others wrap at 32 bits */
+static void msdMacSecStatsAccumulate
+(
+	IN MSD_U64 *now,
+	INOUT MSD_U64 *raw,
+	INOUT MSD_U64 *total,
+	OUT MSD_U64 *delta,
+	IN MSD_U32 numOctet,
+	IN MSD_U32 numCnt,
+	IN MSD_BOOL first
+)
+{
+	MSD_U32 i;
+	MSD_U64 diff;
+
+	for (i = 0; i < numCnt; i++)
+	{
+		diff = (first == MSD_TRUE) ? now[i] : (now[i] - raw[i]);
+		if (i >= numOctet)
+		{
+			diff &= 0xFFFFFFFFU;
+		}
+		raw[i] = now[i];
+		total[i] += diff;
+		if (delta != NULL)
+		{
+			delta[i] = diff;
+		}
+	}
+}
+
+/******************************************************************************
+DESCRIPTION:
+	This function reads the SecY and SC counters of the given counter
+	indexes in one pass and accumulates their change into 64-bit totals.
+
+INPUTS:
+	devNum     - physical device number
+	counterVec - vector of the counter indexes to read
+	ctx        - statistics context
+
+OUTPUTS:
+	ctx   - raw counter values and updated totals
+	delta - change since the previous snapshot, may be NULL
+
+RETURNS:
+	MSD_STATUS
+
+COMMENTS:
+	None
+******************************************************************************/
+MSD_STATUS msdMacSecStatsSnapshot
+(
+	IN  MSD_U8  devNum,
+	IN  MSD_U32 counterVec,
+	INOUT MSD_MACSEC_STATS_CTX *ctx,
+	OUT MSD_MACSEC_STATS *delta
+)
+{
+	MSD_STATUS retVal;
+	MSD_MACSEC_STATS now;
+	MSD_BOOL first;
+	MSD_U32 index;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	if (ctx == NULL)
+	{
+		MSD_DBG_ERROR(("Input param ctx in msdMacSecStatsSnapshot is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+	if (!MSD_DEV_HAS(dev, MACSECObj, gmacsecGetStatsBulk))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+
+	retVal = MSD_DEV_FN(dev, MACSECObj, gmacsecGetStatsBulk)(dev, counterVec, &now);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	if (delta != NULL)
+	{
+		msdMemSet(delta, 0, sizeof(MSD_MACSEC_STATS));
+		delta->counterVec = now.counterVec;
+	}
+	for (index = 0; index < MSD_MACSEC_MAX_COUNTER_INDEX; index++)
+	{
+		if ((now.counterVec & (1U << index)) == 0)
+		{
+			continue;
+		}
+		first = ((ctx->raw.counterVec & (1U << index)) == 0) ? MSD_TRUE : MSD_FALSE;
+		msdMacSecStatsAccumulate(now.rxSecY[index], ctx->raw.rxSecY[index], ctx->total.rxSecY[index],
+			(delta != NULL) ? delta->rxSecY[index] : NULL, MSD_MSEC_SECY_OCTET_CNT_NUM, MSD_MSEC_RX_SECY_CNT_NUM, first);
+		msdMacSecStatsAccumulate(now.txSecY[index], ctx->raw.txSecY[index], ctx->total.txSecY[index],
+			(delta != NULL) ? delta->txSecY[index] : NULL, MSD_MSEC_SECY_OCTET_CNT_NUM, MSD_MSEC_TX_SECY_CNT_NUM, first);
+		msdMacSecStatsAccumulate(now.rxSC[index], ctx->raw.rxSC[index], ctx->total.rxSC[index],
+			(delta != NULL) ? delta->rxSC[index] : NULL, 0, MSD_MSEC_RX_SC_CNT_NUM, first);
+		msdMacSecStatsAccumulate(now.txSC[index], ctx->raw.txSC[index], ctx->total.txSC[index],
+			(delta != NULL) ? delta->txSC[index] : NULL, 0, MSD_MSEC_TX_SC_CNT_NUM, first);
+	}
+	ctx->raw.counterVec |= now.counterVec;
+	ctx->total.counterVec |= now.counterVec;
+
+	return retVal;
+}
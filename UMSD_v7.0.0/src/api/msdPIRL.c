@@ -20,6 +20,7 @@
 #include <api/msdPIRL.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdIRLReset
@@ -57,9 +58,9 @@ MSD_STATUS msdIRLReset
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlInitialize != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlInitialize))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlInitialize(dev);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlInitialize)(dev);
 		}
 		else
 		{
@@ -110,9 +111,9 @@ MSD_STATUS msdIRLInitResourceCounter
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlInitResource != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlInitResource))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlInitResource(dev, irlPort, irlRes);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlInitResource)(dev, irlPort, irlRes);
 		}
 		else
 		{
@@ -178,9 +179,9 @@ MSD_STATUS msdIRLCustomSetup
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlCustomSetup != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlCustomSetup))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlCustomSetup(tgtRate, tgtBstSize, countMode, customSetup);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlCustomSetup)(tgtRate, tgtBstSize, countMode, customSetup);
 		}
 		else
 		{
@@ -232,9 +233,9 @@ MSD_STATUS msdIRLResourceRead
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlReadResource != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlReadResource))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlReadResource(dev, irlPort, irlRes, pirlData);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlReadResource)(dev, irlPort, irlRes, pirlData);
 		}
 		else
 		{
@@ -287,9 +288,9 @@ MSD_STATUS msdIRLResourceWrite
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlWriteResource != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlWriteResource))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlWriteResource(dev, irlPort, irlRes, pirlData);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlWriteResource)(dev, irlPort, irlRes, pirlData);
 		}
 		else
 		{
@@ -300,6 +301,77 @@ MSD_STATUS msdIRLResourceWrite
 	return retVal;
 }
 
+/*******************************************************************************
+* msdIRLResourceBulkWrite
+*
+* DESCRIPTION:
+*       This function writes the same resource bucket parameter to every
+*       selected resource of every selected port.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       portVec  - logical port vector of the target ports
+*       resVec   - resource vector, bit n selects resource unit n
+*       pirlData - IRL Resource data
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdIRLResourceBulkWrite
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  portVec,
+    IN  MSD_U32  resVec,
+    IN  MSD_PIRL_DATA  *pirlData
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_LPORT port;
+	MSD_U32 res;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	if ((NULL == pirlData) || ((portVec & ~dev->validPortVec) != 0U))
+	{
+		MSD_DBG_ERROR(("Bad pirlData or portVec 0x%x.\n", portVec));
+		return MSD_BAD_PARAM;
+	}
+	if (!MSD_DEV_HAS(dev, PIRLObj, gpirlWriteResource))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+
+	for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts); port++)
+	{
+		if ((portVec & ((MSD_U32)1 << port)) == 0U)
+		{
+			continue;
+		}
+		for (res = 0; (retVal == MSD_OK) && (res < 32U); res++)
+		{
+			if ((resVec & ((MSD_U32)1 << res)) != 0U)
+			{
+				retVal = MSD_DEV_FN(dev, PIRLObj, gpirlWriteResource)(dev, port, res, pirlData);
+			}
+		}
+	}
+
+	return retVal;
+}
+
 /*******************************************************************************
 * msdIRLResRegGet
 *
@@ -343,9 +415,9 @@ MSD_STATUS msdIRLResRegGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlGetResReg != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlGetResReg))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlGetResReg(dev, irlPort, irlRes, regOffset, data);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlGetResReg)(dev, irlPort, irlRes, regOffset, data);
 		}
 		else
 		{
@@ -399,9 +471,9 @@ MSD_STATUS msdIRLResRegSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlSetResReg != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlSetResReg))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlSetResReg(dev, irlPort, irlRes, regOffset, data);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlSetResReg)(dev, irlPort, irlRes, regOffset, data);
 		}
 		else
 		{
@@ -461,9 +533,9 @@ MSD_STATUS msdIRLAdvConfig
     }
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlAdvConfig != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlAdvConfig))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlAdvConfig(dev, irlPort, irlRes, tgtRate, tgtBstSize, countMode, pktTypeOrPri);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlAdvConfig)(dev, irlPort, irlRes, tgtRate, tgtBstSize, countMode, pktTypeOrPri);
 		}
 		else
 		{
@@ -514,9 +586,9 @@ MSD_STATUS msdIRLAdvConfigDisable
     }
 	else
 	{
-		if (dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable != NULL)
+		if (MSD_DEV_HAS(dev, PIRLObj, gpirlAdvConfigDisable))
 		{
-			retVal = dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable(dev, irlPort, irlRes);
+			retVal = MSD_DEV_FN(dev, PIRLObj, gpirlAdvConfigDisable)(dev, irlPort, irlRes);
 		}
 		else
 		{
@@ -20,6 +20,7 @@
 #include <api/msdPTP.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdPtpIntEnableSet
@@ -62,9 +63,9 @@ MSD_STATUS msdPtpIntEnableSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetIntEnable != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetIntEnable))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetIntEnable(dev, portNum, interruptEn);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetIntEnable)(dev, portNum, interruptEn);
         }
         else
         {
@@ -115,9 +116,9 @@ MSD_STATUS msdPtpIntEnableGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetIntEnable != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetIntEnable))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetIntEnable(dev, portNum, interruptEn);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetIntEnable)(dev, portNum, interruptEn);
         }
         else
         {
@@ -167,9 +168,9 @@ MSD_STATUS msdPtpPortPTPEnSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetProtPTPEn))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn(dev, portNum, en);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetProtPTPEn)(dev, portNum, en);
         }
         else
         {
@@ -218,9 +219,9 @@ MSD_STATUS msdPtpPortPTPEnGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetProtPTPEn))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn(dev, portNum, en);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetProtPTPEn)(dev, portNum, en);
         }
         else
         {
@@ -270,9 +271,9 @@ MSD_STATUS msdPtpPortConfigSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetPortConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetPortConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetPortConfig(dev, portNum, ptpData);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetPortConfig)(dev, portNum, ptpData);
         }
         else
         {
@@ -321,9 +322,9 @@ MSD_STATUS msdPtpPortConfigGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetPortConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetPortConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetPortConfig(dev, portNum, ptpData);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetPortConfig)(dev, portNum, ptpData);
         }
         else
         {
@@ -376,9 +377,9 @@ MSD_STATUS msdPtpTimeStampGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetTimeStamp != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetTimeStamp))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetTimeStamp(dev, portNum, timeToRead, ptpStatus);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetTimeStamp)(dev, portNum, timeToRead, ptpStatus);
         }
         else
         {
@@ -429,9 +430,9 @@ MSD_STATUS msdPtpTSValidStGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetTSValidSt != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetTSValidSt))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetTSValidSt(dev, portNum, timeToRead, isValid);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetTSValidSt)(dev, portNum, timeToRead, isValid);
         }
         else
         {
@@ -482,9 +483,9 @@ MSD_STATUS msdPtpTimeStampReset
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpResetTimeStamp != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpResetTimeStamp))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpResetTimeStamp(dev, portNum, timeToReset);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpResetTimeStamp)(dev, portNum, timeToReset);
         }
         else
         {
@@ -495,6 +496,180 @@ MSD_STATUS msdPtpTimeStampReset
     return retVal;
 }
 
+/*******************************************************************************
+* msdPtpTimeStampHarvest
+*
+* DESCRIPTION:
+*       This routine collects the valid time stamps of a set of ports in one
+*       sweep, clears them on the device in the same sequence and appends
+*       them to a time stamp queue.
+*
+* INPUTS:
+*       portVec   - logical port vector of the ports to sweep
+*       timeMask  - bit n set to sweep MSD_PTP_TIME n (Arr0, Arr1, Dep, Dep1)
+*       queue     - time stamp queue, set up by msdPtpTsQueueInit
+*
+* OUTPUTS:
+*       numHarvested - number of time stamps appended to queue, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTimeStampHarvest
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_U32    portVec,
+    IN  MSD_U8    timeMask,
+    INOUT MSD_PTP_TS_QUEUE    *queue,
+    OUT MSD_U32    *numHarvested
+)
+{
+    MSD_STATUS retVal;
+    MSD_PTP_TS_EVENT events[MSD_PTP_TS_HARVEST_MAX];
+    MSD_U32 numEvents = 0;
+    MSD_U32 head;
+    MSD_U32 i;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+
+    if (numHarvested != NULL)
+    {
+        *numHarvested = 0;
+    }
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+    else if (queue == NULL)
+    {
+        MSD_DBG_ERROR(("queue is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        if (MSD_DEV_HAS(dev, PTPObj, gptpTimeStampHarvest))
+        {
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpTimeStampHarvest)(dev, portVec, timeMask, events, &numEvents);
+        }
+        else
+        {
+            retVal = MSD_NOT_SUPPORTED;
+        }
+
+        /* time stamps read before an error are already cleared, queue them too */
+        for (i = 0; i < numEvents; i++)
+        {
+            head = queue->head;
+            if ((head - queue->tail) >= MSD_PTP_TS_QUEUE_SIZE)
+            {
+                queue->dropped++;
+                continue;
+            }
+            queue->event[head & (MSD_PTP_TS_QUEUE_SIZE - 1U)] = events[i];
+            MSD_MEM_BARRIER();
+            queue->head = head + 1U;
+            if (numHarvested != NULL)
+            {
+                (*numHarvested)++;
+            }
+        }
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdPtpTsQueueInit
+*
+* DESCRIPTION:
+*       This routine empties a time stamp queue.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       queue - empty time stamp queue
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTsQueueInit
+(
+    OUT MSD_PTP_TS_QUEUE    *queue
+)
+{
+    if (queue == NULL)
+    {
+        MSD_DBG_ERROR(("queue is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemSet((void*)queue, 0, sizeof(MSD_PTP_TS_QUEUE));
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdPtpTsQueuePop
+*
+* DESCRIPTION:
+*       This routine takes the oldest time stamp from a time stamp queue.
+*
+* INPUTS:
+*       queue - time stamp queue
+*
+* OUTPUTS:
+*       event - oldest time stamp
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_NO_SUCH - if the queue is empty
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdPtpTsQueuePop
+(
+    INOUT MSD_PTP_TS_QUEUE    *queue,
+    OUT MSD_PTP_TS_EVENT    *event
+)
+{
+    MSD_U32 tail;
+
+    if ((queue == NULL) || (event == NULL))
+    {
+        MSD_DBG_ERROR(("queue or event is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    tail = queue->tail;
+    if (tail == queue->head)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    MSD_MEM_BARRIER();
+    *event = queue->event[tail & (MSD_PTP_TS_QUEUE_SIZE - 1U)];
+    MSD_MEM_BARRIER();
+    queue->tail = tail + 1U;
+
+    return MSD_OK;
+}
+
 /*******************************************************************************
 * msdPtpGlobalConfigSet
 *
@@ -532,9 +707,9 @@ MSD_STATUS msdPtpGlobalConfigSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetGlobalConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig(dev, ptpData);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetGlobalConfig)(dev, ptpData);
         }
         else
         {
@@ -581,9 +756,9 @@ MSD_STATUS msdPtpGlobalConfigGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetGlobalConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig(dev, ptpData);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetGlobalConfig)(dev, ptpData);
         }
         else
         {
@@ -635,9 +810,9 @@ MSD_STATUS msdPtpIntStatusGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetIntStatus != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetIntStatus))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetIntStatus(dev, ptpIntSt);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetIntStatus)(dev, ptpIntSt);
         }
         else
         {
@@ -687,9 +862,9 @@ MSD_STATUS msdPtpMeanPathDelaySet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetMeanPathDelay))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay(dev, portNum, delay);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetMeanPathDelay)(dev, portNum, delay);
         }
         else
         {
@@ -738,9 +913,9 @@ MSD_STATUS msdPtpMeanPathDelayGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetMeanPathDelay))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay(dev, portNum, delay);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetMeanPathDelay)(dev, portNum, delay);
         }
         else
         {
@@ -795,9 +970,9 @@ MSD_STATUS msdPtpIgrPathDelayAsymSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetIgrPathDelayAsym))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym(dev, portNum, asym);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetIgrPathDelayAsym)(dev, portNum, asym);
         }
         else
         {
@@ -851,9 +1026,9 @@ MSD_STATUS msdPtpIgrPathDelayAsymGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetIgrPathDelayAsym))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym(dev, portNum, asym);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetIgrPathDelayAsym)(dev, portNum, asym);
         }
         else
         {
@@ -908,9 +1083,9 @@ MSD_STATUS msdPtpEgrPathDelayAsymSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetEgrPathDelayAsym))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym(dev, portNum, asym);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetEgrPathDelayAsym)(dev, portNum, asym);
         }
         else
         {
@@ -964,9 +1139,9 @@ MSD_STATUS msdPtpEgrPathDelayAsymGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetEgrPathDelayAsym))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym(dev, portNum, asym);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetEgrPathDelayAsym)(dev, portNum, asym);
         }
         else
         {
@@ -1020,9 +1195,9 @@ MSD_STATUS msdPtpModeSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetMode != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetMode))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetMode(dev, mode);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetMode)(dev, mode);
         }
         else
         {
@@ -1076,9 +1251,9 @@ MSD_STATUS msdPtpModeGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetMode != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetMode))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetMode(dev, mode);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetMode)(dev, mode);
         }
         else
         {
@@ -1126,9 +1301,9 @@ MSD_STATUS msdPtpMasterSlaveSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetMasterSlave != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetMasterSlave))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetMasterSlave(dev, role);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetMasterSlave)(dev, role);
         }
         else
         {
@@ -1175,9 +1350,9 @@ MSD_STATUS msdPtpMasterSlaveGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetMasterSlave != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetMasterSlave))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetMasterSlave(dev, role);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetMasterSlave)(dev, role);
         }
         else
         {
@@ -1224,9 +1399,9 @@ MSD_STATUS msdPtpTODBusyBitStatusGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetTODBusyBitStatus))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus(dev, busyStatus);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetTODBusyBitStatus)(dev, busyStatus);
         }
         else
         {
@@ -1282,9 +1457,9 @@ MSD_STATUS msdPtpTODStoreCompensation
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpTODStoreCompensation))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation(dev, timeArrayIndex, timeArray);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpTODStoreCompensation)(dev, timeArrayIndex, timeArray);
         }
         else
         {
@@ -1340,9 +1515,9 @@ MSD_STATUS msdPtpTODStoreAll
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpTODStoreAll != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpTODStoreAll))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpTODStoreAll(dev, timeArrayIndex, timeArray);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpTODStoreAll)(dev, timeArrayIndex, timeArray);
         }
         else
         {
@@ -1397,9 +1572,9 @@ MSD_STATUS msdPtpTODCaptureAll
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpTODCaptureAll != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpTODCaptureAll))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpTODCaptureAll(dev, timeArrayIndex, timeArray);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpTODCaptureAll)(dev, timeArrayIndex, timeArray);
         }
         else
         {
@@ -1453,9 +1628,9 @@ MSD_STATUS msdPtpPulseSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetPulse != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetPulse))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetPulse(dev, pulsePara);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetPulse)(dev, pulsePara);
         }
         else
         {
@@ -1508,9 +1683,9 @@ MSD_STATUS msdPtpPulseGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetPulse != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetPulse))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetPulse(dev, pulsePara);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetPulse)(dev, pulsePara);
         }
         else
         {
@@ -1558,9 +1733,67 @@ MSD_STATUS msdGetPTPGlobalTime
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gtaiGetPTPGlobalTime))
+        {
+            retVal = MSD_DEV_FN(dev, PTPObj, gtaiGetPTPGlobalTime)(dev, ptpTime);
+        }
+        else
+        {
+            retVal = MSD_NOT_SUPPORTED;
+        }
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdPtpGlobalTimeSampleGet
+*
+* DESCRIPTION:
+*       This routine reads the PTP global time bracketed by host monotonic time
+*       stamps, for correlating the switch clock with the host clock.
+*       The PTP register lock is taken before the first host time stamp, and
+*       only the shortest access sequence is inside the bracket. The read is
+*       repeated numReads times and the read with the narrowest bracket is
+*       returned.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       numReads - number of reads, 1 to MSD_PTP_TIME_SAMPLE_MAX
+*
+* OUTPUTS:
+*       sample   - PTP global time, host time of the capture and its uncertainty
+*
+* RETURNS:
+*       MSD_OK - On success
+*       MSD_FAIL - On error
+*       MSD_BAD_PARAM - If invalid parameter is given
+*       MSD_NOT_SUPPORTED - Device not support, or no getHostTime function
+*                           was registered in MSD_BSP_FUNCTIONS
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS msdPtpGlobalTimeSampleGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32 numReads,
+    OUT MSD_PTP_TIME_SAMPLE *sample
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+    else
+    {
+        if (MSD_DEV_HAS(dev, PTPObj, gtaiGetPTPGlobalTimeSample))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime(dev, ptpTime);
+            retVal = MSD_DEV_FN(dev, PTPObj, gtaiGetPTPGlobalTimeSample)(dev, numReads, sample);
         }
         else
         {
@@ -1588,9 +1821,9 @@ MSD_STATUS msdPtpPortRegGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetPortReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetPortReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetPortReg(dev, portNum, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetPortReg)(dev, portNum, regOffset, data);
         }
         else
         {
@@ -1618,9 +1851,9 @@ MSD_STATUS msdPtpPortRegSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetPortReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetPortReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetPortReg(dev, portNum, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetPortReg)(dev, portNum, regOffset, data);
         }
         else
         {
@@ -1647,9 +1880,9 @@ MSD_STATUS msdPtpGlobalRegGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetGlobalReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetGlobalReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetGlobalReg(dev, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetGlobalReg)(dev, regOffset, data);
         }
         else
         {
@@ -1676,9 +1909,9 @@ MSD_STATUS msdPtpGlobalRegSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetGlobalReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetGlobalReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetGlobalReg(dev, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetGlobalReg)(dev, regOffset, data);
         }
         else
         {
@@ -1705,9 +1938,9 @@ MSD_STATUS msdTaiRegGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetTaiReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetTaiReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetTaiReg(dev, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetTaiReg)(dev, regOffset, data);
         }
         else
         {
@@ -1734,9 +1967,9 @@ MSD_STATUS msdTaiRegSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetTaiReg != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetTaiReg))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetTaiReg(dev, regOffset, data);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetTaiReg)(dev, regOffset, data);
         }
         else
         {
@@ -1765,9 +1998,9 @@ MSD_STATUS msdPtp1588v2ConfigSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSet1588v2Config != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSet1588v2Config))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSet1588v2Config(dev, portNum, timeArrayIndex, ptpMode, ptpStep);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSet1588v2Config)(dev, portNum, timeArrayIndex, ptpMode, ptpStep);
         }
         else
         {
@@ -1795,9 +2028,9 @@ MSD_STATUS msdPtp8021asConfigSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSet8021asConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSet8021asConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSet8021asConfig(dev, portNum, timeArrayIndex, relayMode);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSet8021asConfig)(dev, portNum, timeArrayIndex, relayMode);
         }
         else
         {
@@ -1825,9 +2058,9 @@ MSD_STATUS msdPtp8021asRevConfigSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSet8021asRevConfig))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig(dev, portNum, timeArrayIndex, relayMode);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSet8021asRevConfig)(dev, portNum, timeArrayIndex, relayMode);
         }
         else
         {
@@ -1854,9 +2087,9 @@ MSD_STATUS msdPtpPreemptTimestampSelSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetPreemptTsSel))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel(dev, portNum, tsSelect);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetPreemptTsSel)(dev, portNum, tsSelect);
         }
         else
         {
@@ -1883,9 +2116,9 @@ MSD_STATUS msdPtpPreemptTimestampSelGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetPreemptTsSel))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel(dev, portNum, tsSelect);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetPreemptTsSel)(dev, portNum, tsSelect);
         }
         else
         {
@@ -1912,9 +2145,9 @@ MSD_STATUS msdPtpPreemptCtrlSet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpSetPreemptCtrl))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl(dev, portNum, preemptCtrl);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpSetPreemptCtrl)(dev, portNum, preemptCtrl);
         }
         else
         {
@@ -1941,9 +2174,9 @@ MSD_STATUS msdPtpPreemptCtrlGet
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gptpGetPreemptCtrl))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl(dev, portNum, preemptCtrl);
+            retVal = MSD_DEV_FN(dev, PTPObj, gptpGetPreemptCtrl)(dev, portNum, preemptCtrl);
         }
         else
         {
@@ -1994,9 +2227,9 @@ IN  MSD_U8     trigGenTimerSel
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gtaiSetTrigGenTimerSel != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gtaiSetTrigGenTimerSel))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gtaiSetTrigGenTimerSel(dev, trigGenTimerSel);
+            retVal = MSD_DEV_FN(dev, PTPObj, gtaiSetTrigGenTimerSel)(dev, trigGenTimerSel);
         }
         else
         {
@@ -2046,9 +2279,9 @@ OUT  MSD_U8    *trigGenTimerSel
     }
     else
     {
-        if (dev->SwitchDevObj.PTPObj.gtaiGetTrigGenTimerSel != NULL)
+        if (MSD_DEV_HAS(dev, PTPObj, gtaiGetTrigGenTimerSel))
         {
-            retVal = dev->SwitchDevObj.PTPObj.gtaiGetTrigGenTimerSel(dev, trigGenTimerSel);
+            retVal = MSD_DEV_FN(dev, PTPObj, gtaiGetTrigGenTimerSel)(dev, trigGenTimerSel);
         }
         else
         {
@@ -21,6 +21,7 @@
 #include <api/msdPhyCtrl.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdPhyReset
@@ -69,9 +70,9 @@ MSD_STATUS msdPhyReset
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphyReset != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphyReset))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphyReset(dev, portNum);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphyReset)(dev, portNum);
 		}
 		else
 		{
@@ -128,9 +129,9 @@ MSD_STATUS msdSerdesReset
     }
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.serdesReset != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, serdesReset))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.serdesReset(dev, portNum);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, serdesReset)(dev, portNum);
 		}
 		else
 		{
@@ -195,9 +196,9 @@ MSD_STATUS msdPhyPortLoopbackSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetPortLoopback))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback(dev, portNum, enable);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetPortLoopback)(dev, portNum, enable);
 		}
 		else
 		{
@@ -258,9 +259,9 @@ MSD_STATUS msdPhyPortSpeedSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetPortSpeed))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed(dev, portNum, speed);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetPortSpeed)(dev, portNum, speed);
 		}
 		else
 		{
@@ -313,9 +314,9 @@ MSD_STATUS msdPhyPortPowerDown
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphyPortPowerDown))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown(dev, portNum, state);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphyPortPowerDown)(dev, portNum, state);
 		}
 		else
 		{
@@ -372,9 +373,9 @@ MSD_STATUS msdPhyPortDuplexModeSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetPortDuplexMode))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode(dev, portNum, dMode);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetPortDuplexMode)(dev, portNum, dMode);
 		}
 		else
 		{
@@ -445,9 +446,9 @@ MSD_STATUS msdPhyPortAutoModeSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetPortAutoMode))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetPortAutoMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -498,9 +499,9 @@ MSD_STATUS msdPhyEEESet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetEEE != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetEEE))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetEEE(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetEEE)(dev, portNum, en);
 		}
 		else
 		{
@@ -551,9 +552,9 @@ IN MSD_BOOL en
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetFlowControlEnable))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetFlowControlEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -624,9 +625,9 @@ IN MSD_U16 en
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphySetIntEnable))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphySetIntEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -681,9 +682,9 @@ OUT MSD_U16 *en
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphyGetIntEnable))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphyGetIntEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -735,9 +736,9 @@ OUT MSD_U16 *status
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus != NULL)
+		if (MSD_DEV_HAS(dev, PHYCTRLObj, gphyGetIntStatus))
 		{
-			retVal = dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus(dev, portNum, status);
+			retVal = MSD_DEV_FN(dev, PHYCTRLObj, gphyGetIntStatus)(dev, portNum, status);
 		}
 		else
 		{
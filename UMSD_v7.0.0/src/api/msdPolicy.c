@@ -20,6 +20,7 @@
 #include <api/msdPolicy.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdPolicyMgmtCtrlSet
@@ -68,9 +69,9 @@ IN MSD_U8		data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetMgmtCtrl))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl(dev, portNum, point, data);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetMgmtCtrl)(dev, portNum, point, data);
 		}
 		else
 		{
@@ -127,9 +128,9 @@ OUT MSD_U8		*data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetMgmtCtrl))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl(dev, portNum, point, data);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetMgmtCtrl)(dev, portNum, point, data);
 		}
 		else
 		{
@@ -203,9 +204,9 @@ IN MSD_LPORT    cpuPort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetCpuDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest(dev, portNum, cpuPort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetCpuDest)(dev, portNum, cpuPort);
 		}
 		else
 		{
@@ -278,9 +279,9 @@ OUT MSD_LPORT   *cpuPort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetCpuDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest(dev, portNum, cpuPort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetCpuDest)(dev, portNum, cpuPort);
 		}
 		else
 		{
@@ -339,9 +340,9 @@ IN MSD_LPORT	imd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetIngressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest(dev, portNum, imd);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetIngressMonitorDest)(dev, portNum, imd);
 		}
 		else
 		{
@@ -390,9 +391,9 @@ OUT MSD_LPORT   *imd
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetIngressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest(dev, portNum, imd);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetIngressMonitorDest)(dev, portNum, imd);
 		}
 		else
 		{
@@ -449,9 +450,9 @@ IN MSD_U16		enBits
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetRsvd2CpuEnables))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables(dev, portNum, enBits);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetRsvd2CpuEnables)(dev, portNum, enBits);
 		}
 		else
 		{
@@ -507,9 +508,9 @@ OUT MSD_U16   *enBits
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetRsvd2CpuEnables))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables(dev, portNum, enBits);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetRsvd2CpuEnables)(dev, portNum, enBits);
 		}
 		else
 		{
@@ -560,9 +561,9 @@ IN MSD_U16		pri
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetMGMTPri))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri(dev, portNum, pri);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetMGMTPri)(dev, portNum, pri);
 		}
 		else
 		{
@@ -612,9 +613,9 @@ OUT MSD_U16     *pri
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetMGMTPri))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri(dev, portNum, pri);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetMGMTPri)(dev, portNum, pri);
 		}
 		else
 		{
@@ -671,9 +672,9 @@ IN MSD_LPORT    routePort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetRouteDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest(dev, portNum, routePort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetRouteDest)(dev, portNum, routePort);
 		}
 		else
 		{
@@ -729,9 +730,9 @@ OUT MSD_LPORT   *routePort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetRouteDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest(dev, portNum, routePort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetRouteDest)(dev, portNum, routePort);
 		}
 		else
 		{
@@ -787,9 +788,9 @@ IN MSD_LPORT    mirrorPort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetMirrorDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest(dev, portNum, mirrorPort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetMirrorDest)(dev, portNum, mirrorPort);
 		}
 		else
 		{
@@ -844,9 +845,9 @@ OUT MSD_LPORT   *mirrorPort
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetMirrorDest))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest(dev, portNum, mirrorPort);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetMirrorDest)(dev, portNum, mirrorPort);
 		}
 		else
 		{
@@ -917,9 +918,9 @@ IN MSD_ROUTE_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetIllegalIPAddr))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetIllegalIPAddr)(dev, portNum, action);
 		}
 		else
 		{
@@ -989,9 +990,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetIllegalIPAddr))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetIllegalIPAddr)(dev, portNum, action);
 		}
 		else
 		{
@@ -1061,9 +1062,9 @@ IN MSD_ROUTE_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetDipDaMismatch))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetDipDaMismatch)(dev, portNum, action);
 		}
 		else
 		{
@@ -1132,9 +1133,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetDipDaMismatch))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetDipDaMismatch)(dev, portNum, action);
 		}
 		else
 		{
@@ -1191,8 +1192,8 @@ IN MSD_ROUTE_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP != NULL)
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP(dev, portNum, action);
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetZeroSIP))
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetZeroSIP)(dev, portNum, action);
 		else
 			retVal = MSD_NOT_SUPPORTED;
 	}
@@ -1245,9 +1246,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetZeroSIP))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetZeroSIP)(dev, portNum, action);
 		}
 		else
 		{
@@ -1304,9 +1305,9 @@ IN MSD_ROUTE_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetMcTtlExceeded))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetMcTtlExceeded)(dev, portNum, action);
 		}
 		else
 		{
@@ -1362,9 +1363,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetMcTtlExceeded))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetMcTtlExceeded)(dev, portNum, action);
 		}
 		else
 		{
@@ -1421,9 +1422,9 @@ IN MSD_ROUTE_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetUcTtlExceeded))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetUcTtlExceeded)(dev, portNum, action);
 		}
 		else
 		{
@@ -1479,9 +1480,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetUcTtlExceeded))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetUcTtlExceeded)(dev, portNum, action);
 		}
 		else
 		{
@@ -1533,9 +1534,9 @@ IN MSD_ROUTE_POLICY_TTL_THRESHOLD ttlThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtSetPortTtlThreshold))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold(dev, portNum, ttlThreshold);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtSetPortTtlThreshold)(dev, portNum, ttlThreshold);
 		}
 		else
 		{
@@ -1586,9 +1587,9 @@ OUT MSD_ROUTE_POLICY_TTL_THRESHOLD *ttlThreshold
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtGetPortTtlThreshold))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold(dev, portNum, ttlThreshold);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtGetPortTtlThreshold)(dev, portNum, ttlThreshold);
 		}
 		else
 		{
@@ -1653,9 +1654,9 @@ IN MSD_ROUTE_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetIpHdrErr))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetIpHdrErr)(dev, portNum, action);
 		}
 		else
 		{
@@ -1719,9 +1720,9 @@ OUT MSD_ROUTE_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetIpHdrErr))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetIpHdrErr)(dev, portNum, action);
 		}
 		else
 		{
@@ -1776,9 +1777,9 @@ IN MSD_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPFinUrgPsh))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPFinUrgPsh)(dev, portNum, action);
 		}
 		else
 		{
@@ -1832,9 +1833,9 @@ OUT MSD_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPFinUrgPsh))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPFinUrgPsh)(dev, portNum, action);
 		}
 		else
 		{
@@ -1889,9 +1890,9 @@ IN MSD_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPFlagsSeqNum))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPFlagsSeqNum)(dev, portNum, action);
 		}
 		else
 		{
@@ -1945,9 +1946,9 @@ OUT MSD_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPFlagsSeqNum))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPFlagsSeqNum)(dev, portNum, action);
 		}
 		else
 		{
@@ -2002,9 +2003,9 @@ IN MSD_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPSYN))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPSYN)(dev, portNum, action);
 		}
 		else
 		{
@@ -2059,9 +2060,9 @@ OUT MSD_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPSYN))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPSYN)(dev, portNum, action);
 		}
 		else
 		{
@@ -2116,9 +2117,9 @@ IN MSD_POLICY_ACTION  action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPHSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPHSize)(dev, portNum, action);
 		}
 		else
 		{
@@ -2172,9 +2173,9 @@ OUT MSD_POLICY_ACTION   *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPHSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPHSize)(dev, portNum, action);
 		}
 		else
 		{
@@ -2224,9 +2225,9 @@ IN MSD_U8		minTCPHdrSize
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtSetPortTCPMinHdrSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize(dev, portNum, minTCPHdrSize);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtSetPortTCPMinHdrSize)(dev, portNum, minTCPHdrSize);
 		}
 		else
 		{
@@ -2275,9 +2276,9 @@ OUT MSD_U8		*minTCPHdrSize
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtGetPortTCPMinHdrSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize(dev, portNum, minTCPHdrSize);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtGetPortTCPMinHdrSize)(dev, portNum, minTCPHdrSize);
 		}
 		else
 		{
@@ -2332,9 +2333,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetICMPSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetICMPSize)(dev, portNum, action);
 		}
 		else
 		{
@@ -2388,9 +2389,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetICMPSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetICMPSize)(dev, portNum, action);
 		}
 		else
 		{
@@ -2440,9 +2441,9 @@ IN MSD_U16		maxICMPSize
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtSetPortICMPMaxSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize(dev, portNum, maxICMPSize);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtSetPortICMPMaxSize)(dev, portNum, maxICMPSize);
 		}
 		else
 		{
@@ -2491,9 +2492,9 @@ OUT MSD_U16		*maxICMPSize
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gprtGetPortICMPMaxSize))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize(dev, portNum, maxICMPSize);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gprtGetPortICMPMaxSize)(dev, portNum, maxICMPSize);
 		}
 		else
 		{
@@ -2548,9 +2549,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetUDPPort))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetUDPPort)(dev, portNum, action);
 		}
 		else
 		{
@@ -2604,9 +2605,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetUDPPort))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetUDPPort)(dev, portNum, action);
 		}
 		else
 		{
@@ -2661,9 +2662,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPPort))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPPort)(dev, portNum, action);
 		}
 		else
 		{
@@ -2717,9 +2718,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPPort))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPPort)(dev, portNum, action);
 		}
 		else
 		{
@@ -2774,9 +2775,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPSynFin))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPSynFin)(dev, portNum, action);
 		}
 		else
 		{
@@ -2830,9 +2831,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPSynFin))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPSynFin)(dev, portNum, action);
 		}
 		else
 		{
@@ -2887,9 +2888,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetTCPFrag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetTCPFrag)(dev, portNum, action);
 		}
 		else
 		{
@@ -2943,9 +2944,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetTCPFrag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetTCPFrag)(dev, portNum, action);
 		}
 		else
 		{
@@ -3000,9 +3001,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetNearNonTPMR))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetNearNonTPMR)(dev, portNum, action);
 		}
 		else
 		{
@@ -3056,9 +3057,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetNearNonTPMR))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetNearNonTPMR)(dev, portNum, action);
 		}
 		else
 		{
@@ -3112,9 +3113,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetETag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetETag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetETag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetETag)(dev, portNum, action);
 		}
 		else
 		{
@@ -3167,9 +3168,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetETag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetETag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetETag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetETag)(dev, portNum, action);
 		}
 		else
 		{
@@ -3223,9 +3224,9 @@ IN MSD_POLICY_ACTION action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicySetNonETag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicySetNonETag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicySetNonETag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicySetNonETag)(dev, portNum, action);
 		}
 		else
 		{
@@ -3278,9 +3279,9 @@ OUT MSD_POLICY_ACTION *action
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyGetNonETag))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag(dev, portNum, action);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyGetNonETag)(dev, portNum, action);
 		}
 		else
 		{
@@ -3327,9 +3328,9 @@ IN  MSD_U8	devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.POLICYObj.gpolicyDump != NULL)
+		if (MSD_DEV_HAS(dev, POLICYObj, gpolicyDump))
 		{
-			retVal = dev->SwitchDevObj.POLICYObj.gpolicyDump(dev);
+			retVal = MSD_DEV_FN(dev, POLICYObj, gpolicyDump)(dev);
 		}
 		else
 		{
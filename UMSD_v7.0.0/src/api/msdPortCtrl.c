@@ -20,6 +20,7 @@
 #include <api/msdPortCtrl.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdPortForceDefaultVlanIdGet
@@ -60,9 +61,9 @@ OUT MSD_BOOL  *en
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnGetPortVid))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetForceDefaultVid)(dev, portNum, en);
 		}
 		else
 		{
@@ -113,9 +114,9 @@ IN  MSD_BOOL  en
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnSetPortVid))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetForceDefaultVid)(dev, portNum, en);
 		}
 		else
 		{
@@ -165,9 +166,9 @@ MSD_STATUS msdPortDefaultVlanIdGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnGetPortVid))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid(dev, portNum, vlanId);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gvlnGetPortVid)(dev, portNum, vlanId);
 		}
 		else
 		{
@@ -218,9 +219,9 @@ MSD_STATUS msdPortDefaultVlanIdSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnSetPortVid))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid(dev, portNum, vlanId);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gvlnSetPortVid)(dev, portNum, vlanId);
 		}
 		else
 		{
@@ -270,9 +271,9 @@ MSD_STATUS msdPort8021qModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnGetPortVlanDot1qMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gvlnGetPortVlanDot1qMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -323,9 +324,9 @@ MSD_STATUS msdPort8021qModeSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gvlnSetPortVlanDot1qMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gvlnSetPortVlanDot1qMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -375,9 +376,9 @@ MSD_STATUS msdPortDiscardTaggedGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDiscardTagged))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDiscardTagged)(dev, portNum, en);
 		}
 		else
 		{
@@ -431,9 +432,9 @@ MSD_STATUS msdPortDiscardTaggedSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDiscardTagged))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDiscardTagged)(dev, portNum, en);
 		}
 		else
 		{
@@ -483,9 +484,9 @@ MSD_STATUS msdPortDiscardUntaggedGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDiscardUntagged))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDiscardUntagged)(dev, portNum, en);
 		}
 		else
 		{
@@ -539,9 +540,9 @@ MSD_STATUS msdPortDiscardUntaggedSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDiscardUntagged))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDiscardUntagged)(dev, portNum, en);
 		}
 		else
 		{
@@ -596,9 +597,9 @@ MSD_STATUS msdPortUnicastFloodBlockGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetUnicastFloodBlock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetUnicastFloodBlock)(dev, portNum, en);
 		}
 		else
 		{
@@ -654,9 +655,9 @@ MSD_STATUS msdPortUnicastFloodBlockSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetUnicastFloodBlock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetUnicastFloodBlock)(dev, portNum, en);
 		}
 		else
 		{
@@ -712,9 +713,9 @@ MSD_STATUS msdPortMulticastFloodBlockGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetMulticastFloodBlock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetMulticastFloodBlock)(dev, portNum, en);
 		}
 		else
 		{
@@ -771,9 +772,9 @@ MSD_STATUS msdPortMulticastFloodBlockSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetMulticastFloodBlock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetMulticastFloodBlock)(dev, portNum, en);
 		}
 		else
 		{
@@ -824,9 +825,9 @@ MSD_STATUS msdPortDiscardBcastModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDiscardBCastMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDiscardBCastMode)(dev, portNum, en);
 		}
 		else
 		{
@@ -879,9 +880,9 @@ MSD_STATUS msdPortDiscardBcastModeSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDiscardBCastMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDiscardBCastMode)(dev, portNum, en);
 		}
 		else
 		{
@@ -931,9 +932,9 @@ MSD_STATUS msdPortIGMPSnoopEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetIGMPSnoopEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetIGMPSnoopEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -984,9 +985,9 @@ MSD_STATUS msdPortIGMPSnoopEnableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetIGMPSnoopEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetIGMPSnoopEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -1036,8 +1037,8 @@ MSD_STATUS msdPortHeaderModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode != NULL)
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode(dev, portNum, en);
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetHeaderMode))
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetHeaderMode)(dev, portNum, en);
 		else
 			retVal = MSD_NOT_SUPPORTED;
 	}
@@ -1087,9 +1088,9 @@ MSD_STATUS msdPortHeaderModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetHeaderMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetHeaderMode)(dev, portNum, en);
 		}
 		else
 		{
@@ -1139,9 +1140,9 @@ MSD_STATUS msdPortDropOnLockGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDropOnLock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDropOnLock)(dev, portNum, en);
 		}
 		else
 		{
@@ -1194,9 +1195,9 @@ MSD_STATUS msdPortDropOnLockSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDropOnLock))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDropOnLock)(dev, portNum, en);
 		}
 		else
 		{
@@ -1247,8 +1248,8 @@ MSD_STATUS msdPortMtuGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode != NULL)
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode(dev, portNum, size);
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetJumboMode))
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetJumboMode)(dev, portNum, size);
 		else
 			retVal = MSD_NOT_SUPPORTED;
 	}
@@ -1297,9 +1298,9 @@ MSD_STATUS msdPortMtuSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetJumboMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetJumboMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1350,9 +1351,9 @@ OUT MSD_U16   *size
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetSpecifiedMTU))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU(dev, portNum, size);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetSpecifiedMTU)(dev, portNum, size);
 		}
 		else
 		{
@@ -1404,9 +1405,9 @@ IN  MSD_U16    size
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetSpecifiedMTU))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU(dev, portNum, size);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetSpecifiedMTU)(dev, portNum, size);
 		}
 		else
 		{
@@ -1457,9 +1458,9 @@ MSD_STATUS msdPortLearnEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetLearnEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetLearnEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -1512,9 +1513,9 @@ MSD_STATUS msdPortLearnEnableSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetLearnEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetLearnEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -1564,9 +1565,9 @@ MSD_STATUS msdPortVTUPriorityOverrideGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetVTUPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetVTUPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1617,9 +1618,9 @@ MSD_STATUS msdPortVTUPriorityOverrideSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetVTUPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetVTUPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1669,9 +1670,9 @@ MSD_STATUS msdPortSAPriorityOverrideGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetSAPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetSAPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1722,9 +1723,9 @@ MSD_STATUS msdPortSAPriorityOverrideSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetSAPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetSAPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1774,9 +1775,9 @@ MSD_STATUS msdPortDAPriorityOverrideGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDAPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDAPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1827,9 +1828,9 @@ MSD_STATUS msdPortDAPriorityOverrideSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDAPriorityOverride))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDAPriorityOverride)(dev, portNum, mode);
 		}
 		else
 		{
@@ -1879,9 +1880,9 @@ MSD_STATUS msdPortMessagePortGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetMessagePort))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetMessagePort)(dev, portNum, en);
 		}
 		else
 		{
@@ -1933,9 +1934,9 @@ MSD_STATUS msdPortMessagePortSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetMessagePort))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetMessagePort)(dev, portNum, en);
 		}
 		else
 		{
@@ -1986,9 +1987,9 @@ MSD_STATUS msdPortEtherTypeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetEtherType))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType(dev, portNum, eType);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetEtherType)(dev, portNum, eType);
 		}
 		else
 		{
@@ -2040,9 +2041,9 @@ MSD_STATUS msdPortEtherTypeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetEtherType))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType(dev, portNum, eType);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetEtherType)(dev, portNum, eType);
 		}
 		else
 		{
@@ -2092,9 +2093,9 @@ MSD_STATUS msdPortAllowVidZeroGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetAllowVidZero))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetAllowVidZero)(dev, portNum, en);
 		}
 		else
 		{
@@ -2145,9 +2146,9 @@ MSD_STATUS msdPortAllowVidZeroSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetAllowVidZero))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetAllowVidZero)(dev, portNum, en);
 		}
 		else
 		{
@@ -2200,9 +2201,9 @@ MSD_STATUS msdPortFlowControlEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetFlowCtrl))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl(dev, portNum, en, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetFlowCtrl)(dev, portNum, en, mode);
 		}
 		else
 		{
@@ -2259,9 +2260,9 @@ MSD_STATUS msdPortFlowControlEnableSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetFlowCtrl))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl(dev, portNum, en, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetFlowCtrl)(dev, portNum, en, mode);
 		}
 		else
 		{
@@ -2311,9 +2312,9 @@ MSD_STATUS msdPortEgressMonitorSourceEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetEgressMonitorSource))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetEgressMonitorSource)(dev, portNum, en);
 		}
 		else
 		{
@@ -2367,9 +2368,9 @@ MSD_STATUS msdPortEgressMonitorSourceEnableSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetEgressMonitorSource))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetEgressMonitorSource)(dev, portNum, en);
 		}
 		else
 		{
@@ -2419,9 +2420,9 @@ MSD_STATUS msdPortIngressMonitorSourceEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetIngressMonitorSource))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetIngressMonitorSource)(dev, portNum, en);
 		}
 		else
 		{
@@ -2475,9 +2476,9 @@ MSD_STATUS msdPortIngressMonitorSourceEnableSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetIngressMonitorSource))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetIngressMonitorSource)(dev, portNum, en);
 		}
 		else
 		{
@@ -2542,9 +2543,9 @@ MSD_STATUS msdPortEgressRateGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, grcGetEgressRate))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate(dev, portNum, mode, rate);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, grcGetEgressRate)(dev, portNum, mode, rate);
 		}
 		else
 		{
@@ -2612,9 +2613,9 @@ MSD_STATUS msdPortEgressRateSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, grcSetEgressRate))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate(dev, portNum, mode, rate);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, grcSetEgressRate)(dev, portNum, mode, rate);
 		}
 		else
 		{
@@ -2664,9 +2665,9 @@ MSD_STATUS msdPortForceDuplexModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDuplex))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDuplex)(dev, portNum, mode);
 		}
 		else
 		{
@@ -2717,9 +2718,9 @@ MSD_STATUS msdPortForceDuplexModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetDuplex))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetDuplex)(dev, portNum, mode);
 		}
 		else
 		{
@@ -2769,9 +2770,9 @@ MSD_STATUS msdPortDuplexStatusGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetDuplex))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetDuplexStatus)(dev, portNum, mode);
 		}
 		else
 		{
@@ -2821,9 +2822,9 @@ MSD_STATUS msdPortForceLinkModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetForceLink))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetForceLink)(dev, portNum, mode);
 		}
 		else
 		{
@@ -2874,9 +2875,9 @@ MSD_STATUS msdPortForceLinkModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetForceLink))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetForceLink)(dev, portNum, mode);
 		}
 		else
 		{
@@ -2926,9 +2927,9 @@ MSD_STATUS msdPortLinkStatusGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetLinkState))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState(dev, portNum, state);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetLinkState)(dev, portNum, state);
 		}
 		else
 		{
@@ -2978,9 +2979,9 @@ MSD_STATUS msdPortForceSpeedModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetForceSpeed))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetForceSpeed)(dev, portNum, mode);
 		}
 		else
 		{
@@ -3031,9 +3032,9 @@ MSD_STATUS msdPortForceSpeedModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetForceSpeed))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetForceSpeed)(dev, portNum, mode);
 		}
 		else
 		{
@@ -3086,9 +3087,9 @@ MSD_STATUS msdPortSpeedStatusGet
 	else
 	{
 
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetSpeed))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed(dev, portNum, speed);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetSpeed)(dev, portNum, speed);
 		}
 		else
 		{
@@ -3140,9 +3141,9 @@ MSD_STATUS msdPortCutThroughEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetCutThrouthEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable(dev, portNum, cutThru);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetCutThrouthEnable)(dev, portNum, cutThru);
 		}
 		else
 		{
@@ -3194,9 +3195,9 @@ MSD_STATUS msdPortCutThroughEnableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetCutThrouthEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable(dev, portNum, cutThru);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetCutThrouthEnable)(dev, portNum, cutThru);
 		}
 		else
 		{
@@ -3249,9 +3250,9 @@ MSD_STATUS msdPortIgnoreFcsGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetIgnoreFcs))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetIgnoreFcs)(dev, portNum, en);
 		}
 		else
 		{
@@ -3304,9 +3305,9 @@ MSD_STATUS msdPortIgnoreFcsSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetIgnoreFcs))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetIgnoreFcs)(dev, portNum, en);
 		}
 		else
 		{
@@ -3358,9 +3359,9 @@ MSD_STATUS msdPortAllowBadFcsGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetAllowBadFcs))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetAllowBadFcs)(dev, portNum, en);
 		}
 		else
 		{
@@ -3413,9 +3414,9 @@ MSD_STATUS msdPortAllowBadFcsSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetAllowBadFcs))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetAllowBadFcs)(dev, portNum, en);
 		}
 		else
 		{
@@ -3467,9 +3468,9 @@ MSD_STATUS msdPortPauseLimitOutGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPauseLimitOut))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPauseLimitOut)(dev, portNum, limit);
 		}
 		else
 		{
@@ -3523,9 +3524,9 @@ MSD_STATUS msdPortPauseLimitOutSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPauseLimitOut))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPauseLimitOut)(dev, portNum, limit);
 		}
 		else
 		{
@@ -3577,9 +3578,9 @@ MSD_STATUS msdPortPauseLimitInGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPauseLimitIn))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPauseLimitIn)(dev, portNum, limit);
 		}
 		else
 		{
@@ -3633,9 +3634,9 @@ MSD_STATUS msdPortPauseLimitInSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPauseLimitIn))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn(dev, portNum, limit);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPauseLimitIn)(dev, portNum, limit);
 		}
 		else
 		{
@@ -3686,9 +3687,9 @@ MSD_STATUS msdPortQueueToPauseGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetQueueToPause))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause(dev, portNum, queues);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetQueueToPause)(dev, portNum, queues);
 		}
 		else
 		{
@@ -3743,9 +3744,9 @@ MSD_STATUS msdPortQueueToPauseSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetQueueToPause))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause(dev, portNum, queues);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetQueueToPause)(dev, portNum, queues);
 		}
 		else
 		{
@@ -3798,9 +3799,9 @@ MSD_STATUS msdPortRxPriorityFlowControlEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetRxPriorityFlowControlEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable(dev, portNum, pfcPri, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetRxPriorityFlowControlEnable)(dev, portNum, pfcPri, en);
 		}
 		else
 		{
@@ -3854,9 +3855,9 @@ MSD_STATUS msdPortRxPriorityFlowControlEnableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetRxPriorityFlowControlEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable(dev, portNum, pfcPri, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetRxPriorityFlowControlEnable)(dev, portNum, pfcPri, en);
 		}
 		else
 		{
@@ -3909,9 +3910,9 @@ MSD_STATUS msdPortRxPriorityFlowControlToQueueGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetRxPriorityFlowControlToQueue))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue(dev, portNum, pfcPri, queue);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetRxPriorityFlowControlToQueue)(dev, portNum, pfcPri, queue);
 		}
 		else
 		{
@@ -3965,9 +3966,9 @@ MSD_STATUS msdPortRxPriorityFlowControlToQueueSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetRxPriorityFlowControlToQueue))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue(dev, portNum, pfcPri, queue);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetRxPriorityFlowControlToQueue)(dev, portNum, pfcPri, queue);
 		}
 		else
 		{
@@ -4020,9 +4021,9 @@ MSD_STATUS msdPortTxPriorityFlowControlEnableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetTxPriorityFlowControlEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable(dev, portNum, pfcPri, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetTxPriorityFlowControlEnable)(dev, portNum, pfcPri, en);
 		}
 		else
 		{
@@ -4076,9 +4077,9 @@ MSD_STATUS msdPortTxPriorityFlowControlEnableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetTxPriorityFlowControlEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable(dev, portNum, pfcPri, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetTxPriorityFlowControlEnable)(dev, portNum, pfcPri, en);
 		}
 		else
 		{
@@ -4133,9 +4134,9 @@ MSD_STATUS msdPortOutQueueSizeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetOutQueueSize))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize(dev, portNum, queueNum, count);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetOutQueueSize)(dev, portNum, queueNum, count);
 		}
 		else
 		{
@@ -4185,9 +4186,9 @@ MSD_STATUS msdPortMapDAGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetMapDA))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetMapDA)(dev, portNum, en);
 		}
 		else
 		{
@@ -4241,9 +4242,9 @@ MSD_STATUS msdPortMapDASet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetMapDA))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetMapDA)(dev, portNum, en);
 		}
 		else
 		{
@@ -4294,9 +4295,9 @@ MSD_STATUS msdPortARPMirrorGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetARPMirror))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetARPMirror)(dev, portNum, en);
 		}
 		else
 		{
@@ -4350,9 +4351,9 @@ MSD_STATUS msdPortARPMirrorSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetARPMirror))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetARPMirror)(dev, portNum, en);
 		}
 		else
 		{
@@ -4404,9 +4405,9 @@ MSD_STATUS msdPortBasedVlanMapGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetVlanPorts))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts(dev, portNum, memPorts, memPortsLen);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetVlanPorts)(dev, portNum, memPorts, memPortsLen);
 		}
 		else
 		{
@@ -4451,6 +4452,7 @@ MSD_STATUS msdPortBasedVlanMapSet
 )
 {
     MSD_STATUS retVal;
+    MSD_U8 i;
     MSD_QD_DEV* dev = sohoDevGet(devNum);
     if (NULL == dev)
     {
@@ -4459,9 +4461,22 @@ MSD_STATUS msdPortBasedVlanMapSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts != NULL)
-		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts(dev, portNum, memPorts, memPortsLen);
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetVlanPorts))
+		{
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetVlanPorts)(dev, portNum, memPorts, memPortsLen);
+			if ((retVal == MSD_OK) && (portNum < MSD_MAX_SWITCH_PORTS))
+			{
+				/* keep the port isolation matrix copy in step */
+				dev->vlanMatrixShadow.portVec[portNum] = 0;
+				for (i = 0; i < memPortsLen; i++)
+				{
+					dev->vlanMatrixShadow.portVec[portNum] |= (MSD_U32)1 << memPorts[i];
+				}
+			}
+			else
+			{
+				dev->vlanMatrixShadow.valid = MSD_FALSE;
+			}
 		}
 		else
 		{
@@ -4472,6 +4487,208 @@ MSD_STATUS msdPortBasedVlanMapSet
     return retVal;
 }
 
+/*******************************************************************************
+* msdPortBasedVlanMatrixGet
+*
+* DESCRIPTION:
+*       this routine gets the port based vlan table of every port as a port
+*       isolation matrix, and refreshes the copy used by
+*       msdPortBasedVlanMatrixSet.
+*
+* INPUTS:
+*       devNum  - physical device number
+*
+* OUTPUTS:
+*       portVec - array of MSD_MAX_SWITCH_PORTS entries, entry i is the port
+*                 vector port i is allowed to send frames to
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdPortBasedVlanMatrixGet
+(
+    IN  MSD_U8  devNum,
+    OUT MSD_U32  *portVec
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_LPORT memPorts[MSD_MAX_SWITCH_PORTS];
+    MSD_U8 memPortsLen;
+    MSD_LPORT port;
+    MSD_U8 i;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (NULL == portVec)
+    {
+        MSD_DBG_ERROR(("Input param portVec is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if (!MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetVlanPorts))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    dev->vlanMatrixShadow.valid = MSD_FALSE;
+    msdMemSet((void*)portVec, 0, sizeof(MSD_U32) * MSD_MAX_SWITCH_PORTS);
+
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if ((dev->validPortVec & ((MSD_U32)1 << port)) == 0U)
+        {
+            continue;
+        }
+
+        memPortsLen = 0;
+        retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetVlanPorts)(dev, port, memPorts, &memPortsLen);
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        for (i = 0; i < memPortsLen; i++)
+        {
+            portVec[port] |= (MSD_U32)1 << memPorts[i];
+        }
+    }
+
+    if (retVal == MSD_OK)
+    {
+        msdMemCpy((void*)dev->vlanMatrixShadow.portVec, (const void*)portVec, sizeof(MSD_U32) * MSD_MAX_SWITCH_PORTS);
+        dev->vlanMatrixShadow.valid = MSD_TRUE;
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdPortBasedVlanMatrixSet
+*
+* DESCRIPTION:
+*       this routine sets the port based vlan table of every port from a port
+*       isolation matrix, writing only the ports whose table changes.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       portVec   - array of MSD_MAX_SWITCH_PORTS entries, entry i is the port
+*                   vector port i is allowed to send frames to
+*       useShadow - MSD_TRUE to compare with the tables last read or written
+*                   by the matrix APIs, MSD_FALSE to read them from the device
+*
+* OUTPUTS:
+*       numWrites - number of port tables written, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdPortBasedVlanMatrixSet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  *portVec,
+    IN  MSD_BOOL  useShadow,
+    OUT MSD_U32  *numWrites
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_U32 current[MSD_MAX_SWITCH_PORTS];
+    MSD_LPORT memPorts[MSD_MAX_SWITCH_PORTS];
+    MSD_U8 memPortsLen;
+    MSD_U32 writes = 0;
+    MSD_LPORT port;
+    MSD_LPORT i;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (NULL == portVec)
+    {
+        MSD_DBG_ERROR(("Input param portVec is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if ((!MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetVlanPorts)) ||
+        (!MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetVlanPorts)))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if (((dev->validPortVec & ((MSD_U32)1 << port)) != 0U) &&
+            ((portVec[port] & ~dev->validPortVec) != 0U))
+        {
+            MSD_DBG_ERROR(("Bad port vector 0x%x for port %d.\n", portVec[port], port));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    if ((useShadow == MSD_TRUE) && (dev->vlanMatrixShadow.valid == MSD_TRUE))
+    {
+        msdMemCpy((void*)current, (const void*)dev->vlanMatrixShadow.portVec, sizeof(current));
+    }
+    else
+    {
+        retVal = msdPortBasedVlanMatrixGet(devNum, current);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+    }
+
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if (((dev->validPortVec & ((MSD_U32)1 << port)) == 0U) || (portVec[port] == current[port]))
+        {
+            continue;
+        }
+
+        memPortsLen = 0;
+        for (i = 0; i < dev->numOfPorts; i++)
+        {
+            if ((portVec[port] & ((MSD_U32)1 << i)) != 0U)
+            {
+                memPorts[memPortsLen] = i;
+                memPortsLen++;
+            }
+        }
+
+        retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetVlanPorts)(dev, port, memPorts, memPortsLen);
+        writes++;
+        if (retVal != MSD_OK)
+        {
+            dev->vlanMatrixShadow.valid = MSD_FALSE;
+            break;
+        }
+        dev->vlanMatrixShadow.portVec[port] = portVec[port];
+    }
+
+    if (numWrites != NULL)
+    {
+        *numWrites = writes;
+    }
+
+    return retVal;
+}
+
 /*******************************************************************************
 * msdPortFrameModeGet
 *
@@ -4511,9 +4728,9 @@ MSD_STATUS msdPortFrameModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetFrameMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetFrameMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -4580,9 +4797,9 @@ MSD_STATUS msdPortFrameModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetFrameMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetFrameMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -4646,9 +4863,9 @@ MSD_STATUS msdPortEgressModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetEgressMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetEgressMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -4698,9 +4915,9 @@ OUT MSD_EGRESS_MODE *mode
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetEgressMode))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetEgressMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -4750,9 +4967,9 @@ MSD_STATUS msdPortECIDSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPortECID))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID(dev, portNum, ecid);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPortECID)(dev, portNum, ecid);
 		}
 		else
 		{
@@ -4802,9 +5019,9 @@ MSD_STATUS msdPortECIDGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPortECID))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID(dev, portNum, ecid);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPortECID)(dev, portNum, ecid);
 		}
 		else
 		{
@@ -4855,9 +5072,9 @@ MSD_STATUS msdPortIgnoreETagSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetIgnoreETag))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetIgnoreETag)(dev, portNum, en);
 		}
 		else
 		{
@@ -4907,9 +5124,9 @@ MSD_STATUS msdPortIgnoreETagGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetIgnoreETag))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetIgnoreETag)(dev, portNum, en);
 		}
 		else
 		{
@@ -4964,9 +5181,9 @@ MSD_STATUS msdPortStateGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPortState))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPortState)(dev, portNum, mode);
 		}
 		else
 		{
@@ -5021,9 +5238,9 @@ MSD_STATUS msdPortStateSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPortState))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPortState)(dev, portNum, mode);
 		}
 		else
 		{
@@ -5073,9 +5290,9 @@ MSD_STATUS msdPortRegDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtRegDump != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtRegDump))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtRegDump(dev, portNum);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtRegDump)(dev, portNum);
 		}
 		else
 		{
@@ -5136,9 +5353,9 @@ MSD_STATUS msdPortExtendedPortCtrlRegSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetExtendedPortCtrlReg))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg(dev, portNum, index, fieldOffset, fieldLength, data);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetExtendedPortCtrlReg)(dev, portNum, index, fieldOffset, fieldLength, data);
 		}
 		else
 		{
@@ -5198,9 +5415,9 @@ MSD_STATUS msdPortExtendedPortCtrlRegGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetExtendedPortCtrlReg))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg(dev, portNum, index, fieldOffset, fieldLength, data);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetExtendedPortCtrlReg)(dev, portNum, index, fieldOffset, fieldLength, data);
 		}
 		else
 		{
@@ -5251,9 +5468,9 @@ IN  MSD_BOOL en
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPreemptEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPreemptEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -5303,9 +5520,9 @@ OUT MSD_BOOL *en
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPreemptEnable))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPreemptEnable)(dev, portNum, en);
 		}
 		else
 		{
@@ -5356,9 +5573,9 @@ IN  MSD_U16    size
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPreemptSize))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize(dev, portNum, size);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPreemptSize)(dev, portNum, size);
 		}
 		else
 		{
@@ -5408,9 +5625,9 @@ OUT MSD_U16   *size
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPreemptSize))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize(dev, portNum, size);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPreemptSize)(dev, portNum, size);
 		}
 		else
 		{
@@ -5463,9 +5680,9 @@ IN  MSD_BOOL   en
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtSetPreemptQueue))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue(dev, portNum, queue, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtSetPreemptQueue)(dev, portNum, queue, en);
 		}
 		else
 		{
@@ -5517,9 +5734,9 @@ OUT MSD_BOOL   *en
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue != NULL)
+		if (MSD_DEV_HAS(dev, PORTCTRLObj, gprtGetPreemptQueue))
 		{
-			retVal = dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue(dev, portNum, queue, en);
+			retVal = MSD_DEV_FN(dev, PORTCTRLObj, gprtGetPreemptQueue)(dev, portNum, queue, en);
 		}
 		else
 		{
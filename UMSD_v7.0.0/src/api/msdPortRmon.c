@@ -20,6 +20,7 @@
 #include <api/msdPortRmon.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdStatsFlushAll
@@ -57,9 +58,9 @@ MSD_STATUS msdStatsFlushAll
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsFlushAll))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsFlushAll)(dev);
 		}
 		else
 		{
@@ -108,9 +109,9 @@ MSD_STATUS msdStatsFlushPort
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsFlushPort))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort(dev, portNum);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsFlushPort)(dev, portNum);
 		}
 		else
 		{
@@ -162,9 +163,9 @@ MSD_STATUS msdStatsPortCounterGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsGetPortCounter))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter(dev, portNum, counter, statsData);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsGetPortCounter)(dev, portNum, counter, statsData);
 		}
 		else
 		{
@@ -214,9 +215,9 @@ MSD_STATUS msdStatsPortAllCountersGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsGetPortAllCounters))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters(dev, portNum, statsCounterSet);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsGetPortAllCounters)(dev, portNum, statsCounterSet);
 		}
 		else
 		{
@@ -266,9 +267,9 @@ MSD_STATUS msdStatsHistogramModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsGetHistogramMode))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode(dev, mode);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsGetHistogramMode)(dev, mode);
 		}
 		else
 		{
@@ -318,9 +319,9 @@ MSD_STATUS msdStatsHistogramModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gstatsSetHistogramMode))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode(dev, mode);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsSetHistogramMode)(dev, mode);
 		}
 		else
 		{
@@ -368,9 +369,9 @@ MSD_STATUS msdPortMibDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.PORTRMONObj.gmibDump != NULL)
+		if (MSD_DEV_HAS(dev, PORTRMONObj, gmibDump))
 		{
-			retVal = dev->SwitchDevObj.PORTRMONObj.gmibDump(dev, portNum);
+			retVal = MSD_DEV_FN(dev, PORTRMONObj, gmibDump)(dev, portNum);
 		}
 		else
 		{
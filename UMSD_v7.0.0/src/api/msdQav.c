@@ -20,6 +20,7 @@
 #include <api/msdQav.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /******************************************************************************
 * msdQavPortQpriXRateSet
@@ -67,9 +68,9 @@ MSD_STATUS msdQavPortQpriXRateSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate != NULL)
+		if (MSD_DEV_HAS(dev, QAVObj, gqavSetPortQpriXRate))
 		{
-			retVal = dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate(dev, portNum, queue, rate);
+			retVal = MSD_DEV_FN(dev, QAVObj, gqavSetPortQpriXRate)(dev, portNum, queue, rate);
 		}
 		else
 		{
@@ -124,9 +125,9 @@ MSD_STATUS msdQavPortQpriXRateGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate != NULL)
+		if (MSD_DEV_HAS(dev, QAVObj, gqavGetPortQpriXRate))
 		{
-			retVal = dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate(dev, portNum, queue, rate);
+			retVal = MSD_DEV_FN(dev, QAVObj, gqavGetPortQpriXRate)(dev, portNum, queue, rate);
 		}
 		else
 		{
@@ -179,9 +180,9 @@ MSD_STATUS msdQavPortQpriXHiLimitSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit != NULL)
+		if (MSD_DEV_HAS(dev, QAVObj, gqavSetPortQpriXHiLimit))
 		{
-			retVal = dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit(dev, portNum, queue, hiLimit);
+			retVal = MSD_DEV_FN(dev, QAVObj, gqavSetPortQpriXHiLimit)(dev, portNum, queue, hiLimit);
 		}
 		else
 		{
@@ -234,9 +235,9 @@ MSD_STATUS msdQavPortQpriXHiLimitGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit != NULL)
+		if (MSD_DEV_HAS(dev, QAVObj, gqavGetPortQpriXHiLimit))
 		{
-			retVal = dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit(dev, portNum, queue, hiLimit);
+			retVal = MSD_DEV_FN(dev, QAVObj, gqavGetPortQpriXHiLimit)(dev, portNum, queue, hiLimit);
 		}
 		else
 		{
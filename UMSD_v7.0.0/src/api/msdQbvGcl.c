@@ -0,0 +1,502 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+
+/********************************************************************************
+* msdQbvGcl.c
+*
+* DESCRIPTION:
+*       API definitions for the Qbv gate control list manager, built on the
+*       Qbv register access and the TAI trigger generator.
+*
+* DEPENDENCIES:
+*       None.
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#include <api/msdQbvGcl.h>
+#include <api/msdPTP.h>
+#include <driver/msdApiTypes.h>
+#include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
+
+/* Qbv port registers, see sample_msdQbv.c */
+#define MSD_QBV_REG_ENTRY			0x2U	/* table entry update */
+#define MSD_QBV_REG_WINDOW			0x3U	/* window time of the updated entry */
+
+#define MSD_QBV_ENTRY_UPDATE		0x8000U
+#define MSD_QBV_ENTRY_PTR_SHIFT		8U
+#define MSD_QBV_ENTRY_PTR_MASK		0xFU
+
+/* TAI trigger generator registers, the Qbv cycle is clocked from them */
+#define MSD_QBV_TAI_TRIG_AMT_LO		0x2U
+#define MSD_QBV_TAI_TRIG_AMT_HI		0x3U
+#define MSD_QBV_TAI_TRIG_TIME_LO	0x10U
+#define MSD_QBV_TAI_TRIG_TIME_HI	0x11U
+
+/* PTP clock period in ns */
+static MSD_U32 msdQbvGclTickNs
+(
+    IN  MSD_QD_DEV  *dev
+)
+{
+    if ((dev->devName == MSD_PERIDOT) || (dev->devName == MSD_TOPAZ))
+    {
+        return 8U;
+    }
+    return 4U;
+}
+
+static MSD_BOOL msdQbvGclPortVecValid
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32  portVec
+)
+{
+    if ((dev->numOfPorts < 32U) && ((portVec >> dev->numOfPorts) != 0U))
+    {
+        return MSD_FALSE;
+    }
+    return MSD_TRUE;
+}
+
+static MSD_STATUS msdQbvGclTimeWrite
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  cycleTicks,
+    IN  MSD_U32  baseTime
+)
+{
+    MSD_STATUS retVal;
+
+    retVal = msdTaiRegSet(devNum, MSD_QBV_TAI_TRIG_AMT_LO, (MSD_U16)(cycleTicks & 0xFFFFU));
+    if (retVal == MSD_OK)
+    {
+        retVal = msdTaiRegSet(devNum, MSD_QBV_TAI_TRIG_AMT_HI, (MSD_U16)(cycleTicks >> 16));
+    }
+    if (retVal == MSD_OK)
+    {
+        retVal = msdTaiRegSet(devNum, MSD_QBV_TAI_TRIG_TIME_LO, (MSD_U16)(baseTime & 0xFFFFU));
+    }
+    if (retVal == MSD_OK)
+    {
+        retVal = msdTaiRegSet(devNum, MSD_QBV_TAI_TRIG_TIME_HI, (MSD_U16)(baseTime >> 16));
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+* msdQbvGclCompile
+*
+* DESCRIPTION:
+*       This function checks a schedule against the limits of the Qbv entry
+*       encoding and encodes it into Qbv table images without accessing the
+*       device.
+*
+* INPUTS:
+*       devNum   - physical device number
+*       schedule - cycle time, base time and gate control list per port
+*
+* OUTPUTS:
+*       image - Qbv table images and TAI trigger settings
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if the schedule cannot be encoded
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclCompile
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_SCHEDULE  *schedule,
+    OUT MSD_QBV_GCL_IMAGE  *image
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_QBV_GCL_PORT *gcl;
+    MSD_LPORT port;
+    MSD_U32 i;
+    MSD_U32 tick;
+    MSD_U32 interval;
+    MSD_U32 total;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == schedule) || (NULL == image))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if (!MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvWrite))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    tick = msdQbvGclTickNs(dev);
+    if ((schedule->cycleTime == 0U) || ((schedule->cycleTime % tick) != 0U))
+    {
+        MSD_DBG_ERROR(("Bad cycle time %u ns.\n", (unsigned int)schedule->cycleTime));
+        return MSD_BAD_PARAM;
+    }
+    if (msdQbvGclPortVecValid(dev, schedule->portVec) != MSD_TRUE)
+    {
+        MSD_DBG_ERROR(("Bad port vector 0x%x.\n", (unsigned int)schedule->portVec));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemSet((void*)image, 0, sizeof(MSD_QBV_GCL_IMAGE));
+    image->cycleTicks = schedule->cycleTime / tick;
+    image->baseTime = schedule->baseTime;
+    image->portVec = schedule->portVec;
+
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if ((schedule->portVec & ((MSD_U32)1 << port)) == 0U)
+        {
+            continue;
+        }
+
+        gcl = &schedule->port[port];
+        if ((gcl->numEntries == 0U) || (gcl->numEntries > MSD_QBV_GCL_MAX_ENTRIES))
+        {
+            MSD_DBG_ERROR(("Port %d has %u entries.\n", (int)port, (unsigned int)gcl->numEntries));
+            return MSD_BAD_PARAM;
+        }
+
+        total = 0;
+        for (i = 0; i < gcl->numEntries; i++)
+        {
+            interval = gcl->entry[i].interval;
+            if (((interval % MSD_QBV_GCL_WINDOW_UNIT) != 0U) ||
+                ((interval / MSD_QBV_GCL_WINDOW_UNIT) > MSD_QBV_GCL_MAX_WINDOW) ||
+                ((interval == 0U) && ((i + 1U) != gcl->numEntries)))
+            {
+                MSD_DBG_ERROR(("Port %d entry %u has bad interval %u ns.\n", (int)port, (unsigned int)i, (unsigned int)interval));
+                return MSD_BAD_PARAM;
+            }
+            total += interval;
+
+            image->gates[port][i] = gcl->entry[i].gateStates;
+            image->window[port][i] = (MSD_U16)(interval / MSD_QBV_GCL_WINDOW_UNIT);
+        }
+
+        if (total > schedule->cycleTime)
+        {
+            MSD_DBG_ERROR(("Port %d list exceeds the cycle time.\n", (int)port));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdQbvGclLoad
+*
+* DESCRIPTION:
+*       This function writes a compiled schedule into the Qbv table of each
+*       port of the image, then updates the TAI trigger generator. With a
+*       shadow attached only the entries, and the trigger settings, that
+*       differ from what the API last wrote are written.
+*
+* INPUTS:
+*       devNum - physical device number
+*       image  - Qbv table images produced by msdQbvGclCompile
+*
+* OUTPUTS:
+*       numWrites - number of Qbv register writes, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclLoad
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_GCL_IMAGE  *image,
+    OUT MSD_U32  *numWrites
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QBV_GCL_SHADOW *shadow;
+    MSD_LPORT port;
+    MSD_U32 bit;
+    MSD_U32 i;
+    MSD_U32 count = 0;
+    MSD_BOOL full;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (NULL == image)
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if (!MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvWrite))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+    if (msdQbvGclPortVecValid(dev, image->portVec) != MSD_TRUE)
+    {
+        MSD_DBG_ERROR(("Bad port vector 0x%x.\n", (unsigned int)image->portVec));
+        return MSD_BAD_PARAM;
+    }
+
+    shadow = dev->qbvGclShadow;
+
+    for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts); port++)
+    {
+        bit = (MSD_U32)1 << port;
+        if ((image->portVec & bit) == 0U)
+        {
+            continue;
+        }
+
+        full = MSD_TRUE;
+        if (shadow != NULL)
+        {
+            full = ((shadow->validVec & bit) != 0U) ? MSD_FALSE : MSD_TRUE;
+            shadow->validVec &= ~bit;
+        }
+
+        for (i = 0; (retVal == MSD_OK) && (i < MSD_QBV_GCL_MAX_ENTRIES); i++)
+        {
+            if ((full != MSD_TRUE) &&
+                (shadow->gates[port][i] == image->gates[port][i]) &&
+                (shadow->window[port][i] == image->window[port][i]))
+            {
+                continue;
+            }
+
+            retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysQbvWrite)(dev, (MSD_U8)port,
+                (MSD_U8)MSD_QBV_REG_WINDOW, image->window[port][i]);
+            if (retVal == MSD_OK)
+            {
+                retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysQbvWrite)(dev, (MSD_U8)port,
+                    (MSD_U8)MSD_QBV_REG_ENTRY,
+                    (MSD_U16)(MSD_QBV_ENTRY_UPDATE | ((i & MSD_QBV_ENTRY_PTR_MASK) << MSD_QBV_ENTRY_PTR_SHIFT) |
+                    (MSD_U32)image->gates[port][i]));
+            }
+            if (retVal == MSD_OK)
+            {
+                if (shadow != NULL)
+                {
+                    shadow->gates[port][i] = image->gates[port][i];
+                    shadow->window[port][i] = image->window[port][i];
+                }
+                count += 2U;
+            }
+        }
+
+        if ((retVal == MSD_OK) && (shadow != NULL))
+        {
+            shadow->validVec |= bit;
+        }
+    }
+
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Qbv table write returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+
+    /* the cycle is clocked from the TAI trigger, change it once the tables
+       hold the new lists so that the new cycle starts on the new lists */
+    if ((retVal == MSD_OK) &&
+        ((shadow == NULL) || (shadow->timeValid != MSD_TRUE) ||
+        (shadow->cycleTicks != image->cycleTicks) ||
+        (shadow->baseTime != image->baseTime)))
+    {
+        if (shadow != NULL)
+        {
+            shadow->timeValid = MSD_FALSE;
+        }
+        retVal = msdQbvGclTimeWrite(devNum, image->cycleTicks, image->baseTime);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("TAI trigger write returned: %s.\n", msdDisplayStatus(retVal)));
+        }
+        else if (shadow != NULL)
+        {
+            shadow->cycleTicks = image->cycleTicks;
+            shadow->baseTime = image->baseTime;
+            shadow->timeValid = MSD_TRUE;
+        }
+    }
+
+    if (numWrites != NULL)
+    {
+        *numWrites = count;
+    }
+    return retVal;
+}
+
+/*******************************************************************************
+* msdQbvGclInvalidate
+*
+* DESCRIPTION:
+*       This function drops the table images remembered in the attached
+*       shadow.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Does nothing if no shadow is attached.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclInvalidate
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (!MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvWrite))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+
+    if (dev->qbvGclShadow != NULL)
+    {
+        msdMemSet((void*)dev->qbvGclShadow, 0, sizeof(MSD_QBV_GCL_SHADOW));
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdQbvGclShadowAttach
+*
+* DESCRIPTION:
+*       This function attaches a gate control list shadow to the device.
+*
+* INPUTS:
+*       devNum - physical device number
+*       shadow - shadow memory, owned by the caller until msdQbvGclShadowDetach
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a shadow already
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclShadowAttach
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_QBV_GCL_SHADOW  *shadow
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (!MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvWrite))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+    if (NULL == shadow)
+    {
+        MSD_DBG_ERROR(("Input param shadow is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if (dev->qbvGclShadow != NULL)
+    {
+        MSD_DBG_ERROR(("Qbv gate control list shadow already exists.\n"));
+        return MSD_ALREADY_EXIST;
+    }
+
+    msdMemSet((void*)shadow, 0, sizeof(MSD_QBV_GCL_SHADOW));
+    dev->qbvGclShadow = shadow;
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdQbvGclShadowDetach
+*
+* DESCRIPTION:
+*       This function detaches the gate control list shadow of the device.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdQbvGclShadowDetach
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if (dev->qbvGclShadow == NULL)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    dev->qbvGclShadow = NULL;
+
+    return MSD_OK;
+}
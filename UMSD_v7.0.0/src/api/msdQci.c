@@ -20,6 +20,8 @@
 #include <api/msdQci.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <platform/msdSem.h>
+#include <driver/msdDevObj.h>
 
 /******************************************************************************
 * msdStreamFilterFlushAll
@@ -56,9 +58,9 @@ IN MSD_U8 devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltFlushAll))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltFlushAll(dev);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltFlushAll)(dev);
 		}
 		else
 		{
@@ -109,9 +111,9 @@ IN  MSD_U8   blockEn
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltSet(dev, streamFilterId, maxSDUSize, blockEn);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltSet)(dev, streamFilterId, maxSDUSize, blockEn);
 		}
 		else
 		{
@@ -160,9 +162,9 @@ IN  MSD_U8	 blockStatus
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltBlockStatSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatSet(dev, streamFilterId, blockStatus);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltBlockStatSet)(dev, streamFilterId, blockStatus);
 		}
 		else
 		{
@@ -211,9 +213,9 @@ OUT MSD_U8	 *blockStatus
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltBlockStatGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatGet(dev, streamFilterId, blockStatus);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltBlockStatGet)(dev, streamFilterId, blockStatus);
 		}
 		else
 		{
@@ -262,9 +264,9 @@ IN  MSD_U8	 atsId
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltEnAts != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltEnAts))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltEnAts(dev, streamFilterId, atsId);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltEnAts)(dev, streamFilterId, atsId);
 		}
 		else
 		{
@@ -313,9 +315,9 @@ IN  MSD_U8	 gateId
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltEnGate != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltEnGate))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltEnGate(dev, streamFilterId, gateId);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltEnGate)(dev, streamFilterId, gateId);
 		}
 		else
 		{
@@ -364,9 +366,9 @@ OUT MSD_U16	 *counter
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltMatchCtrGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltMatchCtrGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltMatchCtrGet(dev, streamFilterId, counter);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltMatchCtrGet)(dev, streamFilterId, counter);
 		}
 		else
 		{
@@ -415,9 +417,9 @@ OUT MSD_U16	 *counter
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamFiltFilterCtrGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamFiltFilterCtrGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamFiltFilterCtrGet(dev, streamFilterId, counter);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamFiltFilterCtrGet)(dev, streamFilterId, counter);
 		}
 		else
 		{
@@ -465,9 +467,9 @@ OUT MSD_U16	 *counter
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateFiltCtrGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateFiltCtrGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateFiltCtrGet(dev, streamFilterId, counter);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateFiltCtrGet)(dev, streamFilterId, counter);
 		}
 		else
 		{
@@ -515,9 +517,9 @@ MSD_STATUS msdFlowMeterFiltedCounterGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterFiltCtrGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterFiltCtrGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterFiltCtrGet(dev, streamFilterId, counter);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterFiltCtrGet)(dev, streamFilterId, counter);
 		}
 		else
 		{
@@ -526,6 +528,93 @@ MSD_STATUS msdFlowMeterFiltedCounterGet
 	}
 }
 
+/******************************************************************************
+* msdPsfpStatsSnapshot
+*
+* DESCRIPTION:
+*        This routine reads the matching, stream filter filtered, stream gate
+*        filtered and flow meter filtered frames counters of a set of stream
+*        filters in one locked pass and accumulates their change into 64 bits
+*        totals.
+*
+* INPUTS:
+*        devNum    - physical device number
+*        filterVec - vector of the stream filter instances to read
+*        ctx       - statistics context, zeroed before the first snapshot
+*
+* OUTPUTS:
+*        ctx       - counters and PTP global time of this snapshot in raw,
+*                    updated totals in total, indexed by MSD_PSFP_CNT
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The hardware counters are 16 bits wide and are not cleared. A stream
+*        filter must be read before its counters wrap more than once.
+*
+******************************************************************************/
+MSD_STATUS msdPsfpStatsSnapshot
+(
+IN  MSD_U8   devNum,
+IN  MSD_U32  filterVec,
+INOUT MSD_PSFP_STATS_CTX *ctx
+)
+{
+	MSD_STATUS retVal;
+	MSD_PSFP_COUNTERS now;
+	MSD_U32 id;
+	MSD_U32 i;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	if (ctx == NULL)
+	{
+		MSD_DBG_ERROR(("Input param ctx in msdPsfpStatsSnapshot is NULL. \n"));
+		return MSD_BAD_PARAM;
+	}
+	if (!MSD_DEV_HAS(dev, QCIObj, gqciCountersGetBulk))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+
+	retVal = MSD_DEV_FN(dev, QCIObj, gqciCountersGetBulk)(dev, filterVec, &now);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	for (id = 0; id < MSD_PSFP_MAX_STREAM_FILTER; id++)
+	{
+		if ((now.filterVec & ((MSD_U32)1 << id)) == 0U)
+		{
+			continue;
+		}
+		for (i = 0; i < (MSD_U32)MSD_PSFP_CNT_NUM; i++)
+		{
+			if ((ctx->raw.filterVec & ((MSD_U32)1 << id)) == 0U)
+			{
+				ctx->total[id][i] += now.counter[id][i];
+			}
+			else
+			{
+				ctx->total[id][i] += (MSD_U16)(now.counter[id][i] - ctx->raw.counter[id][i]);
+			}
+			ctx->raw.counter[id][i] = now.counter[id][i];
+		}
+	}
+	ctx->raw.filterVec |= now.filterVec;
+	ctx->raw.timestamp = now.timestamp;
+
+	return retVal;
+}
+
 /******************************************************************************
 * msdStreamGateFlushAll
 *
@@ -561,9 +650,9 @@ IN MSD_U8 devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateFlushAll))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateFlushAll(dev);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateFlushAll)(dev);
 		}
 		else
 		{
@@ -616,9 +705,9 @@ IN  MSD_U8	defGateIPV
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateDefStateSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateDefStateSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateDefStateSet(dev, streamGateId, defGateState, defGateIPVEn, defGateIPV);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateDefStateSet)(dev, streamGateId, defGateState, defGateIPVEn, defGateIPV);
 		}
 		else
 		{
@@ -669,9 +758,9 @@ IN  MSD_U8	 byteScale
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateScaleSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateScaleSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateScaleSet(dev, streamGateId, timeScale, byteScale);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateScaleSet)(dev, streamGateId, timeScale, byteScale);
 		}
 		else
 		{
@@ -720,9 +809,9 @@ IN  MSD_U8	 streamGateTimeGenId
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenIdSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateTimeGenIdSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenIdSet(dev, streamGateId, streamGateTimeGenId);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateTimeGenIdSet)(dev, streamGateId, streamGateTimeGenId);
 		}
 		else
 		{
@@ -773,9 +862,9 @@ IN  MSD_STREAM_GATE_ENTRY *streamGateEntry
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateEntryAdd != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateEntryAdd))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateEntryAdd(dev, streamGateId, pointer, streamGateEntry);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateEntryAdd)(dev, streamGateId, pointer, streamGateEntry);
 		}
 		else
 		{
@@ -821,9 +910,9 @@ IN  MSD_U8   devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenFlush != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateTimeGenFlush))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenFlush(dev);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateTimeGenFlush)(dev);
 		}
 		else
 		{
@@ -874,9 +963,77 @@ IN  MSD_U64  gateBaseTime
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateTimeGenSet))
+		{
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateTimeGenSet)(dev, streamGateGenId, gateCycleTime, gateBaseTime);
+		}
+		else
+		{
+			return MSD_NOT_SUPPORTED;
+		}
+	}
+}
+
+
+/******************************************************************************
+* msdStreamGateScheduleSet
+*
+* DESCRIPTION:
+*        This routine programs the complete schedule of a stream gate instance
+*        in one transaction: gate control entries, time generation identifier
+*        and time generation cycle and base time. With a stream gate shadow
+*        attached (msdStreamGateShadowAttach) only the entries and settings
+*        that differ from what this routine wrote last are programmed, else
+*        everything is programmed.
+*
+* INPUTS:
+*        devNum       - physical device number
+*        streamGateId - stream gate instance identifier
+*        schedule     - stream gate schedule
+*
+* OUTPUTS:
+*        checksum  - CRC-16/CCITT of the schedule as programmed by this
+*                    routine, over the 16 gate control entries (gate fields of
+*                    register 5, registers 6 and 7, low byte first), the time
+*                    generation identifier, cycle time and base time (low byte
+*                    first), may be NULL
+*        numWrites - number of gate control entries, gate settings and time
+*                    generation instances written, may be NULL
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The time generation instance is written last, so the new gate control
+*        list starts at the new base time. Stream gate flush and the single
+*        entry APIs make the next call rewrite the affected parts.
+*        The checksum is computed from the schedule as written, it is not
+*        read back and does not detect a wrong hardware load.
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateScheduleSet
+(
+IN  MSD_U8   devNum,
+IN  MSD_U8   streamGateId,
+IN  MSD_STREAM_GATE_SCHEDULE *schedule,
+OUT MSD_U16  *checksum,
+OUT MSD_U32  *numWrites
+)
+{
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+	else
+	{
+		if (MSD_DEV_HAS(dev, QCIObj, gqciStreamGateScheduleSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenSet(dev, streamGateGenId, gateCycleTime, gateBaseTime);
+			return MSD_DEV_FN(dev, QCIObj, gqciStreamGateScheduleSet)(dev, streamGateId, schedule, checksum, numWrites);
 		}
 		else
 		{
@@ -885,6 +1042,113 @@ IN  MSD_U64  gateBaseTime
 	}
 }
 
+/******************************************************************************
+* msdStreamGateShadowAttach
+*
+* DESCRIPTION:
+*        This routine attaches a stream gate shadow to the device. With a
+*        shadow msdStreamGateScheduleSet only writes what changed.
+*
+* INPUTS:
+*        devNum - physical device number
+*        shadow - shadow memory, owned by the caller until
+*                 msdStreamGateShadowDetach
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_ALREADY_EXIST - if the device has a shadow already
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The shadow starts empty, so the first schedule of every stream gate
+*        is written in full.
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateShadowAttach
+(
+IN  MSD_U8   devNum,
+IN  MSD_QCI_GATE_SHADOW *shadow
+)
+{
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	if (!MSD_DEV_HAS(dev, QCIObj, gqciStreamGateScheduleSet))
+		return MSD_NOT_SUPPORTED;
+
+	if (shadow == NULL)
+	{
+		MSD_DBG_ERROR(("shadow is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdMemSet((void*)shadow, 0, sizeof(MSD_QCI_GATE_SHADOW));
+
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+	if (dev->qciGateShadow != NULL)
+	{
+		msdSemGive(dev->devNum, dev->qciRegsSem);
+		MSD_DBG_ERROR(("Stream gate shadow already exists.\n"));
+		return MSD_ALREADY_EXIST;
+	}
+	dev->qciGateShadow = shadow;
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+
+	return MSD_OK;
+}
+
+/******************************************************************************
+* msdStreamGateShadowDetach
+*
+* DESCRIPTION:
+*        This routine detaches the stream gate shadow of the device.
+*
+* INPUTS:
+*        devNum - physical device number
+*
+* OUTPUTS:
+*        None.
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS msdStreamGateShadowDetach
+(
+IN  MSD_U8   devNum
+)
+{
+	MSD_QCI_GATE_SHADOW *shadow;
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	/* wait for a schedule update in progress */
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+	shadow = dev->qciGateShadow;
+	dev->qciGateShadow = NULL;
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+
+	return (shadow == NULL) ? MSD_NO_SUCH : MSD_OK;
+}
+
 
 /******************************************************************************
 * msdFlowMeterFlushAll
@@ -922,9 +1186,9 @@ IN  MSD_U8   devNum
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterFlushAll))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterFlushAll(dev);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterFlushAll)(dev);
 		}
 		else
 		{
@@ -974,9 +1238,9 @@ IN  MSD_U8   couplingFlag
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterCoupleFlagSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagSet(dev, flowMeterId, couplingFlag);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterCoupleFlagSet)(dev, flowMeterId, couplingFlag);
 		}
 		else
 		{
@@ -1025,9 +1289,9 @@ OUT MSD_U8   *couplingFlag
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterCoupleFlagGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagGet(dev, flowMeterId, couplingFlag);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterCoupleFlagGet)(dev, flowMeterId, couplingFlag);
 		}
 		else
 		{
@@ -1077,9 +1341,9 @@ IN  MSD_U8   dropOnYel
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterDropOnYelSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelSet(dev, flowMeterId, dropOnYel);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterDropOnYelSet)(dev, flowMeterId, dropOnYel);
 		}
 		else
 		{
@@ -1128,9 +1392,9 @@ OUT MSD_U8   *dropOnYel
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterDropOnYelGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelGet(dev, flowMeterId, dropOnYel);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterDropOnYelGet)(dev, flowMeterId, dropOnYel);
 		}
 		else
 		{
@@ -1180,9 +1444,9 @@ IN  MSD_U8   enable
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterRedBlockEnSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnSet(dev, flowMeterId, enable);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterRedBlockEnSet)(dev, flowMeterId, enable);
 		}
 		else
 		{
@@ -1231,9 +1495,9 @@ OUT MSD_U8   *enable
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterRedBlockEnGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnGet(dev, flowMeterId, enable);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterRedBlockEnGet)(dev, flowMeterId, enable);
 		}
 		else
 		{
@@ -1283,9 +1547,9 @@ IN  MSD_U8   status
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatSet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterRedBlkStatSet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatSet(dev, flowMeterId, status);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterRedBlkStatSet)(dev, flowMeterId, status);
 		}
 		else
 		{
@@ -1334,9 +1598,9 @@ OUT MSD_U8   *status
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatGet != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterRedBlkStatGet))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatGet(dev, flowMeterId, status);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterRedBlkStatGet)(dev, flowMeterId, status);
 		}
 		else
 		{
@@ -1390,9 +1654,9 @@ IN  MSD_U8   countMode
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QCIObj.gqciFlowMeterAdvConfig != NULL)
+		if (MSD_DEV_HAS(dev, QCIObj, gqciFlowMeterAdvConfig))
 		{
-			return dev->SwitchDevObj.QCIObj.gqciFlowMeterAdvConfig(dev, flowMeterId, tgtRate, bstSize, countMode);
+			return MSD_DEV_FN(dev, QCIObj, gqciFlowMeterAdvConfig)(dev, flowMeterId, tgtRate, bstSize, countMode);
 		}
 		else
 		{
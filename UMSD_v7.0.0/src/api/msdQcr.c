@@ -20,6 +20,7 @@
 #include <api/msdQcr.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdQcrFlushOne
@@ -59,9 +60,9 @@ IN  MSD_U16    atsEntryId
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrFlushOne != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrFlushOne))
         {
-            retVal = dev->SwitchDevObj.QCRObj.gqcrFlushOne(dev, atsEntryId);
+            retVal = MSD_DEV_FN(dev, QCRObj, gqcrFlushOne)(dev, atsEntryId);
         }    
         else
         {
@@ -105,9 +106,9 @@ IN  MSD_U8   devNum
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrFlushAll != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrFlushAll))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrFlushAll(dev);
+            return MSD_DEV_FN(dev, QCRObj, gqcrFlushAll)(dev);
         }
         else
         {
@@ -156,9 +157,9 @@ IN  MSD_U16  atsEntryGrpId
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrSetGrpId != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrSetGrpId))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrSetGrpId(dev, atsEntryId, atsEntryGrpId);
+            return MSD_DEV_FN(dev, QCRObj, gqcrSetGrpId)(dev, atsEntryId, atsEntryGrpId);
         }
         else
         {
@@ -207,9 +208,9 @@ OUT  MSD_U16*   const   atsEntryGrpId
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrGetGrpId != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrGetGrpId))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrGetGrpId(dev, atsEntryId, atsEntryGrpId);
+            return MSD_DEV_FN(dev, QCRObj, gqcrGetGrpId)(dev, atsEntryId, atsEntryGrpId);
         }
         else
         {
@@ -257,9 +258,9 @@ IN  MSD_U32             atsCbsLimit
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrSetCbsLimit != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrSetCbsLimit))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrSetCbsLimit(dev, atsEntryId, atsCbsLimit);
+            return MSD_DEV_FN(dev, QCRObj, gqcrSetCbsLimit)(dev, atsEntryId, atsCbsLimit);
         }
         else
         {
@@ -307,9 +308,9 @@ OUT MSD_U32*    const   atsCbsLimit
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrGetCbsLimit != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrGetCbsLimit))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrGetCbsLimit(dev, atsEntryId, atsCbsLimit);
+            return MSD_DEV_FN(dev, QCRObj, gqcrGetCbsLimit)(dev, atsEntryId, atsCbsLimit);
         }
         else
         {
@@ -363,9 +364,9 @@ IN  MSD_U32             rateLimit
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrSetRateLimit != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrSetRateLimit))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrSetRateLimit(dev, atsEntryId, rateLimit);
+            return MSD_DEV_FN(dev, QCRObj, gqcrSetRateLimit)(dev, atsEntryId, rateLimit);
         }
         else
         {
@@ -415,9 +416,9 @@ OUT MSD_U32*    const   rateLimit
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrGetRateLimit != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrGetRateLimit))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrGetRateLimit(dev, atsEntryId, rateLimit);
+            return MSD_DEV_FN(dev, QCRObj, gqcrGetRateLimit)(dev, atsEntryId, rateLimit);
         }
         else
         {
@@ -469,9 +470,9 @@ IN  MSD_U16     maxResidenceTime
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrSetMaxResidenceTime != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrSetMaxResidenceTime))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrSetMaxResidenceTime(dev, atsEntryId, maxTimeScale, maxResidenceTime);
+            return MSD_DEV_FN(dev, QCRObj, gqcrSetMaxResidenceTime)(dev, atsEntryId, maxTimeScale, maxResidenceTime);
         }
         else
         {
@@ -523,9 +524,9 @@ OUT MSD_U16*    const   maxResidenceTime
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrGetMaxResidenceTime != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrGetMaxResidenceTime))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrGetMaxResidenceTime(dev, atsEntryId, maxTimeScale, maxResidenceTime);
+            return MSD_DEV_FN(dev, QCRObj, gqcrGetMaxResidenceTime)(dev, atsEntryId, maxTimeScale, maxResidenceTime);
         }
         else
         {
@@ -578,9 +579,9 @@ IN  MSD_BOOL            status
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrSetQueueEnables != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrSetQueueEnables))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrSetQueueEnables(dev, port, queue, status);
+            return MSD_DEV_FN(dev, QCRObj, gqcrSetQueueEnables)(dev, port, queue, status);
         }
         else
         {
@@ -633,9 +634,9 @@ OUT MSD_BOOL*           status
     }
     else
     {
-        if (dev->SwitchDevObj.QCRObj.gqcrGetQueueEnables != NULL)
+        if (MSD_DEV_HAS(dev, QCRObj, gqcrGetQueueEnables))
         {
-            return dev->SwitchDevObj.QCRObj.gqcrGetQueueEnables(dev, port, queue, status);
+            return MSD_DEV_FN(dev, QCRObj, gqcrGetQueueEnables)(dev, port, queue, status);
         }
         else
         {
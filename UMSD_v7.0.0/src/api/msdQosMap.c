@@ -20,6 +20,8 @@
 #include <api/msdQosMap.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <platform/msdSem.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdQosPortPrioMapSet
@@ -82,9 +84,9 @@ MSD_STATUS msdQosPortPrioMapSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetIEEEPrioMap))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap(dev, portNum, table, entryPtr, entryStruct);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetIEEEPrioMap)(dev, portNum, table, entryPtr, entryStruct);
 		}
 		else
 		{
@@ -153,9 +155,9 @@ MSD_STATUS msdQosPortPrioMapGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetIEEEPrioMap))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap(dev, portNum, table, entryPtr, entryStruct);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetIEEEPrioMap)(dev, portNum, table, entryPtr, entryStruct);
 		}
 		else
 		{
@@ -208,9 +210,9 @@ MSD_STATUS msdQosPortCosToQueueSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetCosToQueue))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue(dev, portNum, cosVal, queue);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToQueue)(dev, portNum, cosVal, queue);
 		}
 		else
 		{
@@ -261,9 +263,9 @@ MSD_STATUS msdQosPortCosToQueueGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetCosToQueue))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue(dev, portNum, cosVal, queue);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetCosToQueue)(dev, portNum, cosVal, queue);
 		}
 		else
 		{
@@ -317,9 +319,9 @@ MSD_STATUS msdQosPortCosToDscpMappingSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetCosToDscp))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp(dev, portNum, cosVal, dscp);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToDscp)(dev, portNum, cosVal, dscp);
 		}
 		else
 		{
@@ -371,9 +373,289 @@ MSD_STATUS msdQosPortCosToDscpMappingGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetCosToDscp))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp(dev, portNum, cosVal, dscp);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetCosToDscp)(dev, portNum, cosVal, dscp);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdQosPortPrioMapTableSet
+*
+* DESCRIPTION:
+*       This API sets all entries of one port IEEE Priority Mapping table.
+*       With a QoS map shadow attached (msdQosMapShadowAttach), entries whose
+*       copy holds the requested value are skipped.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portNum		- the logical port number
+*       table		- Frame Priority Table set, see msdQosPortPrioMapSet
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortPrioMapTableSet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_LPORT portNum,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+	else
+	{
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetIEEEPrioMapTable))
+		{
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetIEEEPrioMapTable)(dev, portNum, table, entries);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdQosPortPrioMapTableGet
+*
+* DESCRIPTION:
+*       This API gets all entries of one port IEEE Priority Mapping table.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portNum		- the logical port number
+*       table		- Frame Priority Table set, see msdQosPortPrioMapGet
+*
+* OUTPUTS:
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortPrioMapTableGet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_LPORT portNum,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    OUT MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+	else
+	{
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetIEEEPrioMapTable))
+		{
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetIEEEPrioMapTable)(dev, portNum, table, entries);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdQosPortsPrioMapTableSet
+*
+* DESCRIPTION:
+*       This API sets the same IEEE Priority Mapping table on every port in a
+*       port vector. With a QoS map shadow attached (msdQosMapShadowAttach),
+*       entries whose copy holds the requested value are skipped.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       portVec		- logical port vector, bit N set selects port N
+*       table		- Frame Priority Table set, see msdQosPortPrioMapSet
+*       entries		- MSD_IEEE_PRIORITY_TABLE_SIZE mapping data structures,
+*					  indexed by entry pointer
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortsPrioMapTableSet
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_U32   portVec,
+    IN  MSD_IEEE_PRIORITY_TABLE_SET table,
+    IN  MSD_IEEE_PRIORITY_TABLE_STRUCT *entries
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+	else
+	{
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetIEEEPrioMapTablePorts))
+		{
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetIEEEPrioMapTablePorts)(dev, portVec, table, entries);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdQosPortCosToQueueTableSet
+*
+* DESCRIPTION:
+*       Updates the COS to egress queue mapping of all cos values of a port.
+*       Entries already holding the requested queue are skipped.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       portNum - the logical port number
+*       queue   - MSD_IEEE_PRIORITY_TABLE_SIZE physical queues, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortCosToQueueTableSet
+(
+    IN  MSD_U8     devNum,
+    IN  MSD_LPORT  portNum,
+    IN  MSD_U8     *queue
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+	else
+	{
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetCosToQueueTable))
+		{
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToQueueTable)(dev, portNum, queue);
+		}
+		else
+		{
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* msdQosPortCosToDscpTableSet
+*
+* DESCRIPTION:
+*       Updates the COS to DSCP mapping of all cos values of a port.
+*       Entries already holding the requested DSCP are skipped.
+*
+* INPUTS:
+*       devNum  - physical device number
+*       portNum - the logical port number
+*       dscp    - MSD_IEEE_PRIORITY_TABLE_SIZE frame differentiated services
+*                 code points, indexed by cos
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosPortCosToDscpTableSet
+(
+    IN  MSD_U8      devNum,
+    IN  MSD_LPORT   portNum,
+    IN  MSD_U8      *dscp
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        retVal = MSD_FAIL;
+    }
+	else
+	{
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetCosToDscpTable))
+		{
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToDscpTable)(dev, portNum, dscp);
 		}
 		else
 		{
@@ -424,9 +706,9 @@ MSD_STATUS msdPortDefQPriSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetDefQpri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri(dev, portNum, defQPri);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetDefQpri)(dev, portNum, defQPri);
 		}
 		else
 		{
@@ -475,9 +757,9 @@ MSD_STATUS msdPortDefQPriGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetDefQpri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri(dev, portNum, defQPri);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetDefQpri)(dev, portNum, defQPri);
 		}
 		else
 		{
@@ -527,9 +809,9 @@ MSD_STATUS msdPortDefFPriSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetDefFpri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri(dev, portNum, defFPri);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetDefFpri)(dev, portNum, defFPri);
 		}
 		else
 		{
@@ -578,9 +860,9 @@ MSD_STATUS msdPortDefFPriGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetDefFpri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri(dev, portNum, defFPri);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetDefFpri)(dev, portNum, defFPri);
 		}
 		else
 		{
@@ -635,9 +917,9 @@ MSD_STATUS msdPortPrioRuleSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gqosSetPrioMapRule))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gqosSetPrioMapRule)(dev, portNum, en);
 		}
 		else
 		{
@@ -691,9 +973,9 @@ MSD_STATUS msdPortPrioRuleGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gqosGetPrioMapRule))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gqosGetPrioMapRule)(dev, portNum, en);
 		}
 		else
 		{
@@ -750,9 +1032,9 @@ MSD_STATUS msdPortInitialPriSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtSetInitialPri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetInitialPri)(dev, portNum, mode);
 		}
 		else
 		{
@@ -807,9 +1089,9 @@ MSD_STATUS msdPortInitialPriGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetInitialPri))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtGetInitialPri)(dev, portNum, mode);
 		}
 		else
 		{
@@ -863,9 +1145,9 @@ MSD_STATUS msdQosPortRewriteDscp
     }
 	else
 	{
-		if (dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp != NULL)
+		if (MSD_DEV_HAS(dev, QOSMAPObj, gprtRewriteDscp))
 		{
-			retVal = dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp(dev, portNum, en);
+			retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtRewriteDscp)(dev, portNum, en);
 		}
 		else
 		{
@@ -874,4 +1156,115 @@ MSD_STATUS msdQosPortRewriteDscp
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+* msdQosMapShadowAttach
+*
+* DESCRIPTION:
+*       This API attaches a QoS map shadow to the device. With a shadow the
+*       IEEE Priority Mapping table set APIs skip entries whose copy already
+*       holds the requested value.
+*
+* INPUTS:
+*       devNum - physical device number
+*       shadow - shadow memory, owned by the caller until msdQosMapShadowDetach
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - if the device has a shadow already
+*       MSD_NOT_SUPPORTED - device not supported
+*
+* COMMENTS:
+*		The shadow starts empty. It only follows the QoS map APIs and snapshot
+*		restore; after a switch reset or raw register writes to the priority
+*		mapping tables detach it and attach it again to clear it.
+*
+*******************************************************************************/
+MSD_STATUS msdQosMapShadowAttach
+(
+    IN  MSD_U8    devNum,
+    IN  MSD_QOS_MAP_SHADOW *shadow
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+	if (!MSD_DEV_HAS(dev, QOSMAPObj, gprtSetIEEEPrioMapTablePorts))
+	{
+		return MSD_NOT_SUPPORTED;
+	}
+
+	if (NULL == shadow)
+	{
+		MSD_DBG_ERROR(("Input param shadow is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdMemSet((void*)shadow, 0, sizeof(MSD_QOS_MAP_SHADOW));
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+	if (dev->qosMapShadow != NULL)
+	{
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+		MSD_DBG_ERROR(("QoS map shadow already exists.\n"));
+		return MSD_ALREADY_EXIST;
+	}
+	dev->qosMapShadow = shadow;
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+
+	return MSD_OK;
+}
+
+/*******************************************************************************
+* msdQosMapShadowDetach
+*
+* DESCRIPTION:
+*       This API detaches the QoS map shadow of the device. The table set APIs
+*       write every entry again.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*       MSD_NO_SUCH - if the device has no shadow
+*
+* COMMENTS:
+*		None.
+*
+*******************************************************************************/
+MSD_STATUS msdQosMapShadowDetach
+(
+    IN  MSD_U8    devNum
+)
+{
+    MSD_QOS_MAP_SHADOW *shadow;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+
+	/* wait for a table update in progress */
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+	shadow = dev->qosMapShadow;
+	dev->qosMapShadow = NULL;
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+
+	return (shadow == NULL) ? MSD_NO_SUCH : MSD_OK;
+}
@@ -20,6 +20,7 @@
 #include <api/msdQueueCtrl.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdPortQueueCtrlGet
@@ -75,9 +76,9 @@ MSD_STATUS msdPortQueueCtrlGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtGetQueueCtrl))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl(dev, portNum, point, data);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtGetQueueCtrl)(dev, portNum, point, data);
 		}
 		else
 		{
@@ -143,9 +144,9 @@ MSD_STATUS msdPortQueueCtrlSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtSetQueueCtrl))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl(dev, portNum, point, data);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtSetQueueCtrl)(dev, portNum, point, data);
 		}
 		else
 		{
@@ -197,9 +198,9 @@ MSD_STATUS msdPortSchedGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtGetPortSched != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtGetPortSched))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtGetPortSched(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtGetPortSched)(dev, portNum, mode);
 		}
 		else
 		{
@@ -252,9 +253,9 @@ MSD_STATUS msdPortSchedSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtSetPortSched != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtSetPortSched))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtSetPortSched(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtSetPortSched)(dev, portNum, mode);
 		}
 		else
 		{
@@ -308,9 +309,9 @@ MSD_STATUS msdSysQoSWeightGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gsysGetQoSWeight))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight(dev, weight);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gsysGetQoSWeight)(dev, weight);
 		}
 		else
 		{
@@ -364,9 +365,9 @@ IN  MSD_QoS_WEIGHT  *weight
     }
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gsysSetQoSWeight))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight(dev, weight);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gsysSetQoSWeight)(dev, weight);
 		}
 		else
 		{
@@ -421,9 +422,9 @@ MSD_STATUS msdPortQoSWeightGet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtGetQoSWeight != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtGetQoSWeight))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtGetQoSWeight(dev, portNum, weight);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtGetQoSWeight)(dev, portNum, weight);
 		}
 		else
 		{
@@ -479,9 +480,9 @@ MSD_STATUS msdPortQoSWeightSet
 	}
 	else
 	{
-		if (dev->SwitchDevObj.QUEUEObj.gprtSetQoSWeight != NULL)
+		if (MSD_DEV_HAS(dev, QUEUEObj, gprtSetQoSWeight))
 		{
-			retVal = dev->SwitchDevObj.QUEUEObj.gprtSetQoSWeight(dev, portNum, weight);
+			retVal = MSD_DEV_FN(dev, QUEUEObj, gprtSetQoSWeight)(dev, portNum, weight);
 		}
 		else
 		{
@@ -20,6 +20,7 @@
 #include <api/msdRMU.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdRMUGetID
@@ -57,9 +58,9 @@ MSD_STATUS msdRMUGetID
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuGetID != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuGetID))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuGetID(dev, id);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuGetID)(dev, id);
 		}
 		else
 		{
@@ -109,9 +110,9 @@ MSD_STATUS msdRMUAtuDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuAtuDump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuAtuDump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuAtuDump(dev, startAddr, numOfEntry, atuEntry);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuAtuDump)(dev, startAddr, numOfEntry, atuEntry);
 		}
 		else
 		{
@@ -161,9 +162,9 @@ MSD_STATUS msdRMUEcidDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuEcidDump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuEcidDump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuEcidDump(dev, startAddr, numOfEntry, ecidEntry);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuEcidDump)(dev, startAddr, numOfEntry, ecidEntry);
 		}
 		else
 		{
@@ -213,9 +214,9 @@ MSD_STATUS msdRMUMibDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuMibDump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuMibDump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuMibDump(dev, enClearOnRead, portNum, statsCounterSet);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuMibDump)(dev, enClearOnRead, portNum, statsCounterSet);
 		}
 		else
 		{
@@ -265,9 +266,9 @@ MSD_STATUS msdRMUMib2Dump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuMib2Dump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuMib2Dump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuMib2Dump(dev, enClearOnRead, portNum, statsCounterSet);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuMib2Dump)(dev, enClearOnRead, portNum, statsCounterSet);
 		}
 		else
 		{
@@ -316,9 +317,9 @@ MSD_STATUS msdRMUMultiRegAccess
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuMultiRegAccess != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuMultiRegAccess))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuMultiRegAccess(dev, regCmdList, nCmd);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuMultiRegAccess)(dev, regCmdList, nCmd);
 		}
 		else
 		{
@@ -368,9 +369,9 @@ MSD_STATUS msdRMUTcamDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuTCAMDump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuTCAMDump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuTCAMDump(dev, startAddr, numOfEntry, tcamEntry);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuTCAMDump)(dev, startAddr, numOfEntry, tcamEntry);
 		}
 		else
 		{
@@ -418,9 +419,9 @@ MSD_STATUS msdRMUTcamEntryAdd
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuTCAMWrite != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuTCAMWrite))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuTCAMWrite(dev, tcamPointer, tcamEntry);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuTCAMWrite)(dev, tcamPointer, tcamEntry);
 		}
 		else
 		{
@@ -468,9 +469,9 @@ MSD_STATUS msdRMUTcamEntryRead
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuTCAMRead != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuTCAMRead))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuTCAMRead(dev, tcamPointer, tcamEntry);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuTCAMRead)(dev, tcamPointer, tcamEntry);
 		}
 		else
 		{
@@ -518,9 +519,9 @@ MSD_STATUS msdRMURegisterDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.RMUObj.grmuRegDump != NULL)
+		if (MSD_DEV_HAS(dev, RMUObj, grmuRegDump))
 		{
-			retVal = dev->SwitchDevObj.RMUObj.grmuRegDump(dev, devAddr, dataList);
+			retVal = MSD_DEV_FN(dev, RMUObj, grmuRegDump)(dev, devAddr, dataList);
 		}
 		else
 		{
@@ -0,0 +1,1774 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+
+/********************************************************************************
+* msdSnapshot.c
+*
+* DESCRIPTION:
+*       API definitions for binary configuration snapshot capture and restore.
+*
+* DEPENDENCIES:
+*       None.
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#include <api/msdSnapshot.h>
+#include <driver/msdApiTypes.h>
+#include <driver/msdHwAccess.h>
+#include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
+
+#define MSD_SNAPSHOT_GLOBAL1_ADDR	0x1BU
+#define MSD_SNAPSHOT_GLOBAL2_ADDR	0x1CU
+#define MSD_SNAPSHOT_MAX_FID		4096U
+
+/*
+ * Configuration registers, rewritten by msdSnapshotRestore and compared by
+ * msdSnapshotRegDiff in configOnly mode, bit n for register n.
+ * global 1: 0x04 global control, 0x0a ATU control, 0x0d to 0x0f switch MAC,
+ *           0x1c global control 2
+ * global 2: 0x01 and 0x03 interrupt masks, 0x05 switch management
+ * port:     0x01 physical control, 0x04 to 0x0d port control 0 to 2, VLAN
+ *           map, default VID, egress rate, association vector, ATU control
+ *           and override, 0x19 port control 3
+ * The other registers are status, counter or command and data registers of
+ * indirect tables.
+ */
+#define MSD_SNAPSHOT_GLOBAL1_RESTORE_MASK	0x1000E410U
+#define MSD_SNAPSHOT_GLOBAL2_RESTORE_MASK	0x0000002AU
+#define MSD_SNAPSHOT_PORT_RESTORE_MASK		0x02003FF2U
+
+/* Snapshot buffer being filled, used counts bytes beyond bufSize as well */
+typedef struct
+{
+    MSD_U8   *buf;
+    MSD_U32  bufSize;
+    MSD_U32  used;
+} MSD_SNAPSHOT_WRITER;
+
+/* One entry of a table walked with find and get next */
+typedef union
+{
+    MSD_STU_ENTRY  stu;
+    MSD_VTU_ENTRY  vtu;
+    MSD_SNAPSHOT_TCAM_ENTRY  tcam;
+} MSD_SNAPSHOT_TABLE_ENTRY;
+
+/* Access to a table whose entries are walked in ascending key order */
+typedef struct
+{
+    MSD_U32  recordSize;
+    MSD_STATUS (*next)(MSD_QD_DEV *dev, MSD_BOOL first, MSD_SNAPSHOT_TABLE_ENTRY *entry);
+    MSD_U32 (*key)(const MSD_SNAPSHOT_TABLE_ENTRY *entry);
+    MSD_STATUS (*write)(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry);
+    MSD_STATUS (*remove)(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry);
+} MSD_SNAPSHOT_TABLE_OPS;
+
+/*
+ * Table walks. The first call looks up the lowest key on its own, the
+ * following ones get the entry after entry. A key that does not increase
+ * means the device wrapped around and ends the walk.
+ */
+static MSD_STATUS msdSnapshotStuNext
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_BOOL first,
+    INOUT MSD_SNAPSHOT_TABLE_ENTRY *entry
+)
+{
+    MSD_STATUS retVal;
+    MSD_BOOL found = MSD_FALSE;
+    MSD_U16 sid = entry->stu.sid;
+
+    if (first == MSD_TRUE)
+    {
+        msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+        retVal = MSD_DEV_FN(dev, STUObj, gstuFindSidEntry)(dev, 0, &entry->stu, &found);
+        if ((retVal != MSD_OK) || (found == MSD_TRUE))
+        {
+            return retVal;
+        }
+        sid = 0;
+    }
+
+    msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+    entry->stu.sid = sid;
+    retVal = MSD_DEV_FN(dev, STUObj, gstuGetEntryNext)(dev, &entry->stu);
+    if ((retVal == MSD_OK) && (entry->stu.sid <= sid))
+    {
+        retVal = MSD_NO_SUCH;
+    }
+
+    return retVal;
+}
+
+static MSD_U32 msdSnapshotStuKey(const MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return (MSD_U32)entry->stu.sid;
+}
+
+static MSD_STATUS msdSnapshotStuWrite(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, STUObj, gstuAddEntry)(dev, &entry->stu);
+}
+
+static MSD_STATUS msdSnapshotStuRemove(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, STUObj, gstuDelEntry)(dev, entry->stu.sid);
+}
+
+static MSD_STATUS msdSnapshotVtuNext
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_BOOL first,
+    INOUT MSD_SNAPSHOT_TABLE_ENTRY *entry
+)
+{
+    MSD_STATUS retVal;
+    MSD_BOOL found = MSD_FALSE;
+    MSD_U16 vid = entry->vtu.vid;
+
+    if (first == MSD_TRUE)
+    {
+        msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+        retVal = MSD_DEV_FN(dev, VTUObj, gvtuFindVidEntry)(dev, 0, &entry->vtu, &found);
+        if ((retVal != MSD_OK) || (found == MSD_TRUE))
+        {
+            return retVal;
+        }
+        vid = 0;
+    }
+
+    msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+    entry->vtu.vid = vid;
+    retVal = MSD_DEV_FN(dev, VTUObj, gvtuGetEntryNext)(dev, &entry->vtu);
+    if ((retVal == MSD_OK) && (entry->vtu.vid <= vid))
+    {
+        retVal = MSD_NO_SUCH;
+    }
+
+    return retVal;
+}
+
+static MSD_U32 msdSnapshotVtuKey(const MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return (MSD_U32)entry->vtu.vid;
+}
+
+static MSD_STATUS msdSnapshotVtuWrite(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, VTUObj, gvtuAddEntry)(dev, &entry->vtu);
+}
+
+static MSD_STATUS msdSnapshotVtuRemove(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, VTUObj, gvtuDelEntry)(dev, entry->vtu.vid);
+}
+
+static MSD_STATUS msdSnapshotTcamNext
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_BOOL first,
+    INOUT MSD_SNAPSHOT_TABLE_ENTRY *entry
+)
+{
+    MSD_STATUS retVal;
+    MSD_BOOL found = MSD_FALSE;
+    MSD_U32 tcamPointer = entry->tcam.tcamPointer;
+
+    if (first == MSD_TRUE)
+    {
+        msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+        retVal = MSD_DEV_FN(dev, TCAMObj, gtcamFindEntry)(dev, 0, &entry->tcam.data, &found);
+        if ((retVal != MSD_OK) || (found == MSD_TRUE))
+        {
+            return retVal;
+        }
+        tcamPointer = 0;
+    }
+
+    msdMemSet((void*)entry, 0, sizeof(MSD_SNAPSHOT_TABLE_ENTRY));
+    entry->tcam.tcamPointer = tcamPointer;
+    retVal = MSD_DEV_FN(dev, TCAMObj, gtcamGetNextTCAMData)(dev, &entry->tcam.tcamPointer, &entry->tcam.data);
+    if ((retVal == MSD_OK) && (entry->tcam.tcamPointer <= tcamPointer))
+    {
+        retVal = MSD_NO_SUCH;
+    }
+
+    return retVal;
+}
+
+static MSD_U32 msdSnapshotTcamKey(const MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return entry->tcam.tcamPointer;
+}
+
+static MSD_STATUS msdSnapshotTcamWrite(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, TCAMObj, gtcamLoadEntry)(dev, entry->tcam.tcamPointer, &entry->tcam.data);
+}
+
+static MSD_STATUS msdSnapshotTcamRemove(MSD_QD_DEV *dev, MSD_SNAPSHOT_TABLE_ENTRY *entry)
+{
+    return MSD_DEV_FN(dev, TCAMObj, gtcamFlushEntry)(dev, entry->tcam.tcamPointer);
+}
+
+static const MSD_SNAPSHOT_TABLE_OPS msdSnapshotStuOps =
+{
+    sizeof(MSD_STU_ENTRY), msdSnapshotStuNext, msdSnapshotStuKey, msdSnapshotStuWrite, msdSnapshotStuRemove
+};
+
+static const MSD_SNAPSHOT_TABLE_OPS msdSnapshotVtuOps =
+{
+    sizeof(MSD_VTU_ENTRY), msdSnapshotVtuNext, msdSnapshotVtuKey, msdSnapshotVtuWrite, msdSnapshotVtuRemove
+};
+
+static const MSD_SNAPSHOT_TABLE_OPS msdSnapshotTcamOps =
+{
+    sizeof(MSD_SNAPSHOT_TCAM_ENTRY), msdSnapshotTcamNext, msdSnapshotTcamKey, msdSnapshotTcamWrite, msdSnapshotTcamRemove
+};
+
+/* Adler-32 of a byte array */
+static MSD_U32 msdSnapshotChecksum(const MSD_U8 *data, MSD_U32 size)
+{
+    MSD_U32 a = 1;
+    MSD_U32 b = 0;
+    MSD_U32 i;
+
+    for (i = 0; i < size; i++)
+    {
+        a = (a + data[i]) % 65521U;
+        b = (b + a) % 65521U;
+    }
+
+    return (b << 16) | a;
+}
+
+static MSD_U32 msdSnapshotRecordSize(MSD_U32 sectionId)
+{
+    MSD_U32 size;
+
+    switch (sectionId)
+    {
+    case MSD_SNAPSHOT_SECTION_REGS:
+        size = sizeof(MSD_SNAPSHOT_REG_BLOCK);
+        break;
+    case MSD_SNAPSHOT_SECTION_STU:
+        size = sizeof(MSD_STU_ENTRY);
+        break;
+    case MSD_SNAPSHOT_SECTION_VTU:
+        size = sizeof(MSD_VTU_ENTRY);
+        break;
+    case MSD_SNAPSHOT_SECTION_ATU:
+        size = sizeof(MSD_ATU_ENTRY);
+        break;
+    case MSD_SNAPSHOT_SECTION_TCAM:
+        size = sizeof(MSD_SNAPSHOT_TCAM_ENTRY);
+        break;
+    case MSD_SNAPSHOT_SECTION_PIRL:
+        size = sizeof(MSD_SNAPSHOT_PIRL_RES);
+        break;
+    default:
+        size = sizeof(MSD_SNAPSHOT_QOS_PORT);
+        break;
+    }
+
+    return size;
+}
+
+/* Sections are captured only if they can be restored on the same device */
+static MSD_BOOL msdSnapshotSectionSupported(MSD_QD_DEV *dev, MSD_U32 sectionId)
+{
+    MSD_BOOL supported;
+
+    switch (sectionId)
+    {
+    case MSD_SNAPSHOT_SECTION_REGS:
+        supported = MSD_TRUE;
+        break;
+    case MSD_SNAPSHOT_SECTION_STU:
+        supported = (MSD_DEV_HAS(dev, STUObj, gstuFindSidEntry) && MSD_DEV_HAS(dev, STUObj, gstuGetEntryNext) &&
+            MSD_DEV_HAS(dev, STUObj, gstuAddEntry) && MSD_DEV_HAS(dev, STUObj, gstuDelEntry)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_SNAPSHOT_SECTION_VTU:
+        supported = (MSD_DEV_HAS(dev, VTUObj, gvtuFindVidEntry) && MSD_DEV_HAS(dev, VTUObj, gvtuGetEntryNext) &&
+            MSD_DEV_HAS(dev, VTUObj, gvtuAddEntry) && MSD_DEV_HAS(dev, VTUObj, gvtuDelEntry)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_SNAPSHOT_SECTION_ATU:
+        supported = (MSD_DEV_HAS(dev, ATUObj, gfdbFindAtuMacEntry) && MSD_DEV_HAS(dev, ATUObj, gfdbGetAtuEntryNext) &&
+            MSD_DEV_HAS(dev, ATUObj, gfdbAddMacEntry) && MSD_DEV_HAS(dev, ATUObj, gfdbDelAtuEntry)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_SNAPSHOT_SECTION_TCAM:
+        supported = (MSD_DEV_HAS(dev, TCAMObj, gtcamFindEntry) && MSD_DEV_HAS(dev, TCAMObj, gtcamGetNextTCAMData) &&
+            MSD_DEV_HAS(dev, TCAMObj, gtcamLoadEntry) && MSD_DEV_HAS(dev, TCAMObj, gtcamFlushEntry)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    case MSD_SNAPSHOT_SECTION_PIRL:
+        supported = (MSD_DEV_HAS(dev, PIRLObj, gpirlReadResource) &&
+            MSD_DEV_HAS(dev, PIRLObj, gpirlWriteResource)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    default:
+        supported = (MSD_DEV_HAS(dev, QOSMAPObj, gprtGetIEEEPrioMapTable) &&
+            MSD_DEV_HAS(dev, QOSMAPObj, gprtSetIEEEPrioMapTable)) ? MSD_TRUE : MSD_FALSE;
+        break;
+    }
+
+    return supported;
+}
+
+/* Append a record to a section, only copied while it fits */
+static void msdSnapshotPut
+(
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section,
+    IN  const void *record
+)
+{
+    if ((writer->used + section->recordSize) <= writer->bufSize)
+    {
+        msdMemCpy((void*)(writer->buf + writer->used), record, section->recordSize);
+    }
+    writer->used += section->recordSize;
+    section->count++;
+}
+
+/* Start the next section on a 4 byte boundary, padding is zeroed */
+static void msdSnapshotAlign(INOUT MSD_SNAPSHOT_WRITER *writer)
+{
+    while ((writer->used & 0x3U) != 0U)
+    {
+        if (writer->used < writer->bufSize)
+        {
+            writer->buf[writer->used] = 0;
+        }
+        writer->used++;
+    }
+}
+
+/* SMI device addresses of the register blocks, global 1, global 2 and the ports */
+static MSD_U32 msdSnapshotRegAddrGet(MSD_QD_DEV *dev, MSD_U8 *devAddr)
+{
+    MSD_U32 num = 0;
+    MSD_LPORT port;
+
+    devAddr[num++] = MSD_SNAPSHOT_GLOBAL1_ADDR;
+    devAddr[num++] = MSD_SNAPSHOT_GLOBAL2_ADDR;
+    for (port = 0; (port < dev->numOfPorts) && (num < MSD_SNAPSHOT_MAX_REG_BLOCKS); port++)
+    {
+        devAddr[num++] = (MSD_U8)(dev->baseRegAddr + MSD_LPORT_2_PORT(port));
+    }
+
+    return num;
+}
+
+static MSD_U32 msdSnapshotRegRestoreMask(MSD_QD_DEV *dev, MSD_U8 devAddr)
+{
+    MSD_U32 mask = 0;
+    MSD_LPORT port;
+
+    if (devAddr == MSD_SNAPSHOT_GLOBAL1_ADDR)
+    {
+        mask = MSD_SNAPSHOT_GLOBAL1_RESTORE_MASK;
+    }
+    else if (devAddr == MSD_SNAPSHOT_GLOBAL2_ADDR)
+    {
+        mask = MSD_SNAPSHOT_GLOBAL2_RESTORE_MASK;
+    }
+    else
+    {
+        for (port = 0; port < dev->numOfPorts; port++)
+        {
+            if (devAddr == (MSD_U8)(dev->baseRegAddr + MSD_LPORT_2_PORT(port)))
+            {
+                mask = MSD_SNAPSHOT_PORT_RESTORE_MASK;
+                break;
+            }
+        }
+    }
+
+    return mask;
+}
+
+/* Read the 32 registers of devAddr, in one RMU frame if RMU is the interface */
+static MSD_STATUS msdSnapshotRegBlockRead
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8 devAddr,
+    OUT MSD_SNAPSHOT_REG_BLOCK *block
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_RegList dataList;
+    MSD_U8 reg;
+
+    msdMemSet((void*)block, 0, sizeof(MSD_SNAPSHOT_REG_BLOCK));
+    block->devAddr = devAddr;
+
+    if (IS_RMU_SUPPORTED(dev) && MSD_DEV_HAS(dev, RMUObj, grmuRegDump))
+    {
+        msdMemSet((void*)&dataList, 0, sizeof(MSD_RegList));
+        retVal = MSD_DEV_FN(dev, RMUObj, grmuRegDump)(dev, devAddr, &dataList);
+        for (reg = 0; (retVal == MSD_OK) && (reg < MSD_SNAPSHOT_REG_NUM); reg++)
+        {
+            block->data[reg] = dataList.data[reg];
+        }
+    }
+    else
+    {
+        for (reg = 0; (retVal == MSD_OK) && (reg < MSD_SNAPSHOT_REG_NUM); reg++)
+        {
+            retVal = msdGetAnyReg(dev->devNum, devAddr, reg, &block->data[reg]);
+        }
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotRegRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_REG_BLOCK want;
+    MSD_SNAPSHOT_REG_BLOCK cur;
+    MSD_RegCmd regCmdList[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmdList[0]);
+    MSD_U32 nCmd = 0;
+    MSD_U32 written = 0;
+    MSD_U32 mask;
+    MSD_U32 i;
+    MSD_U8 reg;
+    MSD_BOOL useRmu;
+
+    useRmu = (IS_RMU_SUPPORTED(dev) && MSD_DEV_HAS(dev, RMUObj, grmuRegDump) &&
+        MSD_DEV_HAS(dev, RMUObj, grmuMultiRegAccess)) ? MSD_TRUE : MSD_FALSE;
+
+    for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_SNAPSHOT_REG_BLOCK))), sizeof(MSD_SNAPSHOT_REG_BLOCK));
+        mask = msdSnapshotRegRestoreMask(dev, want.devAddr);
+        if (mask == 0U)
+        {
+            continue;
+        }
+
+        if (useRmu == MSD_TRUE)
+        {
+            retVal = msdSnapshotRegBlockRead(dev, want.devAddr, &cur);
+        }
+
+        for (reg = 0; (retVal == MSD_OK) && (reg < MSD_SNAPSHOT_REG_NUM); reg++)
+        {
+            if ((mask & ((MSD_U32)1 << reg)) == 0U)
+            {
+                continue;
+            }
+            if (useRmu == MSD_FALSE)
+            {
+                retVal = msdGetAnyReg(dev->devNum, want.devAddr, reg, &cur.data[reg]);
+                if (retVal != MSD_OK)
+                {
+                    break;
+                }
+            }
+            if (cur.data[reg] == want.data[reg])
+            {
+                continue;
+            }
+
+            if (useRmu == MSD_TRUE)
+            {
+                if (nCmd == MSD_RMU_MAX_REGCMDS)
+                {
+                    retVal = MSD_DEV_FN(dev, RMUObj, grmuMultiRegAccess)(dev, &pRegCmd, nCmd);
+                    nCmd = 0;
+                }
+                regCmdList[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+                regCmdList[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+                regCmdList[nCmd].devAddr = want.devAddr;
+                regCmdList[nCmd].regAddr = reg;
+                regCmdList[nCmd].data = want.data[reg];
+                nCmd++;
+            }
+            else
+            {
+                retVal = msdSetAnyReg(dev->devNum, want.devAddr, reg, want.data[reg]);
+            }
+            written++;
+        }
+    }
+
+    if ((retVal == MSD_OK) && (nCmd != 0U))
+    {
+        retVal = MSD_DEV_FN(dev, RMUObj, grmuMultiRegAccess)(dev, &pRegCmd, nCmd);
+    }
+
+    /* port control 1, the port based VLAN map and the priority mapping tables are
+       cached by the LAG, isolation and QoS map APIs */
+    if (written != 0U)
+    {
+        dev->lagShadow.valid = MSD_FALSE;
+        dev->vlanMatrixShadow.valid = MSD_FALSE;
+        if (dev->qosMapShadow != NULL)
+        {
+            msdMemSet((void*)dev->qosMapShadow->valid, 0, sizeof(dev->qosMapShadow->valid));
+        }
+    }
+    stats->regsWritten += written;
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotTableCapture
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_SNAPSHOT_TABLE_OPS *ops,
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_TABLE_ENTRY entry;
+    MSD_BOOL first = MSD_TRUE;
+
+    msdMemSet((void*)&entry, 0, sizeof(entry));
+    while (retVal == MSD_OK)
+    {
+        retVal = ops->next(dev, first, &entry);
+        first = MSD_FALSE;
+        if (retVal == MSD_OK)
+        {
+            msdSnapshotPut(writer, section, (const void*)&entry);
+        }
+    }
+
+    return (retVal == MSD_NO_SUCH) ? MSD_OK : retVal;
+}
+
+/*
+ * Walk the device table next to the snapshot records, both in ascending key
+ * order: records before the device entry are added, a matching key is
+ * rewritten only if the entry differs, device entries without a record are
+ * removed.
+ */
+static MSD_STATUS msdSnapshotTableRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_SNAPSHOT_TABLE_OPS *ops,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_TABLE_ENTRY cur;
+    MSD_SNAPSHOT_TABLE_ENTRY want;
+    MSD_BOOL first = MSD_TRUE;
+    MSD_U32 i = 0;
+    MSD_U32 curKey;
+
+    msdMemSet((void*)&cur, 0, sizeof(cur));
+    msdMemSet((void*)&want, 0, sizeof(want));
+    while (retVal == MSD_OK)
+    {
+        retVal = ops->next(dev, first, &cur);
+        first = MSD_FALSE;
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        curKey = ops->key(&cur);
+
+        for (; (retVal == MSD_OK) && (i < count); i++)
+        {
+            msdMemCpy((void*)&want, (const void*)(records + (i * ops->recordSize)), ops->recordSize);
+            if (ops->key(&want) >= curKey)
+            {
+                break;
+            }
+            retVal = ops->write(dev, &want);
+            stats->entriesWritten++;
+        }
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+
+        if ((i < count) && (ops->key(&want) == curKey))
+        {
+            stats->entriesChecked++;
+            if (msdMemCmp((char*)&want, (char*)&cur, ops->recordSize) != 0)
+            {
+                retVal = ops->write(dev, &want);
+                stats->entriesWritten++;
+            }
+            i++;
+        }
+        else
+        {
+            retVal = ops->remove(dev, &cur);
+            stats->entriesDeleted++;
+        }
+    }
+    if (retVal == MSD_NO_SUCH)
+    {
+        retVal = MSD_OK;
+    }
+
+    for (; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * ops->recordSize)), ops->recordSize);
+        retVal = ops->write(dev, &want);
+        stats->entriesWritten++;
+    }
+
+    return retVal;
+}
+
+/* Static entries: multicast entries of any state, unicast states 0x8 to 0xF */
+static MSD_BOOL msdSnapshotAtuIsStatic(const MSD_ATU_ENTRY *entry)
+{
+    MSD_BOOL isStatic;
+
+    if ((entry->macAddr.arEther[0] & 0x1U) != 0U)
+    {
+        isStatic = (entry->entryState != 0U) ? MSD_TRUE : MSD_FALSE;
+    }
+    else
+    {
+        isStatic = (entry->entryState >= 0x8U) ? MSD_TRUE : MSD_FALSE;
+    }
+
+    return isStatic;
+}
+
+static MSD_BOOL msdSnapshotIsBroadcast(const MSD_ETHERADDR *macAddr)
+{
+    MSD_U32 i;
+
+    for (i = 0; i < MSD_ETHERNET_HEADER_SIZE; i++)
+    {
+        if (macAddr->arEther[i] != 0xFFU)
+        {
+            return MSD_FALSE;
+        }
+    }
+
+    return MSD_TRUE;
+}
+
+/* Order of ATU entries, by FID and then by MAC address */
+static MSD_32 msdSnapshotAtuKeyCmp(const MSD_ATU_ENTRY *a, const MSD_ATU_ENTRY *b)
+{
+    MSD_U32 i;
+
+    if (a->fid != b->fid)
+    {
+        return (a->fid < b->fid) ? -1 : 1;
+    }
+    for (i = 0; i < MSD_ETHERNET_HEADER_SIZE; i++)
+    {
+        if (a->macAddr.arEther[i] != b->macAddr.arEther[i])
+        {
+            return (a->macAddr.arEther[i] < b->macAddr.arEther[i]) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+static MSD_BOOL msdSnapshotAtuSame(const MSD_ATU_ENTRY *a, const MSD_ATU_ENTRY *b)
+{
+    return ((a->trunkMemberOrLAG == b->trunkMemberOrLAG) && (a->portVec == b->portVec) &&
+        (a->entryState == b->entryState) && (a->exPrio.macFPri == b->exPrio.macFPri) &&
+        (a->exPrio.macQPri == b->exPrio.macQPri)) ? MSD_TRUE : MSD_FALSE;
+}
+
+/*
+ * ATU walk of one FID in ascending MAC order. The broadcast address ends a
+ * get next walk and is looked up on its own as the last entry.
+ */
+static MSD_STATUS msdSnapshotAtuNext
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_BOOL first,
+    IN  MSD_U16 fid,
+    INOUT MSD_ATU_ENTRY *entry
+)
+{
+    MSD_STATUS retVal;
+    MSD_ETHERADDR prev;
+    MSD_ETHERADDR broadcast;
+    MSD_BOOL found = MSD_FALSE;
+    MSD_ATU_ENTRY start;
+
+    msdMemSet((void*)broadcast.arEther, 0xFF, MSD_ETHERNET_HEADER_SIZE);
+    if (first == MSD_TRUE)
+    {
+        msdMemCpy((void*)&prev, (const void*)&broadcast, sizeof(MSD_ETHERADDR));
+    }
+    else if (msdSnapshotIsBroadcast(&entry->macAddr) == MSD_TRUE)
+    {
+        return MSD_NO_SUCH;
+    }
+    else
+    {
+        msdMemCpy((void*)&prev, (const void*)&entry->macAddr, sizeof(MSD_ETHERADDR));
+    }
+
+    msdMemSet((void*)entry, 0, sizeof(MSD_ATU_ENTRY));
+    msdMemCpy((void*)&entry->macAddr, (const void*)&prev, sizeof(MSD_ETHERADDR));
+    entry->fid = fid;
+    retVal = MSD_DEV_FN(dev, ATUObj, gfdbGetAtuEntryNext)(dev, entry);
+    if ((retVal == MSD_OK) && (msdSnapshotIsBroadcast(&entry->macAddr) == MSD_FALSE))
+    {
+        msdMemSet((void*)&start, 0, sizeof(MSD_ATU_ENTRY));
+        msdMemCpy((void*)&start.macAddr, (const void*)&prev, sizeof(MSD_ETHERADDR));
+        start.fid = fid;
+        entry->fid = fid;
+        if ((first == MSD_TRUE) || (msdSnapshotAtuKeyCmp(entry, &start) > 0))
+        {
+            return MSD_OK;
+        }
+    }
+    else if ((retVal != MSD_OK) && (retVal != MSD_NO_SUCH))
+    {
+        return retVal;
+    }
+
+    msdMemSet((void*)entry, 0, sizeof(MSD_ATU_ENTRY));
+    retVal = MSD_DEV_FN(dev, ATUObj, gfdbFindAtuMacEntry)(dev, &broadcast, fid, entry, &found);
+    msdMemCpy((void*)&entry->macAddr, (const void*)&broadcast, sizeof(MSD_ETHERADDR));
+    entry->fid = fid;
+    if ((retVal == MSD_OK) && (found == MSD_FALSE))
+    {
+        retVal = MSD_NO_SUCH;
+    }
+
+    return retVal;
+}
+
+/* FIDs to walk: 0, the FIDs of the VTU entries and, with RMU, those of an ATU dump */
+static MSD_STATUS msdSnapshotAtuFidVecGet
+(
+    IN  MSD_QD_DEV *dev,
+    OUT MSD_U32 *fidVec
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_TABLE_ENTRY entry;
+    MSD_ATU_ENTRY atuEntry[MSD_RMU_MAX_ATUS];
+    MSD_ATU_ENTRY *pAtuEntry = &(atuEntry[0]);
+    MSD_U32 startAddr = 0;
+    MSD_U32 numOfEntry = 0;
+    MSD_U32 fid;
+    MSD_U32 i;
+    MSD_BOOL first = MSD_TRUE;
+
+    msdMemSet((void*)fidVec, 0, MSD_SNAPSHOT_MAX_FID / 8U);
+    fidVec[0] = 1U;
+
+    if (msdSnapshotSectionSupported(dev, MSD_SNAPSHOT_SECTION_VTU) == MSD_TRUE)
+    {
+        msdMemSet((void*)&entry, 0, sizeof(entry));
+        while (retVal == MSD_OK)
+        {
+            retVal = msdSnapshotVtuNext(dev, first, &entry);
+            first = MSD_FALSE;
+            if (retVal == MSD_OK)
+            {
+                fid = (MSD_U32)entry.vtu.fid & (MSD_SNAPSHOT_MAX_FID - 1U);
+                fidVec[fid / 32U] |= (MSD_U32)1 << (fid % 32U);
+            }
+        }
+        if (retVal != MSD_NO_SUCH)
+        {
+            return retVal;
+        }
+        retVal = MSD_OK;
+    }
+
+    if (IS_RMU_SUPPORTED(dev) && MSD_DEV_HAS(dev, RMUObj, grmuAtuDump))
+    {
+        do
+        {
+            numOfEntry = MSD_RMU_MAX_ATUS;
+            msdMemSet((void*)atuEntry, 0, sizeof(atuEntry));
+            retVal = MSD_DEV_FN(dev, RMUObj, grmuAtuDump)(dev, &startAddr, &numOfEntry, &pAtuEntry);
+            for (i = 0; (retVal == MSD_OK) && (i < numOfEntry) && (i < MSD_RMU_MAX_ATUS); i++)
+            {
+                fid = (MSD_U32)atuEntry[i].fid & (MSD_SNAPSHOT_MAX_FID - 1U);
+                fidVec[fid / 32U] |= (MSD_U32)1 << (fid % 32U);
+            }
+        } while ((retVal == MSD_OK) && (numOfEntry == MSD_RMU_MAX_ATUS) && (startAddr != 0U));
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotAtuCapture
+(
+    IN  MSD_QD_DEV *dev,
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section
+)
+{
+    MSD_STATUS retVal;
+    MSD_U32 fidVec[MSD_SNAPSHOT_MAX_FID / 32U];
+    MSD_ATU_ENTRY entry;
+    MSD_BOOL first;
+    MSD_U32 fid;
+
+    retVal = msdSnapshotAtuFidVecGet(dev, fidVec);
+
+    for (fid = 0; (retVal == MSD_OK) && (fid < MSD_SNAPSHOT_MAX_FID); fid++)
+    {
+        if ((fidVec[fid / 32U] & ((MSD_U32)1 << (fid % 32U))) == 0U)
+        {
+            continue;
+        }
+
+        first = MSD_TRUE;
+        msdMemSet((void*)&entry, 0, sizeof(entry));
+        while (retVal == MSD_OK)
+        {
+            retVal = msdSnapshotAtuNext(dev, first, (MSD_U16)fid, &entry);
+            first = MSD_FALSE;
+            if ((retVal == MSD_OK) && (msdSnapshotAtuIsStatic(&entry) == MSD_TRUE))
+            {
+                msdSnapshotPut(writer, section, (const void*)&entry);
+            }
+        }
+        if (retVal == MSD_NO_SUCH)
+        {
+            retVal = MSD_OK;
+        }
+    }
+
+    return retVal;
+}
+
+/* Same merge as msdSnapshotTableRestore, per FID; dynamic entries are kept */
+static MSD_STATUS msdSnapshotAtuRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal;
+    MSD_U32 fidVec[MSD_SNAPSHOT_MAX_FID / 32U];
+    MSD_ATU_ENTRY cur;
+    MSD_ATU_ENTRY want;
+    MSD_BOOL first;
+    MSD_U32 fid;
+    MSD_U32 i;
+    MSD_32 cmp = 1;
+
+    retVal = msdSnapshotAtuFidVecGet(dev, fidVec);
+    for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_ATU_ENTRY))), sizeof(MSD_ATU_ENTRY));
+        fid = (MSD_U32)want.fid & (MSD_SNAPSHOT_MAX_FID - 1U);
+        fidVec[fid / 32U] |= (MSD_U32)1 << (fid % 32U);
+    }
+
+    i = 0;
+    for (fid = 0; (retVal == MSD_OK) && (fid < MSD_SNAPSHOT_MAX_FID); fid++)
+    {
+        if ((fidVec[fid / 32U] & ((MSD_U32)1 << (fid % 32U))) == 0U)
+        {
+            continue;
+        }
+
+        first = MSD_TRUE;
+        msdMemSet((void*)&cur, 0, sizeof(cur));
+        while (retVal == MSD_OK)
+        {
+            retVal = msdSnapshotAtuNext(dev, first, (MSD_U16)fid, &cur);
+            first = MSD_FALSE;
+            if (retVal != MSD_OK)
+            {
+                break;
+            }
+
+            for (; (retVal == MSD_OK) && (i < count); i++)
+            {
+                msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_ATU_ENTRY))), sizeof(MSD_ATU_ENTRY));
+                cmp = msdSnapshotAtuKeyCmp(&want, &cur);
+                if (cmp >= 0)
+                {
+                    break;
+                }
+                retVal = MSD_DEV_FN(dev, ATUObj, gfdbAddMacEntry)(dev, &want);
+                stats->entriesWritten++;
+            }
+            if (retVal != MSD_OK)
+            {
+                break;
+            }
+
+            if ((i < count) && (cmp == 0))
+            {
+                stats->entriesChecked++;
+                if ((msdSnapshotAtuIsStatic(&cur) == MSD_FALSE) || (msdSnapshotAtuSame(&want, &cur) == MSD_FALSE))
+                {
+                    retVal = MSD_DEV_FN(dev, ATUObj, gfdbAddMacEntry)(dev, &want);
+                    stats->entriesWritten++;
+                }
+                i++;
+            }
+            else if (msdSnapshotAtuIsStatic(&cur) == MSD_TRUE)
+            {
+                retVal = MSD_DEV_FN(dev, ATUObj, gfdbDelAtuEntry)(dev, &cur.macAddr, (MSD_U32)cur.fid);
+                stats->entriesDeleted++;
+            }
+            else
+            {
+                /* learned entry, left to aging */
+            }
+        }
+        if (retVal == MSD_NO_SUCH)
+        {
+            retVal = MSD_OK;
+        }
+    }
+
+    for (; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_ATU_ENTRY))), sizeof(MSD_ATU_ENTRY));
+        retVal = MSD_DEV_FN(dev, ATUObj, gfdbAddMacEntry)(dev, &want);
+        stats->entriesWritten++;
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotPirlCapture
+(
+    IN  MSD_QD_DEV *dev,
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_PIRL_RES res;
+    MSD_LPORT port;
+    MSD_U32 irlRes;
+
+    for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts); port++)
+    {
+        for (irlRes = 0; irlRes < MSD_SNAPSHOT_IRL_RES_NUM; irlRes++)
+        {
+            msdMemSet((void*)&res, 0, sizeof(res));
+            res.irlPort = port;
+            res.irlRes = irlRes;
+            retVal = MSD_DEV_FN(dev, PIRLObj, gpirlReadResource)(dev, port, irlRes, &res.data);
+            if (retVal == MSD_BAD_PARAM)
+            {
+                /* no more resources on this port */
+                retVal = MSD_OK;
+                break;
+            }
+            if (retVal != MSD_OK)
+            {
+                break;
+            }
+            msdSnapshotPut(writer, section, (const void*)&res);
+        }
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotPirlRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_PIRL_RES want;
+    MSD_PIRL_DATA cur;
+    MSD_U32 i;
+
+    for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_SNAPSHOT_PIRL_RES))), sizeof(MSD_SNAPSHOT_PIRL_RES));
+        msdMemSet((void*)&cur, 0, sizeof(cur));
+        retVal = MSD_DEV_FN(dev, PIRLObj, gpirlReadResource)(dev, want.irlPort, want.irlRes, &cur);
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        stats->entriesChecked++;
+        if (msdMemCmp((char*)&want.data, (char*)&cur, sizeof(MSD_PIRL_DATA)) != 0)
+        {
+            retVal = MSD_DEV_FN(dev, PIRLObj, gpirlWriteResource)(dev, want.irlPort, want.irlRes, &want.data);
+            stats->entriesWritten++;
+        }
+    }
+
+    return retVal;
+}
+
+/* A field the port does not have is left out of validVec */
+static MSD_STATUS msdSnapshotQosField(MSD_STATUS status, MSD_U32 field, MSD_U32 *validVec)
+{
+    if (status == MSD_OK)
+    {
+        *validVec |= field;
+    }
+
+    return ((status == MSD_BAD_PARAM) || (status == MSD_NOT_SUPPORTED)) ? MSD_OK : status;
+}
+
+static MSD_STATUS msdSnapshotQosRead
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT port,
+    OUT MSD_SNAPSHOT_QOS_PORT *qos
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_STATUS status;
+    MSD_U32 table;
+    MSD_U8 cos;
+
+    msdMemSet((void*)qos, 0, sizeof(MSD_SNAPSHOT_QOS_PORT));
+    qos->port = port;
+
+    if (MSD_DEV_HAS(dev, QOSMAPObj, gqosGetPrioMapRule))
+    {
+        status = MSD_DEV_FN(dev, QOSMAPObj, gqosGetPrioMapRule)(dev, port, &qos->prioMapRule);
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_PRIO_RULE, &qos->validVec);
+    }
+    if ((retVal == MSD_OK) && MSD_DEV_HAS(dev, QOSMAPObj, gprtGetInitialPri))
+    {
+        status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetInitialPri)(dev, port, &qos->initialPri);
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_INITIAL_PRI, &qos->validVec);
+    }
+    if ((retVal == MSD_OK) && MSD_DEV_HAS(dev, QOSMAPObj, gprtGetDefQpri))
+    {
+        status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetDefQpri)(dev, port, &qos->defQPri);
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_DEF_QPRI, &qos->validVec);
+    }
+    if ((retVal == MSD_OK) && MSD_DEV_HAS(dev, QOSMAPObj, gprtGetDefFpri))
+    {
+        status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetDefFpri)(dev, port, &qos->defFPri);
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_DEF_FPRI, &qos->validVec);
+    }
+    if ((retVal == MSD_OK) && MSD_DEV_HAS(dev, QOSMAPObj, gprtGetCosToQueue))
+    {
+        status = MSD_OK;
+        for (cos = 0; (status == MSD_OK) && (cos < MSD_SNAPSHOT_COS_NUM); cos++)
+        {
+            status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetCosToQueue)(dev, port, cos, &qos->cosToQueue[cos]);
+        }
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_COS_TO_QUEUE, &qos->validVec);
+    }
+    if ((retVal == MSD_OK) && MSD_DEV_HAS(dev, QOSMAPObj, gprtGetCosToDscp))
+    {
+        status = MSD_OK;
+        for (cos = 0; (status == MSD_OK) && (cos < MSD_SNAPSHOT_COS_NUM); cos++)
+        {
+            status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetCosToDscp)(dev, port, cos, &qos->cosToDscp[cos]);
+        }
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_COS_TO_DSCP, &qos->validVec);
+    }
+    for (table = 0; (retVal == MSD_OK) && (table < MSD_IEEE_PRIORITY_TABLE_NUM); table++)
+    {
+        status = MSD_DEV_FN(dev, QOSMAPObj, gprtGetIEEEPrioMapTable)(dev, port,
+            (MSD_IEEE_PRIORITY_TABLE_SET)table, qos->prioMap[table]);
+        retVal = msdSnapshotQosField(status, MSD_SNAPSHOT_QOS_PRIO_MAP(table), &qos->validVec);
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotQosCapture
+(
+    IN  MSD_QD_DEV *dev,
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_QOS_PORT qos;
+    MSD_LPORT port;
+
+    for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts); port++)
+    {
+        retVal = msdSnapshotQosRead(dev, port, &qos);
+        if (retVal == MSD_OK)
+        {
+            msdSnapshotPut(writer, section, (const void*)&qos);
+        }
+    }
+
+    return retVal;
+}
+
+/* Count the differing entries of two arrays */
+static MSD_U32 msdSnapshotDiffCount(const MSD_U8 *a, const MSD_U8 *b, MSD_U32 num, MSD_U32 size)
+{
+    MSD_U32 diff = 0;
+    MSD_U32 i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (msdMemCmp((char*)(a + (i * size)), (char*)(b + (i * size)), size) != 0)
+        {
+            diff++;
+        }
+    }
+
+    return diff;
+}
+
+static MSD_STATUS msdSnapshotQosRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_QOS_PORT want;
+    MSD_SNAPSHOT_QOS_PORT cur;
+    MSD_U32 i;
+    MSD_U32 table;
+    MSD_U32 diff;
+    MSD_U8 cos;
+
+    for (i = 0; (retVal == MSD_OK) && (i < count); i++)
+    {
+        msdMemCpy((void*)&want, (const void*)(records + (i * sizeof(MSD_SNAPSHOT_QOS_PORT))), sizeof(MSD_SNAPSHOT_QOS_PORT));
+        retVal = msdSnapshotQosRead(dev, want.port, &cur);
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        if ((want.validVec & ~cur.validVec) != 0U)
+        {
+            MSD_DBG_ERROR(("Port %u lacks QoS fields 0x%x of the snapshot.\n", (unsigned int)want.port, (unsigned int)(want.validVec & ~cur.validVec)));
+            retVal = MSD_NOT_SUPPORTED;
+            break;
+        }
+
+        if ((want.validVec & MSD_SNAPSHOT_QOS_PRIO_RULE) != 0U)
+        {
+            stats->entriesChecked++;
+            if (want.prioMapRule != cur.prioMapRule)
+            {
+                retVal = MSD_DEV_FN(dev, QOSMAPObj, gqosSetPrioMapRule)(dev, want.port, want.prioMapRule);
+                stats->entriesWritten++;
+            }
+        }
+        if ((retVal == MSD_OK) && ((want.validVec & MSD_SNAPSHOT_QOS_INITIAL_PRI) != 0U))
+        {
+            stats->entriesChecked++;
+            if (want.initialPri != cur.initialPri)
+            {
+                retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetInitialPri)(dev, want.port, want.initialPri);
+                stats->entriesWritten++;
+            }
+        }
+        if ((retVal == MSD_OK) && ((want.validVec & MSD_SNAPSHOT_QOS_DEF_QPRI) != 0U))
+        {
+            stats->entriesChecked++;
+            if (want.defQPri != cur.defQPri)
+            {
+                retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetDefQpri)(dev, want.port, want.defQPri);
+                stats->entriesWritten++;
+            }
+        }
+        if ((retVal == MSD_OK) && ((want.validVec & MSD_SNAPSHOT_QOS_DEF_FPRI) != 0U))
+        {
+            stats->entriesChecked++;
+            if (want.defFPri != cur.defFPri)
+            {
+                retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetDefFpri)(dev, want.port, want.defFPri);
+                stats->entriesWritten++;
+            }
+        }
+        if ((retVal == MSD_OK) && ((want.validVec & MSD_SNAPSHOT_QOS_COS_TO_QUEUE) != 0U))
+        {
+            stats->entriesChecked += MSD_SNAPSHOT_COS_NUM;
+            for (cos = 0; (retVal == MSD_OK) && (cos < MSD_SNAPSHOT_COS_NUM); cos++)
+            {
+                if (want.cosToQueue[cos] != cur.cosToQueue[cos])
+                {
+                    retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToQueue)(dev, want.port, cos, want.cosToQueue[cos]);
+                    stats->entriesWritten++;
+                }
+            }
+        }
+        if ((retVal == MSD_OK) && ((want.validVec & MSD_SNAPSHOT_QOS_COS_TO_DSCP) != 0U))
+        {
+            stats->entriesChecked += MSD_SNAPSHOT_COS_NUM;
+            for (cos = 0; (retVal == MSD_OK) && (cos < MSD_SNAPSHOT_COS_NUM); cos++)
+            {
+                if (want.cosToDscp[cos] != cur.cosToDscp[cos])
+                {
+                    retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetCosToDscp)(dev, want.port, cos, want.cosToDscp[cos]);
+                    stats->entriesWritten++;
+                }
+            }
+        }
+
+        /* the table set skips the entries the read above found matching */
+        for (table = 0; (retVal == MSD_OK) && (table < MSD_IEEE_PRIORITY_TABLE_NUM); table++)
+        {
+            if ((want.validVec & MSD_SNAPSHOT_QOS_PRIO_MAP(table)) == 0U)
+            {
+                continue;
+            }
+            stats->entriesChecked += MSD_IEEE_PRIORITY_TABLE_SIZE;
+            diff = msdSnapshotDiffCount((const MSD_U8*)want.prioMap[table], (const MSD_U8*)cur.prioMap[table],
+                MSD_IEEE_PRIORITY_TABLE_SIZE, sizeof(MSD_IEEE_PRIORITY_TABLE_STRUCT));
+            if (diff != 0U)
+            {
+                retVal = MSD_DEV_FN(dev, QOSMAPObj, gprtSetIEEEPrioMapTable)(dev, want.port,
+                    (MSD_IEEE_PRIORITY_TABLE_SET)table, want.prioMap[table]);
+                stats->entriesWritten += diff;
+            }
+        }
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotSectionCapture
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 sectionId,
+    INOUT MSD_SNAPSHOT_WRITER *writer,
+    INOUT MSD_SNAPSHOT_SECTION *section
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_SNAPSHOT_REG_BLOCK block;
+    MSD_U8 devAddr[MSD_SNAPSHOT_MAX_REG_BLOCKS];
+    MSD_U32 num;
+    MSD_U32 i;
+
+    switch (sectionId)
+    {
+    case MSD_SNAPSHOT_SECTION_REGS:
+        num = msdSnapshotRegAddrGet(dev, devAddr);
+        for (i = 0; (retVal == MSD_OK) && (i < num); i++)
+        {
+            retVal = msdSnapshotRegBlockRead(dev, devAddr[i], &block);
+            if (retVal == MSD_OK)
+            {
+                msdSnapshotPut(writer, section, (const void*)&block);
+            }
+        }
+        break;
+    case MSD_SNAPSHOT_SECTION_STU:
+        retVal = msdSnapshotTableCapture(dev, &msdSnapshotStuOps, writer, section);
+        break;
+    case MSD_SNAPSHOT_SECTION_VTU:
+        retVal = msdSnapshotTableCapture(dev, &msdSnapshotVtuOps, writer, section);
+        break;
+    case MSD_SNAPSHOT_SECTION_ATU:
+        retVal = msdSnapshotAtuCapture(dev, writer, section);
+        break;
+    case MSD_SNAPSHOT_SECTION_TCAM:
+        retVal = msdSnapshotTableCapture(dev, &msdSnapshotTcamOps, writer, section);
+        break;
+    case MSD_SNAPSHOT_SECTION_PIRL:
+        retVal = msdSnapshotPirlCapture(dev, writer, section);
+        break;
+    default:
+        retVal = msdSnapshotQosCapture(dev, writer, section);
+        break;
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotSectionRestore
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 sectionId,
+    IN  const MSD_U8 *records,
+    IN  MSD_U32 count,
+    INOUT MSD_SNAPSHOT_RESTORE_STATS *stats
+)
+{
+    MSD_STATUS retVal;
+
+    switch (sectionId)
+    {
+    case MSD_SNAPSHOT_SECTION_REGS:
+        retVal = msdSnapshotRegRestore(dev, records, count, stats);
+        break;
+    case MSD_SNAPSHOT_SECTION_STU:
+        retVal = msdSnapshotTableRestore(dev, &msdSnapshotStuOps, records, count, stats);
+        break;
+    case MSD_SNAPSHOT_SECTION_VTU:
+        retVal = msdSnapshotTableRestore(dev, &msdSnapshotVtuOps, records, count, stats);
+        break;
+    case MSD_SNAPSHOT_SECTION_ATU:
+        retVal = msdSnapshotAtuRestore(dev, records, count, stats);
+        break;
+    case MSD_SNAPSHOT_SECTION_TCAM:
+        retVal = msdSnapshotTableRestore(dev, &msdSnapshotTcamOps, records, count, stats);
+        break;
+    case MSD_SNAPSHOT_SECTION_PIRL:
+        retVal = msdSnapshotPirlRestore(dev, records, count, stats);
+        break;
+    default:
+        retVal = msdSnapshotQosRestore(dev, records, count, stats);
+        break;
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS msdSnapshotHeaderCheck
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const MSD_SNAPSHOT_HEADER *hdr,
+    IN  const MSD_U8 *buf,
+    IN  MSD_U32 snapshotSize
+)
+{
+    MSD_U32 id;
+
+    if ((hdr->magic != MSD_SNAPSHOT_MAGIC) || (hdr->version != MSD_SNAPSHOT_VERSION) ||
+        (hdr->headerSize != sizeof(MSD_SNAPSHOT_HEADER)))
+    {
+        MSD_DBG_ERROR(("Not a snapshot of version %u.\n", (unsigned int)MSD_SNAPSHOT_VERSION));
+        return MSD_BAD_PARAM;
+    }
+    if ((hdr->totalSize > snapshotSize) || (hdr->totalSize < hdr->headerSize) ||
+        ((hdr->sectionVec & ~MSD_SNAPSHOT_ALL_SECTIONS) != 0U))
+    {
+        MSD_DBG_ERROR(("Bad snapshot size %u or sections 0x%x.\n", (unsigned int)hdr->totalSize, (unsigned int)hdr->sectionVec));
+        return MSD_BAD_PARAM;
+    }
+    for (id = 0; id < MSD_SNAPSHOT_SECTION_NUM; id++)
+    {
+        if ((hdr->sectionVec & (1U << id)) == 0U)
+        {
+            continue;
+        }
+        if ((hdr->section[id].recordSize != msdSnapshotRecordSize(id)) ||
+            (hdr->section[id].offset < hdr->headerSize) || (hdr->section[id].offset > hdr->totalSize) ||
+            (hdr->section[id].count > ((hdr->totalSize - hdr->section[id].offset) / hdr->section[id].recordSize)))
+        {
+            MSD_DBG_ERROR(("Bad snapshot section %u.\n", (unsigned int)id));
+            return MSD_BAD_PARAM;
+        }
+    }
+    if (msdSnapshotChecksum(buf + hdr->headerSize, hdr->totalSize - hdr->headerSize) != hdr->checksum)
+    {
+        MSD_DBG_ERROR(("Snapshot checksum mismatch.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if ((hdr->deviceId != (MSD_U32)dev->deviceId) || (hdr->numOfPorts != (MSD_U32)dev->numOfPorts))
+    {
+        MSD_DBG_ERROR(("Snapshot of device 0x%x with %u ports.\n", (unsigned int)hdr->deviceId, (unsigned int)hdr->numOfPorts));
+        return MSD_BAD_PARAM;
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdSnapshotRegCapture
+*
+* DESCRIPTION:
+*       This function reads all 32 registers of global 1, global 2 and every
+*       port, one block per SMI device address in this order. Each block is
+*       read with one RMU register dump frame when RMU is the interface.
+*
+* INPUTS:
+*       devNum    - physical device number
+*       maxBlocks - number of entries in blocks, at least numOfPorts + 2
+*
+* OUTPUTS:
+*       blocks    - register blocks
+*       numBlocks - number of blocks read
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Registers are read as they are, including command and status
+*       registers of indirect tables.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRegCapture
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  maxBlocks,
+    OUT MSD_SNAPSHOT_REG_BLOCK  *blocks,
+    OUT MSD_U32  *numBlocks
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_U8 devAddr[MSD_SNAPSHOT_MAX_REG_BLOCKS];
+    MSD_U32 num;
+    MSD_U32 i;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == blocks) || (NULL == numBlocks))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    num = msdSnapshotRegAddrGet(dev, devAddr);
+    if (maxBlocks < num)
+    {
+        MSD_DBG_ERROR(("maxBlocks %u less than %u.\n", (unsigned int)maxBlocks, (unsigned int)num));
+        return MSD_BAD_PARAM;
+    }
+
+    *numBlocks = 0;
+    for (i = 0; (retVal == MSD_OK) && (i < num); i++)
+    {
+        retVal = msdSnapshotRegBlockRead(dev, devAddr[i], &blocks[i]);
+    }
+    if (retVal == MSD_OK)
+    {
+        *numBlocks = num;
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdSnapshotRegDiff
+*
+* DESCRIPTION:
+*       This function compares two register captures of msdSnapshotRegCapture
+*       and returns the registers whose value changed, in capture order.
+*       Blocks that did not change at all are skipped with a single compare.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       prevBlocks - previous capture
+*       curBlocks  - current capture
+*       numBlocks  - number of blocks in both captures
+*       configOnly - MSD_TRUE to compare only the configuration registers
+*                    restored by msdSnapshotRestore, ignoring status, counter
+*                    and indirect table registers that change on their own
+*       maxChanges - number of entries in changes, may be 0
+*
+* OUTPUTS:
+*       changes    - changed registers, may be NULL if maxChanges is 0
+*       numChanges - number of changed registers, only the first maxChanges
+*                    are stored in changes
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, or the captures do not
+*                       have the same device addresses
+*
+* COMMENTS:
+*       A watchdog keeps two capture arrays, captures into one and compares
+*       it with the other, then swaps them.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRegDiff
+(
+    IN  MSD_U8  devNum,
+    IN  const MSD_SNAPSHOT_REG_BLOCK  *prevBlocks,
+    IN  const MSD_SNAPSHOT_REG_BLOCK  *curBlocks,
+    IN  MSD_U32  numBlocks,
+    IN  MSD_BOOL  configOnly,
+    IN  MSD_U32  maxChanges,
+    OUT MSD_SNAPSHOT_REG_CHANGE  *changes,
+    OUT MSD_U32  *numChanges
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_U32 num = 0;
+    MSD_U32 mask;
+    MSD_U32 i;
+    MSD_U8 reg;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == prevBlocks) || (NULL == curBlocks) || (NULL == numChanges) ||
+        ((NULL == changes) && (maxChanges != 0U)))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    for (i = 0; i < numBlocks; i++)
+    {
+        if (prevBlocks[i].devAddr != curBlocks[i].devAddr)
+        {
+            MSD_DBG_ERROR(("Block %u is devAddr 0x%x and 0x%x.\n", (unsigned int)i,
+                (unsigned int)prevBlocks[i].devAddr, (unsigned int)curBlocks[i].devAddr));
+            return MSD_BAD_PARAM;
+        }
+        if (msdMemCmp((char*)prevBlocks[i].data, (char*)curBlocks[i].data, sizeof(prevBlocks[i].data)) == 0)
+        {
+            continue;
+        }
+
+        mask = (configOnly == MSD_TRUE) ? msdSnapshotRegRestoreMask(dev, curBlocks[i].devAddr) : 0xFFFFFFFFU;
+        for (reg = 0; reg < MSD_SNAPSHOT_REG_NUM; reg++)
+        {
+            if (((mask & ((MSD_U32)1 << reg)) == 0U) || (prevBlocks[i].data[reg] == curBlocks[i].data[reg]))
+            {
+                continue;
+            }
+            if (num < maxChanges)
+            {
+                changes[num].devAddr = curBlocks[i].devAddr;
+                changes[num].regAddr = reg;
+                changes[num].oldData = prevBlocks[i].data[reg];
+                changes[num].newData = curBlocks[i].data[reg];
+            }
+            num++;
+        }
+    }
+
+    *numChanges = num;
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdSnapshotCapture
+*
+* DESCRIPTION:
+*       This function captures the selected sections of the device
+*       configuration into buf. The snapshot starts with an
+*       MSD_SNAPSHOT_HEADER followed by the records of every section.
+*       Sections the device does not support are left out of
+*       MSD_SNAPSHOT_HEADER.sectionVec.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       sectionVec - sections to capture, bit n for MSD_SNAPSHOT_SECTION_ID n,
+*                    MSD_SNAPSHOT_ALL_SECTIONS for all
+*       bufSize    - size of buf in bytes, may be 0
+*
+* OUTPUTS:
+*       buf          - snapshot, may be NULL if bufSize is 0
+*       snapshotSize - size of the snapshot in bytes, also set when buf is
+*                      too small
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, or buf is too small
+*
+* COMMENTS:
+*       Call with bufSize 0 to get the size needed; the tables are walked
+*       in both calls, leave some room for entries added in between.
+*       Only static ATU entries are captured. The ATU is walked in FID 0,
+*       the FIDs of the VTU entries and, with RMU, the FIDs found by an RMU
+*       ATU dump. VTU entries of VTU page 1 and egress TCAM entries are not
+*       captured.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotCapture
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  sectionVec,
+    IN  MSD_U32  bufSize,
+    OUT MSD_U8  *buf,
+    OUT MSD_U32  *snapshotSize
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_SNAPSHOT_HEADER hdr;
+    MSD_SNAPSHOT_WRITER writer;
+    MSD_U32 id;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == snapshotSize) || ((NULL == buf) && (bufSize != 0U)) ||
+        ((sectionVec & ~MSD_SNAPSHOT_ALL_SECTIONS) != 0U))
+    {
+        MSD_DBG_ERROR(("Bad snapshotSize, buf or sectionVec 0x%x.\n", (unsigned int)sectionVec));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemSet((void*)&hdr, 0, sizeof(hdr));
+    hdr.magic = MSD_SNAPSHOT_MAGIC;
+    hdr.version = (MSD_U16)MSD_SNAPSHOT_VERSION;
+    hdr.headerSize = (MSD_U16)sizeof(MSD_SNAPSHOT_HEADER);
+    hdr.deviceId = (MSD_U32)dev->deviceId;
+    hdr.numOfPorts = (MSD_U32)dev->numOfPorts;
+    hdr.validPortVec = dev->validPortVec;
+
+    writer.buf = buf;
+    writer.bufSize = bufSize;
+    writer.used = sizeof(MSD_SNAPSHOT_HEADER);
+
+    for (id = 0; (retVal == MSD_OK) && (id < MSD_SNAPSHOT_SECTION_NUM); id++)
+    {
+        if (((sectionVec & (1U << id)) == 0U) || (msdSnapshotSectionSupported(dev, id) == MSD_FALSE))
+        {
+            continue;
+        }
+        msdSnapshotAlign(&writer);
+        hdr.section[id].offset = writer.used;
+        hdr.section[id].recordSize = msdSnapshotRecordSize(id);
+        retVal = msdSnapshotSectionCapture(dev, id, &writer, &hdr.section[id]);
+        hdr.sectionVec |= 1U << id;
+    }
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Snapshot section %u returned: %s.\n", (unsigned int)(id - 1U), msdDisplayStatus(retVal)));
+        return retVal;
+    }
+
+    hdr.totalSize = writer.used;
+    *snapshotSize = writer.used;
+    if (writer.used > bufSize)
+    {
+        MSD_DBG_INFO(("Snapshot needs %u bytes, buf has %u.\n", (unsigned int)writer.used, (unsigned int)bufSize));
+        return MSD_BAD_PARAM;
+    }
+
+    hdr.checksum = msdSnapshotChecksum(buf + sizeof(MSD_SNAPSHOT_HEADER), writer.used - sizeof(MSD_SNAPSHOT_HEADER));
+    msdMemCpy((void*)buf, (const void*)&hdr, sizeof(MSD_SNAPSHOT_HEADER));
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdSnapshotRestore
+*
+* DESCRIPTION:
+*       This function programs a snapshot taken by msdSnapshotCapture into the
+*       device in one pass. Every table is walked once next to the snapshot
+*       records: entries that already match are left alone, differing and
+*       missing entries are written and entries the snapshot does not have
+*       are removed. Registers are restored last, see COMMENTS.
+*
+* INPUTS:
+*       devNum       - physical device number
+*       buf          - snapshot
+*       snapshotSize - size of buf in bytes
+*
+* OUTPUTS:
+*       stats - work done, may be NULL
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given, such as a damaged
+*                       snapshot, another snapshot version or a snapshot of
+*                       another device ID or port count
+*       MSD_NOT_SUPPORTED - device does not support a captured section
+*
+* COMMENTS:
+*       Only configuration registers are restored: global 1 global control,
+*       ATU control, switch MAC and global control 2; global 2 interrupt
+*       masks and switch management; port physical control, port control 0
+*       to 3, port based VLAN map, default VID, egress rate, association
+*       vector, ATU control and override. Tables behind command and data
+*       registers are restored through their sections.
+*       Dynamic ATU entries are kept. Other configuration must not be
+*       changed while the restore runs.
+*
+*******************************************************************************/
+MSD_STATUS msdSnapshotRestore
+(
+    IN  MSD_U8  devNum,
+    IN  const MSD_U8  *buf,
+    IN  MSD_U32  snapshotSize,
+    OUT MSD_SNAPSHOT_RESTORE_STATS  *stats
+)
+{
+    /* STU before the VTU entries using it, VTU before the FIDs of the ATU, ports open last */
+    static const MSD_U32 order[MSD_SNAPSHOT_SECTION_NUM] =
+    {
+        MSD_SNAPSHOT_SECTION_STU, MSD_SNAPSHOT_SECTION_VTU, MSD_SNAPSHOT_SECTION_ATU,
+        MSD_SNAPSHOT_SECTION_TCAM, MSD_SNAPSHOT_SECTION_PIRL, MSD_SNAPSHOT_SECTION_QOS,
+        MSD_SNAPSHOT_SECTION_REGS
+    };
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_SNAPSHOT_HEADER hdr;
+    MSD_SNAPSHOT_RESTORE_STATS work;
+    MSD_U32 k;
+    MSD_U32 id;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((NULL == buf) || (snapshotSize < sizeof(MSD_SNAPSHOT_HEADER)))
+    {
+        MSD_DBG_ERROR(("Bad buf or snapshotSize %u.\n", (unsigned int)snapshotSize));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemCpy((void*)&hdr, (const void*)buf, sizeof(MSD_SNAPSHOT_HEADER));
+    retVal = msdSnapshotHeaderCheck(dev, &hdr, buf, snapshotSize);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    msdMemSet((void*)&work, 0, sizeof(work));
+    for (k = 0; (retVal == MSD_OK) && (k < MSD_SNAPSHOT_SECTION_NUM); k++)
+    {
+        id = order[k];
+        if ((hdr.sectionVec & (1U << id)) == 0U)
+        {
+            continue;
+        }
+        if (msdSnapshotSectionSupported(dev, id) == MSD_FALSE)
+        {
+            retVal = MSD_NOT_SUPPORTED;
+            break;
+        }
+        retVal = msdSnapshotSectionRestore(dev, id, buf + hdr.section[id].offset, hdr.section[id].count, &work);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Restore of snapshot section %u returned: %s.\n", (unsigned int)id, msdDisplayStatus(retVal)));
+        }
+    }
+
+    if (stats != NULL)
+    {
+        msdMemCpy((void*)stats, (const void*)&work, sizeof(MSD_SNAPSHOT_RESTORE_STATS));
+    }
+
+    return retVal;
+}
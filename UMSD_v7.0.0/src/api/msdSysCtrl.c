@@ -20,6 +20,7 @@
 #include <api/msdSysCtrl.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdSysFloodBCSet
@@ -65,9 +66,9 @@ MSD_STATUS msdSysFloodBCSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetFloodBC))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC(dev, en);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetFloodBC)(dev, en);
 		}
 		else
 		{
@@ -121,9 +122,9 @@ MSD_STATUS msdSysFloodBCGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetFloodBC))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC(dev, en);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetFloodBC)(dev, en);
 		}
 		else
 		{
@@ -181,9 +182,9 @@ MSD_STATUS msdSysMonitorMgmtCtrlSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetMonitorMgmtCtrl != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetMonitorMgmtCtrl))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetMonitorMgmtCtrl(dev, point, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetMonitorMgmtCtrl)(dev, point, data);
 		}
 		else
 		{
@@ -240,9 +241,9 @@ MSD_STATUS msdSysMonitorMgmtCtrlGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetMonitorMgmtCtrl != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetMonitorMgmtCtrl))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetMonitorMgmtCtrl(dev, point, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetMonitorMgmtCtrl)(dev, point, data);
 		}
 		else
 		{
@@ -312,9 +313,9 @@ MSD_STATUS msdSysCPUDestSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetCPUDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetCPUDest)(dev, portNum);
 		}
 		else
 		{
@@ -383,9 +384,9 @@ MSD_STATUS msdSysCPUDestGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetCPUDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetCPUDest)(dev, portNum);
 		}
 		else
 		{
@@ -441,9 +442,9 @@ MSD_STATUS msdSysIngressMonitorDestSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetIngressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetIngressMonitorDest)(dev, portNum);
 		}
 		else
 		{
@@ -490,9 +491,9 @@ MSD_STATUS msdSysIngressMonitorDestGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetIngressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetIngressMonitorDest)(dev, portNum);
 		}
 		else
 		{
@@ -548,9 +549,9 @@ MSD_STATUS msdSysEgressMonitorDestSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetEgressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetEgressMonitorDest)(dev, portNum);
 		}
 		else
 		{
@@ -597,9 +598,9 @@ MSD_STATUS msdSysEgressMonitorDestGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetEgressMonitorDest))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest(dev, portNum);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetEgressMonitorDest)(dev, portNum);
 		}
 		else
 		{
@@ -653,9 +654,9 @@ MSD_STATUS msdSysRsvd2CpuEnablesSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetRsvd2CpuEnables))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables(dev, enBits);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetRsvd2CpuEnables)(dev, enBits);
 		}
 		else
 		{
@@ -709,9 +710,9 @@ MSD_STATUS msdSysRsvd2CpuEnablesGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetRsvd2CpuEnables))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables(dev, enBits);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetRsvd2CpuEnables)(dev, enBits);
 		}
 		else
 		{
@@ -759,9 +760,9 @@ MSD_STATUS msdSysMGMTPriSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetMGMTPri))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri(dev, pri);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetMGMTPri)(dev, pri);
 		}
 		else
 		{
@@ -809,9 +810,9 @@ MSD_STATUS msdSysMGMTPriGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetMGMTPri))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri(dev, pri);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetMGMTPri)(dev, pri);
 		}
 		else
 		{
@@ -859,9 +860,9 @@ IN MSD_U16	  smiAddr
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetSMISetup))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup(dev, portNum, smiAddr);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetSMISetup)(dev, portNum, smiAddr);
 		}
 		else
 		{
@@ -908,9 +909,9 @@ OUT MSD_U16			*smiAddr
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetSMISetup))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup(dev, portNum, smiAddr);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetSMISetup)(dev, portNum, smiAddr);
 		}
 		else
 		{
@@ -957,9 +958,9 @@ MSD_STATUS msdGlobal1RegDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGlobal1RegDump))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump(dev);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGlobal1RegDump)(dev);
 		}
 		else
 		{
@@ -1006,9 +1007,9 @@ MSD_STATUS msdGlobal2RegDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGlobal2RegDump))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump(dev);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGlobal2RegDump)(dev);
 		}
 		else
 		{
@@ -1055,9 +1056,9 @@ IN MSD_U16   data
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysSetRMUMode))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode(dev, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysSetRMUMode)(dev, data);
 		}
 		else
 		{
@@ -1103,9 +1104,9 @@ OUT MSD_U16   *data
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysGetRMUMode))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode(dev, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysGetRMUMode)(dev, data);
 		}
 		else
 		{
@@ -1156,9 +1157,9 @@ MSD_STATUS msdQbvWrite
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvWrite))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite(dev, portNum, regOffset, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysQbvWrite)(dev, portNum, regOffset, data);
 		}
 		else
 		{
@@ -1207,9 +1208,9 @@ MSD_STATUS msdQbvRead
     }
 	else
 	{
-		if (dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead != NULL)
+		if (MSD_DEV_HAS(dev, SYSCTRLObj, gsysQbvRead))
 		{
-			retVal = dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead(dev, portNum, regOffset, data);
+			retVal = MSD_DEV_FN(dev, SYSCTRLObj, gsysQbvRead)(dev, portNum, regOffset, data);
 		}
 		else
 		{
@@ -1273,9 +1274,9 @@ IN MSD_U16   data
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gdevIntEnableSet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gdevIntEnableSet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gdevIntEnableSet(dev, data);
+			retVal = MSD_DEV_FN(dev, INTObj, gdevIntEnableSet)(dev, data);
 		}
 		else
 		{
@@ -1322,9 +1323,9 @@ OUT MSD_U16  *data
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gdevIntEnableGet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gdevIntEnableGet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gdevIntEnableGet(dev, data);
+			retVal = MSD_DEV_FN(dev, INTObj, gdevIntEnableGet)(dev, data);
 		}
 		else
 		{
@@ -1370,9 +1371,9 @@ OUT MSD_U16   *status
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gdevIntStatusGet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gdevIntStatusGet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gdevIntStatusGet(dev, status);
+			retVal = MSD_DEV_FN(dev, INTObj, gdevIntStatusGet)(dev, status);
 		}
 		else
 		{
@@ -1429,9 +1430,9 @@ IN MSD_U16   data
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gactiveIntEnableSet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gactiveIntEnableSet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gactiveIntEnableSet(dev, data);
+			retVal = MSD_DEV_FN(dev, INTObj, gactiveIntEnableSet)(dev, data);
 		}
 		else
 		{
@@ -1477,9 +1478,9 @@ OUT MSD_U16   *data
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gactiveIntEnableGet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gactiveIntEnableGet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gactiveIntEnableGet(dev, data);
+			retVal = MSD_DEV_FN(dev, INTObj, gactiveIntEnableGet)(dev, data);
 		}
 		else
 		{
@@ -1525,9 +1526,9 @@ OUT MSD_U16   *status
     }
 	else
 	{
-		if (dev->SwitchDevObj.INTObj.gactiveIntStatusGet != NULL)
+		if (MSD_DEV_HAS(dev, INTObj, gactiveIntStatusGet))
 		{
-			retVal = dev->SwitchDevObj.INTObj.gactiveIntStatusGet(dev, status);
+			retVal = MSD_DEV_FN(dev, INTObj, gactiveIntStatusGet)(dev, status);
 		}
 		else
 		{
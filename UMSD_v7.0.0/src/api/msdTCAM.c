@@ -20,6 +20,7 @@
 #include <api/msdTCAM.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdTcamAllDelete
@@ -61,9 +62,9 @@ MSD_STATUS msdTcamAllDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamFlushAll))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamFlushAll)(dev);
 		}
 		else
 		{
@@ -114,9 +115,9 @@ MSD_STATUS msdTcamEntryDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamFlushEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamFlushEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamFlushEntry(dev, tcamPointer);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamFlushEntry)(dev, tcamPointer);
 		}
 		else
 		{
@@ -173,9 +174,9 @@ MSD_STATUS msdTcamEntryAdd
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamLoadEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamLoadEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamLoadEntry(dev, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamLoadEntry)(dev, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -225,9 +226,9 @@ MSD_STATUS msdTcamEntryRead
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamReadTCAMData))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData(dev, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamReadTCAMData)(dev, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -281,9 +282,9 @@ MSD_STATUS msdTcamEntryGetNext
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamGetNextTCAMData))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData(dev, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamGetNextTCAMData)(dev, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -333,9 +334,9 @@ MSD_STATUS msdTcamEntryFind
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamFindEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamFindEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamFindEntry(dev, tcamPointer, tcamData, found);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamFindEntry)(dev, tcamPointer, tcamData, found);
 		}
 		else
 		{
@@ -389,9 +390,9 @@ MSD_STATUS msdPortTcamModeSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamSetMode != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamSetMode))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamSetMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamSetMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -441,9 +442,9 @@ MSD_STATUS msdPortTcamModeGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamGetMode != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamGetMode))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamGetMode(dev, portNum, mode);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamGetMode)(dev, portNum, mode);
 		}
 		else
 		{
@@ -494,9 +495,9 @@ MSD_STATUS msdTcamEntryPortAdd
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamAddEntryPort))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort(dev, tcamPointer, portNum);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamAddEntryPort)(dev, tcamPointer, portNum);
 		}
 		else
 		{
@@ -547,9 +548,9 @@ MSD_STATUS msdTcamEntryPortRemove
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamRemoveEntryPort))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort(dev, tcamPointer, portNum);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamRemoveEntryPort)(dev, tcamPointer, portNum);
 		}
 		else
 		{
@@ -605,9 +606,9 @@ MSD_STATUS msdEgrTcamEntryPerPortDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamEgrFlushEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry(dev, portNum, tcamPointer);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamEgrFlushEntry)(dev, portNum, tcamPointer);
 		}
 		else
 		{
@@ -655,9 +656,9 @@ MSD_STATUS msdEgrTcamEntryAllPortsDelete
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamEgrFlushEntryAllPorts))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts(dev, tcamPointer);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamEgrFlushEntryAllPorts)(dev, tcamPointer);
 		}
 		else
 		{
@@ -709,9 +710,9 @@ MSD_STATUS msdEgrTcamEntryAdd
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamEgrLoadEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry(dev, portNum, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamEgrLoadEntry)(dev, portNum, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -767,9 +768,9 @@ MSD_STATUS msdEgrTcamEntryGetNext
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamEgrGetNextTCAMData))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData(dev, portNum, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamEgrGetNextTCAMData)(dev, portNum, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -821,9 +822,9 @@ MSD_STATUS msdEgrTcamEntryRead
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamEgrReadTCAMData))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData(dev, portNum, tcamPointer, tcamData);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamEgrReadTCAMData)(dev, portNum, tcamPointer, tcamData);
 		}
 		else
 		{
@@ -870,9 +871,9 @@ MSD_STATUS msdTcamDump
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamDump != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamDump))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamDump(dev);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamDump)(dev);
 		}
 		else
 		{
@@ -937,9 +938,9 @@ MSD_STATUS msdTcamAdvConfig
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMObj.gtcamAdvConfig != NULL)
+		if (MSD_DEV_HAS(dev, TCAMObj, gtcamAdvConfig))
 		{
-			retVal = dev->SwitchDevObj.TCAMObj.gtcamAdvConfig(dev, pktType, tcamPointer, tcamPointer2, keyMaskPtr, keyPtr, maskPtr, patternPtr, actionPtr, entry2Used);
+			retVal = MSD_DEV_FN(dev, TCAMObj, gtcamAdvConfig)(dev, pktType, tcamPointer, tcamPointer2, keyMaskPtr, keyPtr, maskPtr, patternPtr, actionPtr, entry2Used);
 		}
 		else
 		{
@@ -20,6 +20,7 @@
 #include <api/msdTCAMRC.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdTcamRCEntryAdd
@@ -61,9 +62,9 @@ IN  MSD_TCAM_RC_DATA *rcData
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCLoadEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry(dev, rcEntryNum, rcData);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCLoadEntry)(dev, rcEntryNum, rcData);
 		}
 		else
 		{
@@ -111,9 +112,9 @@ IN  MSD_U8  devNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCFlushAllEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry(dev);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCFlushAllEntry)(dev);
 		}
 		else
 		{
@@ -163,9 +164,9 @@ IN  MSD_U32 rcEntryNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCFlushEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry(dev, rcEntryNum);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCFlushEntry)(dev, rcEntryNum);
 		}
 		else
 		{
@@ -216,9 +217,9 @@ OUT MSD_TCAM_RC_DATA  *rcData
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCReadEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry(dev, rcEntryNum, rcData);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCReadEntry)(dev, rcEntryNum, rcData);
 		}
 		else
 		{
@@ -270,9 +271,9 @@ OUT   MSD_TCAM_RC_DATA *rcData
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCGetNextEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry(dev, rcEntryNum, rcData);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCGetNextEntry)(dev, rcEntryNum, rcData);
 		}
 		else
 		{
@@ -322,9 +323,9 @@ OUT	MSD_BOOL *found
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCFindEntry))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry(dev, rcEntryNum, rcData, found);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCFindEntry)(dev, rcEntryNum, rcData, found);
 		}
 		else
 		{
@@ -371,9 +372,9 @@ IN  MSD_U8  devNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCObj, gtcamRCEntryDump))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump(dev);
+			retVal = MSD_DEV_FN(dev, TCAMRCObj, gtcamRCEntryDump)(dev);
 		}
 		else
 		{
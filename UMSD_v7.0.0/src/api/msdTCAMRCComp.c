@@ -20,6 +20,7 @@
 #include <api/msdTCAMRCComp.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdTcamRCCompAdd
@@ -61,9 +62,9 @@ IN  MSD_TCAM_RC_COMP_DATA *tcamRCCompData
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCCompObj, gtcamRCCompLoad))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad(dev, portNum, tcamRCCompData);
+			retVal = MSD_DEV_FN(dev, TCAMRCCompObj, gtcamRCCompLoad)(dev, portNum, tcamRCCompData);
 		}
 		else
 		{
@@ -111,9 +112,9 @@ IN  MSD_U8  devNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCCompObj, gtcamRCCompFlushAll))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll(dev);
+			retVal = MSD_DEV_FN(dev, TCAMRCCompObj, gtcamRCCompFlushAll)(dev);
 		}
 		else
 		{
@@ -163,9 +164,9 @@ IN  MSD_LPORT portNum
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCCompObj, gtcamRCCompFlushPort))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort(dev, portNum);
+			retVal = MSD_DEV_FN(dev, TCAMRCCompObj, gtcamRCCompFlushPort)(dev, portNum);
 		}
 		else
 		{
@@ -215,9 +216,9 @@ OUT MSD_TCAM_RC_COMP_DATA *tcamRCCompData
     }
 	else
 	{
-		if (dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead != NULL)
+		if (MSD_DEV_HAS(dev, TCAMRCCompObj, gtcamRCCompRead))
 		{
-			retVal = dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead(dev, portNum, tcamRCCompData);
+			retVal = MSD_DEV_FN(dev, TCAMRCCompObj, gtcamRCCompRead)(dev, portNum, tcamRCCompData);
 		}
 		else
 		{
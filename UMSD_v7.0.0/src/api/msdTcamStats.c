@@ -0,0 +1,789 @@
+/**********************************************************************************************
+* Copyright (c) 2023 Marvell.
+* All rights reserved.
+* Use of this source code is governed by a BSD3 license that
+* can be found in the LICENSE file and also at https://opensource.org/licenses/BSD-3-Clause
+**********************************************************************************************/
+
+
+/********************************************************************************
+* msdTcamStats.c
+*
+* DESCRIPTION:
+*       API definitions for TCAM rule hit statistics, built on the TCAM and
+*       the port RMON functionality.
+*
+* DEPENDENCIES:
+*       None.
+*
+* FILE REVISION NUMBER:
+*******************************************************************************/
+
+#include <api/msdTcamStats.h>
+#include <driver/msdApiTypes.h>
+#include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
+
+/*
+* set the IncTcamCtr and tcamCtr action fields of a rule, MSD_TCAM_STATS_NO_COUNTER
+* disables the counter increment. The entry is only written if it changes.
+*/
+static MSD_STATUS tcamStatsActionSet
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32  tcamPointer,
+    IN  MSD_U8  counter
+)
+{
+    MSD_STATUS retVal;
+    MSD_TCAM_DATA tcamData;
+    MSD_U8 inc;
+    MSD_U8 ctr;
+
+    inc = (counter == MSD_TCAM_STATS_NO_COUNTER) ? (MSD_U8)0 : (MSD_U8)1;
+    ctr = (counter == MSD_TCAM_STATS_NO_COUNTER) ? (MSD_U8)0 : counter;
+
+    retVal = MSD_DEV_FN(dev, TCAMObj, gtcamReadTCAMData)(dev, tcamPointer, &tcamData);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    if ((tcamData.IncTcamCtr == inc) && ((inc == 0U) || (tcamData.tcamCtr == ctr)))
+    {
+        return MSD_OK;
+    }
+
+    tcamData.IncTcamCtr = inc;
+    tcamData.tcamCtr = ctr;
+    return MSD_DEV_FN(dev, TCAMObj, gtcamLoadEntry)(dev, tcamPointer, &tcamData);
+}
+
+/*
+* read one TCAM counter of every sampled port and credit the increments since
+* the last collection to the owner of the counter
+*/
+static MSD_STATUS tcamStatsCollect
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U8  counter
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_TCAM_STATS_SHADOW *shadow = dev->tcamStats;
+    MSD_LPORT port;
+    MSD_U32 value;
+    MSD_U32 delta = 0;
+
+    for (port = 0; (retVal == MSD_OK) && (port < dev->numOfPorts) && (port < MSD_MAX_SWITCH_PORTS); port++)
+    {
+        if ((shadow->portVec & ((MSD_U32)1 << port)) == 0U)
+        {
+            continue;
+        }
+        retVal = MSD_DEV_FN(dev, PORTRMONObj, gstatsGetPortCounter)(dev, port,
+            (MSD_STATS_COUNTERS)((MSD_U32)MSD_STATS_TCAMCounter0 + (MSD_U32)counter), &value);
+        if (retVal == MSD_OK)
+        {
+            /* modulo 2^32, the counters wrap */
+            delta += value - shadow->lastCount[port][counter];
+            shadow->lastCount[port][counter] = value;
+        }
+    }
+
+    if ((retVal == MSD_OK) && (shadow->owner[counter] != MSD_TCAM_STATS_NO_COUNTER))
+    {
+        shadow->rule[shadow->owner[counter]].hits += (MSD_U64)delta;
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS tcamStatsCounterRelease
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U8  counter
+)
+{
+    MSD_STATUS retVal;
+    MSD_TCAM_STATS_SHADOW *shadow = dev->tcamStats;
+    MSD_TCAM_STATS_RULE *rule;
+
+    retVal = tcamStatsCollect(dev, counter);
+    if ((retVal == MSD_OK) && (shadow->owner[counter] != MSD_TCAM_STATS_NO_COUNTER))
+    {
+        rule = &shadow->rule[shadow->owner[counter]];
+        retVal = tcamStatsActionSet(dev, rule->tcamPointer, MSD_TCAM_STATS_NO_COUNTER);
+        if (retVal == MSD_OK)
+        {
+            rule->counter = MSD_TCAM_STATS_NO_COUNTER;
+            shadow->owner[counter] = MSD_TCAM_STATS_NO_COUNTER;
+        }
+    }
+
+    return retVal;
+}
+
+/*
+* hand a counter to a rule. The previous owner is disabled first, so that no
+* frame is counted for two rules.
+*/
+static MSD_STATUS tcamStatsCounterGive
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32  index,
+    IN  MSD_U8  counter
+)
+{
+    MSD_STATUS retVal;
+    MSD_TCAM_STATS_SHADOW *shadow = dev->tcamStats;
+
+    retVal = tcamStatsCounterRelease(dev, counter);
+    if (retVal == MSD_OK)
+    {
+        retVal = tcamStatsActionSet(dev, shadow->rule[index].tcamPointer, counter);
+    }
+    if (retVal == MSD_OK)
+    {
+        shadow->rule[index].counter = counter;
+        shadow->owner[counter] = (MSD_U8)index;
+    }
+
+    return retVal;
+}
+
+/*
+* give the counters not owned by pinned rules to the next rotating rules, in
+* rule order starting at nextRule
+*/
+static MSD_STATUS tcamStatsRotate
+(
+    IN  MSD_QD_DEV  *dev
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_TCAM_STATS_SHADOW *shadow = dev->tcamStats;
+    MSD_BOOL chosen[MSD_TCAM_STATS_MAX_RULES];
+    MSD_U32 numRotating = 0;
+    MSD_U32 numUnpinned = 0;
+    MSD_U32 numChosen = 0;
+    MSD_U32 i;
+    MSD_U32 index;
+    MSD_U8 c;
+
+    for (c = 0; c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM; c++)
+    {
+        if ((shadow->owner[c] == MSD_TCAM_STATS_NO_COUNTER) ||
+            (shadow->rule[shadow->owner[c]].pinned == MSD_FALSE))
+        {
+            numRotating++;
+        }
+    }
+    for (i = 0; i < shadow->numRules; i++)
+    {
+        chosen[i] = MSD_FALSE;
+        if (shadow->rule[i].pinned == MSD_FALSE)
+        {
+            numUnpinned++;
+        }
+    }
+    if ((numRotating == 0U) || (numUnpinned == 0U))
+    {
+        return MSD_OK;
+    }
+
+    index = shadow->nextRule;
+    for (i = 0; (i < shadow->numRules) && (numChosen < numRotating); i++)
+    {
+        if (shadow->rule[index].pinned == MSD_FALSE)
+        {
+            chosen[index] = MSD_TRUE;
+            numChosen++;
+            if (numUnpinned > numRotating)
+            {
+                shadow->nextRule = (index + 1U) % shadow->numRules;
+            }
+        }
+        index = (index + 1U) % shadow->numRules;
+    }
+
+    for (c = 0; (retVal == MSD_OK) && (c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM); c++)
+    {
+        if ((shadow->owner[c] != MSD_TCAM_STATS_NO_COUNTER) && (chosen[shadow->owner[c]] == MSD_FALSE) &&
+            (shadow->rule[shadow->owner[c]].pinned == MSD_FALSE))
+        {
+            retVal = tcamStatsCounterRelease(dev, c);
+        }
+    }
+
+    for (i = 0; (retVal == MSD_OK) && (i < shadow->numRules); i++)
+    {
+        if ((chosen[i] == MSD_FALSE) || (shadow->rule[i].counter != MSD_TCAM_STATS_NO_COUNTER))
+        {
+            continue;
+        }
+        for (c = 0; c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM; c++)
+        {
+            if (shadow->owner[c] == MSD_TCAM_STATS_NO_COUNTER)
+            {
+                break;
+            }
+        }
+        retVal = tcamStatsCounterGive(dev, i, c);
+    }
+
+    return retVal;
+}
+
+/*
+* disable the TCAM counter increment of every rule owning a counter
+*/
+static MSD_STATUS tcamStatsRelease
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_TCAM_STATS_SHADOW  *shadow
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_U8 c;
+
+    for (c = 0; (retVal == MSD_OK) && (c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM); c++)
+    {
+        if (shadow->owner[c] != MSD_TCAM_STATS_NO_COUNTER)
+        {
+            retVal = tcamStatsActionSet(dev, shadow->rule[shadow->owner[c]].tcamPointer, MSD_TCAM_STATS_NO_COUNTER);
+        }
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS tcamStatsDevGet
+(
+    IN  MSD_U8  devNum,
+    OUT MSD_QD_DEV  **devOut
+)
+{
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((!MSD_DEV_HAS(dev, TCAMObj, gtcamReadTCAMData)) ||
+        (!MSD_DEV_HAS(dev, TCAMObj, gtcamLoadEntry)) ||
+        (!MSD_DEV_HAS(dev, PORTRMONObj, gstatsGetPortCounter)))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+    if (NULL == dev->tcamStats)
+    {
+        MSD_DBG_ERROR(("TCAM statistics not started, call msdTcamStatsInit.\n"));
+        return MSD_FEATURE_NOT_ENABLE;
+    }
+
+    *devOut = dev;
+    return MSD_OK;
+}
+
+static MSD_U32 tcamStatsRuleFind
+(
+    IN  MSD_TCAM_STATS_SHADOW  *shadow,
+    IN  MSD_U32  tcamPointer
+)
+{
+    MSD_U32 i;
+
+    for (i = 0; i < shadow->numRules; i++)
+    {
+        if (shadow->rule[i].tcamPointer == tcamPointer)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/*******************************************************************************
+* msdTcamStatsInit
+*
+* DESCRIPTION:
+*       This function starts TCAM rule statistics on a device.
+*
+* INPUTS:
+*       devNum     - physical device number
+*       portVec    - logical port vector of the ports whose counters are summed
+*       dwellTicks - sample intervals between two counter rotations
+*       shadow     - caller memory holding the statistics until msdTcamStatsStop
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsInit
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  portVec,
+    IN  MSD_U32  dwellTicks,
+    IN  MSD_TCAM_STATS_SHADOW  *shadow
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_QD_DEV* dev = sohoDevGet(devNum);
+    MSD_U8 c;
+
+    if (NULL == dev)
+    {
+        MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+        return MSD_FAIL;
+    }
+    if ((!MSD_DEV_HAS(dev, TCAMObj, gtcamReadTCAMData)) ||
+        (!MSD_DEV_HAS(dev, TCAMObj, gtcamLoadEntry)) ||
+        (!MSD_DEV_HAS(dev, PORTRMONObj, gstatsGetPortCounter)))
+    {
+        return MSD_NOT_SUPPORTED;
+    }
+    if ((dwellTicks == 0U) || (portVec == 0U) || ((portVec & ~dev->validPortVec) != 0U))
+    {
+        MSD_DBG_ERROR(("Bad portVec 0x%x or dwellTicks %u.\n", portVec, dwellTicks));
+        return MSD_BAD_PARAM;
+    }
+    if (NULL == shadow)
+    {
+        MSD_DBG_ERROR(("Input param shadow is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    /* release the rules of a previous run */
+    if (dev->tcamStats != NULL)
+    {
+        retVal = tcamStatsRelease(dev, dev->tcamStats);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Release of tagged rules returned: %s.\n", msdDisplayStatus(retVal)));
+            return retVal;
+        }
+        dev->tcamStats = NULL;
+    }
+
+    msdMemSet((void*)shadow, 0, sizeof(MSD_TCAM_STATS_SHADOW));
+    for (c = 0; c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM; c++)
+    {
+        shadow->owner[c] = MSD_TCAM_STATS_NO_COUNTER;
+    }
+    shadow->portVec = portVec;
+    shadow->dwellTicks = dwellTicks;
+    dev->tcamStats = shadow;
+
+    /* take the base values, nothing owns a counter yet */
+    for (c = 0; (retVal == MSD_OK) && (c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM); c++)
+    {
+        retVal = tcamStatsCollect(dev, c);
+    }
+
+    if (retVal != MSD_OK)
+    {
+        dev->tcamStats = NULL;
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdTcamStatsStop
+*
+* DESCRIPTION:
+*       This function stops TCAM rule statistics on a device.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsStop
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = NULL;
+
+    retVal = tcamStatsDevGet(devNum, &dev);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    retVal = tcamStatsRelease(dev, dev->tcamStats);
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Release of tagged rules returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+    dev->tcamStats = NULL;
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdTcamStatsRuleAdd
+*
+* DESCRIPTION:
+*       This function tags a TCAM rule for counting.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry holding the action of the rule
+*       pinned      - MSD_TRUE to count the rule exactly
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_ALREADY_EXIST - the rule is already tagged
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleAdd
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer,
+    IN  MSD_BOOL  pinned
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = NULL;
+    MSD_TCAM_STATS_SHADOW *shadow;
+    MSD_TCAM_STATS_RULE *rule;
+    MSD_U32 index;
+    MSD_U8 c;
+    MSD_U8 stolen = MSD_TCAM_STATS_NO_COUNTER;
+
+    retVal = tcamStatsDevGet(devNum, &dev);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    shadow = dev->tcamStats;
+    if (tcamStatsRuleFind(shadow, tcamPointer) < shadow->numRules)
+    {
+        return MSD_ALREADY_EXIST;
+    }
+    if (shadow->numRules >= MSD_TCAM_STATS_MAX_RULES)
+    {
+        MSD_DBG_ERROR(("No more than %u rules can be tagged.\n", MSD_TCAM_STATS_MAX_RULES));
+        return MSD_BAD_PARAM;
+    }
+
+    /* a free counter first, for a pinned rule else one of a rotating rule */
+    for (c = 0; c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM; c++)
+    {
+        if (shadow->owner[c] == MSD_TCAM_STATS_NO_COUNTER)
+        {
+            break;
+        }
+        if ((stolen == MSD_TCAM_STATS_NO_COUNTER) && (shadow->rule[shadow->owner[c]].pinned == MSD_FALSE))
+        {
+            stolen = c;
+        }
+    }
+    if ((c == (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM) && (pinned == MSD_TRUE))
+    {
+        if (stolen == MSD_TCAM_STATS_NO_COUNTER)
+        {
+            MSD_DBG_ERROR(("All TCAM counters are used by pinned rules.\n"));
+            return MSD_BAD_PARAM;
+        }
+        c = stolen;
+    }
+
+    index = shadow->numRules;
+    rule = &shadow->rule[index];
+    msdMemSet((void*)rule, 0, sizeof(MSD_TCAM_STATS_RULE));
+    rule->tcamPointer = tcamPointer;
+    rule->pinned = pinned;
+    rule->counter = MSD_TCAM_STATS_NO_COUNTER;
+
+    if (c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM)
+    {
+        retVal = tcamStatsCounterGive(dev, index, c);
+    }
+    else
+    {
+        /* no counter now, make sure the rule does not count on a stale one */
+        retVal = tcamStatsActionSet(dev, tcamPointer, MSD_TCAM_STATS_NO_COUNTER);
+    }
+
+    if (retVal == MSD_OK)
+    {
+        shadow->numRules++;
+    }
+    else
+    {
+        MSD_DBG_ERROR(("msdTcamStatsRuleAdd returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdTcamStatsRuleRemove
+*
+* DESCRIPTION:
+*       This function stops counting a TCAM rule.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry given to msdTcamStatsRuleAdd
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NO_SUCH - the rule is not tagged
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleRemove
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = NULL;
+    MSD_TCAM_STATS_SHADOW *shadow;
+    MSD_U32 index;
+    MSD_U32 i;
+    MSD_U8 c;
+
+    retVal = tcamStatsDevGet(devNum, &dev);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    shadow = dev->tcamStats;
+    index = tcamStatsRuleFind(shadow, tcamPointer);
+    if (index >= shadow->numRules)
+    {
+        return MSD_NO_SUCH;
+    }
+
+    if (shadow->rule[index].counter != MSD_TCAM_STATS_NO_COUNTER)
+    {
+        retVal = tcamStatsCounterRelease(dev, shadow->rule[index].counter);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("msdTcamStatsRuleRemove returned: %s.\n", msdDisplayStatus(retVal)));
+            return retVal;
+        }
+    }
+
+    for (i = index; (i + 1U) < shadow->numRules; i++)
+    {
+        shadow->rule[i] = shadow->rule[i + 1U];
+    }
+    shadow->numRules--;
+
+    for (c = 0; c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM; c++)
+    {
+        if ((shadow->owner[c] != MSD_TCAM_STATS_NO_COUNTER) && ((MSD_U32)shadow->owner[c] > index))
+        {
+            shadow->owner[c]--;
+        }
+    }
+    if (shadow->nextRule > index)
+    {
+        shadow->nextRule--;
+    }
+    if (shadow->nextRule >= shadow->numRules)
+    {
+        shadow->nextRule = 0;
+    }
+
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* msdTcamStatsSample
+*
+* DESCRIPTION:
+*       This function ends one sample interval, collects the TCAM counters and
+*       rotates them every dwellTicks calls.
+*
+* INPUTS:
+*       devNum - physical device number
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_NOT_SUPPORTED - device not support
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsSample
+(
+    IN  MSD_U8  devNum
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = NULL;
+    MSD_TCAM_STATS_SHADOW *shadow;
+    MSD_U32 i;
+    MSD_U8 c;
+
+    retVal = tcamStatsDevGet(devNum, &dev);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    shadow = dev->tcamStats;
+    for (c = 0; (retVal == MSD_OK) && (c < (MSD_U8)MSD_TCAM_STATS_COUNTER_NUM); c++)
+    {
+        retVal = tcamStatsCollect(dev, c);
+    }
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("TCAM counter read returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+
+    shadow->tickCount++;
+    for (i = 0; i < shadow->numRules; i++)
+    {
+        shadow->rule[i].totalTicks++;
+        if (shadow->rule[i].counter != MSD_TCAM_STATS_NO_COUNTER)
+        {
+            shadow->rule[i].observedTicks++;
+        }
+    }
+
+    if ((shadow->tickCount % shadow->dwellTicks) == 0U)
+    {
+        retVal = tcamStatsRotate(dev);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("TCAM counter rotation returned: %s.\n", msdDisplayStatus(retVal)));
+        }
+    }
+
+    return retVal;
+}
+
+/*******************************************************************************
+* msdTcamStatsRuleGet
+*
+* DESCRIPTION:
+*       This function gets the hit statistics of a tagged TCAM rule.
+*
+* INPUTS:
+*       devNum      - physical device number
+*       tcamPointer - TCAM entry given to msdTcamStatsRuleAdd
+*
+* OUTPUTS:
+*       stats - hit statistics of the rule
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - the rule is not tagged
+*       MSD_FEATURE_NOT_ENABLE - msdTcamStatsInit was not called
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+MSD_STATUS msdTcamStatsRuleGet
+(
+    IN  MSD_U8  devNum,
+    IN  MSD_U32  tcamPointer,
+    OUT MSD_TCAM_RULE_STATS  *stats
+)
+{
+    MSD_STATUS retVal;
+    MSD_QD_DEV* dev = NULL;
+    MSD_TCAM_STATS_RULE *rule;
+    MSD_U32 index;
+
+    if (NULL == stats)
+    {
+        MSD_DBG_ERROR(("Input param stats is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    retVal = tcamStatsDevGet(devNum, &dev);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    index = tcamStatsRuleFind(dev->tcamStats, tcamPointer);
+    if (index >= dev->tcamStats->numRules)
+    {
+        return MSD_NO_SUCH;
+    }
+    rule = &dev->tcamStats->rule[index];
+
+    stats->tcamPointer = rule->tcamPointer;
+    stats->pinned = rule->pinned;
+    stats->hits = rule->hits;
+    stats->observedTicks = rule->observedTicks;
+    stats->totalTicks = rule->totalTicks;
+    if (rule->observedTicks == rule->totalTicks)
+    {
+        stats->estimatedHits = rule->hits;
+    }
+    else if (rule->observedTicks == 0U)
+    {
+        stats->estimatedHits = 0;
+    }
+    else
+    {
+        stats->estimatedHits = (rule->hits * (MSD_U64)rule->totalTicks) / (MSD_U64)rule->observedTicks;
+    }
+
+    return MSD_OK;
+}
@@ -21,6 +21,7 @@
 #include <api/msdTrunk.h>
 #include <driver/msdApiTypes.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 /*******************************************************************************
 * msdTrunkMaskTableGet
@@ -62,9 +63,9 @@ MSD_STATUS msdTrunkMaskTableGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysGetTrunkMaskTable))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable(dev, maskNum, trunkMask);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysGetTrunkMaskTable)(dev, maskNum, trunkMask);
 		}
 		else
 		{
@@ -116,9 +117,9 @@ MSD_STATUS msdTrunkMaskTableSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysSetTrunkMaskTable))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable(dev, maskNum, trunkMask);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetTrunkMaskTable)(dev, maskNum, trunkMask);
 		}
 		else
 		{
@@ -172,9 +173,9 @@ MSD_STATUS msdTrunkHashTrunkGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysGetHashTrunk))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk(dev, en);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysGetHashTrunk)(dev, en);
 		}
 		else
 		{
@@ -229,9 +230,9 @@ MSD_STATUS msdTrunkHashTrunkSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysSetHashTrunk))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk(dev, en);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetHashTrunk)(dev, en);
 		}
 		else
 		{
@@ -282,9 +283,9 @@ MSD_STATUS msdTrunkRoutingGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysGetTrunkRouting))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting(dev, trunkId, trunkMap);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysGetTrunkRouting)(dev, trunkId, trunkMap);
 		}
 		else
 		{
@@ -336,9 +337,9 @@ MSD_STATUS msdTrunkRoutingSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gsysSetTrunkRouting))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting(dev, trunkId, trunkMap);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gsysSetTrunkRouting)(dev, trunkId, trunkMap);
 		}
 		else
 		{
@@ -466,9 +467,9 @@ MSD_STATUS msdPortLAGPortGet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gprtGetTrunkPort))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort(dev, portNum, en, LAGId);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gprtGetTrunkPort)(dev, portNum, en, LAGId);
 		}
 		else
 		{
@@ -522,9 +523,9 @@ MSD_STATUS msdPortLAGPortSet
     }
 	else
 	{
-		if (dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort != NULL)
+		if (MSD_DEV_HAS(dev, TrunkObj, gprtSetTrunkPort))
 		{
-			retVal = dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort(dev, portNum, en, LAGId);
+			retVal = MSD_DEV_FN(dev, TrunkObj, gprtSetTrunkPort)(dev, portNum, en, LAGId);
 		}
 		else
 		{
@@ -22,6 +22,7 @@
 #include <driver/msdSysConfig.h>
 #include <driver/msdDevObj.h>
 #include <driver/msdHwAccess.h>
+#include <platform/msdSem.h>
 #include <utils/msdUtils.h>
 #ifdef TOPAZ_BUILD_IN
 #include <topaz/include/Topaz_msdApi.h>
@@ -54,4571 +55,4803 @@
 #include <bonsai/include/Bonsai_msdApi.h>
 #endif
 
+#ifdef MSD_SINGLE_FAMILY_FIR
+#if !defined(FIR_BUILD_IN) || defined(TOPAZ_BUILD_IN) || defined(PERIDOT_BUILD_IN) || defined(PEARL_BUILD_IN) || \
+    defined(AGATE_BUILD_IN) || defined(AMETHYST_BUILD_IN) || defined(OAK_BUILD_IN) || defined(SPRUCE_BUILD_IN) || \
+    defined(BONSAIZ1_BUILD_IN) || defined(BONSAI_BUILD_IN)
+#error "MSD_SINGLE_FAMILY_FIR needs FIR_BUILD_IN and no other device family"
+#endif
+
+/*
+* The API calls the Fir functions directly through MSD_DEV_FN, see
+* Fir_msdDispatch.h, so no function table is built. Devices point to
+* msdDevObjNone; msdLoadDriver accepts Fir devices only.
+*/
+static const SwitchDevObj_ msdDevObjNone;
+
+void ResetDevObj(MSD_QD_DEV *dev)
+{
+	dev->SwitchDevObj = &msdDevObjNone;
+}
+
+MSD_STATUS InitDevObj(MSD_QD_DEV *dev)
+{
+	dev->SwitchDevObj = &msdDevObjNone;
+
+	return (dev->devName == MSD_FIR) ? MSD_OK : MSD_NOT_SUPPORTED;
+}
+
+#else
+
 /* static function declare*/
-static MSD_STATUS InitObj(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Peridot(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Topaz(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Pearl(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Agate(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Amethyst(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Oak(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Spruce(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_BonsaiZ1(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Fir(MSD_QD_DEV *dev);
-static MSD_STATUS InitDevObj_Bonsai(MSD_QD_DEV *dev);
+static MSD_STATUS InitObj(SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Peridot(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Topaz(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Pearl(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Agate(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Amethyst(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Oak(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Spruce(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_BonsaiZ1(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Fir(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
+static MSD_STATUS InitDevObj_Bonsai(MSD_QD_DEV *dev, SwitchDevObj_ *obj);
 static MSD_STATUS msdReserveFreeQueueSize(MSD_QD_DEV *qdev);
 
 
-static MSD_STATUS InitDevObj_Peridot(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Peridot(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef PERIDOT_BUILD_IN
-    dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Peridot_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Peridot_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Peridot_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Peridot_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Peridot_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Peridot_gfdbMoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Peridot_gfdbPortRemoveIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Peridot_gfdbPortRemoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Peridot_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Peridot_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Peridot_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Peridot_gfdbSetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Peridot_gfdbGetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Peridot_gfdbSetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Peridot_gfdbGetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Peridot_gfdbSetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Peridot_gfdbGetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Peridot_gfdbGetPortLearnCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Peridot_gfdbGetEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Peridot_gfdbGetEntryCountPerFid;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Peridot_gfdbGetNonStaticEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Peridot_gfdbGetNonStaticEntryCountPerFid;
-    dev->SwitchDevObj.ATUObj.gfdbDump = &Peridot_gfdbDump;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable = &Peridot_gprtSetCutThrouthEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable = &Peridot_gprtGetCutThrouthEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Peridot_gprtSetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Peridot_gprtGetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Peridot_gprtSetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Peridot_gprtGetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Peridot_gprtSetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Peridot_gprtGetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Peridot_gprtSetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Peridot_gprtGetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Peridot_gprtSetQueueToPause;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Peridot_gprtGetQueueToPause;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Peridot_gprtSetRxPriorityFlowControlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Peridot_gprtGetRxPriorityFlowControlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Peridot_gprtSetRxPriorityFlowControlToQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Peridot_gprtGetRxPriorityFlowControlToQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Peridot_gprtSetTxPriorityFlowControlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Peridot_gprtGetTxPriorityFlowControlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Peridot_gprtGetOutQueueSize;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Peridot_gprtSetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Peridot_gprtGetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Peridot_gprtSetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Peridot_gprtGetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Peridot_gprtSetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Peridot_gprtGetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Peridot_gprtSetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Peridot_gprtGetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Peridot_gprtSetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Peridot_gprtGetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Peridot_gprtSetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Peridot_gprtGetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Peridot_gprtSetARPMirror;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Peridot_gprtGetARPMirror;
-
-	dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = &Peridot_gvctGetAdvCableDiagIntf;
-	dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = &Peridot_gvctGetAdvExtendedStatusIntf;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Peridot_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Peridot_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Peridot_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Peridot_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Peridot_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Peridot_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Peridot_gvtuFindVidEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Peridot_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Peridot_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Peridot_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Peridot_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Peridot_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &Peridot_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &Peridot_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Peridot_gvtuGetViolationIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Peridot_gvtuGetEntryCountIntf;
-    dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Peridot_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Peridot_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Peridot_gvtuDump;
+    obj->ATUObj.gfdbAddMacEntry = &Peridot_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Peridot_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Peridot_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Peridot_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Peridot_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Peridot_gfdbMoveInDBIntf;
+    obj->ATUObj.gfdbPortRemove = &Peridot_gfdbPortRemoveIntf;
+    obj->ATUObj.gfdbPortRemoveInDB = &Peridot_gfdbPortRemoveInDBIntf;
+    obj->ATUObj.gfdbDelAtuEntry = &Peridot_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Peridot_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Peridot_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Peridot_gfdbSetAgingTimeout;
+    obj->ATUObj.gfdbGetAgingTimeout = &Peridot_gfdbGetAgingTimeout;
+    obj->ATUObj.gfdbSetLearn2All = &Peridot_gfdbSetLearn2All;
+    obj->ATUObj.gfdbGetLearn2All = &Peridot_gfdbGetLearn2All;
+    obj->ATUObj.gfdbSetPortLearnLimit = &Peridot_gfdbSetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnLimit = &Peridot_gfdbGetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnCount = &Peridot_gfdbGetPortLearnCount;
+    obj->ATUObj.gfdbGetEntryCount = &Peridot_gfdbGetEntryCount;
+    obj->ATUObj.gfdbGetEntryCountPerFid = &Peridot_gfdbGetEntryCountPerFid;
+    obj->ATUObj.gfdbGetNonStaticEntryCount = &Peridot_gfdbGetNonStaticEntryCount;
+    obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Peridot_gfdbGetNonStaticEntryCountPerFid;
+    obj->ATUObj.gfdbDump = &Peridot_gfdbDump;
+    obj->PORTCTRLObj.gprtSetCutThrouthEnable = &Peridot_gprtSetCutThrouthEnableIntf;
+    obj->PORTCTRLObj.gprtGetCutThrouthEnable = &Peridot_gprtGetCutThrouthEnableIntf;
+    obj->PORTCTRLObj.gprtSetIgnoreFcs = &Peridot_gprtSetIgnoreFcs;
+    obj->PORTCTRLObj.gprtGetIgnoreFcs = &Peridot_gprtGetIgnoreFcs;
+    obj->PORTCTRLObj.gprtSetAllowBadFcs = &Peridot_gprtSetAllowBadFcs;
+    obj->PORTCTRLObj.gprtGetAllowBadFcs = &Peridot_gprtGetAllowBadFcs;
+    obj->PORTCTRLObj.gprtSetPauseLimitOut = &Peridot_gprtSetPauseLimitOut;
+    obj->PORTCTRLObj.gprtGetPauseLimitOut = &Peridot_gprtGetPauseLimitOut;
+    obj->PORTCTRLObj.gprtSetPauseLimitIn = &Peridot_gprtSetPauseLimitIn;
+    obj->PORTCTRLObj.gprtGetPauseLimitIn = &Peridot_gprtGetPauseLimitIn;
+    obj->PORTCTRLObj.gprtSetQueueToPause = &Peridot_gprtSetQueueToPause;
+    obj->PORTCTRLObj.gprtGetQueueToPause = &Peridot_gprtGetQueueToPause;
+    obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Peridot_gprtSetRxPriorityFlowControlEnable;
+    obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Peridot_gprtGetRxPriorityFlowControlEnable;
+    obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Peridot_gprtSetRxPriorityFlowControlToQueue;
+    obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Peridot_gprtGetRxPriorityFlowControlToQueue;
+    obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Peridot_gprtSetTxPriorityFlowControlEnable;
+    obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Peridot_gprtGetTxPriorityFlowControlEnable;
+    obj->PORTCTRLObj.gprtGetOutQueueSize = &Peridot_gprtGetOutQueueSize;
+    obj->PORTCTRLObj.gprtSetMapDA = &Peridot_gprtSetMapDA;
+    obj->PORTCTRLObj.gprtGetMapDA = &Peridot_gprtGetMapDA;
+    obj->PORTCTRLObj.gprtSetPortLocked = &Peridot_gprtSetPortLocked;
+    obj->PORTCTRLObj.gprtGetPortLocked = &Peridot_gprtGetPortLocked;
+    obj->PORTCTRLObj.gprtSetHoldAt1 = &Peridot_gprtSetHoldAt1;
+    obj->PORTCTRLObj.gprtGetHoldAt1 = &Peridot_gprtGetHoldAt1;
+    obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Peridot_gprtSetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Peridot_gprtGetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtSetRefreshLocked = &Peridot_gprtSetRefreshLocked;
+    obj->PORTCTRLObj.gprtGetRefreshLocked = &Peridot_gprtGetRefreshLocked;
+    obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Peridot_gprtSetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Peridot_gprtGetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtSetARPMirror = &Peridot_gprtSetARPMirror;
+    obj->PORTCTRLObj.gprtGetARPMirror = &Peridot_gprtGetARPMirror;
+
+	obj->VCTObj.gvctGetAdvCableDiag = &Peridot_gvctGetAdvCableDiagIntf;
+	obj->VCTObj.gvctGetAdvExtendedStatus = &Peridot_gvctGetAdvExtendedStatusIntf;
+
+	obj->STUObj.gstuAddEntry = &Peridot_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Peridot_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &Peridot_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Peridot_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &Peridot_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Peridot_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Peridot_gvtuFindVidEntryIntf;
+    obj->VTUObj.gvtuExistVidEntry = &Peridot_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Peridot_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Peridot_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Peridot_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Peridot_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &Peridot_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &Peridot_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &Peridot_gvtuGetViolationIntf;
+    obj->VTUObj.gvtuGetEntryCount = &Peridot_gvtuGetEntryCountIntf;
+    obj->VTUObj.gvtuSetMemberTag = &Peridot_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Peridot_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Peridot_gvtuDump;
 	
-    dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Peridot_gprtSetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Peridot_gprtGetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Peridot_gsysSetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Peridot_gsysGetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Peridot_gsysSetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Peridot_gsysGetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Peridot_gsysSetTrunkRouting;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Peridot_gsysGetTrunkRouting;
+    obj->TrunkObj.gprtSetTrunkPort = &Peridot_gprtSetTrunkPort;
+    obj->TrunkObj.gprtGetTrunkPort = &Peridot_gprtGetTrunkPort;
+    obj->TrunkObj.gsysSetTrunkMaskTable = &Peridot_gsysSetTrunkMaskTable;
+    obj->TrunkObj.gsysGetTrunkMaskTable = &Peridot_gsysGetTrunkMaskTable;
+    obj->TrunkObj.gsysSetHashTrunk = &Peridot_gsysSetHashTrunk;
+    obj->TrunkObj.gsysGetHashTrunk = &Peridot_gsysGetHashTrunk;
+    obj->TrunkObj.gsysSetTrunkRouting = &Peridot_gsysSetTrunkRouting;
+    obj->TrunkObj.gsysGetTrunkRouting = &Peridot_gsysGetTrunkRouting;
 	
-	dev->SwitchDevObj.IMPObj.impRun = &Peridot_impRunIntf;
-	dev->SwitchDevObj.IMPObj.impReset = &Peridot_impResetIntf;
-	dev->SwitchDevObj.IMPObj.impWriteEEPROM = &Peridot_impWriteEEPROMIntf;
-	dev->SwitchDevObj.IMPObj.impLoadToEEPROM = &Peridot_impLoadToEEPROMIntf;
-	dev->SwitchDevObj.IMPObj.impLoadToRAM = &Peridot_impLoadToRAMIntf;
-	dev->SwitchDevObj.IMPObj.impStop = &Peridot_impStopIntf;
-
-	dev->SwitchDevObj.PHYCTRLObj.gphyReset = &Peridot_gphyReset;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Peridot_serdesReset;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = &Peridot_gphySetPortLoopback;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = &Peridot_gphySetPortSpeedIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = &Peridot_gphyPortPowerDown;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = &Peridot_gphySetPortDuplexMode;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = &Peridot_gphySetPortAutoModeIntf;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = &Peridot_gphySetEEE;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = &Peridot_gphySetFlowControlEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = &Peridot_gphySetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = &Peridot_gphyGetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = &Peridot_gphyGetIntStatus;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Peridot_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Peridot_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Peridot_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Peridot_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Peridot_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Peridot_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Peridot_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Peridot_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Peridot_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Peridot_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Peridot_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Peridot_gpirlGetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Peridot_gpirlSetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Peridot_gpirlAdvConfigIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Peridot_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Peridot_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Peridot_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Peridot_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Peridot_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Peridot_gvlnSetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Peridot_gvlnGetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Peridot_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Peridot_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Peridot_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Peridot_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Peridot_gprtSetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Peridot_gprtGetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Peridot_gprtSetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Peridot_gprtGetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Peridot_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Peridot_gprtGetDiscardBCastModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Peridot_gprtSetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Peridot_gprtGetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Peridot_gprtSetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Peridot_gprtGetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Peridot_gprtSetDropOnLock;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Peridot_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Peridot_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Peridot_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Peridot_gprtSetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Peridot_gprtGetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Peridot_gprtSetVTUPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Peridot_gprtGetVTUPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Peridot_gprtSetSAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Peridot_gprtGetSAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Peridot_gprtSetDAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Peridot_gprtGetDAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Peridot_gprtSetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Peridot_gprtGetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Peridot_gprtSetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Peridot_gprtGetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Peridot_gprtSetAllowVidZero;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Peridot_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Peridot_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Peridot_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Peridot_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Peridot_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Peridot_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Peridot_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Peridot_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Peridot_grcGetEgressRateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Peridot_gprtGetDuplexStatusIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Peridot_gprtSetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Peridot_gprtGetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Peridot_gprtGetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Peridot_gprtSetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Peridot_gprtGetLinkState;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Peridot_gprtSetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Peridot_gprtGetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Peridot_gprtGetSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Peridot_gprtSetFrameModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Peridot_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Peridot_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Peridot_gprtGetEgressModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Peridot_gprtSetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Peridot_gprtGetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Peridot_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Peridot_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Peridot_gprtRegDump;
-
-    dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Peridot_gprtGetIEEEPrioMapIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Peridot_gprtSetIEEEPrioMapIntf;
-    dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Peridot_gqosGetPrioMapRuleIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Peridot_gprtGetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Peridot_gprtSetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Peridot_gprtGetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Peridot_gprtSetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Peridot_gprtGetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Peridot_gprtSetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Peridot_gqosSetPrioMapRuleIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Peridot_gprtRewriteDscp;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Peridot_gprtSetCosToQueue;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Peridot_gprtGetCosToQueue;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Peridot_gprtSetCosToDscp;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Peridot_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Peridot_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Peridot_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Peridot_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Peridot_gstatsGetPortAllCountersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Peridot_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Peridot_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Peridot_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Peridot_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Peridot_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Peridot_gprtSetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Peridot_gprtGetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Peridot_gsysSetQoSWeightIntf;
-    dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Peridot_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Peridot_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Peridot_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMonitorMgmtCtrl = &Peridot_gsysSetMonitorMgmtCtrl;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMonitorMgmtCtrl = &Peridot_gsysGetMonitorMgmtCtrl;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest = &Peridot_gsysSetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest = &Peridot_gsysGetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest = &Peridot_gsysSetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest = &Peridot_gsysGetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Peridot_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Peridot_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables = &Peridot_gsysSetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables = &Peridot_gsysGetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri = &Peridot_gsysSetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri = &Peridot_gsysGetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Peridot_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Peridot_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Peridot_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Peridot_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Peridot_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Peridot_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Peridot_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Peridot_gsysQbvRead;
-
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Peridot_gqavGetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Peridot_gqavSetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Peridot_gqavGetPortQpriXRate;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Peridot_gqavSetPortQpriXRate;
-
-    dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Peridot_gptpSetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Peridot_gptpGetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Peridot_gptpSetProtPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Peridot_gptpGetProtPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpSetPortConfig = &Peridot_gptpSetPortConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetPortConfig = &Peridot_gptpGetPortConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Peridot_gptpGetTimeStampIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Peridot_gptpGetTSValidSt;
-    dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Peridot_gptpResetTimeStamp;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = &Peridot_gptpSetGlobalConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = &Peridot_gptpGetGlobalConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Peridot_gptpGetIntStatusIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Peridot_gptpSetMeanPathDelay;
-    dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Peridot_gptpGetMeanPathDelay;
-    dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Peridot_gptpSetIgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Peridot_gptpGetIgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Peridot_gptpSetEgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Peridot_gptpGetEgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpSetMode = &Peridot_gptpSetModeIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetMode = &Peridot_gptpGetModeIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetMasterSlave = &Peridot_gptpSetMasterSlaveIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetMasterSlave = &Peridot_gptpGetMasterSlaveIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Peridot_gptpGetTODBusyBitStatus;
-    dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Peridot_gptpTODStoreCompensationIntf;
-    dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Peridot_gptpTODStoreAllIntf;
-    dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Peridot_gptpTODCaptureAllIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPulse = &Peridot_gptpSetPulseIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetPulse = &Peridot_gptpGetPulseIntf;
-    dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Peridot_gtaiGetPTPGlobalTime;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Peridot_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Peridot_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Peridot_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Peridot_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Peridot_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Peridot_gtcamFindEntryIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Peridot_gtcamSetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Peridot_gtcamGetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Peridot_gtcamAddEntryPort;
-    dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Peridot_gtcamRemoveEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Peridot_gtcamEgrFlushEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Peridot_gtcamEgrFlushEntryAllPortsIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Peridot_gtcamEgrLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Peridot_gtcamEgrGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Peridot_gtcamEgrReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &Peridot_gtcamDump;
-    dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Peridot_gtcamAdvConfigIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Peridot_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Peridot_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Peridot_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Peridot_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Peridot_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Peridot_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Peridot_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Peridot_msdRmuRegDump;
-
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Peridot_msdGetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Peridot_msdSetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Peridot_msdGetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Peridot_msdSetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Peridot_msdSetSMIPhyXMDIOReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Peridot_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Peridot_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Peridot_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Peridot_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Peridot_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Peridot_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Peridot_EEPROMReadIntf;
-
-    dev->SwitchDevObj.LEDObj.gledForceOn = &Peridot_gledForceOnIntf;
-    dev->SwitchDevObj.LEDObj.gledForceOff = &Peridot_gledForceOffIntf;
-    dev->SwitchDevObj.LEDObj.gledLinkAct = &Peridot_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Peridot_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Peridot_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Peridot_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Peridot_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Peridot_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Peridot_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Peridot_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Peridot_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Peridot_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Peridot_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Peridot_gledDump;
+	obj->IMPObj.impRun = &Peridot_impRunIntf;
+	obj->IMPObj.impReset = &Peridot_impResetIntf;
+	obj->IMPObj.impWriteEEPROM = &Peridot_impWriteEEPROMIntf;
+	obj->IMPObj.impLoadToEEPROM = &Peridot_impLoadToEEPROMIntf;
+	obj->IMPObj.impLoadToRAM = &Peridot_impLoadToRAMIntf;
+	obj->IMPObj.impStop = &Peridot_impStopIntf;
+
+	obj->PHYCTRLObj.gphyReset = &Peridot_gphyReset;
+    obj->PHYCTRLObj.serdesReset = &Peridot_serdesReset;
+	obj->PHYCTRLObj.gphySetPortLoopback = &Peridot_gphySetPortLoopback;
+	obj->PHYCTRLObj.gphySetPortSpeed = &Peridot_gphySetPortSpeedIntf;
+	obj->PHYCTRLObj.gphyPortPowerDown = &Peridot_gphyPortPowerDown;
+	obj->PHYCTRLObj.gphySetPortDuplexMode = &Peridot_gphySetPortDuplexMode;
+	obj->PHYCTRLObj.gphySetPortAutoMode = &Peridot_gphySetPortAutoModeIntf;
+    obj->PHYCTRLObj.gphySetEEE = &Peridot_gphySetEEE;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = &Peridot_gphySetFlowControlEnable;
+	obj->PHYCTRLObj.gphySetIntEnable = &Peridot_gphySetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntEnable = &Peridot_gphyGetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntStatus = &Peridot_gphyGetIntStatus;
+
+	obj->INTObj.gdevIntEnableSet = &Peridot_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Peridot_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Peridot_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Peridot_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Peridot_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Peridot_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Peridot_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Peridot_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Peridot_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &Peridot_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Peridot_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Peridot_gpirlGetResRegIntf;
+    obj->PIRLObj.gpirlSetResReg = &Peridot_gpirlSetResRegIntf;
+    obj->PIRLObj.gpirlAdvConfig = &Peridot_gpirlAdvConfigIntf;
+    obj->PIRLObj.gpirlAdvConfigDisable = &Peridot_gpirlAdvConfigDisableIntf;
+
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Peridot_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Peridot_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Peridot_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Peridot_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Peridot_gvlnSetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Peridot_gvlnGetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Peridot_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Peridot_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Peridot_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Peridot_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Peridot_gprtSetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Peridot_gprtGetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Peridot_gprtSetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Peridot_gprtGetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Peridot_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Peridot_gprtGetDiscardBCastModeIntf;
+    obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Peridot_gprtSetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Peridot_gprtGetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtSetHeaderMode = &Peridot_gprtSetHeaderMode;
+    obj->PORTCTRLObj.gprtGetHeaderMode = &Peridot_gprtGetHeaderMode;
+    obj->PORTCTRLObj.gprtSetDropOnLock = &Peridot_gprtSetDropOnLock;
+    obj->PORTCTRLObj.gprtGetDropOnLock = &Peridot_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Peridot_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Peridot_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Peridot_gprtSetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtGetLearnEnable = &Peridot_gprtGetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Peridot_gprtSetVTUPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Peridot_gprtGetVTUPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Peridot_gprtSetSAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Peridot_gprtGetSAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Peridot_gprtSetDAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Peridot_gprtGetDAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetMessagePort = &Peridot_gprtSetMessagePort;
+    obj->PORTCTRLObj.gprtGetMessagePort = &Peridot_gprtGetMessagePort;
+    obj->PORTCTRLObj.gprtSetEtherType = &Peridot_gprtSetEtherType;
+    obj->PORTCTRLObj.gprtGetEtherType = &Peridot_gprtGetEtherType;
+    obj->PORTCTRLObj.gprtSetAllowVidZero = &Peridot_gprtSetAllowVidZero;
+    obj->PORTCTRLObj.gprtGetAllowVidZero = &Peridot_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Peridot_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Peridot_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Peridot_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Peridot_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Peridot_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Peridot_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Peridot_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Peridot_grcGetEgressRateIntf;
+    obj->PORTCTRLObj.gprtGetDuplexStatus = &Peridot_gprtGetDuplexStatusIntf;
+    obj->PORTCTRLObj.gprtSetDuplex = &Peridot_gprtSetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetDuplex = &Peridot_gprtGetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetForceLink = &Peridot_gprtGetForceLinkIntf;
+    obj->PORTCTRLObj.gprtSetForceLink = &Peridot_gprtSetForceLinkIntf;
+    obj->PORTCTRLObj.gprtGetLinkState = &Peridot_gprtGetLinkState;
+    obj->PORTCTRLObj.gprtSetForceSpeed = &Peridot_gprtSetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetForceSpeed = &Peridot_gprtGetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetSpeed = &Peridot_gprtGetSpeedIntf;
+    obj->PORTCTRLObj.gprtSetFrameMode = &Peridot_gprtSetFrameModeIntf;
+    obj->PORTCTRLObj.gprtGetFrameMode = &Peridot_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Peridot_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Peridot_gprtGetEgressModeIntf;
+    obj->PORTCTRLObj.gprtSetVlanPorts = &Peridot_gprtSetVlanPorts;
+    obj->PORTCTRLObj.gprtGetVlanPorts = &Peridot_gprtGetVlanPorts;
+    obj->PORTCTRLObj.gprtSetPortState = &Peridot_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Peridot_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtRegDump = &Peridot_gprtRegDump;
+
+    obj->QOSMAPObj.gprtGetIEEEPrioMap = &Peridot_gprtGetIEEEPrioMapIntf;
+    obj->QOSMAPObj.gprtSetIEEEPrioMap = &Peridot_gprtSetIEEEPrioMapIntf;
+    obj->QOSMAPObj.gqosGetPrioMapRule = &Peridot_gqosGetPrioMapRuleIntf;
+    obj->QOSMAPObj.gprtGetInitialPri = &Peridot_gprtGetInitialPriIntf;
+    obj->QOSMAPObj.gprtSetDefQpri = &Peridot_gprtSetDefQpriIntf;
+    obj->QOSMAPObj.gprtGetDefQpri = &Peridot_gprtGetDefQpriIntf;
+    obj->QOSMAPObj.gprtSetDefFpri = &Peridot_gprtSetDefFpri;
+    obj->QOSMAPObj.gprtGetDefFpri = &Peridot_gprtGetDefFpri;
+    obj->QOSMAPObj.gprtSetInitialPri = &Peridot_gprtSetInitialPriIntf;
+    obj->QOSMAPObj.gqosSetPrioMapRule = &Peridot_gqosSetPrioMapRuleIntf;
+    obj->QOSMAPObj.gprtRewriteDscp = &Peridot_gprtRewriteDscp;
+    obj->QOSMAPObj.gprtSetCosToQueue = &Peridot_gprtSetCosToQueue;
+    obj->QOSMAPObj.gprtGetCosToQueue = &Peridot_gprtGetCosToQueue;
+    obj->QOSMAPObj.gprtSetCosToDscp = &Peridot_gprtSetCosToDscp;
+    obj->QOSMAPObj.gprtGetCosToDscp = &Peridot_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Peridot_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Peridot_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Peridot_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Peridot_gstatsGetPortAllCountersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Peridot_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Peridot_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Peridot_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &Peridot_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &Peridot_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &Peridot_gprtSetPortSchedIntf;
+    obj->QUEUEObj.gprtGetPortSched = &Peridot_gprtGetPortSchedIntf;
+    obj->QUEUEObj.gsysSetQoSWeight = &Peridot_gsysSetQoSWeightIntf;
+    obj->QUEUEObj.gsysGetQoSWeight = &Peridot_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Peridot_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Peridot_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetMonitorMgmtCtrl = &Peridot_gsysSetMonitorMgmtCtrl;
+	obj->SYSCTRLObj.gsysGetMonitorMgmtCtrl = &Peridot_gsysGetMonitorMgmtCtrl;
+	obj->SYSCTRLObj.gsysSetCPUDest = &Peridot_gsysSetCPUDest;
+	obj->SYSCTRLObj.gsysGetCPUDest = &Peridot_gsysGetCPUDest;
+	obj->SYSCTRLObj.gsysSetIngressMonitorDest = &Peridot_gsysSetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysGetIngressMonitorDest = &Peridot_gsysGetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Peridot_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Peridot_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetRsvd2CpuEnables = &Peridot_gsysSetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysGetRsvd2CpuEnables = &Peridot_gsysGetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysSetMGMTPri = &Peridot_gsysSetMGMTPri;
+	obj->SYSCTRLObj.gsysGetMGMTPri = &Peridot_gsysGetMGMTPri;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Peridot_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Peridot_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Peridot_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Peridot_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Peridot_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Peridot_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Peridot_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Peridot_gsysQbvRead;
+
+    obj->QAVObj.gqavGetPortQpriXHiLimit = &Peridot_gqavGetPortQpriXHiLimit;
+    obj->QAVObj.gqavSetPortQpriXHiLimit = &Peridot_gqavSetPortQpriXHiLimit;
+    obj->QAVObj.gqavGetPortQpriXRate = &Peridot_gqavGetPortQpriXRate;
+    obj->QAVObj.gqavSetPortQpriXRate = &Peridot_gqavSetPortQpriXRate;
+
+    obj->PTPObj.gptpSetIntEnable = &Peridot_gptpSetIntEnableIntf;
+    obj->PTPObj.gptpGetIntEnable = &Peridot_gptpGetIntEnableIntf;
+    obj->PTPObj.gptpSetProtPTPEn = &Peridot_gptpSetProtPTPEn;
+    obj->PTPObj.gptpGetProtPTPEn = &Peridot_gptpGetProtPTPEn;
+    obj->PTPObj.gptpSetPortConfig = &Peridot_gptpSetPortConfigIntf;
+    obj->PTPObj.gptpGetPortConfig = &Peridot_gptpGetPortConfigIntf;
+    obj->PTPObj.gptpGetTimeStamp = &Peridot_gptpGetTimeStampIntf;
+    obj->PTPObj.gptpGetTSValidSt = &Peridot_gptpGetTSValidSt;
+    obj->PTPObj.gptpResetTimeStamp = &Peridot_gptpResetTimeStamp;
+    obj->PTPObj.gptpSetGlobalConfig = &Peridot_gptpSetGlobalConfigIntf;
+    obj->PTPObj.gptpGetGlobalConfig = &Peridot_gptpGetGlobalConfigIntf;
+    obj->PTPObj.gptpGetIntStatus = &Peridot_gptpGetIntStatusIntf;
+    obj->PTPObj.gptpSetMeanPathDelay = &Peridot_gptpSetMeanPathDelay;
+    obj->PTPObj.gptpGetMeanPathDelay = &Peridot_gptpGetMeanPathDelay;
+    obj->PTPObj.gptpSetIgrPathDelayAsym = &Peridot_gptpSetIgrPathDelayAsym;
+    obj->PTPObj.gptpGetIgrPathDelayAsym = &Peridot_gptpGetIgrPathDelayAsym;
+    obj->PTPObj.gptpSetEgrPathDelayAsym = &Peridot_gptpSetEgrPathDelayAsym;
+    obj->PTPObj.gptpGetEgrPathDelayAsym = &Peridot_gptpGetEgrPathDelayAsym;
+    obj->PTPObj.gptpSetMode = &Peridot_gptpSetModeIntf;
+    obj->PTPObj.gptpGetMode = &Peridot_gptpGetModeIntf;
+    obj->PTPObj.gptpSetMasterSlave = &Peridot_gptpSetMasterSlaveIntf;
+    obj->PTPObj.gptpGetMasterSlave = &Peridot_gptpGetMasterSlaveIntf;
+    obj->PTPObj.gptpGetTODBusyBitStatus = &Peridot_gptpGetTODBusyBitStatus;
+    obj->PTPObj.gptpTODStoreCompensation = &Peridot_gptpTODStoreCompensationIntf;
+    obj->PTPObj.gptpTODStoreAll = &Peridot_gptpTODStoreAllIntf;
+    obj->PTPObj.gptpTODCaptureAll = &Peridot_gptpTODCaptureAllIntf;
+    obj->PTPObj.gptpSetPulse = &Peridot_gptpSetPulseIntf;
+    obj->PTPObj.gptpGetPulse = &Peridot_gptpGetPulseIntf;
+    obj->PTPObj.gtaiGetPTPGlobalTime = &Peridot_gtaiGetPTPGlobalTime;
+
+	obj->TCAMObj.gtcamFlushAll = &Peridot_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &Peridot_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &Peridot_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &Peridot_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &Peridot_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamFindEntry = &Peridot_gtcamFindEntryIntf;
+    obj->TCAMObj.gtcamSetMode = &Peridot_gtcamSetModeIntf;
+    obj->TCAMObj.gtcamGetMode = &Peridot_gtcamGetModeIntf;
+    obj->TCAMObj.gtcamAddEntryPort = &Peridot_gtcamAddEntryPort;
+    obj->TCAMObj.gtcamRemoveEntryPort = &Peridot_gtcamRemoveEntryPort;
+	obj->TCAMObj.gtcamEgrFlushEntry = &Peridot_gtcamEgrFlushEntryIntf;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Peridot_gtcamEgrFlushEntryAllPortsIntf;
+	obj->TCAMObj.gtcamEgrLoadEntry = &Peridot_gtcamEgrLoadEntryIntf;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = &Peridot_gtcamEgrGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamEgrReadTCAMData = &Peridot_gtcamEgrReadTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &Peridot_gtcamDump;
+    obj->TCAMObj.gtcamAdvConfig = &Peridot_gtcamAdvConfigIntf;
+
+	obj->RMUObj.grmuGetID = &Peridot_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Peridot_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Peridot_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuTCAMDump = &Peridot_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &Peridot_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &Peridot_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Peridot_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Peridot_msdRmuRegDump;
+
+    obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Peridot_msdGetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Peridot_msdSetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Peridot_msdGetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Peridot_msdSetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Peridot_msdSetSMIPhyXMDIOReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Peridot_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Peridot_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Peridot_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Peridot_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Peridot_msdGetSMIExtPhyXMDIOReg;
+
+	obj->EEPROMObj.geepromWrite = &Peridot_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Peridot_EEPROMReadIntf;
+
+    obj->LEDObj.gledForceOn = &Peridot_gledForceOnIntf;
+    obj->LEDObj.gledForceOff = &Peridot_gledForceOffIntf;
+    obj->LEDObj.gledLinkAct = &Peridot_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Peridot_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Peridot_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Peridot_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Peridot_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Peridot_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Peridot_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Peridot_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Peridot_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Peridot_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Peridot_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Peridot_gledDump;
 
 #endif
     return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Topaz(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Topaz(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef TOPAZ_BUILD_IN
-    dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Topaz_gfdbAddMacEntryIntf;
-    dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Topaz_gfdbGetAtuEntryNextIntf;
-    dev->SwitchDevObj.ATUObj.gfdbFlush = &Topaz_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Topaz_gfdbFlushInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbMove = &Topaz_gfdbMoveIntf;
-    dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Topaz_gfdbMoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Topaz_gfdbPortRemoveIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Topaz_gfdbPortRemoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Topaz_gfdbDelAtuEntry;
-    dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Topaz_gfdbGetViolationIntf;
-    dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Topaz_gfdbFindAtuMacEntryIntf;
-    dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Topaz_gfdbSetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Topaz_gfdbGetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Topaz_gfdbSetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Topaz_gfdbGetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Topaz_gfdbSetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Topaz_gfdbGetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Topaz_gfdbGetPortLearnCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Topaz_gfdbGetEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Topaz_gfdbGetEntryCountPerFid;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Topaz_gfdbGetNonStaticEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Topaz_gfdbGetNonStaticEntryCountPerFid;
-    dev->SwitchDevObj.ATUObj.gfdbDump = &Topaz_gfdbDump;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable = &Topaz_gprtSetCutThrouthEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable = &Topaz_gprtGetCutThrouthEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Topaz_gprtSetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Topaz_gprtGetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Topaz_gprtSetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Topaz_gprtGetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Topaz_gprtSetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Topaz_gprtGetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Topaz_gprtSetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Topaz_gprtGetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Topaz_gprtGetOutQueueSize;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Topaz_gprtSetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Topaz_gprtGetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Topaz_gprtSetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Topaz_gprtGetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Topaz_gprtSetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Topaz_gprtGetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Topaz_gprtSetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Topaz_gprtGetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Topaz_gprtSetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Topaz_gprtGetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Topaz_gprtSetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Topaz_gprtGetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Topaz_gprtSetARPMirror;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Topaz_gprtGetARPMirror;
-
-    dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = &Topaz_gvctGetAdvCableDiagIntf;
-    dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = &Topaz_gvctGetAdvExtendedStatusIntf;
-
-    dev->SwitchDevObj.STUObj.gstuAddEntry = &Topaz_gstuAddEntryIntf;
-    dev->SwitchDevObj.STUObj.gstuDelEntry = &Topaz_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Topaz_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Topaz_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Topaz_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Topaz_gstuDump;
-
-    dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Topaz_gvtuFindVidEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Topaz_gvtuExistVidEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuFlush = &Topaz_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Topaz_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Topaz_gvtuGetEntryNextIntf;
-    dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Topaz_gvtuDelEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Topaz_gvtuGetViolationIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Topaz_gvtuGetEntryCountIntf;
-    dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Topaz_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Topaz_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Topaz_gvtuDump;
-
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Topaz_gprtGetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Topaz_gprtGetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Topaz_gprtSetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Topaz_gprtSetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Topaz_gprtGetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Topaz_gqosGetPrioMapRule;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Topaz_gprtSetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Topaz_gqosSetPrioMapRuleIntf;
-
-    dev->SwitchDevObj.IMPObj.impRun = &Topaz_impRunIntf;
-    dev->SwitchDevObj.IMPObj.impReset = &Topaz_impResetIntf;
-    dev->SwitchDevObj.IMPObj.impWriteEEPROM = &Topaz_impWriteEEPROMIntf;
-    dev->SwitchDevObj.IMPObj.impLoadToEEPROM = &Topaz_impLoadToEEPROMIntf;
-    dev->SwitchDevObj.IMPObj.impLoadToRAM = &Topaz_impLoadToRAMIntf;
-    dev->SwitchDevObj.IMPObj.impStop = &Topaz_impStopIntf;
-
-    dev->SwitchDevObj.PHYCTRLObj.gphyReset = &Topaz_gphyReset;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Topaz_serdesReset;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = &Topaz_gphySetPortLoopback;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = &Topaz_gphySetPortSpeedIntf;
-    dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = &Topaz_gphyPortPowerDown;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = &Topaz_gphySetPortDuplexMode;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = &Topaz_gphySetPortAutoModeIntf;
-    dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = &Topaz_gphySetEEE;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = &Topaz_gphySetFlowControlEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = &Topaz_gphySetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = &Topaz_gphyGetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = &Topaz_gphyGetIntStatus;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Topaz_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Topaz_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Topaz_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Topaz_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Topaz_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Topaz_gsysActiveIntStatusGet;
-
-    dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Topaz_gpirlInitializeIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Topaz_gpirlInitResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Topaz_gpirlCustomSetupIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Topaz_gpirlReadResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Topaz_gpirlWriteResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Topaz_gpirlGetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Topaz_gpirlSetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Topaz_gpirlAdvConfigIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Topaz_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Topaz_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Topaz_gprtGetForceDefaultVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Topaz_gvlnSetPortVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Topaz_gvlnGetPortVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Topaz_gvlnSetPortVlanDot1qModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Topaz_gvlnGetPortVlanDot1qModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Topaz_gprtSetDiscardTaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Topaz_gprtGetDiscardTaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Topaz_gprtSetDiscardUntaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Topaz_gprtGetDiscardUntaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Topaz_gprtSetUnicastFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Topaz_gprtGetUnicastFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Topaz_gprtSetMulticastFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Topaz_gprtGetMulticastFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Topaz_gprtSetDiscardBCastModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Topaz_gprtGetDiscardBCastModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Topaz_gprtSetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Topaz_gprtGetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Topaz_gprtSetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Topaz_gprtGetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Topaz_gprtSetDropOnLock;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Topaz_gprtGetDropOnLock;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Topaz_gprtSetJumboModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Topaz_gprtGetJumboModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Topaz_gprtSetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Topaz_gprtGetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Topaz_gprtSetVTUPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Topaz_gprtGetVTUPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Topaz_gprtSetSAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Topaz_gprtGetSAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Topaz_gprtSetDAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Topaz_gprtGetDAPriorityOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Topaz_gprtSetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Topaz_gprtGetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Topaz_gprtSetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Topaz_gprtGetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Topaz_gprtSetFlowCtrlIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Topaz_gprtGetFlowCtrlIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Topaz_gprtSetEgressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Topaz_gprtGetEgressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Topaz_gprtSetIngressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Topaz_gprtGetIngressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Topaz_grcSetEgressRateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Topaz_grcGetEgressRateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Topaz_gprtGetDuplexStatusIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Topaz_gprtSetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Topaz_gprtGetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Topaz_gprtGetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Topaz_gprtSetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Topaz_gprtGetLinkState;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Topaz_gprtSetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Topaz_gprtGetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Topaz_gprtGetSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Topaz_gprtSetFrameModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Topaz_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Topaz_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Topaz_gprtGetEgressModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Topaz_gprtSetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Topaz_gprtGetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Topaz_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Topaz_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Topaz_gprtRegDump;
-
-    dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Topaz_gprtSetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Topaz_gprtGetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Topaz_gsysSetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Topaz_gsysGetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Topaz_gsysSetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Topaz_gsysGetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Topaz_gsysSetTrunkRouting;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Topaz_gsysGetTrunkRouting;
-
-    dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Topaz_gstatsFlushAll;
-    dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Topaz_gstatsFlushPort;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Topaz_gstatsGetPortCounterIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Topaz_gstatsGetPortAllCountersIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Topaz_gstatsGetHistogramModeIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Topaz_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Topaz_gmibDump;
-
-    dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Topaz_gprtSetQueueCtrlIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Topaz_gprtGetQueueCtrlIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Topaz_gprtSetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Topaz_gprtGetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Topaz_gsysSetQoSWeightIntf;
-    dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Topaz_gsysGetQoSWeightIntf;
-
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Topaz_gsysSetFloodBC;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Topaz_gsysGetFloodBC;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetMonitorMgmtCtrl = &Topaz_gsysSetMonitorMgmtCtrl;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetMonitorMgmtCtrl = &Topaz_gsysGetMonitorMgmtCtrl;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest = &Topaz_gsysSetCPUDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest = &Topaz_gsysGetCPUDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest = &Topaz_gsysSetIngressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest = &Topaz_gsysGetIngressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Topaz_gsysSetEgressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Topaz_gsysGetEgressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables = &Topaz_gsysSetRsvd2CpuEnables;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables = &Topaz_gsysGetRsvd2CpuEnables;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri = &Topaz_gsysSetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri = &Topaz_gsysGetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Topaz_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Topaz_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Topaz_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Topaz_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Topaz_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Topaz_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Topaz_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Topaz_gsysQbvRead;
-
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Topaz_gqavGetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Topaz_gqavSetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Topaz_gqavGetPortQpriXRate;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Topaz_gqavSetPortQpriXRate;
-    dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Topaz_gtcamSetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Topaz_gtcamGetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Topaz_gtcamAddEntryPort;
-    dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Topaz_gtcamRemoveEntryPort;
-
-    dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Topaz_gptpSetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Topaz_gptpGetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Topaz_gptpSetProtPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Topaz_gptpGetProtPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpSetPortConfig = &Topaz_gptpSetPortConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetPortConfig = &Topaz_gptpGetPortConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Topaz_gptpGetTimeStampIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Topaz_gptpGetTSValidSt;
-    dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Topaz_gptpResetTimeStamp;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = &Topaz_gptpSetGlobalConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = &Topaz_gptpGetGlobalConfigIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Topaz_gptpGetIntStatusIntf;
+    obj->ATUObj.gfdbAddMacEntry = &Topaz_gfdbAddMacEntryIntf;
+    obj->ATUObj.gfdbGetAtuEntryNext = &Topaz_gfdbGetAtuEntryNextIntf;
+    obj->ATUObj.gfdbFlush = &Topaz_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Topaz_gfdbFlushInDBIntf;
+    obj->ATUObj.gfdbMove = &Topaz_gfdbMoveIntf;
+    obj->ATUObj.gfdbMoveInDB = &Topaz_gfdbMoveInDBIntf;
+    obj->ATUObj.gfdbPortRemove = &Topaz_gfdbPortRemoveIntf;
+    obj->ATUObj.gfdbPortRemoveInDB = &Topaz_gfdbPortRemoveInDBIntf;
+    obj->ATUObj.gfdbDelAtuEntry = &Topaz_gfdbDelAtuEntry;
+    obj->ATUObj.gfdbGetViolation = &Topaz_gfdbGetViolationIntf;
+    obj->ATUObj.gfdbFindAtuMacEntry = &Topaz_gfdbFindAtuMacEntryIntf;
+    obj->ATUObj.gfdbSetAgingTimeout = &Topaz_gfdbSetAgingTimeout;
+    obj->ATUObj.gfdbGetAgingTimeout = &Topaz_gfdbGetAgingTimeout;
+    obj->ATUObj.gfdbSetLearn2All = &Topaz_gfdbSetLearn2All;
+    obj->ATUObj.gfdbGetLearn2All = &Topaz_gfdbGetLearn2All;
+    obj->ATUObj.gfdbSetPortLearnLimit = &Topaz_gfdbSetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnLimit = &Topaz_gfdbGetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnCount = &Topaz_gfdbGetPortLearnCount;
+    obj->ATUObj.gfdbGetEntryCount = &Topaz_gfdbGetEntryCount;
+    obj->ATUObj.gfdbGetEntryCountPerFid = &Topaz_gfdbGetEntryCountPerFid;
+    obj->ATUObj.gfdbGetNonStaticEntryCount = &Topaz_gfdbGetNonStaticEntryCount;
+    obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Topaz_gfdbGetNonStaticEntryCountPerFid;
+    obj->ATUObj.gfdbDump = &Topaz_gfdbDump;
+    obj->PORTCTRLObj.gprtSetCutThrouthEnable = &Topaz_gprtSetCutThrouthEnableIntf;
+    obj->PORTCTRLObj.gprtGetCutThrouthEnable = &Topaz_gprtGetCutThrouthEnableIntf;
+    obj->PORTCTRLObj.gprtSetIgnoreFcs = &Topaz_gprtSetIgnoreFcs;
+    obj->PORTCTRLObj.gprtGetIgnoreFcs = &Topaz_gprtGetIgnoreFcs;
+    obj->PORTCTRLObj.gprtSetAllowBadFcs = &Topaz_gprtSetAllowBadFcs;
+    obj->PORTCTRLObj.gprtGetAllowBadFcs = &Topaz_gprtGetAllowBadFcs;
+    obj->PORTCTRLObj.gprtSetPauseLimitOut = &Topaz_gprtSetPauseLimitOut;
+    obj->PORTCTRLObj.gprtGetPauseLimitOut = &Topaz_gprtGetPauseLimitOut;
+    obj->PORTCTRLObj.gprtSetPauseLimitIn = &Topaz_gprtSetPauseLimitIn;
+    obj->PORTCTRLObj.gprtGetPauseLimitIn = &Topaz_gprtGetPauseLimitIn;
+    obj->PORTCTRLObj.gprtGetOutQueueSize = &Topaz_gprtGetOutQueueSize;
+    obj->PORTCTRLObj.gprtSetMapDA = &Topaz_gprtSetMapDA;
+    obj->PORTCTRLObj.gprtGetMapDA = &Topaz_gprtGetMapDA;
+    obj->PORTCTRLObj.gprtSetPortLocked = &Topaz_gprtSetPortLocked;
+    obj->PORTCTRLObj.gprtGetPortLocked = &Topaz_gprtGetPortLocked;
+    obj->PORTCTRLObj.gprtSetHoldAt1 = &Topaz_gprtSetHoldAt1;
+    obj->PORTCTRLObj.gprtGetHoldAt1 = &Topaz_gprtGetHoldAt1;
+    obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Topaz_gprtSetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Topaz_gprtGetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtSetRefreshLocked = &Topaz_gprtSetRefreshLocked;
+    obj->PORTCTRLObj.gprtGetRefreshLocked = &Topaz_gprtGetRefreshLocked;
+    obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Topaz_gprtSetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Topaz_gprtGetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtSetARPMirror = &Topaz_gprtSetARPMirror;
+    obj->PORTCTRLObj.gprtGetARPMirror = &Topaz_gprtGetARPMirror;
+
+    obj->VCTObj.gvctGetAdvCableDiag = &Topaz_gvctGetAdvCableDiagIntf;
+    obj->VCTObj.gvctGetAdvExtendedStatus = &Topaz_gvctGetAdvExtendedStatusIntf;
+
+    obj->STUObj.gstuAddEntry = &Topaz_gstuAddEntryIntf;
+    obj->STUObj.gstuDelEntry = &Topaz_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Topaz_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Topaz_gstuGetEntryNextIntf;
+	obj->STUObj.gstuGetEntryCount = &Topaz_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Topaz_gstuDump;
+
+    obj->VTUObj.gvtuFindVidEntry = &Topaz_gvtuFindVidEntryIntf;
+    obj->VTUObj.gvtuExistVidEntry = &Topaz_gvtuExistVidEntryIntf;
+    obj->VTUObj.gvtuFlush = &Topaz_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Topaz_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Topaz_gvtuGetEntryNextIntf;
+    obj->VTUObj.gvtuDelEntry = &Topaz_gvtuDelEntryIntf;
+    obj->VTUObj.gvtuGetViolation = &Topaz_gvtuGetViolationIntf;
+    obj->VTUObj.gvtuGetEntryCount = &Topaz_gvtuGetEntryCountIntf;
+    obj->VTUObj.gvtuSetMemberTag = &Topaz_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Topaz_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Topaz_gvtuDump;
+
+    obj->QOSMAPObj.gprtGetDefQpri = &Topaz_gprtGetDefQpriIntf;
+    obj->QOSMAPObj.gprtGetInitialPri = &Topaz_gprtGetInitialPriIntf;
+    obj->QOSMAPObj.gprtSetDefQpri = &Topaz_gprtSetDefQpriIntf;
+    obj->QOSMAPObj.gprtSetDefFpri = &Topaz_gprtSetDefFpri;
+    obj->QOSMAPObj.gprtGetDefFpri = &Topaz_gprtGetDefFpri;
+    obj->QOSMAPObj.gqosGetPrioMapRule = &Topaz_gqosGetPrioMapRule;
+    obj->QOSMAPObj.gprtSetInitialPri = &Topaz_gprtSetInitialPriIntf;
+    obj->QOSMAPObj.gqosSetPrioMapRule = &Topaz_gqosSetPrioMapRuleIntf;
+
+    obj->IMPObj.impRun = &Topaz_impRunIntf;
+    obj->IMPObj.impReset = &Topaz_impResetIntf;
+    obj->IMPObj.impWriteEEPROM = &Topaz_impWriteEEPROMIntf;
+    obj->IMPObj.impLoadToEEPROM = &Topaz_impLoadToEEPROMIntf;
+    obj->IMPObj.impLoadToRAM = &Topaz_impLoadToRAMIntf;
+    obj->IMPObj.impStop = &Topaz_impStopIntf;
+
+    obj->PHYCTRLObj.gphyReset = &Topaz_gphyReset;
+    obj->PHYCTRLObj.serdesReset = &Topaz_serdesReset;
+    obj->PHYCTRLObj.gphySetPortLoopback = &Topaz_gphySetPortLoopback;
+    obj->PHYCTRLObj.gphySetPortSpeed = &Topaz_gphySetPortSpeedIntf;
+    obj->PHYCTRLObj.gphyPortPowerDown = &Topaz_gphyPortPowerDown;
+    obj->PHYCTRLObj.gphySetPortDuplexMode = &Topaz_gphySetPortDuplexMode;
+    obj->PHYCTRLObj.gphySetPortAutoMode = &Topaz_gphySetPortAutoModeIntf;
+    obj->PHYCTRLObj.gphySetEEE = &Topaz_gphySetEEE;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = &Topaz_gphySetFlowControlEnable;
+	obj->PHYCTRLObj.gphySetIntEnable = &Topaz_gphySetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntEnable = &Topaz_gphyGetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntStatus = &Topaz_gphyGetIntStatus;
+
+	obj->INTObj.gdevIntEnableSet = &Topaz_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Topaz_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Topaz_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Topaz_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Topaz_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Topaz_gsysActiveIntStatusGet;
+
+    obj->PIRLObj.gpirlInitialize = &Topaz_gpirlInitializeIntf;
+    obj->PIRLObj.gpirlInitResource = &Topaz_gpirlInitResourceIntf;
+    obj->PIRLObj.gpirlCustomSetup = &Topaz_gpirlCustomSetupIntf;
+    obj->PIRLObj.gpirlReadResource = &Topaz_gpirlReadResourceIntf;
+    obj->PIRLObj.gpirlWriteResource = &Topaz_gpirlWriteResourceIntf;
+    obj->PIRLObj.gpirlGetResReg = &Topaz_gpirlGetResRegIntf;
+    obj->PIRLObj.gpirlSetResReg = &Topaz_gpirlSetResRegIntf;
+    obj->PIRLObj.gpirlAdvConfig = &Topaz_gpirlAdvConfigIntf;
+    obj->PIRLObj.gpirlAdvConfigDisable = &Topaz_gpirlAdvConfigDisableIntf;
+
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Topaz_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Topaz_gprtGetForceDefaultVid;
+    obj->PORTCTRLObj.gvlnSetPortVid = &Topaz_gvlnSetPortVid;
+    obj->PORTCTRLObj.gvlnGetPortVid = &Topaz_gvlnGetPortVid;
+    obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Topaz_gvlnSetPortVlanDot1qModeIntf;
+    obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Topaz_gvlnGetPortVlanDot1qModeIntf;
+    obj->PORTCTRLObj.gprtSetDiscardTagged = &Topaz_gprtSetDiscardTaggedIntf;
+    obj->PORTCTRLObj.gprtGetDiscardTagged = &Topaz_gprtGetDiscardTaggedIntf;
+    obj->PORTCTRLObj.gprtSetDiscardUntagged = &Topaz_gprtSetDiscardUntaggedIntf;
+    obj->PORTCTRLObj.gprtGetDiscardUntagged = &Topaz_gprtGetDiscardUntaggedIntf;
+    obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Topaz_gprtSetUnicastFloodBlockIntf;
+    obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Topaz_gprtGetUnicastFloodBlockIntf;
+    obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Topaz_gprtSetMulticastFloodBlockIntf;
+    obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Topaz_gprtGetMulticastFloodBlockIntf;
+    obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Topaz_gprtSetDiscardBCastModeIntf;
+    obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Topaz_gprtGetDiscardBCastModeIntf;
+    obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Topaz_gprtSetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Topaz_gprtGetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtSetHeaderMode = &Topaz_gprtSetHeaderMode;
+    obj->PORTCTRLObj.gprtGetHeaderMode = &Topaz_gprtGetHeaderMode;
+    obj->PORTCTRLObj.gprtSetDropOnLock = &Topaz_gprtSetDropOnLock;
+    obj->PORTCTRLObj.gprtGetDropOnLock = &Topaz_gprtGetDropOnLock;
+    obj->PORTCTRLObj.gprtSetJumboMode = &Topaz_gprtSetJumboModeIntf;
+    obj->PORTCTRLObj.gprtGetJumboMode = &Topaz_gprtGetJumboModeIntf;
+    obj->PORTCTRLObj.gprtSetLearnEnable = &Topaz_gprtSetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtGetLearnEnable = &Topaz_gprtGetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Topaz_gprtSetVTUPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Topaz_gprtGetVTUPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Topaz_gprtSetSAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Topaz_gprtGetSAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Topaz_gprtSetDAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Topaz_gprtGetDAPriorityOverrideIntf;
+    obj->PORTCTRLObj.gprtSetMessagePort = &Topaz_gprtSetMessagePort;
+    obj->PORTCTRLObj.gprtGetMessagePort = &Topaz_gprtGetMessagePort;
+    obj->PORTCTRLObj.gprtSetEtherType = &Topaz_gprtSetEtherType;
+    obj->PORTCTRLObj.gprtGetEtherType = &Topaz_gprtGetEtherType;
+    obj->PORTCTRLObj.gprtSetFlowCtrl = &Topaz_gprtSetFlowCtrlIntf;
+    obj->PORTCTRLObj.gprtGetFlowCtrl = &Topaz_gprtGetFlowCtrlIntf;
+    obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Topaz_gprtSetEgressMonitorSource;
+    obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Topaz_gprtGetEgressMonitorSource;
+    obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Topaz_gprtSetIngressMonitorSource;
+    obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Topaz_gprtGetIngressMonitorSource;
+    obj->PORTCTRLObj.grcSetEgressRate = &Topaz_grcSetEgressRateIntf;
+    obj->PORTCTRLObj.grcGetEgressRate = &Topaz_grcGetEgressRateIntf;
+    obj->PORTCTRLObj.gprtGetDuplexStatus = &Topaz_gprtGetDuplexStatusIntf;
+    obj->PORTCTRLObj.gprtSetDuplex = &Topaz_gprtSetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetDuplex = &Topaz_gprtGetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetForceLink = &Topaz_gprtGetForceLinkIntf;
+    obj->PORTCTRLObj.gprtSetForceLink = &Topaz_gprtSetForceLinkIntf;
+    obj->PORTCTRLObj.gprtGetLinkState = &Topaz_gprtGetLinkState;
+    obj->PORTCTRLObj.gprtSetForceSpeed = &Topaz_gprtSetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetForceSpeed = &Topaz_gprtGetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetSpeed = &Topaz_gprtGetSpeedIntf;
+    obj->PORTCTRLObj.gprtSetFrameMode = &Topaz_gprtSetFrameModeIntf;
+    obj->PORTCTRLObj.gprtGetFrameMode = &Topaz_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Topaz_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Topaz_gprtGetEgressModeIntf;
+    obj->PORTCTRLObj.gprtSetVlanPorts = &Topaz_gprtSetVlanPorts;
+    obj->PORTCTRLObj.gprtGetVlanPorts = &Topaz_gprtGetVlanPorts;
+    obj->PORTCTRLObj.gprtSetPortState = &Topaz_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Topaz_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtRegDump = &Topaz_gprtRegDump;
+
+    obj->TrunkObj.gprtSetTrunkPort = &Topaz_gprtSetTrunkPort;
+    obj->TrunkObj.gprtGetTrunkPort = &Topaz_gprtGetTrunkPort;
+    obj->TrunkObj.gsysSetTrunkMaskTable = &Topaz_gsysSetTrunkMaskTable;
+    obj->TrunkObj.gsysGetTrunkMaskTable = &Topaz_gsysGetTrunkMaskTable;
+    obj->TrunkObj.gsysSetHashTrunk = &Topaz_gsysSetHashTrunk;
+    obj->TrunkObj.gsysGetHashTrunk = &Topaz_gsysGetHashTrunk;
+    obj->TrunkObj.gsysSetTrunkRouting = &Topaz_gsysSetTrunkRouting;
+    obj->TrunkObj.gsysGetTrunkRouting = &Topaz_gsysGetTrunkRouting;
+
+    obj->PORTRMONObj.gstatsFlushAll = &Topaz_gstatsFlushAll;
+    obj->PORTRMONObj.gstatsFlushPort = &Topaz_gstatsFlushPort;
+    obj->PORTRMONObj.gstatsGetPortCounter = &Topaz_gstatsGetPortCounterIntf;
+    obj->PORTRMONObj.gstatsGetPortAllCounters = &Topaz_gstatsGetPortAllCountersIntf;
+    obj->PORTRMONObj.gstatsGetHistogramMode = &Topaz_gstatsGetHistogramModeIntf;
+    obj->PORTRMONObj.gstatsSetHistogramMode = &Topaz_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Topaz_gmibDump;
+
+    obj->QUEUEObj.gprtSetQueueCtrl = &Topaz_gprtSetQueueCtrlIntf;
+    obj->QUEUEObj.gprtGetQueueCtrl = &Topaz_gprtGetQueueCtrlIntf;
+    obj->QUEUEObj.gprtSetPortSched = &Topaz_gprtSetPortSchedIntf;
+    obj->QUEUEObj.gprtGetPortSched = &Topaz_gprtGetPortSchedIntf;
+    obj->QUEUEObj.gsysSetQoSWeight = &Topaz_gsysSetQoSWeightIntf;
+    obj->QUEUEObj.gsysGetQoSWeight = &Topaz_gsysGetQoSWeightIntf;
+
+    obj->SYSCTRLObj.gsysSetFloodBC = &Topaz_gsysSetFloodBC;
+    obj->SYSCTRLObj.gsysGetFloodBC = &Topaz_gsysGetFloodBC;
+    obj->SYSCTRLObj.gsysSetMonitorMgmtCtrl = &Topaz_gsysSetMonitorMgmtCtrl;
+    obj->SYSCTRLObj.gsysGetMonitorMgmtCtrl = &Topaz_gsysGetMonitorMgmtCtrl;
+    obj->SYSCTRLObj.gsysSetCPUDest = &Topaz_gsysSetCPUDest;
+    obj->SYSCTRLObj.gsysGetCPUDest = &Topaz_gsysGetCPUDest;
+    obj->SYSCTRLObj.gsysSetIngressMonitorDest = &Topaz_gsysSetIngressMonitorDest;
+    obj->SYSCTRLObj.gsysGetIngressMonitorDest = &Topaz_gsysGetIngressMonitorDest;
+    obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Topaz_gsysSetEgressMonitorDest;
+    obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Topaz_gsysGetEgressMonitorDest;
+    obj->SYSCTRLObj.gsysSetRsvd2CpuEnables = &Topaz_gsysSetRsvd2CpuEnables;
+    obj->SYSCTRLObj.gsysGetRsvd2CpuEnables = &Topaz_gsysGetRsvd2CpuEnables;
+    obj->SYSCTRLObj.gsysSetMGMTPri = &Topaz_gsysSetMGMTPri;
+	obj->SYSCTRLObj.gsysGetMGMTPri = &Topaz_gsysGetMGMTPri;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Topaz_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Topaz_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Topaz_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Topaz_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Topaz_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Topaz_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Topaz_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Topaz_gsysQbvRead;
+
+    obj->QAVObj.gqavGetPortQpriXHiLimit = &Topaz_gqavGetPortQpriXHiLimit;
+    obj->QAVObj.gqavSetPortQpriXHiLimit = &Topaz_gqavSetPortQpriXHiLimit;
+    obj->QAVObj.gqavGetPortQpriXRate = &Topaz_gqavGetPortQpriXRate;
+    obj->QAVObj.gqavSetPortQpriXRate = &Topaz_gqavSetPortQpriXRate;
+    obj->TCAMObj.gtcamSetMode = &Topaz_gtcamSetModeIntf;
+    obj->TCAMObj.gtcamGetMode = &Topaz_gtcamGetModeIntf;
+    obj->TCAMObj.gtcamAddEntryPort = &Topaz_gtcamAddEntryPort;
+    obj->TCAMObj.gtcamRemoveEntryPort = &Topaz_gtcamRemoveEntryPort;
+
+    obj->PTPObj.gptpSetIntEnable = &Topaz_gptpSetIntEnableIntf;
+    obj->PTPObj.gptpGetIntEnable = &Topaz_gptpGetIntEnableIntf;
+    obj->PTPObj.gptpSetProtPTPEn = &Topaz_gptpSetProtPTPEn;
+    obj->PTPObj.gptpGetProtPTPEn = &Topaz_gptpGetProtPTPEn;
+    obj->PTPObj.gptpSetPortConfig = &Topaz_gptpSetPortConfigIntf;
+    obj->PTPObj.gptpGetPortConfig = &Topaz_gptpGetPortConfigIntf;
+    obj->PTPObj.gptpGetTimeStamp = &Topaz_gptpGetTimeStampIntf;
+    obj->PTPObj.gptpGetTSValidSt = &Topaz_gptpGetTSValidSt;
+    obj->PTPObj.gptpResetTimeStamp = &Topaz_gptpResetTimeStamp;
+    obj->PTPObj.gptpSetGlobalConfig = &Topaz_gptpSetGlobalConfigIntf;
+    obj->PTPObj.gptpGetGlobalConfig = &Topaz_gptpGetGlobalConfigIntf;
+    obj->PTPObj.gptpGetIntStatus = &Topaz_gptpGetIntStatusIntf;
 
 	if (dev->deviceId != MSD_88E6141)
     {
-        dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Topaz_gtcamFindEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Topaz_gtcamFlushAll;
-		dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Topaz_gtcamFlushEntry;
-		dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Topaz_gtcamLoadEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Topaz_gtcamReadTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Topaz_gtcamGetNextTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamDump = &Topaz_gtcamDump;
-        dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Topaz_gtcamAdvConfigIntf;
+        obj->TCAMObj.gtcamFindEntry = &Topaz_gtcamFindEntryIntf;
+		obj->TCAMObj.gtcamFlushAll = &Topaz_gtcamFlushAll;
+		obj->TCAMObj.gtcamFlushEntry = &Topaz_gtcamFlushEntry;
+		obj->TCAMObj.gtcamLoadEntry = &Topaz_gtcamLoadEntryIntf;
+		obj->TCAMObj.gtcamReadTCAMData = &Topaz_gtcamReadTCAMDataIntf;
+		obj->TCAMObj.gtcamGetNextTCAMData = &Topaz_gtcamGetNextTCAMDataIntf;
+		obj->TCAMObj.gtcamDump = &Topaz_gtcamDump;
+        obj->TCAMObj.gtcamAdvConfig = &Topaz_gtcamAdvConfigIntf;
 	}
 	/* Topaz deviceId MSD_88E6141 doesn't support TCAM and AVB */
 
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Topaz_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Topaz_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Topaz_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Topaz_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Topaz_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Topaz_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Topaz_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Topaz_msdRmuRegDump;
-
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Topaz_msdGetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Topaz_msdSetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Topaz_msdGetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Topaz_msdSetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Topaz_msdSetSMIPhyXMDIOReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Topaz_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Topaz_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Topaz_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Topaz_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Topaz_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Topaz_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Topaz_EEPROMReadIntf;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Topaz_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Topaz_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &Topaz_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Topaz_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Topaz_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Topaz_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Topaz_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Topaz_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Topaz_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Topaz_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Topaz_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Topaz_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Topaz_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Topaz_gledDump;
+	obj->RMUObj.grmuGetID = &Topaz_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Topaz_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Topaz_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuTCAMDump = &Topaz_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &Topaz_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &Topaz_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Topaz_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Topaz_msdRmuRegDump;
+
+    obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Topaz_msdGetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Topaz_msdSetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Topaz_msdGetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Topaz_msdSetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Topaz_msdSetSMIPhyXMDIOReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Topaz_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Topaz_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Topaz_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Topaz_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Topaz_msdGetSMIExtPhyXMDIOReg;
+
+	obj->EEPROMObj.geepromWrite = &Topaz_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Topaz_EEPROMReadIntf;
+
+	obj->LEDObj.gledForceOn = &Topaz_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Topaz_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &Topaz_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Topaz_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Topaz_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Topaz_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Topaz_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Topaz_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Topaz_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Topaz_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Topaz_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Topaz_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Topaz_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Topaz_gledDump;
 
 #endif
     return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Pearl(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Pearl(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef PEARL_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Pearl_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Pearl_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Pearl_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Pearl_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Pearl_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Pearl_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Pearl_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Pearl_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Pearl_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Pearl_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Pearl_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Pearl_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Pearl_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Pearl_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Pearl_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Pearl_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Pearl_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Pearl_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Pearl_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Pearl_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Pearl_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Pearl_gfdbGetNonStaticEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Pearl_gfdbDump;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Pearl_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Pearl_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Pearl_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Pearl_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Pearl_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Pearl_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Pearl_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Pearl_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Pearl_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Pearl_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Pearl_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Pearl_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Pearl_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Pearl_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Pearl_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Pearl_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Pearl_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Pearl_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Pearl_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Pearl_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Pearl_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Pearl_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Pearl_gprtGetARPMirror;
-
-	dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = &Pearl_gvctGetAdvCableDiagIntf;
-	dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = &Pearl_gvctGetAdvExtendedStatusIntf;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Pearl_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Pearl_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Pearl_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Pearl_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Pearl_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Pearl_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Pearl_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Pearl_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Pearl_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Pearl_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Pearl_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Pearl_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Pearl_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Pearl_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Pearl_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Pearl_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Pearl_gvtuDump;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Pearl_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Pearl_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Pearl_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Pearl_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Pearl_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Pearl_gqosGetPrioMapRule;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Pearl_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Pearl_gqosSetPrioMapRuleIntf;
-
-	dev->SwitchDevObj.PHYCTRLObj.gphyReset = &Pearl_gphyReset;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Pearl_serdesReset;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = &Pearl_gphySetPortLoopback;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = &Pearl_gphySetPortSpeedIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = &Pearl_gphyPortPowerDown;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = &Pearl_gphySetPortDuplexMode;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = &Pearl_gphySetPortAutoModeIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = &Pearl_gphySetEEE;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = &Pearl_gphySetFlowControlEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = &Pearl_gphySetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = &Pearl_gphyGetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = &Pearl_gphyGetIntStatus;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Pearl_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Pearl_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Pearl_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Pearl_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Pearl_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Pearl_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Pearl_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Pearl_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Pearl_gpirlCustomSetupIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Pearl_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Pearl_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Pearl_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Pearl_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Pearl_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Pearl_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Pearl_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Pearl_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Pearl_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Pearl_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Pearl_gvlnSetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Pearl_gvlnGetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Pearl_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Pearl_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Pearl_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Pearl_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Pearl_gprtSetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Pearl_gprtGetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Pearl_gprtSetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Pearl_gprtGetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Pearl_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Pearl_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Pearl_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Pearl_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Pearl_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Pearl_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Pearl_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Pearl_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Pearl_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Pearl_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Pearl_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Pearl_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Pearl_gprtSetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Pearl_gprtGetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Pearl_gprtSetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Pearl_gprtGetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Pearl_gprtSetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Pearl_gprtGetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Pearl_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Pearl_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Pearl_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Pearl_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Pearl_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Pearl_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Pearl_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Pearl_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Pearl_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Pearl_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Pearl_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Pearl_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Pearl_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Pearl_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Pearl_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Pearl_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Pearl_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Pearl_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Pearl_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Pearl_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Pearl_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Pearl_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Pearl_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Pearl_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Pearl_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Pearl_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Pearl_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Pearl_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Pearl_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Pearl_gprtRegDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Pearl_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Pearl_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Pearl_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Pearl_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Pearl_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Pearl_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Pearl_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Pearl_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Pearl_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Pearl_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Pearl_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Pearl_gstatsGetPortAllCountersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Pearl_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Pearl_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Pearl_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Pearl_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Pearl_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Pearl_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Pearl_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Pearl_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Pearl_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest = &Pearl_gsysSetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest = &Pearl_gsysGetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest = &Pearl_gsysSetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest = &Pearl_gsysGetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Pearl_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Pearl_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri = &Pearl_gsysSetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri = &Pearl_gsysGetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables = &Pearl_gsysSetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables = &Pearl_gsysGetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Pearl_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Pearl_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Pearl_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Pearl_gsysGetRMUMode;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Pearl_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Pearl_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Pearl_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Pearl_gqavSetPortQpriXRate;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Pearl_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Pearl_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Pearl_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Pearl_gtcamRemoveEntryPort;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Pearl_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Pearl_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Pearl_gptpSetProtPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Pearl_gptpGetProtPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpSetPortConfig = &Pearl_gptpSetPortConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPortConfig = &Pearl_gptpGetPortConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Pearl_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Pearl_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Pearl_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = &Pearl_gptpSetGlobalConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = &Pearl_gptpGetGlobalConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Pearl_gptpGetIntStatusIntf;
+	obj->ATUObj.gfdbAddMacEntry = &Pearl_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Pearl_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Pearl_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Pearl_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Pearl_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Pearl_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Pearl_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Pearl_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Pearl_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Pearl_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Pearl_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Pearl_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Pearl_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Pearl_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Pearl_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Pearl_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Pearl_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Pearl_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Pearl_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Pearl_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Pearl_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Pearl_gfdbGetNonStaticEntryCountPerFid;
+	obj->ATUObj.gfdbDump = &Pearl_gfdbDump;
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Pearl_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Pearl_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Pearl_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Pearl_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Pearl_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Pearl_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Pearl_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Pearl_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Pearl_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Pearl_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Pearl_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Pearl_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Pearl_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Pearl_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Pearl_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Pearl_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Pearl_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Pearl_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Pearl_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Pearl_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Pearl_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Pearl_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Pearl_gprtGetARPMirror;
+
+	obj->VCTObj.gvctGetAdvCableDiag = &Pearl_gvctGetAdvCableDiagIntf;
+	obj->VCTObj.gvctGetAdvExtendedStatus = &Pearl_gvctGetAdvExtendedStatusIntf;
+
+	obj->STUObj.gstuAddEntry = &Pearl_gstuAddEntryIntf;
+	obj->STUObj.gstuDelEntry = &Pearl_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Pearl_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Pearl_gstuGetEntryNextIntf;
+	obj->STUObj.gstuGetEntryCount = &Pearl_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Pearl_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Pearl_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Pearl_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Pearl_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Pearl_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Pearl_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Pearl_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuGetViolation = &Pearl_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Pearl_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Pearl_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Pearl_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Pearl_gvtuDump;
+
+	obj->QOSMAPObj.gprtGetDefQpri = &Pearl_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Pearl_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Pearl_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Pearl_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Pearl_gprtGetDefFpri;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Pearl_gqosGetPrioMapRule;
+	obj->QOSMAPObj.gprtSetInitialPri = &Pearl_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Pearl_gqosSetPrioMapRuleIntf;
+
+	obj->PHYCTRLObj.gphyReset = &Pearl_gphyReset;
+    obj->PHYCTRLObj.serdesReset = &Pearl_serdesReset;
+	obj->PHYCTRLObj.gphySetPortLoopback = &Pearl_gphySetPortLoopback;
+	obj->PHYCTRLObj.gphySetPortSpeed = &Pearl_gphySetPortSpeedIntf;
+	obj->PHYCTRLObj.gphyPortPowerDown = &Pearl_gphyPortPowerDown;
+	obj->PHYCTRLObj.gphySetPortDuplexMode = &Pearl_gphySetPortDuplexMode;
+	obj->PHYCTRLObj.gphySetPortAutoMode = &Pearl_gphySetPortAutoModeIntf;
+	obj->PHYCTRLObj.gphySetEEE = &Pearl_gphySetEEE;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = &Pearl_gphySetFlowControlEnable;
+	obj->PHYCTRLObj.gphySetIntEnable = &Pearl_gphySetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntEnable = &Pearl_gphyGetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntStatus = &Pearl_gphyGetIntStatus;
+
+	obj->INTObj.gdevIntEnableSet = &Pearl_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Pearl_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Pearl_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Pearl_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Pearl_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Pearl_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Pearl_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Pearl_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Pearl_gpirlCustomSetupIntf;
+	obj->PIRLObj.gpirlReadResource = &Pearl_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Pearl_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Pearl_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Pearl_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Pearl_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Pearl_gpirlAdvConfigDisableIntf;
+
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Pearl_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Pearl_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Pearl_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Pearl_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Pearl_gvlnSetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Pearl_gvlnGetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Pearl_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Pearl_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Pearl_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Pearl_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Pearl_gprtSetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Pearl_gprtGetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Pearl_gprtSetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Pearl_gprtGetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Pearl_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Pearl_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Pearl_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Pearl_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Pearl_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Pearl_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Pearl_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Pearl_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Pearl_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Pearl_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Pearl_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Pearl_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Pearl_gprtSetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Pearl_gprtGetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Pearl_gprtSetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Pearl_gprtGetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Pearl_gprtSetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Pearl_gprtGetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Pearl_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Pearl_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Pearl_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Pearl_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Pearl_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Pearl_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Pearl_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Pearl_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Pearl_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Pearl_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Pearl_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Pearl_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Pearl_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Pearl_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Pearl_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Pearl_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Pearl_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Pearl_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Pearl_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Pearl_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Pearl_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Pearl_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Pearl_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Pearl_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Pearl_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Pearl_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Pearl_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Pearl_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Pearl_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtRegDump = &Pearl_gprtRegDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Pearl_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Pearl_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Pearl_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Pearl_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Pearl_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Pearl_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Pearl_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Pearl_gsysGetTrunkRouting;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Pearl_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Pearl_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Pearl_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Pearl_gstatsGetPortAllCountersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Pearl_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Pearl_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Pearl_gmibDump;
+
+	obj->QUEUEObj.gprtSetPortSched = &Pearl_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Pearl_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &Pearl_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &Pearl_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Pearl_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Pearl_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetCPUDest = &Pearl_gsysSetCPUDest;
+	obj->SYSCTRLObj.gsysGetCPUDest = &Pearl_gsysGetCPUDest;
+	obj->SYSCTRLObj.gsysSetIngressMonitorDest = &Pearl_gsysSetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysGetIngressMonitorDest = &Pearl_gsysGetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Pearl_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Pearl_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetMGMTPri = &Pearl_gsysSetMGMTPri;
+	obj->SYSCTRLObj.gsysGetMGMTPri = &Pearl_gsysGetMGMTPri;
+	obj->SYSCTRLObj.gsysSetRsvd2CpuEnables = &Pearl_gsysSetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysGetRsvd2CpuEnables = &Pearl_gsysGetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Pearl_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Pearl_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Pearl_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Pearl_gsysGetRMUMode;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &Pearl_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &Pearl_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &Pearl_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &Pearl_gqavSetPortQpriXRate;
+	obj->TCAMObj.gtcamSetMode = &Pearl_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &Pearl_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &Pearl_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &Pearl_gtcamRemoveEntryPort;
+
+	obj->PTPObj.gptpSetIntEnable = &Pearl_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &Pearl_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &Pearl_gptpSetProtPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &Pearl_gptpGetProtPTPEn;
+	obj->PTPObj.gptpSetPortConfig = &Pearl_gptpSetPortConfigIntf;
+	obj->PTPObj.gptpGetPortConfig = &Pearl_gptpGetPortConfigIntf;
+	obj->PTPObj.gptpGetTimeStamp = &Pearl_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &Pearl_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &Pearl_gptpResetTimeStamp;
+	obj->PTPObj.gptpSetGlobalConfig = &Pearl_gptpSetGlobalConfigIntf;
+	obj->PTPObj.gptpGetGlobalConfig = &Pearl_gptpGetGlobalConfigIntf;
+	obj->PTPObj.gptpGetIntStatus = &Pearl_gptpGetIntStatusIntf;
 
 	if (dev->deviceId != MSD_88E6320)
 	{
-		dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Pearl_gtcamFindEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Pearl_gtcamFlushAll;
-		dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Pearl_gtcamFlushEntry;
-		dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Pearl_gtcamLoadEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Pearl_gtcamReadTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Pearl_gtcamGetNextTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamDump = &Pearl_gtcamDump;
-		dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Pearl_gtcamAdvConfigIntf;
-		dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable = &Pearl_gprtSetCutThrouthEnableIntf;
-		dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable = &Pearl_gprtGetCutThrouthEnableIntf;
+		obj->TCAMObj.gtcamFindEntry = &Pearl_gtcamFindEntryIntf;
+		obj->TCAMObj.gtcamFlushAll = &Pearl_gtcamFlushAll;
+		obj->TCAMObj.gtcamFlushEntry = &Pearl_gtcamFlushEntry;
+		obj->TCAMObj.gtcamLoadEntry = &Pearl_gtcamLoadEntryIntf;
+		obj->TCAMObj.gtcamReadTCAMData = &Pearl_gtcamReadTCAMDataIntf;
+		obj->TCAMObj.gtcamGetNextTCAMData = &Pearl_gtcamGetNextTCAMDataIntf;
+		obj->TCAMObj.gtcamDump = &Pearl_gtcamDump;
+		obj->TCAMObj.gtcamAdvConfig = &Pearl_gtcamAdvConfigIntf;
+		obj->PORTCTRLObj.gprtSetCutThrouthEnable = &Pearl_gprtSetCutThrouthEnableIntf;
+		obj->PORTCTRLObj.gprtGetCutThrouthEnable = &Pearl_gprtGetCutThrouthEnableIntf;
 	}
 	/* Pearl deviceId MSD_88E6320 doesn't support TCAM and cut thru */
 
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Pearl_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Pearl_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Pearl_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Pearl_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Pearl_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Pearl_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Pearl_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Pearl_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Pearl_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Pearl_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Pearl_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Pearl_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Pearl_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Pearl_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Pearl_msdGetSMIPhyXMDIOReg;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Pearl_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Pearl_EEPROMReadIntf;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Pearl_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Pearl_gledForceOffIntf;	
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Pearl_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Pearl_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Pearl_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Pearl_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Pearl_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Pearl_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Pearl_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Pearl_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Pearl_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Pearl_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Pearl_gledDump;
+	obj->RMUObj.grmuGetID = &Pearl_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Pearl_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Pearl_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Pearl_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Pearl_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Pearl_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Pearl_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Pearl_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Pearl_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Pearl_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Pearl_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Pearl_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Pearl_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Pearl_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Pearl_msdGetSMIPhyXMDIOReg;
+
+	obj->EEPROMObj.geepromWrite = &Pearl_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Pearl_EEPROMReadIntf;
+
+	obj->LEDObj.gledForceOn = &Pearl_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Pearl_gledForceOffIntf;	
+	obj->LEDObj.gledModeSet = &Pearl_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Pearl_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Pearl_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Pearl_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Pearl_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Pearl_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Pearl_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Pearl_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Pearl_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Pearl_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Pearl_gledDump;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Agate(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Agate(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef AGATE_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Agate_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Agate_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Agate_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Agate_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Agate_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Agate_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Agate_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Agate_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Agate_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Agate_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Agate_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Agate_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Agate_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Agate_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Agate_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Agate_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Agate_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Agate_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Agate_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Agate_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Agate_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Agate_gfdbGetNonStaticEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Agate_gfdbDump;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Agate_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Agate_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Agate_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Agate_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Agate_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Agate_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Agate_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Agate_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Agate_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Agate_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Agate_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Agate_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Agate_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Agate_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Agate_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Agate_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Agate_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Agate_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Agate_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Agate_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Agate_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Agate_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Agate_gprtGetARPMirror;
-
-	dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = &Agate_gvctGetAdvCableDiagIntf;
-	dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = &Agate_gvctGetAdvExtendedStatusIntf;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Agate_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Agate_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Agate_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Agate_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Agate_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Agate_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Agate_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Agate_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Agate_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Agate_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Agate_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Agate_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Agate_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Agate_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Agate_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Agate_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Agate_gvtuDump;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Agate_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Agate_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Agate_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Agate_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Agate_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Agate_gqosGetPrioMapRule;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Agate_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Agate_gqosSetPrioMapRuleIntf;
-
-	dev->SwitchDevObj.PHYCTRLObj.gphyReset = &Agate_gphyReset;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Agate_serdesReset;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = &Agate_gphySetPortLoopback;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = &Agate_gphySetPortSpeedIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = &Agate_gphyPortPowerDown;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = &Agate_gphySetPortDuplexMode;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = &Agate_gphySetPortAutoModeIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = &Agate_gphySetEEE;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = &Agate_gphySetFlowControlEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = &Agate_gphySetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = &Agate_gphyGetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = &Agate_gphyGetIntStatus;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Agate_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Agate_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Agate_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Agate_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Agate_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Agate_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Agate_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Agate_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Agate_gpirlCustomSetupIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Agate_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Agate_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Agate_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Agate_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Agate_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Agate_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Agate_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Agate_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Agate_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Agate_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Agate_gvlnSetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Agate_gvlnGetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Agate_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Agate_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Agate_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Agate_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Agate_gprtSetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Agate_gprtGetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Agate_gprtSetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Agate_gprtGetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Agate_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Agate_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Agate_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Agate_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Agate_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Agate_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Agate_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Agate_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Agate_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Agate_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Agate_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Agate_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Agate_gprtSetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Agate_gprtGetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Agate_gprtSetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Agate_gprtGetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Agate_gprtSetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Agate_gprtGetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Agate_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Agate_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Agate_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Agate_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Agate_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Agate_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Agate_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Agate_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Agate_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Agate_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Agate_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Agate_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Agate_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Agate_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Agate_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Agate_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Agate_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Agate_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Agate_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Agate_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Agate_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Agate_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Agate_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Agate_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Agate_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Agate_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Agate_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Agate_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Agate_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Agate_gprtRegDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Agate_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Agate_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Agate_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Agate_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Agate_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Agate_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Agate_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Agate_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Agate_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Agate_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Agate_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Agate_gstatsGetPortAllCountersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Agate_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Agate_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Agate_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Agate_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Agate_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Agate_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Agate_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Agate_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Agate_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest = &Agate_gsysSetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest = &Agate_gsysGetCPUDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest = &Agate_gsysSetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest = &Agate_gsysGetIngressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Agate_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Agate_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables = &Agate_gsysSetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables = &Agate_gsysGetRsvd2CpuEnables;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri = &Agate_gsysSetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri = &Agate_gsysGetMGMTPri;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Agate_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Agate_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Agate_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Agate_gsysGetRMUMode;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Agate_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Agate_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Agate_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Agate_gqavSetPortQpriXRate;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Agate_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Agate_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Agate_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Agate_gtcamRemoveEntryPort;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Agate_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Agate_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Agate_gptpSetProtPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Agate_gptpGetProtPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpSetPortConfig = &Agate_gptpSetPortConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPortConfig = &Agate_gptpGetPortConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Agate_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Agate_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Agate_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = &Agate_gptpSetGlobalConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = &Agate_gptpGetGlobalConfigIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Agate_gptpGetIntStatusIntf;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Agate_gtcamFindEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Agate_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Agate_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Agate_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Agate_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Agate_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &Agate_gtcamDump;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Agate_gtcamAdvConfigIntf;
+	obj->ATUObj.gfdbAddMacEntry = &Agate_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Agate_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Agate_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Agate_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Agate_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Agate_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Agate_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Agate_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Agate_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Agate_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Agate_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Agate_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Agate_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Agate_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Agate_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Agate_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Agate_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Agate_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Agate_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Agate_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Agate_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Agate_gfdbGetNonStaticEntryCountPerFid;
+	obj->ATUObj.gfdbDump = &Agate_gfdbDump;
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Agate_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Agate_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Agate_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Agate_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Agate_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Agate_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Agate_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Agate_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Agate_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Agate_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Agate_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Agate_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Agate_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Agate_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Agate_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Agate_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Agate_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Agate_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Agate_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Agate_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Agate_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Agate_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Agate_gprtGetARPMirror;
+
+	obj->VCTObj.gvctGetAdvCableDiag = &Agate_gvctGetAdvCableDiagIntf;
+	obj->VCTObj.gvctGetAdvExtendedStatus = &Agate_gvctGetAdvExtendedStatusIntf;
+
+	obj->STUObj.gstuAddEntry = &Agate_gstuAddEntryIntf;
+	obj->STUObj.gstuDelEntry = &Agate_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Agate_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Agate_gstuGetEntryNextIntf;
+	obj->STUObj.gstuGetEntryCount = &Agate_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Agate_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Agate_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Agate_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Agate_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Agate_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Agate_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Agate_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuGetViolation = &Agate_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Agate_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Agate_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Agate_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Agate_gvtuDump;
+
+	obj->QOSMAPObj.gprtGetDefQpri = &Agate_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Agate_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Agate_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Agate_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Agate_gprtGetDefFpri;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Agate_gqosGetPrioMapRule;
+	obj->QOSMAPObj.gprtSetInitialPri = &Agate_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Agate_gqosSetPrioMapRuleIntf;
+
+	obj->PHYCTRLObj.gphyReset = &Agate_gphyReset;
+    obj->PHYCTRLObj.serdesReset = &Agate_serdesReset;
+	obj->PHYCTRLObj.gphySetPortLoopback = &Agate_gphySetPortLoopback;
+	obj->PHYCTRLObj.gphySetPortSpeed = &Agate_gphySetPortSpeedIntf;
+	obj->PHYCTRLObj.gphyPortPowerDown = &Agate_gphyPortPowerDown;
+	obj->PHYCTRLObj.gphySetPortDuplexMode = &Agate_gphySetPortDuplexMode;
+	obj->PHYCTRLObj.gphySetPortAutoMode = &Agate_gphySetPortAutoModeIntf;
+	obj->PHYCTRLObj.gphySetEEE = &Agate_gphySetEEE;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = &Agate_gphySetFlowControlEnable;
+	obj->PHYCTRLObj.gphySetIntEnable = &Agate_gphySetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntEnable = &Agate_gphyGetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntStatus = &Agate_gphyGetIntStatus;
+
+	obj->INTObj.gdevIntEnableSet = &Agate_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Agate_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Agate_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Agate_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Agate_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Agate_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Agate_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Agate_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Agate_gpirlCustomSetupIntf;
+	obj->PIRLObj.gpirlReadResource = &Agate_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Agate_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Agate_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Agate_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Agate_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Agate_gpirlAdvConfigDisableIntf;
+
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Agate_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Agate_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Agate_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Agate_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Agate_gvlnSetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Agate_gvlnGetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Agate_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Agate_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Agate_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Agate_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Agate_gprtSetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Agate_gprtGetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Agate_gprtSetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Agate_gprtGetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Agate_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Agate_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Agate_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Agate_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Agate_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Agate_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Agate_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Agate_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Agate_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Agate_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Agate_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Agate_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Agate_gprtSetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Agate_gprtGetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Agate_gprtSetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Agate_gprtGetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Agate_gprtSetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Agate_gprtGetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Agate_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Agate_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Agate_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Agate_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Agate_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Agate_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Agate_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Agate_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Agate_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Agate_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Agate_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Agate_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Agate_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Agate_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Agate_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Agate_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Agate_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Agate_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Agate_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Agate_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Agate_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Agate_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Agate_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Agate_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Agate_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Agate_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Agate_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Agate_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Agate_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtRegDump = &Agate_gprtRegDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Agate_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Agate_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Agate_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Agate_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Agate_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Agate_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Agate_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Agate_gsysGetTrunkRouting;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Agate_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Agate_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Agate_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Agate_gstatsGetPortAllCountersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Agate_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Agate_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Agate_gmibDump;
+
+	obj->QUEUEObj.gprtSetPortSched = &Agate_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Agate_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &Agate_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &Agate_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Agate_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Agate_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetCPUDest = &Agate_gsysSetCPUDest;
+	obj->SYSCTRLObj.gsysGetCPUDest = &Agate_gsysGetCPUDest;
+	obj->SYSCTRLObj.gsysSetIngressMonitorDest = &Agate_gsysSetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysGetIngressMonitorDest = &Agate_gsysGetIngressMonitorDest;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Agate_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Agate_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetRsvd2CpuEnables = &Agate_gsysSetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysGetRsvd2CpuEnables = &Agate_gsysGetRsvd2CpuEnables;
+	obj->SYSCTRLObj.gsysSetMGMTPri = &Agate_gsysSetMGMTPri;
+	obj->SYSCTRLObj.gsysGetMGMTPri = &Agate_gsysGetMGMTPri;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Agate_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Agate_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Agate_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Agate_gsysGetRMUMode;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &Agate_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &Agate_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &Agate_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &Agate_gqavSetPortQpriXRate;
+	obj->TCAMObj.gtcamSetMode = &Agate_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &Agate_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &Agate_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &Agate_gtcamRemoveEntryPort;
+
+	obj->PTPObj.gptpSetIntEnable = &Agate_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &Agate_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &Agate_gptpSetProtPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &Agate_gptpGetProtPTPEn;
+	obj->PTPObj.gptpSetPortConfig = &Agate_gptpSetPortConfigIntf;
+	obj->PTPObj.gptpGetPortConfig = &Agate_gptpGetPortConfigIntf;
+	obj->PTPObj.gptpGetTimeStamp = &Agate_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &Agate_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &Agate_gptpResetTimeStamp;
+	obj->PTPObj.gptpSetGlobalConfig = &Agate_gptpSetGlobalConfigIntf;
+	obj->PTPObj.gptpGetGlobalConfig = &Agate_gptpGetGlobalConfigIntf;
+	obj->PTPObj.gptpGetIntStatus = &Agate_gptpGetIntStatusIntf;
+
+	obj->TCAMObj.gtcamFindEntry = &Agate_gtcamFindEntryIntf;
+	obj->TCAMObj.gtcamFlushAll = &Agate_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &Agate_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &Agate_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &Agate_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &Agate_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &Agate_gtcamDump;
+	obj->TCAMObj.gtcamAdvConfig = &Agate_gtcamAdvConfigIntf;
 	
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Agate_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Agate_EEPROMReadIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Agate_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Agate_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMibDump = &Agate_msdRmuMibDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Agate_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Agate_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Agate_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Agate_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Agate_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Agate_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Agate_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Agate_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Agate_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Agate_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Agate_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Agate_msdGetSMIPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Agate_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Agate_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Agate_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Agate_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Agate_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Agate_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Agate_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Agate_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Agate_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Agate_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Agate_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Agate_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Agate_gledDump;
+	obj->EEPROMObj.geepromWrite = &Agate_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Agate_EEPROMReadIntf;
+
+	obj->RMUObj.grmuGetID = &Agate_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Agate_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMibDump = &Agate_msdRmuMibDumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Agate_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Agate_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Agate_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Agate_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Agate_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Agate_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Agate_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Agate_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Agate_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Agate_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Agate_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Agate_msdGetSMIPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &Agate_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Agate_gledForceOffIntf;
+	obj->LEDObj.gledModeSet = &Agate_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Agate_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Agate_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Agate_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Agate_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Agate_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Agate_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Agate_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Agate_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Agate_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Agate_gledDump;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Amethyst(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Amethyst(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 	MSD_STATUS retVal = MSD_OK;
 
 #ifdef AMETHYST_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Amethyst_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Amethyst_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Amethyst_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Amethyst_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Amethyst_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Amethyst_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Amethyst_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Amethyst_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Amethyst_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Amethyst_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Amethyst_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Amethyst_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Amethyst_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Amethyst_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Amethyst_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Amethyst_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Amethyst_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Amethyst_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Amethyst_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Amethyst_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Amethyst_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Amethyst_gfdbGetNonStaticEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Amethyst_gfdbDump;
+	obj->ATUObj.gfdbAddMacEntry = &Amethyst_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Amethyst_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Amethyst_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Amethyst_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Amethyst_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Amethyst_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Amethyst_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Amethyst_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Amethyst_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Amethyst_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Amethyst_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Amethyst_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Amethyst_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Amethyst_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Amethyst_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Amethyst_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Amethyst_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Amethyst_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Amethyst_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Amethyst_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Amethyst_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Amethyst_gfdbGetNonStaticEntryCountPerFid;
+	obj->ATUObj.gfdbDump = &Amethyst_gfdbDump;
 
 	/* Amethyst deviceId MSD_88E6193X and MSD_88E6191X doesn't support Route, TSN, CutThrough */
 	if ((dev->deviceId != MSD_88E6191X) && (dev->deviceId != MSD_88E6193X))
 	{
-		dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &Amethyst_garpLoadMcEntryIntf;
-		dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &Amethyst_garpLoadUcEntryIntf;
-		dev->SwitchDevObj.ARPObj.garpFlushEntry = &Amethyst_garpFlushEntry;
-		dev->SwitchDevObj.ARPObj.garpFlushAll = &Amethyst_garpFlushAll;
-		dev->SwitchDevObj.ARPObj.garpReadEntry = &Amethyst_garpReadEntryIntf;
-		dev->SwitchDevObj.ARPObj.garpGetNextEntry = &Amethyst_garpGetNextEntryIntf;
-
-		dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Amethyst_gqavGetPortQpriXHiLimit;
-		dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Amethyst_gqavSetPortQpriXHiLimit;
-		dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Amethyst_gqavGetPortQpriXRate;
-		dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Amethyst_gqavSetPortQpriXRate;
-
-		dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Amethyst_gptpSetIntEnableIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Amethyst_gptpGetIntEnableIntf;
-		dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Amethyst_gptpSetProtPTPEn;
-		dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Amethyst_gptpGetProtPTPEn;
-		dev->SwitchDevObj.PTPObj.gptpSetPortConfig = &Amethyst_gptpSetPortConfigIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetPortConfig = &Amethyst_gptpGetPortConfigIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Amethyst_gptpGetTimeStampIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Amethyst_gptpGetTSValidSt;
-		dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Amethyst_gptpResetTimeStamp;
-		dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = &Amethyst_gptpSetGlobalConfigIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = &Amethyst_gptpGetGlobalConfigIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Amethyst_gptpGetIntStatusIntf;
-		dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Amethyst_gptpSetMeanPathDelay;
-		dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Amethyst_gptpGetMeanPathDelay;
-		dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Amethyst_gptpSetIgrPathDelayAsym;
-		dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Amethyst_gptpGetIgrPathDelayAsym;
-		dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Amethyst_gptpSetEgrPathDelayAsym;
-		dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Amethyst_gptpGetEgrPathDelayAsym;
-		dev->SwitchDevObj.PTPObj.gptpSetMode = &Amethyst_gptpSetModeIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetMode = &Amethyst_gptpGetModeIntf;
-		dev->SwitchDevObj.PTPObj.gptpSetMasterSlave = &Amethyst_gptpSetMasterSlaveIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetMasterSlave = &Amethyst_gptpGetMasterSlaveIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Amethyst_gptpGetTODBusyBitStatus;
-		dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Amethyst_gptpTODStoreCompensationIntf;
-		dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Amethyst_gptpTODStoreAllIntf;
-		dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Amethyst_gptpTODCaptureAllIntf;
-		dev->SwitchDevObj.PTPObj.gptpSetPulse = &Amethyst_gptpSetPulseIntf;
-		dev->SwitchDevObj.PTPObj.gptpGetPulse = &Amethyst_gptpGetPulseIntf;
-		dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Amethyst_gtaiGetPTPGlobalTime;
-
-		dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable = &Amethyst_gprtSetCutThrouthEnableIntf;
-		dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable = &Amethyst_gprtGetCutThrouthEnableIntf;
+		obj->ARPObj.garpLoadMcEntry = &Amethyst_garpLoadMcEntryIntf;
+		obj->ARPObj.garpLoadUcEntry = &Amethyst_garpLoadUcEntryIntf;
+		obj->ARPObj.garpFlushEntry = &Amethyst_garpFlushEntry;
+		obj->ARPObj.garpFlushAll = &Amethyst_garpFlushAll;
+		obj->ARPObj.garpReadEntry = &Amethyst_garpReadEntryIntf;
+		obj->ARPObj.garpGetNextEntry = &Amethyst_garpGetNextEntryIntf;
+
+		obj->QAVObj.gqavGetPortQpriXHiLimit = &Amethyst_gqavGetPortQpriXHiLimit;
+		obj->QAVObj.gqavSetPortQpriXHiLimit = &Amethyst_gqavSetPortQpriXHiLimit;
+		obj->QAVObj.gqavGetPortQpriXRate = &Amethyst_gqavGetPortQpriXRate;
+		obj->QAVObj.gqavSetPortQpriXRate = &Amethyst_gqavSetPortQpriXRate;
+
+		obj->PTPObj.gptpSetIntEnable = &Amethyst_gptpSetIntEnableIntf;
+		obj->PTPObj.gptpGetIntEnable = &Amethyst_gptpGetIntEnableIntf;
+		obj->PTPObj.gptpSetProtPTPEn = &Amethyst_gptpSetProtPTPEn;
+		obj->PTPObj.gptpGetProtPTPEn = &Amethyst_gptpGetProtPTPEn;
+		obj->PTPObj.gptpSetPortConfig = &Amethyst_gptpSetPortConfigIntf;
+		obj->PTPObj.gptpGetPortConfig = &Amethyst_gptpGetPortConfigIntf;
+		obj->PTPObj.gptpGetTimeStamp = &Amethyst_gptpGetTimeStampIntf;
+		obj->PTPObj.gptpGetTSValidSt = &Amethyst_gptpGetTSValidSt;
+		obj->PTPObj.gptpResetTimeStamp = &Amethyst_gptpResetTimeStamp;
+		obj->PTPObj.gptpSetGlobalConfig = &Amethyst_gptpSetGlobalConfigIntf;
+		obj->PTPObj.gptpGetGlobalConfig = &Amethyst_gptpGetGlobalConfigIntf;
+		obj->PTPObj.gptpGetIntStatus = &Amethyst_gptpGetIntStatusIntf;
+		obj->PTPObj.gptpSetMeanPathDelay = &Amethyst_gptpSetMeanPathDelay;
+		obj->PTPObj.gptpGetMeanPathDelay = &Amethyst_gptpGetMeanPathDelay;
+		obj->PTPObj.gptpSetIgrPathDelayAsym = &Amethyst_gptpSetIgrPathDelayAsym;
+		obj->PTPObj.gptpGetIgrPathDelayAsym = &Amethyst_gptpGetIgrPathDelayAsym;
+		obj->PTPObj.gptpSetEgrPathDelayAsym = &Amethyst_gptpSetEgrPathDelayAsym;
+		obj->PTPObj.gptpGetEgrPathDelayAsym = &Amethyst_gptpGetEgrPathDelayAsym;
+		obj->PTPObj.gptpSetMode = &Amethyst_gptpSetModeIntf;
+		obj->PTPObj.gptpGetMode = &Amethyst_gptpGetModeIntf;
+		obj->PTPObj.gptpSetMasterSlave = &Amethyst_gptpSetMasterSlaveIntf;
+		obj->PTPObj.gptpGetMasterSlave = &Amethyst_gptpGetMasterSlaveIntf;
+		obj->PTPObj.gptpGetTODBusyBitStatus = &Amethyst_gptpGetTODBusyBitStatus;
+		obj->PTPObj.gptpTODStoreCompensation = &Amethyst_gptpTODStoreCompensationIntf;
+		obj->PTPObj.gptpTODStoreAll = &Amethyst_gptpTODStoreAllIntf;
+		obj->PTPObj.gptpTODCaptureAll = &Amethyst_gptpTODCaptureAllIntf;
+		obj->PTPObj.gptpSetPulse = &Amethyst_gptpSetPulseIntf;
+		obj->PTPObj.gptpGetPulse = &Amethyst_gptpGetPulseIntf;
+		obj->PTPObj.gtaiGetPTPGlobalTime = &Amethyst_gtaiGetPTPGlobalTime;
+
+		obj->PORTCTRLObj.gprtSetCutThrouthEnable = &Amethyst_gprtSetCutThrouthEnableIntf;
+		obj->PORTCTRLObj.gprtGetCutThrouthEnable = &Amethyst_gprtGetCutThrouthEnableIntf;
 	}
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Amethyst_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Amethyst_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Amethyst_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Amethyst_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Amethyst_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Amethyst_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Amethyst_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Amethyst_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Amethyst_gprtSetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Amethyst_gprtGetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Amethyst_gprtSetRxPriorityFlowControlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Amethyst_gprtGetRxPriorityFlowControlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Amethyst_gprtSetRxPriorityFlowControlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Amethyst_gprtGetRxPriorityFlowControlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Amethyst_gprtSetTxPriorityFlowControlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Amethyst_gprtGetTxPriorityFlowControlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Amethyst_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Amethyst_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Amethyst_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Amethyst_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Amethyst_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Amethyst_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Amethyst_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Amethyst_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Amethyst_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Amethyst_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Amethyst_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Amethyst_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Amethyst_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Amethyst_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Amethyst_gprtGetARPMirror;
-
-	dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = &Amethyst_gvctGetAdvCableDiagIntf;
-	dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = &Amethyst_gvctGetAdvExtendedStatusIntf;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Amethyst_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Amethyst_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Amethyst_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Amethyst_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Amethyst_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Amethyst_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Amethyst_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Amethyst_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Amethyst_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Amethyst_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Amethyst_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Amethyst_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &Amethyst_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &Amethyst_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Amethyst_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Amethyst_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Amethyst_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Amethyst_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Amethyst_gvtuDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Amethyst_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Amethyst_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Amethyst_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Amethyst_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Amethyst_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Amethyst_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Amethyst_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Amethyst_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.IMPObj.impRun = &Amethyst_impRunIntf;
-	dev->SwitchDevObj.IMPObj.impReset = &Amethyst_impResetIntf;
-	dev->SwitchDevObj.IMPObj.impLoadToRAM = &Amethyst_impLoadToRAMIntf;
-	dev->SwitchDevObj.IMPObj.impStop = &Amethyst_impStopIntf;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Amethyst_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Amethyst_EEPROMReadIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &Amethyst_EEPROMChipSelSetIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &Amethyst_EEPROMChipSelGetIntf;
-
-	dev->SwitchDevObj.PHYCTRLObj.gphyReset = &Amethyst_gphyReset;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Amethyst_serdesReset;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = &Amethyst_gphySetPortLoopback;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = &Amethyst_gphySetPortSpeedIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = &Amethyst_gphyPortPowerDown;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = &Amethyst_gphySetPortDuplexMode;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = &Amethyst_gphySetPortAutoModeIntf;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = &Amethyst_gphySetEEE;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = &Amethyst_gphySetFlowControlEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = &Amethyst_gphySetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = &Amethyst_gphyGetIntEnable;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = &Amethyst_gphyGetIntStatus;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Amethyst_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Amethyst_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Amethyst_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Amethyst_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Amethyst_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Amethyst_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Amethyst_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Amethyst_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Amethyst_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Amethyst_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Amethyst_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Amethyst_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Amethyst_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Amethyst_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Amethyst_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Amethyst_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Amethyst_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Amethyst_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Amethyst_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Amethyst_gvlnSetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Amethyst_gvlnGetPortVlanDot1qModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Amethyst_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Amethyst_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Amethyst_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Amethyst_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Amethyst_gprtSetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Amethyst_gprtGetUnicastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Amethyst_gprtSetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Amethyst_gprtGetMulticastFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Amethyst_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Amethyst_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Amethyst_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Amethyst_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Amethyst_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Amethyst_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Amethyst_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Amethyst_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Amethyst_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Amethyst_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Amethyst_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Amethyst_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Amethyst_gprtSetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Amethyst_gprtGetVTUPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Amethyst_gprtSetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Amethyst_gprtGetSAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Amethyst_gprtSetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Amethyst_gprtGetDAPriorityOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Amethyst_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Amethyst_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Amethyst_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Amethyst_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Amethyst_gprtSetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Amethyst_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Amethyst_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Amethyst_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Amethyst_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Amethyst_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Amethyst_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Amethyst_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Amethyst_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Amethyst_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Amethyst_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Amethyst_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Amethyst_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Amethyst_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Amethyst_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Amethyst_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Amethyst_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Amethyst_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Amethyst_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Amethyst_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Amethyst_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &Amethyst_gprtSetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &Amethyst_gprtGetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Amethyst_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Amethyst_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &Amethyst_gprtSetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &Amethyst_gprtGetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Amethyst_gprtSetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Amethyst_gprtGetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Amethyst_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Amethyst_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Amethyst_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Amethyst_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Amethyst_gprtRegDump;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Amethyst_gprtGetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Amethyst_gprtSetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Amethyst_gqosGetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Amethyst_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Amethyst_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Amethyst_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Amethyst_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Amethyst_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Amethyst_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Amethyst_gqosSetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Amethyst_gprtRewriteDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Amethyst_gprtSetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Amethyst_gprtGetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Amethyst_gprtSetCosToDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Amethyst_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Amethyst_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Amethyst_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Amethyst_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Amethyst_gstatsGetPortAllCountersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Amethyst_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Amethyst_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Amethyst_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Amethyst_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Amethyst_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Amethyst_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Amethyst_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Amethyst_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Amethyst_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Amethyst_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Amethyst_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Amethyst_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Amethyst_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Amethyst_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Amethyst_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Amethyst_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Amethyst_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Amethyst_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Amethyst_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Amethyst_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Amethyst_gsysQbvRead;
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Amethyst_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Amethyst_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Amethyst_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Amethyst_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Amethyst_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Amethyst_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Amethyst_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Amethyst_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtSetQueueToPause = &Amethyst_gprtSetQueueToPause;
+	obj->PORTCTRLObj.gprtGetQueueToPause = &Amethyst_gprtGetQueueToPause;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Amethyst_gprtSetRxPriorityFlowControlEnable;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Amethyst_gprtGetRxPriorityFlowControlEnable;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Amethyst_gprtSetRxPriorityFlowControlToQueue;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Amethyst_gprtGetRxPriorityFlowControlToQueue;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Amethyst_gprtSetTxPriorityFlowControlEnable;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Amethyst_gprtGetTxPriorityFlowControlEnable;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Amethyst_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Amethyst_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Amethyst_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Amethyst_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Amethyst_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Amethyst_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Amethyst_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Amethyst_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Amethyst_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Amethyst_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Amethyst_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Amethyst_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Amethyst_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Amethyst_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Amethyst_gprtGetARPMirror;
+
+	obj->VCTObj.gvctGetAdvCableDiag = &Amethyst_gvctGetAdvCableDiagIntf;
+	obj->VCTObj.gvctGetAdvExtendedStatus = &Amethyst_gvctGetAdvExtendedStatusIntf;
+
+	obj->STUObj.gstuAddEntry = &Amethyst_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Amethyst_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &Amethyst_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Amethyst_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &Amethyst_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Amethyst_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Amethyst_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Amethyst_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Amethyst_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Amethyst_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Amethyst_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Amethyst_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &Amethyst_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &Amethyst_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &Amethyst_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Amethyst_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Amethyst_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Amethyst_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Amethyst_gvtuDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Amethyst_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Amethyst_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Amethyst_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Amethyst_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Amethyst_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Amethyst_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Amethyst_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Amethyst_gsysGetTrunkRouting;
+
+	obj->IMPObj.impRun = &Amethyst_impRunIntf;
+	obj->IMPObj.impReset = &Amethyst_impResetIntf;
+	obj->IMPObj.impLoadToRAM = &Amethyst_impLoadToRAMIntf;
+	obj->IMPObj.impStop = &Amethyst_impStopIntf;
+
+	obj->EEPROMObj.geepromWrite = &Amethyst_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Amethyst_EEPROMReadIntf;
+	obj->EEPROMObj.geepromSetMChipSel = &Amethyst_EEPROMChipSelSetIntf;
+	obj->EEPROMObj.geepromGetMChipSel = &Amethyst_EEPROMChipSelGetIntf;
+
+	obj->PHYCTRLObj.gphyReset = &Amethyst_gphyReset;
+    obj->PHYCTRLObj.serdesReset = &Amethyst_serdesReset;
+	obj->PHYCTRLObj.gphySetPortLoopback = &Amethyst_gphySetPortLoopback;
+	obj->PHYCTRLObj.gphySetPortSpeed = &Amethyst_gphySetPortSpeedIntf;
+	obj->PHYCTRLObj.gphyPortPowerDown = &Amethyst_gphyPortPowerDown;
+	obj->PHYCTRLObj.gphySetPortDuplexMode = &Amethyst_gphySetPortDuplexMode;
+	obj->PHYCTRLObj.gphySetPortAutoMode = &Amethyst_gphySetPortAutoModeIntf;
+	obj->PHYCTRLObj.gphySetEEE = &Amethyst_gphySetEEE;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = &Amethyst_gphySetFlowControlEnable;
+	obj->PHYCTRLObj.gphySetIntEnable = &Amethyst_gphySetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntEnable = &Amethyst_gphyGetIntEnable;
+	obj->PHYCTRLObj.gphyGetIntStatus = &Amethyst_gphyGetIntStatus;
+
+	obj->INTObj.gdevIntEnableSet = &Amethyst_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Amethyst_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Amethyst_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Amethyst_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Amethyst_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Amethyst_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Amethyst_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Amethyst_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Amethyst_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &Amethyst_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Amethyst_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Amethyst_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Amethyst_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Amethyst_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Amethyst_gpirlAdvConfigDisableIntf;
+
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Amethyst_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Amethyst_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Amethyst_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Amethyst_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Amethyst_gvlnSetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Amethyst_gvlnGetPortVlanDot1qModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Amethyst_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Amethyst_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Amethyst_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Amethyst_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Amethyst_gprtSetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Amethyst_gprtGetUnicastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Amethyst_gprtSetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Amethyst_gprtGetMulticastFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Amethyst_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Amethyst_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Amethyst_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Amethyst_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Amethyst_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Amethyst_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Amethyst_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Amethyst_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Amethyst_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Amethyst_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Amethyst_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Amethyst_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Amethyst_gprtSetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Amethyst_gprtGetVTUPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Amethyst_gprtSetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Amethyst_gprtGetSAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Amethyst_gprtSetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Amethyst_gprtGetDAPriorityOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Amethyst_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Amethyst_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Amethyst_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Amethyst_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = &Amethyst_gprtSetAllowVidZero;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = &Amethyst_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Amethyst_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Amethyst_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Amethyst_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Amethyst_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Amethyst_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Amethyst_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Amethyst_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Amethyst_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Amethyst_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Amethyst_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Amethyst_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Amethyst_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Amethyst_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Amethyst_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Amethyst_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Amethyst_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Amethyst_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Amethyst_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Amethyst_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetPortECID = &Amethyst_gprtSetPortECID;
+	obj->PORTCTRLObj.gprtGetPortECID = &Amethyst_gprtGetPortECID;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Amethyst_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Amethyst_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = &Amethyst_gprtSetIgnoreETag;
+	obj->PORTCTRLObj.gprtGetIgnoreETag = &Amethyst_gprtGetIgnoreETag;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Amethyst_gprtSetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Amethyst_gprtGetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Amethyst_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Amethyst_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Amethyst_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Amethyst_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtRegDump = &Amethyst_gprtRegDump;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = &Amethyst_gprtGetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = &Amethyst_gprtSetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Amethyst_gqosGetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Amethyst_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Amethyst_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetDefQpri = &Amethyst_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Amethyst_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Amethyst_gprtGetDefFpri;
+	obj->QOSMAPObj.gprtSetInitialPri = &Amethyst_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Amethyst_gqosSetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtRewriteDscp = &Amethyst_gprtRewriteDscp;
+	obj->QOSMAPObj.gprtSetCosToQueue = &Amethyst_gprtSetCosToQueue;
+	obj->QOSMAPObj.gprtGetCosToQueue = &Amethyst_gprtGetCosToQueue;
+	obj->QOSMAPObj.gprtSetCosToDscp = &Amethyst_gprtSetCosToDscp;
+	obj->QOSMAPObj.gprtGetCosToDscp = &Amethyst_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Amethyst_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Amethyst_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Amethyst_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Amethyst_gstatsGetPortAllCountersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Amethyst_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Amethyst_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Amethyst_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &Amethyst_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &Amethyst_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &Amethyst_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Amethyst_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &Amethyst_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &Amethyst_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Amethyst_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Amethyst_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Amethyst_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Amethyst_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Amethyst_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Amethyst_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Amethyst_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Amethyst_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Amethyst_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Amethyst_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Amethyst_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Amethyst_gsysQbvRead;
 
 	/* Amethyst deviceId MSD_88E6191X doesn't support ECID, TCAM */
 	if (dev->deviceId != MSD_88E6191X)
 	{
-		dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &Amethyst_gBpeEnableSet;
-		dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &Amethyst_gBpeEnableGet;
-		dev->SwitchDevObj.ECIDObj.gecidAddEntry = &Amethyst_gecidAddEntryIntf;
-		dev->SwitchDevObj.ECIDObj.gecidDump = &Amethyst_gecidDump;
-		dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &Amethyst_gecidFindEcidEntryIntf;
-		dev->SwitchDevObj.ECIDObj.gecidFlushAll = &Amethyst_gecidFlushAll;
-		dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &Amethyst_gecidFlushEntry;
-		dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &Amethyst_gecidGetEcidEntryNextIntf;
-		dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &Amethyst_gecidGetEntryCount;
-		dev->SwitchDevObj.ECIDObj.gecidMove = &Amethyst_gecidMove;
-
-		dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Amethyst_gtcamFlushAll;
-		dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Amethyst_gtcamFlushEntry;
-		dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Amethyst_gtcamLoadEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Amethyst_gtcamReadTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Amethyst_gtcamGetNextTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Amethyst_gtcamFindEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Amethyst_gtcamSetModeIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Amethyst_gtcamGetModeIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Amethyst_gtcamAddEntryPort;
-		dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Amethyst_gtcamRemoveEntryPort;
-		dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Amethyst_gtcamEgrFlushEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Amethyst_gtcamEgrFlushEntryAllPortsIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Amethyst_gtcamEgrLoadEntryIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Amethyst_gtcamEgrGetNextTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Amethyst_gtcamEgrReadTCAMDataIntf;
-		dev->SwitchDevObj.TCAMObj.gtcamDump = &Amethyst_gtcamDump;
-		dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Amethyst_gtcamAdvConfigIntf;
-
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &Amethyst_gtcamRCLoadEntryIntf;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &Amethyst_gtcamRCFlushAllEntry;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &Amethyst_gtcamRCFlushEntry;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &Amethyst_gtcamRCReadEntryIntf;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &Amethyst_gtcamRCGetNextEntryIntf;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &Amethyst_gtcamRCFindEntryIntf;
-		dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &Amethyst_gtcamRCEntryDump;
-
-		dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &Amethyst_gtcamRCCompLoadIntf;
-		dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &Amethyst_gtcamRCCompFlushAll;
-		dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &Amethyst_gtcamRCCompFlushPort;
-		dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &Amethyst_gtcamRCCompReadIntf;
-
-		dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Amethyst_msdRmuTCAMDumpIntf;
-		dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Amethyst_msdRmuTCAMReadIntf;
-		dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Amethyst_msdRmuTCAMWriteIntf;
-		dev->SwitchDevObj.RMUObj.grmuEcidDump = &Amethyst_msdRmuEcidDumpIntf;
+		obj->ECIDObj.gBpeEnableSet = &Amethyst_gBpeEnableSet;
+		obj->ECIDObj.gBpeEnableGet = &Amethyst_gBpeEnableGet;
+		obj->ECIDObj.gecidAddEntry = &Amethyst_gecidAddEntryIntf;
+		obj->ECIDObj.gecidDump = &Amethyst_gecidDump;
+		obj->ECIDObj.gecidFindEcidEntry = &Amethyst_gecidFindEcidEntryIntf;
+		obj->ECIDObj.gecidFlushAll = &Amethyst_gecidFlushAll;
+		obj->ECIDObj.gecidFlushEntry = &Amethyst_gecidFlushEntry;
+		obj->ECIDObj.gecidGetEcidEntryNext = &Amethyst_gecidGetEcidEntryNextIntf;
+		obj->ECIDObj.gecidGetEntryCount = &Amethyst_gecidGetEntryCount;
+		obj->ECIDObj.gecidMove = &Amethyst_gecidMove;
+
+		obj->TCAMObj.gtcamFlushAll = &Amethyst_gtcamFlushAll;
+		obj->TCAMObj.gtcamFlushEntry = &Amethyst_gtcamFlushEntry;
+		obj->TCAMObj.gtcamLoadEntry = &Amethyst_gtcamLoadEntryIntf;
+		obj->TCAMObj.gtcamReadTCAMData = &Amethyst_gtcamReadTCAMDataIntf;
+		obj->TCAMObj.gtcamGetNextTCAMData = &Amethyst_gtcamGetNextTCAMDataIntf;
+		obj->TCAMObj.gtcamFindEntry = &Amethyst_gtcamFindEntryIntf;
+		obj->TCAMObj.gtcamSetMode = &Amethyst_gtcamSetModeIntf;
+		obj->TCAMObj.gtcamGetMode = &Amethyst_gtcamGetModeIntf;
+		obj->TCAMObj.gtcamAddEntryPort = &Amethyst_gtcamAddEntryPort;
+		obj->TCAMObj.gtcamRemoveEntryPort = &Amethyst_gtcamRemoveEntryPort;
+		obj->TCAMObj.gtcamEgrFlushEntry = &Amethyst_gtcamEgrFlushEntryIntf;
+		obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Amethyst_gtcamEgrFlushEntryAllPortsIntf;
+		obj->TCAMObj.gtcamEgrLoadEntry = &Amethyst_gtcamEgrLoadEntryIntf;
+		obj->TCAMObj.gtcamEgrGetNextTCAMData = &Amethyst_gtcamEgrGetNextTCAMDataIntf;
+		obj->TCAMObj.gtcamEgrReadTCAMData = &Amethyst_gtcamEgrReadTCAMDataIntf;
+		obj->TCAMObj.gtcamDump = &Amethyst_gtcamDump;
+		obj->TCAMObj.gtcamAdvConfig = &Amethyst_gtcamAdvConfigIntf;
+
+		obj->TCAMRCObj.gtcamRCLoadEntry = &Amethyst_gtcamRCLoadEntryIntf;
+		obj->TCAMRCObj.gtcamRCFlushAllEntry = &Amethyst_gtcamRCFlushAllEntry;
+		obj->TCAMRCObj.gtcamRCFlushEntry = &Amethyst_gtcamRCFlushEntry;
+		obj->TCAMRCObj.gtcamRCReadEntry = &Amethyst_gtcamRCReadEntryIntf;
+		obj->TCAMRCObj.gtcamRCGetNextEntry = &Amethyst_gtcamRCGetNextEntryIntf;
+		obj->TCAMRCObj.gtcamRCFindEntry = &Amethyst_gtcamRCFindEntryIntf;
+		obj->TCAMRCObj.gtcamRCEntryDump = &Amethyst_gtcamRCEntryDump;
+
+		obj->TCAMRCCompObj.gtcamRCCompLoad = &Amethyst_gtcamRCCompLoadIntf;
+		obj->TCAMRCCompObj.gtcamRCCompFlushAll = &Amethyst_gtcamRCCompFlushAll;
+		obj->TCAMRCCompObj.gtcamRCCompFlushPort = &Amethyst_gtcamRCCompFlushPort;
+		obj->TCAMRCCompObj.gtcamRCCompRead = &Amethyst_gtcamRCCompReadIntf;
+
+		obj->RMUObj.grmuTCAMDump = &Amethyst_msdRmuTCAMDumpIntf;
+		obj->RMUObj.grmuTCAMRead = &Amethyst_msdRmuTCAMReadIntf;
+		obj->RMUObj.grmuTCAMWrite = &Amethyst_msdRmuTCAMWriteIntf;
+		obj->RMUObj.grmuEcidDump = &Amethyst_msdRmuEcidDumpIntf;
 	}
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Amethyst_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Amethyst_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Amethyst_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Amethyst_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Amethyst_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Amethyst_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Amethyst_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Amethyst_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Amethyst_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Amethyst_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Amethyst_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Amethyst_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Amethyst_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Amethyst_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Amethyst_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Amethyst_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Amethyst_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &Amethyst_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Amethyst_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Amethyst_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Amethyst_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Amethyst_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Amethyst_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Amethyst_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Amethyst_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Amethyst_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Amethyst_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Amethyst_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Amethyst_gledDump;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &Amethyst_gpolicySetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &Amethyst_gpolicyGetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &Amethyst_gpolicySetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &Amethyst_gpolicyGetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &Amethyst_gpolicySetIngressMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &Amethyst_gpolicyGetIngressMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &Amethyst_gpolicySetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &Amethyst_gpolicyGetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &Amethyst_gpolicySetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &Amethyst_gpolicyGetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &Amethyst_gpolicySetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &Amethyst_gpolicyGetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &Amethyst_gpolicySetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &Amethyst_gpolicyGetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &Amethyst_gpolicySetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &Amethyst_gpolicyGetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &Amethyst_gpolicySetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &Amethyst_gpolicyGetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &Amethyst_gpolicySetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &Amethyst_gpolicyGetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &Amethyst_gpolicySetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &Amethyst_gpolicyGetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &Amethyst_gpolicySetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &Amethyst_gpolicyGetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &Amethyst_gprtSetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &Amethyst_gprtGetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &Amethyst_gpolicySetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &Amethyst_gpolicyGetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &Amethyst_gpolicySetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &Amethyst_gpolicyGetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &Amethyst_gpolicySetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &Amethyst_gpolicyGetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &Amethyst_gpolicySetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &Amethyst_gpolicyGetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &Amethyst_gpolicySetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &Amethyst_gpolicyGetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &Amethyst_gprtSetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &Amethyst_gprtGetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &Amethyst_gpolicySetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &Amethyst_gpolicyGetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &Amethyst_gprtSetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &Amethyst_gprtGetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &Amethyst_gpolicySetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &Amethyst_gpolicyGetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &Amethyst_gpolicySetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &Amethyst_gpolicyGetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &Amethyst_gpolicySetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &Amethyst_gpolicyGetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &Amethyst_gpolicySetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &Amethyst_gpolicyGetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &Amethyst_gpolicySetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &Amethyst_gpolicyGetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = &Amethyst_gpolicySetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &Amethyst_gpolicyGetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &Amethyst_gpolicySetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &Amethyst_gpolicyGetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = &Amethyst_gpolicyDump;
-
-	/*For Amethyst, reserve 16 free queue size*/
-	retVal = msdReserveFreeQueueSize(dev);
+	obj->RMUObj.grmuGetID = &Amethyst_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Amethyst_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Amethyst_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Amethyst_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Amethyst_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Amethyst_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Amethyst_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Amethyst_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Amethyst_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Amethyst_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Amethyst_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Amethyst_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Amethyst_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Amethyst_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Amethyst_msdGetSMIExtPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &Amethyst_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Amethyst_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &Amethyst_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Amethyst_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Amethyst_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Amethyst_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Amethyst_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Amethyst_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Amethyst_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Amethyst_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Amethyst_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Amethyst_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Amethyst_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Amethyst_gledDump;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = &Amethyst_gpolicySetMgmtCtrl;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = &Amethyst_gpolicyGetMgmtCtrl;
+	obj->POLICYObj.gpolicySetCpuDest = &Amethyst_gpolicySetCpuDest;
+	obj->POLICYObj.gpolicyGetCpuDest = &Amethyst_gpolicyGetCpuDest;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = &Amethyst_gpolicySetIngressMonitorDest;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = &Amethyst_gpolicyGetIngressMonitorDest;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = &Amethyst_gpolicySetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &Amethyst_gpolicyGetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicySetMGMTPri = &Amethyst_gpolicySetMGMTPri;
+	obj->POLICYObj.gpolicyGetMGMTPri = &Amethyst_gpolicyGetMGMTPri;
+	obj->POLICYObj.gpolicySetRouteDest = &Amethyst_gpolicySetRouteDest;
+	obj->POLICYObj.gpolicyGetRouteDest = &Amethyst_gpolicyGetRouteDest;
+	obj->POLICYObj.gpolicySetMirrorDest = &Amethyst_gpolicySetMirrorDest;
+	obj->POLICYObj.gpolicyGetMirrorDest = &Amethyst_gpolicyGetMirrorDest;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = &Amethyst_gpolicySetIllegalIPAddr;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = &Amethyst_gpolicyGetIllegalIPAddr;
+	obj->POLICYObj.gpolicySetDipDaMismatch = &Amethyst_gpolicySetDipDaMismatch;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = &Amethyst_gpolicyGetDipDaMismatch;
+	obj->POLICYObj.gpolicySetZeroSIP = &Amethyst_gpolicySetZeroSIP;
+	obj->POLICYObj.gpolicyGetZeroSIP = &Amethyst_gpolicyGetZeroSIP;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = &Amethyst_gpolicySetMcTtlExceeded;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = &Amethyst_gpolicyGetMcTtlExceeded;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = &Amethyst_gpolicySetUcTtlExceeded;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = &Amethyst_gpolicyGetUcTtlExceeded;
+	obj->POLICYObj.gprtSetPortTtlThreshold = &Amethyst_gprtSetPortTtlThreshold;
+	obj->POLICYObj.gprtGetPortTtlThreshold = &Amethyst_gprtGetPortTtlThreshold;
+	obj->POLICYObj.gpolicySetIpHdrErr = &Amethyst_gpolicySetIpHdrErr;
+	obj->POLICYObj.gpolicyGetIpHdrErr = &Amethyst_gpolicyGetIpHdrErr;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = &Amethyst_gpolicySetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &Amethyst_gpolicyGetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &Amethyst_gpolicySetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &Amethyst_gpolicyGetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicySetTCPSYN = &Amethyst_gpolicySetTCPSYN;
+	obj->POLICYObj.gpolicyGetTCPSYN = &Amethyst_gpolicyGetTCPSYN;
+	obj->POLICYObj.gpolicySetTCPHSize = &Amethyst_gpolicySetTCPHSize;
+	obj->POLICYObj.gpolicyGetTCPHSize = &Amethyst_gpolicyGetTCPHSize;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = &Amethyst_gprtSetPortTCPMinHdrSize;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = &Amethyst_gprtGetPortTCPMinHdrSize;
+	obj->POLICYObj.gpolicySetICMPSize = &Amethyst_gpolicySetICMPSize;
+	obj->POLICYObj.gpolicyGetICMPSize = &Amethyst_gpolicyGetICMPSize;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = &Amethyst_gprtSetPortICMPMaxSize;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = &Amethyst_gprtGetPortICMPMaxSize;
+	obj->POLICYObj.gpolicySetUDPPort = &Amethyst_gpolicySetUDPPort;
+	obj->POLICYObj.gpolicyGetUDPPort = &Amethyst_gpolicyGetUDPPort;
+	obj->POLICYObj.gpolicySetTCPPort = &Amethyst_gpolicySetTCPPort;
+	obj->POLICYObj.gpolicyGetTCPPort = &Amethyst_gpolicyGetTCPPort;
+	obj->POLICYObj.gpolicySetTCPSynFin = &Amethyst_gpolicySetTCPSynFin;
+	obj->POLICYObj.gpolicyGetTCPSynFin = &Amethyst_gpolicyGetTCPSynFin;
+	obj->POLICYObj.gpolicySetTCPFrag = &Amethyst_gpolicySetTCPFrag;
+	obj->POLICYObj.gpolicyGetTCPFrag = &Amethyst_gpolicyGetTCPFrag;
+	obj->POLICYObj.gpolicySetNearNonTPMR = &Amethyst_gpolicySetNearNonTPMR;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = &Amethyst_gpolicyGetNearNonTPMR;
+	obj->POLICYObj.gpolicySetETag = &Amethyst_gpolicySetETag;
+	obj->POLICYObj.gpolicyGetETag = &Amethyst_gpolicyGetETag;
+	obj->POLICYObj.gpolicySetNonETag = &Amethyst_gpolicySetNonETag;
+	obj->POLICYObj.gpolicyGetNonETag = &Amethyst_gpolicyGetNonETag;
+	obj->POLICYObj.gpolicyDump = &Amethyst_gpolicyDump;
 
 #endif
 	return retVal;
 }
 
-static MSD_STATUS InitDevObj_Oak(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Oak(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef OAK_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Oak_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Oak_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Oak_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Oak_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Oak_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Oak_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Oak_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Oak_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Oak_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Oak_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Oak_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Oak_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Oak_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Oak_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Oak_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Oak_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Oak_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Oak_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Oak_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Oak_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Oak_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Oak_gfdbGetNStaticEntryCountFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Oak_gfdbDump;
-
-	dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &Oak_garpLoadMcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &Oak_garpLoadUcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpFlushEntry = &Oak_garpFlushEntry;
-	dev->SwitchDevObj.ARPObj.garpFlushAll = &Oak_garpFlushAll;
-	dev->SwitchDevObj.ARPObj.garpReadEntry = &Oak_garpReadEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpGetNextEntry = &Oak_garpGetNextEntryIntf;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Oak_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Oak_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Oak_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Oak_gqavSetPortQpriXRate;
-
-	dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Oak_serdesReset;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Oak_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Oak_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Oak_gptpSetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Oak_gptpGetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Oak_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Oak_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Oak_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Oak_gptpGetIntStatusIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Oak_gptpSetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Oak_gptpGetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Oak_gptpSetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Oak_gptpGetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Oak_gptpSetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Oak_gptpGetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Oak_gptpGetTODBusyBitStatus;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Oak_gptpTODStoreCompenIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Oak_gptpTODStoreAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Oak_gptpTODCaptureAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetPulse = &Oak_gptpSetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPulse = &Oak_gptpGetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Oak_gtaiGetPTPGlobalTime;
-    dev->SwitchDevObj.PTPObj.gptpGetPortReg = &Oak_gptpPortRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPortReg = &Oak_gptpPortRegSet;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = &Oak_gptpGlobalRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = &Oak_gptpGlobalRegSet;
-    dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = &Oak_gptp1588v2ConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = &Oak_gptp8021asConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = &Oak_gptp8021asRevConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = &Oak_gptpPreemptTimestampSelSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = &Oak_gptpPreemptTimestampSelGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = &Oak_gptpPreemptCtrlSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = &Oak_gptpPreemptCtrlGet;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Oak_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Oak_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Oak_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Oak_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Oak_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Oak_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Oak_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Oak_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Oak_gprtSetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Oak_gprtGetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Oak_gprtSetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Oak_gprtGetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Oak_gprtSetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Oak_gprtGetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Oak_gprtSetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Oak_gprtGetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Oak_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Oak_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Oak_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Oak_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Oak_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Oak_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Oak_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Oak_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Oak_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Oak_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Oak_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Oak_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Oak_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Oak_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Oak_gprtGetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Oak_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Oak_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Oak_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Oak_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Oak_gvlnSetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Oak_gvlnGetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Oak_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Oak_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Oak_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Oak_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Oak_gprtSetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Oak_gprtGetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Oak_gprtSetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Oak_gprtGetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Oak_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Oak_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Oak_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Oak_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Oak_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Oak_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Oak_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Oak_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Oak_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Oak_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = &Oak_gprtSetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = &Oak_gprtGetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Oak_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Oak_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Oak_gprtSetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Oak_gprtGetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Oak_gprtSetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Oak_gprtGetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Oak_gprtSetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Oak_gprtGetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Oak_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Oak_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Oak_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Oak_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Oak_gprtSetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Oak_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Oak_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Oak_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Oak_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Oak_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Oak_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Oak_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Oak_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Oak_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Oak_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Oak_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Oak_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Oak_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Oak_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Oak_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Oak_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Oak_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Oak_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Oak_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Oak_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &Oak_gprtSetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &Oak_gprtGetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Oak_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Oak_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &Oak_gprtSetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &Oak_gprtGetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Oak_gprtSetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Oak_gprtGetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Oak_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Oak_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Oak_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Oak_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = &Oak_gprtSetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = &Oak_gprtGetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = &Oak_gprtSetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = &Oak_gprtGetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = &Oak_gprtSetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = &Oak_gprtGetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Oak_gprtRegDump;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Oak_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Oak_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Oak_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Oak_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Oak_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Oak_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Oak_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Oak_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Oak_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Oak_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Oak_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Oak_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &Oak_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &Oak_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Oak_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Oak_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Oak_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Oak_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Oak_gvtuDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Oak_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Oak_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Oak_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Oak_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Oak_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Oak_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Oak_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Oak_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Oak_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Oak_EEPROMReadIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &Oak_EEPROMChipSelSetIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &Oak_EEPROMChipSelGetIntf;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Oak_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Oak_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Oak_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Oak_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Oak_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Oak_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Oak_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Oak_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Oak_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Oak_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Oak_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Oak_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Oak_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Oak_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Oak_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Oak_gprtGetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Oak_gprtSetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Oak_gqosGetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Oak_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Oak_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Oak_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Oak_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Oak_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Oak_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Oak_gqosSetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Oak_gprtRewriteDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Oak_gprtSetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Oak_gprtGetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Oak_gprtSetCosToDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Oak_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Oak_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Oak_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Oak_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Oak_gstatsGetPortAllCntersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Oak_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Oak_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Oak_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Oak_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Oak_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Oak_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Oak_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Oak_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Oak_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Oak_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Oak_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Oak_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Oak_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Oak_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Oak_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Oak_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Oak_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Oak_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Oak_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Oak_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Oak_gsysQbvRead;
-
-	dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &Oak_gBpeEnableSet;
-	dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &Oak_gBpeEnableGet;
-	dev->SwitchDevObj.ECIDObj.gecidAddEntry = &Oak_gecidAddEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidDump = &Oak_gecidDump;
-	dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &Oak_gecidFindEcidEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidFlushAll = &Oak_gecidFlushAll;
-	dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &Oak_gecidFlushEntry;
-	dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &Oak_gecidGetEcidEntryNextIntf;
-	dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &Oak_gecidGetEntryCount;
-	dev->SwitchDevObj.ECIDObj.gecidMove = &Oak_gecidMove;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Oak_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Oak_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Oak_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Oak_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Oak_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Oak_gtcamFindEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Oak_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Oak_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Oak_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Oak_gtcamRemoveEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Oak_gtcamEgrFlushEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Oak_gtcamEgrFlushAllPortsIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Oak_gtcamEgrLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Oak_gtcamEgrGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Oak_gtcamEgrReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &Oak_gtcamDump;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Oak_gtcamAdvConfigIntf;
-
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &Oak_gtcamRCLoadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &Oak_gtcamRCFlushAllEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &Oak_gtcamRCFlushEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &Oak_gtcamRCReadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &Oak_gtcamRCGetNextEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &Oak_gtcamRCFindEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &Oak_gtcamRCEntryDump;
-
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &Oak_gtcamRCCompLoadIntf;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &Oak_gtcamRCCompFlushAll;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &Oak_gtcamRCCompFlushPort;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &Oak_gtcamRCCompReadIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Oak_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Oak_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Oak_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuEcidDump = &Oak_msdRmuEcidDumpIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Oak_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Oak_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Oak_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Oak_msdRmuMultiRegAccessIntf;
-	dev->SwitchDevObj.RMUObj.grmuRegDump = &Oak_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Oak_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Oak_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Oak_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Oak_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Oak_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Oak_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Oak_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Oak_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Oak_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Oak_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Oak_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Oak_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &Oak_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Oak_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Oak_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Oak_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Oak_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Oak_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Oak_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Oak_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Oak_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Oak_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Oak_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Oak_gledDump;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &Oak_gpolicySetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &Oak_gpolicyGetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &Oak_gpolicySetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &Oak_gpolicyGetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &Oak_gpolicySetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &Oak_gpolicyGetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &Oak_gpolicySetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &Oak_gpolicyGetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &Oak_gpolicySetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &Oak_gpolicyGetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &Oak_gpolicySetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &Oak_gpolicyGetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &Oak_gpolicySetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &Oak_gpolicyGetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &Oak_gpolicySetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &Oak_gpolicyGetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &Oak_gpolicySetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &Oak_gpolicyGetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &Oak_gpolicySetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &Oak_gpolicyGetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &Oak_gpolicySetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &Oak_gpolicyGetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &Oak_gpolicySetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &Oak_gpolicyGetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &Oak_gprtSetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &Oak_gprtGetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &Oak_gpolicySetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &Oak_gpolicyGetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &Oak_gpolicySetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &Oak_gpolicyGetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &Oak_gpolicySetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &Oak_gpolicyGetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &Oak_gpolicySetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &Oak_gpolicyGetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &Oak_gpolicySetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &Oak_gpolicyGetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &Oak_gprtSetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &Oak_gprtGetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &Oak_gpolicySetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &Oak_gpolicyGetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &Oak_gprtSetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &Oak_gprtGetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &Oak_gpolicySetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &Oak_gpolicyGetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &Oak_gpolicySetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &Oak_gpolicyGetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &Oak_gpolicySetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &Oak_gpolicyGetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &Oak_gpolicySetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &Oak_gpolicyGetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &Oak_gpolicySetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &Oak_gpolicyGetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = &Oak_gpolicySetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &Oak_gpolicyGetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &Oak_gpolicySetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &Oak_gpolicyGetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = &Oak_gpolicyDump;
+	obj->ATUObj.gfdbAddMacEntry = &Oak_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Oak_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Oak_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Oak_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Oak_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Oak_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Oak_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Oak_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Oak_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Oak_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Oak_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Oak_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Oak_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Oak_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Oak_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Oak_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Oak_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Oak_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Oak_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Oak_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Oak_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Oak_gfdbGetNStaticEntryCountFid;
+	obj->ATUObj.gfdbDump = &Oak_gfdbDump;
+
+	obj->ARPObj.garpLoadMcEntry = &Oak_garpLoadMcEntryIntf;
+	obj->ARPObj.garpLoadUcEntry = &Oak_garpLoadUcEntryIntf;
+	obj->ARPObj.garpFlushEntry = &Oak_garpFlushEntry;
+	obj->ARPObj.garpFlushAll = &Oak_garpFlushAll;
+	obj->ARPObj.garpReadEntry = &Oak_garpReadEntryIntf;
+	obj->ARPObj.garpGetNextEntry = &Oak_garpGetNextEntryIntf;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &Oak_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &Oak_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &Oak_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &Oak_gqavSetPortQpriXRate;
+
+	obj->PHYCTRLObj.serdesReset = &Oak_serdesReset;
+
+	obj->PTPObj.gptpSetIntEnable = &Oak_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &Oak_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &Oak_gptpSetPortPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &Oak_gptpGetPortPTPEn;
+	obj->PTPObj.gptpGetTimeStamp = &Oak_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &Oak_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &Oak_gptpResetTimeStamp;
+	obj->PTPObj.gptpGetIntStatus = &Oak_gptpGetIntStatusIntf;
+	obj->PTPObj.gptpSetMeanPathDelay = &Oak_gptpSetMeanPathDelay;
+	obj->PTPObj.gptpGetMeanPathDelay = &Oak_gptpGetMeanPathDelay;
+	obj->PTPObj.gptpSetIgrPathDelayAsym = &Oak_gptpSetIgrPathDelayAsym;
+	obj->PTPObj.gptpGetIgrPathDelayAsym = &Oak_gptpGetIgrPathDelayAsym;
+	obj->PTPObj.gptpSetEgrPathDelayAsym = &Oak_gptpSetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetEgrPathDelayAsym = &Oak_gptpGetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetTODBusyBitStatus = &Oak_gptpGetTODBusyBitStatus;
+	obj->PTPObj.gptpTODStoreCompensation = &Oak_gptpTODStoreCompenIntf;
+	obj->PTPObj.gptpTODStoreAll = &Oak_gptpTODStoreAllIntf;
+	obj->PTPObj.gptpTODCaptureAll = &Oak_gptpTODCaptureAllIntf;
+	obj->PTPObj.gptpSetPulse = &Oak_gptpSetPulseIntf;
+	obj->PTPObj.gptpGetPulse = &Oak_gptpGetPulseIntf;
+	obj->PTPObj.gtaiGetPTPGlobalTime = &Oak_gtaiGetPTPGlobalTime;
+    obj->PTPObj.gptpGetPortReg = &Oak_gptpPortRegGet;
+    obj->PTPObj.gptpSetPortReg = &Oak_gptpPortRegSet;
+    obj->PTPObj.gptpGetGlobalReg = &Oak_gptpGlobalRegGet;
+    obj->PTPObj.gptpSetGlobalReg = &Oak_gptpGlobalRegSet;
+    obj->PTPObj.gptpSet1588v2Config = &Oak_gptp1588v2ConfigSetIntf;
+    obj->PTPObj.gptpSet8021asConfig = &Oak_gptp8021asConfigSetIntf;
+    obj->PTPObj.gptpSet8021asRevConfig = &Oak_gptp8021asRevConfigSetIntf;
+    obj->PTPObj.gptpSetPreemptTsSel = &Oak_gptpPreemptTimestampSelSet;
+    obj->PTPObj.gptpGetPreemptTsSel = &Oak_gptpPreemptTimestampSelGet;
+    obj->PTPObj.gptpSetPreemptCtrl = &Oak_gptpPreemptCtrlSet;
+    obj->PTPObj.gptpGetPreemptCtrl = &Oak_gptpPreemptCtrlGet;
+
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Oak_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Oak_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Oak_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Oak_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Oak_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Oak_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Oak_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Oak_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtSetQueueToPause = &Oak_gprtSetQueueToPause;
+	obj->PORTCTRLObj.gprtGetQueueToPause = &Oak_gprtGetQueueToPause;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Oak_gprtSetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Oak_gprtGetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Oak_gprtSetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Oak_gprtGetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Oak_gprtSetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Oak_gprtGetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Oak_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Oak_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Oak_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Oak_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Oak_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Oak_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Oak_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Oak_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Oak_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Oak_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Oak_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Oak_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Oak_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Oak_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Oak_gprtGetARPMirror;
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Oak_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Oak_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Oak_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Oak_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Oak_gvlnSetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Oak_gvlnGetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Oak_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Oak_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Oak_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Oak_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Oak_gprtSetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Oak_gprtGetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Oak_gprtSetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Oak_gprtGetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Oak_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Oak_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Oak_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Oak_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Oak_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Oak_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Oak_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Oak_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Oak_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Oak_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetSpecifiedMTU = &Oak_gprtSetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtGetSpecifiedMTU = &Oak_gprtGetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Oak_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Oak_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Oak_gprtSetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Oak_gprtGetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Oak_gprtSetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Oak_gprtGetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Oak_gprtSetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Oak_gprtGetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Oak_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Oak_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Oak_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Oak_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = &Oak_gprtSetAllowVidZero;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = &Oak_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Oak_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Oak_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Oak_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Oak_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Oak_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Oak_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Oak_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Oak_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Oak_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Oak_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Oak_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Oak_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Oak_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Oak_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Oak_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Oak_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Oak_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Oak_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Oak_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetPortECID = &Oak_gprtSetPortECID;
+	obj->PORTCTRLObj.gprtGetPortECID = &Oak_gprtGetPortECID;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Oak_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Oak_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = &Oak_gprtSetIgnoreETag;
+	obj->PORTCTRLObj.gprtGetIgnoreETag = &Oak_gprtGetIgnoreETag;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Oak_gprtSetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Oak_gprtGetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Oak_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Oak_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Oak_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Oak_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtSetPreemptEnable = &Oak_gprtSetPreemptEnable;
+	obj->PORTCTRLObj.gprtGetPreemptEnable = &Oak_gprtGetPreemptEnable;
+	obj->PORTCTRLObj.gprtSetPreemptSize = &Oak_gprtSetPreemptSize;
+	obj->PORTCTRLObj.gprtGetPreemptSize = &Oak_gprtGetPreemptSize;
+	obj->PORTCTRLObj.gprtSetPreemptQueue = &Oak_gprtSetPreemptQueue;
+	obj->PORTCTRLObj.gprtGetPreemptQueue = &Oak_gprtGetPreemptQueue;
+	obj->PORTCTRLObj.gprtRegDump = &Oak_gprtRegDump;
+
+	obj->STUObj.gstuAddEntry = &Oak_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Oak_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &Oak_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Oak_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &Oak_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Oak_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Oak_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Oak_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Oak_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Oak_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Oak_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Oak_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &Oak_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &Oak_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &Oak_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Oak_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Oak_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Oak_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Oak_gvtuDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Oak_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Oak_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Oak_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Oak_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Oak_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Oak_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Oak_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Oak_gsysGetTrunkRouting;
+
+	obj->EEPROMObj.geepromWrite = &Oak_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Oak_EEPROMReadIntf;
+	obj->EEPROMObj.geepromSetMChipSel = &Oak_EEPROMChipSelSetIntf;
+	obj->EEPROMObj.geepromGetMChipSel = &Oak_EEPROMChipSelGetIntf;
+
+	obj->INTObj.gdevIntEnableSet = &Oak_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Oak_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Oak_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Oak_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Oak_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Oak_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Oak_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Oak_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Oak_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &Oak_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Oak_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Oak_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Oak_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Oak_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Oak_gpirlAdvConfigDisableIntf;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = &Oak_gprtGetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = &Oak_gprtSetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Oak_gqosGetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Oak_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Oak_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetDefQpri = &Oak_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Oak_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Oak_gprtGetDefFpri;
+	obj->QOSMAPObj.gprtSetInitialPri = &Oak_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Oak_gqosSetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtRewriteDscp = &Oak_gprtRewriteDscp;
+	obj->QOSMAPObj.gprtSetCosToQueue = &Oak_gprtSetCosToQueue;
+	obj->QOSMAPObj.gprtGetCosToQueue = &Oak_gprtGetCosToQueue;
+	obj->QOSMAPObj.gprtSetCosToDscp = &Oak_gprtSetCosToDscp;
+	obj->QOSMAPObj.gprtGetCosToDscp = &Oak_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Oak_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Oak_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Oak_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Oak_gstatsGetPortAllCntersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Oak_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Oak_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Oak_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &Oak_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &Oak_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &Oak_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Oak_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &Oak_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &Oak_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Oak_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Oak_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Oak_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Oak_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Oak_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Oak_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Oak_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Oak_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Oak_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Oak_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Oak_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Oak_gsysQbvRead;
+
+	obj->ECIDObj.gBpeEnableSet = &Oak_gBpeEnableSet;
+	obj->ECIDObj.gBpeEnableGet = &Oak_gBpeEnableGet;
+	obj->ECIDObj.gecidAddEntry = &Oak_gecidAddEntryIntf;
+	obj->ECIDObj.gecidDump = &Oak_gecidDump;
+	obj->ECIDObj.gecidFindEcidEntry = &Oak_gecidFindEcidEntryIntf;
+	obj->ECIDObj.gecidFlushAll = &Oak_gecidFlushAll;
+	obj->ECIDObj.gecidFlushEntry = &Oak_gecidFlushEntry;
+	obj->ECIDObj.gecidGetEcidEntryNext = &Oak_gecidGetEcidEntryNextIntf;
+	obj->ECIDObj.gecidGetEntryCount = &Oak_gecidGetEntryCount;
+	obj->ECIDObj.gecidMove = &Oak_gecidMove;
+
+	obj->TCAMObj.gtcamFlushAll = &Oak_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &Oak_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &Oak_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &Oak_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &Oak_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamFindEntry = &Oak_gtcamFindEntryIntf;
+	obj->TCAMObj.gtcamSetMode = &Oak_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &Oak_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &Oak_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &Oak_gtcamRemoveEntryPort;
+	obj->TCAMObj.gtcamEgrFlushEntry = &Oak_gtcamEgrFlushEntryIntf;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Oak_gtcamEgrFlushAllPortsIntf;
+	obj->TCAMObj.gtcamEgrLoadEntry = &Oak_gtcamEgrLoadEntryIntf;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = &Oak_gtcamEgrGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamEgrReadTCAMData = &Oak_gtcamEgrReadTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &Oak_gtcamDump;
+	obj->TCAMObj.gtcamAdvConfig = &Oak_gtcamAdvConfigIntf;
+
+	obj->TCAMRCObj.gtcamRCLoadEntry = &Oak_gtcamRCLoadEntryIntf;
+	obj->TCAMRCObj.gtcamRCFlushAllEntry = &Oak_gtcamRCFlushAllEntry;
+	obj->TCAMRCObj.gtcamRCFlushEntry = &Oak_gtcamRCFlushEntry;
+	obj->TCAMRCObj.gtcamRCReadEntry = &Oak_gtcamRCReadEntryIntf;
+	obj->TCAMRCObj.gtcamRCGetNextEntry = &Oak_gtcamRCGetNextEntryIntf;
+	obj->TCAMRCObj.gtcamRCFindEntry = &Oak_gtcamRCFindEntryIntf;
+	obj->TCAMRCObj.gtcamRCEntryDump = &Oak_gtcamRCEntryDump;
+
+	obj->TCAMRCCompObj.gtcamRCCompLoad = &Oak_gtcamRCCompLoadIntf;
+	obj->TCAMRCCompObj.gtcamRCCompFlushAll = &Oak_gtcamRCCompFlushAll;
+	obj->TCAMRCCompObj.gtcamRCCompFlushPort = &Oak_gtcamRCCompFlushPort;
+	obj->TCAMRCCompObj.gtcamRCCompRead = &Oak_gtcamRCCompReadIntf;
+
+	obj->RMUObj.grmuTCAMDump = &Oak_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &Oak_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &Oak_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuEcidDump = &Oak_msdRmuEcidDumpIntf;
+
+	obj->RMUObj.grmuGetID = &Oak_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Oak_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Oak_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Oak_msdRmuMultiRegAccessIntf;
+	obj->RMUObj.grmuRegDump = &Oak_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Oak_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Oak_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Oak_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Oak_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Oak_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Oak_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Oak_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Oak_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Oak_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Oak_msdGetSMIExtPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &Oak_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Oak_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &Oak_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Oak_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Oak_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Oak_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Oak_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Oak_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Oak_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Oak_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Oak_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Oak_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Oak_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Oak_gledDump;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = &Oak_gpolicySetMgmtCtrl;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = &Oak_gpolicyGetMgmtCtrl;
+	obj->POLICYObj.gpolicySetCpuDest = &Oak_gpolicySetCpuDest;
+	obj->POLICYObj.gpolicyGetCpuDest = &Oak_gpolicyGetCpuDest;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = &Oak_gpolicySetIgrMonitorDest;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = &Oak_gpolicyGetIgrMonitorDest;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = &Oak_gpolicySetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &Oak_gpolicyGetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicySetMGMTPri = &Oak_gpolicySetMGMTPri;
+	obj->POLICYObj.gpolicyGetMGMTPri = &Oak_gpolicyGetMGMTPri;
+	obj->POLICYObj.gpolicySetRouteDest = &Oak_gpolicySetRouteDest;
+	obj->POLICYObj.gpolicyGetRouteDest = &Oak_gpolicyGetRouteDest;
+	obj->POLICYObj.gpolicySetMirrorDest = &Oak_gpolicySetMirrorDest;
+	obj->POLICYObj.gpolicyGetMirrorDest = &Oak_gpolicyGetMirrorDest;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = &Oak_gpolicySetIllegalIPAddr;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = &Oak_gpolicyGetIllegalIPAddr;
+	obj->POLICYObj.gpolicySetDipDaMismatch = &Oak_gpolicySetDipDaMismatch;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = &Oak_gpolicyGetDipDaMismatch;
+	obj->POLICYObj.gpolicySetZeroSIP = &Oak_gpolicySetZeroSIP;
+	obj->POLICYObj.gpolicyGetZeroSIP = &Oak_gpolicyGetZeroSIP;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = &Oak_gpolicySetMcTtlExceeded;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = &Oak_gpolicyGetMcTtlExceeded;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = &Oak_gpolicySetUcTtlExceeded;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = &Oak_gpolicyGetUcTtlExceeded;
+	obj->POLICYObj.gprtSetPortTtlThreshold = &Oak_gprtSetPortTtlThreshold;
+	obj->POLICYObj.gprtGetPortTtlThreshold = &Oak_gprtGetPortTtlThreshold;
+	obj->POLICYObj.gpolicySetIpHdrErr = &Oak_gpolicySetIpHdrErr;
+	obj->POLICYObj.gpolicyGetIpHdrErr = &Oak_gpolicyGetIpHdrErr;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = &Oak_gpolicySetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &Oak_gpolicyGetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &Oak_gpolicySetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &Oak_gpolicyGetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicySetTCPSYN = &Oak_gpolicySetTCPSYN;
+	obj->POLICYObj.gpolicyGetTCPSYN = &Oak_gpolicyGetTCPSYN;
+	obj->POLICYObj.gpolicySetTCPHSize = &Oak_gpolicySetTCPHSize;
+	obj->POLICYObj.gpolicyGetTCPHSize = &Oak_gpolicyGetTCPHSize;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = &Oak_gprtSetPortTCPMinHdrSize;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = &Oak_gprtGetPortTCPMinHdrSize;
+	obj->POLICYObj.gpolicySetICMPSize = &Oak_gpolicySetICMPSize;
+	obj->POLICYObj.gpolicyGetICMPSize = &Oak_gpolicyGetICMPSize;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = &Oak_gprtSetPortICMPMaxSize;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = &Oak_gprtGetPortICMPMaxSize;
+	obj->POLICYObj.gpolicySetUDPPort = &Oak_gpolicySetUDPPort;
+	obj->POLICYObj.gpolicyGetUDPPort = &Oak_gpolicyGetUDPPort;
+	obj->POLICYObj.gpolicySetTCPPort = &Oak_gpolicySetTCPPort;
+	obj->POLICYObj.gpolicyGetTCPPort = &Oak_gpolicyGetTCPPort;
+	obj->POLICYObj.gpolicySetTCPSynFin = &Oak_gpolicySetTCPSynFin;
+	obj->POLICYObj.gpolicyGetTCPSynFin = &Oak_gpolicyGetTCPSynFin;
+	obj->POLICYObj.gpolicySetTCPFrag = &Oak_gpolicySetTCPFrag;
+	obj->POLICYObj.gpolicyGetTCPFrag = &Oak_gpolicyGetTCPFrag;
+	obj->POLICYObj.gpolicySetNearNonTPMR = &Oak_gpolicySetNearNonTPMR;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = &Oak_gpolicyGetNearNonTPMR;
+	obj->POLICYObj.gpolicySetETag = &Oak_gpolicySetETag;
+	obj->POLICYObj.gpolicyGetETag = &Oak_gpolicyGetETag;
+	obj->POLICYObj.gpolicySetNonETag = &Oak_gpolicySetNonETag;
+	obj->POLICYObj.gpolicyGetNonETag = &Oak_gpolicyGetNonETag;
+	obj->POLICYObj.gpolicyDump = &Oak_gpolicyDump;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Spruce(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Spruce(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef SPRUCE_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Spruce_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Spruce_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Spruce_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Spruce_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Spruce_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Spruce_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Spruce_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Spruce_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Spruce_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Spruce_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Spruce_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Spruce_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Spruce_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Spruce_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Spruce_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Spruce_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Spruce_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Spruce_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Spruce_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Spruce_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Spruce_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Spruce_gfdbGetNStaticEntryCountFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Spruce_gfdbDump;
-
-	dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &Spruce_garpLoadMcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &Spruce_garpLoadUcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpFlushEntry = &Spruce_garpFlushEntry;
-	dev->SwitchDevObj.ARPObj.garpFlushAll = &Spruce_garpFlushAll;
-	dev->SwitchDevObj.ARPObj.garpReadEntry = &Spruce_garpReadEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpGetNextEntry = &Spruce_garpGetNextEntryIntf;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Spruce_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Spruce_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Spruce_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Spruce_gqavSetPortQpriXRate;
-
-	dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Spruce_serdesReset;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Spruce_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Spruce_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Spruce_gptpSetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Spruce_gptpGetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Spruce_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Spruce_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Spruce_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Spruce_gptpGetIntStatusIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Spruce_gptpSetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Spruce_gptpGetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Spruce_gptpSetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Spruce_gptpGetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Spruce_gptpSetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Spruce_gptpGetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Spruce_gptpGetTODBusyBitStatus;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Spruce_gptpTODStoreCompenIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Spruce_gptpTODStoreAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Spruce_gptpTODCaptureAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetPulse = &Spruce_gptpSetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPulse = &Spruce_gptpGetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Spruce_gtaiGetPTPGlobalTime;
-    dev->SwitchDevObj.PTPObj.gptpGetPortReg = &Spruce_gptpPortRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPortReg = &Spruce_gptpPortRegSet;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = &Spruce_gptpGlobalRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = &Spruce_gptpGlobalRegSet;
-    dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = &Spruce_gptp1588v2ConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = &Spruce_gptp8021asConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = &Spruce_gptp8021asRevCfgSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = &Spruce_gptpPreemptTsSelSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = &Spruce_gptpPreemptTsSelGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = &Spruce_gptpPreemptCtrlSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = &Spruce_gptpPreemptCtrlGet;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Spruce_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Spruce_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Spruce_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Spruce_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Spruce_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Spruce_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Spruce_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Spruce_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Spruce_gprtSetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Spruce_gprtGetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Spruce_gprtSetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Spruce_gprtGetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Spruce_gprtSetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Spruce_gprtGetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Spruce_gprtSetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Spruce_gprtGetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Spruce_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Spruce_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Spruce_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Spruce_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Spruce_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Spruce_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Spruce_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Spruce_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Spruce_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Spruce_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Spruce_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Spruce_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Spruce_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Spruce_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Spruce_gprtGetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Spruce_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Spruce_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Spruce_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Spruce_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Spruce_gvlnSetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Spruce_gvlnGetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Spruce_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Spruce_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Spruce_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Spruce_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Spruce_gprtSetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Spruce_gprtGetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Spruce_gprtSetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Spruce_gprtGetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Spruce_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Spruce_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Spruce_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Spruce_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Spruce_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Spruce_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Spruce_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Spruce_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Spruce_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Spruce_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = &Spruce_gprtSetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = &Spruce_gprtGetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Spruce_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Spruce_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Spruce_gprtSetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Spruce_gprtGetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Spruce_gprtSetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Spruce_gprtGetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Spruce_gprtSetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Spruce_gprtGetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Spruce_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Spruce_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Spruce_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Spruce_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Spruce_gprtSetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Spruce_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Spruce_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Spruce_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Spruce_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Spruce_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Spruce_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Spruce_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Spruce_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Spruce_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Spruce_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Spruce_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Spruce_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Spruce_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Spruce_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Spruce_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Spruce_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Spruce_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Spruce_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Spruce_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Spruce_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &Spruce_gprtSetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &Spruce_gprtGetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Spruce_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Spruce_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &Spruce_gprtSetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &Spruce_gprtGetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Spruce_gprtSetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Spruce_gprtGetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Spruce_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Spruce_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Spruce_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Spruce_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = &Spruce_gprtSetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = &Spruce_gprtGetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = &Spruce_gprtSetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = &Spruce_gprtGetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = &Spruce_gprtSetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = &Spruce_gprtGetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Spruce_gprtRegDump;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Spruce_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Spruce_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Spruce_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Spruce_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Spruce_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Spruce_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Spruce_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Spruce_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Spruce_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Spruce_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Spruce_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Spruce_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &Spruce_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &Spruce_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Spruce_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Spruce_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Spruce_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Spruce_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Spruce_gvtuDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Spruce_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Spruce_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Spruce_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Spruce_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Spruce_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Spruce_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Spruce_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Spruce_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Spruce_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Spruce_EEPROMReadIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &Spruce_EEPROMChipSelSetIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &Spruce_EEPROMChipSelGetIntf;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Spruce_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Spruce_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Spruce_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Spruce_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Spruce_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Spruce_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Spruce_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Spruce_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Spruce_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Spruce_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Spruce_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Spruce_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Spruce_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Spruce_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Spruce_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Spruce_gprtGetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Spruce_gprtSetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Spruce_gqosGetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Spruce_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Spruce_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Spruce_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Spruce_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Spruce_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Spruce_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Spruce_gqosSetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Spruce_gprtRewriteDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Spruce_gprtSetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Spruce_gprtGetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Spruce_gprtSetCosToDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Spruce_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Spruce_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Spruce_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Spruce_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Spruce_gstatsGetPortAllCntersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Spruce_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Spruce_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Spruce_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Spruce_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Spruce_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Spruce_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Spruce_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &Spruce_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &Spruce_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Spruce_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Spruce_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Spruce_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Spruce_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Spruce_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Spruce_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Spruce_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Spruce_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Spruce_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Spruce_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Spruce_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Spruce_gsysQbvRead;
-
-	dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &Spruce_gBpeEnableSet;
-	dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &Spruce_gBpeEnableGet;
-	dev->SwitchDevObj.ECIDObj.gecidAddEntry = &Spruce_gecidAddEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidDump = &Spruce_gecidDump;
-	dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &Spruce_gecidFindEcidEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidFlushAll = &Spruce_gecidFlushAll;
-	dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &Spruce_gecidFlushEntry;
-	dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &Spruce_gecidGetEcidEntryNextIntf;
-	dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &Spruce_gecidGetEntryCount;
-	dev->SwitchDevObj.ECIDObj.gecidMove = &Spruce_gecidMove;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Spruce_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Spruce_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Spruce_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Spruce_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Spruce_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Spruce_gtcamFindEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Spruce_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Spruce_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Spruce_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Spruce_gtcamRemoveEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Spruce_gtcamEgrFlushEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Spruce_gtcamEgrFlushAllPortsIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Spruce_gtcamEgrLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Spruce_gtcamEgrGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Spruce_gtcamEgrReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &Spruce_gtcamDump;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Spruce_gtcamAdvConfigIntf;
-
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &Spruce_gtcamRCLoadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &Spruce_gtcamRCFlushAllEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &Spruce_gtcamRCFlushEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &Spruce_gtcamRCReadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &Spruce_gtcamRCGetNextEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &Spruce_gtcamRCFindEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &Spruce_gtcamRCEntryDump;
-
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &Spruce_gtcamRCCompLoadIntf;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &Spruce_gtcamRCCompFlushAll;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &Spruce_gtcamRCCompFlushPort;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &Spruce_gtcamRCCompReadIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Spruce_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Spruce_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Spruce_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuEcidDump = &Spruce_msdRmuEcidDumpIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Spruce_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Spruce_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Spruce_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Spruce_msdRmuMultiRegAccessIntf;
-	dev->SwitchDevObj.RMUObj.grmuRegDump = &Spruce_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Spruce_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Spruce_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Spruce_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Spruce_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Spruce_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Spruce_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Spruce_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Spruce_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Spruce_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Spruce_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Spruce_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Spruce_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &Spruce_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Spruce_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Spruce_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Spruce_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Spruce_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Spruce_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Spruce_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Spruce_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Spruce_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Spruce_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Spruce_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Spruce_gledDump;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &Spruce_gpolicySetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &Spruce_gpolicyGetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &Spruce_gpolicySetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &Spruce_gpolicyGetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &Spruce_gpolicySetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &Spruce_gpolicyGetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &Spruce_gpolicySetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &Spruce_gpolicyGetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &Spruce_gpolicySetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &Spruce_gpolicyGetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &Spruce_gpolicySetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &Spruce_gpolicyGetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &Spruce_gpolicySetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &Spruce_gpolicyGetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &Spruce_gpolicySetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &Spruce_gpolicyGetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &Spruce_gpolicySetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &Spruce_gpolicyGetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &Spruce_gpolicySetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &Spruce_gpolicyGetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &Spruce_gpolicySetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &Spruce_gpolicyGetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &Spruce_gpolicySetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &Spruce_gpolicyGetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &Spruce_gprtSetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &Spruce_gprtGetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &Spruce_gpolicySetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &Spruce_gpolicyGetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &Spruce_gpolicySetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &Spruce_gpolicyGetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &Spruce_gpolicySetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &Spruce_gpolicyGetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &Spruce_gpolicySetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &Spruce_gpolicyGetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &Spruce_gpolicySetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &Spruce_gpolicyGetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &Spruce_gprtSetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &Spruce_gprtGetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &Spruce_gpolicySetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &Spruce_gpolicyGetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &Spruce_gprtSetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &Spruce_gprtGetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &Spruce_gpolicySetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &Spruce_gpolicyGetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &Spruce_gpolicySetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &Spruce_gpolicyGetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &Spruce_gpolicySetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &Spruce_gpolicyGetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &Spruce_gpolicySetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &Spruce_gpolicyGetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &Spruce_gpolicySetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &Spruce_gpolicyGetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = &Spruce_gpolicySetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &Spruce_gpolicyGetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &Spruce_gpolicySetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &Spruce_gpolicyGetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = &Spruce_gpolicyDump;
+	obj->ATUObj.gfdbAddMacEntry = &Spruce_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Spruce_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Spruce_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Spruce_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Spruce_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Spruce_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Spruce_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Spruce_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Spruce_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Spruce_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Spruce_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Spruce_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Spruce_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Spruce_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Spruce_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Spruce_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Spruce_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Spruce_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Spruce_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Spruce_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Spruce_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Spruce_gfdbGetNStaticEntryCountFid;
+	obj->ATUObj.gfdbDump = &Spruce_gfdbDump;
+
+	obj->ARPObj.garpLoadMcEntry = &Spruce_garpLoadMcEntryIntf;
+	obj->ARPObj.garpLoadUcEntry = &Spruce_garpLoadUcEntryIntf;
+	obj->ARPObj.garpFlushEntry = &Spruce_garpFlushEntry;
+	obj->ARPObj.garpFlushAll = &Spruce_garpFlushAll;
+	obj->ARPObj.garpReadEntry = &Spruce_garpReadEntryIntf;
+	obj->ARPObj.garpGetNextEntry = &Spruce_garpGetNextEntryIntf;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &Spruce_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &Spruce_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &Spruce_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &Spruce_gqavSetPortQpriXRate;
+
+	obj->PHYCTRLObj.serdesReset = &Spruce_serdesReset;
+
+	obj->PTPObj.gptpSetIntEnable = &Spruce_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &Spruce_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &Spruce_gptpSetPortPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &Spruce_gptpGetPortPTPEn;
+	obj->PTPObj.gptpGetTimeStamp = &Spruce_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &Spruce_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &Spruce_gptpResetTimeStamp;
+	obj->PTPObj.gptpGetIntStatus = &Spruce_gptpGetIntStatusIntf;
+	obj->PTPObj.gptpSetMeanPathDelay = &Spruce_gptpSetMeanPathDelay;
+	obj->PTPObj.gptpGetMeanPathDelay = &Spruce_gptpGetMeanPathDelay;
+	obj->PTPObj.gptpSetIgrPathDelayAsym = &Spruce_gptpSetIgrPathDelayAsym;
+	obj->PTPObj.gptpGetIgrPathDelayAsym = &Spruce_gptpGetIgrPathDelayAsym;
+	obj->PTPObj.gptpSetEgrPathDelayAsym = &Spruce_gptpSetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetEgrPathDelayAsym = &Spruce_gptpGetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetTODBusyBitStatus = &Spruce_gptpGetTODBusyBitStatus;
+	obj->PTPObj.gptpTODStoreCompensation = &Spruce_gptpTODStoreCompenIntf;
+	obj->PTPObj.gptpTODStoreAll = &Spruce_gptpTODStoreAllIntf;
+	obj->PTPObj.gptpTODCaptureAll = &Spruce_gptpTODCaptureAllIntf;
+	obj->PTPObj.gptpSetPulse = &Spruce_gptpSetPulseIntf;
+	obj->PTPObj.gptpGetPulse = &Spruce_gptpGetPulseIntf;
+	obj->PTPObj.gtaiGetPTPGlobalTime = &Spruce_gtaiGetPTPGlobalTime;
+    obj->PTPObj.gptpGetPortReg = &Spruce_gptpPortRegGet;
+    obj->PTPObj.gptpSetPortReg = &Spruce_gptpPortRegSet;
+    obj->PTPObj.gptpGetGlobalReg = &Spruce_gptpGlobalRegGet;
+    obj->PTPObj.gptpSetGlobalReg = &Spruce_gptpGlobalRegSet;
+    obj->PTPObj.gptpSet1588v2Config = &Spruce_gptp1588v2ConfigSetIntf;
+    obj->PTPObj.gptpSet8021asConfig = &Spruce_gptp8021asConfigSetIntf;
+    obj->PTPObj.gptpSet8021asRevConfig = &Spruce_gptp8021asRevCfgSetIntf;
+    obj->PTPObj.gptpSetPreemptTsSel = &Spruce_gptpPreemptTsSelSet;
+    obj->PTPObj.gptpGetPreemptTsSel = &Spruce_gptpPreemptTsSelGet;
+    obj->PTPObj.gptpSetPreemptCtrl = &Spruce_gptpPreemptCtrlSet;
+    obj->PTPObj.gptpGetPreemptCtrl = &Spruce_gptpPreemptCtrlGet;
+
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Spruce_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Spruce_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Spruce_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Spruce_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Spruce_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Spruce_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Spruce_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Spruce_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtSetQueueToPause = &Spruce_gprtSetQueueToPause;
+	obj->PORTCTRLObj.gprtGetQueueToPause = &Spruce_gprtGetQueueToPause;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Spruce_gprtSetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Spruce_gprtGetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Spruce_gprtSetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Spruce_gprtGetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Spruce_gprtSetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Spruce_gprtGetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Spruce_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Spruce_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Spruce_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Spruce_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Spruce_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Spruce_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Spruce_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Spruce_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Spruce_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Spruce_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Spruce_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Spruce_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Spruce_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Spruce_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Spruce_gprtGetARPMirror;
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Spruce_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Spruce_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Spruce_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Spruce_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Spruce_gvlnSetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Spruce_gvlnGetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Spruce_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Spruce_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Spruce_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Spruce_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Spruce_gprtSetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Spruce_gprtGetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Spruce_gprtSetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Spruce_gprtGetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Spruce_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Spruce_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Spruce_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Spruce_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Spruce_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Spruce_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Spruce_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Spruce_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Spruce_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Spruce_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetSpecifiedMTU = &Spruce_gprtSetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtGetSpecifiedMTU = &Spruce_gprtGetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Spruce_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Spruce_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Spruce_gprtSetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Spruce_gprtGetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Spruce_gprtSetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Spruce_gprtGetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Spruce_gprtSetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Spruce_gprtGetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Spruce_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Spruce_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Spruce_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Spruce_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = &Spruce_gprtSetAllowVidZero;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = &Spruce_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Spruce_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Spruce_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Spruce_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Spruce_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Spruce_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Spruce_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Spruce_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Spruce_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Spruce_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Spruce_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Spruce_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Spruce_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Spruce_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Spruce_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Spruce_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Spruce_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Spruce_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Spruce_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Spruce_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetPortECID = &Spruce_gprtSetPortECID;
+	obj->PORTCTRLObj.gprtGetPortECID = &Spruce_gprtGetPortECID;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Spruce_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Spruce_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = &Spruce_gprtSetIgnoreETag;
+	obj->PORTCTRLObj.gprtGetIgnoreETag = &Spruce_gprtGetIgnoreETag;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Spruce_gprtSetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Spruce_gprtGetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Spruce_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Spruce_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Spruce_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Spruce_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtSetPreemptEnable = &Spruce_gprtSetPreemptEnable;
+	obj->PORTCTRLObj.gprtGetPreemptEnable = &Spruce_gprtGetPreemptEnable;
+	obj->PORTCTRLObj.gprtSetPreemptSize = &Spruce_gprtSetPreemptSize;
+	obj->PORTCTRLObj.gprtGetPreemptSize = &Spruce_gprtGetPreemptSize;
+	obj->PORTCTRLObj.gprtSetPreemptQueue = &Spruce_gprtSetPreemptQueue;
+	obj->PORTCTRLObj.gprtGetPreemptQueue = &Spruce_gprtGetPreemptQueue;
+	obj->PORTCTRLObj.gprtRegDump = &Spruce_gprtRegDump;
+
+	obj->STUObj.gstuAddEntry = &Spruce_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Spruce_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &Spruce_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Spruce_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &Spruce_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Spruce_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Spruce_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Spruce_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Spruce_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Spruce_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Spruce_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Spruce_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &Spruce_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &Spruce_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &Spruce_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Spruce_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Spruce_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Spruce_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Spruce_gvtuDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Spruce_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Spruce_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Spruce_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Spruce_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Spruce_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Spruce_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Spruce_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Spruce_gsysGetTrunkRouting;
+
+	obj->EEPROMObj.geepromWrite = &Spruce_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Spruce_EEPROMReadIntf;
+	obj->EEPROMObj.geepromSetMChipSel = &Spruce_EEPROMChipSelSetIntf;
+	obj->EEPROMObj.geepromGetMChipSel = &Spruce_EEPROMChipSelGetIntf;
+
+	obj->INTObj.gdevIntEnableSet = &Spruce_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Spruce_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Spruce_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Spruce_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Spruce_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Spruce_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Spruce_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Spruce_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Spruce_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &Spruce_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Spruce_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Spruce_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Spruce_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Spruce_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Spruce_gpirlAdvConfigDisableIntf;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = &Spruce_gprtGetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = &Spruce_gprtSetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Spruce_gqosGetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Spruce_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Spruce_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetDefQpri = &Spruce_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Spruce_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Spruce_gprtGetDefFpri;
+	obj->QOSMAPObj.gprtSetInitialPri = &Spruce_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Spruce_gqosSetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtRewriteDscp = &Spruce_gprtRewriteDscp;
+	obj->QOSMAPObj.gprtSetCosToQueue = &Spruce_gprtSetCosToQueue;
+	obj->QOSMAPObj.gprtGetCosToQueue = &Spruce_gprtGetCosToQueue;
+	obj->QOSMAPObj.gprtSetCosToDscp = &Spruce_gprtSetCosToDscp;
+	obj->QOSMAPObj.gprtGetCosToDscp = &Spruce_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Spruce_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Spruce_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Spruce_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Spruce_gstatsGetPortAllCntersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Spruce_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Spruce_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Spruce_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &Spruce_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &Spruce_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &Spruce_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Spruce_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &Spruce_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &Spruce_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Spruce_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Spruce_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Spruce_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Spruce_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Spruce_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Spruce_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Spruce_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Spruce_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Spruce_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Spruce_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Spruce_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Spruce_gsysQbvRead;
+
+	obj->ECIDObj.gBpeEnableSet = &Spruce_gBpeEnableSet;
+	obj->ECIDObj.gBpeEnableGet = &Spruce_gBpeEnableGet;
+	obj->ECIDObj.gecidAddEntry = &Spruce_gecidAddEntryIntf;
+	obj->ECIDObj.gecidDump = &Spruce_gecidDump;
+	obj->ECIDObj.gecidFindEcidEntry = &Spruce_gecidFindEcidEntryIntf;
+	obj->ECIDObj.gecidFlushAll = &Spruce_gecidFlushAll;
+	obj->ECIDObj.gecidFlushEntry = &Spruce_gecidFlushEntry;
+	obj->ECIDObj.gecidGetEcidEntryNext = &Spruce_gecidGetEcidEntryNextIntf;
+	obj->ECIDObj.gecidGetEntryCount = &Spruce_gecidGetEntryCount;
+	obj->ECIDObj.gecidMove = &Spruce_gecidMove;
+
+	obj->TCAMObj.gtcamFlushAll = &Spruce_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &Spruce_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &Spruce_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &Spruce_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &Spruce_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamFindEntry = &Spruce_gtcamFindEntryIntf;
+	obj->TCAMObj.gtcamSetMode = &Spruce_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &Spruce_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &Spruce_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &Spruce_gtcamRemoveEntryPort;
+	obj->TCAMObj.gtcamEgrFlushEntry = &Spruce_gtcamEgrFlushEntryIntf;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Spruce_gtcamEgrFlushAllPortsIntf;
+	obj->TCAMObj.gtcamEgrLoadEntry = &Spruce_gtcamEgrLoadEntryIntf;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = &Spruce_gtcamEgrGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamEgrReadTCAMData = &Spruce_gtcamEgrReadTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &Spruce_gtcamDump;
+	obj->TCAMObj.gtcamAdvConfig = &Spruce_gtcamAdvConfigIntf;
+
+	obj->TCAMRCObj.gtcamRCLoadEntry = &Spruce_gtcamRCLoadEntryIntf;
+	obj->TCAMRCObj.gtcamRCFlushAllEntry = &Spruce_gtcamRCFlushAllEntry;
+	obj->TCAMRCObj.gtcamRCFlushEntry = &Spruce_gtcamRCFlushEntry;
+	obj->TCAMRCObj.gtcamRCReadEntry = &Spruce_gtcamRCReadEntryIntf;
+	obj->TCAMRCObj.gtcamRCGetNextEntry = &Spruce_gtcamRCGetNextEntryIntf;
+	obj->TCAMRCObj.gtcamRCFindEntry = &Spruce_gtcamRCFindEntryIntf;
+	obj->TCAMRCObj.gtcamRCEntryDump = &Spruce_gtcamRCEntryDump;
+
+	obj->TCAMRCCompObj.gtcamRCCompLoad = &Spruce_gtcamRCCompLoadIntf;
+	obj->TCAMRCCompObj.gtcamRCCompFlushAll = &Spruce_gtcamRCCompFlushAll;
+	obj->TCAMRCCompObj.gtcamRCCompFlushPort = &Spruce_gtcamRCCompFlushPort;
+	obj->TCAMRCCompObj.gtcamRCCompRead = &Spruce_gtcamRCCompReadIntf;
+
+	obj->RMUObj.grmuTCAMDump = &Spruce_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &Spruce_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &Spruce_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuEcidDump = &Spruce_msdRmuEcidDumpIntf;
+
+	obj->RMUObj.grmuGetID = &Spruce_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Spruce_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Spruce_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Spruce_msdRmuMultiRegAccessIntf;
+	obj->RMUObj.grmuRegDump = &Spruce_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Spruce_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Spruce_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Spruce_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Spruce_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Spruce_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Spruce_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Spruce_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Spruce_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Spruce_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Spruce_msdGetSMIExtPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &Spruce_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Spruce_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &Spruce_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Spruce_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Spruce_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Spruce_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Spruce_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Spruce_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Spruce_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Spruce_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Spruce_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Spruce_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Spruce_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Spruce_gledDump;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = &Spruce_gpolicySetMgmtCtrl;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = &Spruce_gpolicyGetMgmtCtrl;
+	obj->POLICYObj.gpolicySetCpuDest = &Spruce_gpolicySetCpuDest;
+	obj->POLICYObj.gpolicyGetCpuDest = &Spruce_gpolicyGetCpuDest;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = &Spruce_gpolicySetIgrMonitorDest;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = &Spruce_gpolicyGetIgrMonitorDest;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = &Spruce_gpolicySetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &Spruce_gpolicyGetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicySetMGMTPri = &Spruce_gpolicySetMGMTPri;
+	obj->POLICYObj.gpolicyGetMGMTPri = &Spruce_gpolicyGetMGMTPri;
+	obj->POLICYObj.gpolicySetRouteDest = &Spruce_gpolicySetRouteDest;
+	obj->POLICYObj.gpolicyGetRouteDest = &Spruce_gpolicyGetRouteDest;
+	obj->POLICYObj.gpolicySetMirrorDest = &Spruce_gpolicySetMirrorDest;
+	obj->POLICYObj.gpolicyGetMirrorDest = &Spruce_gpolicyGetMirrorDest;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = &Spruce_gpolicySetIllegalIPAddr;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = &Spruce_gpolicyGetIllegalIPAddr;
+	obj->POLICYObj.gpolicySetDipDaMismatch = &Spruce_gpolicySetDipDaMismatch;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = &Spruce_gpolicyGetDipDaMismatch;
+	obj->POLICYObj.gpolicySetZeroSIP = &Spruce_gpolicySetZeroSIP;
+	obj->POLICYObj.gpolicyGetZeroSIP = &Spruce_gpolicyGetZeroSIP;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = &Spruce_gpolicySetMcTtlExceeded;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = &Spruce_gpolicyGetMcTtlExceeded;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = &Spruce_gpolicySetUcTtlExceeded;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = &Spruce_gpolicyGetUcTtlExceeded;
+	obj->POLICYObj.gprtSetPortTtlThreshold = &Spruce_gprtSetPortTtlThreshold;
+	obj->POLICYObj.gprtGetPortTtlThreshold = &Spruce_gprtGetPortTtlThreshold;
+	obj->POLICYObj.gpolicySetIpHdrErr = &Spruce_gpolicySetIpHdrErr;
+	obj->POLICYObj.gpolicyGetIpHdrErr = &Spruce_gpolicyGetIpHdrErr;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = &Spruce_gpolicySetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &Spruce_gpolicyGetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &Spruce_gpolicySetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &Spruce_gpolicyGetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicySetTCPSYN = &Spruce_gpolicySetTCPSYN;
+	obj->POLICYObj.gpolicyGetTCPSYN = &Spruce_gpolicyGetTCPSYN;
+	obj->POLICYObj.gpolicySetTCPHSize = &Spruce_gpolicySetTCPHSize;
+	obj->POLICYObj.gpolicyGetTCPHSize = &Spruce_gpolicyGetTCPHSize;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = &Spruce_gprtSetPortTCPMinHdrSize;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = &Spruce_gprtGetPortTCPMinHdrSize;
+	obj->POLICYObj.gpolicySetICMPSize = &Spruce_gpolicySetICMPSize;
+	obj->POLICYObj.gpolicyGetICMPSize = &Spruce_gpolicyGetICMPSize;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = &Spruce_gprtSetPortICMPMaxSize;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = &Spruce_gprtGetPortICMPMaxSize;
+	obj->POLICYObj.gpolicySetUDPPort = &Spruce_gpolicySetUDPPort;
+	obj->POLICYObj.gpolicyGetUDPPort = &Spruce_gpolicyGetUDPPort;
+	obj->POLICYObj.gpolicySetTCPPort = &Spruce_gpolicySetTCPPort;
+	obj->POLICYObj.gpolicyGetTCPPort = &Spruce_gpolicyGetTCPPort;
+	obj->POLICYObj.gpolicySetTCPSynFin = &Spruce_gpolicySetTCPSynFin;
+	obj->POLICYObj.gpolicyGetTCPSynFin = &Spruce_gpolicyGetTCPSynFin;
+	obj->POLICYObj.gpolicySetTCPFrag = &Spruce_gpolicySetTCPFrag;
+	obj->POLICYObj.gpolicyGetTCPFrag = &Spruce_gpolicyGetTCPFrag;
+	obj->POLICYObj.gpolicySetNearNonTPMR = &Spruce_gpolicySetNearNonTPMR;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = &Spruce_gpolicyGetNearNonTPMR;
+	obj->POLICYObj.gpolicySetETag = &Spruce_gpolicySetETag;
+	obj->POLICYObj.gpolicyGetETag = &Spruce_gpolicyGetETag;
+	obj->POLICYObj.gpolicySetNonETag = &Spruce_gpolicySetNonETag;
+	obj->POLICYObj.gpolicyGetNonETag = &Spruce_gpolicyGetNonETag;
+	obj->POLICYObj.gpolicyDump = &Spruce_gpolicyDump;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_BonsaiZ1(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_BonsaiZ1(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef BONSAIZ1_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &BonsaiZ1_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &BonsaiZ1_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &BonsaiZ1_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &BonsaiZ1_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &BonsaiZ1_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &BonsaiZ1_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &BonsaiZ1_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &BonsaiZ1_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &BonsaiZ1_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &BonsaiZ1_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &BonsaiZ1_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &BonsaiZ1_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &BonsaiZ1_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &BonsaiZ1_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &BonsaiZ1_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &BonsaiZ1_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &BonsaiZ1_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &BonsaiZ1_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &BonsaiZ1_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &BonsaiZ1_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &BonsaiZ1_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &BonsaiZ1_gfdbGetNStaticEntryCountFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &BonsaiZ1_gfdbDump;
-
-	dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &BonsaiZ1_garpLoadMcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &BonsaiZ1_garpLoadUcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpFlushEntry = &BonsaiZ1_garpFlushEntry;
-	dev->SwitchDevObj.ARPObj.garpFlushAll = &BonsaiZ1_garpFlushAll;
-	dev->SwitchDevObj.ARPObj.garpReadEntry = &BonsaiZ1_garpReadEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpGetNextEntry = &BonsaiZ1_garpGetNextEntryIntf;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &BonsaiZ1_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &BonsaiZ1_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &BonsaiZ1_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &BonsaiZ1_gqavSetPortQpriXRate;
-
-	dev->SwitchDevObj.PHYCTRLObj.serdesReset = &BonsaiZ1_serdesReset;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &BonsaiZ1_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &BonsaiZ1_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &BonsaiZ1_gptpSetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &BonsaiZ1_gptpGetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &BonsaiZ1_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &BonsaiZ1_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &BonsaiZ1_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &BonsaiZ1_gptpGetIntStatusIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &BonsaiZ1_gptpSetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &BonsaiZ1_gptpGetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &BonsaiZ1_gptpSetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &BonsaiZ1_gptpGetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &BonsaiZ1_gptpSetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &BonsaiZ1_gptpGetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &BonsaiZ1_gptpGetTODBusyBitStatus;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &BonsaiZ1_gptpTODStoreCompenIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &BonsaiZ1_gptpTODStoreAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &BonsaiZ1_gptpTODCaptureAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetPulse = &BonsaiZ1_gptpSetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPulse = &BonsaiZ1_gptpGetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &BonsaiZ1_gtaiGetPTPGlobalTime;
-    dev->SwitchDevObj.PTPObj.gptpGetPortReg = &BonsaiZ1_gptpPortRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPortReg = &BonsaiZ1_gptpPortRegSet;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = &BonsaiZ1_gptpGlobalRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = &BonsaiZ1_gptpGlobalRegSet;
-    dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = &BonsaiZ1_gptp1588v2ConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = &BonsaiZ1_gptp8021asConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = &BonsaiZ1_gptp8021asRevCfgSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = &BonsaiZ1_gptpPreemptTsSelSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = &BonsaiZ1_gptpPreemptTsSelGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = &BonsaiZ1_gptpPreemptCtrlSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = &BonsaiZ1_gptpPreemptCtrlGet;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &BonsaiZ1_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &BonsaiZ1_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &BonsaiZ1_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &BonsaiZ1_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &BonsaiZ1_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &BonsaiZ1_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &BonsaiZ1_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &BonsaiZ1_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &BonsaiZ1_gprtSetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &BonsaiZ1_gprtGetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &BonsaiZ1_gprtSetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &BonsaiZ1_gprtGetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &BonsaiZ1_gprtSetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &BonsaiZ1_gprtGetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &BonsaiZ1_gprtSetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &BonsaiZ1_gprtGetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &BonsaiZ1_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &BonsaiZ1_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &BonsaiZ1_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &BonsaiZ1_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &BonsaiZ1_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &BonsaiZ1_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &BonsaiZ1_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &BonsaiZ1_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &BonsaiZ1_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &BonsaiZ1_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &BonsaiZ1_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &BonsaiZ1_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &BonsaiZ1_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &BonsaiZ1_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &BonsaiZ1_gprtGetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &BonsaiZ1_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &BonsaiZ1_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &BonsaiZ1_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &BonsaiZ1_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &BonsaiZ1_gvlnSetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &BonsaiZ1_gvlnGetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &BonsaiZ1_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &BonsaiZ1_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &BonsaiZ1_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &BonsaiZ1_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &BonsaiZ1_gprtSetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &BonsaiZ1_gprtGetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &BonsaiZ1_gprtSetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &BonsaiZ1_gprtGetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &BonsaiZ1_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &BonsaiZ1_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &BonsaiZ1_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &BonsaiZ1_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &BonsaiZ1_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &BonsaiZ1_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &BonsaiZ1_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &BonsaiZ1_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &BonsaiZ1_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &BonsaiZ1_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = &BonsaiZ1_gprtSetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = &BonsaiZ1_gprtGetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &BonsaiZ1_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &BonsaiZ1_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &BonsaiZ1_gprtSetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &BonsaiZ1_gprtGetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &BonsaiZ1_gprtSetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &BonsaiZ1_gprtGetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &BonsaiZ1_gprtSetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &BonsaiZ1_gprtGetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &BonsaiZ1_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &BonsaiZ1_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &BonsaiZ1_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &BonsaiZ1_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &BonsaiZ1_gprtSetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &BonsaiZ1_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &BonsaiZ1_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &BonsaiZ1_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &BonsaiZ1_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &BonsaiZ1_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &BonsaiZ1_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &BonsaiZ1_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &BonsaiZ1_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &BonsaiZ1_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &BonsaiZ1_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &BonsaiZ1_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &BonsaiZ1_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &BonsaiZ1_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &BonsaiZ1_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &BonsaiZ1_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &BonsaiZ1_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &BonsaiZ1_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &BonsaiZ1_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &BonsaiZ1_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &BonsaiZ1_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &BonsaiZ1_gprtSetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &BonsaiZ1_gprtGetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &BonsaiZ1_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &BonsaiZ1_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &BonsaiZ1_gprtSetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &BonsaiZ1_gprtGetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &BonsaiZ1_gprtSetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &BonsaiZ1_gprtGetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &BonsaiZ1_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &BonsaiZ1_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &BonsaiZ1_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &BonsaiZ1_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = &BonsaiZ1_gprtSetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = &BonsaiZ1_gprtGetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = &BonsaiZ1_gprtSetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = &BonsaiZ1_gprtGetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = &BonsaiZ1_gprtSetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = &BonsaiZ1_gprtGetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &BonsaiZ1_gprtRegDump;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &BonsaiZ1_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &BonsaiZ1_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &BonsaiZ1_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &BonsaiZ1_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &BonsaiZ1_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &BonsaiZ1_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &BonsaiZ1_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &BonsaiZ1_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &BonsaiZ1_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &BonsaiZ1_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &BonsaiZ1_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &BonsaiZ1_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &BonsaiZ1_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &BonsaiZ1_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &BonsaiZ1_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &BonsaiZ1_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &BonsaiZ1_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &BonsaiZ1_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &BonsaiZ1_gvtuDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &BonsaiZ1_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &BonsaiZ1_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &BonsaiZ1_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &BonsaiZ1_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &BonsaiZ1_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &BonsaiZ1_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &BonsaiZ1_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &BonsaiZ1_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &BonsaiZ1_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &BonsaiZ1_EEPROMReadIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &BonsaiZ1_EEPROMChipSelSetIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &BonsaiZ1_EEPROMChipSelGetIntf;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &BonsaiZ1_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &BonsaiZ1_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &BonsaiZ1_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &BonsaiZ1_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &BonsaiZ1_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &BonsaiZ1_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &BonsaiZ1_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &BonsaiZ1_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &BonsaiZ1_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &BonsaiZ1_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &BonsaiZ1_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &BonsaiZ1_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &BonsaiZ1_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &BonsaiZ1_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &BonsaiZ1_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &BonsaiZ1_gprtGetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &BonsaiZ1_gprtSetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &BonsaiZ1_gqosGetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &BonsaiZ1_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &BonsaiZ1_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &BonsaiZ1_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &BonsaiZ1_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &BonsaiZ1_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &BonsaiZ1_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &BonsaiZ1_gqosSetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &BonsaiZ1_gprtRewriteDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &BonsaiZ1_gprtSetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &BonsaiZ1_gprtGetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &BonsaiZ1_gprtSetCosToDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &BonsaiZ1_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &BonsaiZ1_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &BonsaiZ1_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &BonsaiZ1_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &BonsaiZ1_gstatsGetPortAllCntersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &BonsaiZ1_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &BonsaiZ1_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &BonsaiZ1_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &BonsaiZ1_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &BonsaiZ1_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &BonsaiZ1_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &BonsaiZ1_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = &BonsaiZ1_gsysSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = &BonsaiZ1_gsysGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &BonsaiZ1_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &BonsaiZ1_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &BonsaiZ1_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &BonsaiZ1_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &BonsaiZ1_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &BonsaiZ1_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &BonsaiZ1_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &BonsaiZ1_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &BonsaiZ1_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &BonsaiZ1_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &BonsaiZ1_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &BonsaiZ1_gsysQbvRead;
-
-	dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &BonsaiZ1_gBpeEnableSet;
-	dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &BonsaiZ1_gBpeEnableGet;
-	dev->SwitchDevObj.ECIDObj.gecidAddEntry = &BonsaiZ1_gecidAddEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidDump = &BonsaiZ1_gecidDump;
-	dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &BonsaiZ1_gecidFindEcidEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidFlushAll = &BonsaiZ1_gecidFlushAll;
-	dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &BonsaiZ1_gecidFlushEntry;
-	dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &BonsaiZ1_gecidGetEcidEntryNextIntf;
-	dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &BonsaiZ1_gecidGetEntryCount;
-	dev->SwitchDevObj.ECIDObj.gecidMove = &BonsaiZ1_gecidMove;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &BonsaiZ1_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &BonsaiZ1_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &BonsaiZ1_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &BonsaiZ1_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &BonsaiZ1_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &BonsaiZ1_gtcamFindEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &BonsaiZ1_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &BonsaiZ1_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &BonsaiZ1_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &BonsaiZ1_gtcamRemoveEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &BonsaiZ1_gtcamEgrFlushEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &BonsaiZ1_gtcamEgrFlushAllPortsIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &BonsaiZ1_gtcamEgrLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &BonsaiZ1_gtcamEgrGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &BonsaiZ1_gtcamEgrReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &BonsaiZ1_gtcamDump;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &BonsaiZ1_gtcamAdvConfigIntf;
-
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &BonsaiZ1_gtcamRCLoadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &BonsaiZ1_gtcamRCFlushAllEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &BonsaiZ1_gtcamRCFlushEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &BonsaiZ1_gtcamRCReadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &BonsaiZ1_gtcamRCGetNextEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &BonsaiZ1_gtcamRCFindEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &BonsaiZ1_gtcamRCEntryDump;
-
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &BonsaiZ1_gtcamRCCompLoadIntf;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &BonsaiZ1_gtcamRCCompFlushAll;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &BonsaiZ1_gtcamRCCompFlushPort;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &BonsaiZ1_gtcamRCCompReadIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &BonsaiZ1_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &BonsaiZ1_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &BonsaiZ1_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuEcidDump = &BonsaiZ1_msdRmuEcidDumpIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &BonsaiZ1_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &BonsaiZ1_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &BonsaiZ1_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &BonsaiZ1_msdRmuMultiRegAccessIntf;
-	dev->SwitchDevObj.RMUObj.grmuRegDump = &BonsaiZ1_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &BonsaiZ1_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &BonsaiZ1_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &BonsaiZ1_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &BonsaiZ1_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &BonsaiZ1_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &BonsaiZ1_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &BonsaiZ1_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &BonsaiZ1_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &BonsaiZ1_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &BonsaiZ1_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &BonsaiZ1_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &BonsaiZ1_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &BonsaiZ1_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &BonsaiZ1_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &BonsaiZ1_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &BonsaiZ1_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &BonsaiZ1_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &BonsaiZ1_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &BonsaiZ1_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &BonsaiZ1_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &BonsaiZ1_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &BonsaiZ1_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &BonsaiZ1_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &BonsaiZ1_gledDump;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &BonsaiZ1_gpolicySetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &BonsaiZ1_gpolicyGetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &BonsaiZ1_gpolicySetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &BonsaiZ1_gpolicyGetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &BonsaiZ1_gpolicySetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &BonsaiZ1_gpolicyGetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &BonsaiZ1_gpolicySetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &BonsaiZ1_gpolicyGetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &BonsaiZ1_gpolicySetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &BonsaiZ1_gpolicyGetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &BonsaiZ1_gpolicySetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &BonsaiZ1_gpolicyGetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &BonsaiZ1_gpolicySetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &BonsaiZ1_gpolicyGetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &BonsaiZ1_gpolicySetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &BonsaiZ1_gpolicyGetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &BonsaiZ1_gpolicySetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &BonsaiZ1_gpolicyGetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &BonsaiZ1_gpolicySetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &BonsaiZ1_gpolicyGetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &BonsaiZ1_gpolicySetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &BonsaiZ1_gpolicyGetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &BonsaiZ1_gpolicySetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &BonsaiZ1_gpolicyGetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &BonsaiZ1_gprtSetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &BonsaiZ1_gprtGetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &BonsaiZ1_gpolicySetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &BonsaiZ1_gpolicyGetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &BonsaiZ1_gpolicySetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &BonsaiZ1_gpolicyGetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &BonsaiZ1_gpolicySetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &BonsaiZ1_gpolicyGetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &BonsaiZ1_gpolicySetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &BonsaiZ1_gpolicyGetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &BonsaiZ1_gpolicySetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &BonsaiZ1_gpolicyGetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &BonsaiZ1_gprtSetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &BonsaiZ1_gprtGetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &BonsaiZ1_gpolicySetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &BonsaiZ1_gpolicyGetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &BonsaiZ1_gprtSetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &BonsaiZ1_gprtGetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &BonsaiZ1_gpolicySetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &BonsaiZ1_gpolicyGetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &BonsaiZ1_gpolicySetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &BonsaiZ1_gpolicyGetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &BonsaiZ1_gpolicySetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &BonsaiZ1_gpolicyGetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &BonsaiZ1_gpolicySetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &BonsaiZ1_gpolicyGetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &BonsaiZ1_gpolicySetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &BonsaiZ1_gpolicyGetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = &BonsaiZ1_gpolicySetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &BonsaiZ1_gpolicyGetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &BonsaiZ1_gpolicySetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &BonsaiZ1_gpolicyGetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = &BonsaiZ1_gpolicyDump;
+	obj->ATUObj.gfdbAddMacEntry = &BonsaiZ1_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &BonsaiZ1_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &BonsaiZ1_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &BonsaiZ1_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &BonsaiZ1_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &BonsaiZ1_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &BonsaiZ1_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &BonsaiZ1_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &BonsaiZ1_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &BonsaiZ1_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &BonsaiZ1_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &BonsaiZ1_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &BonsaiZ1_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &BonsaiZ1_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &BonsaiZ1_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &BonsaiZ1_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &BonsaiZ1_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &BonsaiZ1_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &BonsaiZ1_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &BonsaiZ1_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &BonsaiZ1_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &BonsaiZ1_gfdbGetNStaticEntryCountFid;
+	obj->ATUObj.gfdbDump = &BonsaiZ1_gfdbDump;
+
+	obj->ARPObj.garpLoadMcEntry = &BonsaiZ1_garpLoadMcEntryIntf;
+	obj->ARPObj.garpLoadUcEntry = &BonsaiZ1_garpLoadUcEntryIntf;
+	obj->ARPObj.garpFlushEntry = &BonsaiZ1_garpFlushEntry;
+	obj->ARPObj.garpFlushAll = &BonsaiZ1_garpFlushAll;
+	obj->ARPObj.garpReadEntry = &BonsaiZ1_garpReadEntryIntf;
+	obj->ARPObj.garpGetNextEntry = &BonsaiZ1_garpGetNextEntryIntf;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &BonsaiZ1_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &BonsaiZ1_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &BonsaiZ1_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &BonsaiZ1_gqavSetPortQpriXRate;
+
+	obj->PHYCTRLObj.serdesReset = &BonsaiZ1_serdesReset;
+
+	obj->PTPObj.gptpSetIntEnable = &BonsaiZ1_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &BonsaiZ1_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &BonsaiZ1_gptpSetPortPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &BonsaiZ1_gptpGetPortPTPEn;
+	obj->PTPObj.gptpGetTimeStamp = &BonsaiZ1_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &BonsaiZ1_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &BonsaiZ1_gptpResetTimeStamp;
+	obj->PTPObj.gptpGetIntStatus = &BonsaiZ1_gptpGetIntStatusIntf;
+	obj->PTPObj.gptpSetMeanPathDelay = &BonsaiZ1_gptpSetMeanPathDelay;
+	obj->PTPObj.gptpGetMeanPathDelay = &BonsaiZ1_gptpGetMeanPathDelay;
+	obj->PTPObj.gptpSetIgrPathDelayAsym = &BonsaiZ1_gptpSetIgrPathDelayAsym;
+	obj->PTPObj.gptpGetIgrPathDelayAsym = &BonsaiZ1_gptpGetIgrPathDelayAsym;
+	obj->PTPObj.gptpSetEgrPathDelayAsym = &BonsaiZ1_gptpSetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetEgrPathDelayAsym = &BonsaiZ1_gptpGetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetTODBusyBitStatus = &BonsaiZ1_gptpGetTODBusyBitStatus;
+	obj->PTPObj.gptpTODStoreCompensation = &BonsaiZ1_gptpTODStoreCompenIntf;
+	obj->PTPObj.gptpTODStoreAll = &BonsaiZ1_gptpTODStoreAllIntf;
+	obj->PTPObj.gptpTODCaptureAll = &BonsaiZ1_gptpTODCaptureAllIntf;
+	obj->PTPObj.gptpSetPulse = &BonsaiZ1_gptpSetPulseIntf;
+	obj->PTPObj.gptpGetPulse = &BonsaiZ1_gptpGetPulseIntf;
+	obj->PTPObj.gtaiGetPTPGlobalTime = &BonsaiZ1_gtaiGetPTPGlobalTime;
+    obj->PTPObj.gptpGetPortReg = &BonsaiZ1_gptpPortRegGet;
+    obj->PTPObj.gptpSetPortReg = &BonsaiZ1_gptpPortRegSet;
+    obj->PTPObj.gptpGetGlobalReg = &BonsaiZ1_gptpGlobalRegGet;
+    obj->PTPObj.gptpSetGlobalReg = &BonsaiZ1_gptpGlobalRegSet;
+    obj->PTPObj.gptpSet1588v2Config = &BonsaiZ1_gptp1588v2ConfigSetIntf;
+    obj->PTPObj.gptpSet8021asConfig = &BonsaiZ1_gptp8021asConfigSetIntf;
+    obj->PTPObj.gptpSet8021asRevConfig = &BonsaiZ1_gptp8021asRevCfgSetIntf;
+    obj->PTPObj.gptpSetPreemptTsSel = &BonsaiZ1_gptpPreemptTsSelSet;
+    obj->PTPObj.gptpGetPreemptTsSel = &BonsaiZ1_gptpPreemptTsSelGet;
+    obj->PTPObj.gptpSetPreemptCtrl = &BonsaiZ1_gptpPreemptCtrlSet;
+    obj->PTPObj.gptpGetPreemptCtrl = &BonsaiZ1_gptpPreemptCtrlGet;
+
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &BonsaiZ1_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &BonsaiZ1_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &BonsaiZ1_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &BonsaiZ1_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &BonsaiZ1_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &BonsaiZ1_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &BonsaiZ1_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &BonsaiZ1_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtSetQueueToPause = &BonsaiZ1_gprtSetQueueToPause;
+	obj->PORTCTRLObj.gprtGetQueueToPause = &BonsaiZ1_gprtGetQueueToPause;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &BonsaiZ1_gprtSetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &BonsaiZ1_gprtGetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &BonsaiZ1_gprtSetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &BonsaiZ1_gprtGetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &BonsaiZ1_gprtSetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &BonsaiZ1_gprtGetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &BonsaiZ1_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &BonsaiZ1_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &BonsaiZ1_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &BonsaiZ1_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &BonsaiZ1_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &BonsaiZ1_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &BonsaiZ1_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &BonsaiZ1_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &BonsaiZ1_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &BonsaiZ1_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &BonsaiZ1_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &BonsaiZ1_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &BonsaiZ1_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &BonsaiZ1_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &BonsaiZ1_gprtGetARPMirror;
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &BonsaiZ1_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &BonsaiZ1_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &BonsaiZ1_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &BonsaiZ1_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &BonsaiZ1_gvlnSetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &BonsaiZ1_gvlnGetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &BonsaiZ1_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &BonsaiZ1_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &BonsaiZ1_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &BonsaiZ1_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &BonsaiZ1_gprtSetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &BonsaiZ1_gprtGetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &BonsaiZ1_gprtSetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &BonsaiZ1_gprtGetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &BonsaiZ1_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &BonsaiZ1_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &BonsaiZ1_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &BonsaiZ1_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &BonsaiZ1_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &BonsaiZ1_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &BonsaiZ1_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &BonsaiZ1_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &BonsaiZ1_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &BonsaiZ1_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetSpecifiedMTU = &BonsaiZ1_gprtSetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtGetSpecifiedMTU = &BonsaiZ1_gprtGetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &BonsaiZ1_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &BonsaiZ1_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &BonsaiZ1_gprtSetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &BonsaiZ1_gprtGetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &BonsaiZ1_gprtSetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &BonsaiZ1_gprtGetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &BonsaiZ1_gprtSetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &BonsaiZ1_gprtGetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &BonsaiZ1_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &BonsaiZ1_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &BonsaiZ1_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &BonsaiZ1_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = &BonsaiZ1_gprtSetAllowVidZero;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = &BonsaiZ1_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &BonsaiZ1_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &BonsaiZ1_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &BonsaiZ1_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &BonsaiZ1_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &BonsaiZ1_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &BonsaiZ1_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &BonsaiZ1_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &BonsaiZ1_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &BonsaiZ1_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &BonsaiZ1_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &BonsaiZ1_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &BonsaiZ1_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &BonsaiZ1_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &BonsaiZ1_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &BonsaiZ1_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &BonsaiZ1_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &BonsaiZ1_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &BonsaiZ1_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &BonsaiZ1_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetPortECID = &BonsaiZ1_gprtSetPortECID;
+	obj->PORTCTRLObj.gprtGetPortECID = &BonsaiZ1_gprtGetPortECID;
+	obj->PORTCTRLObj.gprtSetEgressMode = &BonsaiZ1_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &BonsaiZ1_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = &BonsaiZ1_gprtSetIgnoreETag;
+	obj->PORTCTRLObj.gprtGetIgnoreETag = &BonsaiZ1_gprtGetIgnoreETag;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &BonsaiZ1_gprtSetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &BonsaiZ1_gprtGetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &BonsaiZ1_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &BonsaiZ1_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &BonsaiZ1_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &BonsaiZ1_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtSetPreemptEnable = &BonsaiZ1_gprtSetPreemptEnable;
+	obj->PORTCTRLObj.gprtGetPreemptEnable = &BonsaiZ1_gprtGetPreemptEnable;
+	obj->PORTCTRLObj.gprtSetPreemptSize = &BonsaiZ1_gprtSetPreemptSize;
+	obj->PORTCTRLObj.gprtGetPreemptSize = &BonsaiZ1_gprtGetPreemptSize;
+	obj->PORTCTRLObj.gprtSetPreemptQueue = &BonsaiZ1_gprtSetPreemptQueue;
+	obj->PORTCTRLObj.gprtGetPreemptQueue = &BonsaiZ1_gprtGetPreemptQueue;
+	obj->PORTCTRLObj.gprtRegDump = &BonsaiZ1_gprtRegDump;
+
+	obj->STUObj.gstuAddEntry = &BonsaiZ1_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &BonsaiZ1_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &BonsaiZ1_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &BonsaiZ1_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &BonsaiZ1_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &BonsaiZ1_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &BonsaiZ1_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &BonsaiZ1_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &BonsaiZ1_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &BonsaiZ1_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &BonsaiZ1_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &BonsaiZ1_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &BonsaiZ1_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &BonsaiZ1_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &BonsaiZ1_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &BonsaiZ1_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &BonsaiZ1_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &BonsaiZ1_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &BonsaiZ1_gvtuDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &BonsaiZ1_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &BonsaiZ1_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &BonsaiZ1_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &BonsaiZ1_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &BonsaiZ1_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &BonsaiZ1_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &BonsaiZ1_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &BonsaiZ1_gsysGetTrunkRouting;
+
+	obj->EEPROMObj.geepromWrite = &BonsaiZ1_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &BonsaiZ1_EEPROMReadIntf;
+	obj->EEPROMObj.geepromSetMChipSel = &BonsaiZ1_EEPROMChipSelSetIntf;
+	obj->EEPROMObj.geepromGetMChipSel = &BonsaiZ1_EEPROMChipSelGetIntf;
+
+	obj->INTObj.gdevIntEnableSet = &BonsaiZ1_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &BonsaiZ1_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &BonsaiZ1_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &BonsaiZ1_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &BonsaiZ1_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &BonsaiZ1_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &BonsaiZ1_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &BonsaiZ1_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &BonsaiZ1_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &BonsaiZ1_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &BonsaiZ1_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &BonsaiZ1_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &BonsaiZ1_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &BonsaiZ1_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &BonsaiZ1_gpirlAdvConfigDisableIntf;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = &BonsaiZ1_gprtGetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = &BonsaiZ1_gprtSetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &BonsaiZ1_gqosGetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &BonsaiZ1_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &BonsaiZ1_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetDefQpri = &BonsaiZ1_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &BonsaiZ1_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &BonsaiZ1_gprtGetDefFpri;
+	obj->QOSMAPObj.gprtSetInitialPri = &BonsaiZ1_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &BonsaiZ1_gqosSetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtRewriteDscp = &BonsaiZ1_gprtRewriteDscp;
+	obj->QOSMAPObj.gprtSetCosToQueue = &BonsaiZ1_gprtSetCosToQueue;
+	obj->QOSMAPObj.gprtGetCosToQueue = &BonsaiZ1_gprtGetCosToQueue;
+	obj->QOSMAPObj.gprtSetCosToDscp = &BonsaiZ1_gprtSetCosToDscp;
+	obj->QOSMAPObj.gprtGetCosToDscp = &BonsaiZ1_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &BonsaiZ1_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &BonsaiZ1_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &BonsaiZ1_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &BonsaiZ1_gstatsGetPortAllCntersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &BonsaiZ1_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &BonsaiZ1_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &BonsaiZ1_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &BonsaiZ1_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &BonsaiZ1_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &BonsaiZ1_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &BonsaiZ1_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gsysSetQoSWeight = &BonsaiZ1_gsysSetQoSWeightIntf;
+	obj->QUEUEObj.gsysGetQoSWeight = &BonsaiZ1_gsysGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &BonsaiZ1_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &BonsaiZ1_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &BonsaiZ1_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &BonsaiZ1_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetSMISetup = &BonsaiZ1_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &BonsaiZ1_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &BonsaiZ1_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &BonsaiZ1_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &BonsaiZ1_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &BonsaiZ1_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &BonsaiZ1_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &BonsaiZ1_gsysQbvRead;
+
+	obj->ECIDObj.gBpeEnableSet = &BonsaiZ1_gBpeEnableSet;
+	obj->ECIDObj.gBpeEnableGet = &BonsaiZ1_gBpeEnableGet;
+	obj->ECIDObj.gecidAddEntry = &BonsaiZ1_gecidAddEntryIntf;
+	obj->ECIDObj.gecidDump = &BonsaiZ1_gecidDump;
+	obj->ECIDObj.gecidFindEcidEntry = &BonsaiZ1_gecidFindEcidEntryIntf;
+	obj->ECIDObj.gecidFlushAll = &BonsaiZ1_gecidFlushAll;
+	obj->ECIDObj.gecidFlushEntry = &BonsaiZ1_gecidFlushEntry;
+	obj->ECIDObj.gecidGetEcidEntryNext = &BonsaiZ1_gecidGetEcidEntryNextIntf;
+	obj->ECIDObj.gecidGetEntryCount = &BonsaiZ1_gecidGetEntryCount;
+	obj->ECIDObj.gecidMove = &BonsaiZ1_gecidMove;
+
+	obj->TCAMObj.gtcamFlushAll = &BonsaiZ1_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &BonsaiZ1_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &BonsaiZ1_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &BonsaiZ1_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &BonsaiZ1_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamFindEntry = &BonsaiZ1_gtcamFindEntryIntf;
+	obj->TCAMObj.gtcamSetMode = &BonsaiZ1_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &BonsaiZ1_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &BonsaiZ1_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &BonsaiZ1_gtcamRemoveEntryPort;
+	obj->TCAMObj.gtcamEgrFlushEntry = &BonsaiZ1_gtcamEgrFlushEntryIntf;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &BonsaiZ1_gtcamEgrFlushAllPortsIntf;
+	obj->TCAMObj.gtcamEgrLoadEntry = &BonsaiZ1_gtcamEgrLoadEntryIntf;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = &BonsaiZ1_gtcamEgrGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamEgrReadTCAMData = &BonsaiZ1_gtcamEgrReadTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &BonsaiZ1_gtcamDump;
+	obj->TCAMObj.gtcamAdvConfig = &BonsaiZ1_gtcamAdvConfigIntf;
+
+	obj->TCAMRCObj.gtcamRCLoadEntry = &BonsaiZ1_gtcamRCLoadEntryIntf;
+	obj->TCAMRCObj.gtcamRCFlushAllEntry = &BonsaiZ1_gtcamRCFlushAllEntry;
+	obj->TCAMRCObj.gtcamRCFlushEntry = &BonsaiZ1_gtcamRCFlushEntry;
+	obj->TCAMRCObj.gtcamRCReadEntry = &BonsaiZ1_gtcamRCReadEntryIntf;
+	obj->TCAMRCObj.gtcamRCGetNextEntry = &BonsaiZ1_gtcamRCGetNextEntryIntf;
+	obj->TCAMRCObj.gtcamRCFindEntry = &BonsaiZ1_gtcamRCFindEntryIntf;
+	obj->TCAMRCObj.gtcamRCEntryDump = &BonsaiZ1_gtcamRCEntryDump;
+
+	obj->TCAMRCCompObj.gtcamRCCompLoad = &BonsaiZ1_gtcamRCCompLoadIntf;
+	obj->TCAMRCCompObj.gtcamRCCompFlushAll = &BonsaiZ1_gtcamRCCompFlushAll;
+	obj->TCAMRCCompObj.gtcamRCCompFlushPort = &BonsaiZ1_gtcamRCCompFlushPort;
+	obj->TCAMRCCompObj.gtcamRCCompRead = &BonsaiZ1_gtcamRCCompReadIntf;
+
+	obj->RMUObj.grmuTCAMDump = &BonsaiZ1_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &BonsaiZ1_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &BonsaiZ1_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuEcidDump = &BonsaiZ1_msdRmuEcidDumpIntf;
+
+	obj->RMUObj.grmuGetID = &BonsaiZ1_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &BonsaiZ1_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &BonsaiZ1_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &BonsaiZ1_msdRmuMultiRegAccessIntf;
+	obj->RMUObj.grmuRegDump = &BonsaiZ1_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &BonsaiZ1_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &BonsaiZ1_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &BonsaiZ1_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &BonsaiZ1_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &BonsaiZ1_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &BonsaiZ1_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &BonsaiZ1_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &BonsaiZ1_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &BonsaiZ1_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &BonsaiZ1_msdGetSMIExtPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &BonsaiZ1_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &BonsaiZ1_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &BonsaiZ1_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &BonsaiZ1_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &BonsaiZ1_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &BonsaiZ1_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &BonsaiZ1_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &BonsaiZ1_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &BonsaiZ1_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &BonsaiZ1_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &BonsaiZ1_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &BonsaiZ1_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &BonsaiZ1_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &BonsaiZ1_gledDump;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = &BonsaiZ1_gpolicySetMgmtCtrl;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = &BonsaiZ1_gpolicyGetMgmtCtrl;
+	obj->POLICYObj.gpolicySetCpuDest = &BonsaiZ1_gpolicySetCpuDest;
+	obj->POLICYObj.gpolicyGetCpuDest = &BonsaiZ1_gpolicyGetCpuDest;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = &BonsaiZ1_gpolicySetIgrMonitorDest;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = &BonsaiZ1_gpolicyGetIgrMonitorDest;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = &BonsaiZ1_gpolicySetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &BonsaiZ1_gpolicyGetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicySetMGMTPri = &BonsaiZ1_gpolicySetMGMTPri;
+	obj->POLICYObj.gpolicyGetMGMTPri = &BonsaiZ1_gpolicyGetMGMTPri;
+	obj->POLICYObj.gpolicySetRouteDest = &BonsaiZ1_gpolicySetRouteDest;
+	obj->POLICYObj.gpolicyGetRouteDest = &BonsaiZ1_gpolicyGetRouteDest;
+	obj->POLICYObj.gpolicySetMirrorDest = &BonsaiZ1_gpolicySetMirrorDest;
+	obj->POLICYObj.gpolicyGetMirrorDest = &BonsaiZ1_gpolicyGetMirrorDest;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = &BonsaiZ1_gpolicySetIllegalIPAddr;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = &BonsaiZ1_gpolicyGetIllegalIPAddr;
+	obj->POLICYObj.gpolicySetDipDaMismatch = &BonsaiZ1_gpolicySetDipDaMismatch;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = &BonsaiZ1_gpolicyGetDipDaMismatch;
+	obj->POLICYObj.gpolicySetZeroSIP = &BonsaiZ1_gpolicySetZeroSIP;
+	obj->POLICYObj.gpolicyGetZeroSIP = &BonsaiZ1_gpolicyGetZeroSIP;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = &BonsaiZ1_gpolicySetMcTtlExceeded;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = &BonsaiZ1_gpolicyGetMcTtlExceeded;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = &BonsaiZ1_gpolicySetUcTtlExceeded;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = &BonsaiZ1_gpolicyGetUcTtlExceeded;
+	obj->POLICYObj.gprtSetPortTtlThreshold = &BonsaiZ1_gprtSetPortTtlThreshold;
+	obj->POLICYObj.gprtGetPortTtlThreshold = &BonsaiZ1_gprtGetPortTtlThreshold;
+	obj->POLICYObj.gpolicySetIpHdrErr = &BonsaiZ1_gpolicySetIpHdrErr;
+	obj->POLICYObj.gpolicyGetIpHdrErr = &BonsaiZ1_gpolicyGetIpHdrErr;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = &BonsaiZ1_gpolicySetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &BonsaiZ1_gpolicyGetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &BonsaiZ1_gpolicySetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &BonsaiZ1_gpolicyGetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicySetTCPSYN = &BonsaiZ1_gpolicySetTCPSYN;
+	obj->POLICYObj.gpolicyGetTCPSYN = &BonsaiZ1_gpolicyGetTCPSYN;
+	obj->POLICYObj.gpolicySetTCPHSize = &BonsaiZ1_gpolicySetTCPHSize;
+	obj->POLICYObj.gpolicyGetTCPHSize = &BonsaiZ1_gpolicyGetTCPHSize;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = &BonsaiZ1_gprtSetPortTCPMinHdrSize;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = &BonsaiZ1_gprtGetPortTCPMinHdrSize;
+	obj->POLICYObj.gpolicySetICMPSize = &BonsaiZ1_gpolicySetICMPSize;
+	obj->POLICYObj.gpolicyGetICMPSize = &BonsaiZ1_gpolicyGetICMPSize;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = &BonsaiZ1_gprtSetPortICMPMaxSize;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = &BonsaiZ1_gprtGetPortICMPMaxSize;
+	obj->POLICYObj.gpolicySetUDPPort = &BonsaiZ1_gpolicySetUDPPort;
+	obj->POLICYObj.gpolicyGetUDPPort = &BonsaiZ1_gpolicyGetUDPPort;
+	obj->POLICYObj.gpolicySetTCPPort = &BonsaiZ1_gpolicySetTCPPort;
+	obj->POLICYObj.gpolicyGetTCPPort = &BonsaiZ1_gpolicyGetTCPPort;
+	obj->POLICYObj.gpolicySetTCPSynFin = &BonsaiZ1_gpolicySetTCPSynFin;
+	obj->POLICYObj.gpolicyGetTCPSynFin = &BonsaiZ1_gpolicyGetTCPSynFin;
+	obj->POLICYObj.gpolicySetTCPFrag = &BonsaiZ1_gpolicySetTCPFrag;
+	obj->POLICYObj.gpolicyGetTCPFrag = &BonsaiZ1_gpolicyGetTCPFrag;
+	obj->POLICYObj.gpolicySetNearNonTPMR = &BonsaiZ1_gpolicySetNearNonTPMR;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = &BonsaiZ1_gpolicyGetNearNonTPMR;
+	obj->POLICYObj.gpolicySetETag = &BonsaiZ1_gpolicySetETag;
+	obj->POLICYObj.gpolicyGetETag = &BonsaiZ1_gpolicyGetETag;
+	obj->POLICYObj.gpolicySetNonETag = &BonsaiZ1_gpolicySetNonETag;
+	obj->POLICYObj.gpolicyGetNonETag = &BonsaiZ1_gpolicyGetNonETag;
+	obj->POLICYObj.gpolicyDump = &BonsaiZ1_gpolicyDump;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Fir(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Fir(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef FIR_BUILD_IN
-    dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Fir_gfdbAddMacEntryIntf;
-    dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Fir_gfdbGetAtuEntryNextIntf;
-    dev->SwitchDevObj.ATUObj.gfdbFlush = &Fir_gfdbFlushIntf;
-    dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Fir_gfdbFlushInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbMove = &Fir_gfdbMoveIntf;
-    dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Fir_gfdbMoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Fir_gfdbPortRemoveIntf;
-    dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Fir_gfdbPortRemoveInDBIntf;
-    dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Fir_gfdbDelAtuEntry;
-    dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Fir_gfdbGetViolationIntf;
-    dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Fir_gfdbFindAtuMacEntryIntf;
-    dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Fir_gfdbSetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Fir_gfdbGetAgingTimeout;
-    dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Fir_gfdbSetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Fir_gfdbGetLearn2All;
-    dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Fir_gfdbSetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Fir_gfdbGetPortLearnLimit;
-    dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Fir_gfdbGetPortLearnCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Fir_gfdbGetEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Fir_gfdbGetEntryCountPerFid;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Fir_gfdbGetNonStaticEntryCount;
-    dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Fir_gfdbGetNStaticEntryCountFid;
-    dev->SwitchDevObj.ATUObj.gfdbDump = &Fir_gfdbDump;
-
-    dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &Fir_garpLoadMcEntryIntf;
-    dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &Fir_garpLoadUcEntryIntf;
-    dev->SwitchDevObj.ARPObj.garpFlushEntry = &Fir_garpFlushEntry;
-    dev->SwitchDevObj.ARPObj.garpFlushAll = &Fir_garpFlushAll;
-    dev->SwitchDevObj.ARPObj.garpReadEntry = &Fir_garpReadEntryIntf;
-    dev->SwitchDevObj.ARPObj.garpGetNextEntry = &Fir_garpGetNextEntryIntf;
-
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Fir_gqavGetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Fir_gqavSetPortQpriXHiLimit;
-    dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Fir_gqavGetPortQpriXRate;
-    dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Fir_gqavSetPortQpriXRate;
-
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Fir_serdesReset;
-
-    dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Fir_gptpSetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Fir_gptpGetIntEnableIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Fir_gptpSetPortPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Fir_gptpGetPortPTPEn;
-    dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Fir_gptpGetTimeStampIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Fir_gptpGetTSValidSt;
-    dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Fir_gptpResetTimeStamp;
-    dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Fir_gptpGetIntStatusIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Fir_gptpSetMeanPathDelay;
-    dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Fir_gptpGetMeanPathDelay;
-    dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Fir_gptpSetIgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Fir_gptpGetIgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Fir_gptpSetEgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Fir_gptpGetEgrPathDelayAsym;
-    dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Fir_gptpGetTODBusyBitStatus;
-    dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Fir_gptpTODStoreCompenIntf;
-    dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Fir_gptpTODStoreAllIntf;
-    dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Fir_gptpTODCaptureAllIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPulse = &Fir_gptpSetPulseIntf;
-    dev->SwitchDevObj.PTPObj.gptpGetPulse = &Fir_gptpGetPulseIntf;
-    dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Fir_gtaiGetPTPGlobalTime;
-    dev->SwitchDevObj.PTPObj.gptpGetPortReg = &Fir_gptpPortRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPortReg = &Fir_gptpPortRegSet;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = &Fir_gptpGlobalRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = &Fir_gptpGlobalRegSet;
-    dev->SwitchDevObj.PTPObj.gptpGetTaiReg = &Fir_gTaiRegGet;
-    dev->SwitchDevObj.PTPObj.gptpSetTaiReg = &Fir_gTaiRegSet;
-    dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = &Fir_gptp1588v2ConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = &Fir_gptp8021asConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = &Fir_gptp8021asRevConfigSetIntf;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = &Fir_gptpPreemptTimestampSelSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = &Fir_gptpPreemptTimestampSelGet;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = &Fir_gptpPreemptCtrlSet;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = &Fir_gptpPreemptCtrlGet;
-    dev->SwitchDevObj.PTPObj.gtaiSetTrigGenTimerSel = &Fir_gtaiTrigGenTimerSelSet;
-    dev->SwitchDevObj.PTPObj.gtaiGetTrigGenTimerSel = &Fir_gtaiTrigGenTimerSelGet;
-
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Fir_gprtSetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Fir_gprtGetIgnoreFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Fir_gprtSetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Fir_gprtGetAllowBadFcs;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Fir_gprtSetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Fir_gprtGetPauseLimitOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Fir_gprtSetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Fir_gprtGetPauseLimitIn;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Fir_gprtSetQueueToPause;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Fir_gprtGetQueueToPause;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Fir_gprtSetRxPriFlowCtrlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Fir_gprtGetRxPriFlowCtrlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Fir_gprtSetRxPriFlowCtrlToQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Fir_gprtGetRxPriFlowCtrlToQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Fir_gprtSetTxPriFlowCtrlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Fir_gprtGetTxPriFlowCtrlEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Fir_gprtGetOutQueueSize;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Fir_gprtSetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Fir_gprtGetMapDA;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Fir_gprtSetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Fir_gprtGetPortLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Fir_gprtSetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Fir_gprtGetHoldAt1;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Fir_gprtSetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Fir_gprtGetInt0nAgeOut;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Fir_gprtSetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Fir_gprtGetRefreshLocked;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Fir_gprtSetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Fir_gprtGetIgnoreWrongData;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Fir_gprtSetARPMirror;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Fir_gprtGetARPMirror;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Fir_gprtSetForceDefaultVid;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Fir_gprtGetForceDefaultVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Fir_gvlnSetPortVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Fir_gvlnGetPortVid;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Fir_gvlnSetPortVlanQModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Fir_gvlnGetPortVlanQModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Fir_gprtSetDiscardTaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Fir_gprtGetDiscardTaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Fir_gprtSetDiscardUntaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Fir_gprtGetDiscardUntaggedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Fir_gprtSetUnicFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Fir_gprtGetUnicFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Fir_gprtSetMultiFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Fir_gprtGetMultiFloodBlockIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Fir_gprtSetDiscardBCastModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Fir_gprtGetDiscardBCastModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Fir_gprtSetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Fir_gprtGetIGMPSnoopEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Fir_gprtSetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Fir_gprtGetHeaderMode;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Fir_gprtSetDropOnLock;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Fir_gprtGetDropOnLock;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Fir_gprtSetJumboModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Fir_gprtGetJumboModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = &Fir_gprtSetSpecifiedMTUIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = &Fir_gprtGetSpecifiedMTUIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Fir_gprtSetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Fir_gprtGetLearnEnableIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Fir_gprtSetVTUPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Fir_gprtGetVTUPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Fir_gprtSetSAPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Fir_gprtGetSAPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Fir_gprtSetDAPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Fir_gprtGetDAPriOverrideIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Fir_gprtSetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Fir_gprtGetMessagePort;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Fir_gprtSetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Fir_gprtGetEtherType;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Fir_gprtSetAllowVidZero;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Fir_gprtGetAllowVidZero;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Fir_gprtSetFlowCtrlIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Fir_gprtGetFlowCtrlIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Fir_gprtSetEgressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Fir_gprtGetEgressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Fir_gprtSetIngressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Fir_gprtGetIngressMonitorSource;
-    dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Fir_grcSetEgressRateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Fir_grcGetEgressRateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Fir_gprtGetDuplexStatusIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Fir_gprtSetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Fir_gprtGetDuplexIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Fir_gprtGetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Fir_gprtSetForceLinkIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Fir_gprtGetLinkState;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Fir_gprtSetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Fir_gprtGetForceSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Fir_gprtGetSpeedIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Fir_gprtSetFrameModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Fir_gprtGetFrameModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &Fir_gprtSetPortECID;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &Fir_gprtGetPortECID;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Fir_gprtSetEgressModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Fir_gprtGetEgressModeIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &Fir_gprtSetIgnoreETag;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &Fir_gprtGetIgnoreETag;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Fir_gprtSetExtendedPortCtrlReg;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Fir_gprtGetExtendedPortCtrlReg;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Fir_gprtSetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Fir_gprtGetVlanPorts;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Fir_gprtSetPortStateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Fir_gprtGetPortStateIntf;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = &Fir_gprtSetPreemptEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = &Fir_gprtGetPreemptEnable;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = &Fir_gprtSetPreemptSize;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = &Fir_gprtGetPreemptSize;
-    dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = &Fir_gprtSetPreemptQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = &Fir_gprtGetPreemptQueue;
-    dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Fir_gprtRegDump;
-
-    dev->SwitchDevObj.STUObj.gstuAddEntry = &Fir_gstuAddEntryIntf;
-    dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Fir_gstuGetEntryNextIntf;
-    dev->SwitchDevObj.STUObj.gstuDelEntry = &Fir_gstuDelEntryIntf;
-    dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Fir_gstuFindSidEntryIntf;
-    dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Fir_gstuGetEntryCountIntf;
-    dev->SwitchDevObj.STUObj.gstuDump = &Fir_gstuDump;
-
-    dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Fir_gvtuFindVidEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Fir_gvtuExistVidEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuFlush = &Fir_gvtuFlushIntf;
-    dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Fir_gvtuAddEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Fir_gvtuGetEntryNextIntf;
-    dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Fir_gvtuDelEntryIntf;
-    dev->SwitchDevObj.VTUObj.gvtuSetMode = &Fir_gvtuSetModeIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetMode = &Fir_gvtuGetModeIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Fir_gvtuGetViolationIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Fir_gvtuGetEntryCountIntf;
-    dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Fir_gvtuSetMemberTagIntf;
-    dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Fir_gvtuGetMemberTagIntf;
-    dev->SwitchDevObj.VTUObj.gvtuDump = &Fir_gvtuDump;
-
-    dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Fir_gprtSetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Fir_gprtGetTrunkPort;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Fir_gsysSetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Fir_gsysGetTrunkMaskTable;
-    dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Fir_gsysSetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Fir_gsysGetHashTrunk;
-    dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Fir_gsysSetTrunkRouting;
-    dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Fir_gsysGetTrunkRouting;
-
-    dev->SwitchDevObj.EEPROMObj.geepromWrite = &Fir_EEPROMWriteIntf;
-    dev->SwitchDevObj.EEPROMObj.geepromRead = &Fir_EEPROMReadIntf;
-    dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &Fir_EEPROMChipSelSetIntf;
-    dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &Fir_EEPROMChipSelGetIntf;
-
-    dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Fir_gsysDevIntEnableSet;
-    dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Fir_gsysDevIntEnableGet;
-    dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Fir_gsysDevIntStatusGet;
-    dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Fir_gsysActiveIntEnableSet;
-    dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Fir_gsysActiveIntEnableGet;
-    dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Fir_gsysActiveIntStatusGet;
-
-    dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Fir_gpirlInitializeIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Fir_gpirlInitResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Fir_gpirlCustomSetup_sr2cIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Fir_gpirlReadResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Fir_gpirlWriteResourceIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Fir_gpirlGetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Fir_gpirlSetResRegIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Fir_gpirlAdvConfigIntf;
-    dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Fir_gpirlAdvConfigDisableIntf;
-
-    dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Fir_gprtGetIEEEPrioMapIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Fir_gprtSetIEEEPrioMapIntf;
-    dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Fir_gqosGetPrioMapRuleIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Fir_gprtGetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Fir_gprtSetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Fir_gprtGetDefQpriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Fir_gprtSetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Fir_gprtGetDefFpri;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Fir_gprtSetInitialPriIntf;
-    dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Fir_gqosSetPrioMapRuleIntf;
-    dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Fir_gprtRewriteDscp;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Fir_gprtSetCosToQueue;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Fir_gprtGetCosToQueue;
-    dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Fir_gprtSetCosToDscp;
-    dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Fir_gprtGetCosToDscp;
-
-    dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Fir_gstatsFlushAll;
-    dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Fir_gstatsFlushPort;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Fir_gstatsGetPortCounterIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Fir_gstatsGetPortAllCntersIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Fir_gstatsGetHistogramModeIntf;
-    dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Fir_gstatsSetHistogramModeIntf;
-    dev->SwitchDevObj.PORTRMONObj.gmibDump = &Fir_gmibDump;
-
-    dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Fir_gprtSetQueueCtrlIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Fir_gprtGetQueueCtrlIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Fir_gprtSetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Fir_gprtGetPortSchedIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtSetQoSWeight = &Fir_gprtSetQoSWeightIntf;
-    dev->SwitchDevObj.QUEUEObj.gprtGetQoSWeight = &Fir_gprtGetQoSWeightIntf;
-
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Fir_gsysSetFloodBC;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Fir_gsysGetFloodBC;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Fir_gsysSetEgressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Fir_gsysGetEgressMonitorDest;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Fir_gsysSetSMISetup;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Fir_gsysGetSMISetup;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Fir_gsysGlobal1RegDump;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Fir_gsysGlobal2RegDump;
-    dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Fir_gsysSetRMUMode;
-    dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Fir_gsysGetRMUMode;
-    dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Fir_gsysQbvWrite;
-    dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Fir_gsysQbvRead;
-
-    dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &Fir_gBpeEnableSet;
-    dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &Fir_gBpeEnableGet;
-    dev->SwitchDevObj.ECIDObj.gecidAddEntry = &Fir_gecidAddEntryIntf;
-    dev->SwitchDevObj.ECIDObj.gecidDump = &Fir_gecidDump;
-    dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &Fir_gecidFindEcidEntryIntf;
-    dev->SwitchDevObj.ECIDObj.gecidFlushAll = &Fir_gecidFlushAll;
-    dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &Fir_gecidFlushEntry;
-    dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &Fir_gecidGetEcidEntryNextIntf;
-    dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &Fir_gecidGetEntryCount;
-    dev->SwitchDevObj.ECIDObj.gecidMove = &Fir_gecidMove;
-
-    dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Fir_gtcamFlushAll;
-    dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Fir_gtcamFlushEntry;
-    dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Fir_gtcamLoadEntryIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Fir_gtcamReadTCAMDataIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Fir_gtcamGetNextTCAMDataIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Fir_gtcamFindEntryIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Fir_gtcamSetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Fir_gtcamGetModeIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Fir_gtcamAddEntryPort;
-    dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Fir_gtcamRemoveEntryPort;
-    dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Fir_gtcamEgrFlushEntryIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Fir_gtcamEgrFlushAllPortsIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Fir_gtcamEgrLoadEntryIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Fir_gtcamEgrGetNextTCAMDataIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Fir_gtcamEgrReadTCAMDataIntf;
-    dev->SwitchDevObj.TCAMObj.gtcamDump = &Fir_gtcamDump;
-    dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Fir_gtcamAdvConfigIntf;
-
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &Fir_gtcamRCLoadEntryIntf;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &Fir_gtcamRCFlushAllEntry;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &Fir_gtcamRCFlushEntry;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &Fir_gtcamRCReadEntryIntf;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &Fir_gtcamRCGetNextEntryIntf;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &Fir_gtcamRCFindEntryIntf;
-    dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &Fir_gtcamRCEntryDump;
-
-    dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &Fir_gtcamRCCompLoadIntf;
-    dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &Fir_gtcamRCCompFlushAll;
-    dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &Fir_gtcamRCCompFlushPort;
-    dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &Fir_gtcamRCCompReadIntf;
-
-    dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Fir_msdRmuTCAMDumpIntf;
-    dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Fir_msdRmuTCAMReadIntf;
-    dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Fir_msdRmuTCAMWriteIntf;
-    dev->SwitchDevObj.RMUObj.grmuEcidDump = &Fir_msdRmuEcidDumpIntf;
-
-    dev->SwitchDevObj.RMUObj.grmuGetID = &Fir_msdRmuGetIDIntf;
-    dev->SwitchDevObj.RMUObj.grmuAtuDump = &Fir_msdRmuAtuDumpIntf;
-    dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Fir_msdRmuMib2DumpIntf;
-    dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Fir_msdRmuMultiRegAccessIntf;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = &Fir_msdRmuRegDump;
-
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Fir_msdGetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Fir_msdSetSMIC45PhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Fir_msdGetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Fir_msdSetSMIPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Fir_msdSetSMIPhyXMDIOReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Fir_msdGetSMIPhyXMDIOReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Fir_msdGetSMIExtPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Fir_msdSetSMIExtPhyReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Fir_msdSetSMIExtPhyXMDIOReg;
-    dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Fir_msdGetSMIExtPhyXMDIOReg;
-
-    dev->SwitchDevObj.LEDObj.gledForceOn = &Fir_gledForceOnIntf;
-    dev->SwitchDevObj.LEDObj.gledForceOff = &Fir_gledForceOffIntf;
-    dev->SwitchDevObj.LEDObj.gledLinkAct = &Fir_gledLinkActIntf;
-    dev->SwitchDevObj.LEDObj.gledModeSet = &Fir_gledModeSetIntf;
-    dev->SwitchDevObj.LEDObj.gledModeGet = &Fir_gledModeGetIntf;
-    dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Fir_gledBlinkRateSetIntf;
-    dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Fir_gledBlinkRateGetIntf;
-    dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Fir_gledPulseStretchSetIntf;
-    dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Fir_gledPulseStretchGetIntf;
-    dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Fir_gledSpecialModeSetIntf;
-    dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Fir_gledSpecialModeGetIntf;
-    dev->SwitchDevObj.LEDObj.gledCtrlSet = &Fir_gledCtrlSetIntf;
-    dev->SwitchDevObj.LEDObj.gledCtrlGet = &Fir_gledCtrlGetIntf;
-    dev->SwitchDevObj.LEDObj.gledDump = &Fir_gledDump;
-
-    dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &Fir_gpolicySetMgmtCtrl;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &Fir_gpolicyGetMgmtCtrl;
-    dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &Fir_gpolicySetCpuDest;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &Fir_gpolicyGetCpuDest;
-    dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &Fir_gpolicySetIgrMonitorDest;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &Fir_gpolicyGetIgrMonitorDest;
-    dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &Fir_gpolicySetRsvd2CpuEnables;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &Fir_gpolicyGetRsvd2CpuEnables;
-    dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &Fir_gpolicySetMGMTPri;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &Fir_gpolicyGetMGMTPri;
-    dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &Fir_gpolicySetRouteDest;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &Fir_gpolicyGetRouteDest;
-    dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &Fir_gpolicySetMirrorDest;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &Fir_gpolicyGetMirrorDest;
-    dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &Fir_gpolicySetIllegalIPAddr;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &Fir_gpolicyGetIllegalIPAddr;
-    dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &Fir_gpolicySetDipDaMismatch;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &Fir_gpolicyGetDipDaMismatch;
-    dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &Fir_gpolicySetZeroSIP;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &Fir_gpolicyGetZeroSIP;
-    dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &Fir_gpolicySetMcTtlExceeded;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &Fir_gpolicyGetMcTtlExceeded;
-    dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &Fir_gpolicySetUcTtlExceeded;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &Fir_gpolicyGetUcTtlExceeded;
-    dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &Fir_gprtSetPortTtlThreshold;
-    dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &Fir_gprtGetPortTtlThreshold;
-    dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &Fir_gpolicySetIpHdrErr;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &Fir_gpolicyGetIpHdrErr;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &Fir_gpolicySetTCPFinUrgPsh;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &Fir_gpolicyGetTCPFinUrgPsh;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &Fir_gpolicySetTCPFlagsSeqNum;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &Fir_gpolicyGetTCPFlagsSeqNum;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &Fir_gpolicySetTCPSYN;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &Fir_gpolicyGetTCPSYN;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &Fir_gpolicySetTCPHSize;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &Fir_gpolicyGetTCPHSize;
-    dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &Fir_gprtSetPortTCPMinHdrSize;
-    dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &Fir_gprtGetPortTCPMinHdrSize;
-    dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &Fir_gpolicySetICMPSize;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &Fir_gpolicyGetICMPSize;
-    dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &Fir_gprtSetPortICMPMaxSize;
-    dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &Fir_gprtGetPortICMPMaxSize;
-    dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &Fir_gpolicySetUDPPort;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &Fir_gpolicyGetUDPPort;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &Fir_gpolicySetTCPPort;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &Fir_gpolicyGetTCPPort;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &Fir_gpolicySetTCPSynFin;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &Fir_gpolicyGetTCPSynFin;
-    dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &Fir_gpolicySetTCPFrag;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &Fir_gpolicyGetTCPFrag;
-    dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &Fir_gpolicySetNearNonTPMR;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &Fir_gpolicyGetNearNonTPMR;
-    dev->SwitchDevObj.POLICYObj.gpolicySetETag = &Fir_gpolicySetETag;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &Fir_gpolicyGetETag;
-    dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &Fir_gpolicySetNonETag;
-    dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &Fir_gpolicyGetNonETag;
-    dev->SwitchDevObj.POLICYObj.gpolicyDump = &Fir_gpolicyDump;
-
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushAll = &Fir_gfrerSeqGenFlushAll;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushEntry = &Fir_gfrerSeqGenFlushEntry;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenRead = &Fir_gfrerSeqGenReadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenLoad = &Fir_gfrerSeqGenLoadIntf;
-
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushAll = &Fir_gfrerIndvRcvyFlushAll;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushEntry = &Fir_gfrerIndvRcvyFlushEntry;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyRead = &Fir_gfrerIndvRcvyReadIntf;
-	dev->SwitchDevObj.FRERObj.gfrerIndvRcvyLoad = &Fir_gfrerIndvRcvyLoadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyGetNext = &Fir_gfrerIndvRcvyGetNextIntf;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyReadClear = &Fir_gfrerIndvRcvyReadClearIntf;
-
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushAll = &Fir_gfrerSeqRcvyFlushAll;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushEntry = &Fir_gfrerSeqRcvyFlushEntry;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyRead = &Fir_gfrerSeqRcvyReadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyLoad = &Fir_gfrerSeqRcvyLoadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetNext = &Fir_gfrerSeqRcvyGetNextIntf;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetViolation = &Fir_gfrerSeqRcvyGetViolationIntf;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyReadClear = &Fir_gfrerSeqRcvyReadClearIntf;
-
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushAll = &Fir_gfrerBank0SCtrFlushAll;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushEntry = &Fir_gfrerBank0SCtrFlushCtr;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrRead = &Fir_gfrerBank0SCtrReadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrLoad = &Fir_gfrerBank0SCtrLoadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrGetNext = &Fir_gfrerBank0SCtrGetNextIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrReadClear = &Fir_gfrerBank0SCtrReadClearIntf;
-
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushAll = &Fir_gfrerBank1SCtrFlushAll;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushEntry = &Fir_gfrerBank1SCtrFlushCtr;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrRead = &Fir_gfrerBank1SCtrReadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrLoad = &Fir_gfrerBank1SCtrLoadIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrGetNext = &Fir_gfrerBank1SCtrGetNextIntf;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrReadClear = &Fir_gfrerBank1SCtrReadClearIntf;
-
-    dev->SwitchDevObj.QCRObj.gqcrFlushAll = &Fir_gatsFlushAll;
-    dev->SwitchDevObj.QCRObj.gqcrFlushOne = &Fir_gatsFlushOne;
-    dev->SwitchDevObj.QCRObj.gqcrSetGrpId = &Fir_gatsSetGrpId;
-    dev->SwitchDevObj.QCRObj.gqcrGetGrpId = &Fir_gatsGetGrpId;
-    dev->SwitchDevObj.QCRObj.gqcrSetCbsLimit = &Fir_gatsSetCbsLimit;
-    dev->SwitchDevObj.QCRObj.gqcrGetCbsLimit = &Fir_gatsGetCbsLimit;
-    dev->SwitchDevObj.QCRObj.gqcrSetMaxResidenceTime = &Fir_gatsSetMaxResidenceTime;
-    dev->SwitchDevObj.QCRObj.gqcrGetMaxResidenceTime = &Fir_gatsGetMaxResidenceTime;
-    dev->SwitchDevObj.QCRObj.gqcrSetRateLimit = &Fir_gatsSetRateLimit;
-    dev->SwitchDevObj.QCRObj.gqcrGetRateLimit = &Fir_gatsGetRateLimit;
-    dev->SwitchDevObj.QCRObj.gqcrSetQueueEnables = &Fir_gatsSetQueueEnables;
-    dev->SwitchDevObj.QCRObj.gqcrGetQueueEnables = &Fir_gatsGetQueueEnables;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFlushAll = &Fir_gqciStreamFiltFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltSet = &Fir_gqciStreamFiltSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatSet = &Fir_gqciStreamFiltBlockStatSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatGet = &Fir_gqciStreamFiltBlockStatGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnAts = &Fir_gqciStreamFiltEnAts;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnGate = &Fir_gqciStreamFiltEnGate;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltMatchCtrGet = &Fir_gqciStreamFiltMatchCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFilterCtrGet = &Fir_gqciStreamFiltFilterCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFiltCtrGet = &Fir_gqciStreamGateFiltCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFiltCtrGet = &Fir_gqciFlowMeterFiltCtrGet;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFlushAll = &Fir_gqciStreamGateFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateDefStateSet = &Fir_gqciStreamGateDefStateSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateScaleSet = &Fir_gqciStreamGateScaleSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenIdSet = &Fir_gqciStreamGateTimeGenIdSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateEntryAdd = &Fir_gqciStreamGateEntryAddIntf;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenFlush = &Fir_gqciStreamGateTimeGenFlush;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenSet = &Fir_gqciStreamGateTimeGenSet;
-
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFlushAll = &Fir_gqciFlowMeterFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagSet = &Fir_gqciFlowMeterCoupleFlagSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagGet = &Fir_gqciFlowMeterCoupleFlagGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelSet = &Fir_gqciFlowMeterDropOnYelSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelGet = &Fir_gqciFlowMeterDropOnYelGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnSet = &Fir_gqciFlowMeterRedBlockEnSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnGet = &Fir_gqciFlowMeterRedBlockEnGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatSet = &Fir_gqciFlowMeterRedBlkStatSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatGet = &Fir_gqciFlowMeterRedBlkStatGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterAdvConfig = &Fir_gqciFlowMeterAdvConfig;
-
-	dev->SwitchDevObj.MACSECObj.gmacsecFlushAll = &Fir_gmacsecFlushAll;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRule = &Fir_gmacsecCreateRuleIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRule = &Fir_gmacsecDeleteRule;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRule = &Fir_gmacsecGetRuleIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSecY = &Fir_gmacsecCreateTxSecYIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSecY = &Fir_gmacsecDeleteTxSecY;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSecY = &Fir_gmacsecGetTxSecYIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSecY = &Fir_gmacsecCreateRxSecYIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSecY = &Fir_gmacsecDeleteRxSecY;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSecY = &Fir_gmacsecGetRxSecYIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSC = &Fir_gmacsecCreateRxSCIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSC = &Fir_gmacsecDeleteRxSC;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSC = &Fir_gmacsecGetRxSCIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSA = &Fir_gmacsecCreateRxSAIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSA = &Fir_gmacsecDeleteRxSA;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSA = &Fir_gmacsecGetRxSAIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSC = &Fir_gmacsecCreateTxSCIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSC = &Fir_gmacsecDeleteTxSC;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSC = &Fir_gmacsecGetTxSCIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSA = &Fir_gmacsecCreateTxSAIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSA = &Fir_gmacsecDeleteTxSA;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSA = &Fir_gmacsecGetTxSAIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRXSCStates = &Fir_gmacsecGetRXSCStatesIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRXSecYStates = &Fir_gmacsecGetRXSecYStatesIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTXSCStates = &Fir_gmacsecGetTXSCStatesIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTXSecYStates = &Fir_gmacsecGetTXSecYStatesIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressSet = &Fir_gmacsecEnableEgressSet;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressGet = &Fir_gmacsecEnableEgressGet;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressSet = &Fir_gmacsecEnableIngressSet;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressGet = &Fir_gmacsecEnableIngressGet;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxPNThreshold = &Fir_gmacsecSetTxPNThreshold;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxPNThreshold = &Fir_gmacsecGetTxPNThreshold;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxXPNThreshold = &Fir_gmacsecSetTxXPNThreshold;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxXPNThreshold = &Fir_gmacsecGetTxXPNThreshold;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetRxDefaultSCI = &Fir_gmacsecSetRxDefaultSCI;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxDefaultSCI = &Fir_gmacsecGetRxDefaultSCI;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxSCIntCtrl = &Fir_gmacsecSetTxSCIntCtrlIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSCIntCtrl = &Fir_gmacsecGetTxSCIntCtrlIntf;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetNextTxSCIntStatus = &Fir_gmacsecGetNextTxSCIntStatusIntf;
+    obj->ATUObj.gfdbAddMacEntry = &Fir_gfdbAddMacEntryIntf;
+    obj->ATUObj.gfdbGetAtuEntryNext = &Fir_gfdbGetAtuEntryNextIntf;
+    obj->ATUObj.gfdbFlush = &Fir_gfdbFlushIntf;
+    obj->ATUObj.gfdbFlushInDB = &Fir_gfdbFlushInDBIntf;
+    obj->ATUObj.gfdbMove = &Fir_gfdbMoveIntf;
+    obj->ATUObj.gfdbMoveInDB = &Fir_gfdbMoveInDBIntf;
+    obj->ATUObj.gfdbPortRemove = &Fir_gfdbPortRemoveIntf;
+    obj->ATUObj.gfdbPortRemoveInDB = &Fir_gfdbPortRemoveInDBIntf;
+    obj->ATUObj.gfdbDelAtuEntry = &Fir_gfdbDelAtuEntry;
+    obj->ATUObj.gfdbGetViolation = &Fir_gfdbGetViolationIntf;
+    obj->ATUObj.gfdbFindAtuMacEntry = &Fir_gfdbFindAtuMacEntryIntf;
+    obj->ATUObj.gfdbSetAgingTimeout = &Fir_gfdbSetAgingTimeout;
+    obj->ATUObj.gfdbGetAgingTimeout = &Fir_gfdbGetAgingTimeout;
+    obj->ATUObj.gfdbSetLearn2All = &Fir_gfdbSetLearn2All;
+    obj->ATUObj.gfdbGetLearn2All = &Fir_gfdbGetLearn2All;
+    obj->ATUObj.gfdbSetPortLearnLimit = &Fir_gfdbSetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnLimit = &Fir_gfdbGetPortLearnLimit;
+    obj->ATUObj.gfdbGetPortLearnCount = &Fir_gfdbGetPortLearnCount;
+    obj->ATUObj.gfdbGetEntryCount = &Fir_gfdbGetEntryCount;
+    obj->ATUObj.gfdbGetEntryCountPerFid = &Fir_gfdbGetEntryCountPerFid;
+    obj->ATUObj.gfdbGetNonStaticEntryCount = &Fir_gfdbGetNonStaticEntryCount;
+    obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Fir_gfdbGetNStaticEntryCountFid;
+    obj->ATUObj.gfdbGetOccupancy = &Fir_gfdbGetOccupancy;
+    obj->ATUObj.gfdbDump = &Fir_gfdbDump;
+
+    obj->ARPObj.garpLoadMcEntry = &Fir_garpLoadMcEntryIntf;
+    obj->ARPObj.garpLoadUcEntry = &Fir_garpLoadUcEntryIntf;
+    obj->ARPObj.garpFlushEntry = &Fir_garpFlushEntry;
+    obj->ARPObj.garpFlushAll = &Fir_garpFlushAll;
+    obj->ARPObj.garpReadEntry = &Fir_garpReadEntryIntf;
+    obj->ARPObj.garpGetNextEntry = &Fir_garpGetNextEntryIntf;
+
+    obj->QAVObj.gqavGetPortQpriXHiLimit = &Fir_gqavGetPortQpriXHiLimit;
+    obj->QAVObj.gqavSetPortQpriXHiLimit = &Fir_gqavSetPortQpriXHiLimit;
+    obj->QAVObj.gqavGetPortQpriXRate = &Fir_gqavGetPortQpriXRate;
+    obj->QAVObj.gqavSetPortQpriXRate = &Fir_gqavSetPortQpriXRate;
+
+    obj->PHYCTRLObj.serdesReset = &Fir_serdesReset;
+
+    obj->PTPObj.gptpSetIntEnable = &Fir_gptpSetIntEnableIntf;
+    obj->PTPObj.gptpGetIntEnable = &Fir_gptpGetIntEnableIntf;
+    obj->PTPObj.gptpSetProtPTPEn = &Fir_gptpSetPortPTPEn;
+    obj->PTPObj.gptpGetProtPTPEn = &Fir_gptpGetPortPTPEn;
+    obj->PTPObj.gptpGetTimeStamp = &Fir_gptpGetTimeStampIntf;
+    obj->PTPObj.gptpGetTSValidSt = &Fir_gptpGetTSValidSt;
+    obj->PTPObj.gptpResetTimeStamp = &Fir_gptpResetTimeStamp;
+    obj->PTPObj.gptpTimeStampHarvest = &Fir_gptpTimeStampHarvest;
+    obj->PTPObj.gptpGetIntStatus = &Fir_gptpGetIntStatusIntf;
+    obj->PTPObj.gptpSetMeanPathDelay = &Fir_gptpSetMeanPathDelay;
+    obj->PTPObj.gptpGetMeanPathDelay = &Fir_gptpGetMeanPathDelay;
+    obj->PTPObj.gptpSetIgrPathDelayAsym = &Fir_gptpSetIgrPathDelayAsym;
+    obj->PTPObj.gptpGetIgrPathDelayAsym = &Fir_gptpGetIgrPathDelayAsym;
+    obj->PTPObj.gptpSetEgrPathDelayAsym = &Fir_gptpSetEgrPathDelayAsym;
+    obj->PTPObj.gptpGetEgrPathDelayAsym = &Fir_gptpGetEgrPathDelayAsym;
+    obj->PTPObj.gptpGetTODBusyBitStatus = &Fir_gptpGetTODBusyBitStatus;
+    obj->PTPObj.gptpTODStoreCompensation = &Fir_gptpTODStoreCompenIntf;
+    obj->PTPObj.gptpTODStoreAll = &Fir_gptpTODStoreAllIntf;
+    obj->PTPObj.gptpTODCaptureAll = &Fir_gptpTODCaptureAllIntf;
+    obj->PTPObj.gptpSetPulse = &Fir_gptpSetPulseIntf;
+    obj->PTPObj.gptpGetPulse = &Fir_gptpGetPulseIntf;
+    obj->PTPObj.gtaiGetPTPGlobalTime = &Fir_gtaiGetPTPGlobalTime;
+    obj->PTPObj.gtaiGetPTPGlobalTimeSample = &Fir_gtaiGetPTPGlobalTimeSample;
+    obj->PTPObj.gptpGetPortReg = &Fir_gptpPortRegGet;
+    obj->PTPObj.gptpSetPortReg = &Fir_gptpPortRegSet;
+    obj->PTPObj.gptpGetGlobalReg = &Fir_gptpGlobalRegGet;
+    obj->PTPObj.gptpSetGlobalReg = &Fir_gptpGlobalRegSet;
+    obj->PTPObj.gptpGetTaiReg = &Fir_gTaiRegGet;
+    obj->PTPObj.gptpSetTaiReg = &Fir_gTaiRegSet;
+    obj->PTPObj.gptpSet1588v2Config = &Fir_gptp1588v2ConfigSetIntf;
+    obj->PTPObj.gptpSet8021asConfig = &Fir_gptp8021asConfigSetIntf;
+    obj->PTPObj.gptpSet8021asRevConfig = &Fir_gptp8021asRevConfigSetIntf;
+    obj->PTPObj.gptpSetPreemptTsSel = &Fir_gptpPreemptTimestampSelSet;
+    obj->PTPObj.gptpGetPreemptTsSel = &Fir_gptpPreemptTimestampSelGet;
+    obj->PTPObj.gptpSetPreemptCtrl = &Fir_gptpPreemptCtrlSet;
+    obj->PTPObj.gptpGetPreemptCtrl = &Fir_gptpPreemptCtrlGet;
+    obj->PTPObj.gtaiSetTrigGenTimerSel = &Fir_gtaiTrigGenTimerSelSet;
+    obj->PTPObj.gtaiGetTrigGenTimerSel = &Fir_gtaiTrigGenTimerSelGet;
+
+    obj->PORTCTRLObj.gprtSetIgnoreFcs = &Fir_gprtSetIgnoreFcs;
+    obj->PORTCTRLObj.gprtGetIgnoreFcs = &Fir_gprtGetIgnoreFcs;
+    obj->PORTCTRLObj.gprtSetAllowBadFcs = &Fir_gprtSetAllowBadFcs;
+    obj->PORTCTRLObj.gprtGetAllowBadFcs = &Fir_gprtGetAllowBadFcs;
+    obj->PORTCTRLObj.gprtSetPauseLimitOut = &Fir_gprtSetPauseLimitOut;
+    obj->PORTCTRLObj.gprtGetPauseLimitOut = &Fir_gprtGetPauseLimitOut;
+    obj->PORTCTRLObj.gprtSetPauseLimitIn = &Fir_gprtSetPauseLimitIn;
+    obj->PORTCTRLObj.gprtGetPauseLimitIn = &Fir_gprtGetPauseLimitIn;
+    obj->PORTCTRLObj.gprtSetQueueToPause = &Fir_gprtSetQueueToPause;
+    obj->PORTCTRLObj.gprtGetQueueToPause = &Fir_gprtGetQueueToPause;
+    obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Fir_gprtSetRxPriFlowCtrlEnable;
+    obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Fir_gprtGetRxPriFlowCtrlEnable;
+    obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Fir_gprtSetRxPriFlowCtrlToQueue;
+    obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Fir_gprtGetRxPriFlowCtrlToQueue;
+    obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Fir_gprtSetTxPriFlowCtrlEnable;
+    obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Fir_gprtGetTxPriFlowCtrlEnable;
+    obj->PORTCTRLObj.gprtGetOutQueueSize = &Fir_gprtGetOutQueueSize;
+    obj->PORTCTRLObj.gprtSetMapDA = &Fir_gprtSetMapDA;
+    obj->PORTCTRLObj.gprtGetMapDA = &Fir_gprtGetMapDA;
+    obj->PORTCTRLObj.gprtSetPortLocked = &Fir_gprtSetPortLocked;
+    obj->PORTCTRLObj.gprtGetPortLocked = &Fir_gprtGetPortLocked;
+    obj->PORTCTRLObj.gprtSetHoldAt1 = &Fir_gprtSetHoldAt1;
+    obj->PORTCTRLObj.gprtGetHoldAt1 = &Fir_gprtGetHoldAt1;
+    obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Fir_gprtSetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Fir_gprtGetInt0nAgeOut;
+    obj->PORTCTRLObj.gprtSetRefreshLocked = &Fir_gprtSetRefreshLocked;
+    obj->PORTCTRLObj.gprtGetRefreshLocked = &Fir_gprtGetRefreshLocked;
+    obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Fir_gprtSetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Fir_gprtGetIgnoreWrongData;
+    obj->PORTCTRLObj.gprtSetARPMirror = &Fir_gprtSetARPMirror;
+    obj->PORTCTRLObj.gprtGetARPMirror = &Fir_gprtGetARPMirror;
+    obj->PORTCTRLObj.gprtSetForceDefaultVid = &Fir_gprtSetForceDefaultVid;
+    obj->PORTCTRLObj.gprtGetForceDefaultVid = &Fir_gprtGetForceDefaultVid;
+    obj->PORTCTRLObj.gvlnSetPortVid = &Fir_gvlnSetPortVid;
+    obj->PORTCTRLObj.gvlnGetPortVid = &Fir_gvlnGetPortVid;
+    obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Fir_gvlnSetPortVlanQModeIntf;
+    obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Fir_gvlnGetPortVlanQModeIntf;
+    obj->PORTCTRLObj.gprtSetDiscardTagged = &Fir_gprtSetDiscardTaggedIntf;
+    obj->PORTCTRLObj.gprtGetDiscardTagged = &Fir_gprtGetDiscardTaggedIntf;
+    obj->PORTCTRLObj.gprtSetDiscardUntagged = &Fir_gprtSetDiscardUntaggedIntf;
+    obj->PORTCTRLObj.gprtGetDiscardUntagged = &Fir_gprtGetDiscardUntaggedIntf;
+    obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Fir_gprtSetUnicFloodBlockIntf;
+    obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Fir_gprtGetUnicFloodBlockIntf;
+    obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Fir_gprtSetMultiFloodBlockIntf;
+    obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Fir_gprtGetMultiFloodBlockIntf;
+    obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Fir_gprtSetDiscardBCastModeIntf;
+    obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Fir_gprtGetDiscardBCastModeIntf;
+    obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Fir_gprtSetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Fir_gprtGetIGMPSnoopEnable;
+    obj->PORTCTRLObj.gprtSetHeaderMode = &Fir_gprtSetHeaderMode;
+    obj->PORTCTRLObj.gprtGetHeaderMode = &Fir_gprtGetHeaderMode;
+    obj->PORTCTRLObj.gprtSetDropOnLock = &Fir_gprtSetDropOnLock;
+    obj->PORTCTRLObj.gprtGetDropOnLock = &Fir_gprtGetDropOnLock;
+    obj->PORTCTRLObj.gprtSetJumboMode = &Fir_gprtSetJumboModeIntf;
+    obj->PORTCTRLObj.gprtGetJumboMode = &Fir_gprtGetJumboModeIntf;
+    obj->PORTCTRLObj.gprtSetSpecifiedMTU = &Fir_gprtSetSpecifiedMTUIntf;
+    obj->PORTCTRLObj.gprtGetSpecifiedMTU = &Fir_gprtGetSpecifiedMTUIntf;
+    obj->PORTCTRLObj.gprtSetLearnEnable = &Fir_gprtSetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtGetLearnEnable = &Fir_gprtGetLearnEnableIntf;
+    obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Fir_gprtSetVTUPriOverrideIntf;
+    obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Fir_gprtGetVTUPriOverrideIntf;
+    obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Fir_gprtSetSAPriOverrideIntf;
+    obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Fir_gprtGetSAPriOverrideIntf;
+    obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Fir_gprtSetDAPriOverrideIntf;
+    obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Fir_gprtGetDAPriOverrideIntf;
+    obj->PORTCTRLObj.gprtSetMessagePort = &Fir_gprtSetMessagePort;
+    obj->PORTCTRLObj.gprtGetMessagePort = &Fir_gprtGetMessagePort;
+    obj->PORTCTRLObj.gprtSetEtherType = &Fir_gprtSetEtherType;
+    obj->PORTCTRLObj.gprtGetEtherType = &Fir_gprtGetEtherType;
+    obj->PORTCTRLObj.gprtSetAllowVidZero = &Fir_gprtSetAllowVidZero;
+    obj->PORTCTRLObj.gprtGetAllowVidZero = &Fir_gprtGetAllowVidZero;
+    obj->PORTCTRLObj.gprtSetFlowCtrl = &Fir_gprtSetFlowCtrlIntf;
+    obj->PORTCTRLObj.gprtGetFlowCtrl = &Fir_gprtGetFlowCtrlIntf;
+    obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Fir_gprtSetEgressMonitorSource;
+    obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Fir_gprtGetEgressMonitorSource;
+    obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Fir_gprtSetIngressMonitorSource;
+    obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Fir_gprtGetIngressMonitorSource;
+    obj->PORTCTRLObj.grcSetEgressRate = &Fir_grcSetEgressRateIntf;
+    obj->PORTCTRLObj.grcGetEgressRate = &Fir_grcGetEgressRateIntf;
+    obj->PORTCTRLObj.gprtGetDuplexStatus = &Fir_gprtGetDuplexStatusIntf;
+    obj->PORTCTRLObj.gprtSetDuplex = &Fir_gprtSetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetDuplex = &Fir_gprtGetDuplexIntf;
+    obj->PORTCTRLObj.gprtGetForceLink = &Fir_gprtGetForceLinkIntf;
+    obj->PORTCTRLObj.gprtSetForceLink = &Fir_gprtSetForceLinkIntf;
+    obj->PORTCTRLObj.gprtGetLinkState = &Fir_gprtGetLinkState;
+    obj->PORTCTRLObj.gprtSetForceSpeed = &Fir_gprtSetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetForceSpeed = &Fir_gprtGetForceSpeedIntf;
+    obj->PORTCTRLObj.gprtGetSpeed = &Fir_gprtGetSpeedIntf;
+    obj->PORTCTRLObj.gprtSetFrameMode = &Fir_gprtSetFrameModeIntf;
+    obj->PORTCTRLObj.gprtGetFrameMode = &Fir_gprtGetFrameModeIntf;
+    obj->PORTCTRLObj.gprtSetPortECID = &Fir_gprtSetPortECID;
+    obj->PORTCTRLObj.gprtGetPortECID = &Fir_gprtGetPortECID;
+    obj->PORTCTRLObj.gprtSetEgressMode = &Fir_gprtSetEgressModeIntf;
+    obj->PORTCTRLObj.gprtGetEgressMode = &Fir_gprtGetEgressModeIntf;
+    obj->PORTCTRLObj.gprtSetIgnoreETag = &Fir_gprtSetIgnoreETag;
+    obj->PORTCTRLObj.gprtGetIgnoreETag = &Fir_gprtGetIgnoreETag;
+    obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Fir_gprtSetExtendedPortCtrlReg;
+    obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Fir_gprtGetExtendedPortCtrlReg;
+    obj->PORTCTRLObj.gprtSetVlanPorts = &Fir_gprtSetVlanPorts;
+    obj->PORTCTRLObj.gprtGetVlanPorts = &Fir_gprtGetVlanPorts;
+    obj->PORTCTRLObj.gprtSetPortState = &Fir_gprtSetPortStateIntf;
+    obj->PORTCTRLObj.gprtGetPortState = &Fir_gprtGetPortStateIntf;
+    obj->PORTCTRLObj.gprtSetPreemptEnable = &Fir_gprtSetPreemptEnable;
+    obj->PORTCTRLObj.gprtGetPreemptEnable = &Fir_gprtGetPreemptEnable;
+    obj->PORTCTRLObj.gprtSetPreemptSize = &Fir_gprtSetPreemptSize;
+    obj->PORTCTRLObj.gprtGetPreemptSize = &Fir_gprtGetPreemptSize;
+    obj->PORTCTRLObj.gprtSetPreemptQueue = &Fir_gprtSetPreemptQueue;
+    obj->PORTCTRLObj.gprtGetPreemptQueue = &Fir_gprtGetPreemptQueue;
+    obj->PORTCTRLObj.gprtRegDump = &Fir_gprtRegDump;
+
+    obj->STUObj.gstuAddEntry = &Fir_gstuAddEntryIntf;
+    obj->STUObj.gstuGetEntryNext = &Fir_gstuGetEntryNextIntf;
+    obj->STUObj.gstuDelEntry = &Fir_gstuDelEntryIntf;
+    obj->STUObj.gstuFindSidEntry = &Fir_gstuFindSidEntryIntf;
+    obj->STUObj.gstuGetEntryCount = &Fir_gstuGetEntryCountIntf;
+    obj->STUObj.gstuDump = &Fir_gstuDump;
+
+    obj->VTUObj.gvtuFindVidEntry = &Fir_gvtuFindVidEntryIntf;
+    obj->VTUObj.gvtuExistVidEntry = &Fir_gvtuExistVidEntryIntf;
+    obj->VTUObj.gvtuFlush = &Fir_gvtuFlushIntf;
+    obj->VTUObj.gvtuAddEntry = &Fir_gvtuAddEntryIntf;
+    obj->VTUObj.gvtuGetEntryNext = &Fir_gvtuGetEntryNextIntf;
+    obj->VTUObj.gvtuDelEntry = &Fir_gvtuDelEntryIntf;
+    obj->VTUObj.gvtuSetMode = &Fir_gvtuSetModeIntf;
+    obj->VTUObj.gvtuGetMode = &Fir_gvtuGetModeIntf;
+    obj->VTUObj.gvtuGetViolation = &Fir_gvtuGetViolationIntf;
+    obj->VTUObj.gvtuGetEntryCount = &Fir_gvtuGetEntryCountIntf;
+    obj->VTUObj.gvtuSetMemberTag = &Fir_gvtuSetMemberTagIntf;
+    obj->VTUObj.gvtuGetMemberTag = &Fir_gvtuGetMemberTagIntf;
+    obj->VTUObj.gvtuDump = &Fir_gvtuDump;
+
+    obj->TrunkObj.gprtSetTrunkPort = &Fir_gprtSetTrunkPort;
+    obj->TrunkObj.gprtGetTrunkPort = &Fir_gprtGetTrunkPort;
+    obj->TrunkObj.gsysSetTrunkMaskTable = &Fir_gsysSetTrunkMaskTable;
+    obj->TrunkObj.gsysGetTrunkMaskTable = &Fir_gsysGetTrunkMaskTable;
+    obj->TrunkObj.gsysSetHashTrunk = &Fir_gsysSetHashTrunk;
+    obj->TrunkObj.gsysGetHashTrunk = &Fir_gsysGetHashTrunk;
+    obj->TrunkObj.gsysSetTrunkRouting = &Fir_gsysSetTrunkRouting;
+    obj->TrunkObj.gsysGetTrunkRouting = &Fir_gsysGetTrunkRouting;
+
+    obj->EEPROMObj.geepromWrite = &Fir_EEPROMWriteIntf;
+    obj->EEPROMObj.geepromRead = &Fir_EEPROMReadIntf;
+    obj->EEPROMObj.geepromSetMChipSel = &Fir_EEPROMChipSelSetIntf;
+    obj->EEPROMObj.geepromGetMChipSel = &Fir_EEPROMChipSelGetIntf;
+    obj->EEPROMObj.geepromReadBlock = &Fir_EEPROMReadBlockIntf;
+    obj->EEPROMObj.geepromWriteBlock = &Fir_EEPROMWriteBlockIntf;
+
+    obj->INTObj.gdevIntEnableSet = &Fir_gsysDevIntEnableSet;
+    obj->INTObj.gdevIntEnableGet = &Fir_gsysDevIntEnableGet;
+    obj->INTObj.gdevIntStatusGet = &Fir_gsysDevIntStatusGet;
+    obj->INTObj.gactiveIntEnableSet = &Fir_gsysActiveIntEnableSet;
+    obj->INTObj.gactiveIntEnableGet = &Fir_gsysActiveIntEnableGet;
+    obj->INTObj.gactiveIntStatusGet = &Fir_gsysActiveIntStatusGet;
+
+    obj->PIRLObj.gpirlInitialize = &Fir_gpirlInitializeIntf;
+    obj->PIRLObj.gpirlInitResource = &Fir_gpirlInitResourceIntf;
+    obj->PIRLObj.gpirlCustomSetup = &Fir_gpirlCustomSetup_sr2cIntf;
+    obj->PIRLObj.gpirlReadResource = &Fir_gpirlReadResourceIntf;
+    obj->PIRLObj.gpirlWriteResource = &Fir_gpirlWriteResourceIntf;
+    obj->PIRLObj.gpirlGetResReg = &Fir_gpirlGetResRegIntf;
+    obj->PIRLObj.gpirlSetResReg = &Fir_gpirlSetResRegIntf;
+    obj->PIRLObj.gpirlAdvConfig = &Fir_gpirlAdvConfigIntf;
+    obj->PIRLObj.gpirlAdvConfigDisable = &Fir_gpirlAdvConfigDisableIntf;
+
+    obj->QOSMAPObj.gprtGetIEEEPrioMap = &Fir_gprtGetIEEEPrioMapIntf;
+    obj->QOSMAPObj.gprtSetIEEEPrioMap = &Fir_gprtSetIEEEPrioMapIntf;
+    obj->QOSMAPObj.gqosGetPrioMapRule = &Fir_gqosGetPrioMapRuleIntf;
+    obj->QOSMAPObj.gprtGetInitialPri = &Fir_gprtGetInitialPriIntf;
+    obj->QOSMAPObj.gprtSetDefQpri = &Fir_gprtSetDefQpriIntf;
+    obj->QOSMAPObj.gprtGetDefQpri = &Fir_gprtGetDefQpriIntf;
+    obj->QOSMAPObj.gprtSetDefFpri = &Fir_gprtSetDefFpri;
+    obj->QOSMAPObj.gprtGetDefFpri = &Fir_gprtGetDefFpri;
+    obj->QOSMAPObj.gprtSetInitialPri = &Fir_gprtSetInitialPriIntf;
+    obj->QOSMAPObj.gqosSetPrioMapRule = &Fir_gqosSetPrioMapRuleIntf;
+    obj->QOSMAPObj.gprtRewriteDscp = &Fir_gprtRewriteDscp;
+    obj->QOSMAPObj.gprtSetCosToQueue = &Fir_gprtSetCosToQueue;
+    obj->QOSMAPObj.gprtGetCosToQueue = &Fir_gprtGetCosToQueue;
+    obj->QOSMAPObj.gprtSetCosToDscp = &Fir_gprtSetCosToDscp;
+    obj->QOSMAPObj.gprtGetCosToDscp = &Fir_gprtGetCosToDscp;
+    obj->QOSMAPObj.gprtSetIEEEPrioMapTable = &Fir_gprtSetIEEEPrioMapTableIntf;
+    obj->QOSMAPObj.gprtGetIEEEPrioMapTable = &Fir_gprtGetIEEEPrioMapTableIntf;
+    obj->QOSMAPObj.gprtSetIEEEPrioMapTablePorts = &Fir_gprtSetIEEEPrioMapTablePortsIntf;
+    obj->QOSMAPObj.gprtSetCosToQueueTable = &Fir_gprtSetCosToQueueTable;
+    obj->QOSMAPObj.gprtSetCosToDscpTable = &Fir_gprtSetCosToDscpTable;
+
+    obj->PORTRMONObj.gstatsFlushAll = &Fir_gstatsFlushAll;
+    obj->PORTRMONObj.gstatsFlushPort = &Fir_gstatsFlushPort;
+    obj->PORTRMONObj.gstatsGetPortCounter = &Fir_gstatsGetPortCounterIntf;
+    obj->PORTRMONObj.gstatsGetPortAllCounters = &Fir_gstatsGetPortAllCntersIntf;
+    obj->PORTRMONObj.gstatsGetHistogramMode = &Fir_gstatsGetHistogramModeIntf;
+    obj->PORTRMONObj.gstatsSetHistogramMode = &Fir_gstatsSetHistogramModeIntf;
+    obj->PORTRMONObj.gmibDump = &Fir_gmibDump;
+
+    obj->QUEUEObj.gprtSetQueueCtrl = &Fir_gprtSetQueueCtrlIntf;
+    obj->QUEUEObj.gprtGetQueueCtrl = &Fir_gprtGetQueueCtrlIntf;
+    obj->QUEUEObj.gprtSetPortSched = &Fir_gprtSetPortSchedIntf;
+    obj->QUEUEObj.gprtGetPortSched = &Fir_gprtGetPortSchedIntf;
+    obj->QUEUEObj.gprtSetQoSWeight = &Fir_gprtSetQoSWeightIntf;
+    obj->QUEUEObj.gprtGetQoSWeight = &Fir_gprtGetQoSWeightIntf;
+
+    obj->SYSCTRLObj.gsysSetFloodBC = &Fir_gsysSetFloodBC;
+    obj->SYSCTRLObj.gsysGetFloodBC = &Fir_gsysGetFloodBC;
+    obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Fir_gsysSetEgressMonitorDest;
+    obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Fir_gsysGetEgressMonitorDest;
+    obj->SYSCTRLObj.gsysSetSMISetup = &Fir_gsysSetSMISetup;
+    obj->SYSCTRLObj.gsysGetSMISetup = &Fir_gsysGetSMISetup;
+    obj->SYSCTRLObj.gsysGlobal1RegDump = &Fir_gsysGlobal1RegDump;
+    obj->SYSCTRLObj.gsysGlobal2RegDump = &Fir_gsysGlobal2RegDump;
+    obj->SYSCTRLObj.gsysSetRMUMode = &Fir_gsysSetRMUMode;
+    obj->SYSCTRLObj.gsysGetRMUMode = &Fir_gsysGetRMUMode;
+    obj->SYSCTRLObj.gsysQbvWrite = &Fir_gsysQbvWrite;
+    obj->SYSCTRLObj.gsysQbvRead = &Fir_gsysQbvRead;
+
+    obj->ECIDObj.gBpeEnableSet = &Fir_gBpeEnableSet;
+    obj->ECIDObj.gBpeEnableGet = &Fir_gBpeEnableGet;
+    obj->ECIDObj.gecidAddEntry = &Fir_gecidAddEntryIntf;
+    obj->ECIDObj.gecidDump = &Fir_gecidDump;
+    obj->ECIDObj.gecidFindEcidEntry = &Fir_gecidFindEcidEntryIntf;
+    obj->ECIDObj.gecidFlushAll = &Fir_gecidFlushAll;
+    obj->ECIDObj.gecidFlushEntry = &Fir_gecidFlushEntry;
+    obj->ECIDObj.gecidGetEcidEntryNext = &Fir_gecidGetEcidEntryNextIntf;
+    obj->ECIDObj.gecidGetEntryCount = &Fir_gecidGetEntryCount;
+    obj->ECIDObj.gecidMove = &Fir_gecidMove;
+
+    obj->TCAMObj.gtcamFlushAll = &Fir_gtcamFlushAll;
+    obj->TCAMObj.gtcamFlushEntry = &Fir_gtcamFlushEntry;
+    obj->TCAMObj.gtcamLoadEntry = &Fir_gtcamLoadEntryIntf;
+    obj->TCAMObj.gtcamReadTCAMData = &Fir_gtcamReadTCAMDataIntf;
+    obj->TCAMObj.gtcamGetNextTCAMData = &Fir_gtcamGetNextTCAMDataIntf;
+    obj->TCAMObj.gtcamFindEntry = &Fir_gtcamFindEntryIntf;
+    obj->TCAMObj.gtcamSetMode = &Fir_gtcamSetModeIntf;
+    obj->TCAMObj.gtcamGetMode = &Fir_gtcamGetModeIntf;
+    obj->TCAMObj.gtcamAddEntryPort = &Fir_gtcamAddEntryPort;
+    obj->TCAMObj.gtcamRemoveEntryPort = &Fir_gtcamRemoveEntryPort;
+    obj->TCAMObj.gtcamEgrFlushEntry = &Fir_gtcamEgrFlushEntryIntf;
+    obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Fir_gtcamEgrFlushAllPortsIntf;
+    obj->TCAMObj.gtcamEgrLoadEntry = &Fir_gtcamEgrLoadEntryIntf;
+    obj->TCAMObj.gtcamEgrGetNextTCAMData = &Fir_gtcamEgrGetNextTCAMDataIntf;
+    obj->TCAMObj.gtcamEgrReadTCAMData = &Fir_gtcamEgrReadTCAMDataIntf;
+    obj->TCAMObj.gtcamDump = &Fir_gtcamDump;
+    obj->TCAMObj.gtcamAdvConfig = &Fir_gtcamAdvConfigIntf;
+
+    obj->TCAMRCObj.gtcamRCLoadEntry = &Fir_gtcamRCLoadEntryIntf;
+    obj->TCAMRCObj.gtcamRCFlushAllEntry = &Fir_gtcamRCFlushAllEntry;
+    obj->TCAMRCObj.gtcamRCFlushEntry = &Fir_gtcamRCFlushEntry;
+    obj->TCAMRCObj.gtcamRCReadEntry = &Fir_gtcamRCReadEntryIntf;
+    obj->TCAMRCObj.gtcamRCGetNextEntry = &Fir_gtcamRCGetNextEntryIntf;
+    obj->TCAMRCObj.gtcamRCFindEntry = &Fir_gtcamRCFindEntryIntf;
+    obj->TCAMRCObj.gtcamRCEntryDump = &Fir_gtcamRCEntryDump;
+
+    obj->TCAMRCCompObj.gtcamRCCompLoad = &Fir_gtcamRCCompLoadIntf;
+    obj->TCAMRCCompObj.gtcamRCCompFlushAll = &Fir_gtcamRCCompFlushAll;
+    obj->TCAMRCCompObj.gtcamRCCompFlushPort = &Fir_gtcamRCCompFlushPort;
+    obj->TCAMRCCompObj.gtcamRCCompRead = &Fir_gtcamRCCompReadIntf;
+
+    obj->RMUObj.grmuTCAMDump = &Fir_msdRmuTCAMDumpIntf;
+    obj->RMUObj.grmuTCAMRead = &Fir_msdRmuTCAMReadIntf;
+    obj->RMUObj.grmuTCAMWrite = &Fir_msdRmuTCAMWriteIntf;
+    obj->RMUObj.grmuEcidDump = &Fir_msdRmuEcidDumpIntf;
+
+    obj->RMUObj.grmuGetID = &Fir_msdRmuGetIDIntf;
+    obj->RMUObj.grmuAtuDump = &Fir_msdRmuAtuDumpIntf;
+    obj->RMUObj.grmuMib2Dump = &Fir_msdRmuMib2DumpIntf;
+    obj->RMUObj.grmuMultiRegAccess = &Fir_msdRmuMultiRegAccessIntf;
+    obj->RMUObj.grmuRegDump = &Fir_msdRmuRegDump;
+
+    obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Fir_msdGetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Fir_msdSetSMIC45PhyReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Fir_msdGetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Fir_msdSetSMIPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Fir_msdSetSMIPhyXMDIOReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Fir_msdGetSMIPhyXMDIOReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Fir_msdGetSMIExtPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Fir_msdSetSMIExtPhyReg;
+    obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Fir_msdSetSMIExtPhyXMDIOReg;
+    obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Fir_msdGetSMIExtPhyXMDIOReg;
+
+    obj->LEDObj.gledForceOn = &Fir_gledForceOnIntf;
+    obj->LEDObj.gledForceOff = &Fir_gledForceOffIntf;
+    obj->LEDObj.gledLinkAct = &Fir_gledLinkActIntf;
+    obj->LEDObj.gledModeSet = &Fir_gledModeSetIntf;
+    obj->LEDObj.gledModeGet = &Fir_gledModeGetIntf;
+    obj->LEDObj.gledBlinkRateSet = &Fir_gledBlinkRateSetIntf;
+    obj->LEDObj.gledBlinkRateGet = &Fir_gledBlinkRateGetIntf;
+    obj->LEDObj.gledPulseStretchSet = &Fir_gledPulseStretchSetIntf;
+    obj->LEDObj.gledPulseStretchGet = &Fir_gledPulseStretchGetIntf;
+    obj->LEDObj.gledSpecialModeSet = &Fir_gledSpecialModeSetIntf;
+    obj->LEDObj.gledSpecialModeGet = &Fir_gledSpecialModeGetIntf;
+    obj->LEDObj.gledCtrlSet = &Fir_gledCtrlSetIntf;
+    obj->LEDObj.gledCtrlGet = &Fir_gledCtrlGetIntf;
+    obj->LEDObj.gledDump = &Fir_gledDump;
+
+    obj->POLICYObj.gpolicySetMgmtCtrl = &Fir_gpolicySetMgmtCtrl;
+    obj->POLICYObj.gpolicyGetMgmtCtrl = &Fir_gpolicyGetMgmtCtrl;
+    obj->POLICYObj.gpolicySetCpuDest = &Fir_gpolicySetCpuDest;
+    obj->POLICYObj.gpolicyGetCpuDest = &Fir_gpolicyGetCpuDest;
+    obj->POLICYObj.gpolicySetIngressMonitorDest = &Fir_gpolicySetIgrMonitorDest;
+    obj->POLICYObj.gpolicyGetIngressMonitorDest = &Fir_gpolicyGetIgrMonitorDest;
+    obj->POLICYObj.gpolicySetRsvd2CpuEnables = &Fir_gpolicySetRsvd2CpuEnables;
+    obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &Fir_gpolicyGetRsvd2CpuEnables;
+    obj->POLICYObj.gpolicySetMGMTPri = &Fir_gpolicySetMGMTPri;
+    obj->POLICYObj.gpolicyGetMGMTPri = &Fir_gpolicyGetMGMTPri;
+    obj->POLICYObj.gpolicySetRouteDest = &Fir_gpolicySetRouteDest;
+    obj->POLICYObj.gpolicyGetRouteDest = &Fir_gpolicyGetRouteDest;
+    obj->POLICYObj.gpolicySetMirrorDest = &Fir_gpolicySetMirrorDest;
+    obj->POLICYObj.gpolicyGetMirrorDest = &Fir_gpolicyGetMirrorDest;
+    obj->POLICYObj.gpolicySetIllegalIPAddr = &Fir_gpolicySetIllegalIPAddr;
+    obj->POLICYObj.gpolicyGetIllegalIPAddr = &Fir_gpolicyGetIllegalIPAddr;
+    obj->POLICYObj.gpolicySetDipDaMismatch = &Fir_gpolicySetDipDaMismatch;
+    obj->POLICYObj.gpolicyGetDipDaMismatch = &Fir_gpolicyGetDipDaMismatch;
+    obj->POLICYObj.gpolicySetZeroSIP = &Fir_gpolicySetZeroSIP;
+    obj->POLICYObj.gpolicyGetZeroSIP = &Fir_gpolicyGetZeroSIP;
+    obj->POLICYObj.gpolicySetMcTtlExceeded = &Fir_gpolicySetMcTtlExceeded;
+    obj->POLICYObj.gpolicyGetMcTtlExceeded = &Fir_gpolicyGetMcTtlExceeded;
+    obj->POLICYObj.gpolicySetUcTtlExceeded = &Fir_gpolicySetUcTtlExceeded;
+    obj->POLICYObj.gpolicyGetUcTtlExceeded = &Fir_gpolicyGetUcTtlExceeded;
+    obj->POLICYObj.gprtSetPortTtlThreshold = &Fir_gprtSetPortTtlThreshold;
+    obj->POLICYObj.gprtGetPortTtlThreshold = &Fir_gprtGetPortTtlThreshold;
+    obj->POLICYObj.gpolicySetIpHdrErr = &Fir_gpolicySetIpHdrErr;
+    obj->POLICYObj.gpolicyGetIpHdrErr = &Fir_gpolicyGetIpHdrErr;
+    obj->POLICYObj.gpolicySetTCPFinUrgPsh = &Fir_gpolicySetTCPFinUrgPsh;
+    obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &Fir_gpolicyGetTCPFinUrgPsh;
+    obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &Fir_gpolicySetTCPFlagsSeqNum;
+    obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &Fir_gpolicyGetTCPFlagsSeqNum;
+    obj->POLICYObj.gpolicySetTCPSYN = &Fir_gpolicySetTCPSYN;
+    obj->POLICYObj.gpolicyGetTCPSYN = &Fir_gpolicyGetTCPSYN;
+    obj->POLICYObj.gpolicySetTCPHSize = &Fir_gpolicySetTCPHSize;
+    obj->POLICYObj.gpolicyGetTCPHSize = &Fir_gpolicyGetTCPHSize;
+    obj->POLICYObj.gprtSetPortTCPMinHdrSize = &Fir_gprtSetPortTCPMinHdrSize;
+    obj->POLICYObj.gprtGetPortTCPMinHdrSize = &Fir_gprtGetPortTCPMinHdrSize;
+    obj->POLICYObj.gpolicySetICMPSize = &Fir_gpolicySetICMPSize;
+    obj->POLICYObj.gpolicyGetICMPSize = &Fir_gpolicyGetICMPSize;
+    obj->POLICYObj.gprtSetPortICMPMaxSize = &Fir_gprtSetPortICMPMaxSize;
+    obj->POLICYObj.gprtGetPortICMPMaxSize = &Fir_gprtGetPortICMPMaxSize;
+    obj->POLICYObj.gpolicySetUDPPort = &Fir_gpolicySetUDPPort;
+    obj->POLICYObj.gpolicyGetUDPPort = &Fir_gpolicyGetUDPPort;
+    obj->POLICYObj.gpolicySetTCPPort = &Fir_gpolicySetTCPPort;
+    obj->POLICYObj.gpolicyGetTCPPort = &Fir_gpolicyGetTCPPort;
+    obj->POLICYObj.gpolicySetTCPSynFin = &Fir_gpolicySetTCPSynFin;
+    obj->POLICYObj.gpolicyGetTCPSynFin = &Fir_gpolicyGetTCPSynFin;
+    obj->POLICYObj.gpolicySetTCPFrag = &Fir_gpolicySetTCPFrag;
+    obj->POLICYObj.gpolicyGetTCPFrag = &Fir_gpolicyGetTCPFrag;
+    obj->POLICYObj.gpolicySetNearNonTPMR = &Fir_gpolicySetNearNonTPMR;
+    obj->POLICYObj.gpolicyGetNearNonTPMR = &Fir_gpolicyGetNearNonTPMR;
+    obj->POLICYObj.gpolicySetETag = &Fir_gpolicySetETag;
+    obj->POLICYObj.gpolicyGetETag = &Fir_gpolicyGetETag;
+    obj->POLICYObj.gpolicySetNonETag = &Fir_gpolicySetNonETag;
+    obj->POLICYObj.gpolicyGetNonETag = &Fir_gpolicyGetNonETag;
+    obj->POLICYObj.gpolicyDump = &Fir_gpolicyDump;
+
+    obj->FRERObj.gfrerSeqGenFlushAll = &Fir_gfrerSeqGenFlushAll;
+    obj->FRERObj.gfrerSeqGenFlushEntry = &Fir_gfrerSeqGenFlushEntry;
+    obj->FRERObj.gfrerSeqGenRead = &Fir_gfrerSeqGenReadIntf;
+    obj->FRERObj.gfrerSeqGenLoad = &Fir_gfrerSeqGenLoadIntf;
+
+    obj->FRERObj.gfrerIndvRcvyFlushAll = &Fir_gfrerIndvRcvyFlushAll;
+    obj->FRERObj.gfrerIndvRcvyFlushEntry = &Fir_gfrerIndvRcvyFlushEntry;
+    obj->FRERObj.gfrerIndvRcvyRead = &Fir_gfrerIndvRcvyReadIntf;
+	obj->FRERObj.gfrerIndvRcvyLoad = &Fir_gfrerIndvRcvyLoadIntf;
+    obj->FRERObj.gfrerIndvRcvyGetNext = &Fir_gfrerIndvRcvyGetNextIntf;
+    obj->FRERObj.gfrerIndvRcvyReadClear = &Fir_gfrerIndvRcvyReadClearIntf;
+
+    obj->FRERObj.gfrerSeqRcvyFlushAll = &Fir_gfrerSeqRcvyFlushAll;
+    obj->FRERObj.gfrerSeqRcvyFlushEntry = &Fir_gfrerSeqRcvyFlushEntry;
+    obj->FRERObj.gfrerSeqRcvyRead = &Fir_gfrerSeqRcvyReadIntf;
+    obj->FRERObj.gfrerSeqRcvyLoad = &Fir_gfrerSeqRcvyLoadIntf;
+    obj->FRERObj.gfrerSeqRcvyGetNext = &Fir_gfrerSeqRcvyGetNextIntf;
+    obj->FRERObj.gfrerSeqRcvyGetViolation = &Fir_gfrerSeqRcvyGetViolationIntf;
+    obj->FRERObj.gfrerSeqRcvyReadClear = &Fir_gfrerSeqRcvyReadClearIntf;
+
+    obj->FRERObj.gfrerBank0SCtrFlushAll = &Fir_gfrerBank0SCtrFlushAll;
+    obj->FRERObj.gfrerBank0SCtrFlushEntry = &Fir_gfrerBank0SCtrFlushCtr;
+    obj->FRERObj.gfrerBank0SCtrRead = &Fir_gfrerBank0SCtrReadIntf;
+    obj->FRERObj.gfrerBank0SCtrLoad = &Fir_gfrerBank0SCtrLoadIntf;
+    obj->FRERObj.gfrerBank0SCtrGetNext = &Fir_gfrerBank0SCtrGetNextIntf;
+    obj->FRERObj.gfrerBank0SCtrReadClear = &Fir_gfrerBank0SCtrReadClearIntf;
+
+    obj->FRERObj.gfrerBank1SCtrFlushAll = &Fir_gfrerBank1SCtrFlushAll;
+    obj->FRERObj.gfrerBank1SCtrFlushEntry = &Fir_gfrerBank1SCtrFlushCtr;
+    obj->FRERObj.gfrerBank1SCtrRead = &Fir_gfrerBank1SCtrReadIntf;
+    obj->FRERObj.gfrerBank1SCtrLoad = &Fir_gfrerBank1SCtrLoadIntf;
+    obj->FRERObj.gfrerBank1SCtrGetNext = &Fir_gfrerBank1SCtrGetNextIntf;
+    obj->FRERObj.gfrerBank1SCtrReadClear = &Fir_gfrerBank1SCtrReadClearIntf;
+
+    obj->FRERObj.gfrerSnapshotRefresh = &Fir_gfrerSnapshotRefresh;
+
+    obj->QCRObj.gqcrFlushAll = &Fir_gatsFlushAll;
+    obj->QCRObj.gqcrFlushOne = &Fir_gatsFlushOne;
+    obj->QCRObj.gqcrSetGrpId = &Fir_gatsSetGrpId;
+    obj->QCRObj.gqcrGetGrpId = &Fir_gatsGetGrpId;
+    obj->QCRObj.gqcrSetCbsLimit = &Fir_gatsSetCbsLimit;
+    obj->QCRObj.gqcrGetCbsLimit = &Fir_gatsGetCbsLimit;
+    obj->QCRObj.gqcrSetMaxResidenceTime = &Fir_gatsSetMaxResidenceTime;
+    obj->QCRObj.gqcrGetMaxResidenceTime = &Fir_gatsGetMaxResidenceTime;
+    obj->QCRObj.gqcrSetRateLimit = &Fir_gatsSetRateLimit;
+    obj->QCRObj.gqcrGetRateLimit = &Fir_gatsGetRateLimit;
+    obj->QCRObj.gqcrSetQueueEnables = &Fir_gatsSetQueueEnables;
+    obj->QCRObj.gqcrGetQueueEnables = &Fir_gatsGetQueueEnables;
+
+	obj->QCIObj.gqciStreamFiltFlushAll = &Fir_gqciStreamFiltFlushAll;
+	obj->QCIObj.gqciStreamFiltSet = &Fir_gqciStreamFiltSet;
+	obj->QCIObj.gqciStreamFiltBlockStatSet = &Fir_gqciStreamFiltBlockStatSet;
+	obj->QCIObj.gqciStreamFiltBlockStatGet = &Fir_gqciStreamFiltBlockStatGet;
+	obj->QCIObj.gqciStreamFiltEnAts = &Fir_gqciStreamFiltEnAts;
+	obj->QCIObj.gqciStreamFiltEnGate = &Fir_gqciStreamFiltEnGate;
+	obj->QCIObj.gqciStreamFiltMatchCtrGet = &Fir_gqciStreamFiltMatchCtrGet;
+	obj->QCIObj.gqciStreamFiltFilterCtrGet = &Fir_gqciStreamFiltFilterCtrGet;
+	obj->QCIObj.gqciStreamGateFiltCtrGet = &Fir_gqciStreamGateFiltCtrGet;
+	obj->QCIObj.gqciFlowMeterFiltCtrGet = &Fir_gqciFlowMeterFiltCtrGet;
+	obj->QCIObj.gqciCountersGetBulk = &Fir_gqciCountersGetBulk;
+
+	obj->QCIObj.gqciStreamGateFlushAll = &Fir_gqciStreamGateFlushAll;
+	obj->QCIObj.gqciStreamGateDefStateSet = &Fir_gqciStreamGateDefStateSet;
+	obj->QCIObj.gqciStreamGateScaleSet = &Fir_gqciStreamGateScaleSet;
+	obj->QCIObj.gqciStreamGateTimeGenIdSet = &Fir_gqciStreamGateTimeGenIdSet;
+	obj->QCIObj.gqciStreamGateEntryAdd = &Fir_gqciStreamGateEntryAddIntf;
+
+	obj->QCIObj.gqciStreamGateTimeGenFlush = &Fir_gqciStreamGateTimeGenFlush;
+	obj->QCIObj.gqciStreamGateTimeGenSet = &Fir_gqciStreamGateTimeGenSet;
+	obj->QCIObj.gqciStreamGateScheduleSet = &Fir_gqciStreamGateScheduleSet;
+
+	obj->QCIObj.gqciFlowMeterFlushAll = &Fir_gqciFlowMeterFlushAll;
+	obj->QCIObj.gqciFlowMeterCoupleFlagSet = &Fir_gqciFlowMeterCoupleFlagSet;
+	obj->QCIObj.gqciFlowMeterCoupleFlagGet = &Fir_gqciFlowMeterCoupleFlagGet;
+	obj->QCIObj.gqciFlowMeterDropOnYelSet = &Fir_gqciFlowMeterDropOnYelSet;
+	obj->QCIObj.gqciFlowMeterDropOnYelGet = &Fir_gqciFlowMeterDropOnYelGet;
+	obj->QCIObj.gqciFlowMeterRedBlockEnSet = &Fir_gqciFlowMeterRedBlockEnSet;
+	obj->QCIObj.gqciFlowMeterRedBlockEnGet = &Fir_gqciFlowMeterRedBlockEnGet;
+	obj->QCIObj.gqciFlowMeterRedBlkStatSet = &Fir_gqciFlowMeterRedBlkStatSet;
+	obj->QCIObj.gqciFlowMeterRedBlkStatGet = &Fir_gqciFlowMeterRedBlkStatGet;
+	obj->QCIObj.gqciFlowMeterAdvConfig = &Fir_gqciFlowMeterAdvConfig;
+
+	obj->MACSECObj.gmacsecFlushAll = &Fir_gmacsecFlushAll;
+	obj->MACSECObj.gmacsecCreateRule = &Fir_gmacsecCreateRuleIntf;
+	obj->MACSECObj.gmacsecDeleteRule = &Fir_gmacsecDeleteRule;
+	obj->MACSECObj.gmacsecGetRule = &Fir_gmacsecGetRuleIntf;
+	obj->MACSECObj.gmacsecCreateTxSecY = &Fir_gmacsecCreateTxSecYIntf;
+	obj->MACSECObj.gmacsecDeleteTxSecY = &Fir_gmacsecDeleteTxSecY;
+	obj->MACSECObj.gmacsecGetTxSecY = &Fir_gmacsecGetTxSecYIntf;
+	obj->MACSECObj.gmacsecCreateRxSecY = &Fir_gmacsecCreateRxSecYIntf;
+	obj->MACSECObj.gmacsecDeleteRxSecY = &Fir_gmacsecDeleteRxSecY;
+	obj->MACSECObj.gmacsecGetRxSecY = &Fir_gmacsecGetRxSecYIntf;
+	obj->MACSECObj.gmacsecCreateRxSC = &Fir_gmacsecCreateRxSCIntf;
+	obj->MACSECObj.gmacsecDeleteRxSC = &Fir_gmacsecDeleteRxSC;
+	obj->MACSECObj.gmacsecGetRxSC = &Fir_gmacsecGetRxSCIntf;
+	obj->MACSECObj.gmacsecCreateRxSA = &Fir_gmacsecCreateRxSAIntf;
+	obj->MACSECObj.gmacsecDeleteRxSA = &Fir_gmacsecDeleteRxSA;
+	obj->MACSECObj.gmacsecGetRxSA = &Fir_gmacsecGetRxSAIntf;
+	obj->MACSECObj.gmacsecCreateTxSC = &Fir_gmacsecCreateTxSCIntf;
+	obj->MACSECObj.gmacsecDeleteTxSC = &Fir_gmacsecDeleteTxSC;
+	obj->MACSECObj.gmacsecGetTxSC = &Fir_gmacsecGetTxSCIntf;
+	obj->MACSECObj.gmacsecCreateTxSA = &Fir_gmacsecCreateTxSAIntf;
+	obj->MACSECObj.gmacsecDeleteTxSA = &Fir_gmacsecDeleteTxSA;
+	obj->MACSECObj.gmacsecGetTxSA = &Fir_gmacsecGetTxSAIntf;
+	obj->MACSECObj.gmacsecGetRXSCStates = &Fir_gmacsecGetRXSCStatesIntf;
+	obj->MACSECObj.gmacsecGetRXSecYStates = &Fir_gmacsecGetRXSecYStatesIntf;
+	obj->MACSECObj.gmacsecGetTXSCStates = &Fir_gmacsecGetTXSCStatesIntf;
+	obj->MACSECObj.gmacsecGetTXSecYStates = &Fir_gmacsecGetTXSecYStatesIntf;
+	obj->MACSECObj.gmacsecEnableEgressSet = &Fir_gmacsecEnableEgressSet;
+	obj->MACSECObj.gmacsecEnableEgressGet = &Fir_gmacsecEnableEgressGet;
+	obj->MACSECObj.gmacsecEnableIngressSet = &Fir_gmacsecEnableIngressSet;
+	obj->MACSECObj.gmacsecEnableIngressGet = &Fir_gmacsecEnableIngressGet;
+	obj->MACSECObj.gmacsecSetTxPNThreshold = &Fir_gmacsecSetTxPNThreshold;
+	obj->MACSECObj.gmacsecGetTxPNThreshold = &Fir_gmacsecGetTxPNThreshold;
+	obj->MACSECObj.gmacsecSetTxXPNThreshold = &Fir_gmacsecSetTxXPNThreshold;
+	obj->MACSECObj.gmacsecGetTxXPNThreshold = &Fir_gmacsecGetTxXPNThreshold;
+	obj->MACSECObj.gmacsecSetRxDefaultSCI = &Fir_gmacsecSetRxDefaultSCI;
+	obj->MACSECObj.gmacsecGetRxDefaultSCI = &Fir_gmacsecGetRxDefaultSCI;
+	obj->MACSECObj.gmacsecSetTxSCIntCtrl = &Fir_gmacsecSetTxSCIntCtrlIntf;
+	obj->MACSECObj.gmacsecGetTxSCIntCtrl = &Fir_gmacsecGetTxSCIntCtrlIntf;
+	obj->MACSECObj.gmacsecGetNextTxSCIntStatus = &Fir_gmacsecGetNextTxSCIntStatusIntf;
+	obj->MACSECObj.gmacsecGetStatsBulk = &Fir_gmacsecGetStatsBulk;
 
 #endif
     return MSD_OK;
 }
 
-static MSD_STATUS InitDevObj_Bonsai(MSD_QD_DEV *dev)
+static MSD_STATUS InitDevObj_Bonsai(MSD_QD_DEV *dev, SwitchDevObj_ *obj)
 {
 #ifdef BONSAI_BUILD_IN
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = &Bonsai_gfdbAddMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = &Bonsai_gfdbGetAtuEntryNextIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = &Bonsai_gfdbFlushIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFlushInDB = &Bonsai_gfdbFlushInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMove = &Bonsai_gfdbMoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = &Bonsai_gfdbMoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = &Bonsai_gfdbPortRemoveIntf;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = &Bonsai_gfdbPortRemoveInDBIntf;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = &Bonsai_gfdbDelAtuEntry;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = &Bonsai_gfdbGetViolationIntf;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = &Bonsai_gfdbFindAtuMacEntryIntf;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = &Bonsai_gfdbSetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = &Bonsai_gfdbGetAgingTimeout;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = &Bonsai_gfdbSetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = &Bonsai_gfdbGetLearn2All;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = &Bonsai_gfdbSetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = &Bonsai_gfdbGetPortLearnLimit;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = &Bonsai_gfdbGetPortLearnCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = &Bonsai_gfdbGetEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = &Bonsai_gfdbGetEntryCountPerFid;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = &Bonsai_gfdbGetNonStaticEntryCount;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = &Bonsai_gfdbGetNStaticEntryCountFid;
-	dev->SwitchDevObj.ATUObj.gfdbDump = &Bonsai_gfdbDump;
-
-	dev->SwitchDevObj.ARPObj.garpLoadMcEntry = &Bonsai_garpLoadMcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpLoadUcEntry = &Bonsai_garpLoadUcEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpFlushEntry = &Bonsai_garpFlushEntry;
-	dev->SwitchDevObj.ARPObj.garpFlushAll = &Bonsai_garpFlushAll;
-	dev->SwitchDevObj.ARPObj.garpReadEntry = &Bonsai_garpReadEntryIntf;
-	dev->SwitchDevObj.ARPObj.garpGetNextEntry = &Bonsai_garpGetNextEntryIntf;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = &Bonsai_gqavGetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = &Bonsai_gqavSetPortQpriXHiLimit;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = &Bonsai_gqavGetPortQpriXRate;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = &Bonsai_gqavSetPortQpriXRate;
-
-	dev->SwitchDevObj.PHYCTRLObj.serdesReset = &Bonsai_serdesReset;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = &Bonsai_gptpSetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = &Bonsai_gptpGetIntEnableIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = &Bonsai_gptpSetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = &Bonsai_gptpGetPortPTPEn;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = &Bonsai_gptpGetTimeStampIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = &Bonsai_gptpGetTSValidSt;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = &Bonsai_gptpResetTimeStamp;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = &Bonsai_gptpGetIntStatusIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = &Bonsai_gptpSetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = &Bonsai_gptpGetMeanPathDelay;
-	dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = &Bonsai_gptpSetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = &Bonsai_gptpGetIgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = &Bonsai_gptpSetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = &Bonsai_gptpGetEgrPathDelayAsym;
-	dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = &Bonsai_gptpGetTODBusyBitStatus;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = &Bonsai_gptpTODStoreCompenIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreAll = &Bonsai_gptpTODStoreAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = &Bonsai_gptpTODCaptureAllIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetPulse = &Bonsai_gptpSetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gptpGetPulse = &Bonsai_gptpGetPulseIntf;
-	dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = &Bonsai_gtaiGetPTPGlobalTime;
-	dev->SwitchDevObj.PTPObj.gptpGetPortReg = &Bonsai_gptpPortRegGet;
-	dev->SwitchDevObj.PTPObj.gptpSetPortReg = &Bonsai_gptpPortRegSet;
-	dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = &Bonsai_gptpGlobalRegGet;
-	dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = &Bonsai_gptpGlobalRegSet;
-	dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = &Bonsai_gptp1588v2ConfigSetIntf;
-	dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = &Bonsai_gptp8021asConfigSetIntf;
-	dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = &Bonsai_gptp8021asRevCfgSetIntf;
-	dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = &Bonsai_gptpPreemptTsSelSet;
-	dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = &Bonsai_gptpPreemptTsSelGet;
-	dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = &Bonsai_gptpPreemptCtrlSet;
-	dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = &Bonsai_gptpPreemptCtrlGet;
-	dev->SwitchDevObj.PTPObj.gtaiSetTrigGenTimerSel = &Bonsai_gtaiTrigGenTimerSelSet;
-	dev->SwitchDevObj.PTPObj.gtaiGetTrigGenTimerSel = &Bonsai_gtaiTrigGenTimerSelGet;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = &Bonsai_gprtSetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = &Bonsai_gprtGetIgnoreFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = &Bonsai_gprtSetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = &Bonsai_gprtGetAllowBadFcs;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = &Bonsai_gprtSetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = &Bonsai_gprtGetPauseLimitOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = &Bonsai_gprtSetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = &Bonsai_gprtGetPauseLimitIn;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = &Bonsai_gprtSetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = &Bonsai_gprtGetQueueToPause;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Bonsai_gprtSetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Bonsai_gprtGetRxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Bonsai_gprtSetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Bonsai_gprtGetRxPriFlowCtrlToQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Bonsai_gprtSetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Bonsai_gprtGetTxPriFlowCtrlEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = &Bonsai_gprtGetOutQueueSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = &Bonsai_gprtSetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = &Bonsai_gprtGetMapDA;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = &Bonsai_gprtSetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = &Bonsai_gprtGetPortLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = &Bonsai_gprtSetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = &Bonsai_gprtGetHoldAt1;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = &Bonsai_gprtSetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = &Bonsai_gprtGetInt0nAgeOut;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = &Bonsai_gprtSetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = &Bonsai_gprtGetRefreshLocked;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = &Bonsai_gprtSetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = &Bonsai_gprtGetIgnoreWrongData;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = &Bonsai_gprtSetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = &Bonsai_gprtGetARPMirror;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = &Bonsai_gprtSetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = &Bonsai_gprtGetForceDefaultVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = &Bonsai_gvlnSetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = &Bonsai_gvlnGetPortVid;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Bonsai_gvlnSetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Bonsai_gvlnGetPortVlanQModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = &Bonsai_gprtSetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = &Bonsai_gprtGetDiscardTaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = &Bonsai_gprtSetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = &Bonsai_gprtGetDiscardUntaggedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = &Bonsai_gprtSetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = &Bonsai_gprtGetUnicFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = &Bonsai_gprtSetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = &Bonsai_gprtGetMultiFloodBlockIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = &Bonsai_gprtSetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = &Bonsai_gprtGetDiscardBCastModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = &Bonsai_gprtSetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = &Bonsai_gprtGetIGMPSnoopEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = &Bonsai_gprtSetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = &Bonsai_gprtGetHeaderMode;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = &Bonsai_gprtSetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = &Bonsai_gprtGetDropOnLock;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = &Bonsai_gprtSetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = &Bonsai_gprtGetJumboModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = &Bonsai_gprtSetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = &Bonsai_gprtGetSpecifiedMTUIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = &Bonsai_gprtSetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = &Bonsai_gprtGetLearnEnableIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = &Bonsai_gprtSetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = &Bonsai_gprtGetVTUPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = &Bonsai_gprtSetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = &Bonsai_gprtGetSAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = &Bonsai_gprtSetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = &Bonsai_gprtGetDAPriOverrideIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = &Bonsai_gprtSetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = &Bonsai_gprtGetMessagePort;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = &Bonsai_gprtSetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = &Bonsai_gprtGetEtherType;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = &Bonsai_gprtSetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = &Bonsai_gprtGetAllowVidZero;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = &Bonsai_gprtSetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = &Bonsai_gprtGetFlowCtrlIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = &Bonsai_gprtSetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = &Bonsai_gprtGetEgressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = &Bonsai_gprtSetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = &Bonsai_gprtGetIngressMonitorSource;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = &Bonsai_grcSetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = &Bonsai_grcGetEgressRateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplexStatus = &Bonsai_gprtGetDuplexStatusIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = &Bonsai_gprtSetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = &Bonsai_gprtGetDuplexIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = &Bonsai_gprtGetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceLink = &Bonsai_gprtSetForceLinkIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = &Bonsai_gprtGetLinkState;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = &Bonsai_gprtSetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = &Bonsai_gprtGetForceSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = &Bonsai_gprtGetSpeedIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = &Bonsai_gprtSetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = &Bonsai_gprtGetFrameModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = &Bonsai_gprtSetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = &Bonsai_gprtGetPortECID;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = &Bonsai_gprtSetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = &Bonsai_gprtGetEgressModeIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = &Bonsai_gprtSetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreETag = &Bonsai_gprtGetIgnoreETag;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Bonsai_gprtSetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Bonsai_gprtGetExtendedPortCtrlReg;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = &Bonsai_gprtSetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = &Bonsai_gprtGetVlanPorts;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = &Bonsai_gprtSetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = &Bonsai_gprtGetPortStateIntf;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = &Bonsai_gprtSetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = &Bonsai_gprtGetPreemptEnable;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = &Bonsai_gprtSetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = &Bonsai_gprtGetPreemptSize;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = &Bonsai_gprtSetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = &Bonsai_gprtGetPreemptQueue;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = &Bonsai_gprtRegDump;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = &Bonsai_gstuAddEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = &Bonsai_gstuGetEntryNextIntf;
-	dev->SwitchDevObj.STUObj.gstuDelEntry = &Bonsai_gstuDelEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = &Bonsai_gstuFindSidEntryIntf;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = &Bonsai_gstuGetEntryCountIntf;
-	dev->SwitchDevObj.STUObj.gstuDump = &Bonsai_gstuDump;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = &Bonsai_gvtuFindVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = &Bonsai_gvtuExistVidEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = &Bonsai_gvtuFlushIntf;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = &Bonsai_gvtuAddEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = &Bonsai_gvtuGetEntryNextIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = &Bonsai_gvtuDelEntryIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = &Bonsai_gvtuSetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = &Bonsai_gvtuGetModeIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = &Bonsai_gvtuGetViolationIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = &Bonsai_gvtuGetEntryCountIntf;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = &Bonsai_gvtuSetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = &Bonsai_gvtuGetMemberTagIntf;
-	dev->SwitchDevObj.VTUObj.gvtuDump = &Bonsai_gvtuDump;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = &Bonsai_gprtSetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = &Bonsai_gprtGetTrunkPort;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = &Bonsai_gsysSetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = &Bonsai_gsysGetTrunkMaskTable;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = &Bonsai_gsysSetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = &Bonsai_gsysGetHashTrunk;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = &Bonsai_gsysSetTrunkRouting;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = &Bonsai_gsysGetTrunkRouting;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = &Bonsai_EEPROMWriteIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = &Bonsai_EEPROMReadIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = &Bonsai_EEPROMChipSelSetIntf;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = &Bonsai_EEPROMChipSelGetIntf;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = &Bonsai_gsysDevIntEnableSet;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = &Bonsai_gsysDevIntEnableGet;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = &Bonsai_gsysDevIntStatusGet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = &Bonsai_gsysActiveIntEnableSet;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = &Bonsai_gsysActiveIntEnableGet;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = &Bonsai_gsysActiveIntStatusGet;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = &Bonsai_gpirlInitializeIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = &Bonsai_gpirlInitResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = &Bonsai_gpirlCustomSetup_sr2cIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = &Bonsai_gpirlReadResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = &Bonsai_gpirlWriteResourceIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = &Bonsai_gpirlGetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = &Bonsai_gpirlSetResRegIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = &Bonsai_gpirlAdvConfigIntf;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = &Bonsai_gpirlAdvConfigDisableIntf;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = &Bonsai_gprtGetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = &Bonsai_gprtSetIEEEPrioMapIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = &Bonsai_gqosGetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = &Bonsai_gprtGetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = &Bonsai_gprtSetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = &Bonsai_gprtGetDefQpriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefFpri = &Bonsai_gprtSetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefFpri = &Bonsai_gprtGetDefFpri;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = &Bonsai_gprtSetInitialPriIntf;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = &Bonsai_gqosSetPrioMapRuleIntf;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = &Bonsai_gprtRewriteDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = &Bonsai_gprtSetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = &Bonsai_gprtGetCosToQueue;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = &Bonsai_gprtSetCosToDscp;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = &Bonsai_gprtGetCosToDscp;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = &Bonsai_gstatsFlushAll;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = &Bonsai_gstatsFlushPort;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = &Bonsai_gstatsGetPortCounterIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = &Bonsai_gstatsGetPortAllCntersIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = &Bonsai_gstatsGetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = &Bonsai_gstatsSetHistogramModeIntf;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = &Bonsai_gmibDump;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = &Bonsai_gprtSetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = &Bonsai_gprtGetQueueCtrlIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = &Bonsai_gprtSetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = &Bonsai_gprtGetPortSchedIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtSetQoSWeight = &Bonsai_gprtSetQoSWeightIntf;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQoSWeight = &Bonsai_gprtGetQoSWeightIntf;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = &Bonsai_gsysSetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = &Bonsai_gsysGetFloodBC;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = &Bonsai_gsysSetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = &Bonsai_gsysGetEgressMonitorDest;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = &Bonsai_gsysSetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = &Bonsai_gsysGetSMISetup;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = &Bonsai_gsysGlobal1RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = &Bonsai_gsysGlobal2RegDump;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = &Bonsai_gsysSetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = &Bonsai_gsysGetRMUMode;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = &Bonsai_gsysQbvWrite;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = &Bonsai_gsysQbvRead;
-
-	dev->SwitchDevObj.ECIDObj.gBpeEnableSet = &Bonsai_gBpeEnableSet;
-	dev->SwitchDevObj.ECIDObj.gBpeEnableGet = &Bonsai_gBpeEnableGet;
-	dev->SwitchDevObj.ECIDObj.gecidAddEntry = &Bonsai_gecidAddEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidDump = &Bonsai_gecidDump;
-	dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = &Bonsai_gecidFindEcidEntryIntf;
-	dev->SwitchDevObj.ECIDObj.gecidFlushAll = &Bonsai_gecidFlushAll;
-	dev->SwitchDevObj.ECIDObj.gecidFlushEntry = &Bonsai_gecidFlushEntry;
-	dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = &Bonsai_gecidGetEcidEntryNextIntf;
-	dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = &Bonsai_gecidGetEntryCount;
-	dev->SwitchDevObj.ECIDObj.gecidMove = &Bonsai_gecidMove;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = &Bonsai_gtcamFlushAll;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = &Bonsai_gtcamFlushEntry;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = &Bonsai_gtcamLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = &Bonsai_gtcamReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = &Bonsai_gtcamGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = &Bonsai_gtcamFindEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = &Bonsai_gtcamSetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = &Bonsai_gtcamGetModeIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = &Bonsai_gtcamAddEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = &Bonsai_gtcamRemoveEntryPort;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = &Bonsai_gtcamEgrFlushEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = &Bonsai_gtcamEgrFlushAllPortsIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = &Bonsai_gtcamEgrLoadEntryIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = &Bonsai_gtcamEgrGetNextTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = &Bonsai_gtcamEgrReadTCAMDataIntf;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = &Bonsai_gtcamDump;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = &Bonsai_gtcamAdvConfigIntf;
-
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = &Bonsai_gtcamRCLoadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushAllEntry = &Bonsai_gtcamRCFlushAllEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = &Bonsai_gtcamRCFlushEntry;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = &Bonsai_gtcamRCReadEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = &Bonsai_gtcamRCGetNextEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = &Bonsai_gtcamRCFindEntryIntf;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = &Bonsai_gtcamRCEntryDump;
-
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = &Bonsai_gtcamRCCompLoadIntf;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = &Bonsai_gtcamRCCompFlushAll;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = &Bonsai_gtcamRCCompFlushPort;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = &Bonsai_gtcamRCCompReadIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = &Bonsai_msdRmuTCAMDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = &Bonsai_msdRmuTCAMReadIntf;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = &Bonsai_msdRmuTCAMWriteIntf;
-	dev->SwitchDevObj.RMUObj.grmuEcidDump = &Bonsai_msdRmuEcidDumpIntf;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = &Bonsai_msdRmuGetIDIntf;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = &Bonsai_msdRmuAtuDumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = &Bonsai_msdRmuMib2DumpIntf;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = &Bonsai_msdRmuMultiRegAccessIntf;
-	dev->SwitchDevObj.RMUObj.grmuRegDump = &Bonsai_msdRmuRegDump;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Bonsai_msdGetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Bonsai_msdSetSMIC45PhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = &Bonsai_msdGetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = &Bonsai_msdSetSMIPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Bonsai_msdSetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Bonsai_msdGetSMIPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Bonsai_msdGetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Bonsai_msdSetSMIExtPhyReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Bonsai_msdSetSMIExtPhyXMDIOReg;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Bonsai_msdGetSMIExtPhyXMDIOReg;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = &Bonsai_gledForceOnIntf;
-	dev->SwitchDevObj.LEDObj.gledForceOff = &Bonsai_gledForceOffIntf;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = &Bonsai_gledLinkActIntf;
-	dev->SwitchDevObj.LEDObj.gledModeSet = &Bonsai_gledModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledModeGet = &Bonsai_gledModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = &Bonsai_gledBlinkRateSetIntf;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = &Bonsai_gledBlinkRateGetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = &Bonsai_gledPulseStretchSetIntf;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = &Bonsai_gledPulseStretchGetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = &Bonsai_gledSpecialModeSetIntf;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = &Bonsai_gledSpecialModeGetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = &Bonsai_gledCtrlSetIntf;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = &Bonsai_gledCtrlGetIntf;
-	dev->SwitchDevObj.LEDObj.gledDump = &Bonsai_gledDump;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = &Bonsai_gpolicySetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = &Bonsai_gpolicyGetMgmtCtrl;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = &Bonsai_gpolicySetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = &Bonsai_gpolicyGetCpuDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = &Bonsai_gpolicySetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = &Bonsai_gpolicyGetIgrMonitorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = &Bonsai_gpolicySetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = &Bonsai_gpolicyGetRsvd2CpuEnables;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = &Bonsai_gpolicySetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = &Bonsai_gpolicyGetMGMTPri;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = &Bonsai_gpolicySetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = &Bonsai_gpolicyGetRouteDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = &Bonsai_gpolicySetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = &Bonsai_gpolicyGetMirrorDest;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = &Bonsai_gpolicySetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = &Bonsai_gpolicyGetIllegalIPAddr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = &Bonsai_gpolicySetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = &Bonsai_gpolicyGetDipDaMismatch;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = &Bonsai_gpolicySetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = &Bonsai_gpolicyGetZeroSIP;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = &Bonsai_gpolicySetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = &Bonsai_gpolicyGetMcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = &Bonsai_gpolicySetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = &Bonsai_gpolicyGetUcTtlExceeded;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = &Bonsai_gprtSetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = &Bonsai_gprtGetPortTtlThreshold;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = &Bonsai_gpolicySetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = &Bonsai_gpolicyGetIpHdrErr;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = &Bonsai_gpolicySetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = &Bonsai_gpolicyGetTCPFinUrgPsh;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = &Bonsai_gpolicySetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = &Bonsai_gpolicyGetTCPFlagsSeqNum;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = &Bonsai_gpolicySetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = &Bonsai_gpolicyGetTCPSYN;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = &Bonsai_gpolicySetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = &Bonsai_gpolicyGetTCPHSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = &Bonsai_gprtSetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = &Bonsai_gprtGetPortTCPMinHdrSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = &Bonsai_gpolicySetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = &Bonsai_gpolicyGetICMPSize;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = &Bonsai_gprtSetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = &Bonsai_gprtGetPortICMPMaxSize;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = &Bonsai_gpolicySetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = &Bonsai_gpolicyGetUDPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = &Bonsai_gpolicySetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = &Bonsai_gpolicyGetTCPPort;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = &Bonsai_gpolicySetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = &Bonsai_gpolicyGetTCPSynFin;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = &Bonsai_gpolicySetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = &Bonsai_gpolicyGetTCPFrag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = &Bonsai_gpolicySetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = &Bonsai_gpolicyGetNearNonTPMR;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = &Bonsai_gpolicySetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = &Bonsai_gpolicyGetETag;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = &Bonsai_gpolicySetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = &Bonsai_gpolicyGetNonETag;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = &Bonsai_gpolicyDump;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFlushAll = &Bonsai_gqciStreamFiltFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltSet = &Bonsai_gqciStreamFiltSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatSet = &Bonsai_gqciStreamFiltBlockStatSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatGet = &Bonsai_gqciStreamFiltBlockStatGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnAts = &Bonsai_gqciStreamFiltEnAts;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnGate = &Bonsai_gqciStreamFiltEnGate;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltMatchCtrGet = &Bonsai_gqciStreamFiltMatchCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFilterCtrGet = &Bonsai_gqciStreamFiltFilterCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFiltCtrGet = &Bonsai_gqciStreamGateFiltCtrGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFiltCtrGet = &Bonsai_gqciFlowMeterFiltCtrGet;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFlushAll = &Bonsai_gqciStreamGateFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateDefStateSet = &Bonsai_gqciStreamGateDefStateSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateScaleSet = &Bonsai_gqciStreamGateScaleSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenIdSet = &Bonsai_gqciStreamGateTimeGenIdSet;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateEntryAdd = &Bonsai_gqciStreamGateEntryAddIntf;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenFlush = &Bonsai_gqciStreamGateTimeGenFlush;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenSet = &Bonsai_gqciStreamGateTimeGenSet;
-
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFlushAll = &Bonsai_gqciFlowMeterFlushAll;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagSet = &Bonsai_gqciFlowMeterCoupleFlagSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagGet = &Bonsai_gqciFlowMeterCoupleFlagGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelSet = &Bonsai_gqciFlowMeterDropOnYelSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelGet = &Bonsai_gqciFlowMeterDropOnYelGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnSet = &Bonsai_gqciFlowMeterRedBlockEnSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnGet = &Bonsai_gqciFlowMeterRedBlockEnGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatSet = &Bonsai_gqciFlowMeterRedBlkStatSet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatGet = &Bonsai_gqciFlowMeterRedBlkStatGet;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterAdvConfig = &Bonsai_gqciFlowMeterAdvConfig;
+	obj->ATUObj.gfdbAddMacEntry = &Bonsai_gfdbAddMacEntryIntf;
+	obj->ATUObj.gfdbGetAtuEntryNext = &Bonsai_gfdbGetAtuEntryNextIntf;
+	obj->ATUObj.gfdbFlush = &Bonsai_gfdbFlushIntf;
+	obj->ATUObj.gfdbFlushInDB = &Bonsai_gfdbFlushInDBIntf;
+	obj->ATUObj.gfdbMove = &Bonsai_gfdbMoveIntf;
+	obj->ATUObj.gfdbMoveInDB = &Bonsai_gfdbMoveInDBIntf;
+	obj->ATUObj.gfdbPortRemove = &Bonsai_gfdbPortRemoveIntf;
+	obj->ATUObj.gfdbPortRemoveInDB = &Bonsai_gfdbPortRemoveInDBIntf;
+	obj->ATUObj.gfdbDelAtuEntry = &Bonsai_gfdbDelAtuEntry;
+	obj->ATUObj.gfdbGetViolation = &Bonsai_gfdbGetViolationIntf;
+	obj->ATUObj.gfdbFindAtuMacEntry = &Bonsai_gfdbFindAtuMacEntryIntf;
+	obj->ATUObj.gfdbSetAgingTimeout = &Bonsai_gfdbSetAgingTimeout;
+	obj->ATUObj.gfdbGetAgingTimeout = &Bonsai_gfdbGetAgingTimeout;
+	obj->ATUObj.gfdbSetLearn2All = &Bonsai_gfdbSetLearn2All;
+	obj->ATUObj.gfdbGetLearn2All = &Bonsai_gfdbGetLearn2All;
+	obj->ATUObj.gfdbSetPortLearnLimit = &Bonsai_gfdbSetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnLimit = &Bonsai_gfdbGetPortLearnLimit;
+	obj->ATUObj.gfdbGetPortLearnCount = &Bonsai_gfdbGetPortLearnCount;
+	obj->ATUObj.gfdbGetEntryCount = &Bonsai_gfdbGetEntryCount;
+	obj->ATUObj.gfdbGetEntryCountPerFid = &Bonsai_gfdbGetEntryCountPerFid;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = &Bonsai_gfdbGetNonStaticEntryCount;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = &Bonsai_gfdbGetNStaticEntryCountFid;
+	obj->ATUObj.gfdbDump = &Bonsai_gfdbDump;
+
+	obj->ARPObj.garpLoadMcEntry = &Bonsai_garpLoadMcEntryIntf;
+	obj->ARPObj.garpLoadUcEntry = &Bonsai_garpLoadUcEntryIntf;
+	obj->ARPObj.garpFlushEntry = &Bonsai_garpFlushEntry;
+	obj->ARPObj.garpFlushAll = &Bonsai_garpFlushAll;
+	obj->ARPObj.garpReadEntry = &Bonsai_garpReadEntryIntf;
+	obj->ARPObj.garpGetNextEntry = &Bonsai_garpGetNextEntryIntf;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = &Bonsai_gqavGetPortQpriXHiLimit;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = &Bonsai_gqavSetPortQpriXHiLimit;
+	obj->QAVObj.gqavGetPortQpriXRate = &Bonsai_gqavGetPortQpriXRate;
+	obj->QAVObj.gqavSetPortQpriXRate = &Bonsai_gqavSetPortQpriXRate;
+
+	obj->PHYCTRLObj.serdesReset = &Bonsai_serdesReset;
+
+	obj->PTPObj.gptpSetIntEnable = &Bonsai_gptpSetIntEnableIntf;
+	obj->PTPObj.gptpGetIntEnable = &Bonsai_gptpGetIntEnableIntf;
+	obj->PTPObj.gptpSetProtPTPEn = &Bonsai_gptpSetPortPTPEn;
+	obj->PTPObj.gptpGetProtPTPEn = &Bonsai_gptpGetPortPTPEn;
+	obj->PTPObj.gptpGetTimeStamp = &Bonsai_gptpGetTimeStampIntf;
+	obj->PTPObj.gptpGetTSValidSt = &Bonsai_gptpGetTSValidSt;
+	obj->PTPObj.gptpResetTimeStamp = &Bonsai_gptpResetTimeStamp;
+	obj->PTPObj.gptpGetIntStatus = &Bonsai_gptpGetIntStatusIntf;
+	obj->PTPObj.gptpSetMeanPathDelay = &Bonsai_gptpSetMeanPathDelay;
+	obj->PTPObj.gptpGetMeanPathDelay = &Bonsai_gptpGetMeanPathDelay;
+	obj->PTPObj.gptpSetIgrPathDelayAsym = &Bonsai_gptpSetIgrPathDelayAsym;
+	obj->PTPObj.gptpGetIgrPathDelayAsym = &Bonsai_gptpGetIgrPathDelayAsym;
+	obj->PTPObj.gptpSetEgrPathDelayAsym = &Bonsai_gptpSetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetEgrPathDelayAsym = &Bonsai_gptpGetEgrPathDelayAsym;
+	obj->PTPObj.gptpGetTODBusyBitStatus = &Bonsai_gptpGetTODBusyBitStatus;
+	obj->PTPObj.gptpTODStoreCompensation = &Bonsai_gptpTODStoreCompenIntf;
+	obj->PTPObj.gptpTODStoreAll = &Bonsai_gptpTODStoreAllIntf;
+	obj->PTPObj.gptpTODCaptureAll = &Bonsai_gptpTODCaptureAllIntf;
+	obj->PTPObj.gptpSetPulse = &Bonsai_gptpSetPulseIntf;
+	obj->PTPObj.gptpGetPulse = &Bonsai_gptpGetPulseIntf;
+	obj->PTPObj.gtaiGetPTPGlobalTime = &Bonsai_gtaiGetPTPGlobalTime;
+	obj->PTPObj.gptpGetPortReg = &Bonsai_gptpPortRegGet;
+	obj->PTPObj.gptpSetPortReg = &Bonsai_gptpPortRegSet;
+	obj->PTPObj.gptpGetGlobalReg = &Bonsai_gptpGlobalRegGet;
+	obj->PTPObj.gptpSetGlobalReg = &Bonsai_gptpGlobalRegSet;
+	obj->PTPObj.gptpSet1588v2Config = &Bonsai_gptp1588v2ConfigSetIntf;
+	obj->PTPObj.gptpSet8021asConfig = &Bonsai_gptp8021asConfigSetIntf;
+	obj->PTPObj.gptpSet8021asRevConfig = &Bonsai_gptp8021asRevCfgSetIntf;
+	obj->PTPObj.gptpSetPreemptTsSel = &Bonsai_gptpPreemptTsSelSet;
+	obj->PTPObj.gptpGetPreemptTsSel = &Bonsai_gptpPreemptTsSelGet;
+	obj->PTPObj.gptpSetPreemptCtrl = &Bonsai_gptpPreemptCtrlSet;
+	obj->PTPObj.gptpGetPreemptCtrl = &Bonsai_gptpPreemptCtrlGet;
+	obj->PTPObj.gtaiSetTrigGenTimerSel = &Bonsai_gtaiTrigGenTimerSelSet;
+	obj->PTPObj.gtaiGetTrigGenTimerSel = &Bonsai_gtaiTrigGenTimerSelGet;
+
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = &Bonsai_gprtSetIgnoreFcs;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = &Bonsai_gprtGetIgnoreFcs;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = &Bonsai_gprtSetAllowBadFcs;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = &Bonsai_gprtGetAllowBadFcs;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = &Bonsai_gprtSetPauseLimitOut;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = &Bonsai_gprtGetPauseLimitOut;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = &Bonsai_gprtSetPauseLimitIn;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = &Bonsai_gprtGetPauseLimitIn;
+	obj->PORTCTRLObj.gprtSetQueueToPause = &Bonsai_gprtSetQueueToPause;
+	obj->PORTCTRLObj.gprtGetQueueToPause = &Bonsai_gprtGetQueueToPause;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = &Bonsai_gprtSetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = &Bonsai_gprtGetRxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = &Bonsai_gprtSetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = &Bonsai_gprtGetRxPriFlowCtrlToQueue;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = &Bonsai_gprtSetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = &Bonsai_gprtGetTxPriFlowCtrlEnable;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = &Bonsai_gprtGetOutQueueSize;
+	obj->PORTCTRLObj.gprtSetMapDA = &Bonsai_gprtSetMapDA;
+	obj->PORTCTRLObj.gprtGetMapDA = &Bonsai_gprtGetMapDA;
+	obj->PORTCTRLObj.gprtSetPortLocked = &Bonsai_gprtSetPortLocked;
+	obj->PORTCTRLObj.gprtGetPortLocked = &Bonsai_gprtGetPortLocked;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = &Bonsai_gprtSetHoldAt1;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = &Bonsai_gprtGetHoldAt1;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = &Bonsai_gprtSetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = &Bonsai_gprtGetInt0nAgeOut;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = &Bonsai_gprtSetRefreshLocked;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = &Bonsai_gprtGetRefreshLocked;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = &Bonsai_gprtSetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = &Bonsai_gprtGetIgnoreWrongData;
+	obj->PORTCTRLObj.gprtSetARPMirror = &Bonsai_gprtSetARPMirror;
+	obj->PORTCTRLObj.gprtGetARPMirror = &Bonsai_gprtGetARPMirror;
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = &Bonsai_gprtSetForceDefaultVid;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = &Bonsai_gprtGetForceDefaultVid;
+	obj->PORTCTRLObj.gvlnSetPortVid = &Bonsai_gvlnSetPortVid;
+	obj->PORTCTRLObj.gvlnGetPortVid = &Bonsai_gvlnGetPortVid;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = &Bonsai_gvlnSetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = &Bonsai_gvlnGetPortVlanQModeIntf;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = &Bonsai_gprtSetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = &Bonsai_gprtGetDiscardTaggedIntf;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = &Bonsai_gprtSetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = &Bonsai_gprtGetDiscardUntaggedIntf;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = &Bonsai_gprtSetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = &Bonsai_gprtGetUnicFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = &Bonsai_gprtSetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = &Bonsai_gprtGetMultiFloodBlockIntf;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = &Bonsai_gprtSetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = &Bonsai_gprtGetDiscardBCastModeIntf;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = &Bonsai_gprtSetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = &Bonsai_gprtGetIGMPSnoopEnable;
+	obj->PORTCTRLObj.gprtSetHeaderMode = &Bonsai_gprtSetHeaderMode;
+	obj->PORTCTRLObj.gprtGetHeaderMode = &Bonsai_gprtGetHeaderMode;
+	obj->PORTCTRLObj.gprtSetDropOnLock = &Bonsai_gprtSetDropOnLock;
+	obj->PORTCTRLObj.gprtGetDropOnLock = &Bonsai_gprtGetDropOnLock;
+	obj->PORTCTRLObj.gprtSetJumboMode = &Bonsai_gprtSetJumboModeIntf;
+	obj->PORTCTRLObj.gprtGetJumboMode = &Bonsai_gprtGetJumboModeIntf;
+	obj->PORTCTRLObj.gprtSetSpecifiedMTU = &Bonsai_gprtSetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtGetSpecifiedMTU = &Bonsai_gprtGetSpecifiedMTUIntf;
+	obj->PORTCTRLObj.gprtSetLearnEnable = &Bonsai_gprtSetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtGetLearnEnable = &Bonsai_gprtGetLearnEnableIntf;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = &Bonsai_gprtSetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = &Bonsai_gprtGetVTUPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = &Bonsai_gprtSetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = &Bonsai_gprtGetSAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = &Bonsai_gprtSetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = &Bonsai_gprtGetDAPriOverrideIntf;
+	obj->PORTCTRLObj.gprtSetMessagePort = &Bonsai_gprtSetMessagePort;
+	obj->PORTCTRLObj.gprtGetMessagePort = &Bonsai_gprtGetMessagePort;
+	obj->PORTCTRLObj.gprtSetEtherType = &Bonsai_gprtSetEtherType;
+	obj->PORTCTRLObj.gprtGetEtherType = &Bonsai_gprtGetEtherType;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = &Bonsai_gprtSetAllowVidZero;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = &Bonsai_gprtGetAllowVidZero;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = &Bonsai_gprtSetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = &Bonsai_gprtGetFlowCtrlIntf;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = &Bonsai_gprtSetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = &Bonsai_gprtGetEgressMonitorSource;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = &Bonsai_gprtSetIngressMonitorSource;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = &Bonsai_gprtGetIngressMonitorSource;
+	obj->PORTCTRLObj.grcSetEgressRate = &Bonsai_grcSetEgressRateIntf;
+	obj->PORTCTRLObj.grcGetEgressRate = &Bonsai_grcGetEgressRateIntf;
+	obj->PORTCTRLObj.gprtGetDuplexStatus = &Bonsai_gprtGetDuplexStatusIntf;
+	obj->PORTCTRLObj.gprtSetDuplex = &Bonsai_gprtSetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetDuplex = &Bonsai_gprtGetDuplexIntf;
+	obj->PORTCTRLObj.gprtGetForceLink = &Bonsai_gprtGetForceLinkIntf;
+	obj->PORTCTRLObj.gprtSetForceLink = &Bonsai_gprtSetForceLinkIntf;
+	obj->PORTCTRLObj.gprtGetLinkState = &Bonsai_gprtGetLinkState;
+	obj->PORTCTRLObj.gprtSetForceSpeed = &Bonsai_gprtSetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetForceSpeed = &Bonsai_gprtGetForceSpeedIntf;
+	obj->PORTCTRLObj.gprtGetSpeed = &Bonsai_gprtGetSpeedIntf;
+	obj->PORTCTRLObj.gprtSetFrameMode = &Bonsai_gprtSetFrameModeIntf;
+	obj->PORTCTRLObj.gprtGetFrameMode = &Bonsai_gprtGetFrameModeIntf;
+	obj->PORTCTRLObj.gprtSetPortECID = &Bonsai_gprtSetPortECID;
+	obj->PORTCTRLObj.gprtGetPortECID = &Bonsai_gprtGetPortECID;
+	obj->PORTCTRLObj.gprtSetEgressMode = &Bonsai_gprtSetEgressModeIntf;
+	obj->PORTCTRLObj.gprtGetEgressMode = &Bonsai_gprtGetEgressModeIntf;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = &Bonsai_gprtSetIgnoreETag;
+	obj->PORTCTRLObj.gprtGetIgnoreETag = &Bonsai_gprtGetIgnoreETag;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = &Bonsai_gprtSetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = &Bonsai_gprtGetExtendedPortCtrlReg;
+	obj->PORTCTRLObj.gprtSetVlanPorts = &Bonsai_gprtSetVlanPorts;
+	obj->PORTCTRLObj.gprtGetVlanPorts = &Bonsai_gprtGetVlanPorts;
+	obj->PORTCTRLObj.gprtSetPortState = &Bonsai_gprtSetPortStateIntf;
+	obj->PORTCTRLObj.gprtGetPortState = &Bonsai_gprtGetPortStateIntf;
+	obj->PORTCTRLObj.gprtSetPreemptEnable = &Bonsai_gprtSetPreemptEnable;
+	obj->PORTCTRLObj.gprtGetPreemptEnable = &Bonsai_gprtGetPreemptEnable;
+	obj->PORTCTRLObj.gprtSetPreemptSize = &Bonsai_gprtSetPreemptSize;
+	obj->PORTCTRLObj.gprtGetPreemptSize = &Bonsai_gprtGetPreemptSize;
+	obj->PORTCTRLObj.gprtSetPreemptQueue = &Bonsai_gprtSetPreemptQueue;
+	obj->PORTCTRLObj.gprtGetPreemptQueue = &Bonsai_gprtGetPreemptQueue;
+	obj->PORTCTRLObj.gprtRegDump = &Bonsai_gprtRegDump;
+
+	obj->STUObj.gstuAddEntry = &Bonsai_gstuAddEntryIntf;
+	obj->STUObj.gstuGetEntryNext = &Bonsai_gstuGetEntryNextIntf;
+	obj->STUObj.gstuDelEntry = &Bonsai_gstuDelEntryIntf;
+	obj->STUObj.gstuFindSidEntry = &Bonsai_gstuFindSidEntryIntf;
+	obj->STUObj.gstuGetEntryCount = &Bonsai_gstuGetEntryCountIntf;
+	obj->STUObj.gstuDump = &Bonsai_gstuDump;
+
+	obj->VTUObj.gvtuFindVidEntry = &Bonsai_gvtuFindVidEntryIntf;
+	obj->VTUObj.gvtuExistVidEntry = &Bonsai_gvtuExistVidEntryIntf;
+	obj->VTUObj.gvtuFlush = &Bonsai_gvtuFlushIntf;
+	obj->VTUObj.gvtuAddEntry = &Bonsai_gvtuAddEntryIntf;
+	obj->VTUObj.gvtuGetEntryNext = &Bonsai_gvtuGetEntryNextIntf;
+	obj->VTUObj.gvtuDelEntry = &Bonsai_gvtuDelEntryIntf;
+	obj->VTUObj.gvtuSetMode = &Bonsai_gvtuSetModeIntf;
+	obj->VTUObj.gvtuGetMode = &Bonsai_gvtuGetModeIntf;
+	obj->VTUObj.gvtuGetViolation = &Bonsai_gvtuGetViolationIntf;
+	obj->VTUObj.gvtuGetEntryCount = &Bonsai_gvtuGetEntryCountIntf;
+	obj->VTUObj.gvtuSetMemberTag = &Bonsai_gvtuSetMemberTagIntf;
+	obj->VTUObj.gvtuGetMemberTag = &Bonsai_gvtuGetMemberTagIntf;
+	obj->VTUObj.gvtuDump = &Bonsai_gvtuDump;
+
+	obj->TrunkObj.gprtSetTrunkPort = &Bonsai_gprtSetTrunkPort;
+	obj->TrunkObj.gprtGetTrunkPort = &Bonsai_gprtGetTrunkPort;
+	obj->TrunkObj.gsysSetTrunkMaskTable = &Bonsai_gsysSetTrunkMaskTable;
+	obj->TrunkObj.gsysGetTrunkMaskTable = &Bonsai_gsysGetTrunkMaskTable;
+	obj->TrunkObj.gsysSetHashTrunk = &Bonsai_gsysSetHashTrunk;
+	obj->TrunkObj.gsysGetHashTrunk = &Bonsai_gsysGetHashTrunk;
+	obj->TrunkObj.gsysSetTrunkRouting = &Bonsai_gsysSetTrunkRouting;
+	obj->TrunkObj.gsysGetTrunkRouting = &Bonsai_gsysGetTrunkRouting;
+
+	obj->EEPROMObj.geepromWrite = &Bonsai_EEPROMWriteIntf;
+	obj->EEPROMObj.geepromRead = &Bonsai_EEPROMReadIntf;
+	obj->EEPROMObj.geepromSetMChipSel = &Bonsai_EEPROMChipSelSetIntf;
+	obj->EEPROMObj.geepromGetMChipSel = &Bonsai_EEPROMChipSelGetIntf;
+
+	obj->INTObj.gdevIntEnableSet = &Bonsai_gsysDevIntEnableSet;
+	obj->INTObj.gdevIntEnableGet = &Bonsai_gsysDevIntEnableGet;
+	obj->INTObj.gdevIntStatusGet = &Bonsai_gsysDevIntStatusGet;
+	obj->INTObj.gactiveIntEnableSet = &Bonsai_gsysActiveIntEnableSet;
+	obj->INTObj.gactiveIntEnableGet = &Bonsai_gsysActiveIntEnableGet;
+	obj->INTObj.gactiveIntStatusGet = &Bonsai_gsysActiveIntStatusGet;
+
+	obj->PIRLObj.gpirlInitialize = &Bonsai_gpirlInitializeIntf;
+	obj->PIRLObj.gpirlInitResource = &Bonsai_gpirlInitResourceIntf;
+	obj->PIRLObj.gpirlCustomSetup = &Bonsai_gpirlCustomSetup_sr2cIntf;
+	obj->PIRLObj.gpirlReadResource = &Bonsai_gpirlReadResourceIntf;
+	obj->PIRLObj.gpirlWriteResource = &Bonsai_gpirlWriteResourceIntf;
+	obj->PIRLObj.gpirlGetResReg = &Bonsai_gpirlGetResRegIntf;
+	obj->PIRLObj.gpirlSetResReg = &Bonsai_gpirlSetResRegIntf;
+	obj->PIRLObj.gpirlAdvConfig = &Bonsai_gpirlAdvConfigIntf;
+	obj->PIRLObj.gpirlAdvConfigDisable = &Bonsai_gpirlAdvConfigDisableIntf;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = &Bonsai_gprtGetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = &Bonsai_gprtSetIEEEPrioMapIntf;
+	obj->QOSMAPObj.gqosGetPrioMapRule = &Bonsai_gqosGetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtGetInitialPri = &Bonsai_gprtGetInitialPriIntf;
+	obj->QOSMAPObj.gprtSetDefQpri = &Bonsai_gprtSetDefQpriIntf;
+	obj->QOSMAPObj.gprtGetDefQpri = &Bonsai_gprtGetDefQpriIntf;
+	obj->QOSMAPObj.gprtSetDefFpri = &Bonsai_gprtSetDefFpri;
+	obj->QOSMAPObj.gprtGetDefFpri = &Bonsai_gprtGetDefFpri;
+	obj->QOSMAPObj.gprtSetInitialPri = &Bonsai_gprtSetInitialPriIntf;
+	obj->QOSMAPObj.gqosSetPrioMapRule = &Bonsai_gqosSetPrioMapRuleIntf;
+	obj->QOSMAPObj.gprtRewriteDscp = &Bonsai_gprtRewriteDscp;
+	obj->QOSMAPObj.gprtSetCosToQueue = &Bonsai_gprtSetCosToQueue;
+	obj->QOSMAPObj.gprtGetCosToQueue = &Bonsai_gprtGetCosToQueue;
+	obj->QOSMAPObj.gprtSetCosToDscp = &Bonsai_gprtSetCosToDscp;
+	obj->QOSMAPObj.gprtGetCosToDscp = &Bonsai_gprtGetCosToDscp;
+
+	obj->PORTRMONObj.gstatsFlushAll = &Bonsai_gstatsFlushAll;
+	obj->PORTRMONObj.gstatsFlushPort = &Bonsai_gstatsFlushPort;
+	obj->PORTRMONObj.gstatsGetPortCounter = &Bonsai_gstatsGetPortCounterIntf;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = &Bonsai_gstatsGetPortAllCntersIntf;
+	obj->PORTRMONObj.gstatsGetHistogramMode = &Bonsai_gstatsGetHistogramModeIntf;
+	obj->PORTRMONObj.gstatsSetHistogramMode = &Bonsai_gstatsSetHistogramModeIntf;
+	obj->PORTRMONObj.gmibDump = &Bonsai_gmibDump;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = &Bonsai_gprtSetQueueCtrlIntf;
+	obj->QUEUEObj.gprtGetQueueCtrl = &Bonsai_gprtGetQueueCtrlIntf;
+	obj->QUEUEObj.gprtSetPortSched = &Bonsai_gprtSetPortSchedIntf;
+	obj->QUEUEObj.gprtGetPortSched = &Bonsai_gprtGetPortSchedIntf;
+	obj->QUEUEObj.gprtSetQoSWeight = &Bonsai_gprtSetQoSWeightIntf;
+	obj->QUEUEObj.gprtGetQoSWeight = &Bonsai_gprtGetQoSWeightIntf;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = &Bonsai_gsysSetFloodBC;
+	obj->SYSCTRLObj.gsysGetFloodBC = &Bonsai_gsysGetFloodBC;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = &Bonsai_gsysSetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = &Bonsai_gsysGetEgressMonitorDest;
+	obj->SYSCTRLObj.gsysSetSMISetup = &Bonsai_gsysSetSMISetup;
+	obj->SYSCTRLObj.gsysGetSMISetup = &Bonsai_gsysGetSMISetup;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = &Bonsai_gsysGlobal1RegDump;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = &Bonsai_gsysGlobal2RegDump;
+	obj->SYSCTRLObj.gsysSetRMUMode = &Bonsai_gsysSetRMUMode;
+	obj->SYSCTRLObj.gsysGetRMUMode = &Bonsai_gsysGetRMUMode;
+	obj->SYSCTRLObj.gsysQbvWrite = &Bonsai_gsysQbvWrite;
+	obj->SYSCTRLObj.gsysQbvRead = &Bonsai_gsysQbvRead;
+
+	obj->ECIDObj.gBpeEnableSet = &Bonsai_gBpeEnableSet;
+	obj->ECIDObj.gBpeEnableGet = &Bonsai_gBpeEnableGet;
+	obj->ECIDObj.gecidAddEntry = &Bonsai_gecidAddEntryIntf;
+	obj->ECIDObj.gecidDump = &Bonsai_gecidDump;
+	obj->ECIDObj.gecidFindEcidEntry = &Bonsai_gecidFindEcidEntryIntf;
+	obj->ECIDObj.gecidFlushAll = &Bonsai_gecidFlushAll;
+	obj->ECIDObj.gecidFlushEntry = &Bonsai_gecidFlushEntry;
+	obj->ECIDObj.gecidGetEcidEntryNext = &Bonsai_gecidGetEcidEntryNextIntf;
+	obj->ECIDObj.gecidGetEntryCount = &Bonsai_gecidGetEntryCount;
+	obj->ECIDObj.gecidMove = &Bonsai_gecidMove;
+
+	obj->TCAMObj.gtcamFlushAll = &Bonsai_gtcamFlushAll;
+	obj->TCAMObj.gtcamFlushEntry = &Bonsai_gtcamFlushEntry;
+	obj->TCAMObj.gtcamLoadEntry = &Bonsai_gtcamLoadEntryIntf;
+	obj->TCAMObj.gtcamReadTCAMData = &Bonsai_gtcamReadTCAMDataIntf;
+	obj->TCAMObj.gtcamGetNextTCAMData = &Bonsai_gtcamGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamFindEntry = &Bonsai_gtcamFindEntryIntf;
+	obj->TCAMObj.gtcamSetMode = &Bonsai_gtcamSetModeIntf;
+	obj->TCAMObj.gtcamGetMode = &Bonsai_gtcamGetModeIntf;
+	obj->TCAMObj.gtcamAddEntryPort = &Bonsai_gtcamAddEntryPort;
+	obj->TCAMObj.gtcamRemoveEntryPort = &Bonsai_gtcamRemoveEntryPort;
+	obj->TCAMObj.gtcamEgrFlushEntry = &Bonsai_gtcamEgrFlushEntryIntf;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = &Bonsai_gtcamEgrFlushAllPortsIntf;
+	obj->TCAMObj.gtcamEgrLoadEntry = &Bonsai_gtcamEgrLoadEntryIntf;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = &Bonsai_gtcamEgrGetNextTCAMDataIntf;
+	obj->TCAMObj.gtcamEgrReadTCAMData = &Bonsai_gtcamEgrReadTCAMDataIntf;
+	obj->TCAMObj.gtcamDump = &Bonsai_gtcamDump;
+	obj->TCAMObj.gtcamAdvConfig = &Bonsai_gtcamAdvConfigIntf;
+
+	obj->TCAMRCObj.gtcamRCLoadEntry = &Bonsai_gtcamRCLoadEntryIntf;
+	obj->TCAMRCObj.gtcamRCFlushAllEntry = &Bonsai_gtcamRCFlushAllEntry;
+	obj->TCAMRCObj.gtcamRCFlushEntry = &Bonsai_gtcamRCFlushEntry;
+	obj->TCAMRCObj.gtcamRCReadEntry = &Bonsai_gtcamRCReadEntryIntf;
+	obj->TCAMRCObj.gtcamRCGetNextEntry = &Bonsai_gtcamRCGetNextEntryIntf;
+	obj->TCAMRCObj.gtcamRCFindEntry = &Bonsai_gtcamRCFindEntryIntf;
+	obj->TCAMRCObj.gtcamRCEntryDump = &Bonsai_gtcamRCEntryDump;
+
+	obj->TCAMRCCompObj.gtcamRCCompLoad = &Bonsai_gtcamRCCompLoadIntf;
+	obj->TCAMRCCompObj.gtcamRCCompFlushAll = &Bonsai_gtcamRCCompFlushAll;
+	obj->TCAMRCCompObj.gtcamRCCompFlushPort = &Bonsai_gtcamRCCompFlushPort;
+	obj->TCAMRCCompObj.gtcamRCCompRead = &Bonsai_gtcamRCCompReadIntf;
+
+	obj->RMUObj.grmuTCAMDump = &Bonsai_msdRmuTCAMDumpIntf;
+	obj->RMUObj.grmuTCAMRead = &Bonsai_msdRmuTCAMReadIntf;
+	obj->RMUObj.grmuTCAMWrite = &Bonsai_msdRmuTCAMWriteIntf;
+	obj->RMUObj.grmuEcidDump = &Bonsai_msdRmuEcidDumpIntf;
+
+	obj->RMUObj.grmuGetID = &Bonsai_msdRmuGetIDIntf;
+	obj->RMUObj.grmuAtuDump = &Bonsai_msdRmuAtuDumpIntf;
+	obj->RMUObj.grmuMib2Dump = &Bonsai_msdRmuMib2DumpIntf;
+	obj->RMUObj.grmuMultiRegAccess = &Bonsai_msdRmuMultiRegAccessIntf;
+	obj->RMUObj.grmuRegDump = &Bonsai_msdRmuRegDump;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = &Bonsai_msdGetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = &Bonsai_msdSetSMIC45PhyReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = &Bonsai_msdGetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = &Bonsai_msdSetSMIPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = &Bonsai_msdSetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = &Bonsai_msdGetSMIPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = &Bonsai_msdGetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = &Bonsai_msdSetSMIExtPhyReg;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = &Bonsai_msdSetSMIExtPhyXMDIOReg;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = &Bonsai_msdGetSMIExtPhyXMDIOReg;
+
+	obj->LEDObj.gledForceOn = &Bonsai_gledForceOnIntf;
+	obj->LEDObj.gledForceOff = &Bonsai_gledForceOffIntf;
+	obj->LEDObj.gledLinkAct = &Bonsai_gledLinkActIntf;
+	obj->LEDObj.gledModeSet = &Bonsai_gledModeSetIntf;
+	obj->LEDObj.gledModeGet = &Bonsai_gledModeGetIntf;
+	obj->LEDObj.gledBlinkRateSet = &Bonsai_gledBlinkRateSetIntf;
+	obj->LEDObj.gledBlinkRateGet = &Bonsai_gledBlinkRateGetIntf;
+	obj->LEDObj.gledPulseStretchSet = &Bonsai_gledPulseStretchSetIntf;
+	obj->LEDObj.gledPulseStretchGet = &Bonsai_gledPulseStretchGetIntf;
+	obj->LEDObj.gledSpecialModeSet = &Bonsai_gledSpecialModeSetIntf;
+	obj->LEDObj.gledSpecialModeGet = &Bonsai_gledSpecialModeGetIntf;
+	obj->LEDObj.gledCtrlSet = &Bonsai_gledCtrlSetIntf;
+	obj->LEDObj.gledCtrlGet = &Bonsai_gledCtrlGetIntf;
+	obj->LEDObj.gledDump = &Bonsai_gledDump;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = &Bonsai_gpolicySetMgmtCtrl;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = &Bonsai_gpolicyGetMgmtCtrl;
+	obj->POLICYObj.gpolicySetCpuDest = &Bonsai_gpolicySetCpuDest;
+	obj->POLICYObj.gpolicyGetCpuDest = &Bonsai_gpolicyGetCpuDest;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = &Bonsai_gpolicySetIgrMonitorDest;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = &Bonsai_gpolicyGetIgrMonitorDest;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = &Bonsai_gpolicySetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = &Bonsai_gpolicyGetRsvd2CpuEnables;
+	obj->POLICYObj.gpolicySetMGMTPri = &Bonsai_gpolicySetMGMTPri;
+	obj->POLICYObj.gpolicyGetMGMTPri = &Bonsai_gpolicyGetMGMTPri;
+	obj->POLICYObj.gpolicySetRouteDest = &Bonsai_gpolicySetRouteDest;
+	obj->POLICYObj.gpolicyGetRouteDest = &Bonsai_gpolicyGetRouteDest;
+	obj->POLICYObj.gpolicySetMirrorDest = &Bonsai_gpolicySetMirrorDest;
+	obj->POLICYObj.gpolicyGetMirrorDest = &Bonsai_gpolicyGetMirrorDest;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = &Bonsai_gpolicySetIllegalIPAddr;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = &Bonsai_gpolicyGetIllegalIPAddr;
+	obj->POLICYObj.gpolicySetDipDaMismatch = &Bonsai_gpolicySetDipDaMismatch;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = &Bonsai_gpolicyGetDipDaMismatch;
+	obj->POLICYObj.gpolicySetZeroSIP = &Bonsai_gpolicySetZeroSIP;
+	obj->POLICYObj.gpolicyGetZeroSIP = &Bonsai_gpolicyGetZeroSIP;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = &Bonsai_gpolicySetMcTtlExceeded;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = &Bonsai_gpolicyGetMcTtlExceeded;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = &Bonsai_gpolicySetUcTtlExceeded;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = &Bonsai_gpolicyGetUcTtlExceeded;
+	obj->POLICYObj.gprtSetPortTtlThreshold = &Bonsai_gprtSetPortTtlThreshold;
+	obj->POLICYObj.gprtGetPortTtlThreshold = &Bonsai_gprtGetPortTtlThreshold;
+	obj->POLICYObj.gpolicySetIpHdrErr = &Bonsai_gpolicySetIpHdrErr;
+	obj->POLICYObj.gpolicyGetIpHdrErr = &Bonsai_gpolicyGetIpHdrErr;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = &Bonsai_gpolicySetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = &Bonsai_gpolicyGetTCPFinUrgPsh;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = &Bonsai_gpolicySetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = &Bonsai_gpolicyGetTCPFlagsSeqNum;
+	obj->POLICYObj.gpolicySetTCPSYN = &Bonsai_gpolicySetTCPSYN;
+	obj->POLICYObj.gpolicyGetTCPSYN = &Bonsai_gpolicyGetTCPSYN;
+	obj->POLICYObj.gpolicySetTCPHSize = &Bonsai_gpolicySetTCPHSize;
+	obj->POLICYObj.gpolicyGetTCPHSize = &Bonsai_gpolicyGetTCPHSize;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = &Bonsai_gprtSetPortTCPMinHdrSize;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = &Bonsai_gprtGetPortTCPMinHdrSize;
+	obj->POLICYObj.gpolicySetICMPSize = &Bonsai_gpolicySetICMPSize;
+	obj->POLICYObj.gpolicyGetICMPSize = &Bonsai_gpolicyGetICMPSize;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = &Bonsai_gprtSetPortICMPMaxSize;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = &Bonsai_gprtGetPortICMPMaxSize;
+	obj->POLICYObj.gpolicySetUDPPort = &Bonsai_gpolicySetUDPPort;
+	obj->POLICYObj.gpolicyGetUDPPort = &Bonsai_gpolicyGetUDPPort;
+	obj->POLICYObj.gpolicySetTCPPort = &Bonsai_gpolicySetTCPPort;
+	obj->POLICYObj.gpolicyGetTCPPort = &Bonsai_gpolicyGetTCPPort;
+	obj->POLICYObj.gpolicySetTCPSynFin = &Bonsai_gpolicySetTCPSynFin;
+	obj->POLICYObj.gpolicyGetTCPSynFin = &Bonsai_gpolicyGetTCPSynFin;
+	obj->POLICYObj.gpolicySetTCPFrag = &Bonsai_gpolicySetTCPFrag;
+	obj->POLICYObj.gpolicyGetTCPFrag = &Bonsai_gpolicyGetTCPFrag;
+	obj->POLICYObj.gpolicySetNearNonTPMR = &Bonsai_gpolicySetNearNonTPMR;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = &Bonsai_gpolicyGetNearNonTPMR;
+	obj->POLICYObj.gpolicySetETag = &Bonsai_gpolicySetETag;
+	obj->POLICYObj.gpolicyGetETag = &Bonsai_gpolicyGetETag;
+	obj->POLICYObj.gpolicySetNonETag = &Bonsai_gpolicySetNonETag;
+	obj->POLICYObj.gpolicyGetNonETag = &Bonsai_gpolicyGetNonETag;
+	obj->POLICYObj.gpolicyDump = &Bonsai_gpolicyDump;
+
+	obj->QCIObj.gqciStreamFiltFlushAll = &Bonsai_gqciStreamFiltFlushAll;
+	obj->QCIObj.gqciStreamFiltSet = &Bonsai_gqciStreamFiltSet;
+	obj->QCIObj.gqciStreamFiltBlockStatSet = &Bonsai_gqciStreamFiltBlockStatSet;
+	obj->QCIObj.gqciStreamFiltBlockStatGet = &Bonsai_gqciStreamFiltBlockStatGet;
+	obj->QCIObj.gqciStreamFiltEnAts = &Bonsai_gqciStreamFiltEnAts;
+	obj->QCIObj.gqciStreamFiltEnGate = &Bonsai_gqciStreamFiltEnGate;
+	obj->QCIObj.gqciStreamFiltMatchCtrGet = &Bonsai_gqciStreamFiltMatchCtrGet;
+	obj->QCIObj.gqciStreamFiltFilterCtrGet = &Bonsai_gqciStreamFiltFilterCtrGet;
+	obj->QCIObj.gqciStreamGateFiltCtrGet = &Bonsai_gqciStreamGateFiltCtrGet;
+	obj->QCIObj.gqciFlowMeterFiltCtrGet = &Bonsai_gqciFlowMeterFiltCtrGet;
+
+	obj->QCIObj.gqciStreamGateFlushAll = &Bonsai_gqciStreamGateFlushAll;
+	obj->QCIObj.gqciStreamGateDefStateSet = &Bonsai_gqciStreamGateDefStateSet;
+	obj->QCIObj.gqciStreamGateScaleSet = &Bonsai_gqciStreamGateScaleSet;
+	obj->QCIObj.gqciStreamGateTimeGenIdSet = &Bonsai_gqciStreamGateTimeGenIdSet;
+	obj->QCIObj.gqciStreamGateEntryAdd = &Bonsai_gqciStreamGateEntryAddIntf;
+
+	obj->QCIObj.gqciStreamGateTimeGenFlush = &Bonsai_gqciStreamGateTimeGenFlush;
+	obj->QCIObj.gqciStreamGateTimeGenSet = &Bonsai_gqciStreamGateTimeGenSet;
+
+	obj->QCIObj.gqciFlowMeterFlushAll = &Bonsai_gqciFlowMeterFlushAll;
+	obj->QCIObj.gqciFlowMeterCoupleFlagSet = &Bonsai_gqciFlowMeterCoupleFlagSet;
+	obj->QCIObj.gqciFlowMeterCoupleFlagGet = &Bonsai_gqciFlowMeterCoupleFlagGet;
+	obj->QCIObj.gqciFlowMeterDropOnYelSet = &Bonsai_gqciFlowMeterDropOnYelSet;
+	obj->QCIObj.gqciFlowMeterDropOnYelGet = &Bonsai_gqciFlowMeterDropOnYelGet;
+	obj->QCIObj.gqciFlowMeterRedBlockEnSet = &Bonsai_gqciFlowMeterRedBlockEnSet;
+	obj->QCIObj.gqciFlowMeterRedBlockEnGet = &Bonsai_gqciFlowMeterRedBlockEnGet;
+	obj->QCIObj.gqciFlowMeterRedBlkStatSet = &Bonsai_gqciFlowMeterRedBlkStatSet;
+	obj->QCIObj.gqciFlowMeterRedBlkStatGet = &Bonsai_gqciFlowMeterRedBlkStatGet;
+	obj->QCIObj.gqciFlowMeterAdvConfig = &Bonsai_gqciFlowMeterAdvConfig;
 
 #endif
 	return MSD_OK;
 }
 
-static MSD_STATUS InitObj(MSD_QD_DEV *dev)
+static MSD_STATUS InitObj(SwitchDevObj_ *obj)
 {
-	dev->SwitchDevObj.ATUObj.gfdbAddMacEntry = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetAtuEntryNext = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbFlush = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbMove = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbMoveInDB = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemove = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbPortRemoveInDB = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbDelAtuEntry = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetViolation = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbFindAtuMacEntry = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbSetAgingTimeout = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetAgingTimeout = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbSetLearn2All = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetLearn2All = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbSetPortLearnLimit = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnLimit = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetPortLearnCount = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCount = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetEntryCountPerFid = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCount = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbGetNonStaticEntryCountPerFid = NULL;
-	dev->SwitchDevObj.ATUObj.gfdbDump = NULL;
-
-	dev->SwitchDevObj.ECIDObj.gecidAddEntry = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidFlushAll = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidFlushEntry = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidMove = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidGetEcidEntryNext = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidFindEcidEntry = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidGetEntryCount = NULL;
-	dev->SwitchDevObj.ECIDObj.gecidDump = NULL;
-
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetCutThrouthEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetCutThrouthEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreFcs = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreFcs = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowBadFcs = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowBadFcs = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitOut = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitOut = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPauseLimitIn = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPauseLimitIn = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetQueueToPause = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetQueueToPause = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetOutQueueSize = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMapDA = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMapDA = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortLocked = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortLocked = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHoldAt1 = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHoldAt1 = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetInt0nAgeOut = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetInt0nAgeOut = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetRefreshLocked = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetRefreshLocked = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreWrongData = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIgnoreWrongData = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetARPMirror = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetARPMirror = NULL;
-
-	dev->SwitchDevObj.POLICYObj.gpolicySetMgmtCtrl = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMgmtCtrl = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetCpuDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetCpuDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIngressMonitorDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIngressMonitorDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRsvd2CpuEnables = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRsvd2CpuEnables = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMGMTPri = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMGMTPri = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetRouteDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetRouteDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMirrorDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMirrorDest = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIllegalIPAddr = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIllegalIPAddr = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetDipDaMismatch = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetDipDaMismatch = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetZeroSIP = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetZeroSIP = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetMcTtlExceeded = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetMcTtlExceeded = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUcTtlExceeded = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUcTtlExceeded = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTtlThreshold = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTtlThreshold = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetIpHdrErr = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetIpHdrErr = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFinUrgPsh = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFinUrgPsh = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFlagsSeqNum = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFlagsSeqNum = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSYN = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSYN = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPHSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPHSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortTCPMinHdrSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortTCPMinHdrSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetICMPSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetICMPSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtSetPortICMPMaxSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gprtGetPortICMPMaxSize = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetUDPPort = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetUDPPort = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPPort = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPPort = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPSynFin = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPSynFin = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetTCPFrag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetTCPFrag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNearNonTPMR = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNearNonTPMR = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetETag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetETag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicySetNonETag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyGetNonETag = NULL;
-	dev->SwitchDevObj.POLICYObj.gpolicyDump = NULL;
-
-	dev->SwitchDevObj.VCTObj.gvctGetAdvCableDiag = NULL;
-	dev->SwitchDevObj.VCTObj.gvctGetAdvExtendedStatus = NULL;
-
-	dev->SwitchDevObj.STUObj.gstuAddEntry = NULL;
-	dev->SwitchDevObj.STUObj.gstuGetEntryNext = NULL;
-	dev->SwitchDevObj.STUObj.gstuFindSidEntry = NULL;
-	dev->SwitchDevObj.STUObj.gstuGetEntryCount = NULL;
-	dev->SwitchDevObj.STUObj.gstuDump = NULL;
-
-	dev->SwitchDevObj.VTUObj.gvtuFindVidEntry = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuExistVidEntry = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuFlush = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuAddEntry = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryNext = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuDelEntry = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuSetMode = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuGetMode = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuGetViolation = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuGetEntryCount = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuSetMemberTag = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuGetMemberTag = NULL;
-	dev->SwitchDevObj.VTUObj.gvtuDump = NULL;
-
-	dev->SwitchDevObj.IMPObj.impRun = NULL;
-	dev->SwitchDevObj.IMPObj.impReset = NULL;
-	dev->SwitchDevObj.IMPObj.impWriteEEPROM = NULL;
-	dev->SwitchDevObj.IMPObj.impLoadToEEPROM = NULL;
-	dev->SwitchDevObj.IMPObj.impLoadToRAM = NULL;
-	dev->SwitchDevObj.IMPObj.impStop = NULL;
-
-	dev->SwitchDevObj.EEPROMObj.geepromWrite = NULL;
-	dev->SwitchDevObj.EEPROMObj.geepromRead = NULL;
-	dev->SwitchDevObj.EEPROMObj.geepromSetMChipSel = NULL;
-	dev->SwitchDevObj.EEPROMObj.geepromGetMChipSel = NULL;
-
-	dev->SwitchDevObj.PHYCTRLObj.gphyReset = NULL;
-    dev->SwitchDevObj.PHYCTRLObj.serdesReset = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortLoopback = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortSpeed = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphyPortPowerDown = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortDuplexMode = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetPortAutoMode = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetEEE = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetFlowControlEnable = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphySetIntEnable = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntEnable = NULL;
-	dev->SwitchDevObj.PHYCTRLObj.gphyGetIntStatus = NULL;
-
-	dev->SwitchDevObj.PIRLObj.gpirlInitialize = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlInitResource = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlCustomSetup = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlReadResource = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlWriteResource = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlGetResReg = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlSetResReg = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfig = NULL;
-	dev->SwitchDevObj.PIRLObj.gpirlAdvConfigDisable = NULL;
-
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVid = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVid = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnSetPortVlanDot1qMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gvlnGetPortVlanDot1qMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardTagged = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardTagged = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardUntagged = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardUntagged = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetUnicastFloodBlock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetUnicastFloodBlock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMulticastFloodBlock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMulticastFloodBlock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDiscardBCastMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDiscardBCastMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIGMPSnoopEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIGMPSnoopEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetHeaderMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetHeaderMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDropOnLock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDropOnLock = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetJumboMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetJumboMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSpecifiedMTU = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpecifiedMTU = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetLearnEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLearnEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVTUPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVTUPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetSAPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSAPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDAPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDAPriorityOverride = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetMessagePort = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetMessagePort = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEtherType = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEtherType = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetAllowVidZero = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetAllowVidZero = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFlowCtrl = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFlowCtrl = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMonitorSource = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMonitorSource = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIngressMonitorSource = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetIngressMonitorSource = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.grcSetEgressRate = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.grcGetEgressRate = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetDuplex = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetDuplex = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceLink = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetLinkState = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceSpeed = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceSpeed = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetSpeed = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetFrameMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetFrameMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortECID = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortECID = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetEgressMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetEgressMode = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetIgnoreETag = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetExtendedPortCtrlReg = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetExtendedPortCtrlReg = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetVlanPorts = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetVlanPorts = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetForceDefaultVid = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetForceDefaultVid = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPortState = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPortState = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptEnable = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptSize = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptSize = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtSetPreemptQueue = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtGetPreemptQueue = NULL;
-	dev->SwitchDevObj.PORTCTRLObj.gprtRegDump = NULL;
-
-	dev->SwitchDevObj.TrunkObj.gprtSetTrunkPort = NULL;
-	dev->SwitchDevObj.TrunkObj.gprtGetTrunkPort = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkMaskTable = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkMaskTable = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysSetHashTrunk = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysGetHashTrunk = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysSetTrunkRouting = NULL;
-	dev->SwitchDevObj.TrunkObj.gsysGetTrunkRouting = NULL;
-
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushAll = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gstatsFlushPort = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortCounter = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetPortAllCounters = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gstatsGetHistogramMode = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gstatsSetHistogramMode = NULL;
-	dev->SwitchDevObj.PORTRMONObj.gmibDump = NULL;
-
-	dev->SwitchDevObj.QUEUEObj.gprtSetQueueCtrl = NULL;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQueueCtrl = NULL;
-	dev->SwitchDevObj.QUEUEObj.gprtSetPortSched = NULL;
-	dev->SwitchDevObj.QUEUEObj.gprtGetPortSched = NULL;
-	dev->SwitchDevObj.QUEUEObj.gsysSetQoSWeight = NULL;
-	dev->SwitchDevObj.QUEUEObj.gsysGetQoSWeight = NULL;
-	dev->SwitchDevObj.QUEUEObj.gprtSetQoSWeight = NULL;
-	dev->SwitchDevObj.QUEUEObj.gprtGetQoSWeight = NULL;
-
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetFloodBC = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetFloodBC = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMonitorMgmtCtrl = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMonitorMgmtCtrl = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetCPUDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetCPUDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetIngressMonitorDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetIngressMonitorDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetEgressMonitorDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetEgressMonitorDest = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRsvd2CpuEnables = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRsvd2CpuEnables = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetMGMTPri = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetMGMTPri = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetSMISetup = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetSMISetup = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal1RegDump = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGlobal2RegDump = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysSetRMUMode = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysGetRMUMode = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvWrite = NULL;
-	dev->SwitchDevObj.SYSCTRLObj.gsysQbvRead = NULL;
-
-	dev->SwitchDevObj.QOSMAPObj.gprtGetIEEEPrioMap = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetIEEEPrioMap = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gqosGetPrioMapRule = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetInitialPri = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetDefQpri = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetDefQpri = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetInitialPri = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gqosSetPrioMapRule = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtRewriteDscp = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToQueue = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToQueue = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtSetCosToDscp = NULL;
-	dev->SwitchDevObj.QOSMAPObj.gprtGetCosToDscp = NULL;
-
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXHiLimit = NULL;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXHiLimit = NULL;
-	dev->SwitchDevObj.QAVObj.gqavGetPortQpriXRate = NULL;
-	dev->SwitchDevObj.QAVObj.gqavSetPortQpriXRate = NULL;
-
-	dev->SwitchDevObj.PTPObj.gptpSetIntEnable = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetIntEnable = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetProtPTPEn = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetProtPTPEn = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetPortConfig = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetPortConfig = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetTimeStamp = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetTSValidSt = NULL;
-	dev->SwitchDevObj.PTPObj.gptpResetTimeStamp = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetGlobalConfig = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetGlobalConfig = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetIntStatus = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetMeanPathDelay = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetMeanPathDelay = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetIgrPathDelayAsym = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetIgrPathDelayAsym = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetEgrPathDelayAsym = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetEgrPathDelayAsym = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetMode = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetMode = NULL;
-	dev->SwitchDevObj.PTPObj.gptpSetMasterSlave = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetMasterSlave = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetTODBusyBitStatus = NULL;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreCompensation = NULL;
-	dev->SwitchDevObj.PTPObj.gptpTODStoreAll = NULL;
-	dev->SwitchDevObj.PTPObj.gptpTODCaptureAll = NULL;
-
-	dev->SwitchDevObj.PTPObj.gptpSetPulse = NULL;
-	dev->SwitchDevObj.PTPObj.gptpGetPulse = NULL;
-	dev->SwitchDevObj.PTPObj.gtaiGetPTPGlobalTime = NULL;
-    dev->SwitchDevObj.PTPObj.gptpGetPortReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSetPortReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpGetGlobalReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSetGlobalReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpGetTaiReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSetTaiReg = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSet1588v2Config = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asConfig = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSet8021asRevConfig = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptTsSel = NULL;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptTsSel = NULL;
-    dev->SwitchDevObj.PTPObj.gptpSetPreemptCtrl = NULL;
-    dev->SwitchDevObj.PTPObj.gptpGetPreemptCtrl = NULL;
-	dev->SwitchDevObj.PTPObj.gtaiSetTrigGenTimerSel = NULL;
-	dev->SwitchDevObj.PTPObj.gtaiGetTrigGenTimerSel = NULL;
-
-	dev->SwitchDevObj.TCAMObj.gtcamFlushAll = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamFlushEntry = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamLoadEntry = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamReadTCAMData = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamGetNextTCAMData = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamFindEntry = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamSetMode = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamGetMode = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamAddEntryPort = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamRemoveEntryPort = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntry = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrFlushEntryAllPorts = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrLoadEntry = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrGetNextTCAMData = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamEgrReadTCAMData = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamDump = NULL;
-	dev->SwitchDevObj.TCAMObj.gtcamAdvConfig = NULL;
-
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCLoadEntry = NULL;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFlushEntry = NULL;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCReadEntry = NULL;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCGetNextEntry = NULL;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCFindEntry = NULL;
-	dev->SwitchDevObj.TCAMRCObj.gtcamRCEntryDump = NULL;
-
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompLoad = NULL;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushAll = NULL;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompFlushPort = NULL;
-	dev->SwitchDevObj.TCAMRCCompObj.gtcamRCCompRead = NULL;
-
-	dev->SwitchDevObj.ARPObj.garpLoadMcEntry = NULL;
-	dev->SwitchDevObj.ARPObj.garpLoadUcEntry = NULL;
-	dev->SwitchDevObj.ARPObj.garpFlushEntry = NULL;
-	dev->SwitchDevObj.ARPObj.garpFlushAll = NULL;
-	dev->SwitchDevObj.ARPObj.garpReadEntry = NULL;
-	dev->SwitchDevObj.ARPObj.garpGetNextEntry = NULL;
-
-	dev->SwitchDevObj.RMUObj.grmuGetID = NULL;
-	dev->SwitchDevObj.RMUObj.grmuAtuDump = NULL;
-	dev->SwitchDevObj.RMUObj.grmuEcidDump = NULL;
-	dev->SwitchDevObj.RMUObj.grmuMibDump = NULL;
-	dev->SwitchDevObj.RMUObj.grmuMib2Dump = NULL;
-	dev->SwitchDevObj.RMUObj.grmuTCAMDump = NULL;
-	dev->SwitchDevObj.RMUObj.grmuTCAMRead = NULL;
-	dev->SwitchDevObj.RMUObj.grmuTCAMWrite = NULL;
-	dev->SwitchDevObj.RMUObj.grmuMultiRegAccess = NULL;
-    dev->SwitchDevObj.RMUObj.grmuRegDump = NULL;
-
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = NULL;
-	dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = NULL;
-
-	dev->SwitchDevObj.LEDObj.gledForceOn = NULL;
-	dev->SwitchDevObj.LEDObj.gledForceOff = NULL;
-	dev->SwitchDevObj.LEDObj.gledLinkAct = NULL;
-	dev->SwitchDevObj.LEDObj.gledModeSet = NULL;
-	dev->SwitchDevObj.LEDObj.gledModeGet = NULL;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateSet = NULL;
-	dev->SwitchDevObj.LEDObj.gledBlinkRateGet = NULL;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchSet = NULL;
-	dev->SwitchDevObj.LEDObj.gledPulseStretchGet = NULL;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeSet = NULL;
-	dev->SwitchDevObj.LEDObj.gledSpecialModeGet = NULL;
-	dev->SwitchDevObj.LEDObj.gledCtrlSet = NULL;
-	dev->SwitchDevObj.LEDObj.gledCtrlGet = NULL;
-	dev->SwitchDevObj.LEDObj.gledDump = NULL;
-
-	dev->SwitchDevObj.INTObj.gdevIntEnableSet = NULL;
-	dev->SwitchDevObj.INTObj.gdevIntEnableGet = NULL;
-	dev->SwitchDevObj.INTObj.gdevIntStatusGet = NULL;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableSet = NULL;
-	dev->SwitchDevObj.INTObj.gactiveIntEnableGet = NULL;
-	dev->SwitchDevObj.INTObj.gactiveIntStatusGet = NULL;
-
-    dev->SwitchDevObj.QCRObj.gqcrFlushAll = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrFlushOne = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrSetGrpId = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrGetGrpId = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrSetCbsLimit = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrGetCbsLimit = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrSetMaxResidenceTime = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrGetMaxResidenceTime = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrSetRateLimit = NULL;
-    dev->SwitchDevObj.QCRObj.gqcrGetRateLimit = NULL;
-
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushAll = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenFlushEntry = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenRead = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqGenLoad = NULL;
-
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushAll = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyFlushEntry = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyRead = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyGetNext = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerIndvRcvyReadClear = NULL;
-
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushAll = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyFlushEntry = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyRead = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyLoad = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetNext = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyGetViolation = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerSeqRcvyReadClear = NULL;
-
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushAll = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrFlushEntry = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrRead = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrLoad = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrGetNext = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank0SCtrReadClear = NULL;
-
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushAll = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrFlushEntry = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrRead = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrLoad = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrGetNext = NULL;
-    dev->SwitchDevObj.FRERObj.gfrerBank1SCtrReadClear = NULL;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFlushAll = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltBlockStatGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnAts = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltEnGate = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltMatchCtrGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamFiltFilterCtrGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFiltCtrGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFiltCtrGet = NULL;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateFlushAll = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateDefStateSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateScaleSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenIdSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateEntryAdd = NULL;
-
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenFlush = NULL;
-	dev->SwitchDevObj.QCIObj.gqciStreamGateTimeGenSet = NULL;
-
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterFlushAll = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterCoupleFlagGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterDropOnYelGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlockEnGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatSet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterRedBlkStatGet = NULL;
-	dev->SwitchDevObj.QCIObj.gqciFlowMeterAdvConfig = NULL;
-
-	dev->SwitchDevObj.MACSECObj.gmacsecFlushAll = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRule = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRule = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRule = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSecY = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateRxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteRxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSC = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecCreateTxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecDeleteTxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSA = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRXSCStates = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRXSecYStates = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTXSCStates = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTXSecYStates = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressSet = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableEgressGet = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressSet = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecEnableIngressGet = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxPNThreshold = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxPNThreshold = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxXPNThreshold = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxXPNThreshold = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetRxDefaultSCI = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetRxDefaultSCI = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecSetTxSCIntCtrl = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetTxSCIntCtrl = NULL;
-	dev->SwitchDevObj.MACSECObj.gmacsecGetNextTxSCIntStatus = NULL;
+	obj->ATUObj.gfdbAddMacEntry = NULL;
+	obj->ATUObj.gfdbGetAtuEntryNext = NULL;
+	obj->ATUObj.gfdbFlush = NULL;
+	obj->ATUObj.gfdbMove = NULL;
+	obj->ATUObj.gfdbMoveInDB = NULL;
+	obj->ATUObj.gfdbPortRemove = NULL;
+	obj->ATUObj.gfdbPortRemoveInDB = NULL;
+	obj->ATUObj.gfdbDelAtuEntry = NULL;
+	obj->ATUObj.gfdbGetViolation = NULL;
+	obj->ATUObj.gfdbFindAtuMacEntry = NULL;
+	obj->ATUObj.gfdbSetAgingTimeout = NULL;
+	obj->ATUObj.gfdbGetAgingTimeout = NULL;
+	obj->ATUObj.gfdbSetLearn2All = NULL;
+	obj->ATUObj.gfdbGetLearn2All = NULL;
+	obj->ATUObj.gfdbSetPortLearnLimit = NULL;
+	obj->ATUObj.gfdbGetPortLearnLimit = NULL;
+	obj->ATUObj.gfdbGetPortLearnCount = NULL;
+	obj->ATUObj.gfdbGetEntryCount = NULL;
+	obj->ATUObj.gfdbGetEntryCountPerFid = NULL;
+	obj->ATUObj.gfdbGetNonStaticEntryCount = NULL;
+	obj->ATUObj.gfdbGetNonStaticEntryCountPerFid = NULL;
+	obj->ATUObj.gfdbGetOccupancy = NULL;
+	obj->ATUObj.gfdbDump = NULL;
+
+	obj->ECIDObj.gecidAddEntry = NULL;
+	obj->ECIDObj.gecidFlushAll = NULL;
+	obj->ECIDObj.gecidFlushEntry = NULL;
+	obj->ECIDObj.gecidMove = NULL;
+	obj->ECIDObj.gecidGetEcidEntryNext = NULL;
+	obj->ECIDObj.gecidFindEcidEntry = NULL;
+	obj->ECIDObj.gecidGetEntryCount = NULL;
+	obj->ECIDObj.gecidDump = NULL;
+
+	obj->PORTCTRLObj.gprtSetCutThrouthEnable = NULL;
+	obj->PORTCTRLObj.gprtGetCutThrouthEnable = NULL;
+	obj->PORTCTRLObj.gprtSetIgnoreFcs = NULL;
+	obj->PORTCTRLObj.gprtGetIgnoreFcs = NULL;
+	obj->PORTCTRLObj.gprtSetAllowBadFcs = NULL;
+	obj->PORTCTRLObj.gprtGetAllowBadFcs = NULL;
+	obj->PORTCTRLObj.gprtSetPauseLimitOut = NULL;
+	obj->PORTCTRLObj.gprtGetPauseLimitOut = NULL;
+	obj->PORTCTRLObj.gprtSetPauseLimitIn = NULL;
+	obj->PORTCTRLObj.gprtGetPauseLimitIn = NULL;
+	obj->PORTCTRLObj.gprtSetQueueToPause = NULL;
+	obj->PORTCTRLObj.gprtGetQueueToPause = NULL;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlEnable = NULL;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlEnable = NULL;
+	obj->PORTCTRLObj.gprtSetRxPriorityFlowControlToQueue = NULL;
+	obj->PORTCTRLObj.gprtGetRxPriorityFlowControlToQueue = NULL;
+	obj->PORTCTRLObj.gprtSetTxPriorityFlowControlEnable = NULL;
+	obj->PORTCTRLObj.gprtGetTxPriorityFlowControlEnable = NULL;
+	obj->PORTCTRLObj.gprtGetOutQueueSize = NULL;
+	obj->PORTCTRLObj.gprtSetMapDA = NULL;
+	obj->PORTCTRLObj.gprtGetMapDA = NULL;
+	obj->PORTCTRLObj.gprtSetPortLocked = NULL;
+	obj->PORTCTRLObj.gprtGetPortLocked = NULL;
+	obj->PORTCTRLObj.gprtSetHoldAt1 = NULL;
+	obj->PORTCTRLObj.gprtGetHoldAt1 = NULL;
+	obj->PORTCTRLObj.gprtSetInt0nAgeOut = NULL;
+	obj->PORTCTRLObj.gprtGetInt0nAgeOut = NULL;
+	obj->PORTCTRLObj.gprtSetRefreshLocked = NULL;
+	obj->PORTCTRLObj.gprtGetRefreshLocked = NULL;
+	obj->PORTCTRLObj.gprtSetIgnoreWrongData = NULL;
+	obj->PORTCTRLObj.gprtGetIgnoreWrongData = NULL;
+	obj->PORTCTRLObj.gprtSetARPMirror = NULL;
+	obj->PORTCTRLObj.gprtGetARPMirror = NULL;
+
+	obj->POLICYObj.gpolicySetMgmtCtrl = NULL;
+	obj->POLICYObj.gpolicyGetMgmtCtrl = NULL;
+	obj->POLICYObj.gpolicySetCpuDest = NULL;
+	obj->POLICYObj.gpolicyGetCpuDest = NULL;
+	obj->POLICYObj.gpolicySetIngressMonitorDest = NULL;
+	obj->POLICYObj.gpolicyGetIngressMonitorDest = NULL;
+	obj->POLICYObj.gpolicySetRsvd2CpuEnables = NULL;
+	obj->POLICYObj.gpolicyGetRsvd2CpuEnables = NULL;
+	obj->POLICYObj.gpolicySetMGMTPri = NULL;
+	obj->POLICYObj.gpolicyGetMGMTPri = NULL;
+	obj->POLICYObj.gpolicySetRouteDest = NULL;
+	obj->POLICYObj.gpolicyGetRouteDest = NULL;
+	obj->POLICYObj.gpolicySetMirrorDest = NULL;
+	obj->POLICYObj.gpolicyGetMirrorDest = NULL;
+	obj->POLICYObj.gpolicySetIllegalIPAddr = NULL;
+	obj->POLICYObj.gpolicyGetIllegalIPAddr = NULL;
+	obj->POLICYObj.gpolicySetDipDaMismatch = NULL;
+	obj->POLICYObj.gpolicyGetDipDaMismatch = NULL;
+	obj->POLICYObj.gpolicySetZeroSIP = NULL;
+	obj->POLICYObj.gpolicyGetZeroSIP = NULL;
+	obj->POLICYObj.gpolicySetMcTtlExceeded = NULL;
+	obj->POLICYObj.gpolicyGetMcTtlExceeded = NULL;
+	obj->POLICYObj.gpolicySetUcTtlExceeded = NULL;
+	obj->POLICYObj.gpolicyGetUcTtlExceeded = NULL;
+	obj->POLICYObj.gprtSetPortTtlThreshold = NULL;
+	obj->POLICYObj.gprtGetPortTtlThreshold = NULL;
+	obj->POLICYObj.gpolicySetIpHdrErr = NULL;
+	obj->POLICYObj.gpolicyGetIpHdrErr = NULL;
+	obj->POLICYObj.gpolicySetTCPFinUrgPsh = NULL;
+	obj->POLICYObj.gpolicyGetTCPFinUrgPsh = NULL;
+	obj->POLICYObj.gpolicySetTCPFlagsSeqNum = NULL;
+	obj->POLICYObj.gpolicyGetTCPFlagsSeqNum = NULL;
+	obj->POLICYObj.gpolicySetTCPSYN = NULL;
+	obj->POLICYObj.gpolicyGetTCPSYN = NULL;
+	obj->POLICYObj.gpolicySetTCPHSize = NULL;
+	obj->POLICYObj.gpolicyGetTCPHSize = NULL;
+	obj->POLICYObj.gprtSetPortTCPMinHdrSize = NULL;
+	obj->POLICYObj.gprtGetPortTCPMinHdrSize = NULL;
+	obj->POLICYObj.gpolicySetICMPSize = NULL;
+	obj->POLICYObj.gpolicyGetICMPSize = NULL;
+	obj->POLICYObj.gprtSetPortICMPMaxSize = NULL;
+	obj->POLICYObj.gprtGetPortICMPMaxSize = NULL;
+	obj->POLICYObj.gpolicySetUDPPort = NULL;
+	obj->POLICYObj.gpolicyGetUDPPort = NULL;
+	obj->POLICYObj.gpolicySetTCPPort = NULL;
+	obj->POLICYObj.gpolicyGetTCPPort = NULL;
+	obj->POLICYObj.gpolicySetTCPSynFin = NULL;
+	obj->POLICYObj.gpolicyGetTCPSynFin = NULL;
+	obj->POLICYObj.gpolicySetTCPFrag = NULL;
+	obj->POLICYObj.gpolicyGetTCPFrag = NULL;
+	obj->POLICYObj.gpolicySetNearNonTPMR = NULL;
+	obj->POLICYObj.gpolicyGetNearNonTPMR = NULL;
+	obj->POLICYObj.gpolicySetETag = NULL;
+	obj->POLICYObj.gpolicyGetETag = NULL;
+	obj->POLICYObj.gpolicySetNonETag = NULL;
+	obj->POLICYObj.gpolicyGetNonETag = NULL;
+	obj->POLICYObj.gpolicyDump = NULL;
+
+	obj->VCTObj.gvctGetAdvCableDiag = NULL;
+	obj->VCTObj.gvctGetAdvExtendedStatus = NULL;
+
+	obj->STUObj.gstuAddEntry = NULL;
+	obj->STUObj.gstuGetEntryNext = NULL;
+	obj->STUObj.gstuFindSidEntry = NULL;
+	obj->STUObj.gstuGetEntryCount = NULL;
+	obj->STUObj.gstuDump = NULL;
+
+	obj->VTUObj.gvtuFindVidEntry = NULL;
+	obj->VTUObj.gvtuExistVidEntry = NULL;
+	obj->VTUObj.gvtuFlush = NULL;
+	obj->VTUObj.gvtuAddEntry = NULL;
+	obj->VTUObj.gvtuGetEntryNext = NULL;
+	obj->VTUObj.gvtuDelEntry = NULL;
+	obj->VTUObj.gvtuSetMode = NULL;
+	obj->VTUObj.gvtuGetMode = NULL;
+	obj->VTUObj.gvtuGetViolation = NULL;
+	obj->VTUObj.gvtuGetEntryCount = NULL;
+	obj->VTUObj.gvtuSetMemberTag = NULL;
+	obj->VTUObj.gvtuGetMemberTag = NULL;
+	obj->VTUObj.gvtuDump = NULL;
+
+	obj->IMPObj.impRun = NULL;
+	obj->IMPObj.impReset = NULL;
+	obj->IMPObj.impWriteEEPROM = NULL;
+	obj->IMPObj.impLoadToEEPROM = NULL;
+	obj->IMPObj.impLoadToRAM = NULL;
+	obj->IMPObj.impStop = NULL;
+
+	obj->EEPROMObj.geepromWrite = NULL;
+	obj->EEPROMObj.geepromRead = NULL;
+	obj->EEPROMObj.geepromSetMChipSel = NULL;
+	obj->EEPROMObj.geepromGetMChipSel = NULL;
+	obj->EEPROMObj.geepromReadBlock = NULL;
+	obj->EEPROMObj.geepromWriteBlock = NULL;
+
+	obj->PHYCTRLObj.gphyReset = NULL;
+    obj->PHYCTRLObj.serdesReset = NULL;
+	obj->PHYCTRLObj.gphySetPortLoopback = NULL;
+	obj->PHYCTRLObj.gphySetPortSpeed = NULL;
+	obj->PHYCTRLObj.gphyPortPowerDown = NULL;
+	obj->PHYCTRLObj.gphySetPortDuplexMode = NULL;
+	obj->PHYCTRLObj.gphySetPortAutoMode = NULL;
+	obj->PHYCTRLObj.gphySetEEE = NULL;
+	obj->PHYCTRLObj.gphySetFlowControlEnable = NULL;
+	obj->PHYCTRLObj.gphySetIntEnable = NULL;
+	obj->PHYCTRLObj.gphyGetIntEnable = NULL;
+	obj->PHYCTRLObj.gphyGetIntStatus = NULL;
+
+	obj->PIRLObj.gpirlInitialize = NULL;
+	obj->PIRLObj.gpirlInitResource = NULL;
+	obj->PIRLObj.gpirlCustomSetup = NULL;
+	obj->PIRLObj.gpirlCustomSetup = NULL;
+	obj->PIRLObj.gpirlReadResource = NULL;
+	obj->PIRLObj.gpirlWriteResource = NULL;
+	obj->PIRLObj.gpirlGetResReg = NULL;
+	obj->PIRLObj.gpirlSetResReg = NULL;
+	obj->PIRLObj.gpirlAdvConfig = NULL;
+	obj->PIRLObj.gpirlAdvConfigDisable = NULL;
+
+	obj->PORTCTRLObj.gvlnSetPortVid = NULL;
+	obj->PORTCTRLObj.gvlnGetPortVid = NULL;
+	obj->PORTCTRLObj.gvlnSetPortVlanDot1qMode = NULL;
+	obj->PORTCTRLObj.gvlnGetPortVlanDot1qMode = NULL;
+	obj->PORTCTRLObj.gprtSetDiscardTagged = NULL;
+	obj->PORTCTRLObj.gprtGetDiscardTagged = NULL;
+	obj->PORTCTRLObj.gprtSetDiscardUntagged = NULL;
+	obj->PORTCTRLObj.gprtGetDiscardUntagged = NULL;
+	obj->PORTCTRLObj.gprtSetUnicastFloodBlock = NULL;
+	obj->PORTCTRLObj.gprtGetUnicastFloodBlock = NULL;
+	obj->PORTCTRLObj.gprtSetMulticastFloodBlock = NULL;
+	obj->PORTCTRLObj.gprtGetMulticastFloodBlock = NULL;
+	obj->PORTCTRLObj.gprtSetDiscardBCastMode = NULL;
+	obj->PORTCTRLObj.gprtGetDiscardBCastMode = NULL;
+	obj->PORTCTRLObj.gprtSetIGMPSnoopEnable = NULL;
+	obj->PORTCTRLObj.gprtGetIGMPSnoopEnable = NULL;
+	obj->PORTCTRLObj.gprtSetHeaderMode = NULL;
+	obj->PORTCTRLObj.gprtGetHeaderMode = NULL;
+	obj->PORTCTRLObj.gprtSetDropOnLock = NULL;
+	obj->PORTCTRLObj.gprtGetDropOnLock = NULL;
+	obj->PORTCTRLObj.gprtSetJumboMode = NULL;
+	obj->PORTCTRLObj.gprtGetJumboMode = NULL;
+	obj->PORTCTRLObj.gprtSetSpecifiedMTU = NULL;
+	obj->PORTCTRLObj.gprtGetSpecifiedMTU = NULL;
+	obj->PORTCTRLObj.gprtSetLearnEnable = NULL;
+	obj->PORTCTRLObj.gprtGetLearnEnable = NULL;
+	obj->PORTCTRLObj.gprtSetVTUPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtGetVTUPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtSetSAPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtGetSAPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtSetDAPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtGetDAPriorityOverride = NULL;
+	obj->PORTCTRLObj.gprtSetMessagePort = NULL;
+	obj->PORTCTRLObj.gprtGetMessagePort = NULL;
+	obj->PORTCTRLObj.gprtSetEtherType = NULL;
+	obj->PORTCTRLObj.gprtGetEtherType = NULL;
+	obj->PORTCTRLObj.gprtSetAllowVidZero = NULL;
+	obj->PORTCTRLObj.gprtGetAllowVidZero = NULL;
+	obj->PORTCTRLObj.gprtSetFlowCtrl = NULL;
+	obj->PORTCTRLObj.gprtGetFlowCtrl = NULL;
+	obj->PORTCTRLObj.gprtSetEgressMonitorSource = NULL;
+	obj->PORTCTRLObj.gprtGetEgressMonitorSource = NULL;
+	obj->PORTCTRLObj.gprtSetIngressMonitorSource = NULL;
+	obj->PORTCTRLObj.gprtGetIngressMonitorSource = NULL;
+	obj->PORTCTRLObj.grcSetEgressRate = NULL;
+	obj->PORTCTRLObj.grcGetEgressRate = NULL;
+	obj->PORTCTRLObj.gprtSetDuplex = NULL;
+	obj->PORTCTRLObj.gprtGetDuplex = NULL;
+	obj->PORTCTRLObj.gprtGetDuplex = NULL;
+	obj->PORTCTRLObj.gprtGetForceLink = NULL;
+	obj->PORTCTRLObj.gprtGetForceLink = NULL;
+	obj->PORTCTRLObj.gprtGetLinkState = NULL;
+	obj->PORTCTRLObj.gprtSetForceSpeed = NULL;
+	obj->PORTCTRLObj.gprtGetForceSpeed = NULL;
+	obj->PORTCTRLObj.gprtGetSpeed = NULL;
+	obj->PORTCTRLObj.gprtSetFrameMode = NULL;
+	obj->PORTCTRLObj.gprtGetFrameMode = NULL;
+	obj->PORTCTRLObj.gprtSetPortECID = NULL;
+	obj->PORTCTRLObj.gprtGetPortECID = NULL;
+	obj->PORTCTRLObj.gprtSetEgressMode = NULL;
+	obj->PORTCTRLObj.gprtGetEgressMode = NULL;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = NULL;
+	obj->PORTCTRLObj.gprtSetIgnoreETag = NULL;
+	obj->PORTCTRLObj.gprtSetExtendedPortCtrlReg = NULL;
+	obj->PORTCTRLObj.gprtGetExtendedPortCtrlReg = NULL;
+	obj->PORTCTRLObj.gprtSetVlanPorts = NULL;
+	obj->PORTCTRLObj.gprtGetVlanPorts = NULL;
+	obj->PORTCTRLObj.gprtSetForceDefaultVid = NULL;
+	obj->PORTCTRLObj.gprtGetForceDefaultVid = NULL;
+	obj->PORTCTRLObj.gprtSetPortState = NULL;
+	obj->PORTCTRLObj.gprtGetPortState = NULL;
+	obj->PORTCTRLObj.gprtSetPreemptEnable = NULL;
+	obj->PORTCTRLObj.gprtGetPreemptEnable = NULL;
+	obj->PORTCTRLObj.gprtSetPreemptSize = NULL;
+	obj->PORTCTRLObj.gprtGetPreemptSize = NULL;
+	obj->PORTCTRLObj.gprtSetPreemptQueue = NULL;
+	obj->PORTCTRLObj.gprtGetPreemptQueue = NULL;
+	obj->PORTCTRLObj.gprtRegDump = NULL;
+
+	obj->TrunkObj.gprtSetTrunkPort = NULL;
+	obj->TrunkObj.gprtGetTrunkPort = NULL;
+	obj->TrunkObj.gsysSetTrunkMaskTable = NULL;
+	obj->TrunkObj.gsysGetTrunkMaskTable = NULL;
+	obj->TrunkObj.gsysSetHashTrunk = NULL;
+	obj->TrunkObj.gsysGetHashTrunk = NULL;
+	obj->TrunkObj.gsysSetTrunkRouting = NULL;
+	obj->TrunkObj.gsysGetTrunkRouting = NULL;
+
+	obj->PORTRMONObj.gstatsFlushAll = NULL;
+	obj->PORTRMONObj.gstatsFlushPort = NULL;
+	obj->PORTRMONObj.gstatsGetPortCounter = NULL;
+	obj->PORTRMONObj.gstatsGetPortAllCounters = NULL;
+	obj->PORTRMONObj.gstatsGetHistogramMode = NULL;
+	obj->PORTRMONObj.gstatsSetHistogramMode = NULL;
+	obj->PORTRMONObj.gmibDump = NULL;
+
+	obj->QUEUEObj.gprtSetQueueCtrl = NULL;
+	obj->QUEUEObj.gprtGetQueueCtrl = NULL;
+	obj->QUEUEObj.gprtSetPortSched = NULL;
+	obj->QUEUEObj.gprtGetPortSched = NULL;
+	obj->QUEUEObj.gsysSetQoSWeight = NULL;
+	obj->QUEUEObj.gsysGetQoSWeight = NULL;
+	obj->QUEUEObj.gprtSetQoSWeight = NULL;
+	obj->QUEUEObj.gprtGetQoSWeight = NULL;
+
+	obj->SYSCTRLObj.gsysSetFloodBC = NULL;
+	obj->SYSCTRLObj.gsysGetFloodBC = NULL;
+	obj->SYSCTRLObj.gsysSetMonitorMgmtCtrl = NULL;
+	obj->SYSCTRLObj.gsysGetMonitorMgmtCtrl = NULL;
+	obj->SYSCTRLObj.gsysSetCPUDest = NULL;
+	obj->SYSCTRLObj.gsysGetCPUDest = NULL;
+	obj->SYSCTRLObj.gsysSetIngressMonitorDest = NULL;
+	obj->SYSCTRLObj.gsysGetIngressMonitorDest = NULL;
+	obj->SYSCTRLObj.gsysSetEgressMonitorDest = NULL;
+	obj->SYSCTRLObj.gsysGetEgressMonitorDest = NULL;
+	obj->SYSCTRLObj.gsysSetRsvd2CpuEnables = NULL;
+	obj->SYSCTRLObj.gsysGetRsvd2CpuEnables = NULL;
+	obj->SYSCTRLObj.gsysSetMGMTPri = NULL;
+	obj->SYSCTRLObj.gsysGetMGMTPri = NULL;
+	obj->SYSCTRLObj.gsysSetSMISetup = NULL;
+	obj->SYSCTRLObj.gsysGetSMISetup = NULL;
+	obj->SYSCTRLObj.gsysGlobal1RegDump = NULL;
+	obj->SYSCTRLObj.gsysGlobal2RegDump = NULL;
+	obj->SYSCTRLObj.gsysSetRMUMode = NULL;
+	obj->SYSCTRLObj.gsysGetRMUMode = NULL;
+	obj->SYSCTRLObj.gsysQbvWrite = NULL;
+	obj->SYSCTRLObj.gsysQbvRead = NULL;
+
+	obj->QOSMAPObj.gprtGetIEEEPrioMap = NULL;
+	obj->QOSMAPObj.gprtSetIEEEPrioMap = NULL;
+	obj->QOSMAPObj.gqosGetPrioMapRule = NULL;
+	obj->QOSMAPObj.gprtGetInitialPri = NULL;
+	obj->QOSMAPObj.gprtSetDefQpri = NULL;
+	obj->QOSMAPObj.gprtGetDefQpri = NULL;
+	obj->QOSMAPObj.gprtSetInitialPri = NULL;
+	obj->QOSMAPObj.gqosSetPrioMapRule = NULL;
+	obj->QOSMAPObj.gprtRewriteDscp = NULL;
+	obj->QOSMAPObj.gprtSetIEEEPrioMapTable = NULL;
+	obj->QOSMAPObj.gprtGetIEEEPrioMapTable = NULL;
+	obj->QOSMAPObj.gprtSetIEEEPrioMapTablePorts = NULL;
+	obj->QOSMAPObj.gprtSetCosToQueueTable = NULL;
+	obj->QOSMAPObj.gprtSetCosToDscpTable = NULL;
+	obj->QOSMAPObj.gprtSetCosToQueue = NULL;
+	obj->QOSMAPObj.gprtGetCosToQueue = NULL;
+	obj->QOSMAPObj.gprtSetCosToDscp = NULL;
+	obj->QOSMAPObj.gprtGetCosToDscp = NULL;
+
+	obj->QAVObj.gqavGetPortQpriXHiLimit = NULL;
+	obj->QAVObj.gqavSetPortQpriXHiLimit = NULL;
+	obj->QAVObj.gqavGetPortQpriXRate = NULL;
+	obj->QAVObj.gqavSetPortQpriXRate = NULL;
+
+	obj->PTPObj.gptpSetIntEnable = NULL;
+	obj->PTPObj.gptpGetIntEnable = NULL;
+	obj->PTPObj.gptpSetProtPTPEn = NULL;
+	obj->PTPObj.gptpGetProtPTPEn = NULL;
+	obj->PTPObj.gptpSetPortConfig = NULL;
+	obj->PTPObj.gptpGetPortConfig = NULL;
+	obj->PTPObj.gptpGetTimeStamp = NULL;
+	obj->PTPObj.gptpGetTSValidSt = NULL;
+	obj->PTPObj.gptpResetTimeStamp = NULL;
+	obj->PTPObj.gptpTimeStampHarvest = NULL;
+	obj->PTPObj.gptpSetGlobalConfig = NULL;
+	obj->PTPObj.gptpGetGlobalConfig = NULL;
+	obj->PTPObj.gptpGetIntStatus = NULL;
+	obj->PTPObj.gptpSetMeanPathDelay = NULL;
+	obj->PTPObj.gptpGetMeanPathDelay = NULL;
+	obj->PTPObj.gptpSetIgrPathDelayAsym = NULL;
+	obj->PTPObj.gptpGetIgrPathDelayAsym = NULL;
+	obj->PTPObj.gptpSetEgrPathDelayAsym = NULL;
+	obj->PTPObj.gptpGetEgrPathDelayAsym = NULL;
+	obj->PTPObj.gptpSetMode = NULL;
+	obj->PTPObj.gptpGetMode = NULL;
+	obj->PTPObj.gptpSetMasterSlave = NULL;
+	obj->PTPObj.gptpGetMasterSlave = NULL;
+	obj->PTPObj.gptpGetTODBusyBitStatus = NULL;
+	obj->PTPObj.gptpTODStoreCompensation = NULL;
+	obj->PTPObj.gptpTODStoreAll = NULL;
+	obj->PTPObj.gptpTODCaptureAll = NULL;
+
+	obj->PTPObj.gptpSetPulse = NULL;
+	obj->PTPObj.gptpGetPulse = NULL;
+	obj->PTPObj.gtaiGetPTPGlobalTime = NULL;
+	obj->PTPObj.gtaiGetPTPGlobalTimeSample = NULL;
+    obj->PTPObj.gptpGetPortReg = NULL;
+    obj->PTPObj.gptpSetPortReg = NULL;
+    obj->PTPObj.gptpGetGlobalReg = NULL;
+    obj->PTPObj.gptpSetGlobalReg = NULL;
+    obj->PTPObj.gptpGetTaiReg = NULL;
+    obj->PTPObj.gptpSetTaiReg = NULL;
+    obj->PTPObj.gptpSet1588v2Config = NULL;
+    obj->PTPObj.gptpSet8021asConfig = NULL;
+    obj->PTPObj.gptpSet8021asRevConfig = NULL;
+    obj->PTPObj.gptpSetPreemptTsSel = NULL;
+    obj->PTPObj.gptpGetPreemptTsSel = NULL;
+    obj->PTPObj.gptpSetPreemptCtrl = NULL;
+    obj->PTPObj.gptpGetPreemptCtrl = NULL;
+	obj->PTPObj.gtaiSetTrigGenTimerSel = NULL;
+	obj->PTPObj.gtaiGetTrigGenTimerSel = NULL;
+
+	obj->TCAMObj.gtcamFlushAll = NULL;
+	obj->TCAMObj.gtcamFlushEntry = NULL;
+	obj->TCAMObj.gtcamLoadEntry = NULL;
+	obj->TCAMObj.gtcamReadTCAMData = NULL;
+	obj->TCAMObj.gtcamGetNextTCAMData = NULL;
+	obj->TCAMObj.gtcamFindEntry = NULL;
+	obj->TCAMObj.gtcamSetMode = NULL;
+	obj->TCAMObj.gtcamGetMode = NULL;
+	obj->TCAMObj.gtcamAddEntryPort = NULL;
+	obj->TCAMObj.gtcamRemoveEntryPort = NULL;
+	obj->TCAMObj.gtcamEgrFlushEntry = NULL;
+	obj->TCAMObj.gtcamEgrFlushEntryAllPorts = NULL;
+	obj->TCAMObj.gtcamEgrLoadEntry = NULL;
+	obj->TCAMObj.gtcamEgrGetNextTCAMData = NULL;
+	obj->TCAMObj.gtcamEgrReadTCAMData = NULL;
+	obj->TCAMObj.gtcamDump = NULL;
+	obj->TCAMObj.gtcamAdvConfig = NULL;
+
+	obj->TCAMRCObj.gtcamRCLoadEntry = NULL;
+	obj->TCAMRCObj.gtcamRCFlushEntry = NULL;
+	obj->TCAMRCObj.gtcamRCReadEntry = NULL;
+	obj->TCAMRCObj.gtcamRCGetNextEntry = NULL;
+	obj->TCAMRCObj.gtcamRCFindEntry = NULL;
+	obj->TCAMRCObj.gtcamRCEntryDump = NULL;
+
+	obj->TCAMRCCompObj.gtcamRCCompLoad = NULL;
+	obj->TCAMRCCompObj.gtcamRCCompFlushAll = NULL;
+	obj->TCAMRCCompObj.gtcamRCCompFlushPort = NULL;
+	obj->TCAMRCCompObj.gtcamRCCompRead = NULL;
+
+	obj->ARPObj.garpLoadMcEntry = NULL;
+	obj->ARPObj.garpLoadUcEntry = NULL;
+	obj->ARPObj.garpFlushEntry = NULL;
+	obj->ARPObj.garpFlushAll = NULL;
+	obj->ARPObj.garpReadEntry = NULL;
+	obj->ARPObj.garpGetNextEntry = NULL;
+
+	obj->RMUObj.grmuGetID = NULL;
+	obj->RMUObj.grmuAtuDump = NULL;
+	obj->RMUObj.grmuEcidDump = NULL;
+	obj->RMUObj.grmuMibDump = NULL;
+	obj->RMUObj.grmuMib2Dump = NULL;
+	obj->RMUObj.grmuTCAMDump = NULL;
+	obj->RMUObj.grmuTCAMRead = NULL;
+	obj->RMUObj.grmuTCAMWrite = NULL;
+	obj->RMUObj.grmuMultiRegAccess = NULL;
+    obj->RMUObj.grmuRegDump = NULL;
+
+	obj->SmiPhyRegAccessObj.msdGetSMIC45PhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdSetSMIC45PhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg = NULL;
+	obj->SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg = NULL;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyReg = NULL;
+	obj->SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg = NULL;
+	obj->SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg = NULL;
+
+	obj->LEDObj.gledForceOn = NULL;
+	obj->LEDObj.gledForceOff = NULL;
+	obj->LEDObj.gledLinkAct = NULL;
+	obj->LEDObj.gledModeSet = NULL;
+	obj->LEDObj.gledModeGet = NULL;
+	obj->LEDObj.gledBlinkRateSet = NULL;
+	obj->LEDObj.gledBlinkRateGet = NULL;
+	obj->LEDObj.gledPulseStretchSet = NULL;
+	obj->LEDObj.gledPulseStretchGet = NULL;
+	obj->LEDObj.gledSpecialModeSet = NULL;
+	obj->LEDObj.gledSpecialModeGet = NULL;
+	obj->LEDObj.gledCtrlSet = NULL;
+	obj->LEDObj.gledCtrlGet = NULL;
+	obj->LEDObj.gledDump = NULL;
+
+	obj->INTObj.gdevIntEnableSet = NULL;
+	obj->INTObj.gdevIntEnableGet = NULL;
+	obj->INTObj.gdevIntStatusGet = NULL;
+	obj->INTObj.gactiveIntEnableSet = NULL;
+	obj->INTObj.gactiveIntEnableGet = NULL;
+	obj->INTObj.gactiveIntStatusGet = NULL;
+
+    obj->QCRObj.gqcrFlushAll = NULL;
+    obj->QCRObj.gqcrFlushOne = NULL;
+    obj->QCRObj.gqcrSetGrpId = NULL;
+    obj->QCRObj.gqcrGetGrpId = NULL;
+    obj->QCRObj.gqcrSetCbsLimit = NULL;
+    obj->QCRObj.gqcrGetCbsLimit = NULL;
+    obj->QCRObj.gqcrSetMaxResidenceTime = NULL;
+    obj->QCRObj.gqcrGetMaxResidenceTime = NULL;
+    obj->QCRObj.gqcrSetRateLimit = NULL;
+    obj->QCRObj.gqcrGetRateLimit = NULL;
+
+    obj->FRERObj.gfrerSeqGenFlushAll = NULL;
+    obj->FRERObj.gfrerSeqGenFlushEntry = NULL;
+    obj->FRERObj.gfrerSeqGenRead = NULL;
+    obj->FRERObj.gfrerSeqGenLoad = NULL;
+
+    obj->FRERObj.gfrerIndvRcvyFlushAll = NULL;
+    obj->FRERObj.gfrerIndvRcvyFlushEntry = NULL;
+    obj->FRERObj.gfrerIndvRcvyRead = NULL;
+    obj->FRERObj.gfrerIndvRcvyGetNext = NULL;
+    obj->FRERObj.gfrerIndvRcvyReadClear = NULL;
+
+    obj->FRERObj.gfrerSeqRcvyFlushAll = NULL;
+    obj->FRERObj.gfrerSeqRcvyFlushEntry = NULL;
+    obj->FRERObj.gfrerSeqRcvyRead = NULL;
+    obj->FRERObj.gfrerSeqRcvyLoad = NULL;
+    obj->FRERObj.gfrerSeqRcvyGetNext = NULL;
+    obj->FRERObj.gfrerSeqRcvyGetViolation = NULL;
+    obj->FRERObj.gfrerSeqRcvyReadClear = NULL;
+
+    obj->FRERObj.gfrerBank0SCtrFlushAll = NULL;
+    obj->FRERObj.gfrerBank0SCtrFlushEntry = NULL;
+    obj->FRERObj.gfrerBank0SCtrRead = NULL;
+    obj->FRERObj.gfrerBank0SCtrLoad = NULL;
+    obj->FRERObj.gfrerBank0SCtrGetNext = NULL;
+    obj->FRERObj.gfrerBank0SCtrReadClear = NULL;
+
+    obj->FRERObj.gfrerBank1SCtrFlushAll = NULL;
+    obj->FRERObj.gfrerBank1SCtrFlushEntry = NULL;
+    obj->FRERObj.gfrerBank1SCtrRead = NULL;
+    obj->FRERObj.gfrerBank1SCtrLoad = NULL;
+    obj->FRERObj.gfrerBank1SCtrGetNext = NULL;
+    obj->FRERObj.gfrerBank1SCtrReadClear = NULL;
+
+    obj->FRERObj.gfrerSnapshotRefresh = NULL;
+
+	obj->QCIObj.gqciStreamFiltFlushAll = NULL;
+	obj->QCIObj.gqciStreamFiltSet = NULL;
+	obj->QCIObj.gqciStreamFiltBlockStatSet = NULL;
+	obj->QCIObj.gqciStreamFiltBlockStatGet = NULL;
+	obj->QCIObj.gqciStreamFiltEnAts = NULL;
+	obj->QCIObj.gqciStreamFiltEnGate = NULL;
+	obj->QCIObj.gqciStreamFiltMatchCtrGet = NULL;
+	obj->QCIObj.gqciStreamFiltFilterCtrGet = NULL;
+	obj->QCIObj.gqciStreamGateFiltCtrGet = NULL;
+	obj->QCIObj.gqciFlowMeterFiltCtrGet = NULL;
+	obj->QCIObj.gqciCountersGetBulk = NULL;
+
+	obj->QCIObj.gqciStreamGateFlushAll = NULL;
+	obj->QCIObj.gqciStreamGateDefStateSet = NULL;
+	obj->QCIObj.gqciStreamGateScaleSet = NULL;
+	obj->QCIObj.gqciStreamGateTimeGenIdSet = NULL;
+	obj->QCIObj.gqciStreamGateEntryAdd = NULL;
+
+	obj->QCIObj.gqciStreamGateTimeGenFlush = NULL;
+	obj->QCIObj.gqciStreamGateTimeGenSet = NULL;
+	obj->QCIObj.gqciStreamGateScheduleSet = NULL;
+
+	obj->QCIObj.gqciFlowMeterFlushAll = NULL;
+	obj->QCIObj.gqciFlowMeterCoupleFlagSet = NULL;
+	obj->QCIObj.gqciFlowMeterCoupleFlagGet = NULL;
+	obj->QCIObj.gqciFlowMeterDropOnYelSet = NULL;
+	obj->QCIObj.gqciFlowMeterDropOnYelGet = NULL;
+	obj->QCIObj.gqciFlowMeterRedBlockEnSet = NULL;
+	obj->QCIObj.gqciFlowMeterRedBlockEnGet = NULL;
+	obj->QCIObj.gqciFlowMeterRedBlkStatSet = NULL;
+	obj->QCIObj.gqciFlowMeterRedBlkStatGet = NULL;
+	obj->QCIObj.gqciFlowMeterAdvConfig = NULL;
+
+	obj->MACSECObj.gmacsecFlushAll = NULL;
+	obj->MACSECObj.gmacsecCreateRule = NULL;
+	obj->MACSECObj.gmacsecDeleteRule = NULL;
+	obj->MACSECObj.gmacsecGetRule = NULL;
+	obj->MACSECObj.gmacsecCreateTxSecY = NULL;
+	obj->MACSECObj.gmacsecDeleteTxSecY = NULL;
+	obj->MACSECObj.gmacsecGetTxSecY = NULL;
+	obj->MACSECObj.gmacsecCreateRxSecY = NULL;
+	obj->MACSECObj.gmacsecDeleteRxSecY = NULL;
+	obj->MACSECObj.gmacsecGetRxSecY = NULL;
+	obj->MACSECObj.gmacsecCreateRxSC = NULL;
+	obj->MACSECObj.gmacsecDeleteRxSC = NULL;
+	obj->MACSECObj.gmacsecGetRxSC = NULL;
+	obj->MACSECObj.gmacsecCreateRxSA = NULL;
+	obj->MACSECObj.gmacsecDeleteRxSA = NULL;
+	obj->MACSECObj.gmacsecGetRxSA = NULL;
+	obj->MACSECObj.gmacsecCreateTxSC = NULL;
+	obj->MACSECObj.gmacsecDeleteTxSC = NULL;
+	obj->MACSECObj.gmacsecGetTxSC = NULL;
+	obj->MACSECObj.gmacsecCreateTxSA = NULL;
+	obj->MACSECObj.gmacsecDeleteTxSA = NULL;
+	obj->MACSECObj.gmacsecGetTxSA = NULL;
+	obj->MACSECObj.gmacsecGetRXSCStates = NULL;
+	obj->MACSECObj.gmacsecGetRXSecYStates = NULL;
+	obj->MACSECObj.gmacsecGetTXSCStates = NULL;
+	obj->MACSECObj.gmacsecGetTXSecYStates = NULL;
+	obj->MACSECObj.gmacsecEnableEgressSet = NULL;
+	obj->MACSECObj.gmacsecEnableEgressGet = NULL;
+	obj->MACSECObj.gmacsecEnableIngressSet = NULL;
+	obj->MACSECObj.gmacsecEnableIngressGet = NULL;
+	obj->MACSECObj.gmacsecSetTxPNThreshold = NULL;
+	obj->MACSECObj.gmacsecGetTxPNThreshold = NULL;
+	obj->MACSECObj.gmacsecSetTxXPNThreshold = NULL;
+	obj->MACSECObj.gmacsecGetTxXPNThreshold = NULL;
+	obj->MACSECObj.gmacsecSetRxDefaultSCI = NULL;
+	obj->MACSECObj.gmacsecGetRxDefaultSCI = NULL;
+	obj->MACSECObj.gmacsecSetTxSCIntCtrl = NULL;
+	obj->MACSECObj.gmacsecGetTxSCIntCtrl = NULL;
+	obj->MACSECObj.gmacsecGetNextTxSCIntStatus = NULL;
+	obj->MACSECObj.gmacsecGetStatsBulk = NULL;
 
 	return MSD_OK;
 }
 
-MSD_STATUS InitDevObj(MSD_QD_DEV *dev)
+/*
+* Function tables, one per chip variant built in. Families whose functions
+* depend on the device ID (Topaz, Pearl, Amethyst) have one table per variant,
+* every other family has a single table. A table is filled when the first
+* device of its variant is loaded and not changed afterwards; later devices
+* only take a pointer to it. Devices that are not bound to a table point to
+* msdDevObjNone, whose functions are all NULL.
+*/
+enum
 {
-	MSD_STATUS retVal;
-	retVal = InitObj(dev);
-	if (dev->devName == MSD_TOPAZ)
-	{
-		retVal = InitDevObj_Topaz(dev);
-	}
-	else if (dev->devName == MSD_PERIDOT)
+#ifdef TOPAZ_BUILD_IN
+	MSD_DEVOBJ_TOPAZ,
+	MSD_DEVOBJ_TOPAZ_6141,
+#endif
+#ifdef PERIDOT_BUILD_IN
+	MSD_DEVOBJ_PERIDOT,
+#endif
+#ifdef PEARL_BUILD_IN
+	MSD_DEVOBJ_PEARL,
+	MSD_DEVOBJ_PEARL_6320,
+#endif
+#ifdef AGATE_BUILD_IN
+	MSD_DEVOBJ_AGATE,
+#endif
+#ifdef AMETHYST_BUILD_IN
+	MSD_DEVOBJ_AMETHYST,
+	MSD_DEVOBJ_AMETHYST_6193X,
+	MSD_DEVOBJ_AMETHYST_6191X,
+#endif
+#ifdef OAK_BUILD_IN
+	MSD_DEVOBJ_OAK,
+#endif
+#ifdef SPRUCE_BUILD_IN
+	MSD_DEVOBJ_SPRUCE,
+#endif
+#ifdef BONSAIZ1_BUILD_IN
+	MSD_DEVOBJ_BONSAIZ1,
+#endif
+#ifdef FIR_BUILD_IN
+	MSD_DEVOBJ_FIR,
+#endif
+#ifdef BONSAI_BUILD_IN
+	MSD_DEVOBJ_BONSAI,
+#endif
+	MSD_DEVOBJ_NUM
+};
+
+static const SwitchDevObj_ msdDevObjNone;
+static SwitchDevObj_ msdDevObjTable[MSD_DEVOBJ_NUM + 1];
+static MSD_BOOL msdDevObjTableReady[MSD_DEVOBJ_NUM + 1];
+
+/* table index of the device's chip variant, MSD_DEVOBJ_NUM if not built in */
+static int msdDevObjIndex(MSD_QD_DEV *dev)
+{
+	int index = MSD_DEVOBJ_NUM;
+
+	switch (dev->devName)
 	{
-		retVal = InitDevObj_Peridot(dev);
+#ifdef TOPAZ_BUILD_IN
+	case MSD_TOPAZ:
+		index = (dev->deviceId == MSD_88E6141) ? MSD_DEVOBJ_TOPAZ_6141 : MSD_DEVOBJ_TOPAZ;
+		break;
+#endif
+#ifdef PERIDOT_BUILD_IN
+	case MSD_PERIDOT:
+		index = MSD_DEVOBJ_PERIDOT;
+		break;
+#endif
+#ifdef PEARL_BUILD_IN
+	case MSD_PEARL:
+		index = (dev->deviceId == MSD_88E6320) ? MSD_DEVOBJ_PEARL_6320 : MSD_DEVOBJ_PEARL;
+		break;
+#endif
+#ifdef AGATE_BUILD_IN
+	case MSD_AGATE:
+		index = MSD_DEVOBJ_AGATE;
+		break;
+#endif
+#ifdef AMETHYST_BUILD_IN
+	case MSD_AMETHYST:
+		if (dev->deviceId == MSD_88E6191X)
+		{
+			index = MSD_DEVOBJ_AMETHYST_6191X;
+		}
+		else if (dev->deviceId == MSD_88E6193X)
+		{
+			index = MSD_DEVOBJ_AMETHYST_6193X;
+		}
+		else
+		{
+			index = MSD_DEVOBJ_AMETHYST;
+		}
+		break;
+#endif
+#ifdef OAK_BUILD_IN
+	case MSD_OAK:
+		index = MSD_DEVOBJ_OAK;
+		break;
+#endif
+#ifdef SPRUCE_BUILD_IN
+	case MSD_SPRUCE:
+		index = MSD_DEVOBJ_SPRUCE;
+		break;
+#endif
+#ifdef BONSAIZ1_BUILD_IN
+	case MSD_BONSAIZ1:
+		index = MSD_DEVOBJ_BONSAIZ1;
+		break;
+#endif
+#ifdef FIR_BUILD_IN
+	case MSD_FIR:
+		index = MSD_DEVOBJ_FIR;
+		break;
+#endif
+#ifdef BONSAI_BUILD_IN
+	case MSD_BONSAI:
+		index = MSD_DEVOBJ_BONSAI;
+		break;
+#endif
+	default:
+		break;
 	}
-	else if (dev->devName == MSD_PEARL)
+
+	return index;
+}
+
+void ResetDevObj(MSD_QD_DEV *dev)
+{
+	dev->SwitchDevObj = &msdDevObjNone;
+}
+
+MSD_STATUS InitDevObj(MSD_QD_DEV *dev)
+{
+	MSD_STATUS retVal = MSD_OK;
+	int index;
+	SwitchDevObj_ *obj;
+
+	dev->SwitchDevObj = &msdDevObjNone;
+
+	index = msdDevObjIndex(dev);
+	if (index == MSD_DEVOBJ_NUM)
 	{
-		retVal = InitDevObj_Pearl(dev);
+		MSD_DBG_ERROR(("Device family of device ID 0x%x is not built in.\n", (unsigned int)dev->deviceId));
+		return MSD_FAIL;
 	}
-	else if (dev->devName == MSD_AGATE)
+	obj = &msdDevObjTable[index];
+
+	/* devices loaded in parallel share the tables, see msdLoadDriver */
+	if ((dev->loadSem != 0U) && (dev->semTake != NULL))
 	{
-		retVal = InitDevObj_Agate(dev);
+		(void)dev->semTake(dev->loadSem, OS_WAIT_FOREVER);
 	}
-	else if (dev->devName == MSD_AMETHYST)
+
+	if (msdDevObjTableReady[index] != MSD_TRUE)
 	{
-		retVal = InitDevObj_Amethyst(dev);
+		retVal = InitObj(obj);
+
+		if (dev->devName == MSD_TOPAZ)
+		{
+			retVal = InitDevObj_Topaz(dev, obj);
+		}
+		else if (dev->devName == MSD_PERIDOT)
+		{
+			retVal = InitDevObj_Peridot(dev, obj);
+		}
+		else if (dev->devName == MSD_PEARL)
+		{
+			retVal = InitDevObj_Pearl(dev, obj);
+		}
+		else if (dev->devName == MSD_AGATE)
+		{
+			retVal = InitDevObj_Agate(dev, obj);
+		}
+		else if (dev->devName == MSD_AMETHYST)
+		{
+			retVal = InitDevObj_Amethyst(dev, obj);
+		}
+		else if (dev->devName == MSD_OAK)
+		{
+			retVal = InitDevObj_Oak(dev, obj);
+		}
+		else if (dev->devName == MSD_SPRUCE)
+		{
+			retVal = InitDevObj_Spruce(dev, obj);
+		}
+		else if (dev->devName == MSD_BONSAIZ1)
+		{
+			retVal = InitDevObj_BonsaiZ1(dev, obj);
+		}
+		else if (dev->devName == MSD_FIR)
+		{
+			retVal = InitDevObj_Fir(dev, obj);
+		}
+		else if (dev->devName == MSD_BONSAI)
+		{
+			retVal = InitDevObj_Bonsai(dev, obj);
+		}
+		else
+		{
+			retVal = MSD_FAIL;
+		}
+
+		if (retVal == MSD_OK)
+		{
+			msdDevObjTableReady[index] = MSD_TRUE;
+		}
 	}
-	else if (dev->devName == MSD_OAK)
+
+	if (retVal == MSD_OK)
 	{
-		retVal = InitDevObj_Oak(dev);
+		dev->SwitchDevObj = obj;
 	}
-    else if (dev->devName == MSD_SPRUCE)
-    {
-        retVal = InitDevObj_Spruce(dev);
-    }
-    else if (dev->devName == MSD_BONSAIZ1)
-    {
-        retVal = InitDevObj_BonsaiZ1(dev);
-    }
-	else if (dev->devName == MSD_FIR)
-    {
-        retVal = InitDevObj_Fir(dev);
-    }
-	else if (dev->devName == MSD_BONSAI)
+
+	if ((dev->loadSem != 0U) && (dev->semGive != NULL))
 	{
-		retVal = InitDevObj_Bonsai(dev);
+		(void)dev->semGive(dev->loadSem);
 	}
-	else
+
+#ifdef AMETHYST_BUILD_IN
+	/*For Amethyst, reserve 16 free queue size, already done on a running device*/
+	if ((retVal == MSD_OK) && (dev->devName == MSD_AMETHYST) && (dev->reattached != MSD_TRUE))
 	{
-		retVal = MSD_FAIL;
+		retVal = msdReserveFreeQueueSize(dev);
 	}
+#endif
 
 	return retVal;
 }
@@ -4697,4 +4930,6 @@ static MSD_STATUS msdReserveFreeQueueSize(MSD_QD_DEV *qdev)
 	}
 
 	return MSD_OK;
-}
\ No newline at end of file
+}
+
+#endif /* MSD_SINGLE_FAMILY_FIR */
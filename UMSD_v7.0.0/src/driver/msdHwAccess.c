@@ -22,6 +22,7 @@
 #include <driver/msdHwAccess.h>
 #include <platform/msdSem.h>
 #include <utils/msdUtils.h>
+#include <driver/msdDevObj.h>
 
 static MSD_STATUS msdRmuRegRead (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, OUT MSD_U16* value);
 static MSD_STATUS msdRmuRegWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, MSD_U16 value);
@@ -652,9 +653,9 @@ MSD_STATUS msdSetSMIC45PhyReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdSetSMIC45PhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIC45PhyReg(dev, devAddr, phyAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdSetSMIC45PhyReg)(dev, devAddr, phyAddr, regAddr, data);
 		}
 		else
 		{
@@ -707,9 +708,9 @@ MSD_STATUS msdGetSMIC45PhyReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdGetSMIC45PhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIC45PhyReg(dev, devAddr, phyAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdGetSMIC45PhyReg)(dev, devAddr, phyAddr, regAddr, data);
 		}
 		else
 		{
@@ -761,9 +762,9 @@ MSD_STATUS msdSetSMIPhyReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdSetSMIPhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyReg(dev, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdSetSMIPhyReg)(dev, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -814,9 +815,9 @@ MSD_STATUS msdGetSMIPhyReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdGetSMIPhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyReg(dev, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdGetSMIPhyReg)(dev, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -870,9 +871,9 @@ MSD_STATUS msdSetSMIPhyXMDIOReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdSetSMIPhyXMDIOReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIPhyXMDIOReg(dev, portNum, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdSetSMIPhyXMDIOReg)(dev, portNum, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -925,9 +926,9 @@ MSD_STATUS msdGetSMIPhyXMDIOReg
     }
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdGetSMIPhyXMDIOReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIPhyXMDIOReg(dev, portNum, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdGetSMIPhyXMDIOReg)(dev, portNum, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -979,9 +980,9 @@ IN  MSD_U16  data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdSetSMIExtPhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyReg(dev, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdSetSMIExtPhyReg)(dev, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -1032,9 +1033,9 @@ OUT MSD_U16  *data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdGetSMIExtPhyReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyReg(dev, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdGetSMIExtPhyReg)(dev, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -1088,9 +1089,9 @@ IN MSD_U16 data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdSetSMIExtPhyXMDIOReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdSetSMIExtPhyXMDIOReg(dev, portNum, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdSetSMIExtPhyXMDIOReg)(dev, portNum, devAddr, regAddr, data);
 		}
 		else
 		{
@@ -1143,9 +1144,9 @@ OUT MSD_U16 *data
 	}
 	else
 	{
-		if (dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg != NULL)
+		if (MSD_DEV_HAS(dev, SmiPhyRegAccessObj, msdGetSMIExtPhyXMDIOReg))
 		{
-			retVal = dev->SwitchDevObj.SmiPhyRegAccessObj.msdGetSMIExtPhyXMDIOReg(dev, portNum, devAddr, regAddr, data);
+			retVal = MSD_DEV_FN(dev, SmiPhyRegAccessObj, msdGetSMIExtPhyXMDIOReg)(dev, portNum, devAddr, regAddr, data);
 		}
 		else
 		{
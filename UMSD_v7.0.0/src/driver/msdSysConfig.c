@@ -25,11 +25,40 @@
 #include <platform/msdSem.h>
 #include <utils/msdUtils.h>
 
-static MSD_QD_DEV sohoDevs[MAX_SOHO_DEVICES];
+#if (MSD_MAX_LOADED_DEVICES < 1) || (MSD_MAX_LOADED_DEVICES > MAX_SOHO_DEVICES)
+#error "MSD_MAX_LOADED_DEVICES must be within [1, MAX_SOHO_DEVICES]"
+#endif
+
+/* device state is taken from sohoDevs when a device is loaded, see MSD_MAX_LOADED_DEVICES */
+static MSD_QD_DEV sohoDevs[MSD_MAX_LOADED_DEVICES];
+static MSD_BOOL sohoDevsUsed[MSD_MAX_LOADED_DEVICES];
 static MSD_QD_DEV_PTR sohoDevsPtr[MAX_SOHO_DEVICES];
 
 static MSD_BOOL msdRegister(MSD_QD_DEV *dev, const MSD_BSP_FUNCTIONS* pBSPFunctions);
 
+/* guard the device state pool while devices are loaded in parallel */
+static void msdLoadSemTake(MSD_SEM loadSem, MSD_FMSD_SEM_TAKE semTake)
+{
+	if ((loadSem != 0U) && (semTake != NULL))
+	{
+		(void)semTake(loadSem, OS_WAIT_FOREVER);
+	}
+}
+
+static void msdLoadSemGive(MSD_SEM loadSem, MSD_FMSD_SEM_GIVE semGive)
+{
+	if ((loadSem != 0U) && (semGive != NULL))
+	{
+		(void)semGive(loadSem);
+	}
+}
+
+/* semaphores of a partly loaded device may not be created yet, skip those */
+static MSD_STATUS msdUnLoadSemDelete(MSD_U8 devNum, MSD_SEM smid)
+{
+	return (smid == 0U) ? MSD_OK : msdSemDelete(devNum, smid);
+}
+
 /*******************************************************************************
 * msdLoadDriver
 *
@@ -54,6 +83,13 @@ static MSD_BOOL msdRegister(MSD_QD_DEV *dev, const MSD_BSP_FUNCTIONS* pBSPFuncti
 *
 * COMMENTS:
 *     msdUnLoadDriver is also provided to do driver cleanup.
+*     Devices with different devNum, on different buses or RMU channels, may
+*     be loaded from parallel threads if they are given the same cfg->loadSem.
+*     With cfg->reattach the driver attaches to a device that is already
+*     configured, e.g. when the management process restarts: the device ID
+*     is checked against cfg->reattachDeviceId and no register is written.
+*     Driver copies of device tables start empty and are read back when
+*     first needed.
 *
 *******************************************************************************/
 MSD_STATUS msdLoadDriver
@@ -65,6 +101,8 @@ MSD_STATUS msdLoadDriver
 	MSD_U16 		value;
 	MSD_BOOL		flag = MSD_TRUE;
 	MSD_QD_DEV		*dev;
+	MSD_U32			slot;
+	MSD_STATUS		retVal;
 
     MSD_DBG_INFO(("msdLoadDriver Called.\n"));
 
@@ -75,23 +113,46 @@ MSD_STATUS msdLoadDriver
         return MSD_BAD_PARAM;
     }
 
-	if ((sohoDevsPtr[cfg->devNum] != NULL) && (sohoDevsPtr[cfg->devNum]->devEnabled))
+	if (cfg->devNum >= MAX_SOHO_DEVICES)
+	{
+		MSD_DBG_ERROR(("Input devNum %d out of range. It should be within [0, %u]\n", cfg->devNum, MAX_SOHO_DEVICES - 1U));
+		return MSD_BAD_PARAM;
+	}
+
+	msdLoadSemTake(cfg->loadSem, cfg->BSPFunctions.semTake);
+
+	/* a failed load releases its state, see msdUnLoadDriver */
+	if (sohoDevsPtr[cfg->devNum] != NULL)
 	{
+		msdLoadSemGive(cfg->loadSem, cfg->BSPFunctions.semGive);
 		MSD_DBG_INFO(("Soho Device already started.\n"));
 		return MSD_ALREADY_EXIST;
 	}
 
-	if (cfg->devNum >= MAX_SOHO_DEVICES)
+	dev = NULL;
+	for (slot = 0; (dev == NULL) && (slot < MSD_MAX_LOADED_DEVICES); slot++)
 	{
-		MSD_DBG_ERROR(("Input devNum %d out of range. It should be within [0, %u]\n", cfg->devNum, MAX_SOHO_DEVICES - 1U));
-		return MSD_BAD_PARAM;
+		if (sohoDevsUsed[slot] == MSD_FALSE)
+		{
+			sohoDevsUsed[slot] = MSD_TRUE;
+			dev = &(sohoDevs[slot]);
+		}
+	}
+	if (dev == NULL)
+	{
+		msdLoadSemGive(cfg->loadSem, cfg->BSPFunctions.semGive);
+		MSD_DBG_ERROR(("No device state left, %u devices are loaded.\n", MSD_MAX_LOADED_DEVICES));
+		return MSD_FAIL;
 	}
 
 	/*Initialize dev structure*/
-	msdMemSet((void*)&sohoDevs[cfg->devNum], 0, sizeof(MSD_QD_DEV));
-	dev = &(sohoDevs[cfg->devNum]);
+	msdMemSet((void*)dev, 0, sizeof(MSD_QD_DEV));
+	ResetDevObj(dev);
 	sohoDevsPtr[cfg->devNum] = dev;
+	msdLoadSemGive(cfg->loadSem, cfg->BSPFunctions.semGive);
+
 	dev->devNum = cfg->devNum;
+	dev->loadSem = cfg->loadSem;
     dev->InterfaceChannel = cfg->InterfaceChannel;
     dev->rmuMode = cfg->rmuMode;
     dev->eTypeValue = cfg->eTypeValue;
@@ -99,6 +160,7 @@ MSD_STATUS msdLoadDriver
 	if (msdRegister(dev, &(cfg->BSPFunctions)) != MSD_TRUE)
     {
 		MSD_DBG_ERROR(("msdRegister Failed.\n"));
+		msdUnLoadDriver(dev->devNum);
         return MSD_FAIL;
     }
 
@@ -122,6 +184,7 @@ MSD_STATUS msdLoadDriver
 		if ((msdGetAnyReg(dev->devNum, dev->baseRegAddr, (MSD_U8)MSD_REG_SWITCH_ID, &value)) != MSD_OK)
         {
 			MSD_DBG_ERROR(("Get Device ID Failed.\n"));
+			msdUnLoadDriver(dev->devNum);
             return MSD_FAIL;
         }
 
@@ -279,6 +342,7 @@ MSD_STATUS msdLoadDriver
 					{
 						dev->devName = MSD_UNKNOWN;
 						MSD_DBG_ERROR(("Unknown Device. Initialization failed.\n"));
+						msdUnLoadDriver(dev->devNum);
 						return MSD_FAIL;
 					}
 					else
@@ -298,6 +362,27 @@ MSD_STATUS msdLoadDriver
 		}
     }
 
+#ifdef MSD_SINGLE_FAMILY_FIR
+	if (dev->devName != MSD_FIR)
+	{
+		MSD_DBG_ERROR(("Device is not supported by the Fir only driver.\n"));
+		msdUnLoadDriver(dev->devNum);
+		return MSD_NOT_SUPPORTED;
+	}
+#endif
+
+	if (cfg->reattach == MSD_TRUE)
+	{
+		if ((cfg->reattachDeviceId != 0) && (dev->deviceId != cfg->reattachDeviceId))
+		{
+			MSD_DBG_ERROR(("Reattach found device ID 0x%x, expected 0x%x.\n",
+				(unsigned int)dev->deviceId, (unsigned int)cfg->reattachDeviceId));
+			msdUnLoadDriver(dev->devNum);
+			return MSD_FAIL;
+		}
+		dev->reattached = MSD_TRUE;
+	}
+
     /* Initialize the ATU semaphore.    */
 	if ((dev->atuRegsSem = msdSemCreate(dev->devNum, MSD_SEM_FULL)) == 0U)
     {
@@ -405,8 +490,14 @@ MSD_STATUS msdLoadDriver
 		msdUnLoadDriver(dev->devNum);
 		return MSD_FAIL;
 	}
+	/* function tables are filled at the first load of a chip variant */
+	if ((retVal = InitDevObj(dev)) != MSD_OK)
+	{
+		MSD_DBG_ERROR(("InitDevObj Failed.\n"));
+		msdUnLoadDriver(dev->devNum);
+		return retVal;
+	}
     dev->devEnabled = 1;
-    InitDevObj(dev);
 
     MSD_DBG_INFO(("msdLoadDriver Exit.\n"));
     return MSD_OK;
@@ -440,6 +531,9 @@ MSD_STATUS msdUnLoadDriver
 )
 {
 	MSD_QD_DEV* dev;
+	MSD_SEM loadSem;
+	MSD_FMSD_SEM_TAKE semTake;
+	MSD_FMSD_SEM_GIVE semGive;
 
     MSD_DBG_INFO(("msdUnLoadDriver Called.\n"));
 
@@ -450,110 +544,135 @@ MSD_STATUS msdUnLoadDriver
 		return MSD_FAIL;
 	}
 
+	/* The asynchronous queue uses the semaphore functions of the device */
+	if (dev->asyncQueue != NULL)
+	{
+		MSD_DBG_ERROR(("Async queue still in use, call msdAsyncQueueDestroy first.\n"));
+		return MSD_FAIL;
+	}
+
     /* Delete the MultiAddress mode reagister access semaphore.    */
-	if (msdSemDelete(devNum, dev->multiAddrSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->multiAddrSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("multiAddrSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
  
     /* Delete the ATU semaphore.    */
-	if (msdSemDelete(devNum, dev->atuRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->atuRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("atuRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the VTU semaphore.    */
-	if (msdSemDelete(devNum, dev->vtuRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->vtuRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("vtuRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the STATS semaphore.    */
-	if (msdSemDelete(devNum, dev->statsRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->statsRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("statsRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the PIRL semaphore.    */
-	if (msdSemDelete(devNum, dev->pirlRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->pirlRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("pirlRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the PTP semaphore.    */
-	if (msdSemDelete(devNum, dev->ptpRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->ptpRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("ptpRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the PTP Mode semaphore.    */
-    if (msdSemDelete(devNum, dev->ptpModeSem) != MSD_OK)
+    if (msdUnLoadSemDelete(devNum, dev->ptpModeSem) != MSD_OK)
     {
         MSD_DBG_ERROR(("ptpModeSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the PTP Tod semaphore.    */
-    if (msdSemDelete(devNum, dev->ptpTodSem) != MSD_OK)
+    if (msdUnLoadSemDelete(devNum, dev->ptpTodSem) != MSD_OK)
     {
         MSD_DBG_ERROR(("ptpTodSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the Table semaphore.    */
-	if (msdSemDelete(devNum, dev->tblRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->tblRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("tblRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the EEPROM Configuration semaphore.    */
-	if (msdSemDelete(devNum, dev->eepromRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->eepromRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("eepromRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
     /* Delete the PHY Device semaphore.    */
-	if (msdSemDelete(devNum, dev->phyRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->phyRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("phyRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
     
     /* Delete the Qci semaphore.    */
-	if (msdSemDelete(devNum, dev->qciRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->qciRegsSem) != MSD_OK)
     {
 		MSD_DBG_ERROR(("qciRegsSem semDelete Failed.\n"));
         return MSD_FAIL;
     }
 
 	/* Delete the Qcr semaphore.    */
-	if (msdSemDelete(devNum, dev->qcrRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->qcrRegsSem) != MSD_OK)
 	{
 		MSD_DBG_ERROR(("qcrRegsSem semDelete Failed.\n"));
 		return MSD_FAIL;
 	}
+	/* Detach the FRER snapshot cache, its memory belongs to the caller */
+	if (dev->frerCache != NULL)
+	{
+		if (msdUnLoadSemDelete(devNum, dev->frerCache->lockSem) != MSD_OK)
+		{
+			MSD_DBG_ERROR(("frerCache lockSem semDelete Failed.\n"));
+			return MSD_FAIL;
+		}
+		dev->frerCache = NULL;
+	}
 	/* Delete the Frer semaphore.    */
-	if (msdSemDelete(devNum, dev->frerRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->frerRegsSem) != MSD_OK)
 	{
 		MSD_DBG_ERROR(("frerRegsSem semDelete Failed.\n"));
 		return MSD_FAIL;
 	}
 	/* Delete the APB semaphore.    */
-	if (msdSemDelete(devNum, dev->apbRegsSem) != MSD_OK)
+	if (msdUnLoadSemDelete(devNum, dev->apbRegsSem) != MSD_OK)
 	{
 		MSD_DBG_ERROR(("apbRegsSem semDelete Failed.\n"));
 		return MSD_FAIL;
 	}
 
+	loadSem = dev->loadSem;
+	semTake = dev->semTake;
+	semGive = dev->semGive;
+
+	msdLoadSemTake(loadSem, semTake);
 	msdMemSet((void*)dev, 0, sizeof(MSD_QD_DEV));
+	sohoDevsUsed[dev - sohoDevs] = MSD_FALSE;
+	sohoDevsPtr[devNum] = NULL;
+	msdLoadSemGive(loadSem, semGive);
 
 	MSD_DBG_INFO(("msdUnLoadDriver Exit.\n"));
     return MSD_OK;
@@ -1197,6 +1316,8 @@ static MSD_BOOL msdRegister(MSD_QD_DEV *dev, const MSD_BSP_FUNCTIONS* pBSPFuncti
     dev->semDelete = pBSPFunctions->semDelete;
     dev->semTake   = pBSPFunctions->semTake  ;
     dev->semGive   = pBSPFunctions->semGive  ;
+
+    dev->getHostTime = pBSPFunctions->getHostTime;
     
     return MSD_TRUE;
 }
\ No newline at end of file
@@ -29,10 +29,10 @@ void msdSetStringPrintCallback(MSD_STRING_PRINT_CALLBACK callback)
 * msdDbgLvlSet
 *
 * DESCRIPTION:
-*       This routine set debug level
+*       This routine set debug level of all modules
 *
 * INPUTS:
-*       None
+*       dbgLvl - debug level, 0 off to 3 all messages
 *
 * OUTPUTS:
 *       None
@@ -45,13 +45,26 @@ void msdSetStringPrintCallback(MSD_STRING_PRINT_CALLBACK callback)
 *******************************************************************************/
 
 #ifdef MSD_DEBUG_QD
-MSD_DBG_LEVEL dbg_level = MSD_DBG_OFF_LVL; /* Set default debug level */
+MSD_U32 msdDbgModuleMask[MSD_DBG_LVL_NUM] = { 0 }; /* Set default debug level, all off */
+
+static void msdDbgModuleMaskSet(MSD_U32 moduleVec, MSD_U8 dbgLvl)
+{
+	MSD_U32 lvl;
+
+	for (lvl = MSD_DBG_ERR_LVL; lvl < MSD_DBG_LVL_NUM; lvl++)
+	{
+		if (lvl <= dbgLvl)
+			msdDbgModuleMask[lvl] |= moduleVec;
+		else
+			msdDbgModuleMask[lvl] &= ~moduleVec;
+	}
+}
 #endif
 
 void msdDbgLvlSet(MSD_U8 dbgLvl)
 {
 	#ifdef MSD_DEBUG_QD
-	dbg_level = dbgLvl;
+	msdDbgModuleMaskSet((1U << MSD_DBG_MOD_NUM) - 1U, dbgLvl);
 	#endif
 	switch (dbgLvl)
 	{
@@ -77,6 +90,39 @@ void msdDbgLvlSet(MSD_U8 dbgLvl)
 	}
 }
 
+/*******************************************************************************
+* msdDbgModuleLvlSet
+*
+* DESCRIPTION:
+*       This routine set debug level of one module, the other modules keep
+*       their level
+*
+* INPUTS:
+*       module - debug module
+*       dbgLvl - debug level, 0 off to 3 all messages
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+void msdDbgModuleLvlSet(MSD_DBG_MODULE module, MSD_U8 dbgLvl)
+{
+	#ifdef MSD_DEBUG_QD
+	if ((MSD_U32)module < (MSD_U32)MSD_DBG_MOD_NUM)
+	{
+		msdDbgModuleMaskSet(1U << module, dbgLvl);
+	}
+	#else
+	MSD_UNUSED_PARAM(module);
+	MSD_UNUSED_PARAM(dbgLvl);
+	#endif
+}
+
 #if defined(LINUX)
  #ifdef __KERNEL__
   #include "kernel.h"
@@ -84,16 +130,21 @@ void msdDbgLvlSet(MSD_U8 dbgLvl)
   #include "stdio.h"
   #include "stdarg.h"
  #endif
+#else
+#include "stdio.h"
+#include "stdarg.h"
 #endif
 
 /*******************************************************************************
-* msdDbgPrint
+* msdDbgVPrint
 *
 * DESCRIPTION:
-*       .
+*       Formats a message behind prefix and prints it.
 *
 * INPUTS:
-*       None
+*       prefix - text printed before the message
+*       format - printf style format string
+*       argP   - arguments of format
 *
 * OUTPUTS:
 *       None
@@ -104,16 +155,19 @@ void msdDbgLvlSet(MSD_U8 dbgLvl)
 *       None
 *
 *******************************************************************************/
-#if defined(LINUX)
-void msdDbgPrint(char* format, ...)
+static void msdDbgVPrint(const char *prefix, char* format, va_list argP)
 {
-    va_list argP;
     char dbgStr[1000] = "";
+    MSD_U32 len = 0;
 
-    va_start(argP, format);
+    while ((prefix[len] != 0) && (len < 32U))
+    {
+        dbgStr[len] = prefix[len];
+        len++;
+    }
 
-    vsprintf(dbgStr, format, argP);
 #if defined(LINUX)
+    vsprintf(dbgStr + len, format, argP);
  #ifdef __KERNEL__
     if (printCallback != NULL)
         printCallback(dbgStr);
@@ -125,32 +179,696 @@ void msdDbgPrint(char* format, ...)
     else
         printf("%s", dbgStr);
  #endif
+#else
+	vsprintf_s(dbgStr + len, sizeof(dbgStr) - len, format, argP);
+	if (printCallback != NULL)
+		printCallback(dbgStr);
+	else
+		printf("%s", dbgStr);
 #endif
-    return;
 }
-#else
-#include "stdio.h"
-#include "stdarg.h"
+
+/*******************************************************************************
+* msdDbgPrint
+*
+* DESCRIPTION:
+*       .
+*
+* INPUTS:
+*       None
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
 void msdDbgPrint(char* format, ...)
 {
-    MSD_UNUSED_PARAM(format);
+    va_list argP;
+
+    va_start(argP, format);
+    msdDbgVPrint("", format, argP);
+    va_end(argP);
+}
+
+#ifdef MSD_DEBUG_QD
+
+/*
+* Debug trace ring. Every thread records into a ring of its own, the
+* single producer single consumer scheme of MSD_PTP_TS_QUEUE without a
+* lock. A record holds the format string, which identifies the log site,
+* and the raw arguments; formatting is left to msdDbgTraceDump. A full ring
+* overwrites its oldest records. Threads beyond MSD_DBG_TRACE_RING_NUM do
+* not record, their messages are counted as lost.
+*
+* The per thread ring needs thread local storage; a platform without it
+* defines MSD_THREAD_LOCAL as nothing and logs from one thread only.
+*/
+#ifndef MSD_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define MSD_THREAD_LOCAL	__declspec(thread)
+#elif defined(__GNUC__) && !defined(__KERNEL__)
+#define MSD_THREAD_LOCAL	__thread
+#else
+#define MSD_THREAD_LOCAL
+#endif
+#endif
+
+/* atomic increment returning the new value */
+#ifndef MSD_ATOMIC_INC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MSD_ATOMIC_INC(_p)	((MSD_U32)_InterlockedIncrement((volatile long*)(_p)))
+#elif defined(__GNUC__)
+#define MSD_ATOMIC_INC(_p)	__sync_add_and_fetch((_p), 1U)
+#else
+#define MSD_ATOMIC_INC(_p)	(++(*(_p)))
+#endif
+#endif
+
+#ifndef MSD_DBG_TRACE_RING_NUM
+#define MSD_DBG_TRACE_RING_NUM		8U		/* threads with a ring */
+#endif
+#ifndef MSD_DBG_TRACE_RING_SIZE
+#define MSD_DBG_TRACE_RING_SIZE		128U	/* records per ring, power of 2 */
+#endif
+#define MSD_DBG_TRACE_ARG_NUM		10U		/* arguments kept per record */
+#define MSD_DBG_TRACE_STR_SIZE		48U		/* bytes of %s arguments kept per record */
+#define MSD_DBG_TRACE_LINE_SIZE		512U	/* formatted record */
+#define MSD_DBG_TRACE_SPEC_SIZE		16U		/* one conversion specification */
+
+typedef union
+{
+	MSD_U64 u;
+	MSD_DOUBLE d;
+	const void *p;
+} MSD_DBG_TRACE_ARG;
+
+typedef struct
+{
+	const char *format;
+	MSD_U32 seq;
+	MSD_U8 level;
+	MSD_U8 numArgs;
+	MSD_U8 strSize;
+	MSD_U8 reserved;
+	MSD_DBG_TRACE_ARG arg[MSD_DBG_TRACE_ARG_NUM];
+	char str[MSD_DBG_TRACE_STR_SIZE];
+} MSD_DBG_TRACE_RECORD;
+
+typedef struct
+{
+	volatile MSD_U32 head;
+	MSD_U32 tail;
+	MSD_DBG_TRACE_RECORD record[MSD_DBG_TRACE_RING_SIZE];
+} MSD_DBG_TRACE_RING;
+
+/* printf conversion specification, starting at '%' */
+typedef struct
+{
+	MSD_U32 len;
+	char conv;
+	char size;		/* 'h', 'l', 'q' for ll, 'L' or 0 */
+	MSD_U8 stars;	/* '*' width and precision */
+} MSD_DBG_TRACE_SPEC;
+
+typedef struct
+{
+	const char *name;
+	MSD_DBG_MODULE module;
+} MSD_DBG_MODULE_NAME;
+
+/* source file names after the family prefix and "msd", prefix match */
+static const MSD_DBG_MODULE_NAME msdDbgModuleName[] =
+{
+	{ "BrgFdb", MSD_DBG_MOD_ATU },
+	{ "BrgVtu", MSD_DBG_MOD_VTU },
+	{ "BrgStu", MSD_DBG_MOD_STU },
+	{ "PortPrioMap", MSD_DBG_MOD_QOS },
+	{ "QosMap", MSD_DBG_MOD_QOS },
+	{ "QueueCtrl", MSD_DBG_MOD_QOS },
+	{ "Port", MSD_DBG_MOD_PORT },
+	{ "PhyCtrl", MSD_DBG_MOD_PORT },
+	{ "AdvVct", MSD_DBG_MOD_PORT },
+	{ "Trunk", MSD_DBG_MOD_PORT },
+	{ "Lag", MSD_DBG_MOD_PORT },
+	{ "PIRL", MSD_DBG_MOD_PIRL },
+	{ "TCAM", MSD_DBG_MOD_TCAM },
+	{ "TcamStats", MSD_DBG_MOD_TCAM },
+	{ "Arp", MSD_DBG_MOD_TCAM },
+	{ "Policy", MSD_DBG_MOD_TCAM },
+	{ "Ecid", MSD_DBG_MOD_TCAM },
+	{ "PTP", MSD_DBG_MOD_PTP },
+	{ "Ptp", MSD_DBG_MOD_PTP },
+	{ "Qav", MSD_DBG_MOD_TSN },
+	{ "Qci", MSD_DBG_MOD_TSN },
+	{ "Qcr", MSD_DBG_MOD_TSN },
+	{ "QbvGcl", MSD_DBG_MOD_TSN },
+	{ "FRER", MSD_DBG_MOD_TSN },
+	{ "MACSec", MSD_DBG_MOD_MACSEC },
+	{ "RMU", MSD_DBG_MOD_RMU },
+	{ "HwAccess", MSD_DBG_MOD_HW },
+	{ "Sem", MSD_DBG_MOD_HW }
+};
+
+static MSD_DBG_TRACE_RING msdDbgTraceRing[MSD_DBG_TRACE_RING_NUM];
+static MSD_U32 msdDbgTraceRingUsed = 0;
+static MSD_U32 msdDbgTraceSeq = 0;
+static MSD_U32 msdDbgTraceLost = 0;
+static volatile MSD_BOOL msdDbgTraceOn = MSD_FALSE;
+static MSD_THREAD_LOCAL MSD_DBG_TRACE_RING *msdDbgTraceMine = NULL;
+
+static MSD_DBG_MODULE msdDbgFileModule(const char *file)
+{
+	const char *name = file;
+	const char *s;
+	const char *n;
+	MSD_U32 i;
+
+	for (s = file; *s != 0; s++)
+	{
+		if ((*s == '/') || (*s == '\\'))
+			name = s + 1;
+	}
+	/* Fir_msdBrgFdbIntf.c */
+	if ((name[0] != 'm') || (name[1] != 's') || (name[2] != 'd'))
+	{
+		for (s = name; (*s != 0) && (*s != '_'); s++)
+			;
+		if (*s == '_')
+			name = s + 1;
+	}
+	if ((name[0] == 'm') && (name[1] == 's') && (name[2] == 'd'))
+		name += 3;
+
+	for (i = 0; i < sizeof(msdDbgModuleName) / sizeof(msdDbgModuleName[0]); i++)
+	{
+		for (s = name, n = msdDbgModuleName[i].name; (*n != 0) && (*s == *n); s++, n++)
+			;
+		if (*n == 0)
+			return msdDbgModuleName[i].module;
+	}
+
+	return MSD_DBG_MOD_SYS;
+}
+
+/*******************************************************************************
+* msdDbgOn
+*
+* DESCRIPTION:
+*       Checks if the module of a source file has a debug level enabled.
+*
+* INPUTS:
+*       level - debug level
+*       file  - source file name, __FILE__
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       MSD_TRUE if messages of level are printed
+*
+* COMMENTS:
+*       Called by the MSD_DBG macros once msdDbgModuleMask shows some module
+*       has level enabled.
+*
+*******************************************************************************/
+MSD_BOOL msdDbgOn(MSD_DBG_LEVEL level, const char *file)
+{
+	if ((MSD_U32)level >= (MSD_U32)MSD_DBG_LVL_NUM)
+		return MSD_FALSE;
+
+	return ((msdDbgModuleMask[level] & (1U << msdDbgFileModule(file))) != 0U) ? MSD_TRUE : MSD_FALSE;
+}
+
+static void msdDbgSpecParse(const char *s, MSD_DBG_TRACE_SPEC *spec)
+{
+	MSD_U32 i = 1;
+
+	spec->size = 0;
+	spec->stars = 0;
+	while ((s[i] == '-') || (s[i] == '+') || (s[i] == ' ') || (s[i] == '#') || (s[i] == '0'))
+		i++;
+	if (s[i] == '*')
+	{
+		spec->stars++;
+		i++;
+	}
+	while ((s[i] >= '0') && (s[i] <= '9'))
+		i++;
+	if (s[i] == '.')
+	{
+		i++;
+		if (s[i] == '*')
+		{
+			spec->stars++;
+			i++;
+		}
+		while ((s[i] >= '0') && (s[i] <= '9'))
+			i++;
+	}
+	if ((s[i] == 'h') || (s[i] == 'l') || (s[i] == 'L'))
+	{
+		spec->size = s[i];
+		i++;
+		if ((s[i] == s[i - 1]) && (s[i] != 'L'))
+		{
+			spec->size = (s[i] == 'l') ? 'q' : 'h';
+			i++;
+		}
+	}
+	spec->conv = s[i];
+	spec->len = (s[i] != 0) ? (i + 1U) : i;
+}
+
+/* Keep the raw arguments of format, the conversions tell their types */
+static void msdDbgTraceRecord(MSD_DBG_LEVEL level, char *format, va_list argP)
+{
+	MSD_DBG_TRACE_RING *ring = msdDbgTraceMine;
+	MSD_DBG_TRACE_RECORD *rec;
+	MSD_DBG_TRACE_SPEC spec;
+	const char *s;
+	const char *str;
+	MSD_U32 head;
+	MSD_U32 idx;
+	MSD_U32 n = 0;
+	MSD_U32 k;
+	MSD_U32 size = 0;
+	MSD_BOOL done = MSD_FALSE;
+
+	if (ring == NULL)
+	{
+		idx = MSD_DBG_TRACE_RING_NUM;
+		if (msdDbgTraceRingUsed < MSD_DBG_TRACE_RING_NUM)
+			idx = MSD_ATOMIC_INC(&msdDbgTraceRingUsed) - 1U;
+		if (idx >= MSD_DBG_TRACE_RING_NUM)
+		{
+			MSD_ATOMIC_INC(&msdDbgTraceLost);
+			return;
+		}
+		ring = &msdDbgTraceRing[idx];
+		msdDbgTraceMine = ring;
+	}
+
+	head = ring->head;
+	rec = &ring->record[head & (MSD_DBG_TRACE_RING_SIZE - 1U)];
+	rec->format = format;
+	rec->seq = MSD_ATOMIC_INC(&msdDbgTraceSeq);
+	rec->level = (MSD_U8)level;
+
+	for (s = format; (*s != 0) && (done == MSD_FALSE); s++)
+	{
+		if (*s != '%')
+			continue;
+		msdDbgSpecParse(s, &spec);
+		s += spec.len - 1U;
+		if ((spec.conv == '%') || (spec.conv == 0))
+			continue;
+		for (k = 0; (k < spec.stars) && (n < MSD_DBG_TRACE_ARG_NUM); k++)
+			rec->arg[n++].u = (MSD_U64)(MSD_32)va_arg(argP, int);
+		if (n >= MSD_DBG_TRACE_ARG_NUM)
+			break;
+
+		switch (spec.conv)
+		{
+		case 'd':
+		case 'i':
+		case 'c':
+			if (spec.size == 'q')
+				rec->arg[n].u = va_arg(argP, MSD_U64);
+			else if (spec.size == 'l')
+				rec->arg[n].u = (MSD_U64)va_arg(argP, long);
+			else
+				rec->arg[n].u = (MSD_U64)(MSD_32)va_arg(argP, int);
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'o':
+			if (spec.size == 'q')
+				rec->arg[n].u = va_arg(argP, MSD_U64);
+			else if (spec.size == 'l')
+				rec->arg[n].u = (MSD_U64)va_arg(argP, unsigned long);
+			else
+				rec->arg[n].u = (MSD_U64)va_arg(argP, unsigned int);
+			break;
+		case 'e':
+		case 'E':
+		case 'f':
+		case 'g':
+		case 'G':
+			rec->arg[n].d = va_arg(argP, double);
+			break;
+		case 'p':
+			rec->arg[n].p = va_arg(argP, void*);
+			break;
+		case 's':
+			/* the string may not outlive the call, keep a copy */
+			str = va_arg(argP, const char*);
+			if (str == NULL)
+				str = "(null)";
+			rec->arg[n].u = size;
+			while ((*str != 0) && (size < (MSD_DBG_TRACE_STR_SIZE - 1U)))
+				rec->str[size++] = *str++;
+			if (size < MSD_DBG_TRACE_STR_SIZE)
+				rec->str[size++] = 0;
+			break;
+		case 'n':
+			(void)va_arg(argP, int*);
+			break;
+		default:
+			/* unknown argument type, the rest of the arguments is lost */
+			done = MSD_TRUE;
+			break;
+		}
+		if (done == MSD_FALSE)
+			n++;
+	}
+	rec->numArgs = (MSD_U8)n;
+	rec->strSize = (MSD_U8)size;
+
+	MSD_MEM_BARRIER();
+	ring->head = head + 1U;
+}
+
+static void msdDbgEmit(MSD_DBG_LEVEL level, const char *prefix, char *format, va_list argP)
+{
+	if (msdDbgTraceOn == MSD_TRUE)
+		msdDbgTraceRecord(level, format, argP);
+	else
+		msdDbgVPrint(prefix, format, argP);
+}
+
+void msdDbgError(char* format, ...)
+{
 	va_list argP;
-	char dbgStr[1000] = "";
 
 	va_start(argP, format);
+	msdDbgEmit(MSD_DBG_ERR_LVL, "(ERROR ): ", format, argP);
+	va_end(argP);
+}
 
-	vsprintf_s(dbgStr, 1000, format, argP);
-	if (printCallback != NULL)
-		printCallback(dbgStr);
-	else
-		printf("%s", dbgStr);
+void msdDbgInfo(char* format, ...)
+{
+	va_list argP;
+
+	va_start(argP, format);
+	msdDbgEmit(MSD_DBG_INF_LVL, "(TRACE ): ", format, argP);
+	va_end(argP);
+}
+
+void msdDbgAll(char* format, ...)
+{
+	va_list argP;
 
+	va_start(argP, format);
+	msdDbgEmit(MSD_DBG_ALL_LVL, "", format, argP);
 	va_end(argP);
+}
 
+/* Append text to line, cut at MSD_DBG_TRACE_LINE_SIZE */
+static void msdDbgTraceAppend(char *line, MSD_U32 *len, const char *text, MSD_U32 textLen)
+{
+	MSD_U32 i;
+
+	for (i = 0; (i < textLen) && (text[i] != 0) && (*len < (MSD_DBG_TRACE_LINE_SIZE - 1U)); i++)
+		line[(*len)++] = text[i];
+	line[*len] = 0;
 }
 
-#endif
+/* Format one conversion with its recorded argument */
+static void msdDbgTraceConv(const MSD_DBG_TRACE_RECORD *rec, const char *s, const MSD_DBG_TRACE_SPEC *spec,
+	MSD_U32 *n, char *out)
+{
+	char fmt[MSD_DBG_TRACE_SPEC_SIZE + 8U];
+	const MSD_DBG_TRACE_ARG *arg;
+	MSD_U32 i;
+	MSD_U32 j = 0;
+	MSD_32 num;
+	MSD_U32 digits = 0;
+
+	out[0] = 0;
+	if ((spec->len >= MSD_DBG_TRACE_SPEC_SIZE) || ((*n + spec->stars) >= rec->numArgs))
+		return;
+
+	/* '*' is replaced by the recorded value, widths are kept below 100 */
+	for (i = 0; i < spec->len; i++)
+	{
+		if (s[i] == '*')
+		{
+			num = (MSD_32)rec->arg[(*n)++].u;
+			if ((num < 0) || (num > 99))
+				num = 0;
+			if (num >= 10)
+				fmt[j++] = (char)('0' + (num / 10));
+			fmt[j++] = (char)('0' + (num % 10));
+			digits = 0;
+			continue;
+		}
+		if ((s[i] >= '0') && (s[i] <= '9'))
+		{
+			if (++digits > 2U)
+				return;
+		}
+		else
+		{
+			digits = 0;
+		}
+		fmt[j++] = s[i];
+	}
+	fmt[j] = 0;
+	arg = &rec->arg[(*n)++];
+
+	switch (spec->conv)
+	{
+	case 'd':
+	case 'i':
+	case 'c':
+		if (spec->size == 'q')
+			sprintf(out, fmt, arg->u);
+		else if (spec->size == 'l')
+			sprintf(out, fmt, (long)arg->u);
+		else
+			sprintf(out, fmt, (int)arg->u);
+		break;
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'o':
+		if (spec->size == 'q')
+			sprintf(out, fmt, arg->u);
+		else if (spec->size == 'l')
+			sprintf(out, fmt, (unsigned long)arg->u);
+		else
+			sprintf(out, fmt, (unsigned int)arg->u);
+		break;
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+		sprintf(out, fmt, arg->d);
+		break;
+	case 'f':
+		/* %f of a large value has hundreds of digits */
+		if ((arg->d < 1e30) && (arg->d > -1e30))
+			sprintf(out, fmt, arg->d);
+		else
+			sprintf(out, "%e", arg->d);
+		break;
+	case 'p':
+		sprintf(out, fmt, arg->p);
+		break;
+	case 's':
+		if (arg->u < rec->strSize)
+			sprintf(out, fmt, &rec->str[arg->u]);
+		break;
+	default:
+		break;
+	}
+}
 
+static void msdDbgTracePrint(const MSD_DBG_TRACE_RECORD *rec)
+{
+	char line[MSD_DBG_TRACE_LINE_SIZE];
+	char conv[MSD_DBG_TRACE_LINE_SIZE];
+	MSD_DBG_TRACE_SPEC spec;
+	const char *s;
+	const char *text;
+	MSD_U32 len = 0;
+	MSD_U32 n = 0;
+
+	line[0] = 0;
+	if (rec->level == MSD_DBG_ERR_LVL)
+		msdDbgTraceAppend(line, &len, "(ERROR ): ", 10U);
+	else if (rec->level == MSD_DBG_INF_LVL)
+		msdDbgTraceAppend(line, &len, "(TRACE ): ", 10U);
+
+	for (s = rec->format; *s != 0; )
+	{
+		for (text = s; (*s != 0) && (*s != '%'); s++)
+			;
+		msdDbgTraceAppend(line, &len, text, (MSD_U32)(s - text));
+		if (*s == 0)
+			break;
+
+		msdDbgSpecParse(s, &spec);
+		if (spec.conv == '%')
+		{
+			msdDbgTraceAppend(line, &len, "%", 1U);
+		}
+		else if ((spec.conv != 0) && (spec.conv != 'n'))
+		{
+			msdDbgTraceConv(rec, s, &spec, &n, conv);
+			if (conv[0] != 0)
+				msdDbgTraceAppend(line, &len, conv, MSD_DBG_TRACE_LINE_SIZE);
+			else
+				msdDbgTraceAppend(line, &len, s, spec.len);
+		}
+		s += spec.len;
+	}
+
+	msdDbgPrint("%s", line);
+}
+
+/* Copy the oldest unread record of a ring, MSD_FALSE if there is none */
+static MSD_BOOL msdDbgTraceLoad(MSD_DBG_TRACE_RING *ring, MSD_U32 head, MSD_U32 *pos,
+	MSD_DBG_TRACE_RECORD *rec, MSD_U32 *overwritten)
+{
+	while (*pos != head)
+	{
+		msdMemCpy((void*)rec, (const void*)&ring->record[*pos & (MSD_DBG_TRACE_RING_SIZE - 1U)],
+			sizeof(MSD_DBG_TRACE_RECORD));
+		MSD_MEM_BARRIER();
+		/* the slot is rewritten once the writer reaches pos + size */
+		if ((ring->head - *pos) < MSD_DBG_TRACE_RING_SIZE)
+			return MSD_TRUE;
+		(*pos)++;
+		(*overwritten)++;
+	}
+
+	return MSD_FALSE;
+}
+#endif /* MSD_DEBUG_QD */
+
+/*******************************************************************************
+* msdDbgTraceSet
+*
+* DESCRIPTION:
+*       This routine switches the debug messages between printing and the
+*       trace ring. In the trace ring, a message is recorded as its format
+*       string and raw arguments and formatted only by msdDbgTraceDump.
+*
+* INPUTS:
+*       enable - MSD_TRUE to record into the trace ring, MSD_FALSE to print
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*
+* COMMENTS:
+*       Which messages are recorded is still set by msdDbgLvlSet and
+*       msdDbgModuleLvlSet. Each thread records into a ring of its own,
+*       MSD_DBG_TRACE_RING_NUM threads at most.
+*
+*******************************************************************************/
+void msdDbgTraceSet(MSD_BOOL enable)
+{
+	#ifdef MSD_DEBUG_QD
+	msdDbgTraceOn = enable;
+	#else
+	MSD_UNUSED_PARAM(enable);
+	#endif
+}
+
+/*******************************************************************************
+* msdDbgTraceDump
+*
+* DESCRIPTION:
+*       This routine formats and prints the records of all trace rings in the
+*       order they were recorded, and empties the rings.
+*
+* INPUTS:
+*       None
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       Number of records printed
+*
+* COMMENTS:
+*       Format strings must stay valid until the dump, %s arguments are
+*       copied into the record and cut at MSD_DBG_TRACE_STR_SIZE bytes in
+*       total. Only one thread may dump at a time, recording goes on while
+*       it does.
+*
+*******************************************************************************/
+MSD_U32 msdDbgTraceDump(void)
+{
+	MSD_U32 printed = 0;
+	#ifdef MSD_DEBUG_QD
+	MSD_DBG_TRACE_RECORD rec[MSD_DBG_TRACE_RING_NUM];
+	MSD_BOOL valid[MSD_DBG_TRACE_RING_NUM];
+	MSD_U32 head[MSD_DBG_TRACE_RING_NUM];
+	MSD_U32 pos[MSD_DBG_TRACE_RING_NUM];
+	MSD_U32 numRings;
+	MSD_U32 overwritten = 0;
+	MSD_U32 lost;
+	MSD_U32 r;
+	MSD_U32 oldest;
+
+	numRings = msdDbgTraceRingUsed;
+	if (numRings > MSD_DBG_TRACE_RING_NUM)
+		numRings = MSD_DBG_TRACE_RING_NUM;
+
+	for (r = 0; r < numRings; r++)
+	{
+		head[r] = msdDbgTraceRing[r].head;
+		MSD_MEM_BARRIER();
+		pos[r] = msdDbgTraceRing[r].tail;
+		if ((head[r] - pos[r]) > MSD_DBG_TRACE_RING_SIZE)
+		{
+			overwritten += head[r] - pos[r] - MSD_DBG_TRACE_RING_SIZE;
+			pos[r] = head[r] - MSD_DBG_TRACE_RING_SIZE;
+		}
+		valid[r] = msdDbgTraceLoad(&msdDbgTraceRing[r], head[r], &pos[r], &rec[r], &overwritten);
+	}
+
+	/* merge the rings by sequence number */
+	for (;;)
+	{
+		oldest = numRings;
+		for (r = 0; r < numRings; r++)
+		{
+			if ((valid[r] == MSD_TRUE) &&
+				((oldest == numRings) || ((MSD_32)(rec[r].seq - rec[oldest].seq) < 0)))
+				oldest = r;
+		}
+		if (oldest == numRings)
+			break;
+
+		msdDbgTracePrint(&rec[oldest]);
+		printed++;
+		pos[oldest]++;
+		valid[oldest] = msdDbgTraceLoad(&msdDbgTraceRing[oldest], head[oldest], &pos[oldest], &rec[oldest], &overwritten);
+	}
+
+	for (r = 0; r < numRings; r++)
+		msdDbgTraceRing[r].tail = pos[r];
+
+	lost = msdDbgTraceLost;
+	msdDbgTraceLost = 0;
+	if ((overwritten != 0U) || (lost != 0U))
+		MSG(("%u trace records overwritten, %u lost\n", (unsigned int)overwritten, (unsigned int)lost));
+	#endif
+
+	return printed;
+}
 
 char* msdDisplayStatus(MSD_STATUS status)
 {
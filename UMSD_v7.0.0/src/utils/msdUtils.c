@@ -302,3 +302,26 @@ MSD_U8 msdShort2Char(MSD_U16 data)
     return msd32_2_8[dataL&0xff];
 }
 
+MSD_U16 msdCrc16(MSD_U16 crc, const MSD_U16 *data, MSD_U32 count)
+{
+    MSD_U32 i;
+    MSD_U8 bit;
+
+    for (i = 0; i < count; i++)
+    {
+        crc = crc ^ (MSD_U16)((data[i] & 0xffU) << 8);
+        for (bit = 0; bit < 8U; bit++)
+        {
+            if ((crc & 0x8000U) != 0U)
+            {
+                crc = (MSD_U16)((crc << 1) ^ 0x1021U);
+            }
+            else
+            {
+                crc = (MSD_U16)(crc << 1);
+            }
+        }
+    }
+
+    return crc;
+}